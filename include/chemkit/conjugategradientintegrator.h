@@ -0,0 +1 @@
+#include "../../src/md/conjugategradientintegrator.h"
@@ -0,0 +1 @@
+#include "../../src/chemkit/spatialgrid.h"
@@ -0,0 +1 @@
+#include "../../src/md-io/trajectoryfilereader.h"
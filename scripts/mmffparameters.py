@@ -0,0 +1,213 @@
+###############################################################################
+##
+## Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+## All rights reserved.
+##
+## This file is a part of the chemkit project. For more information
+## see <http://www.chemkit.org>.
+##
+## Redistribution and use in source and binary forms, with or without
+## modification, are permitted provided that the following conditions
+## are met:
+##
+##   * Redistributions of source code must retain the above copyright
+##     notice, this list of conditions and the following disclaimer.
+##   * Redistributions in binary form must reproduce the above copyright
+##     notice, this list of conditions and the following disclaimer in the
+##     documentation and/or other materials provided with the distribution.
+##   * Neither the name of the chemkit project nor the names of its
+##     contributors may be used to endorse or promote products derived
+##     from this software without specific prior written permission.
+##
+## THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+## "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+## LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+## A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+## OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+## SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+## LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+## DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+## THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+## (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+## OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+##
+###############################################################################
+
+# Generates the compiled-in MMFF94 parameter tables from the text
+# parameter file. The tables are sorted by the same indices used by
+# the MmffParameters::calculate*Index() methods.
+#
+# Usage: python mmffparameters.py src/plugins/mmff/data/mmff94.prm \
+#            > src/plugins/mmff/mmff94parameters.cpp
+
+import sys
+
+LICENSE = """/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+"""
+
+MAX_ATOM_TYPE = 99
+
+SECTIONS = ["BondStrech", "EmpiricalBondStrech", "AngleBend", "StrechBend",
+            "DefaultStrechBend", "OutOfPlaneBending", "Torsion", "VanDerWaals",
+            "Charge", "PartialCharge", "End"]
+
+def bondStrechIndex(bondType, a, b):
+    return 2 * (a * 136 + b) + bondType
+
+def angleBendIndex(angleType, a, b, c):
+    return 9 * (b * (136*136) + a * 136 + c) + angleType
+
+def strechBendIndex(strechBendType, a, b, c):
+    return 12 * (b * (136*136) + a * 136 + c) + strechBendType
+
+def outOfPlaneBendingIndex(a, b, c, d):
+    return b * (136*136*136) + a * (136*136) + c * 136 + d
+
+def torsionIndex(torsionType, a, b, c, d):
+    return 6 * (b * (136*136*136) + c * (136*136) + a * 136 + d) + torsionType
+
+def readParameters(fileName):
+    tables = dict((name, {}) for name in ["BondStrech", "AngleBend", "StrechBend",
+                                          "OutOfPlaneBending", "Torsion", "Charge",
+                                          "VanDerWaals", "PartialCharge"])
+    defaultStrechBend = []
+
+    section = 0
+    for line in open(fileName):
+        line = line.rstrip("\n").lstrip()
+
+        if line.startswith("$"):
+            section += 1
+            if SECTIONS[section] == "End":
+                break
+            continue
+        elif line.startswith("#"):
+            continue
+
+        data = [item for item in line.split(" ") if item]
+        if len(data) < 2:
+            continue
+
+        name = SECTIONS[section]
+        if name == "BondStrech":
+            index = bondStrechIndex(int(data[0]), int(data[1]), int(data[2]))
+            tables[name][index] = (data[3], data[4])
+        elif name == "AngleBend":
+            index = angleBendIndex(int(data[0]), int(data[1]), int(data[2]), int(data[3]))
+            tables[name][index] = (data[4], data[5])
+        elif name == "StrechBend":
+            index = strechBendIndex(int(data[0]), int(data[1]), int(data[2]), int(data[3]))
+            tables[name][index] = (data[4], data[5])
+        elif name == "DefaultStrechBend":
+            defaultStrechBend.append((data[0], data[1], data[2], data[3], data[4]))
+        elif name == "OutOfPlaneBending":
+            index = outOfPlaneBendingIndex(int(data[0]), int(data[1]), int(data[2]), int(data[3]))
+            tables[name][index] = (data[4],)
+        elif name == "Torsion":
+            index = torsionIndex(int(data[0]), int(data[1]), int(data[2]), int(data[3]), int(data[4]))
+            tables[name][index] = (data[5], data[6], data[7])
+        elif name == "VanDerWaals":
+            if int(data[0]) <= MAX_ATOM_TYPE:
+                tables[name][int(data[0])] = (data[1], data[2], data[3], data[4], "'%s'" % data[5][0])
+        elif name == "Charge":
+            index = bondStrechIndex(int(data[0]), int(data[1]), int(data[2]))
+            tables[name][index] = (data[0], data[1], data[2], data[3])
+        elif name == "PartialCharge":
+            if int(data[1]) <= MAX_ATOM_TYPE:
+                tables[name][int(data[1])] = (data[2], data[3])
+
+    return tables, defaultStrechBend
+
+def printTable(name, parametersType, table):
+    print("const MmffParametersEntry<%s> %sParameters[] = {" % (parametersType, name))
+    for index in sorted(table):
+        print("    {%d, {%s}}," % (index, ", ".join(table[index])))
+    print("};")
+    print("")
+
+if __name__ == '__main__':
+    tables, defaultStrechBend = readParameters(sys.argv[1])
+
+    print(LICENSE)
+    print("// This file was generated from data/mmff94.prm by")
+    print("// scripts/mmffparameters.py. Do not edit it by hand.")
+    print("")
+    print("#include \"mmffparametersdata.h\"")
+    print("")
+    print("namespace {")
+    print("")
+    printTable("BondStrech", "MmffBondStrechParameters", tables["BondStrech"])
+    printTable("AngleBend", "MmffAngleBendParameters", tables["AngleBend"])
+    printTable("StrechBend", "MmffStrechBendParameters", tables["StrechBend"])
+    print("const MmffDefaultStrechBendParameters DefaultStrechBendParameters[] = {")
+    for row in defaultStrechBend:
+        print("    {%s, %s, %s, {%s, %s}}," % row)
+    print("};")
+    print("")
+    printTable("OutOfPlaneBending", "MmffOutOfPlaneBendingParameters", tables["OutOfPlaneBending"])
+    printTable("Torsion", "MmffTorsionParameters", tables["Torsion"])
+    printTable("VanDerWaals", "MmffVanDerWaalsParameters", tables["VanDerWaals"])
+    printTable("Charge", "MmffChargeParameters", tables["Charge"])
+    printTable("PartialCharge", "MmffPartialChargeParameters", tables["PartialCharge"])
+    print("template<typename T, size_t N>")
+    print("size_t count(const T (&)[N])")
+    print("{")
+    print("    return N;")
+    print("}")
+    print("")
+    print("} // end anonymous namespace")
+    print("")
+    print("// --- MMFF94 Parameters --------------------------------------------------- //")
+    print("/// Sets the parameters to the MMFF94 parameters.")
+    print("void MmffParametersData::setMmff94Parameters()")
+    print("{")
+    print("    bondStrechParameters.assign(BondStrechParameters, count(BondStrechParameters));")
+    print("    angleBendParameters.assign(AngleBendParameters, count(AngleBendParameters));")
+    print("    strechBendParameters.assign(StrechBendParameters, count(StrechBendParameters));")
+    print("    defaultStrechBendParameters.assign(DefaultStrechBendParameters,")
+    print("                                       DefaultStrechBendParameters + count(DefaultStrechBendParameters));")
+    print("    outOfPlaneBendingParameters.assign(OutOfPlaneBendingParameters, count(OutOfPlaneBendingParameters));")
+    print("    torsionParameters.assign(TorsionParameters, count(TorsionParameters));")
+    print("    chargeParameters.assign(ChargeParameters, count(ChargeParameters));")
+    print("")
+    print("    for(size_t i = 0; i < count(VanDerWaalsParameters); i++){")
+    print("        vanDerWaalsParameters[VanDerWaalsParameters[i].index] = VanDerWaalsParameters[i].parameters;")
+    print("    }")
+    print("")
+    print("    for(size_t i = 0; i < count(PartialChargeParameters); i++){")
+    print("        partialChargeParameters[PartialChargeParameters[i].index] = PartialChargeParameters[i].parameters;")
+    print("    }")
+    print("}")
@@ -0,0 +1,213 @@
+###############################################################################
+##
+## Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+## All rights reserved.
+##
+## This file is a part of the chemkit project. For more information
+## see <http://www.chemkit.org>.
+##
+## Redistribution and use in source and binary forms, with or without
+## modification, are permitted provided that the following conditions
+## are met:
+##
+##   * Redistributions of source code must retain the above copyright
+##     notice, this list of conditions and the following disclaimer.
+##   * Redistributions in binary form must reproduce the above copyright
+##     notice, this list of conditions and the following disclaimer in the
+##     documentation and/or other materials provided with the distribution.
+##   * Neither the name of the chemkit project nor the names of its
+##     contributors may be used to endorse or promote products derived
+##     from this software without specific prior written permission.
+##
+## THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+## "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+## LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+## A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+## OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+## SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+## LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+## DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+## THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+## (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+## OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+##
+###############################################################################
+
+# Generates the compiled-in OPLS-AA parameter tables from the text
+# parameter file. The bond, angle and torsion tables are sorted by their
+# atom classes in the same order used by OplsParameters::sort().
+#
+# Usage: python oplsparameters.py src/plugins/opls/data/oplsaa.prm \
+#            > src/plugins/opls/oplsaaparameters.cpp
+
+import sys
+
+LICENSE = """/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+"""
+
+def readParameters(fileName):
+    atoms = []
+    bonds = []
+    angles = []
+    torsions = []
+    vanDerWaals = []
+    charges = []
+
+    for line in open(fileName):
+        line = line.rstrip("\n")
+        items = line.replace("\t", " ").split(" ")
+        items = [items[0]] + [item for item in items[1:] if item]
+
+        if line.startswith("atom"):
+            if len(items) >= 4:
+                atoms.append((items[1], items[2], "\"%s\"" % items[3]))
+        elif line.startswith("bond"):
+            if len(items) >= 5:
+                bonds.append(((int(items[1]), int(items[2])), items[3], items[4]))
+        elif line.startswith("angle"):
+            if len(items) >= 6:
+                angles.append(((int(items[1]), int(items[2]), int(items[3])), items[4], items[5]))
+        elif line.startswith("torsion"):
+            if len(items) >= 14:
+                torsions.append(((int(items[1]), int(items[2]), int(items[3]), int(items[4])),
+                                 items[5], items[8], items[11]))
+        elif line.startswith("vdw"):
+            if len(items) >= 4:
+                vanDerWaals.append((items[1], items[2], items[3]))
+        elif line.startswith("charge"):
+            if len(items) >= 3:
+                charges.append((items[1], items[2]))
+
+    # sort is stable so the first of any duplicate entries is kept first
+    bonds.sort(key=lambda row: row[0])
+    angles.sort(key=lambda row: row[0])
+    torsions.sort(key=lambda row: row[0])
+
+    return atoms, bonds, angles, torsions, vanDerWaals, charges
+
+def printTable(name, type, rows):
+    print("const %s %s[] = {" % (type, name))
+    for row in rows:
+        print("    {%s}," % ", ".join(row))
+    print("};")
+    print("")
+
+def classRows(rows):
+    return [tuple(str(klass) for klass in row[0]) + row[1:] for row in rows]
+
+if __name__ == '__main__':
+    atoms, bonds, angles, torsions, vanDerWaals, charges = readParameters(sys.argv[1])
+
+    print(LICENSE)
+    print("// This file was generated from data/oplsaa.prm by")
+    print("// scripts/oplsparameters.py. Do not edit it by hand.")
+    print("")
+    print("#include \"oplsparameters.h\"")
+    print("")
+    print("namespace {")
+    print("")
+    print("struct OplsAtomData")
+    print("{")
+    print("    int type;")
+    print("    int klass;")
+    print("    const char *name;")
+    print("};")
+    print("")
+    print("struct OplsVanDerWaalsData")
+    print("{")
+    print("    int type;")
+    print("    OplsVanDerWaalsParameters parameters;")
+    print("};")
+    print("")
+    print("struct OplsChargeData")
+    print("{")
+    print("    int type;")
+    print("    chemkit::Real charge;")
+    print("};")
+    print("")
+    printTable("AtomData", "OplsAtomData", atoms)
+    printTable("BondStrechParameters", "OplsBondStrechParameters", classRows(bonds))
+    printTable("AngleBendParameters", "OplsAngleBendParameters", classRows(angles))
+    printTable("TorsionParameters", "OplsTorsionParameters", classRows(torsions))
+    print("const OplsVanDerWaalsData VanDerWaalsData[] = {")
+    for row in vanDerWaals:
+        print("    {%s, {%s, %s}}," % row)
+    print("};")
+    print("")
+    printTable("ChargeData", "OplsChargeData", charges)
+    print("template<typename T, size_t N>")
+    print("size_t count(const T (&)[N])")
+    print("{")
+    print("    return N;")
+    print("}")
+    print("")
+    print("} // end anonymous namespace")
+    print("")
+    print("// --- OPLS-AA Parameters -------------------------------------------------- //")
+    print("void OplsParameters::setOplsAaParameters()")
+    print("{")
+    print("    for(size_t i = 0; i < count(AtomData); i++){")
+    print("        const OplsAtomData &data = AtomData[i];")
+    print("")
+    print("        if(m_typeToClass.size() < static_cast<size_t>(data.type + 1))")
+    print("            m_typeToClass.resize(data.type + 1);")
+    print("        m_typeToClass[data.type] = data.klass;")
+    print("")
+    print("        if(m_typeToName.size() < static_cast<size_t>(data.type + 1))")
+    print("            m_typeToName.resize(data.type + 1);")
+    print("        m_typeToName[data.type] = data.name;")
+    print("    }")
+    print("")
+    print("    m_bondStrechParameters.assign(BondStrechParameters, BondStrechParameters + count(BondStrechParameters));")
+    print("    m_angleBendParameters.assign(AngleBendParameters, AngleBendParameters + count(AngleBendParameters));")
+    print("    m_torsionParameters.assign(TorsionParameters, TorsionParameters + count(TorsionParameters));")
+    print("")
+    print("    for(size_t i = 0; i < count(VanDerWaalsData); i++){")
+    print("        const OplsVanDerWaalsData &data = VanDerWaalsData[i];")
+    print("")
+    print("        if(m_vanDerWaalsParameters.size() < static_cast<size_t>(data.type + 1))")
+    print("            m_vanDerWaalsParameters.resize(data.type + 1);")
+    print("        m_vanDerWaalsParameters[data.type] = data.parameters;")
+    print("    }")
+    print("")
+    print("    for(size_t i = 0; i < count(ChargeData); i++){")
+    print("        const OplsChargeData &data = ChargeData[i];")
+    print("")
+    print("        if(m_typeToCharge.size() < static_cast<size_t>(data.type + 1))")
+    print("            m_typeToCharge.resize(data.type + 1);")
+    print("        m_typeToCharge[data.type] = data.charge;")
+    print("    }")
+    print("}")
@@ -41,6 +41,7 @@
 #include <boost/algorithm/string.hpp>
 
 #include <chemkit/chemkit.h>
+#include <chemkit/molecule.h>
 #include <chemkit/moleculefile.h>
 
 void printHelp(char *argv[], const boost::program_options::options_description &options)
@@ -104,23 +105,20 @@ int main(int argc, char *argv[])
         return -1;
     }
 
-    // read input
+    // open input
     chemkit::MoleculeFile inputFile;
-    if(!inputFormatName.empty()){
-        inputFile.setFormat(inputFormatName);
+    if(!inputFormatName.empty() && !inputFile.setFormat(inputFormatName)){
+        std::cerr << "Error: Failed to read input file: " << inputFile.errorString() << std::endl;
+        return -1;
     }
 
     bool ok = false;
     if(inputFileName == "-"){
-        ok = inputFile.read(std::cin);
+        ok = inputFile.beginRead(std::cin);
     }
     else{
-        if(inputFormatName.empty()){
-            ok = inputFile.read(inputFileName);
-        }
-        else{
-            ok = inputFile.read(inputFileName, inputFormatName);
-        }
+        inputFile.setFileName(inputFileName);
+        ok = inputFile.beginRead();
     }
 
     if(!ok){
@@ -128,21 +126,42 @@ int main(int argc, char *argv[])
         return -1;
     }
 
-    // write output
-    if(outputFormatName.empty()){
-        ok = inputFile.write(outputFileName);
+    // open output
+    chemkit::MoleculeFile outputFile;
+    if(!outputFormatName.empty() && !outputFile.setFormat(outputFormatName)){
+        std::cerr << "Error: failed to write output file: " << outputFile.errorString() << std::endl;
+        return -1;
+    }
+
+    if(outputFileName == "-"){
+        ok = outputFile.beginWrite(std::cout);
     }
     else{
-        if(outputFileName == "-"){
-            ok = inputFile.write(std::cout, outputFormatName);
-        }
-        else{
-            ok = inputFile.write(outputFileName, outputFormatName);
-        }
+        outputFile.setFileName(outputFileName);
+        ok = outputFile.beginWrite();
     }
 
     if(!ok){
-        std::cerr << "Error: failed to write output file: " << inputFile.errorString() << std::endl;
+        std::cerr << "Error: failed to write output file: " << outputFile.errorString() << std::endl;
+        return -1;
+    }
+
+    // convert each molecule as it is read so that only a single
+    // molecule is kept in memory at a time
+    while(boost::shared_ptr<chemkit::Molecule> molecule = inputFile.readNext()){
+        if(!outputFile.writeNext(molecule.get())){
+            std::cerr << "Error: failed to write output file: " << outputFile.errorString() << std::endl;
+            return -1;
+        }
+    }
+
+    if(!inputFile.errorString().empty()){
+        std::cerr << "Error: Failed to read input file: " << inputFile.errorString() << std::endl;
+        return -1;
+    }
+
+    if(!outputFile.endWrite()){
+        std::cerr << "Error: failed to write output file: " << outputFile.errorString() << std::endl;
         return -1;
     }
 
@@ -0,0 +1,203 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iostream>
+
+#include <boost/program_options.hpp>
+#include <boost/algorithm/string.hpp>
+
+#include <chemkit/chemkit.h>
+#include <chemkit/molecule.h>
+#include <chemkit/moleculefile.h>
+#include <chemkit/descriptorcalculator.h>
+
+// number of molecules read and calculated at once
+const size_t batchSize = 1024;
+
+void printHelp(char *argv[], const boost::program_options::options_description &options)
+{
+    std::cout << "Usage: " << argv[0] << " [OPTIONS] FILE\n";
+    std::cout << "\n";
+    std::cout << "Calculate molecular descriptors for each molecule in FILE. The\n";
+    std::cout << "results are output in CSV format with a row for each molecule\n";
+    std::cout << "and a column for each descriptor.\n";
+    std::cout << "\n";
+    std::cout << "Options:\n";
+    std::cout << options << "\n";
+}
+
+int main(int argc, char *argv[])
+{
+    std::string fileName;
+    std::string outputFileName;
+    std::string descriptorList = "mass,heavy-atom-count,ring-count,tpsa";
+    size_t threadCount = 1;
+
+    boost::program_options::options_description options;
+    options.add_options()
+        ("file",
+            boost::program_options::value<std::string>(&fileName),
+            "Input file.")
+        ("descriptors,d",
+            boost::program_options::value<std::string>(&descriptorList),
+            "Comma-separated list of descriptors to calculate.")
+        ("output,o",
+            boost::program_options::value<std::string>(&outputFileName),
+            "Output file (default is standard output).")
+        ("binary,b",
+            "Write the output in binary format (requires --output).")
+        ("threads,t",
+            boost::program_options::value<size_t>(&threadCount),
+            "Number of threads to calculate descriptors with (0 uses one per core).")
+        ("help,h",
+            "Shows this help message");
+
+    boost::program_options::positional_options_description positionalOptions;
+    positionalOptions.add("file", 1);
+
+    boost::program_options::variables_map variables;
+    boost::program_options::store(
+        boost::program_options::command_line_parser(argc, argv)
+            .options(options)
+            .positional(positionalOptions).run(),
+        variables);
+    boost::program_options::notify(variables);
+
+    bool binary = variables.find("binary") != variables.end();
+
+    if(variables.count("help")){
+        printHelp(argv, options);
+        return 0;
+    }
+    else if(fileName.empty()){
+        printHelp(argv, options);
+        std::cerr << "Error: no input file given." << std::endl;
+        return -1;
+    }
+    else if(binary && outputFileName.empty()){
+        printHelp(argv, options);
+        std::cerr << "Error: binary output requires an output file." << std::endl;
+        return -1;
+    }
+
+    std::vector<std::string> descriptors;
+    boost::algorithm::split(descriptors, descriptorList, boost::algorithm::is_any_of(","));
+
+    chemkit::DescriptorCalculator calculator;
+    if(!calculator.setDescriptors(descriptors)){
+        std::cerr << "Error: " << calculator.errorString() << std::endl;
+        return -1;
+    }
+
+    calculator.setThreadCount(threadCount);
+
+    // open input file
+    chemkit::MoleculeFile inputFile(fileName);
+    if(!inputFile.beginRead()){
+        std::cerr << "Error: failed to read input file: " << inputFile.errorString() << std::endl;
+        return -1;
+    }
+
+    // open output
+    std::ofstream outputFile;
+    if(!outputFileName.empty()){
+        outputFile.open(outputFileName.c_str(), binary ? std::ios_base::out | std::ios_base::binary : std::ios_base::out);
+        if(!outputFile.is_open()){
+            std::cerr << "Error: failed to open output file: " << outputFileName << std::endl;
+            return -1;
+        }
+    }
+
+    std::ostream &output = outputFile.is_open() ? outputFile : std::cout;
+
+    // the number of rows is not known until the whole input file has
+    // been read, so the binary header is rewritten at the end
+    if(binary){
+        chemkit::DescriptorCalculator::writeBinaryHeader(output, descriptors, 0);
+    }
+
+    size_t rowCount = 0;
+
+    for(;;){
+        std::vector<boost::shared_ptr<chemkit::Molecule> > batch;
+        batch.reserve(batchSize);
+
+        while(batch.size() < batchSize){
+            boost::shared_ptr<chemkit::Molecule> molecule = inputFile.readNext();
+            if(!molecule){
+                break;
+            }
+
+            batch.push_back(molecule);
+        }
+
+        // an empty input file still outputs the csv header
+        if(!batch.empty() || (rowCount == 0 && !binary)){
+            calculator.calculate(batch);
+
+            bool ok = binary ? calculator.writeBinary(output, false)
+                             : calculator.writeCsv(output, rowCount == 0);
+            if(!ok){
+                std::cerr << "Error: failed to write output." << std::endl;
+                return -1;
+            }
+
+            rowCount += batch.size();
+        }
+
+        if(batch.size() < batchSize){
+            break;
+        }
+    }
+
+    if(!inputFile.errorString().empty()){
+        std::cerr << "Error: failed to read input file: " << inputFile.errorString() << std::endl;
+        return -1;
+    }
+
+    if(binary){
+        output.seekp(0);
+        if(!chemkit::DescriptorCalculator::writeBinaryHeader(output, descriptors, rowCount)){
+            std::cerr << "Error: failed to write output." << std::endl;
+            return -1;
+        }
+    }
+
+    return 0;
+}
@@ -143,7 +143,10 @@ int main(int argc, char *argv[])
 
     if(!variables.count("no-optimization")){
         // optimize 3d coordinates
-        chemkit::MoleculeGeometryOptimizer::optimizeCoordinates(molecule.get());
+        chemkit::MoleculeGeometryOptimizer optimizer(molecule.get());
+        optimizer.setAlgorithm(chemkit::MoleculeGeometryOptimizer::Lbfgs);
+        optimizer.setEnergyTolerance(1e-6);
+        optimizer.optimize();
     }
 
     // set center to origin
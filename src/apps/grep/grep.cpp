@@ -33,20 +33,28 @@
 **
 ******************************************************************************/
 
+#include <deque>
 #include <string>
+#include <vector>
 #include <iostream>
 
+#include <boost/bind.hpp>
 #include <boost/scoped_ptr.hpp>
 #include <boost/program_options.hpp>
 #include <boost/algorithm/string.hpp>
 
 #include <chemkit/chemkit.h>
-#include <chemkit/foreach.h>
 #include <chemkit/molecule.h>
 #include <chemkit/lineformat.h>
+#include <chemkit/threadpool.h>
 #include <chemkit/moleculefile.h>
 #include <chemkit/substructurequery.h>
 
+typedef std::vector<boost::shared_ptr<chemkit::Molecule> > MoleculeBatch;
+
+// number of molecules passed to a worker thread at once
+const size_t batchSize = 64;
+
 void printHelp(char *argv[], const boost::program_options::options_description &options)
 {
     std::cout << "Usage: " << argv[0] << " [OPTIONS] PATTERN FILE\n";
@@ -60,10 +68,46 @@ void printHelp(char *argv[], const boost::program_options::options_description &
     std::cout << options << "\n";
 }
 
+// Returns the molecules from batch which should be output.
+MoleculeBatch matchBatch(const chemkit::SubstructureQuery *query,
+                         const MoleculeBatch &batch,
+                         bool invertMatch)
+{
+    MoleculeBatch matches;
+
+    for(size_t i = 0; i < batch.size(); i++){
+        bool match = query->matches(batch[i].get());
+
+        if(match != invertMatch){
+            matches.push_back(batch[i]);
+        }
+    }
+
+    return matches;
+}
+
+// Writes the matching molecules to the output. Returns false if
+// writing fails.
+bool writeMatches(const MoleculeBatch &matches, chemkit::MoleculeFile &outputFile, bool namesOnly)
+{
+    for(size_t i = 0; i < matches.size(); i++){
+        if(namesOnly){
+            std::cout << matches[i]->name() << "\n";
+        }
+        else if(!outputFile.writeNext(matches[i].get())){
+            std::cerr << "Error: failed to write output file: " << outputFile.errorString() << std::endl;
+            return false;
+        }
+    }
+
+    return true;
+}
+
 int main(int argc, char *argv[])
 {
     std::string formula;
     std::string fileName;
+    size_t threadCount = 1;
 
     boost::program_options::options_description options;
     options.add_options()
@@ -81,6 +125,11 @@ int main(int argc, char *argv[])
             "Return only non-matching molecules.")
         ("names-only,n",
             "Output only the names of matching molecules.")
+        ("screen,s",
+            "Screen molecules by fingerprint before matching and report the screen-out rate.")
+        ("threads,t",
+            boost::program_options::value<size_t>(&threadCount),
+            "Number of threads to match molecules with (0 uses one per core).")
         ("help,h",
             "Shows this help message");
 
@@ -133,9 +182,9 @@ int main(int argc, char *argv[])
         return -1;
     }
 
-    // read input file
+    // open input file
     chemkit::MoleculeFile inputFile(fileName);
-    if(!inputFile.read()){
+    if(!inputFile.beginRead()){
         std::cerr << "Error: failed to read input file: " << inputFile.errorString() << std::endl;
         return -1;
     }
@@ -145,6 +194,7 @@ int main(int argc, char *argv[])
     bool exactMatch = variables.find("exact-match") != variables.end();
     bool invertMatch = variables.find("invert-match") != variables.end();
     bool namesOnly = variables.find("names-only") != variables.end();
+    bool screen = variables.find("screen") != variables.end();
 
     int flags = 0;
     if(compositionOnly){
@@ -157,28 +207,84 @@ int main(int argc, char *argv[])
     chemkit::SubstructureQuery query;
     query.setMolecule(patternMolecule);
     query.setFlags(flags);
+    query.setScreeningEnabled(screen);
 
+    // open output
     chemkit::MoleculeFile outputFile;
+    if(!namesOnly){
+        outputFile.setFormat(inputFile.formatName());
+        if(!outputFile.beginWrite(std::cout)){
+            std::cerr << "Error: failed to write output file: " << outputFile.errorString() << std::endl;
+            return -1;
+        }
+    }
 
-    foreach(const boost::shared_ptr<chemkit::Molecule> &molecule, inputFile.molecules()){
-        bool match = query.matches(molecule.get());
+    // molecules are read in batches on this thread and matched on the
+    // thread pool. batches are written out in the order they were read
+    // so the output does not depend on the number of threads.
+    boost::scoped_ptr<chemkit::ThreadPool> pool;
+    if(threadCount != 1){
+        pool.reset(new chemkit::ThreadPool(threadCount));
+    }
 
-        if((match && !invertMatch) || (!match && invertMatch)){
-            outputFile.addMolecule(molecule);
+    // limit the number of batches in flight to bound memory use
+    const size_t maxPendingBatches = pool ? 2 * pool->threadCount() : 0;
+    std::deque<boost::shared_future<MoleculeBatch> > pendingBatches;
+
+    for(;;){
+        MoleculeBatch batch;
+        batch.reserve(batchSize);
+
+        while(batch.size() < batchSize){
+            boost::shared_ptr<chemkit::Molecule> molecule = inputFile.readNext();
+            if(!molecule){
+                break;
+            }
+
+            batch.push_back(molecule);
         }
-    }
 
-    if(namesOnly){
-        foreach(const boost::shared_ptr<chemkit::Molecule> &molecule, outputFile.molecules()){
-            std::cout << molecule->name() << "\n";
+        bool done = batch.size() < batchSize;
+
+        if(!pool){
+            if(!writeMatches(matchBatch(&query, batch, invertMatch), outputFile, namesOnly)){
+                return -1;
+            }
         }
-    }
-    else{
-        bool ok = outputFile.write(std::cout, inputFile.formatName());
-        if(!ok){
-            std::cerr << "Error: failed to write output file: " << outputFile.errorString() << std::endl;
-            return -1;
+        else{
+            if(!batch.empty()){
+                pendingBatches.push_back(pool->run(boost::bind(matchBatch, &query, batch, invertMatch)));
+            }
+
+            while(!pendingBatches.empty() && (done || pendingBatches.size() > maxPendingBatches)){
+                if(!writeMatches(pendingBatches.front().get(), outputFile, namesOnly)){
+                    return -1;
+                }
+
+                pendingBatches.pop_front();
+            }
         }
+
+        if(done){
+            break;
+        }
+    }
+
+    if(!inputFile.errorString().empty()){
+        std::cerr << "Error: failed to read input file: " << inputFile.errorString() << std::endl;
+        return -1;
+    }
+
+    if(!namesOnly && !outputFile.endWrite()){
+        std::cerr << "Error: failed to write output file: " << outputFile.errorString() << std::endl;
+        return -1;
+    }
+
+    if(screen && query.screenedCount() > 0){
+        std::cerr << "Screened out " << query.screenedOutCount()
+                  << " of " << query.screenedCount() << " molecules ("
+                  << 100.0 * query.screenedOutCount() / query.screenedCount() << "%)"
+                  << std::endl;
     }
 
     return 0;
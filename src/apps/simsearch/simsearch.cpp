@@ -0,0 +1,192 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2011 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+#include <string>
+#include <vector>
+#include <iostream>
+
+#include <boost/scoped_ptr.hpp>
+#include <boost/program_options.hpp>
+#include <boost/algorithm/string.hpp>
+
+#include <chemkit/chemkit.h>
+#include <chemkit/foreach.h>
+#include <chemkit/molecule.h>
+#include <chemkit/lineformat.h>
+#include <chemkit/fingerprint.h>
+#include <chemkit/moleculefile.h>
+#include <chemkit/fingerprintdatabase.h>
+
+void printHelp(char *argv[], const boost::program_options::options_description &options)
+{
+    std::cout << "Usage: " << argv[0] << " [OPTIONS] DATABASE [QUERY]\n";
+    std::cout << "\n";
+    std::cout << "Search for the molecules in DATABASE most similar to QUERY. QUERY\n";
+    std::cout << "is a line representation (e.g. InChI or SMILES) of a molecule.\n";
+    std::cout << "Each hit is output as its name followed by its tanimoto\n";
+    std::cout << "coefficient with QUERY.\n";
+    std::cout << "\n";
+    std::cout << "Use --create to build DATABASE from a molecule file.\n";
+    std::cout << "\n";
+    std::cout << "Options:\n";
+    std::cout << options << "\n";
+}
+
+int main(int argc, char *argv[])
+{
+    std::string databaseFileName;
+    std::string formula;
+    std::string inputFileName;
+    std::string fingerprintName = "fp2";
+    size_t count = 10;
+    chemkit::Real threshold = 0;
+
+    boost::program_options::options_description options;
+    options.add_options()
+        ("database",
+            boost::program_options::value<std::string>(&databaseFileName),
+            "Fingerprint database file.")
+        ("formula",
+            boost::program_options::value<std::string>(&formula),
+            "Query formula.")
+        ("create,c",
+            boost::program_options::value<std::string>(&inputFileName),
+            "Create the database from the molecules in a file.")
+        ("fingerprint,f",
+            boost::program_options::value<std::string>(&fingerprintName),
+            "Fingerprint to use when creating the database (default is fp2).")
+        ("count,k",
+            boost::program_options::value<size_t>(&count),
+            "Maximum number of hits to output (0 outputs all hits above the threshold).")
+        ("threshold,t",
+            boost::program_options::value<chemkit::Real>(&threshold),
+            "Minimum tanimoto coefficient of hits.")
+        ("help,h",
+            "Shows this help message");
+
+    boost::program_options::positional_options_description positionalOptions;
+    positionalOptions.add("database", 1).add("formula", 1);
+
+    boost::program_options::variables_map variables;
+    boost::program_options::store(
+        boost::program_options::command_line_parser(argc, argv)
+            .options(options)
+            .positional(positionalOptions).run(),
+        variables);
+    boost::program_options::notify(variables);
+
+    if(variables.count("help")){
+        printHelp(argv, options);
+        return 0;
+    }
+    else if(databaseFileName.empty()){
+        printHelp(argv, options);
+        std::cerr << "Error: no database file given." << std::endl;
+        return -1;
+    }
+    else if(inputFileName.empty() && formula.empty()){
+        printHelp(argv, options);
+        std::cerr << "Error: no query formula given." << std::endl;
+        return -1;
+    }
+
+    chemkit::FingerprintDatabase database;
+
+    if(!inputFileName.empty()){
+        // create database
+        chemkit::MoleculeFile inputFile(inputFileName);
+        if(!inputFile.beginRead()){
+            std::cerr << "Error: failed to read input file: " << inputFile.errorString() << std::endl;
+            return -1;
+        }
+
+        if(!database.create(databaseFileName, &inputFile, fingerprintName)){
+            std::cerr << "Error: failed to create database: " << database.errorString() << std::endl;
+            return -1;
+        }
+
+        if(formula.empty()){
+            return 0;
+        }
+    }
+    else if(!database.open(databaseFileName)){
+        std::cerr << "Error: failed to open database: " << database.errorString() << std::endl;
+        return -1;
+    }
+
+    // select input line format based on the query given
+    std::string inputFormat;
+    if(boost::algorithm::starts_with(formula, "InChI=") || isdigit(formula[0])){
+        inputFormat = "inchi";
+    }
+    else{
+        inputFormat = "smiles";
+    }
+
+    boost::scoped_ptr<chemkit::LineFormat> queryFormat(chemkit::LineFormat::create(inputFormat));
+    if(!queryFormat){
+        std::cerr << "Error: failed to create line format." << std::endl;
+        return -1;
+    }
+
+    boost::scoped_ptr<chemkit::Molecule> queryMolecule(queryFormat->read(formula));
+    if(!queryMolecule){
+        std::cerr << "Error: failed to read query molecule: " << queryFormat->errorString() << std::endl;
+        return -1;
+    }
+
+    // calculate the query fingerprint with the database's fingerprint
+    boost::scoped_ptr<chemkit::Fingerprint> fingerprint(chemkit::Fingerprint::create(database.fingerprintName()));
+    if(!fingerprint){
+        std::cerr << "Error: fingerprint '" << database.fingerprintName() << "' is not supported." << std::endl;
+        return -1;
+    }
+
+    chemkit::Bitset queryFingerprint = fingerprint->value(queryMolecule.get());
+
+    std::vector<chemkit::FingerprintDatabase::Hit> hits;
+    if(count == 0){
+        hits = database.thresholdSearch(queryFingerprint, threshold);
+    }
+    else{
+        hits = database.search(queryFingerprint, count, threshold);
+    }
+
+    foreach(const chemkit::FingerprintDatabase::Hit &hit, hits){
+        std::cout << database.name(hit.first) << "\t" << hit.second << "\n";
+    }
+
+    return 0;
+}
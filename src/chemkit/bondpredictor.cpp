@@ -35,9 +35,18 @@
 
 #include "bondpredictor.h"
 
+#include <cmath>
+#include <algorithm>
+
+#ifndef Q_MOC_RUN
+#include <boost/bind.hpp>
+#endif
+
 #include "atom.h"
 #include "foreach.h"
 #include "molecule.h"
+#include "threadpool.h"
+#include "spatialgrid.h"
 
 namespace chemkit {
 
@@ -49,6 +58,12 @@ public:
     Real tolerance;
     Real minimumBondLength;
     Real maximumBondLength;
+    size_t threadCount;
+
+    // used while predicting bonds
+    std::vector<Atom *> atoms;
+    SpatialGrid grid;
+    Real cutoff;
 };
 
 // === BondPredictor ======================================================= //
@@ -68,6 +83,9 @@ public:
 /// \endcode
 ///
 /// This class implements the \blueobeliskalgorithm{rebondFrom3DCoordinates}.
+///
+/// Candidate pairs of atoms are found with a SpatialGrid so the time
+/// taken to predict bonds grows linearly with the number of atoms.
 
 /// \typedef BondPredictor::PredictedBond;
 /// This tuple contains information about each predicted bond.
@@ -93,6 +111,7 @@ BondPredictor::BondPredictor(Molecule *molecule)
     d->minimumBondLength = 0.4;
     d->maximumBondLength = 5.0;
     d->tolerance = 0.45;
+    d->threadCount = 1;
 }
 
 /// Destroys the bond predictor object.
@@ -144,25 +163,88 @@ Molecule* BondPredictor::molecule() const
     return d->molecule;
 }
 
+// --- Threading ----------------------------------------------------------- //
+/// Sets the number of threads used to predict bonds to
+/// \p threadCount. If \p threadCount is \c 0 the value of
+/// ThreadPool::idealThreadCount() is used.
+///
+/// By default a single thread is used. The predicted bonds are the
+/// same and in the same order for any number of threads.
+void BondPredictor::setThreadCount(size_t threadCount)
+{
+    if(threadCount == 0){
+        threadCount = ThreadPool::idealThreadCount();
+    }
+
+    d->threadCount = threadCount;
+}
+
+/// Returns the number of threads used to predict bonds.
+size_t BondPredictor::threadCount() const
+{
+    return d->threadCount;
+}
+
 // --- Prediction ---------------------------------------------------------- //
 /// Returns a list of pairs of atoms that are predicted to be bonded.
+///
+/// The bonds are sorted by the index of their first atom and then by
+/// the index of their second atom.
 std::vector<BondPredictor::PredictedBond> BondPredictor::predictedBonds()
 {
     std::vector<PredictedBond> bonds;
 
-    if(!d->molecule)
+    if(!d->molecule || d->molecule->isEmpty())
         return bonds;
 
-    std::vector<Atom *> atoms(d->molecule->atoms().begin(), d->molecule->atoms().end());
+    d->atoms.assign(d->molecule->atoms().begin(), d->molecule->atoms().end());
+    const size_t size = d->atoms.size();
 
-    for(unsigned int i = 0; i < atoms.size(); i++){
-        for(unsigned int j = i+1; j < atoms.size(); j++){
-            if(couldBeBonded(atoms[i], atoms[j])){
-                bonds.push_back(boost::make_tuple(atoms[i], atoms[j], Bond::Single));
-            }
+    // atoms further apart than the cutoff can never be bonded
+    Real maximumRadius = 0;
+    std::vector<Point3> positions(size);
+    for(size_t i = 0; i < size; i++){
+        positions[i] = d->atoms[i]->position();
+        maximumRadius = std::max(maximumRadius, d->atoms[i]->covalentRadius());
+    }
+
+    d->cutoff = std::min(maximumBondLength(), 2 * maximumRadius + tolerance());
+    if(d->cutoff <= 0){
+        d->atoms.clear();
+        return bonds;
+    }
+
+    d->grid.setCellSize(d->cutoff);
+    d->grid.setPositions(positions);
+
+    if(d->threadCount < 2){
+        predictedBondsSlice(&bonds, 0, size);
+    }
+    else{
+        // each slice is a contiguous range of atoms so the bonds from
+        // each slice can be joined in order
+        size_t sliceCount = std::min(d->threadCount * 4, size);
+        std::vector<std::vector<PredictedBond> > sliceBonds(sliceCount);
+
+        ThreadPool pool(d->threadCount);
+        std::vector<boost::shared_future<void> > tasks;
+        for(size_t i = 0; i < sliceCount; i++){
+            tasks.push_back(pool.run(boost::bind(&BondPredictor::predictedBondsSlice,
+                                                 this,
+                                                 &sliceBonds[i],
+                                                 size * i / sliceCount,
+                                                 size * (i + 1) / sliceCount)));
+        }
+
+        for(size_t i = 0; i < sliceCount; i++){
+            tasks[i].wait();
+            bonds.insert(bonds.end(), sliceBonds[i].begin(), sliceBonds[i].end());
         }
     }
 
+    d->atoms.clear();
+    d->grid.clear();
+
     return bonds;
 }
 
@@ -192,4 +274,21 @@ bool BondPredictor::couldBeBonded(Atom *a, Atom *b) const
         return false;
 }
 
+// Appends the bonds from each atom in the range [begin, end) to atoms
+// with a larger index to bonds.
+void BondPredictor::predictedBondsSlice(std::vector<PredictedBond> *bonds, size_t begin, size_t end) const
+{
+    for(size_t i = begin; i < end; i++){
+        std::vector<size_t> neighbors = d->grid.neighbors(i, d->cutoff);
+
+        for(std::vector<size_t>::const_iterator iter = std::upper_bound(neighbors.begin(), neighbors.end(), i);
+            iter != neighbors.end();
+            ++iter){
+            if(couldBeBonded(d->atoms[i], d->atoms[*iter])){
+                bonds->push_back(boost::make_tuple(d->atoms[i], d->atoms[*iter], Bond::Single));
+            }
+        }
+    }
+}
+
 } // end chemkit namespace
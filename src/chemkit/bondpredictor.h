@@ -71,6 +71,10 @@ public:
     Real maximumBondLength() const;
     Molecule* molecule() const;
 
+    // threading
+    void setThreadCount(size_t threadCount);
+    size_t threadCount() const;
+
     // prediction
     std::vector<PredictedBond> predictedBonds();
 
@@ -79,6 +83,7 @@ public:
 
 private:
     bool couldBeBonded(Atom *a, Atom *b) const;
+    void predictedBondsSlice(std::vector<PredictedBond> *bonds, size_t begin, size_t end) const;
 
 private:
     BondPredictorPrivate* const d;
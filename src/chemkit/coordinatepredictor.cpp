@@ -39,6 +39,7 @@
 #include "foreach.h"
 #include "molecule.h"
 #include "concurrent.h"
+#include "spatialgrid.h"
 
 namespace chemkit {
 
@@ -128,30 +129,63 @@ boost::shared_future<void> CoordinatePredictor::predictCoordinatesAsync(Molecule
 /// Adjusts the coordinates of the atoms in \p molecule to ensure that
 /// no two atoms are within \p distance Angstroms of each other. Returns
 /// \c true if at least one close contact was found and eliminated.
+///
+/// Close contacts are found with a SpatialGrid. After the first pass
+/// over every atom only the atoms that have been moved are checked
+/// again.
 bool CoordinatePredictor::eliminateCloseContacts(Molecule *molecule, Real distance)
 {
-    bool done = false;
     bool modified = false;
+    const size_t size = molecule->size();
+
+    std::vector<Point3> positions(size);
+    for(size_t i = 0; i < size; i++){
+        positions[i] = molecule->atom(i)->position();
+    }
+
+    SpatialGrid grid(positions, distance);
+
+    // atoms that need to be checked for close contacts
+    std::vector<size_t> queue;
+    std::vector<bool> queued(size, true);
+    for(size_t i = size; i > 0; i--){
+        queue.push_back(i - 1);
+    }
 
-    while(!done){
-        done = true;
+    while(!queue.empty()){
+        size_t i = queue.back();
+        queue.pop_back();
+        queued[i] = false;
 
-        for(size_t i = 0; i < molecule->size(); i++){
+        foreach(size_t j, grid.neighbors(i, distance)){
             Atom *a = molecule->atom(i);
+            Atom *b = molecule->atom(j);
 
-            for(size_t j = i + 1; j < molecule->size(); j++){
-                Atom *b = molecule->atom(j);
+            if(a->distance(b) >= distance){
+                continue;
+            }
+
+            // move the atom with the larger index by a random unit vector
+            if(j < i){
+                std::swap(a, b);
+            }
 
-                if(a->distance(b) < distance){
-                    done = false;
+            b->setPosition(b->position() +
+                           distance * Vector3::Random().normalized());
+            grid.setPosition(b->index(), b->position());
+
+            // check the moved atom again
+            if(!queued[b->index()]){
+                queue.push_back(b->index());
+                queued[b->index()] = true;
+            }
 
-                    // move atom b by a random unit vector
-                    b->setPosition(b->position() +
-                                   distance * Vector3::Random().normalized());
+            // set modified flag
+            modified = true;
 
-                    // set modified flag
-                    modified = true;
-                }
+            // stop if atom i was moved
+            if(b == molecule->atom(i)){
+                break;
             }
         }
     }
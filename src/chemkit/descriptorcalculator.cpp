@@ -0,0 +1,454 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+#include "descriptorcalculator.h"
+
+#include <limits>
+#include <algorithm>
+
+#ifndef Q_MOC_RUN
+#include <boost/bind.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/scoped_ptr.hpp>
+#endif
+
+#include "foreach.h"
+#include "molecule.h"
+#include "threadpool.h"
+#include "moleculardescriptor.h"
+
+namespace chemkit {
+
+namespace {
+
+// The binary file contains a fixed size header followed by the name
+// of each descriptor in a 64 character field and then the values as
+// a row-major array of doubles. Values are stored in the byte order
+// of the machine which created the file.
+struct BinaryHeader
+{
+    char magic[8];
+    boost::uint32_t byteOrder;
+    boost::uint32_t columnCount;
+    boost::uint64_t rowCount;
+};
+
+const char BinaryMagic[8] = { 'C', 'K', 'D', 'E', 'S', 'C', '0', '1' };
+const boost::uint32_t BinaryByteOrder = 0x01020304;
+const size_t BinaryNameSize = 64;
+
+// Returns the value of variant as a real number. Missing values and
+// values which are not numbers are returned as NaN.
+Real toReal(const Variant &variant)
+{
+    switch(variant.type()){
+        case Variant::Bool:
+        case Variant::Int:
+        case Variant::Long:
+        case Variant::Float:
+        case Variant::Double:
+            return variant.toReal();
+        default:
+            return std::numeric_limits<Real>::quiet_NaN();
+    }
+}
+
+// Writes value to output as a csv field, quoting it if needed.
+void writeCsvField(std::ostream &output, const std::string &value)
+{
+    if(value.find_first_of(",\"\n") == std::string::npos){
+        output << value;
+        return;
+    }
+
+    output << '"';
+    foreach(char c, value){
+        if(c == '"'){
+            output << '"';
+        }
+
+        output << c;
+    }
+    output << '"';
+}
+
+} // end anonymous namespace
+
+// === DescriptorCalculatorPrivate ========================================= //
+class DescriptorCalculatorPrivate
+{
+public:
+    std::vector<std::string> descriptors;
+    size_t threadCount;
+    std::vector<Real> values;
+    std::vector<std::string> names;
+    std::string errorString;
+};
+
+// === DescriptorCalculator ================================================ //
+/// \class DescriptorCalculator descriptorcalculator.h chemkit/descriptorcalculator.h
+/// \ingroup chemkit
+/// \brief The DescriptorCalculator class calculates a set of
+///        molecular descriptors for many molecules.
+///
+/// The calculator resolves each descriptor name once and uses a
+/// separate set of descriptor objects for each thread, instead of
+/// creating a new descriptor object for each value as
+/// Molecule::descriptor() does. Rings and fragments are perceived
+/// once for each molecule before any of the descriptors are
+/// calculated so that each descriptor uses the same perception.
+///
+/// The results are stored in a dense row-major matrix with a row for
+/// each molecule and a column for each descriptor. Values which
+/// could not be calculated are stored as NaN.
+///
+/// The following example calculates three descriptors for each
+/// molecule in a file and writes them in CSV format:
+/// \code
+/// std::vector<std::string> descriptors;
+/// descriptors.push_back("mass");
+/// descriptors.push_back("wiener-index");
+/// descriptors.push_back("tpsa");
+///
+/// DescriptorCalculator calculator(descriptors);
+/// calculator.setThreadCount(4);
+/// calculator.calculate(file.molecules());
+/// calculator.writeCsv(std::cout);
+/// \endcode
+///
+/// \see MolecularDescriptor
+
+// --- Construction and Destruction ---------------------------------------- //
+/// Creates a new descriptor calculator with no descriptors.
+DescriptorCalculator::DescriptorCalculator()
+    : d(new DescriptorCalculatorPrivate)
+{
+    d->threadCount = 1;
+}
+
+/// Creates a new descriptor calculator for \p descriptors.
+DescriptorCalculator::DescriptorCalculator(const std::vector<std::string> &descriptors)
+    : d(new DescriptorCalculatorPrivate)
+{
+    d->threadCount = 1;
+
+    setDescriptors(descriptors);
+}
+
+/// Destroys the descriptor calculator.
+DescriptorCalculator::~DescriptorCalculator()
+{
+    delete d;
+}
+
+// --- Properties ---------------------------------------------------------- //
+/// Sets the descriptors to calculate to \p descriptors. Returns
+/// \c false and leaves the descriptors unchanged if any of the
+/// descriptors are not available.
+bool DescriptorCalculator::setDescriptors(const std::vector<std::string> &descriptors)
+{
+    foreach(const std::string &name, descriptors){
+        boost::scoped_ptr<MolecularDescriptor> descriptor(MolecularDescriptor::create(name));
+
+        if(!descriptor){
+            setErrorString("Descriptor '" + name + "' is not available.");
+            return false;
+        }
+    }
+
+    d->descriptors = descriptors;
+    clear();
+
+    return true;
+}
+
+/// Returns the names of the descriptors to calculate.
+std::vector<std::string> DescriptorCalculator::descriptors() const
+{
+    return d->descriptors;
+}
+
+/// Returns the number of descriptors to calculate.
+size_t DescriptorCalculator::descriptorCount() const
+{
+    return d->descriptors.size();
+}
+
+// --- Threading ----------------------------------------------------------- //
+/// Sets the number of threads used to calculate descriptors to
+/// \p threadCount. If \p threadCount is \c 0 the value of
+/// ThreadPool::idealThreadCount() is used.
+///
+/// By default a single thread is used. The results are the same for
+/// any number of threads.
+void DescriptorCalculator::setThreadCount(size_t threadCount)
+{
+    if(threadCount == 0){
+        threadCount = ThreadPool::idealThreadCount();
+    }
+
+    d->threadCount = threadCount;
+}
+
+/// Returns the number of threads used to calculate descriptors.
+size_t DescriptorCalculator::threadCount() const
+{
+    return d->threadCount;
+}
+
+// --- Calculation --------------------------------------------------------- //
+/// Calculates each descriptor for each molecule in \p molecules.
+/// Returns \c false if no descriptors have been set.
+///
+/// Rings and fragments may be perceived for each molecule, so the
+/// molecules must not be used by other threads during the
+/// calculation.
+bool DescriptorCalculator::calculate(const std::vector<const Molecule *> &molecules)
+{
+    clear();
+
+    if(d->descriptors.empty()){
+        setErrorString("No descriptors set.");
+        return false;
+    }
+
+    const size_t size = molecules.size();
+    d->values.assign(size * d->descriptors.size(), std::numeric_limits<Real>::quiet_NaN());
+    d->names.resize(size);
+
+    if(d->threadCount < 2 || size < 2){
+        calculateSlice(&molecules, 0, size);
+    }
+    else{
+        // each slice is a contiguous range of molecules and writes
+        // only to its own rows of the result matrix
+        size_t sliceCount = std::min(d->threadCount * 4, size);
+
+        ThreadPool pool(d->threadCount);
+        std::vector<boost::shared_future<void> > tasks;
+        for(size_t i = 0; i < sliceCount; i++){
+            tasks.push_back(pool.run(boost::bind(&DescriptorCalculator::calculateSlice,
+                                                 this,
+                                                 &molecules,
+                                                 size * i / sliceCount,
+                                                 size * (i + 1) / sliceCount)));
+        }
+
+        foreach(const boost::shared_future<void> &task, tasks){
+            task.wait();
+        }
+    }
+
+    return true;
+}
+
+/// \overload
+bool DescriptorCalculator::calculate(const std::vector<boost::shared_ptr<Molecule> > &molecules)
+{
+    std::vector<const Molecule *> pointers;
+    pointers.reserve(molecules.size());
+
+    foreach(const boost::shared_ptr<Molecule> &molecule, molecules){
+        pointers.push_back(molecule.get());
+    }
+
+    return calculate(pointers);
+}
+
+// --- Results ------------------------------------------------------------- //
+/// Returns the number of rows (molecules) in the results.
+size_t DescriptorCalculator::rowCount() const
+{
+    return d->names.size();
+}
+
+/// Returns the number of columns (descriptors) in the results.
+size_t DescriptorCalculator::columnCount() const
+{
+    return d->descriptors.size();
+}
+
+/// Returns the value of the descriptor at \p column for the molecule
+/// at \p row.
+Real DescriptorCalculator::value(size_t row, size_t column) const
+{
+    return d->values[row * columnCount() + column];
+}
+
+/// Returns the results as a row-major matrix with a row for each
+/// molecule and a column for each descriptor.
+const std::vector<Real>& DescriptorCalculator::values() const
+{
+    return d->values;
+}
+
+/// Returns the name of the molecule at \p row.
+std::string DescriptorCalculator::name(size_t row) const
+{
+    return d->names[row];
+}
+
+/// Removes all of the results.
+void DescriptorCalculator::clear()
+{
+    d->values.clear();
+    d->names.clear();
+}
+
+// --- Output -------------------------------------------------------------- //
+/// Writes the results to \p output in CSV format. Each row contains
+/// the name of a molecule followed by its descriptor values. Missing
+/// values are written as empty fields. If \p header is \c true the
+/// first row contains the names of the descriptors.
+bool DescriptorCalculator::writeCsv(std::ostream &output, bool header) const
+{
+    if(header){
+        output << "name";
+        foreach(const std::string &descriptor, d->descriptors){
+            output << ',';
+            writeCsvField(output, descriptor);
+        }
+        output << '\n';
+    }
+
+    std::streamsize precision = output.precision(10);
+
+    for(size_t row = 0; row < rowCount(); row++){
+        writeCsvField(output, d->names[row]);
+
+        for(size_t column = 0; column < columnCount(); column++){
+            output << ',';
+
+            Real value = this->value(row, column);
+            if(value == value){
+                output << value;
+            }
+        }
+
+        output << '\n';
+    }
+
+    output.precision(precision);
+
+    return !output.fail();
+}
+
+/// Writes the results to \p output in binary format. If \p header is
+/// \c false only the values are written. This allows the results for
+/// many calls to calculate() to be written after a single header.
+///
+/// \see writeBinaryHeader()
+bool DescriptorCalculator::writeBinary(std::ostream &output, bool header) const
+{
+    if(header){
+        writeBinaryHeader(output, d->descriptors, rowCount());
+    }
+
+    if(!d->values.empty()){
+        std::vector<double> values(d->values.begin(), d->values.end());
+        output.write(reinterpret_cast<const char *>(&values[0]), values.size() * sizeof(double));
+    }
+
+    return !output.fail();
+}
+
+/// Writes the header for a binary results file with \p descriptors
+/// and \p rowCount rows to \p output.
+bool DescriptorCalculator::writeBinaryHeader(std::ostream &output, const std::vector<std::string> &descriptors, size_t rowCount)
+{
+    BinaryHeader header;
+    std::fill(reinterpret_cast<char *>(&header), reinterpret_cast<char *>(&header) + sizeof(header), 0);
+    std::copy(BinaryMagic, BinaryMagic + sizeof(BinaryMagic), header.magic);
+    header.byteOrder = BinaryByteOrder;
+    header.columnCount = static_cast<boost::uint32_t>(descriptors.size());
+    header.rowCount = rowCount;
+    output.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    foreach(const std::string &descriptor, descriptors){
+        char name[BinaryNameSize] = { 0 };
+        std::copy(descriptor.begin(), descriptor.begin() + std::min(descriptor.size(), BinaryNameSize - 1), name);
+        output.write(name, sizeof(name));
+    }
+
+    return !output.fail();
+}
+
+// --- Error Handling ------------------------------------------------------ //
+void DescriptorCalculator::setErrorString(const std::string &errorString)
+{
+    d->errorString = errorString;
+}
+
+/// Returns a string describing the last error that occurred.
+std::string DescriptorCalculator::errorString() const
+{
+    return d->errorString;
+}
+
+// --- Internal Methods ---------------------------------------------------- //
+// Calculates the descriptors for the molecules in the range
+// [begin, end) with a set of descriptor objects used only by this
+// slice.
+void DescriptorCalculator::calculateSlice(const std::vector<const Molecule *> *molecules, size_t begin, size_t end)
+{
+    const size_t columnCount = d->descriptors.size();
+
+    std::vector<boost::shared_ptr<MolecularDescriptor> > descriptors;
+    foreach(const std::string &name, d->descriptors){
+        descriptors.push_back(boost::shared_ptr<MolecularDescriptor>(MolecularDescriptor::create(name)));
+    }
+
+    for(size_t row = begin; row < end; row++){
+        const Molecule *molecule = (*molecules)[row];
+        if(!molecule){
+            continue;
+        }
+
+        d->names[row] = molecule->name();
+
+        // perceive rings and fragments once for all descriptors
+        molecule->rings();
+        molecule->fragments();
+
+        Real *values = &d->values[row * columnCount];
+        for(size_t column = 0; column < columnCount; column++){
+            if(descriptors[column]){
+                values[column] = toReal(descriptors[column]->value(molecule));
+            }
+        }
+    }
+}
+
+} // end chemkit namespace
@@ -0,0 +1,103 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+#ifndef CHEMKIT_DESCRIPTORCALCULATOR_H
+#define CHEMKIT_DESCRIPTORCALCULATOR_H
+
+#include "chemkit.h"
+
+#include <string>
+#include <vector>
+#include <iostream>
+
+#ifndef Q_MOC_RUN
+#include <boost/shared_ptr.hpp>
+#endif
+
+namespace chemkit {
+
+class Molecule;
+class DescriptorCalculatorPrivate;
+
+class CHEMKIT_EXPORT DescriptorCalculator
+{
+public:
+    // construction and destruction
+    DescriptorCalculator();
+    DescriptorCalculator(const std::vector<std::string> &descriptors);
+    ~DescriptorCalculator();
+
+    // properties
+    bool setDescriptors(const std::vector<std::string> &descriptors);
+    std::vector<std::string> descriptors() const;
+    size_t descriptorCount() const;
+
+    // threading
+    void setThreadCount(size_t threadCount);
+    size_t threadCount() const;
+
+    // calculation
+    bool calculate(const std::vector<const Molecule *> &molecules);
+    bool calculate(const std::vector<boost::shared_ptr<Molecule> > &molecules);
+
+    // results
+    size_t rowCount() const;
+    size_t columnCount() const;
+    Real value(size_t row, size_t column) const;
+    const std::vector<Real>& values() const;
+    std::string name(size_t row) const;
+    void clear();
+
+    // output
+    bool writeCsv(std::ostream &output, bool header = true) const;
+    bool writeBinary(std::ostream &output, bool header = true) const;
+    static bool writeBinaryHeader(std::ostream &output, const std::vector<std::string> &descriptors, size_t rowCount);
+
+    // error handling
+    std::string errorString() const;
+
+private:
+    void setErrorString(const std::string &errorString);
+    void calculateSlice(const std::vector<const Molecule *> *molecules, size_t begin, size_t end);
+
+    CHEMKIT_DISABLE_COPY(DescriptorCalculator)
+
+private:
+    DescriptorCalculatorPrivate* const d;
+};
+
+} // end chemkit namespace
+
+#endif // CHEMKIT_DESCRIPTORCALCULATOR_H
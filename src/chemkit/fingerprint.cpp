@@ -35,11 +35,42 @@
 
 #include "fingerprint.h"
 
+#include <algorithm>
+
+#ifndef Q_MOC_RUN
+#include <boost/bind.hpp>
+#include <boost/scoped_ptr.hpp>
+#endif
+
+#include "foreach.h"
 #include "molecule.h"
+#include "threadpool.h"
 #include "pluginmanager.h"
 
 namespace chemkit {
 
+namespace {
+
+// Calculates the fingerprints for the molecules in the range
+// [begin, end) with a fingerprint object used only by this slice so
+// that its scratch buffers are reused for each molecule.
+void calculateSlice(const std::string &name,
+                    const std::vector<const Molecule *> *molecules,
+                    size_t begin,
+                    size_t end,
+                    FingerprintMatrix *matrix)
+{
+    boost::scoped_ptr<Fingerprint> fingerprint(Fingerprint::create(name));
+
+    for(size_t i = begin; i < end; i++){
+        if((*molecules)[i]){
+            fingerprint->packedValue((*molecules)[i], matrix->row(i));
+        }
+    }
+}
+
+} // end anonymous namespace
+
 // === Fingerprint ========================================================= //
 /// \class Fingerprint fingerprint.h chemkit/fingerprint.h
 /// \ingroup chemkit
@@ -74,7 +105,13 @@ namespace chemkit {
 /// Bitset fingerprint = uracil.fingerprint("fp2");
 /// \endcode
 ///
-/// \see Bitset, Molecule::fingerprint()
+/// Fingerprints for many molecules can be calculated at once with
+/// the values() method which stores them in a FingerprintMatrix:
+/// \code
+/// FingerprintMatrix matrix = Fingerprint::values(molecules, "fp2", 4);
+/// \endcode
+///
+/// \see Bitset, FingerprintMatrix, Molecule::fingerprint()
 
 // --- Construction and Destruction ---------------------------------------- //
 /// Creates a new fingerprint with \p name.
@@ -106,6 +143,13 @@ size_t Fingerprint::size() const
     return value(&molecule).size();
 }
 
+/// Returns the number of 64-bit words needed to store the
+/// fingerprint.
+size_t Fingerprint::wordCount() const
+{
+    return (size() + 63) / 64;
+}
+
 // --- Fingerprint --------------------------------------------------------- //
 /// Returns the fingerprint value as a bitset.
 Bitset Fingerprint::value(const Molecule *molecule) const
@@ -115,6 +159,26 @@ Bitset Fingerprint::value(const Molecule *molecule) const
     return Bitset();
 }
 
+/// Calculates the fingerprint for \p molecule and stores it in
+/// \p words which must have space for wordCount() words. Bit \c i of
+/// the fingerprint is stored in bit \c {i % 64} of word \c {i / 64}.
+///
+/// The default implementation calls value() and packs the bitset.
+/// Fingerprints should reimplement this method to write their bits
+/// directly into \p words.
+void Fingerprint::packedValue(const Molecule *molecule, boost::uint64_t *words) const
+{
+    const size_t wordCount = this->wordCount();
+    std::fill(words, words + wordCount, boost::uint64_t(0));
+
+    Bitset value = this->value(molecule);
+    for(size_t i = value.find_first(); i != Bitset::npos; i = value.find_next(i)){
+        if(i / 64 < wordCount){
+            words[i / 64] |= boost::uint64_t(1) << (i % 64);
+        }
+    }
+}
+
 // --- Similarity ---------------------------------------------------------- //
 /// Returns the tanimoto coefficent between \p a and \p b.
 Real Fingerprint::tanimotoCoefficient(const Bitset &a, const Bitset &b)
@@ -139,4 +203,86 @@ std::vector<std::string> Fingerprint::fingerprints()
     return PluginManager::instance()->pluginClassNames<Fingerprint>();
 }
 
+/// Calculates the \p name fingerprint for each molecule in
+/// \p molecules using \p threadCount threads and returns them as a
+/// fingerprint matrix. If \p threadCount is \c 0 the value of
+/// ThreadPool::idealThreadCount() is used. Returns an empty matrix
+/// if \p name is not supported.
+///
+/// Each thread uses its own fingerprint object for all of the
+/// molecules it calculates. The rows for null molecules are left
+/// empty.
+FingerprintMatrix Fingerprint::values(const std::vector<const Molecule *> &molecules,
+                                      const std::string &name,
+                                      size_t threadCount)
+{
+    boost::scoped_ptr<Fingerprint> fingerprint(Fingerprint::create(name));
+    if(!fingerprint){
+        return FingerprintMatrix();
+    }
+
+    const size_t size = molecules.size();
+    FingerprintMatrix matrix(size, fingerprint->size());
+
+    if(threadCount == 0){
+        threadCount = ThreadPool::idealThreadCount();
+    }
+
+    if(threadCount < 2 || size < 2){
+        calculateSlice(name, &molecules, 0, size, &matrix);
+    }
+    else{
+        // each slice writes only to its own rows of the matrix
+        size_t sliceCount = std::min(threadCount * 4, size);
+
+        ThreadPool pool(threadCount);
+        std::vector<boost::shared_future<void> > tasks;
+        for(size_t i = 0; i < sliceCount; i++){
+            tasks.push_back(pool.run(boost::bind(calculateSlice,
+                                                 boost::cref(name),
+                                                 &molecules,
+                                                 size * i / sliceCount,
+                                                 size * (i + 1) / sliceCount,
+                                                 &matrix)));
+        }
+
+        foreach(const boost::shared_future<void> &task, tasks){
+            task.wait();
+        }
+    }
+
+    return matrix;
+}
+
+/// \overload
+FingerprintMatrix Fingerprint::values(const std::vector<boost::shared_ptr<Molecule> > &molecules,
+                                      const std::string &name,
+                                      size_t threadCount)
+{
+    std::vector<const Molecule *> pointers;
+    pointers.reserve(molecules.size());
+
+    foreach(const boost::shared_ptr<Molecule> &molecule, molecules){
+        pointers.push_back(molecule.get());
+    }
+
+    return values(pointers, name, threadCount);
+}
+
+// --- Internal Methods ---------------------------------------------------- //
+/// Returns a bitset with \p size bits containing the fingerprint
+/// stored in \p words.
+Bitset Fingerprint::unpack(const boost::uint64_t *words, size_t size)
+{
+    Bitset value(size);
+
+    for(size_t i = 0; i < size; i++){
+        if(words[i / 64] & (boost::uint64_t(1) << (i % 64))){
+            value.set(i);
+        }
+    }
+
+    return value;
+}
+
 } // end chemkit namespace
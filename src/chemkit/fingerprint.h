@@ -41,8 +41,14 @@
 #include <string>
 #include <vector>
 
+#ifndef Q_MOC_RUN
+#include <boost/cstdint.hpp>
+#include <boost/shared_ptr.hpp>
+#endif
+
 #include "bitset.h"
 #include "plugin.h"
+#include "fingerprintmatrix.h"
 
 namespace chemkit {
 
@@ -57,9 +63,11 @@ public:
     // properties
     std::string name() const;
     virtual size_t size() const;
+    size_t wordCount() const;
 
     // fingerprint
     virtual Bitset value(const Molecule *molecule) const;
+    virtual void packedValue(const Molecule *molecule, boost::uint64_t *words) const;
 
     // similarity
     static Real tanimotoCoefficient(const Bitset &a, const Bitset &b);
@@ -67,9 +75,16 @@ public:
     // static methods
     static Fingerprint* create(const std::string &name);
     static std::vector<std::string> fingerprints();
+    static FingerprintMatrix values(const std::vector<const Molecule *> &molecules,
+                                    const std::string &name,
+                                    size_t threadCount = 1);
+    static FingerprintMatrix values(const std::vector<boost::shared_ptr<Molecule> > &molecules,
+                                    const std::string &name,
+                                    size_t threadCount = 1);
 
 protected:
     Fingerprint(const std::string &name);
+    static Bitset unpack(const boost::uint64_t *words, size_t size);
 
 private:
     std::string m_name;
@@ -0,0 +1,113 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+
+#ifndef CHEMKIT_FINGERPRINTMATRIX_INLINE_H
+#define CHEMKIT_FINGERPRINTMATRIX_INLINE_H
+
+#include "fingerprintmatrix.h"
+
+#include <cassert>
+
+namespace chemkit {
+
+// --- Properties ---------------------------------------------------------- //
+/// Returns the number of fingerprints (rows) in the matrix.
+inline size_t FingerprintMatrix::rowCount() const
+{
+    return m_rowCount;
+}
+
+/// Returns the number of bits in each fingerprint.
+inline size_t FingerprintMatrix::bitCount() const
+{
+    return m_bitCount;
+}
+
+/// Returns the number of 64-bit words in each row.
+inline size_t FingerprintMatrix::stride() const
+{
+    return m_stride;
+}
+
+/// Returns \c true if the matrix contains no fingerprints.
+inline bool FingerprintMatrix::isEmpty() const
+{
+    return m_rowCount == 0;
+}
+
+// --- Values -------------------------------------------------------------- //
+/// Returns a pointer to the words in the matrix. The fingerprint for
+/// row \c i starts at word \c {i * stride()}. Bit \c j of a
+/// fingerprint is stored in bit \c {j % 64} of word \c {j / 64}.
+inline boost::uint64_t* FingerprintMatrix::data()
+{
+    return m_words.empty() ? 0 : &m_words[0];
+}
+
+/// \overload
+inline const boost::uint64_t* FingerprintMatrix::data() const
+{
+    return m_words.empty() ? 0 : &m_words[0];
+}
+
+/// Returns a pointer to the first word of the fingerprint at
+/// \p index.
+inline boost::uint64_t* FingerprintMatrix::row(size_t index)
+{
+    assert(index < m_rowCount);
+
+    return &m_words[index * m_stride];
+}
+
+/// \overload
+inline const boost::uint64_t* FingerprintMatrix::row(size_t index) const
+{
+    assert(index < m_rowCount);
+
+    return &m_words[index * m_stride];
+}
+
+/// Returns \c true if \p bit is set in the fingerprint at \p row.
+inline bool FingerprintMatrix::test(size_t row, size_t bit) const
+{
+    assert(bit < m_bitCount);
+
+    return (this->row(row)[bit / 64] & (boost::uint64_t(1) << (bit % 64))) != 0;
+}
+
+} // end chemkit namespace
+
+#endif // CHEMKIT_FINGERPRINTMATRIX_INLINE_H
@@ -0,0 +1,151 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+
+#include "fingerprintmatrix.h"
+
+namespace chemkit {
+
+namespace {
+
+inline size_t popcount(boost::uint64_t word)
+{
+#if defined(__GNUC__)
+    return __builtin_popcountll(word);
+#else
+    word = word - ((word >> 1) & 0x5555555555555555ULL);
+    word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+    word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+    return static_cast<size_t>((word * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+} // end anonymous namespace
+
+// === FingerprintMatrix =================================================== //
+/// \class FingerprintMatrix fingerprintmatrix.h chemkit/fingerprintmatrix.h
+/// \ingroup chemkit
+/// \brief The FingerprintMatrix class contains fingerprints for a set
+///        of molecules.
+///
+/// The fingerprints are packed into a single contiguous array of
+/// 64-bit words with one row for each molecule. Every row has the
+/// same number of words (the stride) and unused bits at the end of a
+/// row are always zero.
+///
+/// Fingerprint matrices are usually created with
+/// Fingerprint::values():
+/// \code
+/// FingerprintMatrix matrix = Fingerprint::values(molecules, "fp2", 4);
+///
+/// Real similarity = matrix.tanimotoCoefficient(0, 1);
+/// \endcode
+///
+/// \see Fingerprint
+
+// --- Construction and Destruction ---------------------------------------- //
+/// Creates a new, empty fingerprint matrix.
+FingerprintMatrix::FingerprintMatrix()
+    : m_rowCount(0),
+      m_bitCount(0),
+      m_stride(0)
+{
+}
+
+/// Creates a new fingerprint matrix with \p rowCount fingerprints of
+/// \p bitCount bits. All of the bits are initially zero.
+FingerprintMatrix::FingerprintMatrix(size_t rowCount, size_t bitCount)
+    : m_rowCount(rowCount),
+      m_bitCount(bitCount),
+      m_stride((bitCount + 63) / 64),
+      m_words(rowCount * ((bitCount + 63) / 64), 0)
+{
+}
+
+/// Destroys the fingerprint matrix.
+FingerprintMatrix::~FingerprintMatrix()
+{
+}
+
+// --- Values -------------------------------------------------------------- //
+/// Returns the fingerprint at \p row as a bitset.
+Bitset FingerprintMatrix::value(size_t row) const
+{
+    Bitset value(m_bitCount);
+
+    const boost::uint64_t *words = this->row(row);
+    for(size_t i = 0; i < m_bitCount; i++){
+        if(words[i / 64] & (boost::uint64_t(1) << (i % 64))){
+            value.set(i);
+        }
+    }
+
+    return value;
+}
+
+/// Returns the number of bits set in the fingerprint at \p row.
+size_t FingerprintMatrix::count(size_t row) const
+{
+    const boost::uint64_t *words = this->row(row);
+
+    size_t count = 0;
+    for(size_t i = 0; i < m_stride; i++){
+        count += popcount(words[i]);
+    }
+
+    return count;
+}
+
+// --- Similarity ---------------------------------------------------------- //
+/// Returns the tanimoto coefficient between the fingerprints at rows
+/// \p a and \p b.
+///
+/// \see Fingerprint::tanimotoCoefficient()
+Real FingerprintMatrix::tanimotoCoefficient(size_t a, size_t b) const
+{
+    const boost::uint64_t *wordsA = row(a);
+    const boost::uint64_t *wordsB = row(b);
+
+    size_t intersection = 0;
+    size_t total = 0;
+    for(size_t i = 0; i < m_stride; i++){
+        intersection += popcount(wordsA[i] & wordsB[i]);
+        total += popcount(wordsA[i]) + popcount(wordsB[i]);
+    }
+
+    return Real(intersection) / Real(total - intersection);
+}
+
+} // end chemkit namespace
@@ -0,0 +1,89 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+
+#ifndef CHEMKIT_FINGERPRINTMATRIX_H
+#define CHEMKIT_FINGERPRINTMATRIX_H
+
+#include "chemkit.h"
+
+#include <vector>
+
+#ifndef Q_MOC_RUN
+#include <boost/cstdint.hpp>
+#endif
+
+#include "bitset.h"
+
+namespace chemkit {
+
+class CHEMKIT_EXPORT FingerprintMatrix
+{
+public:
+    // construction and destruction
+    FingerprintMatrix();
+    FingerprintMatrix(size_t rowCount, size_t bitCount);
+    ~FingerprintMatrix();
+
+    // properties
+    inline size_t rowCount() const;
+    inline size_t bitCount() const;
+    inline size_t stride() const;
+    inline bool isEmpty() const;
+
+    // values
+    inline boost::uint64_t* data();
+    inline const boost::uint64_t* data() const;
+    inline boost::uint64_t* row(size_t index);
+    inline const boost::uint64_t* row(size_t index) const;
+    inline bool test(size_t row, size_t bit) const;
+    Bitset value(size_t row) const;
+    size_t count(size_t row) const;
+
+    // similarity
+    Real tanimotoCoefficient(size_t a, size_t b) const;
+
+private:
+    size_t m_rowCount;
+    size_t m_bitCount;
+    size_t m_stride;
+    std::vector<boost::uint64_t> m_words;
+};
+
+} // end chemkit namespace
+
+#include "fingerprintmatrix-inline.h"
+
+#endif // CHEMKIT_FINGERPRINTMATRIX_H
@@ -36,19 +36,31 @@
 // The formulae for sphere intersection area and volume are
 // derived from those presented in: "Measuring Space Filling
 // Diagrams and Voids" by Herbert Edelsbrunner and Ping Fu.
+//
+// The approximate surface areas are calculated with the methods
+// presented in: "Environment and Exposure to Solvent of Protein
+// Atoms. Lysozyme and Insulin" by A. Shrake and J. A. Rupley and
+// "Approximate Atomic Surfaces from Linear Combinations of Pairwise
+// Overlaps (LCPO)" by Jorg Weiser, Peter S. Shenkin and W. Clark
+// Still.
 
 #include "molecularsurface.h"
 
+#include <algorithm>
+
 #include <boost/bind.hpp>
 #include <boost/thread.hpp>
 
 #include "atom.h"
+#include "bond.h"
 #include "foreach.h"
 #include "vector3.h"
 #include "geometry.h"
 #include "molecule.h"
 #include "alphashape.h"
 #include "concurrent.h"
+#include "spatialgrid.h"
+#include "cartesiancoordinates.h"
 #include "delaunaytriangulation.h"
 
 namespace chemkit {
@@ -68,6 +80,195 @@ Real angleDihedral(const Point3 &s, const Point3 &t, const Point3 &u, const Poin
     return acos(nu.dot(nv)) / (2.0 * pi);
 }
 
+// Returns count points evenly distributed over the unit sphere using
+// the golden section spiral. The coordinates are stored in separate
+// arrays so that the burial test loops can be vectorized.
+void spherePoints(int count, std::vector<Real> &x, std::vector<Real> &y, std::vector<Real> &z)
+{
+    x.resize(count);
+    y.resize(count);
+    z.resize(count);
+
+    const Real increment = pi * (3.0 - sqrt(5.0));
+
+    for(int i = 0; i < count; i++){
+        Real zi = 1.0 - (2.0 * i + 1.0) / count;
+        Real r = sqrt(1.0 - zi * zi);
+        Real phi = i * increment;
+
+        x[i] = r * cos(phi);
+        y[i] = r * sin(phi);
+        z[i] = zi;
+    }
+}
+
+struct LcpoParameters
+{
+    Real radius;
+    Real p1;
+    Real p2;
+    Real p3;
+    Real p4;
+};
+
+bool isSp2(const Atom *atom)
+{
+    foreach(const Bond *bond, atom->bonds()){
+        if(bond->order() > Bond::Single){
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Returns the LCPO parameters for atom. These are the parameters
+// from table 1 of the Weiser et al. paper as used by Amber.
+LcpoParameters lcpoParameters(const Atom *atom)
+{
+    int heavyNeighborCount = 0;
+    foreach(const Atom *neighbor, atom->neighbors()){
+        if(!neighbor->is(Atom::Hydrogen)){
+            heavyNeighborCount++;
+        }
+    }
+
+    if(atom->is(Atom::Carbon)){
+        if(isSp2(atom)){
+            if(heavyNeighborCount <= 2){
+                const LcpoParameters parameters = { 1.70, 0.51245, -0.15966, -0.00019781, 0.00016392 };
+                return parameters;
+            }
+            else{
+                const LcpoParameters parameters = { 1.70, 0.070344, -0.019015, -0.000022009, 0.000016875 };
+                return parameters;
+            }
+        }
+        else if(heavyNeighborCount <= 1){
+            const LcpoParameters parameters = { 1.70, 0.77887, -0.28063, -0.0012968, 0.00039328 };
+            return parameters;
+        }
+        else if(heavyNeighborCount == 2){
+            const LcpoParameters parameters = { 1.70, 0.56482, -0.19608, -0.0010219, 0.0002658 };
+            return parameters;
+        }
+        else if(heavyNeighborCount == 3){
+            const LcpoParameters parameters = { 1.70, 0.23348, -0.072627, -0.00020079, 0.00007967 };
+            return parameters;
+        }
+        else{
+            const LcpoParameters parameters = { 1.70, 0.0, 0.0, 0.0, 0.0 };
+            return parameters;
+        }
+    }
+    else if(atom->is(Atom::Oxygen)){
+        if(heavyNeighborCount <= 1){
+            // carboxylate oxygens are bonded to a carbon with two
+            // terminal oxygens
+            if(atom->neighborCount() == 1 && atom->neighbor(0)->is(Atom::Carbon)){
+                const Atom *carbon = atom->neighbor(0);
+
+                int terminalOxygenCount = 0;
+                foreach(const Atom *neighbor, carbon->neighbors()){
+                    if(neighbor->is(Atom::Oxygen) && neighbor->isTerminal()){
+                        terminalOxygenCount++;
+                    }
+                }
+
+                if(terminalOxygenCount == 2){
+                    const LcpoParameters parameters = { 1.60, 0.88857, -0.33421, -0.0018683, 0.00049372 };
+                    return parameters;
+                }
+            }
+
+            if(isSp2(atom)){
+                const LcpoParameters parameters = { 1.60, 0.68563, -0.1868, -0.00135573, 0.00023743 };
+                return parameters;
+            }
+            else{
+                const LcpoParameters parameters = { 1.60, 0.77914, -0.25262, -0.0016056, 0.00035071 };
+                return parameters;
+            }
+        }
+        else{
+            const LcpoParameters parameters = { 1.60, 0.49392, -0.16038, -0.00015512, 0.00016453 };
+            return parameters;
+        }
+    }
+    else if(atom->is(Atom::Nitrogen)){
+        // nitrogens bonded to a multiply bonded atom (e.g. amides
+        // and aromatic amines) are treated as sp2
+        bool sp2 = isSp2(atom);
+        if(!sp2){
+            foreach(const Atom *neighbor, atom->neighbors()){
+                if(isSp2(neighbor)){
+                    sp2 = true;
+                    break;
+                }
+            }
+        }
+
+        if(sp2){
+            if(heavyNeighborCount <= 1){
+                const LcpoParameters parameters = { 1.65, 0.73511, -0.22116, -0.00089148, 0.0002523 };
+                return parameters;
+            }
+            else if(heavyNeighborCount == 2){
+                const LcpoParameters parameters = { 1.65, 0.41102, -0.12254, -0.000075448, 0.00011804 };
+                return parameters;
+            }
+            else{
+                const LcpoParameters parameters = { 1.65, 0.062577, -0.017874, -0.00008312, 0.000019849 };
+                return parameters;
+            }
+        }
+        else{
+            if(heavyNeighborCount <= 1){
+                const LcpoParameters parameters = { 1.65, 0.078602, -0.29198, -0.0006537, 0.00036247 };
+                return parameters;
+            }
+            else if(heavyNeighborCount == 2){
+                const LcpoParameters parameters = { 1.65, 0.22599, -0.036648, -0.0012297, 0.000080038 };
+                return parameters;
+            }
+            else{
+                const LcpoParameters parameters = { 1.65, 0.051481, -0.012603, -0.00032006, 0.000024774 };
+                return parameters;
+            }
+        }
+    }
+    else if(atom->is(Atom::Sulfur)){
+        if(heavyNeighborCount <= 1){
+            const LcpoParameters parameters = { 1.90, 0.7722, -0.26393, 0.0010629, 0.0002179 };
+            return parameters;
+        }
+        else{
+            const LcpoParameters parameters = { 1.90, 0.54581, -0.19477, -0.0012873, 0.00029247 };
+            return parameters;
+        }
+    }
+    else if(atom->is(Atom::Phosphorus)){
+        if(heavyNeighborCount <= 3){
+            const LcpoParameters parameters = { 1.90, 0.3865, -0.18249, -0.0036598, 0.0004264 };
+            return parameters;
+        }
+        else{
+            const LcpoParameters parameters = { 1.90, 0.03873, -0.0089339, 0.0000083582, 0.0000030381 };
+            return parameters;
+        }
+    }
+
+    // other elements are treated as sp3 carbons with their own van
+    // der waals radius
+    const Real sp3[3][4] = { { 0.77887, -0.28063, -0.0012968, 0.00039328 },
+                             { 0.56482, -0.19608, -0.0010219, 0.0002658 },
+                             { 0.23348, -0.072627, -0.00020079, 0.00007967 } };
+    const Real *p = sp3[std::min(std::max(heavyNeighborCount, 1), 3) - 1];
+
+    const LcpoParameters parameters = { atom->vanDerWaalsRadius(), p[0], p[1], p[2], p[3] };
+    return parameters;
+}
+
 } // end anonymous namespace
 
 // === MolecularSurfacePrivate ============================================= //
@@ -77,6 +278,8 @@ public:
     const Molecule *molecule;
     MolecularSurface::SurfaceType surfaceType;
     Real probeRadius;
+    MolecularSurface::Algorithm algorithm;
+    int spherePointCount;
     std::vector<Point3> points;
     std::vector<Real> radii;
     AlphaShape *alphaShape;
@@ -84,6 +287,8 @@ public:
     Real surfaceArea;
     bool volumeCalculated;
     bool surfaceAreaCalculated;
+    std::vector<Real> atomSurfaceAreas;
+    bool atomSurfaceAreasCalculated;
 };
 
 // === MolecularSurface ==================================================== //
@@ -107,6 +312,19 @@ public:
 /// // calculate the surface area
 /// double area = surface.surfaceArea();
 /// \endcode
+///
+/// By default the surface area is calculated exactly from the alpha
+/// shape of the atoms. For large molecules or for each frame of a
+/// trajectory an approximate algorithm can be used instead, which
+/// also gives the area contributed by each atom:
+/// \code
+/// surface.setAlgorithm(MolecularSurface::ShrakeRupley);
+///
+/// foreach(const TrajectoryFrame *frame, trajectory->frames()){
+///     surface.setCoordinates(frame->coordinates());
+///     std::vector<Real> areas = surface.atomSurfaceAreas();
+/// }
+/// \endcode
 
 /// \enum MolecularSurface::SurfaceType
 /// Provides names for each of the available surface types:
@@ -114,6 +332,17 @@ public:
 ///     - \c SolventAccessible
 ///     - \c SolventExcluded
 
+/// \enum MolecularSurface::Algorithm
+/// Provides names for the surface area algorithms:
+///     - \c Exact, inclusion-exclusion over the alpha shape.
+///     - \c ShrakeRupley, counts the exposed points on a sphere
+///       around each atom. The accuracy is set with
+///       setSpherePointCount().
+///     - \c Lcpo, linear combination of pairwise overlaps. This is
+///       the fastest algorithm but is only parameterized for the
+///       solvent accessible surface of organic molecules and
+///       requires a molecule.
+
 // --- Construction and Destruction ---------------------------------------- //
 /// Creates a new molecular surface for \p molecule.
 MolecularSurface::MolecularSurface(const Molecule *molecule, SurfaceType type)
@@ -122,6 +351,8 @@ MolecularSurface::MolecularSurface(const Molecule *molecule, SurfaceType type)
     d->molecule = molecule;
     d->surfaceType = type;
     d->probeRadius = 1.4;
+    d->algorithm = Exact;
+    d->spherePointCount = 960;
 
     if(molecule){
         foreach(const Atom *atom, molecule->atoms()){
@@ -133,6 +364,7 @@ MolecularSurface::MolecularSurface(const Molecule *molecule, SurfaceType type)
     d->alphaShape = 0;
     d->volumeCalculated = false;
     d->surfaceAreaCalculated = false;
+    d->atomSurfaceAreasCalculated = false;
 }
 
 /// Destroys the molecular surface object.
@@ -201,6 +433,53 @@ Real MolecularSurface::probeRadius() const
     return d->probeRadius;
 }
 
+/// Sets the algorithm used to calculate the surface area to
+/// \p algorithm.
+void MolecularSurface::setAlgorithm(Algorithm algorithm)
+{
+    d->algorithm = algorithm;
+
+    setCalculated(false);
+}
+
+/// Returns the algorithm used to calculate the surface area. The
+/// default algorithm is \c Exact.
+MolecularSurface::Algorithm MolecularSurface::algorithm() const
+{
+    return d->algorithm;
+}
+
+/// Sets the number of points on each sphere used by the Shrake-Rupley
+/// algorithm to \p count. More points give a more accurate area.
+void MolecularSurface::setSpherePointCount(int count)
+{
+    d->spherePointCount = std::max(count, 1);
+
+    setCalculated(false);
+}
+
+/// Returns the number of points on each sphere used by the
+/// Shrake-Rupley algorithm. The default is 960 points.
+int MolecularSurface::spherePointCount() const
+{
+    return d->spherePointCount;
+}
+
+/// Sets the positions of the atoms to \p coordinates. The radii of
+/// the atoms are kept. This is used to calculate the surface of each
+/// frame in a trajectory.
+void MolecularSurface::setCoordinates(const CartesianCoordinates *coordinates)
+{
+    d->points.resize(coordinates->size());
+    d->radii.resize(coordinates->size(), 0);
+
+    for(size_t i = 0; i < coordinates->size(); i++){
+        d->points[i] = coordinates->position(i);
+    }
+
+    setCalculated(false);
+}
+
 const AlphaShape* MolecularSurface::alphaShape() const
 {
     if(!d->alphaShape){
@@ -282,7 +561,17 @@ boost::shared_future<Real> MolecularSurface::volumeAsync() const
 /// area is in Angstroms squared (\f$ \AA^{2} \f$).
 Real MolecularSurface::surfaceArea() const
 {
-    if(!d->surfaceAreaCalculated){
+    if(!d->surfaceAreaCalculated && d->algorithm != Exact){
+        d->surfaceArea = 0;
+
+        calculateAtomSurfaceAreas();
+        foreach(Real area, d->atomSurfaceAreas){
+            d->surfaceArea += area;
+        }
+
+        d->surfaceAreaCalculated = true;
+    }
+    else if(!d->surfaceAreaCalculated){
         d->surfaceArea = 0;
 
         const AlphaShape *alphaShape = this->alphaShape();
@@ -324,6 +613,27 @@ boost::shared_future<Real> MolecularSurface::surfaceAreaAsync() const
     return chemkit::concurrent::run(boost::bind(&MolecularSurface::surfaceArea, this));
 }
 
+/// Returns the surface area contributed by the atom at \p index.
+///
+/// When the algorithm is \c Exact the per-atom areas are
+/// calculated with the Shrake-Rupley algorithm.
+Real MolecularSurface::atomSurfaceArea(int index) const
+{
+    calculateAtomSurfaceAreas();
+
+    return d->atomSurfaceAreas[index];
+}
+
+/// Returns the surface area contributed by each atom.
+///
+/// \see atomSurfaceArea()
+std::vector<Real> MolecularSurface::atomSurfaceAreas() const
+{
+    calculateAtomSurfaceAreas();
+
+    return d->atomSurfaceAreas;
+}
+
 // --- Internal Methods ---------------------------------------------------- //
 void MolecularSurface::setCalculated(bool calculated) const
 {
@@ -332,6 +642,179 @@ void MolecularSurface::setCalculated(bool calculated) const
         d->alphaShape = 0;
         d->volumeCalculated = false;
         d->surfaceAreaCalculated = false;
+        d->atomSurfaceAreasCalculated = false;
+    }
+}
+
+void MolecularSurface::calculateAtomSurfaceAreas() const
+{
+    if(d->atomSurfaceAreasCalculated){
+        return;
+    }
+
+    if(d->algorithm == Lcpo &&
+       d->molecule &&
+       d->molecule->size() == d->points.size()){
+        calculateLcpoAreas();
+    }
+    else{
+        calculateShrakeRupleyAreas();
+    }
+
+    d->atomSurfaceAreasCalculated = true;
+}
+
+void MolecularSurface::calculateShrakeRupleyAreas() const
+{
+    const size_t size = d->points.size();
+    d->atomSurfaceAreas.assign(size, 0);
+    if(size == 0){
+        return;
+    }
+
+    std::vector<Real> radii(size);
+    Real maximumRadius = 0;
+    for(size_t i = 0; i < size; i++){
+        radii[i] = radius(i);
+        maximumRadius = std::max(maximumRadius, radii[i]);
+    }
+
+    std::vector<Real> sx, sy, sz;
+    spherePoints(d->spherePointCount, sx, sy, sz);
+    const int pointCount = d->spherePointCount;
+
+    SpatialGrid grid(d->points, 2 * maximumRadius);
+    std::vector<unsigned char> buried(pointCount);
+
+    for(size_t i = 0; i < size; i++){
+        const Real ri = radii[i];
+        const Point3 &center = d->points[i];
+
+        std::fill(buried.begin(), buried.end(), 0);
+
+        // a sphere point is buried if it is inside of any neighboring
+        // sphere. the loop over the points is kept free of branches so
+        // that it can be vectorized
+        foreach(size_t j, grid.neighbors(i, ri + maximumRadius)){
+            const Real rj = radii[j];
+            const Vector3 offset = center - d->points[j];
+
+            if(offset.norm() >= ri + rj){
+                continue;
+            }
+
+            const Real dx = offset.x();
+            const Real dy = offset.y();
+            const Real dz = offset.z();
+            const Real rj2 = rj * rj;
+
+            for(int k = 0; k < pointCount; k++){
+                Real px = dx + ri * sx[k];
+                Real py = dy + ri * sy[k];
+                Real pz = dz + ri * sz[k];
+
+                buried[k] |= (px*px + py*py + pz*pz < rj2);
+            }
+        }
+
+        int exposedCount = 0;
+        for(int k = 0; k < pointCount; k++){
+            exposedCount += !buried[k];
+        }
+
+        d->atomSurfaceAreas[i] = 4.0 * pi * ri * ri * exposedCount / pointCount;
+    }
+}
+
+void MolecularSurface::calculateLcpoAreas() const
+{
+    const size_t size = d->points.size();
+    d->atomSurfaceAreas.assign(size, 0);
+
+    // hydrogens are not included in the lcpo model
+    const Real probe = d->surfaceType == VanDerWaals ? 0 : d->probeRadius;
+    std::vector<size_t> indices;
+    std::vector<Point3> points;
+    std::vector<LcpoParameters> parameters;
+    Real maximumRadius = 0;
+
+    for(size_t i = 0; i < size; i++){
+        const Atom *atom = d->molecule->atom(i);
+        if(atom->is(Atom::Hydrogen)){
+            continue;
+        }
+
+        LcpoParameters p = lcpoParameters(atom);
+        p.radius += probe;
+
+        indices.push_back(i);
+        points.push_back(d->points[i]);
+        parameters.push_back(p);
+        maximumRadius = std::max(maximumRadius, p.radius);
+    }
+
+    if(points.empty()){
+        return;
+    }
+
+    // find overlapping neighbors of each atom and the area of
+    // each atom buried by each of its neighbors (Aij)
+    SpatialGrid grid(points, 2 * maximumRadius);
+    std::vector<std::vector<size_t> > neighbors(points.size());
+    std::vector<std::vector<Real> > overlaps(points.size());
+
+    for(size_t i = 0; i < points.size(); i++){
+        const Real ri = parameters[i].radius;
+
+        foreach(size_t j, grid.neighbors(i, ri + maximumRadius)){
+            const Real rj = parameters[j].radius;
+            const Real distance = (points[i] - points[j]).norm();
+
+            if(distance >= ri + rj || distance == 0){
+                continue;
+            }
+
+            neighbors[i].push_back(j);
+            overlaps[i].push_back(2.0 * pi * ri * (ri - distance / 2.0 - (ri*ri - rj*rj) / (2.0 * distance)));
+        }
+    }
+
+    for(size_t i = 0; i < points.size(); i++){
+        const LcpoParameters &p = parameters[i];
+        const std::vector<size_t> &ni = neighbors[i];
+
+        Real sumAij = 0;
+        Real sumAjk = 0;
+        Real sumAijAjk = 0;
+
+        for(size_t a = 0; a < ni.size(); a++){
+            const size_t j = ni[a];
+            const std::vector<size_t> &nj = neighbors[j];
+
+            // sum of the overlaps of j with the neighbors it shares
+            // with i. both neighbor lists are sorted
+            Real sumJk = 0;
+            std::vector<size_t>::const_iterator k = ni.begin();
+            for(size_t b = 0; b < nj.size() && k != ni.end(); b++){
+                while(k != ni.end() && *k < nj[b]){
+                    ++k;
+                }
+                if(k != ni.end() && *k == nj[b]){
+                    sumJk += overlaps[j][b];
+                }
+            }
+
+            sumAij += overlaps[i][a];
+            sumAjk += sumJk;
+            sumAijAjk += overlaps[i][a] * sumJk;
+        }
+
+        Real area = p.p1 * 4.0 * pi * p.radius * p.radius +
+                    p.p2 * sumAij +
+                    p.p3 * sumAjk +
+                    p.p4 * sumAijAjk;
+
+        d->atomSurfaceAreas[indices[i]] = std::max(area, Real(0));
     }
 }
 
@@ -38,6 +38,8 @@
 
 #include "chemkit.h"
 
+#include <vector>
+
 #ifndef Q_MOC_RUN
 #include <boost/thread/future.hpp>
 #endif
@@ -48,6 +50,7 @@ namespace chemkit {
 
 class Molecule;
 class AlphaShape;
+class CartesianCoordinates;
 class MolecularSurfacePrivate;
 
 class CHEMKIT_EXPORT MolecularSurface
@@ -60,6 +63,12 @@ public:
         SolventExcluded
     };
 
+    enum Algorithm {
+        Exact,
+        ShrakeRupley,
+        Lcpo
+    };
+
     // construction and destruction
     MolecularSurface(const Molecule *molecule = 0, SurfaceType type = VanDerWaals);
     ~MolecularSurface();
@@ -71,6 +80,11 @@ public:
     SurfaceType surfaceType() const;
     void setProbeRadius(Real radius);
     Real probeRadius() const;
+    void setAlgorithm(Algorithm algorithm);
+    Algorithm algorithm() const;
+    void setSpherePointCount(int count);
+    int spherePointCount() const;
+    void setCoordinates(const CartesianCoordinates *coordinates);
     const AlphaShape* alphaShape() const;
 
     // geometry
@@ -80,10 +94,15 @@ public:
     boost::shared_future<Real> volumeAsync() const;
     Real surfaceArea() const;
     boost::shared_future<Real> surfaceAreaAsync() const;
+    Real atomSurfaceArea(int index) const;
+    std::vector<Real> atomSurfaceAreas() const;
 
 private:
     // internal methods
     void setCalculated(bool calculated) const;
+    void calculateAtomSurfaceAreas() const;
+    void calculateShrakeRupleyAreas() const;
+    void calculateLcpoAreas() const;
     Real intersectionArea(int i, int j) const;
     Real intersectionArea(int i, int j, int k) const;
     Real intersectionArea(int i, int j, int k, int l) const;
@@ -64,8 +64,10 @@
 #include "quaternion.h"
 #include "variantmap.h"
 #include "fingerprint.h"
+#include "moleculegraph.h"
 #include "moleculeprivate.h"
 #include "moleculewatcher.h"
+#include "topologicaldistancematrix.h"
 #include "diagramcoordinates.h"
 #include "internalcoordinates.h"
 #include "moleculardescriptor.h"
@@ -78,6 +80,8 @@ MoleculePrivate::MoleculePrivate()
 {
     fragmentsPerceived = false;
     ringsPerceived = false;
+    graph = 0;
+    topologicalDistanceMatrix = 0;
 }
 
 // === Molecule ============================================================ //
@@ -115,6 +119,13 @@ MoleculePrivate::MoleculePrivate()
 /// Molecule objects take ownership of all the Atom, Bond, Ring,
 /// Fragment, and CoordinateSet objects that they contain. Deleting
 /// the molecule will also delete all of the objects that it contains.
+///
+/// The Atom and Bond objects for a molecule are allocated from
+/// memory pools owned by the molecule. Atoms and bonds added one
+/// after another are stored contiguously and all of their memory is
+/// released at once when the molecule is cleared or destroyed. Use
+/// setAtomCapacity() and setBondCapacity() to allocate the storage
+/// for a molecule of known size up-front.
 
 // --- Construction and Destruction ---------------------------------------- //
 /// Creates a new, empty molecule.
@@ -186,14 +197,17 @@ Molecule::Molecule(const Molecule &molecule)
 /// bonds that the molecule contains.
 Molecule::~Molecule()
 {
+    // the atom and bond memory is released along with their pools
     foreach(Atom *atom, m_atoms)
-        delete atom;
+        atom->~Atom();
     foreach(Bond *bond, d->bonds)
-        delete bond;
+        bond->~Bond();
     foreach(Ring *ring, d->rings)
         delete ring;
     foreach(Fragment *fragment, d->fragments)
         delete fragment;
+    delete d->graph;
+    delete d->topologicalDistanceMatrix;
 
     // delete coordinates and all coordinate sets
     bool deletedCoordinates = false;
@@ -382,7 +396,7 @@ Variant Molecule::data(const std::string &name) const
 /// \endcode
 Atom* Molecule::addAtom(const Element &element)
 {
-    Atom *atom = new Atom(this, m_atoms.size());
+    Atom *atom = new(d->atomPool.allocate()) Atom(this, m_atoms.size());
     m_atoms.push_back(atom);
 
     // add atom properties
@@ -422,46 +436,122 @@ Atom* Molecule::addAtomCopy(const Atom *atom)
 /// to/from the atom.
 void Molecule::removeAtom(Atom *atom)
 {
-    if(!contains(atom)){
+    removeAtoms(std::vector<Atom *>(1, atom));
+}
+
+/// Removes each atom in \p atoms from the molecule. This will also
+/// remove any bonds to/from the atoms.
+///
+/// The atoms are removed together in a single pass over the
+/// molecule's atom data and watchers are notified once for all of
+/// the removed atoms. This is much faster than calling removeAtom()
+/// for each atom when removing many atoms from a large molecule.
+void Molecule::removeAtoms(const std::vector<Atom *> &atoms)
+{
+    // mark atoms to remove
+    std::vector<bool> removed;
+    std::vector<const Atom *> removedAtoms;
+
+    foreach(Atom *atom, atoms){
+        if(!atom || !contains(atom)){
+            continue;
+        }
+
+        if(removed.empty()){
+            removed.resize(m_atoms.size(), false);
+        }
+
+        if(!removed[atom->index()]){
+            removed[atom->index()] = true;
+            removedAtoms.push_back(atom);
+        }
+    }
+
+    if(removedAtoms.empty()){
         return;
     }
 
-    // remove all bonds to/from the atom first
-    removeBonds(atom->bonds());
+    // remove all bonds to/from the atoms first
+    std::vector<Bond *> removedBonds;
+    foreach(const Atom *atom, removedAtoms){
+        foreach(Bond *bond, d->atomBonds[atom->index()]){
+            removedBonds.push_back(bond);
+        }
+    }
 
-    m_atoms.erase(std::remove(m_atoms.begin(), m_atoms.end(), atom), m_atoms.end());
+    removeBonds(removedBonds);
 
-    // remove atom properties
-    m_elements.erase(m_elements.begin() + atom->index());
-    d->isotopes.erase(atom);
-    d->atomBonds.erase(d->atomBonds.begin() + atom->index());
-    d->partialCharges.erase(d->partialCharges.begin() + atom->index());
+    // the removed atoms no longer belong to any fragment
+    if(!d->changedRingAtoms.empty()){
+        size_t changedCount = 0;
 
-    if(atom->index() < d->atomTypes.size()){
-        d->atomTypes.erase(d->atomTypes.begin() + atom->index());
+        foreach(const Atom *atom, d->changedRingAtoms){
+            if(!removed[atom->index()]){
+                d->changedRingAtoms[changedCount++] = atom;
+            }
+        }
+
+        d->changedRingAtoms.resize(changedCount);
     }
 
+    // move each remaining atom and its properties to its new index
+    const size_t typeCount = d->atomTypes.size();
+    size_t newTypeCount = 0;
+    size_t index = 0;
+
+    for(size_t i = 0; i < m_atoms.size(); i++){
+        Atom *atom = m_atoms[i];
+
+        if(removed[i]){
+            d->isotopes.erase(atom);
+            continue;
+        }
+
+        if(index != i){
+            m_atoms[index] = atom;
+            m_elements[index] = m_elements[i];
+            d->atomBonds[index].swap(d->atomBonds[i]);
+            d->partialCharges[index] = d->partialCharges[i];
+
+            if(i < typeCount){
+                d->atomTypes[index].swap(d->atomTypes[i]);
+            }
+
+            if(m_coordinates){
+                m_coordinates->setPosition(index, m_coordinates->position(i));
+            }
+
+            atom->m_index = index;
+        }
+
+        if(i < typeCount){
+            newTypeCount = index + 1;
+        }
+
+        index++;
+    }
+
+    d->atomTypes.resize(newTypeCount);
+    m_atoms.resize(index);
+    m_elements.resize(index);
+    d->atomBonds.resize(index);
+    d->partialCharges.resize(index);
+
     if(m_coordinates){
-        m_coordinates->remove(atom->index());
+        m_coordinates->resize(index);
     }
 
-    // subtract one from the index of all atoms after this one
-    for(size_t i = atom->m_index; i < m_atoms.size(); i++){
-        m_atoms[i]->m_index--;
+    foreach(const Atom *atom, removedAtoms){
+        const_cast<Atom *>(atom)->m_molecule = 0;
     }
 
-    atom->m_molecule = 0;
     setFragmentsPerceived(false);
-    notifyWatchers(atom, MoleculeWatcher::AtomRemoved);
-
-    delete atom;
-}
+    notifyWatchers(removedAtoms, MoleculeWatcher::AtomsRemoved);
 
-/// Removes each atom in \p atoms from the molecule.
-void Molecule::removeAtoms(const std::vector<Atom *> &atoms)
-{
-    BOOST_REVERSE_FOREACH(Atom *atom, atoms){
-        removeAtom(atom);
+    foreach(const Atom *atom, removedAtoms){
+        Atom *removedAtom = const_cast<Atom *>(atom);
+        removedAtom->~Atom();
+        d->atomPool.deallocate(removedAtom);
     }
 }
 
@@ -479,6 +569,7 @@ size_t Molecule::atomCount(const Element &element) const
 void Molecule::setAtomCapacity(size_t capacity)
 {
     m_atoms.reserve(capacity);
+    d->atomPool.reserve(capacity);
     m_elements.reserve(capacity);
     d->atomBonds.reserve(capacity);
     d->partialCharges.reserve(capacity);
@@ -524,7 +615,20 @@ Bond* Molecule::addBond(Atom *a, Atom *b, int order)
         return bond(a, b);
     }
 
-    Bond *bond = new Bond(this, d->bonds.size());
+    // a bond between two atoms which are not already connected cannot
+    // form a new ring, otherwise the rings in their fragment must be
+    // perceived again
+    if(ringsPerceived()){
+        bool bridge = d->atomBonds[a->index()].empty() ||
+                      d->atomBonds[b->index()].empty() ||
+                      (fragmentsPerceived() && !fragmentForAtom(a)->contains(b));
+
+        if(!bridge){
+            d->changedRingAtoms.push_back(a);
+        }
+    }
+
+    Bond *bond = new(d->bondPool.allocate()) Bond(this, d->bonds.size());
     d->atomBonds[a->index()].push_back(bond);
     d->atomBonds[b->index()].push_back(bond);
     d->bonds.push_back(bond);
@@ -533,7 +637,6 @@ Bond* Molecule::addBond(Atom *a, Atom *b, int order)
     d->bondAtoms.push_back(std::make_pair(a, b));
     d->bondOrders.push_back(order);
 
-    setRingsPerceived(false);
     setFragmentsPerceived(false);
 
     notifyWatchers(bond, MoleculeWatcher::BondAdded);
@@ -552,30 +655,7 @@ void Molecule::removeBond(Bond *bond)
 {
     assert(bond->molecule() == this);
 
-    d->bonds.erase(d->bonds.begin() + bond->index());
-
-    // remove bond from atom bond vectors
-    std::vector<Bond *> &bondsA = d->atomBonds[bond->atom1()->index()];
-    std::vector<Bond *> &bondsB = d->atomBonds[bond->atom2()->index()];
-
-    bondsA.erase(std::find(bondsA.begin(), bondsA.end(), bond));
-    bondsB.erase(std::find(bondsB.begin(), bondsB.end(), bond));
-
-    // remove bond properties
-    d->bondAtoms.erase(d->bondAtoms.begin() + bond->index());
-    d->bondOrders.erase(d->bondOrders.begin() + bond->index());
-
-    // subtract one from the index of all bonds after this one
-    for(size_t i = bond->index(); i < d->bonds.size(); i++){
-        d->bonds[i]->m_index--;
-    }
-
-    setRingsPerceived(false);
-    setFragmentsPerceived(false);
-
-    notifyWatchers(bond, MoleculeWatcher::BondRemoved);
-
-    delete bond;
+    removeBonds(std::vector<Bond *>(1, bond));
 }
 
 /// Removes the bond between atoms \p a and \p b. Does nothing if
@@ -596,10 +676,110 @@ void Molecule::removeBond(size_t a, size_t b)
 }
 
 /// Removes each bond in \p bonds from the molecule.
+///
+/// The bonds are removed together in a single pass over the
+/// molecule's bond data and watchers are notified once for all of
+/// the removed bonds.
 void Molecule::removeBonds(const std::vector<Bond *> &bonds)
 {
-    BOOST_REVERSE_FOREACH(Bond *bond, bonds){
-        removeBond(bond);
+    // mark bonds to remove
+    std::vector<bool> removed;
+    std::vector<const Bond *> removedBonds;
+
+    foreach(Bond *bond, bonds){
+        if(!bond || bond->molecule() != this){
+            continue;
+        }
+
+        if(removed.empty()){
+            removed.resize(d->bonds.size(), false);
+        }
+
+        if(!removed[bond->index()]){
+            removed[bond->index()] = true;
+            removedBonds.push_back(bond);
+        }
+    }
+
+    if(removedBonds.empty()){
+        return;
+    }
+
+    // removing a bond which is not in a ring does not change the
+    // rings. rings containing a removed bond are deleted and the
+    // other rings in their fragments are perceived again.
+    if(ringsPerceived()){
+        size_t ringCount = 0;
+
+        foreach(Ring *ring, d->rings){
+            bool broken = false;
+
+            foreach(const Bond *bond, ring->bonds()){
+                if(!bond || removed[bond->index()]){
+                    broken = true;
+                    break;
+                }
+            }
+
+            if(broken){
+                foreach(const Atom *atom, ring->atoms()){
+                    d->changedRingAtoms.push_back(atom);
+                }
+
+                delete ring;
+            }
+            else{
+                d->rings[ringCount++] = ring;
+            }
+        }
+
+        d->rings.resize(ringCount);
+    }
+
+    // remove bonds from the bond vectors of their atoms
+    foreach(const Bond *bond, removedBonds){
+        const std::pair<Atom *, Atom *> &atoms = d->bondAtoms[bond->index()];
+
+        std::vector<Bond *> &bondsA = d->atomBonds[atoms.first->index()];
+        std::vector<Bond *> &bondsB = d->atomBonds[atoms.second->index()];
+
+        bondsA.erase(std::find(bondsA.begin(), bondsA.end(), bond));
+        bondsB.erase(std::find(bondsB.begin(), bondsB.end(), bond));
+    }
+
+    // move each remaining bond and its properties to its new index
+    size_t index = 0;
+
+    for(size_t i = 0; i < d->bonds.size(); i++){
+        if(removed[i]){
+            continue;
+        }
+
+        if(index != i){
+            Bond *bond = d->bonds[i];
+
+            d->bonds[index] = bond;
+            d->bondAtoms[index] = d->bondAtoms[i];
+            d->bondOrders[index] = d->bondOrders[i];
+
+            bond->m_index = index;
+        }
+
+        index++;
+    }
+
+    d->bonds.resize(index);
+    d->bondAtoms.resize(index);
+    d->bondOrders.resize(index);
+
+    setFragmentsPerceived(false);
+
+    notifyWatchers(removedBonds, MoleculeWatcher::BondsRemoved);
+
+    foreach(const Bond *bond, removedBonds){
+        Bond *removedBond = const_cast<Bond *>(bond);
+        removedBond->~Bond();
+        d->bondPool.deallocate(removedBond);
     }
 }
 
@@ -643,6 +823,7 @@ Bond* Molecule::bond(size_t a, size_t b) const
 void Molecule::setBondCapacity(size_t capacity)
 {
     d->bonds.reserve(capacity);
+    d->bondPool.reserve(capacity);
     d->bondOrders.reserve(capacity);
     d->bondAtoms.reserve(capacity);
 }
@@ -661,11 +842,96 @@ bool Molecule::contains(const Bond *bond) const
     return contains(bond->atom1());
 }
 
+/// Returns the connectivity graph for the molecule.
+///
+/// The graph is created the first time this method is called and
+/// is kept until the molecule's atoms or bonds are changed. It
+/// provides faster access to the neighbors of each atom than the
+/// Atom::neighbors() method and is intended for use by graph
+/// algorithms which do not modify the molecule.
+///
+/// \warning The returned graph is only valid as long as the
+///          molecule's structure remains unchanged.
+const MoleculeGraph* Molecule::graph() const
+{
+    if(!d->graph){
+        d->graph = new MoleculeGraph(this);
+    }
+
+    return d->graph;
+}
+
+/// Returns the topological distance matrix for the molecule. This
+/// contains the number of bonds on the shortest path between each
+/// pair of atoms.
+///
+/// Like graph(), the matrix is created the first time this method
+/// is called and is kept until the molecule's atoms or bonds are
+/// changed. Graph descriptors which need the distances between many
+/// pairs of atoms should use this instead of searching the molecule
+/// for each pair.
+///
+/// \warning The returned matrix is only valid as long as the
+///          molecule's structure remains unchanged.
+const TopologicalDistanceMatrix* Molecule::topologicalDistanceMatrix() const
+{
+    if(!d->topologicalDistanceMatrix){
+        d->topologicalDistanceMatrix = new TopologicalDistanceMatrix(this);
+    }
+
+    return d->topologicalDistanceMatrix;
+}
+
 /// Removes all atoms and bonds from the molecule.
+///
+/// The memory used by the atoms and bonds is released in one step
+/// rather than removing each atom and bond individually.
 void Molecule::clear()
 {
-    removeBonds(d->bonds);
-    removeAtoms(m_atoms);
+    // notify watchers in the same way that removeAtoms() would
+    if(!d->watchers.empty()){
+        if(!d->bonds.empty()){
+            notifyWatchers(std::vector<const Bond *>(d->bonds.begin(), d->bonds.end()),
+                           MoleculeWatcher::BondsRemoved);
+        }
+
+        foreach(Atom *atom, m_atoms){
+            atom->m_molecule = 0;
+        }
+
+        if(!m_atoms.empty()){
+            notifyWatchers(std::vector<const Atom *>(m_atoms.begin(), m_atoms.end()),
+                           MoleculeWatcher::AtomsRemoved);
+        }
+    }
+
+    foreach(Bond *bond, d->bonds){
+        bond->~Bond();
+    }
+    foreach(Atom *atom, m_atoms){
+        atom->~Atom();
+    }
+
+    d->bonds.clear();
+    d->bondAtoms.clear();
+    d->bondOrders.clear();
+    d->bondPool.release();
+
+    m_atoms.clear();
+    m_elements.clear();
+    d->isotopes.clear();
+    d->atomBonds.clear();
+    d->atomTypes.clear();
+    d->partialCharges.clear();
+    d->atomPool.release();
+
+    if(m_coordinates){
+        m_coordinates->resize(0);
+    }
+
+    invalidateGraph();
+    setRingsPerceived(false);
+    setFragmentsPerceived(false);
 }
 
 // --- Ring Perception ----------------------------------------------------- //
@@ -685,6 +951,12 @@ Ring* Molecule::ring(size_t index) const
 /// This method implements the
 /// \blueobeliskalgorithm{findSmallestSetOfSmallestRings}.
 ///
+/// Ring perception is incremental. Adding or removing a bond which
+/// is not part of a ring (including any bond which joins two
+/// fragments) keeps the current rings. Other changes cause only the
+/// rings in the affected fragments to be perceived again the next
+/// time this method is called.
+///
 /// \warning The range of rings returned from this method is only
 ///          valid as long as the molecule's structure remains
 ///          unchanged. If any atoms or bonds in the molecule are
@@ -702,6 +974,9 @@ Molecule::RingRange Molecule::rings() const
         // set perceived to true
         setRingsPerceived(true);
     }
+    else if(!d->changedRingAtoms.empty()){
+        perceiveChangedRings();
+    }
 
     return boost::make_iterator_range(d->rings.begin(), d->rings.end());
 }
@@ -724,6 +999,7 @@ void Molecule::setRingsPerceived(bool perceived) const
         }
 
         d->rings.clear();
+        d->changedRingAtoms.clear();
     }
 
     d->ringsPerceived = perceived;
@@ -734,6 +1010,64 @@ bool Molecule::ringsPerceived() const
     return d->ringsPerceived;
 }
 
+// Perceives the rings again in each fragment containing an atom
+// whose rings were changed. The rings in other fragments are kept.
+void Molecule::perceiveChangedRings() const
+{
+    // find the fragments containing changed atoms
+    Bitset changedAtoms(m_atoms.size());
+    foreach(const Atom *atom, d->changedRingAtoms){
+        changedAtoms.set(atom->index());
+    }
+
+    d->changedRingAtoms.clear();
+
+    std::vector<const Fragment *> changedFragments;
+    std::vector<size_t> atomFragments(m_atoms.size());
+    Bitset changedFragmentAtoms(m_atoms.size());
+
+    size_t fragmentIndex = 0;
+    foreach(const Fragment *fragment, fragments()){
+        if(fragment->m_bitset.intersects(changedAtoms)){
+            changedFragments.push_back(fragment);
+            changedFragmentAtoms |= fragment->m_bitset;
+        }
+
+        const Bitset &atoms = fragment->m_bitset;
+        for(size_t i = atoms.find_first(); i != Bitset::npos; i = atoms.find_next(i)){
+            atomFragments[i] = fragmentIndex;
+        }
+
+        fragmentIndex++;
+    }
+
+    // delete the old rings in the changed fragments and perceive them
+    // again, keeping the rings ordered by fragment
+    std::vector<std::vector<Ring *> > fragmentRings(fragmentIndex);
+
+    foreach(Ring *ring, d->rings){
+        size_t atom = ring->atom(0)->index();
+
+        if(changedFragmentAtoms.test(atom)){
+            delete ring;
+        }
+        else{
+            fragmentRings[atomFragments[atom]].push_back(ring);
+        }
+    }
+
+    foreach(const Fragment *fragment, changedFragments){
+        foreach(const std::vector<Atom *> &ring, chemkit::algorithm::rppath(fragment)){
+            fragmentRings[atomFragments[ring[0]->index()]].push_back(new Ring(ring));
+        }
+    }
+
+    d->rings.clear();
+    foreach(const std::vector<Ring *> &rings, fragmentRings){
+        d->rings.insert(d->rings.end(), rings.begin(), rings.end());
+    }
+}
+
 // --- Fragment Perception-------------------------------------------------- //
 /// Returns the fragment at \p index.
 ///
@@ -817,6 +1151,15 @@ bool Molecule::fragmentsPerceived() const
     return d->fragmentsPerceived;
 }
 
+void Molecule::invalidateGraph() const
+{
+    delete d->graph;
+    d->graph = 0;
+
+    delete d->topologicalDistanceMatrix;
+    d->topologicalDistanceMatrix = 0;
+}
+
 void Molecule::perceiveFragments() const
 {
     if(isEmpty()){
@@ -1122,6 +1465,10 @@ void Molecule::notifyWatchers(MoleculeWatcher::ChangeType type)
 
 void Molecule::notifyWatchers(const Atom *atom, MoleculeWatcher::ChangeType type)
 {
+    if(type == MoleculeWatcher::AtomAdded || type == MoleculeWatcher::AtomRemoved){
+        invalidateGraph();
+    }
+
     foreach(MoleculeWatcher *watcher, d->watchers){
         watcher->atomChanged(atom, type);
     }
@@ -1129,11 +1476,32 @@ void Molecule::notifyWatchers(const Atom *atom, MoleculeWatcher::ChangeType type
 
 void Molecule::notifyWatchers(const Bond *bond, MoleculeWatcher::ChangeType type)
 {
+    // bond changes always affect the graph
+    invalidateGraph();
+
     foreach(MoleculeWatcher *watcher, d->watchers){
         watcher->bondChanged(bond, type);
     }
 }
 
+void Molecule::notifyWatchers(const std::vector<const Atom *> &atoms, MoleculeWatcher::ChangeType type)
+{
+    invalidateGraph();
+
+    foreach(MoleculeWatcher *watcher, d->watchers){
+        watcher->atomsChanged(atoms, type);
+    }
+}
+
+void Molecule::notifyWatchers(const std::vector<const Bond *> &bonds, MoleculeWatcher::ChangeType type)
+{
+    invalidateGraph();
+
+    foreach(MoleculeWatcher *watcher, d->watchers){
+        watcher->bondsChanged(bonds, type);
+    }
+}
+
 void Molecule::addWatcher(MoleculeWatcher *watcher) const
 {
     d->watchers.push_back(watcher);
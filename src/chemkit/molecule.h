@@ -60,9 +60,11 @@ class Atom;
 class Bond;
 class Ring;
 class Fragment;
+class MoleculeGraph;
 class MoleculePrivate;
 class MoleculeWatcher;
 class Stereochemistry;
+class TopologicalDistanceMatrix;
 class DiagramCoordinates;
 class InternalCoordinates;
 class CartesianCoordinates;
@@ -127,6 +129,8 @@ public:
     void setBondCapacity(size_t capacity);
     size_t bondCapacity() const;
     bool contains(const Bond *bond) const;
+    const MoleculeGraph* graph() const;
+    const TopologicalDistanceMatrix* topologicalDistanceMatrix() const;
     void clear();
 
     // ring perception
@@ -171,13 +175,17 @@ private:
     // internal methods
     void setRingsPerceived(bool perceived) const;
     bool ringsPerceived() const;
+    void perceiveChangedRings() const;
     void setFragmentsPerceived(bool perceived) const;
     bool fragmentsPerceived() const;
     void perceiveFragments() const;
     Fragment* fragmentForAtom(const Atom *atom) const;
+    void invalidateGraph() const;
     void notifyWatchers(MoleculeWatcher::ChangeType type);
     void notifyWatchers(const Atom *atom, MoleculeWatcher::ChangeType type);
     void notifyWatchers(const Bond *bond, MoleculeWatcher::ChangeType type);
+    void notifyWatchers(const std::vector<const Atom *> &atoms, MoleculeWatcher::ChangeType type);
+    void notifyWatchers(const std::vector<const Bond *> &bonds, MoleculeWatcher::ChangeType type);
     void addWatcher(MoleculeWatcher *watcher) const;
     void removeWatcher(MoleculeWatcher *watcher) const;
     Stereochemistry* stereochemistry();
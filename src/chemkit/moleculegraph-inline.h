@@ -0,0 +1,127 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+#ifndef CHEMKIT_MOLECULEGRAPH_INLINE_H
+#define CHEMKIT_MOLECULEGRAPH_INLINE_H
+
+#include "moleculegraph.h"
+
+#include <cassert>
+
+namespace chemkit {
+
+// --- Properties ---------------------------------------------------------- //
+/// Returns the number of vertices in the graph.
+inline size_t MoleculeGraph::size() const
+{
+    return vertexCount();
+}
+
+/// Returns \c true if the graph contains no vertices.
+inline bool MoleculeGraph::isEmpty() const
+{
+    return size() == 0;
+}
+
+/// Returns the number of vertices in the graph.
+inline size_t MoleculeGraph::vertexCount() const
+{
+    return m_offsets.size() - 1;
+}
+
+/// Returns the number of edges in the graph.
+inline size_t MoleculeGraph::edgeCount() const
+{
+    return m_neighbors.size() / 2;
+}
+
+// --- Structure ----------------------------------------------------------- //
+/// Returns the number of neighbors of \p vertex.
+inline size_t MoleculeGraph::degree(size_t vertex) const
+{
+    assert(vertex < vertexCount());
+
+    return m_offsets[vertex + 1] - m_offsets[vertex];
+}
+
+/// Returns a range containing the indices of each vertex adjacent
+/// to \p vertex.
+inline MoleculeGraph::IndexRange MoleculeGraph::neighbors(size_t vertex) const
+{
+    assert(vertex < vertexCount());
+
+    return boost::make_iterator_range(m_neighbors.begin() + m_offsets[vertex],
+                                      m_neighbors.begin() + m_offsets[vertex + 1]);
+}
+
+/// Returns the neighbor at \p index for \p vertex.
+inline size_t MoleculeGraph::neighbor(size_t vertex, size_t index) const
+{
+    assert(index < degree(vertex));
+
+    return m_neighbors[m_offsets[vertex] + index];
+}
+
+/// Returns a range containing the molecule bond index for each of
+/// the edges of \p vertex. The bonds are in the same order as the
+/// vertices returned from neighbors().
+inline MoleculeGraph::IndexRange MoleculeGraph::bonds(size_t vertex) const
+{
+    assert(vertex < vertexCount());
+
+    return boost::make_iterator_range(m_bonds.begin() + m_offsets[vertex],
+                                      m_bonds.begin() + m_offsets[vertex + 1]);
+}
+
+/// Returns the molecule bond index of the edge at \p index for
+/// \p vertex.
+inline size_t MoleculeGraph::bond(size_t vertex, size_t index) const
+{
+    assert(index < degree(vertex));
+
+    return m_bonds[m_offsets[vertex] + index];
+}
+
+/// Returns the bond order of the edge at \p index for \p vertex.
+inline Bond::BondOrderType MoleculeGraph::bondOrder(size_t vertex, size_t index) const
+{
+    assert(index < degree(vertex));
+
+    return m_bondOrders[m_offsets[vertex] + index];
+}
+
+} // end chemkit namespace
+
+#endif // CHEMKIT_MOLECULEGRAPH_INLINE_H
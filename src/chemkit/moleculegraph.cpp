@@ -0,0 +1,167 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+#include "moleculegraph.h"
+
+#include "atom.h"
+#include "bond.h"
+#include "foreach.h"
+#include "molecule.h"
+
+namespace chemkit {
+
+// === MoleculeGraph ======================================================= //
+/// \class MoleculeGraph moleculegraph.h chemkit/moleculegraph.h
+/// \ingroup chemkit
+/// \brief The MoleculeGraph class provides a compact, read-only view
+///        of a molecule's connectivity.
+///
+/// The graph stores the neighbors of every atom in a single
+/// contiguous array indexed by a per-atom offset (also known as the
+/// compressed sparse row format). Each neighbor entry is paired with
+/// the index and order of the bond connecting the two atoms.
+///
+/// The graph for a molecule is available from Molecule::graph()
+/// which creates it lazily and discards it whenever the structure
+/// of the molecule changes.
+
+// --- Construction and Destruction ---------------------------------------- //
+/// Creates a new, empty molecule graph.
+MoleculeGraph::MoleculeGraph()
+    : m_offsets(1, 0)
+{
+}
+
+/// Creates a new molecule graph containing every atom and bond in
+/// \p molecule. Vertex indices are equal to atom indices.
+MoleculeGraph::MoleculeGraph(const Molecule *molecule)
+    : m_offsets(molecule->atomCount() + 1, 0)
+{
+    // count the neighbors for each atom
+    foreach(const Bond *bond, molecule->bonds()){
+        m_offsets[bond->atom1()->index() + 1]++;
+        m_offsets[bond->atom2()->index() + 1]++;
+    }
+
+    for(size_t i = 0; i < molecule->atomCount(); i++){
+        m_offsets[i + 1] += m_offsets[i];
+    }
+
+    m_neighbors.resize(m_offsets.back());
+    m_bonds.resize(m_offsets.back());
+    m_bondOrders.resize(m_offsets.back());
+
+    // fill in the neighbors in the same order as Atom::neighbors()
+    for(size_t i = 0; i < molecule->atomCount(); i++){
+        const Atom *atom = molecule->atom(i);
+        size_t position = m_offsets[i];
+
+        foreach(const Bond *bond, atom->bonds()){
+            m_neighbors[position] = bond->otherAtom(atom)->index();
+            m_bonds[position] = bond->index();
+            m_bondOrders[position] = bond->order();
+            position++;
+        }
+    }
+}
+
+/// Creates a new molecule graph containing each atom in \p atoms
+/// and the bonds between them. The vertex at index \c i in the
+/// graph corresponds to the atom at index \c i in \p atoms. All of
+/// the atoms must belong to the same molecule.
+MoleculeGraph::MoleculeGraph(const std::vector<Atom *> &atoms)
+    : m_offsets(atoms.size() + 1, 0)
+{
+    if(atoms.empty()){
+        return;
+    }
+
+    const Molecule *molecule = atoms.front()->molecule();
+    const MoleculeGraph *graph = molecule->graph();
+
+    // map from atom index to vertex index
+    std::vector<size_t> vertices(molecule->atomCount(), npos);
+    for(size_t i = 0; i < atoms.size(); i++){
+        vertices[atoms[i]->index()] = i;
+    }
+
+    for(size_t i = 0; i < atoms.size(); i++){
+        size_t atom = atoms[i]->index();
+
+        for(size_t j = 0; j < graph->degree(atom); j++){
+            size_t vertex = vertices[graph->neighbor(atom, j)];
+
+            if(vertex != npos){
+                m_neighbors.push_back(vertex);
+                m_bonds.push_back(graph->bond(atom, j));
+                m_bondOrders.push_back(graph->bondOrder(atom, j));
+            }
+        }
+
+        m_offsets[i + 1] = m_neighbors.size();
+    }
+}
+
+/// Destroys the molecule graph.
+MoleculeGraph::~MoleculeGraph()
+{
+}
+
+// --- Structure ----------------------------------------------------------- //
+/// Returns the molecule bond index for the edge between vertices
+/// \p a and \p b. Returns \c npos if they are not adjacent.
+size_t MoleculeGraph::bondBetween(size_t a, size_t b) const
+{
+    for(size_t i = m_offsets[a]; i < m_offsets[a + 1]; i++){
+        if(m_neighbors[i] == b){
+            return m_bonds[i];
+        }
+    }
+
+    return npos;
+}
+
+/// Returns \c true if vertices \p a and \p b are adjacent.
+bool MoleculeGraph::isAdjacent(size_t a, size_t b) const
+{
+    return bondBetween(a, b) != npos;
+}
+
+// --- Constants ----------------------------------------------------------- //
+/// Value returned from bondBetween() when two vertices are not
+/// adjacent.
+const size_t MoleculeGraph::npos = size_t(-1);
+
+} // end chemkit namespace
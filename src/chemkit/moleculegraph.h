@@ -0,0 +1,96 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+#ifndef CHEMKIT_MOLECULEGRAPH_H
+#define CHEMKIT_MOLECULEGRAPH_H
+
+#include "chemkit.h"
+
+#include <vector>
+
+#ifndef Q_MOC_RUN
+#include <boost/range/iterator_range.hpp>
+#endif
+
+#include "bond.h"
+
+namespace chemkit {
+
+class Atom;
+class Molecule;
+
+class CHEMKIT_EXPORT MoleculeGraph
+{
+public:
+    // typedefs
+    typedef boost::iterator_range<std::vector<size_t>::const_iterator> IndexRange;
+
+    // construction and destruction
+    MoleculeGraph();
+    MoleculeGraph(const Molecule *molecule);
+    MoleculeGraph(const std::vector<Atom *> &atoms);
+    ~MoleculeGraph();
+
+    // properties
+    inline size_t size() const;
+    inline bool isEmpty() const;
+    inline size_t vertexCount() const;
+    inline size_t edgeCount() const;
+
+    // structure
+    inline size_t degree(size_t vertex) const;
+    inline IndexRange neighbors(size_t vertex) const;
+    inline size_t neighbor(size_t vertex, size_t index) const;
+    inline IndexRange bonds(size_t vertex) const;
+    inline size_t bond(size_t vertex, size_t index) const;
+    inline Bond::BondOrderType bondOrder(size_t vertex, size_t index) const;
+    size_t bondBetween(size_t a, size_t b) const;
+    bool isAdjacent(size_t a, size_t b) const;
+
+    // constants
+    static const size_t npos;
+
+private:
+    std::vector<size_t> m_offsets;
+    std::vector<size_t> m_neighbors;
+    std::vector<size_t> m_bonds;
+    std::vector<Bond::BondOrderType> m_bondOrders;
+};
+
+} // end chemkit namespace
+
+#include "moleculegraph-inline.h"
+
+#endif // CHEMKIT_MOLECULEGRAPH_H
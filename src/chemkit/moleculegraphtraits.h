@@ -41,6 +41,7 @@
 #ifndef Q_MOC_RUN
 #include <boost/graph/properties.hpp>
 #include <boost/graph/graph_traits.hpp>
+#include <boost/iterator/iterator_adaptor.hpp>
 #include <boost/property_map/property_map.hpp>
 #include <boost/type_traits/remove_reference.hpp>
 #endif
@@ -48,6 +49,7 @@
 #include "atom.h"
 #include "bond.h"
 #include "molecule.h"
+#include "moleculegraph.h"
 
 namespace boost {
 
@@ -123,6 +125,78 @@ private:
     const chemkit::Atom *m_source;
 };
 
+// === Molecule Graph Out Edge Iterator ==================================== //
+class chemkit_molecule_graph_out_edge_iterator :
+    public iterator_adaptor<chemkit_molecule_graph_out_edge_iterator,
+                            chemkit::MoleculeGraph::IndexRange::const_iterator,
+                            std::pair<const chemkit::Bond*, bool>,
+                            use_default,
+                            std::pair<const chemkit::Bond*, bool> >
+{
+public:
+    typedef chemkit::MoleculeGraph::IndexRange::const_iterator BaseIterator;
+
+    chemkit_molecule_graph_out_edge_iterator()
+        : m_source(0)
+    {
+    }
+
+    chemkit_molecule_graph_out_edge_iterator(const BaseIterator &base,
+                                             const chemkit::Atom *source)
+        : chemkit_molecule_graph_out_edge_iterator::iterator_adaptor_(base),
+          m_source(source)
+    {
+    }
+
+private:
+    std::pair<const chemkit::Bond *, bool> dereference() const
+    {
+        const chemkit::Bond *bond = m_source->molecule()->bond(*base_reference());
+
+        return std::make_pair(bond, m_source == bond->atom1());
+    }
+
+    friend class iterator_core_access;
+
+private:
+    const chemkit::Atom *m_source;
+};
+
+// === Molecule Graph Adjacency Iterator =================================== //
+class chemkit_molecule_graph_adjacency_iterator :
+    public iterator_adaptor<chemkit_molecule_graph_adjacency_iterator,
+                            chemkit::MoleculeGraph::IndexRange::const_iterator,
+                            const chemkit::Atom*,
+                            use_default,
+                            const chemkit::Atom*>
+{
+public:
+    typedef chemkit::MoleculeGraph::IndexRange::const_iterator BaseIterator;
+
+    chemkit_molecule_graph_adjacency_iterator()
+        : m_molecule(0)
+    {
+    }
+
+    chemkit_molecule_graph_adjacency_iterator(const BaseIterator &base,
+                                              const chemkit::Molecule *molecule)
+        : chemkit_molecule_graph_adjacency_iterator::iterator_adaptor_(base),
+          m_molecule(molecule)
+    {
+    }
+
+private:
+    const chemkit::Atom* dereference() const
+    {
+        return m_molecule->atom(*base_reference());
+    }
+
+    friend class iterator_core_access;
+
+private:
+    const chemkit::Molecule *m_molecule;
+};
+
 // === Molecule Graph Traits =============================================== //
 struct chemkit_molecule_graph_traversal_category :
         public virtual incidence_graph_tag,
@@ -138,9 +212,9 @@ struct graph_traits<chemkit::Molecule>
 {
     typedef const chemkit::Atom* vertex_descriptor;
     typedef std::pair<const chemkit::Bond*, bool> edge_descriptor;
-    typedef chemkit::Atom::NeighborRange::const_iterator adjacency_iterator;
-    typedef chemkit_molecule_graph_edge_iterator out_edge_iterator;
-    typedef chemkit_molecule_graph_edge_iterator in_edge_iterator;
+    typedef chemkit_molecule_graph_adjacency_iterator adjacency_iterator;
+    typedef chemkit_molecule_graph_out_edge_iterator out_edge_iterator;
+    typedef chemkit_molecule_graph_out_edge_iterator in_edge_iterator;
     typedef chemkit::Molecule::AtomRange::const_iterator vertex_iterator;
     typedef chemkit_molecule_graph_edge_iterator edge_iterator;
     typedef undirected_tag directed_category;
@@ -182,12 +256,10 @@ inline std::pair<graph_traits<chemkit::Molecule>::out_edge_iterator,
 out_edges(graph_traits<chemkit::Molecule>::vertex_descriptor vertex,
           const chemkit::Molecule &graph)
 {
-    CHEMKIT_UNUSED(graph);
+    const chemkit::MoleculeGraph::IndexRange bonds = graph.graph()->bonds(vertex->index());
 
-    const chemkit::Atom::BondRange bonds = vertex->bonds();
-
-    return std::make_pair(chemkit_molecule_graph_edge_iterator(bonds.begin(), vertex),
-                          chemkit_molecule_graph_edge_iterator(bonds.end(), vertex));
+    return std::make_pair(chemkit_molecule_graph_out_edge_iterator(bonds.begin(), vertex),
+                          chemkit_molecule_graph_out_edge_iterator(bonds.end(), vertex));
 }
 
 inline std::pair<graph_traits<chemkit::Molecule>::in_edge_iterator,
@@ -195,30 +267,24 @@ inline std::pair<graph_traits<chemkit::Molecule>::in_edge_iterator,
 in_edges(graph_traits<chemkit::Molecule>::vertex_descriptor vertex,
          const chemkit::Molecule &graph)
 {
-    CHEMKIT_UNUSED(graph);
-
-    const chemkit::Atom::BondRange bonds = vertex->bonds();
+    const chemkit::MoleculeGraph::IndexRange bonds = graph.graph()->bonds(vertex->index());
 
-    return std::make_pair(chemkit_molecule_graph_edge_iterator(bonds.begin(), vertex),
-                          chemkit_molecule_graph_edge_iterator(bonds.end(), vertex));
+    return std::make_pair(chemkit_molecule_graph_out_edge_iterator(bonds.begin(), vertex),
+                          chemkit_molecule_graph_out_edge_iterator(bonds.end(), vertex));
 }
 
 inline graph_traits<chemkit::Molecule>::degree_size_type
 out_degree(graph_traits<chemkit::Molecule>::vertex_descriptor vertex,
            const chemkit::Molecule &graph)
 {
-    CHEMKIT_UNUSED(graph);
-
-    return vertex->neighborCount();
+    return graph.graph()->degree(vertex->index());
 }
 
 inline graph_traits<chemkit::Molecule>::degree_size_type
 in_degree(graph_traits<chemkit::Molecule>::vertex_descriptor vertex,
           const chemkit::Molecule &graph)
 {
-    CHEMKIT_UNUSED(graph);
-
-    return vertex->neighborCount();
+    return graph.graph()->degree(vertex->index());
 }
 
 inline std::pair<graph_traits<chemkit::Molecule>::vertex_iterator,
@@ -241,11 +307,10 @@ inline std::pair<graph_traits<chemkit::Molecule>::adjacency_iterator,
 adjacent_vertices(graph_traits<chemkit::Molecule>::vertex_descriptor vertex,
                   const chemkit::Molecule &graph)
 {
-    CHEMKIT_UNUSED(graph);
-
-    const chemkit::Atom::NeighborRange neighbors = vertex->neighbors();
+    const chemkit::MoleculeGraph::IndexRange neighbors = graph.graph()->neighbors(vertex->index());
 
-    return std::make_pair(neighbors.begin(), neighbors.end());
+    return std::make_pair(chemkit_molecule_graph_adjacency_iterator(neighbors.begin(), &graph),
+                          chemkit_molecule_graph_adjacency_iterator(neighbors.end(), &graph));
 }
 
 inline std::pair<graph_traits<chemkit::Molecule>::edge_iterator,
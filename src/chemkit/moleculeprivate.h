@@ -42,9 +42,11 @@
 #include <string>
 #include <vector>
 
+#include "atom.h"
 #include "bond.h"
 #include "point3.h"
 #include "isotope.h"
+#include "objectpool.h"
 #include "variantmap.h"
 
 namespace chemkit {
@@ -54,7 +56,9 @@ class Bond;
 class Ring;
 class Fragment;
 class CoordinateSet;
+class MoleculeGraph;
 class MoleculeWatcher;
+class TopologicalDistanceMatrix;
 
 class MoleculePrivate
 {
@@ -65,8 +69,11 @@ public:
     std::vector<Bond *> bonds;
     bool ringsPerceived;
     std::vector<Ring *> rings;
+    std::vector<const Atom *> changedRingAtoms;
     bool fragmentsPerceived;
     std::vector<Fragment *> fragments;
+    MoleculeGraph *graph;
+    TopologicalDistanceMatrix *topologicalDistanceMatrix;
     std::vector<MoleculeWatcher *> watchers;
     VariantMap data;
     std::map<const Atom *, Isotope> isotopes;
@@ -76,6 +83,8 @@ public:
     std::vector<std::vector<Bond *> > atomBonds;
     std::vector<Bond::BondOrderType> bondOrders;
     std::vector<boost::shared_ptr<CoordinateSet> > coordinateSets;
+    ObjectPool<Atom> atomPool;
+    ObjectPool<Bond> bondPool;
 };
 
 } // end chemkit namespace
@@ -35,6 +35,7 @@
 
 #include "moleculewatcher.h"
 
+#include "foreach.h"
 #include "molecule.h"
 
 namespace chemkit {
@@ -104,6 +105,11 @@ const Molecule* MoleculeWatcher::molecule() const
 ///
 /// This signal is emitted when an atom is removed.
 
+/// \fn void MoleculeWatcher::atomsRemoved(const std::vector<const Atom *> &atoms)
+///
+/// This signal is emitted once when several atoms are removed
+/// together. The atomRemoved() signal is also emitted for each atom.
+
 /// \fn void MoleculeWatcher::atomElementChanged(const Atom *atom)
 ///
 /// This signal is emitted when an atom's element changes.
@@ -120,6 +126,11 @@ const Molecule* MoleculeWatcher::molecule() const
 ///
 /// This signal is emitted when a bond is removed.
 
+/// \fn void MoleculeWatcher::bondsRemoved(const std::vector<const Bond *> &bonds)
+///
+/// This signal is emitted once when several bonds are removed
+/// together. The bondRemoved() signal is also emitted for each bond.
+
 /// \fn void MoleculeWatcher::bondOrderChanged(const Bond *bond)
 ///
 /// This signal is emitted when a bond's order changes.
@@ -176,4 +187,38 @@ void MoleculeWatcher::bondChanged(const Bond *bond, ChangeType changeType)
     }
 }
 
+void MoleculeWatcher::atomsChanged(const std::vector<const Atom *> &atoms, ChangeType changeType)
+{
+    switch(changeType){
+        case AtomsRemoved:
+            atomsRemoved(atoms);
+
+            if(!atomRemoved.empty()){
+                foreach(const Atom *atom, atoms){
+                    atomRemoved(atom);
+                }
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+void MoleculeWatcher::bondsChanged(const std::vector<const Bond *> &bonds, ChangeType changeType)
+{
+    switch(changeType){
+        case BondsRemoved:
+            bondsRemoved(bonds);
+
+            if(!bondRemoved.empty()){
+                foreach(const Bond *bond, bonds){
+                    bondRemoved(bond);
+                }
+            }
+            break;
+        default:
+            break;
+    }
+}
+
 } // end chemkit namespace
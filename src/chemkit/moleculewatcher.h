@@ -38,6 +38,8 @@
 
 #include "chemkit.h"
 
+#include <vector>
+
 #ifndef Q_MOC_RUN
 #include <boost/signals2/signal.hpp>
 #endif
@@ -64,7 +66,9 @@ public:
         BondAdded,
         BondRemoved,
         BondOrderChanged,
-        NameChanged
+        NameChanged,
+        AtomsRemoved,
+        BondsRemoved
     };
 
     // construction and destruction
@@ -78,16 +82,20 @@ public:
     // signals
     boost::signals2::signal<void (const Atom *atom)> atomAdded;
     boost::signals2::signal<void (const Atom *atom)> atomRemoved;
+    boost::signals2::signal<void (const std::vector<const Atom *> &atoms)> atomsRemoved;
     boost::signals2::signal<void (const Atom *atom)> atomElementChanged;
     boost::signals2::signal<void (const Atom *atom)> atomPositionChanged;
     boost::signals2::signal<void (const Bond *bond)> bondAdded;
     boost::signals2::signal<void (const Bond *bond)> bondRemoved;
+    boost::signals2::signal<void (const std::vector<const Bond *> &bonds)> bondsRemoved;
     boost::signals2::signal<void (const Bond *bond)> bondOrderChanged;
     boost::signals2::signal<void (const Molecule *molecule)> nameChanged;
 
 private:
     void atomChanged(const Atom *atom, ChangeType changeType);
     void bondChanged(const Bond *bond, ChangeType changeType);
+    void atomsChanged(const std::vector<const Atom *> &atoms, ChangeType changeType);
+    void bondsChanged(const std::vector<const Bond *> &bonds, ChangeType changeType);
     void moleculeChanged(const Molecule *molecule, ChangeType changeType);
 
     friend class Molecule;
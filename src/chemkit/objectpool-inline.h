@@ -0,0 +1,186 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+#ifndef CHEMKIT_OBJECTPOOL_INLINE_H
+#define CHEMKIT_OBJECTPOOL_INLINE_H
+
+#include "objectpool.h"
+
+#include <cassert>
+#include <algorithm>
+
+namespace chemkit {
+
+// === ObjectPool ========================================================== //
+/// \class ObjectPool objectpool.h chemkit/objectpool.h
+/// \ingroup chemkit
+/// \internal
+/// \brief The ObjectPool class provides block-allocated storage for
+///        objects of type \c T.
+///
+/// Memory is handed out from large contiguous blocks which are only
+/// returned to the system when release() is called or the pool is
+/// destroyed. Objects allocated one after another are placed next to
+/// each other in memory. Slots returned with deallocate() are reused
+/// by subsequent allocations.
+///
+/// The pool only manages raw memory. Objects must be constructed
+/// with placement new and explicitly destroyed before their memory
+/// is deallocated or released.
+
+// --- Construction and Destruction ---------------------------------------- //
+/// Creates a new, empty object pool. The first block allocated will
+/// contain storage for \p blockSize objects.
+template<typename T>
+inline ObjectPool<T>::ObjectPool(size_t blockSize)
+    : m_block(0),
+      m_position(0),
+      m_blockSize(std::max(blockSize, size_t(1))),
+      m_size(0),
+      m_capacity(0),
+      m_freeList(0)
+{
+}
+
+/// Destroys the object pool and releases all of its memory.
+template<typename T>
+inline ObjectPool<T>::~ObjectPool()
+{
+    release();
+}
+
+// --- Properties ---------------------------------------------------------- //
+/// Returns the number of objects currently allocated from the pool.
+template<typename T>
+inline size_t ObjectPool<T>::size() const
+{
+    return m_size;
+}
+
+/// Returns the total number of objects the pool can store without
+/// allocating more memory.
+template<typename T>
+inline size_t ObjectPool<T>::capacity() const
+{
+    return m_capacity;
+}
+
+/// Ensures that the pool contains enough storage for \p capacity
+/// objects. The additional storage is allocated as a single
+/// contiguous block.
+template<typename T>
+inline void ObjectPool<T>::reserve(size_t capacity)
+{
+    if(capacity > m_capacity){
+        addBlock(capacity - m_capacity);
+    }
+}
+
+// --- Allocation ---------------------------------------------------------- //
+/// Returns a pointer to uninitialized storage for one object.
+template<typename T>
+inline void* ObjectPool<T>::allocate()
+{
+    m_size++;
+
+    // reuse a previously deallocated slot if possible
+    if(m_freeList){
+        Slot *slot = m_freeList;
+        m_freeList = slot->next;
+        return slot;
+    }
+
+    // move to the next block if the current one is full
+    while(m_block < m_blocks.size() && m_position == m_blocks[m_block].size){
+        m_block++;
+        m_position = 0;
+    }
+
+    if(m_block == m_blocks.size()){
+        addBlock(m_blockSize);
+
+        // grow the block size geometrically
+        m_blockSize *= 2;
+    }
+
+    return &m_blocks[m_block].slots[m_position++];
+}
+
+/// Returns the storage at \p pointer to the pool. The object stored
+/// there must have already been destroyed.
+template<typename T>
+inline void ObjectPool<T>::deallocate(void *pointer)
+{
+    assert(m_size > 0);
+
+    Slot *slot = static_cast<Slot *>(pointer);
+    slot->next = m_freeList;
+    m_freeList = slot;
+
+    m_size--;
+}
+
+/// Releases all of the memory held by the pool at once. Any objects
+/// still stored in the pool must have already been destroyed.
+template<typename T>
+inline void ObjectPool<T>::release()
+{
+    for(size_t i = 0; i < m_blocks.size(); i++){
+        delete [] m_blocks[i].slots;
+    }
+
+    m_blocks.clear();
+    m_block = 0;
+    m_position = 0;
+    m_size = 0;
+    m_capacity = 0;
+    m_freeList = 0;
+}
+
+// --- Internal Methods ---------------------------------------------------- //
+template<typename T>
+inline void ObjectPool<T>::addBlock(size_t size)
+{
+    Block block;
+    block.slots = new Slot[size];
+    block.size = size;
+    m_blocks.push_back(block);
+
+    m_capacity += size;
+}
+
+} // end chemkit namespace
+
+#endif // CHEMKIT_OBJECTPOOL_INLINE_H
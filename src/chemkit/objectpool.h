@@ -0,0 +1,97 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+#ifndef CHEMKIT_OBJECTPOOL_H
+#define CHEMKIT_OBJECTPOOL_H
+
+#include "chemkit.h"
+
+#include <vector>
+
+#ifndef Q_MOC_RUN
+#include <boost/type_traits/alignment_of.hpp>
+#include <boost/type_traits/aligned_storage.hpp>
+#endif
+
+namespace chemkit {
+
+template<typename T>
+class ObjectPool
+{
+public:
+    // construction and destruction
+    ObjectPool(size_t blockSize = 16);
+    ~ObjectPool();
+
+    // properties
+    size_t size() const;
+    size_t capacity() const;
+    void reserve(size_t capacity);
+
+    // allocation
+    void* allocate();
+    void deallocate(void *pointer);
+    void release();
+
+private:
+    CHEMKIT_DISABLE_COPY(ObjectPool)
+
+    union Slot {
+        Slot *next;
+        typename boost::aligned_storage<sizeof(T), boost::alignment_of<T>::value>::type storage;
+    };
+
+    struct Block {
+        Slot *slots;
+        size_t size;
+    };
+
+    void addBlock(size_t size);
+
+private:
+    std::vector<Block> m_blocks;
+    size_t m_block;
+    size_t m_position;
+    size_t m_blockSize;
+    size_t m_size;
+    size_t m_capacity;
+    Slot *m_freeList;
+};
+
+} // end chemkit namespace
+
+#include "objectpool-inline.h"
+
+#endif // CHEMKIT_OBJECTPOOL_H
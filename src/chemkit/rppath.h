@@ -38,21 +38,19 @@
 
 #include "chemkit.h"
 
-#include <set>
 #include <limits>
+#include <cassert>
 #include <algorithm>
 
-#ifndef Q_MOC_RUN
-#include <boost/bind.hpp>
-#endif
-
 #include <Eigen/Core>
 
 #include "atom.h"
 #include "graph.h"
+#include "bitset.h"
 #include "foreach.h"
 #include "fragment.h"
 #include "molecule.h"
+#include "moleculegraph.h"
 
 namespace chemkit {
 namespace algorithm {
@@ -180,37 +178,91 @@ private:
 };
 
 // === Sssr ================================================================ //
+// The Sssr class stores the rings found so far. Each ring is also
+// stored as a bitset of its vertices and a bitset of its edges so
+// that new rings can be checked against it with bitwise operations.
 template<typename T>
 class Sssr
 {
 public:
+    // construction and destruction
+    Sssr(const Graph<T> &graph);
+
     // properties
     size_t size() const { return m_rings.size(); }
     bool isEmpty() const { return m_rings.empty(); }
 
     // rings
     const std::vector<std::vector<T> >& rings() const { return m_rings; }
-    void append(const std::vector<T> &ring) { m_rings.push_back(ring); }
+    void append(const std::vector<T> &ring);
 
     // ring checks
     bool isValid(const std::vector<T> &ring) const;
     bool isUnique(const std::vector<T> &ring) const;
 
 private:
+    Bitset vertexSet(const std::vector<T> &ring) const;
+    Bitset edgeSet(const std::vector<T> &ring) const;
+    T edgeIndex(T a, T b) const;
+
+private:
+    const Graph<T> &m_graph;
+    T m_edgeCount;
+    std::vector<std::vector<T> > m_edgeIndices;
     std::vector<std::vector<T> > m_rings;
+    std::vector<Bitset> m_ringVertices;
+    std::vector<Bitset> m_ringEdges;
 };
 
+// --- Construction and Destruction ---------------------------------------- //
+template<typename T>
+inline Sssr<T>::Sssr(const Graph<T> &graph)
+    : m_graph(graph),
+      m_edgeCount(0)
+{
+    // number each edge, m_edgeIndices[i][k] is the index of the edge
+    // between vertex i and its k'th neighbor
+    m_edgeIndices.resize(graph.size());
+
+    for(T i = 0; i < graph.size(); i++){
+        const std::vector<T> &neighbors = graph.neighbors(i);
+        m_edgeIndices[i].resize(neighbors.size());
+
+        for(size_t k = 0; k < neighbors.size(); k++){
+            T j = neighbors[k];
+
+            if(j > i){
+                m_edgeIndices[i][k] = m_edgeCount++;
+            }
+            else{
+                m_edgeIndices[i][k] = edgeIndex(j, i);
+            }
+        }
+    }
+}
+
+// --- Rings --------------------------------------------------------------- //
+template<typename T>
+inline void Sssr<T>::append(const std::vector<T> &ring)
+{
+    m_rings.push_back(ring);
+    m_ringVertices.push_back(vertexSet(ring));
+    m_ringEdges.push_back(edgeSet(ring));
+}
+
 // --- Ring Checks --------------------------------------------------------- //
 template<typename T>
 inline bool Sssr<T>::isValid(const std::vector<T> &ring) const
 {
     // check for any duplicate vertices
-    for(T i = 0; i < ring.size(); i++){
-        for(T j = i + 1; j < ring.size(); j++){
-            if(ring[i] == ring[j]){
-                return false;
-            }
+    Bitset vertices(m_graph.size());
+
+    foreach(T vertex, ring){
+        if(vertices.test(vertex)){
+            return false;
         }
+
+        vertices.set(vertex);
     }
 
     return true;
@@ -225,77 +277,71 @@ inline bool Sssr<T>::isUnique(const std::vector<T> &path) const
     }
 
     // check if a ring with the same atoms is already in the sssr
-    std::set<T> pathSet;
-    pathSet.insert(path.begin(), path.end());
-
-    foreach(const std::vector<T> &ring, m_rings){
-        std::set<T> ringSet;
-        ringSet.insert(ring.begin(), ring.end());
-
-        std::vector<T> sortedRing(ring.begin(), ring.end());
-        std::sort(sortedRing.begin(), sortedRing.end());
+    Bitset pathVertices = vertexSet(path);
 
-        std::set<T> intersection;
-        std::set_intersection(pathSet.begin(), pathSet.end(),
-                              ringSet.begin(), ringSet.end(),
-                              std::inserter(intersection, intersection.begin()));
-
-        if(intersection.size() == ring.size()){
+    foreach(const Bitset &ringVertices, m_ringVertices){
+        if(ringVertices.is_subset_of(pathVertices)){
             return false;
         }
     }
 
-    // build set of bonds in the path
-    std::set<std::pair<T, T> > pathBonds;
-    for(T i = 0; i < path.size() - 1; i++){
-        pathBonds.insert(std::make_pair(std::min(path[i], path[i+1]),
-                                        std::max(path[i], path[i+1])));
-    }
-
-    pathBonds.insert(std::make_pair(std::min(path.front(), path.back()),
-                                    std::max(path.front(), path.back())));
-
     // remove bonds from path bonds that are already in a smaller ring
-    foreach(const std::vector<T> &ring, m_rings){
-        if(ring.size() >= path.size()){
-            continue;
+    Bitset pathEdges = edgeSet(path);
+
+    for(size_t i = 0; i < m_rings.size(); i++){
+        if(m_rings[i].size() < path.size()){
+            pathEdges -= m_ringEdges[i];
         }
+    }
 
-        for(T i = 0; i < ring.size() - 1; i++){
-            pathBonds.erase(std::make_pair(std::min(ring[i], ring[i+1]),
-                                           std::max(ring[i], ring[i+1])));
+    // check if any other ring contains the same bonds
+    foreach(const Bitset &ringEdges, m_ringEdges){
+        if(pathEdges.is_subset_of(ringEdges)){
+            return false;
         }
+    }
+
+    return true;
+}
 
-        pathBonds.erase(std::make_pair(std::min(ring.front(), ring.back()),
-                                       std::max(ring.front(), ring.back())));
+// --- Internal Methods ---------------------------------------------------- //
+template<typename T>
+inline Bitset Sssr<T>::vertexSet(const std::vector<T> &ring) const
+{
+    Bitset vertices(m_graph.size());
+
+    foreach(T vertex, ring){
+        vertices.set(vertex);
     }
 
-    // check if any other ring contains the same bonds
-    foreach(const std::vector<T> &ring, m_rings){
-        std::set<std::pair<T, T> > ringBonds;
+    return vertices;
+}
 
-        // add ring bonds
-        for(T i = 0; i < ring.size() - 1; i++){
-            ringBonds.insert(std::make_pair(std::min(ring[i], ring[i+1]),
-                                            std::max(ring[i], ring[i+1])));
-        }
+template<typename T>
+inline Bitset Sssr<T>::edgeSet(const std::vector<T> &ring) const
+{
+    Bitset edges(m_edgeCount);
 
-        // add closure bond
-        ringBonds.insert(std::make_pair(std::min(ring.front(), ring.back()),
-                                        std::max(ring.front(), ring.back())));
+    for(size_t i = 0; i < ring.size(); i++){
+        edges.set(edgeIndex(ring[i], ring[(i + 1) % ring.size()]));
+    }
 
-        // check intersection
-        std::set<std::pair<T, T> > intersection;
-        std::set_intersection(pathBonds.begin(), pathBonds.end(),
-                              ringBonds.begin(), ringBonds.end(),
-                              std::inserter(intersection, intersection.begin()));
+    return edges;
+}
 
-        if(intersection.size() == pathBonds.size()){
-            return false;
+template<typename T>
+inline T Sssr<T>::edgeIndex(T a, T b) const
+{
+    const std::vector<T> &neighbors = m_graph.neighbors(a);
+
+    for(size_t k = 0; k < neighbors.size(); k++){
+        if(neighbors[k] == b){
+            return m_edgeIndices[a][k];
         }
     }
 
-    return true;
+    assert(false);
+    return 0;
 }
 
 } // end detail namespace
@@ -394,7 +440,7 @@ inline std::vector<std::vector<T> > rppath(const Graph<T> &graph)
     std::sort(candidates.begin(), candidates.end(), RingCandidate<T>::compareSize);
 
     // algorithm 3 - find sssr from the ring candidate set
-    Sssr<T> sssr;
+    Sssr<T> sssr(graph);
 
     foreach(const RingCandidate<T> &candidate, candidates){
         // odd sized ring
@@ -446,20 +492,44 @@ inline std::vector<std::vector<T> > rppath(const Graph<T> &graph)
 
 inline std::vector<std::vector<Atom *> > rppath(const Fragment *fragment)
 {
-    std::vector<Atom *> atoms = fragment->atoms();
+    const Molecule *molecule = fragment->molecule();
+    const MoleculeGraph *moleculeGraph = molecule->graph();
+
+    // find all non-terminal atoms
+    std::vector<Atom *> atoms;
+    foreach(Atom *atom, fragment->atoms()){
+        if(moleculeGraph->degree(atom->index()) != 1){
+            atoms.push_back(atom);
+        }
+    }
 
-    // remove any terminal atoms
-    atoms.erase(std::remove_if(atoms.begin(), atoms.end(), boost::bind(&Atom::isTerminal, _1)), atoms.end());
+    // map from atom index to vertex index
+    std::vector<size_t> vertices(molecule->atomCount(), MoleculeGraph::npos);
+    for(size_t i = 0; i < atoms.size(); i++){
+        vertices[atoms[i]->index()] = i;
+    }
 
     // create graph
     Graph<size_t> graph(atoms.size());
 
+    std::vector<size_t> neighbors;
     for(size_t i = 0; i < atoms.size(); i++){
-        for(size_t j = i + 1; j < atoms.size(); j++){
-            if(atoms[i]->isBondedTo(atoms[j])){
-                graph.addEdge(i, j);
+        neighbors.clear();
+
+        foreach(size_t neighbor, moleculeGraph->neighbors(atoms[i]->index())){
+            size_t j = vertices[neighbor];
+
+            if(j != MoleculeGraph::npos && j > i){
+                neighbors.push_back(j);
             }
         }
+
+        // add edges in order of increasing vertex index
+        std::sort(neighbors.begin(), neighbors.end());
+
+        foreach(size_t j, neighbors){
+            graph.addEdge(i, j);
+        }
     }
 
     // cyclize graph
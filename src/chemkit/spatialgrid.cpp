@@ -0,0 +1,350 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+#include "spatialgrid.h"
+
+#include <cmath>
+#include <algorithm>
+
+#ifndef Q_MOC_RUN
+#include <boost/array.hpp>
+#endif
+
+namespace chemkit {
+
+namespace {
+
+const size_t npos = static_cast<size_t>(-1);
+
+} // end anonymous namespace
+
+// === SpatialGridPrivate ================================================== //
+class SpatialGridPrivate
+{
+public:
+    Real cellSize;
+    Real gridCellSize;
+    Point3 origin;
+    boost::array<size_t, 3> dimensions;
+    std::vector<Point3> positions;
+    std::vector<size_t> cells;
+    std::vector<size_t> head;
+    std::vector<size_t> next;
+    std::vector<size_t> previous;
+};
+
+// === SpatialGrid ========================================================= //
+/// \class SpatialGrid spatialgrid.h chemkit/spatialgrid.h
+/// \ingroup chemkit
+/// \brief The SpatialGrid class finds points near a position.
+///
+/// The spatial grid divides the bounding box of a set of points into
+/// cubic cells and stores the points in each cell. Finding the points
+/// within a distance of a position only checks the points in the
+/// nearby cells instead of every point. This makes finding all of
+/// the close pairs in a set of points take linear time.
+///
+/// The following example finds every atom within 3 Angstroms of the
+/// first atom in a molecule:
+/// \code
+/// std::vector<Point3> positions;
+/// foreach(const Atom *atom, molecule->atoms()){
+///     positions.push_back(atom->position());
+/// }
+///
+/// SpatialGrid grid(positions, 3.0);
+/// std::vector<size_t> neighbors = grid.neighbors(0, 3.0);
+/// \endcode
+///
+/// Points can be moved with setPosition() without rebuilding the
+/// grid. Points moved outside of the original bounding box are placed
+/// in the cells at its edges. Queries are still correct for these
+/// points, but become slower if many points move far away. Calling
+/// setPositions() rebuilds the grid for the new bounding box.
+///
+/// The cell size should be close to the distances that will be
+/// queried. For sparse sets of points the cell size used may be
+/// larger than cellSize() to limit the number of empty cells.
+
+// --- Construction and Destruction ---------------------------------------- //
+/// Creates a new, empty spatial grid with \p cellSize.
+SpatialGrid::SpatialGrid(Real cellSize)
+    : d(new SpatialGridPrivate)
+{
+    d->cellSize = cellSize;
+    build();
+}
+
+/// Creates a new spatial grid containing \p positions with
+/// \p cellSize.
+SpatialGrid::SpatialGrid(const std::vector<Point3> &positions, Real cellSize)
+    : d(new SpatialGridPrivate)
+{
+    d->cellSize = cellSize;
+    d->positions = positions;
+    build();
+}
+
+/// Destroys the spatial grid.
+SpatialGrid::~SpatialGrid()
+{
+    delete d;
+}
+
+// --- Properties ---------------------------------------------------------- //
+/// Sets the size of each cell to \p cellSize and rebuilds the grid.
+void SpatialGrid::setCellSize(Real cellSize)
+{
+    d->cellSize = cellSize;
+    build();
+}
+
+/// Returns the size of each cell.
+Real SpatialGrid::cellSize() const
+{
+    return d->cellSize;
+}
+
+/// Returns the number of points in the grid.
+size_t SpatialGrid::size() const
+{
+    return d->positions.size();
+}
+
+/// Returns \c true if the grid contains no points.
+bool SpatialGrid::isEmpty() const
+{
+    return d->positions.empty();
+}
+
+// --- Positions ----------------------------------------------------------- //
+/// Sets the points in the grid to \p positions and rebuilds the grid.
+void SpatialGrid::setPositions(const std::vector<Point3> &positions)
+{
+    d->positions = positions;
+    build();
+}
+
+/// Moves the point at \p index to \p position.
+void SpatialGrid::setPosition(size_t index, const Point3 &position)
+{
+    d->positions[index] = position;
+
+    size_t cell = cellIndex(position);
+    if(cell != d->cells[index]){
+        removeFromCell(index);
+        insertIntoCell(index, cell);
+    }
+}
+
+/// Returns the position of the point at \p index.
+Point3 SpatialGrid::position(size_t index) const
+{
+    return d->positions[index];
+}
+
+/// Removes all of the points from the grid.
+void SpatialGrid::clear()
+{
+    d->positions.clear();
+    build();
+}
+
+// --- Queries ------------------------------------------------------------- //
+/// Returns the indices of the points within \p distance of \p point.
+/// The indices are sorted in increasing order.
+std::vector<size_t> SpatialGrid::neighbors(const Point3 &point, Real distance) const
+{
+    std::vector<size_t> neighbors;
+    appendNeighbors(point, distance, npos, neighbors);
+    std::sort(neighbors.begin(), neighbors.end());
+
+    return neighbors;
+}
+
+/// Returns the indices of the points within \p distance of the point
+/// at \p index. The point itself is not included. The indices are
+/// sorted in increasing order.
+std::vector<size_t> SpatialGrid::neighbors(size_t index, Real distance) const
+{
+    std::vector<size_t> neighbors;
+    appendNeighbors(d->positions[index], distance, index, neighbors);
+    std::sort(neighbors.begin(), neighbors.end());
+
+    return neighbors;
+}
+
+// --- Internal Methods ---------------------------------------------------- //
+void SpatialGrid::build()
+{
+    const size_t size = d->positions.size();
+
+    d->gridCellSize = d->cellSize > 0 ? d->cellSize : 1.0;
+    d->origin = Point3(0, 0, 0);
+    d->dimensions.assign(1);
+
+    if(size > 0){
+        // find bounding box
+        Point3 min = d->positions[0];
+        Point3 max = min;
+        for(size_t i = 1; i < size; i++){
+            for(int k = 0; k < 3; k++){
+                min[k] = std::min(min[k], d->positions[i][k]);
+                max[k] = std::max(max[k], d->positions[i][k]);
+            }
+        }
+        d->origin = min;
+
+        // the cell size is increased for sparse systems to limit the
+        // number of empty cells
+        for(;;){
+            Real cellCount = 1;
+            for(int k = 0; k < 3; k++){
+                d->dimensions[k] = static_cast<size_t>((max[k] - min[k]) / d->gridCellSize) + 1;
+                cellCount *= d->dimensions[k];
+            }
+
+            if(cellCount <= 8 * size + 27){
+                break;
+            }
+
+            d->gridCellSize *= 2;
+        }
+    }
+
+    // place each point in a cell. inserting the points in reverse
+    // order leaves each cell's list in increasing order
+    d->head.assign(d->dimensions[0] * d->dimensions[1] * d->dimensions[2], npos);
+    d->next.assign(size, npos);
+    d->previous.assign(size, npos);
+    d->cells.resize(size);
+
+    for(size_t i = size; i > 0; i--){
+        insertIntoCell(i - 1, cellIndex(d->positions[i - 1]));
+    }
+}
+
+// Returns the index of the cell containing position. Positions
+// outside of the grid are placed in the nearest cell.
+size_t SpatialGrid::cellIndex(const Point3 &position) const
+{
+    boost::array<size_t, 3> cell;
+
+    for(int k = 0; k < 3; k++){
+        Real offset = (position[k] - d->origin[k]) / d->gridCellSize;
+
+        if(offset > 0){
+            cell[k] = static_cast<size_t>(std::min(offset, static_cast<Real>(d->dimensions[k] - 1)));
+        }
+        else{
+            cell[k] = 0;
+        }
+    }
+
+    return (cell[2] * d->dimensions[1] + cell[1]) * d->dimensions[0] + cell[0];
+}
+
+void SpatialGrid::insertIntoCell(size_t index, size_t cell)
+{
+    size_t first = d->head[cell];
+
+    d->cells[index] = cell;
+    d->previous[index] = npos;
+    d->next[index] = first;
+    if(first != npos){
+        d->previous[first] = index;
+    }
+    d->head[cell] = index;
+}
+
+void SpatialGrid::removeFromCell(size_t index)
+{
+    size_t previous = d->previous[index];
+    size_t next = d->next[index];
+
+    if(previous != npos){
+        d->next[previous] = next;
+    }
+    else{
+        d->head[d->cells[index]] = next;
+    }
+
+    if(next != npos){
+        d->previous[next] = previous;
+    }
+}
+
+// Appends the index of each point within distance of point other than
+// exclude to neighbors.
+void SpatialGrid::appendNeighbors(const Point3 &point, Real distance, size_t exclude, std::vector<size_t> &neighbors) const
+{
+    if(d->positions.empty() || distance < 0){
+        return;
+    }
+
+    const Real distanceSquared = distance * distance;
+    const size_t range = static_cast<size_t>(std::ceil(distance / d->gridCellSize));
+
+    // find the range of cells to search in each direction
+    boost::array<size_t, 3> lower;
+    boost::array<size_t, 3> upper;
+    for(int k = 0; k < 3; k++){
+        Real offset = (point[k] - d->origin[k]) / d->gridCellSize;
+        size_t cell = 0;
+
+        if(offset > 0){
+            cell = static_cast<size_t>(std::min(offset, static_cast<Real>(d->dimensions[k] - 1)));
+        }
+
+        lower[k] = cell > range ? cell - range : 0;
+        upper[k] = std::min(cell + range, d->dimensions[k] - 1);
+    }
+
+    for(size_t z = lower[2]; z <= upper[2]; z++){
+        for(size_t y = lower[1]; y <= upper[1]; y++){
+            for(size_t x = lower[0]; x <= upper[0]; x++){
+                size_t cell = (z * d->dimensions[1] + y) * d->dimensions[0] + x;
+
+                for(size_t i = d->head[cell]; i != npos; i = d->next[i]){
+                    if(i != exclude && (d->positions[i] - point).squaredNorm() <= distanceSquared){
+                        neighbors.push_back(i);
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // end chemkit namespace
@@ -35,6 +35,8 @@
 
 #include "substructurequery.h"
 
+#include <boost/atomic.hpp>
+#include <boost/scoped_ptr.hpp>
 #include <boost/make_shared.hpp>
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/mcgregor_common_subgraphs.hpp>
@@ -45,6 +47,7 @@
 #include "ring.h"
 #include "foreach.h"
 #include "molecule.h"
+#include "moleculegraph.h"
 
 namespace chemkit {
 
@@ -75,29 +78,40 @@ struct AtomComparator
 
 struct BondComparator
 {
-    BondComparator(const std::vector<Atom *> &sourceAtoms, const std::vector<Atom *> &targetAtoms, int flags)
-        : m_sourceAtoms(sourceAtoms),
-          m_targetAtoms(targetAtoms),
+    BondComparator(const Molecule *sourceMolecule,
+                   const MoleculeGraph &sourceGraph,
+                   const Molecule *targetMolecule,
+                   const MoleculeGraph &targetGraph,
+                   int flags)
+        : m_sourceMolecule(sourceMolecule),
+          m_sourceGraph(sourceGraph),
+          m_targetMolecule(targetMolecule),
+          m_targetGraph(targetGraph),
           m_flags(flags)
     {
     }
 
     BondComparator(const BondComparator &other)
-        : m_sourceAtoms(other.m_sourceAtoms),
-          m_targetAtoms(other.m_targetAtoms),
+        : m_sourceMolecule(other.m_sourceMolecule),
+          m_sourceGraph(other.m_sourceGraph),
+          m_targetMolecule(other.m_targetMolecule),
+          m_targetGraph(other.m_targetGraph),
           m_flags(other.m_flags)
     {
     }
 
     bool operator()(size_t a1, size_t a2, size_t b1, size_t b2) const
     {
-        const Bond *bondA = m_sourceAtoms[a1]->bondTo(m_sourceAtoms[a2]);
-        const Bond *bondB = m_targetAtoms[b1]->bondTo(m_targetAtoms[b2]);
+        size_t bondIndexA = m_sourceGraph.bondBetween(a1, a2);
+        size_t bondIndexB = m_targetGraph.bondBetween(b1, b2);
 
-        if(!bondA || !bondB){
+        if(bondIndexA == MoleculeGraph::npos || bondIndexB == MoleculeGraph::npos){
             return false;
         }
 
+        const Bond *bondA = m_sourceMolecule->bond(bondIndexA);
+        const Bond *bondB = m_targetMolecule->bond(bondIndexB);
+
         if(m_flags & SubstructureQuery::CompareAromaticity){
             return (bondA->order() == bondB->order()) ||
                    (bondA->isAromatic() && bondB->isAromatic());
@@ -107,8 +121,10 @@ struct BondComparator
         }
     }
 
-    const std::vector<Atom *> &m_sourceAtoms;
-    const std::vector<Atom *> &m_targetAtoms;
+    const Molecule *m_sourceMolecule;
+    const MoleculeGraph &m_sourceGraph;
+    const Molecule *m_targetMolecule;
+    const MoleculeGraph &m_targetGraph;
     int m_flags;
 };
 
@@ -241,6 +257,59 @@ struct McgregorCommonSubgraphsCallback
     std::map<size_t, size_t> &m_mapping;
 };
 
+// Size of the screening fingerprint in bits.
+const size_t ScreeningFingerprintSize = 1021;
+
+// Maximum number of atoms in a path added to the screening fingerprint.
+const size_t MaxScreeningPathLength = 7;
+
+// Sets the bit for the path of atomic numbers in fingerprint. A path
+// and its reverse set the same bit.
+void addScreeningPath(const std::vector<size_t> &path, Bitset &fingerprint)
+{
+    bool reverse = std::lexicographical_compare(path.rbegin(), path.rend(),
+                                                path.begin(), path.end());
+
+    size_t hash = 0;
+    if(reverse){
+        for(std::vector<size_t>::const_reverse_iterator i = path.rbegin(); i != path.rend(); ++i){
+            hash = (hash * 257 + *i) % ScreeningFingerprintSize;
+        }
+    }
+    else{
+        for(std::vector<size_t>::const_iterator i = path.begin(); i != path.end(); ++i){
+            hash = (hash * 257 + *i) % ScreeningFingerprintSize;
+        }
+    }
+
+    fingerprint.set(hash);
+}
+
+// Adds every simple path starting at vertex to fingerprint.
+void addScreeningPaths(const MoleculeGraph &graph,
+                       const std::vector<size_t> &atomicNumbers,
+                       size_t vertex,
+                       std::vector<size_t> &path,
+                       std::vector<bool> &visited,
+                       Bitset &fingerprint)
+{
+    path.push_back(atomicNumbers[vertex]);
+    visited[vertex] = true;
+
+    addScreeningPath(path, fingerprint);
+
+    if(path.size() < MaxScreeningPathLength){
+        foreach(size_t neighbor, graph.neighbors(vertex)){
+            if(!visited[neighbor]){
+                addScreeningPaths(graph, atomicNumbers, neighbor, path, visited, fingerprint);
+            }
+        }
+    }
+
+    visited[vertex] = false;
+    path.pop_back();
+}
+
 } // end anonymous namespace
 
 // === SubstructureQueryPrivate ============================================ //
@@ -249,12 +318,35 @@ class SubstructureQueryPrivate
 public:
     boost::shared_ptr<Molecule> molecule;
     int flags;
+
+    // compiled query
+    std::vector<Atom *> atoms;
+    boost::scoped_ptr<MoleculeGraph> graph;
+
+    // screening
+    bool screeningEnabled;
+    Bitset fingerprint;
+    boost::atomic<size_t> screenedCount;
+    boost::atomic<size_t> screenedOutCount;
 };
 
 // === SubstructureQuery =================================================== //
 /// \class SubstructureQuery substructurequery.h chemkit/substructurequery.h
 /// \ingroup chemkit
 /// \brief The SubstructureQuery class represents a substructure query.
+///
+/// The query molecule is compiled when it or the flags are set. The
+/// query methods do not modify the query and may be called from
+/// multiple threads at once, provided each thread searches different
+/// molecules. If the query molecule is modified after being set,
+/// setMolecule() must be called again.
+///
+/// When screening is enabled with setScreeningEnabled() each target
+/// molecule's screening fingerprint is first compared with the
+/// query's, and the full isomorphism search is skipped if the target
+/// is missing any of the query's bits. Callers searching the same
+/// molecules with several queries can compute the fingerprints once
+/// with screeningFingerprint() and pass them to matches().
 
 // --- Construction and Destruction ---------------------------------------- //
 /// Creates a new substructure query.
@@ -262,6 +354,9 @@ SubstructureQuery::SubstructureQuery()
   : d(new SubstructureQueryPrivate)
 {
     d->flags = 0;
+    d->screeningEnabled = false;
+    d->screenedCount = 0;
+    d->screenedOutCount = 0;
 }
 
 /// Creates a new substructure query with \p molecule as the
@@ -271,6 +366,10 @@ SubstructureQuery::SubstructureQuery(const boost::shared_ptr<Molecule> &molecule
 {
     d->molecule = molecule;
     d->flags = 0;
+    d->screeningEnabled = false;
+    d->screenedCount = 0;
+    d->screenedOutCount = 0;
+    compile();
 }
 
 /// Creates a new substructure query with \p formula in \p format as
@@ -280,6 +379,10 @@ SubstructureQuery::SubstructureQuery(const std::string &formula, const std::stri
 {
     d->molecule = boost::make_shared<Molecule>(formula, format);
     d->flags = 0;
+    d->screeningEnabled = false;
+    d->screenedCount = 0;
+    d->screenedOutCount = 0;
+    compile();
 }
 
 /// Destroys the substructure query object.
@@ -293,6 +396,7 @@ SubstructureQuery::~SubstructureQuery()
 void SubstructureQuery::setMolecule(const boost::shared_ptr<Molecule> &molecule)
 {
     d->molecule = molecule;
+    compile();
 }
 
 /// Sets the substructure molecule to \p formula with \p format.
@@ -311,6 +415,7 @@ boost::shared_ptr<Molecule> SubstructureQuery::molecule() const
 void SubstructureQuery::setFlags(int flags)
 {
     d->flags = flags;
+    compile();
 }
 
 /// Returns the query flags.
@@ -346,6 +451,37 @@ bool SubstructureQuery::matches(const Molecule *molecule) const
         return true;
     }
 
+    if(d->screeningEnabled){
+        return matches(molecule, screeningFingerprint(molecule));
+    }
+
+    return !mapping(molecule).empty();
+}
+
+/// Returns \c true if the substructure molecule matches \p molecule.
+/// The screening fingerprint for \p molecule, as returned from
+/// screeningFingerprint(), is passed in \p fingerprint.
+///
+/// If the bits set in the query's fingerprint are not a subset of
+/// those in \p fingerprint the molecule cannot contain the query and
+/// \c false is returned without performing the isomorphism search.
+bool SubstructureQuery::matches(const Molecule *molecule, const Bitset &fingerprint) const
+{
+    if(!d->molecule){
+        return false;
+    }
+
+    if(d->molecule->isEmpty()){
+        return true;
+    }
+
+    d->screenedCount++;
+
+    if(fingerprint.size() != d->fingerprint.size() || !d->fingerprint.is_subset_of(fingerprint)){
+        d->screenedOutCount++;
+        return false;
+    }
+
     return !mapping(molecule).empty();
 }
 
@@ -353,77 +489,45 @@ bool SubstructureQuery::matches(const Molecule *molecule) const
 /// atoms in the substructure molecule and the atoms in \p molecule.
 std::map<Atom *, Atom *> SubstructureQuery::mapping(const Molecule *molecule) const
 {
-    Graph<size_t> source;
-    Graph<size_t> target;
+    if(!d->molecule){
+        return std::map<Atom *, Atom *>();
+    }
 
-    std::vector<Atom *> sourceAtoms;
+    const std::vector<Atom *> &sourceAtoms = d->atoms;
     std::vector<Atom *> targetAtoms;
 
-    if(d->flags & CompareHydrogens){
-        source.resize(d->molecule->size());
-        sourceAtoms = std::vector<Atom *>(d->molecule->atoms().begin(), d->molecule->atoms().end());
-
-        if(!(d->flags & CompareAtomsOnly)){
-            foreach(const Bond *bond, d->molecule->bonds()){
-                source.addEdge(bond->atom1()->index(), bond->atom2()->index());
-            }
-        }
+    // graph for the target atoms being compared. when hydrogens are
+    // compared the molecule's own graph is used directly.
+    boost::scoped_ptr<MoleculeGraph> targetSubgraph;
+    const MoleculeGraph *source = d->graph.get();
+    const MoleculeGraph *target = 0;
 
-        target.resize(molecule->size());
+    if(d->flags & CompareHydrogens){
         targetAtoms = std::vector<Atom *>(molecule->atoms().begin(), molecule->atoms().end());
-
-        if(!(d->flags & CompareAtomsOnly)){
-            foreach(const Bond *bond, molecule->bonds()){
-                target.addEdge(bond->atom1()->index(), bond->atom2()->index());
-            }
-        }
+        target = molecule->graph();
     }
     else{
-        foreach(Atom *atom, d->molecule->atoms()){
-            if(!atom->isTerminalHydrogen()){
-                sourceAtoms.push_back(atom);
-            }
-        }
-
         foreach(Atom *atom, molecule->atoms()){
             if(!atom->isTerminalHydrogen()){
                 targetAtoms.push_back(atom);
             }
         }
 
-        source.resize(sourceAtoms.size());
-        target.resize(targetAtoms.size());
-
-        if(!(d->flags & CompareAtomsOnly)){
-            for(size_t i = 0; i < sourceAtoms.size(); i++){
-                for(size_t j = i + 1; j < sourceAtoms.size(); j++){
-                    if(sourceAtoms[i]->isBondedTo(sourceAtoms[j])){
-                        source.addEdge(i, j);
-                    }
-                }
-            }
-
-            for(size_t i = 0; i < targetAtoms.size(); i++){
-                for(size_t j = i + 1; j < targetAtoms.size(); j++){
-                    if(targetAtoms[i]->isBondedTo(targetAtoms[j])){
-                        target.addEdge(i, j);
-                    }
-                }
-            }
-        }
+        targetSubgraph.reset(new MoleculeGraph(targetAtoms));
+        target = targetSubgraph.get();
     }
 
     AtomComparator atomComparator(sourceAtoms, targetAtoms);
-    BondComparator bondComparator(sourceAtoms, targetAtoms, d->flags);
+    BondComparator bondComparator(d->molecule.get(), *source, molecule, *target, d->flags);
 
     // run vf2 isomorphism algorithm
-    std::map<size_t, size_t> mapping = chemkit::algorithm::vf2(source,
-                                                               target,
+    std::map<size_t, size_t> mapping = chemkit::algorithm::vf2(*source,
+                                                               *target,
                                                                atomComparator,
                                                                bondComparator);
 
     // check for exact match
-    if(d->flags & CompareExact && mapping.size() != source.size()){
+    if(d->flags & CompareExact && mapping.size() != source->size()){
         return std::map<Atom *, Atom *>();
     }
 
@@ -585,4 +689,114 @@ Moiety SubstructureQuery::find(const Molecule *molecule) const
     return Moiety(atoms);
 }
 
+// --- Screening ---------------------------------------------------------- //
+/// Sets whether matches() screens molecules with their fingerprint
+/// before performing the isomorphism search. Screening is disabled
+/// by default.
+void SubstructureQuery::setScreeningEnabled(bool enabled)
+{
+    d->screeningEnabled = enabled;
+}
+
+/// Returns \c true if screening is enabled.
+bool SubstructureQuery::isScreeningEnabled() const
+{
+    return d->screeningEnabled;
+}
+
+/// Returns the number of molecules which have been screened.
+size_t SubstructureQuery::screenedCount() const
+{
+    return d->screenedCount;
+}
+
+/// Returns the number of molecules which were rejected by the screen
+/// without performing the isomorphism search.
+///
+/// The screen-out rate is given by:
+/// \code
+/// Real rate = Real(query.screenedOutCount()) / query.screenedCount();
+/// \endcode
+size_t SubstructureQuery::screenedOutCount() const
+{
+    return d->screenedOutCount;
+}
+
+/// Resets the screened and screened out counts to zero.
+void SubstructureQuery::resetScreeningStatistics()
+{
+    d->screenedCount = 0;
+    d->screenedOutCount = 0;
+}
+
+// --- Static Methods ------------------------------------------------------ //
+/// Returns the screening fingerprint for \p molecule.
+///
+/// Each bit represents the sequence of elements along one or more
+/// paths of up to seven atoms, ignoring terminal hydrogens. Bond
+/// orders and aromaticity are not encoded so every path in a
+/// substructure is also present in a molecule which contains it,
+/// regardless of the query's flags.
+Bitset SubstructureQuery::screeningFingerprint(const Molecule *molecule)
+{
+    Bitset fingerprint(ScreeningFingerprintSize);
+
+    const MoleculeGraph *graph = molecule->graph();
+
+    // terminal hydrogens are never part of a path
+    std::vector<bool> visited(molecule->size());
+    std::vector<size_t> atomicNumbers(molecule->size());
+    foreach(const Atom *atom, molecule->atoms()){
+        visited[atom->index()] = atom->isTerminalHydrogen();
+        atomicNumbers[atom->index()] = atom->atomicNumber();
+    }
+
+    std::vector<size_t> path;
+    path.reserve(MaxScreeningPathLength);
+
+    for(size_t i = 0; i < molecule->size(); i++){
+        if(!visited[i]){
+            addScreeningPaths(*graph, atomicNumbers, i, path, visited, fingerprint);
+        }
+    }
+
+    return fingerprint;
+}
+
+// --- Internal Methods ---------------------------------------------------- //
+// Builds the atom list and graph for the query molecule and runs any
+// lazy perception it needs so that the query methods only read from
+// the query molecule.
+void SubstructureQuery::compile()
+{
+    d->atoms.clear();
+    d->graph.reset();
+    d->fingerprint.clear();
+
+    if(!d->molecule){
+        return;
+    }
+
+    d->fingerprint = screeningFingerprint(d->molecule.get());
+
+    if(d->flags & CompareHydrogens){
+        d->atoms.assign(d->molecule->atoms().begin(), d->molecule->atoms().end());
+        d->graph.reset(new MoleculeGraph(*d->molecule->graph()));
+    }
+    else{
+        foreach(Atom *atom, d->molecule->atoms()){
+            if(!atom->isTerminalHydrogen()){
+                d->atoms.push_back(atom);
+            }
+        }
+
+        d->graph.reset(new MoleculeGraph(d->atoms));
+    }
+
+    // perceive rings for aromaticity comparisons
+    if(d->flags & CompareAromaticity){
+        d->molecule->rings();
+    }
+}
+
 } // end chemkit namespace
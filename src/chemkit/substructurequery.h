@@ -45,6 +45,7 @@
 #include <boost/shared_ptr.hpp>
 #endif
 
+#include "bitset.h"
 #include "moiety.h"
 
 namespace chemkit {
@@ -79,11 +80,25 @@ public:
 
     // queries
     bool matches(const Molecule *molecule) const;
+    bool matches(const Molecule *molecule, const Bitset &fingerprint) const;
     std::map<Atom *, Atom *> mapping(const Molecule *molecule) const;
     std::map<Atom *, Atom *> maximumMapping(const Molecule *molecule) const;
     std::vector<Molecule *> filter(const std::vector<Molecule *> &molecules) const;
     Moiety find(const Molecule *molecule) const;
 
+    // screening
+    void setScreeningEnabled(bool enabled);
+    bool isScreeningEnabled() const;
+    size_t screenedCount() const;
+    size_t screenedOutCount() const;
+    void resetScreeningStatistics();
+
+    // static methods
+    static Bitset screeningFingerprint(const Molecule *molecule);
+
+private:
+    void compile();
+
 private:
     SubstructureQueryPrivate* const d;
 };
@@ -0,0 +1,95 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+#ifndef CHEMKIT_THREADPOOL_INLINE_H
+#define CHEMKIT_THREADPOOL_INLINE_H
+
+#include "threadpool.h"
+
+#ifndef Q_MOC_RUN
+#include <boost/shared_ptr.hpp>
+#include <boost/make_shared.hpp>
+#endif
+
+namespace chemkit {
+
+namespace detail {
+
+// Wraps a shared packaged task so that it can be stored in the
+// thread pool's queue as a boost::function<void ()>.
+template<typename T>
+class ThreadPoolTask
+{
+public:
+    typedef void result_type;
+
+    ThreadPoolTask(const boost::shared_ptr<boost::packaged_task<T> > &task)
+        : m_task(task)
+    {
+    }
+
+    void operator()() const
+    {
+        (*m_task)();
+    }
+
+private:
+    boost::shared_ptr<boost::packaged_task<T> > m_task;
+};
+
+} // end detail namespace
+
+// --- Tasks --------------------------------------------------------------- //
+/// Queues \p function to be run by one of the threads in the pool.
+/// Returns a future containing the value returned from \p function.
+///
+/// Tasks are started in the order they are queued.
+template<typename Function>
+inline boost::shared_future<typename Function::result_type> ThreadPool::run(const Function &function)
+{
+    typedef typename Function::result_type result_type;
+
+    boost::shared_ptr<boost::packaged_task<result_type> > task =
+        boost::make_shared<boost::packaged_task<result_type> >(function);
+    boost::shared_future<result_type> future(task->get_future());
+
+    enqueue(detail::ThreadPoolTask<result_type>(task));
+
+    return future;
+}
+
+} // end chemkit namespace
+
+#endif // CHEMKIT_THREADPOOL_INLINE_H
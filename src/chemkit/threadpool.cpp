@@ -0,0 +1,192 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+#include "threadpool.h"
+
+#include <deque>
+
+#include <boost/bind.hpp>
+
+namespace chemkit {
+
+// === ThreadPoolPrivate =================================================== //
+class ThreadPoolPrivate
+{
+public:
+    boost::thread_group threads;
+    size_t threadCount;
+    std::deque<boost::function<void ()> > tasks;
+    size_t activeTaskCount;
+    bool stopping;
+    boost::mutex mutex;
+    boost::condition_variable taskAvailable;
+    boost::condition_variable tasksDone;
+};
+
+// === ThreadPool ========================================================== //
+/// \class ThreadPool threadpool.h chemkit/threadpool.h
+/// \ingroup chemkit
+/// \brief The ThreadPool class manages a fixed set of worker threads.
+///
+/// Unlike concurrent::run(), which starts a new thread for each
+/// call, the thread pool keeps its threads alive for its entire
+/// lifetime and hands queued tasks to whichever thread is idle. This
+/// makes it suitable for running many small tasks.
+///
+/// The following example counts the atoms in a list of molecules
+/// using the threads in a pool:
+/// \code
+/// ThreadPool pool(4);
+///
+/// std::vector<boost::shared_future<size_t> > counts;
+/// foreach(const Molecule *molecule, molecules){
+///     counts.push_back(pool.run(boost::bind(&Molecule::atomCount, molecule)));
+/// }
+///
+/// size_t atomCount = 0;
+/// for(size_t i = 0; i < counts.size(); i++){
+///     atomCount += counts[i].get();
+/// }
+/// \endcode
+
+// --- Construction and Destruction ---------------------------------------- //
+/// Creates a new thread pool with \p threadCount threads. If
+/// \p threadCount is \c 0 the value of idealThreadCount() is used.
+ThreadPool::ThreadPool(size_t threadCount)
+    : d(new ThreadPoolPrivate)
+{
+    if(threadCount == 0){
+        threadCount = idealThreadCount();
+    }
+
+    d->threadCount = threadCount;
+    d->activeTaskCount = 0;
+    d->stopping = false;
+
+    for(size_t i = 0; i < threadCount; i++){
+        d->threads.create_thread(boost::bind(&ThreadPool::workerLoop, this));
+    }
+}
+
+/// Destroys the thread pool. Any tasks still queued are run before
+/// the threads are stopped.
+ThreadPool::~ThreadPool()
+{
+    {
+        boost::lock_guard<boost::mutex> lock(d->mutex);
+        d->stopping = true;
+    }
+
+    d->taskAvailable.notify_all();
+    d->threads.join_all();
+
+    delete d;
+}
+
+// --- Properties ---------------------------------------------------------- //
+/// Returns the number of threads in the pool.
+size_t ThreadPool::threadCount() const
+{
+    return d->threadCount;
+}
+
+// --- Tasks --------------------------------------------------------------- //
+/// Blocks until all of the queued tasks have finished.
+void ThreadPool::waitForDone()
+{
+    boost::unique_lock<boost::mutex> lock(d->mutex);
+
+    while(!d->tasks.empty() || d->activeTaskCount > 0){
+        d->tasksDone.wait(lock);
+    }
+}
+
+// --- Static Methods ------------------------------------------------------ //
+/// Returns the number of threads that can run concurrently on the
+/// system. Returns \c 1 if this cannot be determined.
+size_t ThreadPool::idealThreadCount()
+{
+    size_t count = boost::thread::hardware_concurrency();
+
+    return count > 0 ? count : 1;
+}
+
+// --- Internal Methods ---------------------------------------------------- //
+void ThreadPool::enqueue(const boost::function<void ()> &task)
+{
+    {
+        boost::lock_guard<boost::mutex> lock(d->mutex);
+        d->tasks.push_back(task);
+    }
+
+    d->taskAvailable.notify_one();
+}
+
+void ThreadPool::workerLoop()
+{
+    for(;;){
+        boost::function<void ()> task;
+
+        {
+            boost::unique_lock<boost::mutex> lock(d->mutex);
+
+            while(d->tasks.empty() && !d->stopping){
+                d->taskAvailable.wait(lock);
+            }
+
+            if(d->tasks.empty()){
+                // stopping and no work left
+                return;
+            }
+
+            task = d->tasks.front();
+            d->tasks.pop_front();
+            d->activeTaskCount++;
+        }
+
+        task();
+
+        {
+            boost::lock_guard<boost::mutex> lock(d->mutex);
+            d->activeTaskCount--;
+
+            if(d->tasks.empty() && d->activeTaskCount == 0){
+                d->tasksDone.notify_all();
+            }
+        }
+    }
+}
+
+} // end chemkit namespace
@@ -0,0 +1,94 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+#ifndef CHEMKIT_TOPOLOGICALDISTANCEMATRIX_INLINE_H
+#define CHEMKIT_TOPOLOGICALDISTANCEMATRIX_INLINE_H
+
+#include "topologicaldistancematrix.h"
+
+#include <cassert>
+
+namespace chemkit {
+
+// --- Properties ---------------------------------------------------------- //
+/// Returns the number of atoms in the matrix.
+inline size_t TopologicalDistanceMatrix::size() const
+{
+    return m_rows.size();
+}
+
+/// Returns \c true if the matrix contains no atoms.
+inline bool TopologicalDistanceMatrix::isEmpty() const
+{
+    return size() == 0;
+}
+
+// --- Distances ----------------------------------------------------------- //
+/// Returns the number of bonds on the shortest path between the
+/// atoms with indices \p a and \p b. Returns \c npos if the atoms
+/// are not connected.
+inline size_t TopologicalDistanceMatrix::distance(size_t a, size_t b) const
+{
+    assert(a < size() && b < size());
+
+    if(a == b){
+        return 0;
+    }
+
+    size_t distance = rowDistance(m_rows[a], m_rows[b]);
+    if(distance == npos){
+        return npos;
+    }
+
+    return distance + m_offsets[a] + m_offsets[b];
+}
+
+inline size_t TopologicalDistanceMatrix::rowDistance(size_t i, size_t j) const
+{
+    size_t index = i * m_rowCount + j;
+
+    if(!m_distances8.empty()){
+        unsigned char distance = m_distances8[index];
+        return distance == 0xff ? npos : distance;
+    }
+    else{
+        unsigned short distance = m_distances16[index];
+        return distance == 0xffff ? npos : distance;
+    }
+}
+
+} // end chemkit namespace
+
+#endif // CHEMKIT_TOPOLOGICALDISTANCEMATRIX_INLINE_H
@@ -0,0 +1,172 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+#include "topologicaldistancematrix.h"
+
+#include <algorithm>
+
+#include "atom.h"
+#include "molecule.h"
+#include "moleculegraph.h"
+
+namespace chemkit {
+
+// === TopologicalDistanceMatrix =========================================== //
+/// \class TopologicalDistanceMatrix topologicaldistancematrix.h chemkit/topologicaldistancematrix.h
+/// \ingroup chemkit
+/// \brief The TopologicalDistanceMatrix class contains the number
+///        of bonds between each pair of atoms in a molecule.
+///
+/// The distances are found with a breadth-first search from each
+/// atom. Terminal hydrogens are left out of the searches and the
+/// stored matrix because the distance to a terminal hydrogen is
+/// always one more than the distance to the atom it is bonded to.
+/// Distances are stored in 8-bit integers when fewer than 255 atoms
+/// are not terminal hydrogens and in 16-bit integers otherwise.
+/// Bridging hydrogens and the atoms of a hydrogen molecule count
+/// towards this limit.
+///
+/// The distance matrix for a molecule is available from
+/// Molecule::topologicalDistanceMatrix() which creates it lazily
+/// and discards it whenever the structure of the molecule changes.
+
+// --- Constants ----------------------------------------------------------- //
+/// Value returned by distance() for atoms which are not connected.
+const size_t TopologicalDistanceMatrix::npos = static_cast<size_t>(-1);
+
+// --- Construction and Destruction ---------------------------------------- //
+/// Creates a new distance matrix for \p molecule.
+TopologicalDistanceMatrix::TopologicalDistanceMatrix(const Molecule *molecule)
+    : m_rowCount(0),
+      m_rows(molecule->size()),
+      m_offsets(molecule->size(), 0)
+{
+    const MoleculeGraph *graph = molecule->graph();
+    const size_t size = molecule->size();
+
+    // assign a row to each atom other than the terminal hydrogens.
+    // the two atoms in a hydrogen molecule both keep their rows
+    std::vector<bool> terminalHydrogen(size, false);
+    for(size_t i = 0; i < size; i++){
+        terminalHydrogen[i] = graph->degree(i) == 1 &&
+                              molecule->atom(i)->is(Atom::Hydrogen);
+    }
+
+    for(size_t i = 0; i < size; i++){
+        if(terminalHydrogen[i] && !terminalHydrogen[graph->neighbor(i, 0)]){
+            m_offsets[i] = 1;
+        }
+        else{
+            m_rows[i] = m_rowCount++;
+        }
+    }
+
+    // terminal hydrogens share the row of their neighbor
+    std::vector<size_t> atoms(m_rowCount);
+    for(size_t i = 0; i < size; i++){
+        if(m_offsets[i]){
+            m_rows[i] = m_rows[graph->neighbor(i, 0)];
+        }
+        else{
+            atoms[m_rows[i]] = i;
+        }
+    }
+
+    // store the distances with the smallest type that can hold them
+    if(m_rowCount < 0xff){
+        m_distances8.resize(m_rowCount * m_rowCount);
+    }
+    else{
+        m_distances16.resize(m_rowCount * m_rowCount);
+    }
+
+    // run a breadth-first search from each row
+    std::vector<size_t> row(m_rowCount);
+    std::vector<size_t> queue(m_rowCount);
+
+    for(size_t source = 0; source < m_rowCount; source++){
+        std::fill(row.begin(), row.end(), npos);
+        row[source] = 0;
+
+        size_t head = 0;
+        size_t tail = 0;
+        queue[tail++] = source;
+
+        while(head < tail){
+            size_t current = queue[head++];
+            size_t atom = atoms[current];
+
+            for(size_t i = 0; i < graph->degree(atom); i++){
+                size_t neighbor = graph->neighbor(atom, i);
+                if(m_offsets[neighbor]){
+                    continue;
+                }
+
+                size_t next = m_rows[neighbor];
+                if(row[next] == npos){
+                    row[next] = row[current] + 1;
+                    queue[tail++] = next;
+                }
+            }
+        }
+
+        size_t offset = source * m_rowCount;
+        if(!m_distances8.empty()){
+            for(size_t i = 0; i < m_rowCount; i++){
+                m_distances8[offset + i] = row[i] == npos ? 0xff : static_cast<unsigned char>(row[i]);
+            }
+        }
+        else{
+            for(size_t i = 0; i < m_rowCount; i++){
+                m_distances16[offset + i] = row[i] == npos ? 0xffff : static_cast<unsigned short>(std::min<size_t>(row[i], 0xfffe));
+            }
+        }
+    }
+}
+
+/// Destroys the distance matrix.
+TopologicalDistanceMatrix::~TopologicalDistanceMatrix()
+{
+}
+
+// --- Distances ----------------------------------------------------------- //
+/// Returns the number of bonds on the shortest path between atoms
+/// \p a and \p b. Returns \c npos if the atoms are not connected.
+size_t TopologicalDistanceMatrix::distance(const Atom *a, const Atom *b) const
+{
+    return distance(a->index(), b->index());
+}
+
+} // end chemkit namespace
@@ -0,0 +1,642 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+#include "fingerprintdatabase.h"
+
+#include <queue>
+#include <fstream>
+#include <algorithm>
+
+#ifndef Q_MOC_RUN
+#include <boost/cstdint.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+#endif
+
+#include <chemkit/molecule.h>
+#include <chemkit/fingerprint.h>
+
+#include "moleculefile.h"
+
+namespace chemkit {
+
+namespace {
+
+// The database file contains a fixed size header followed by these
+// sections, each an array of 64-bit unsigned integers unless noted:
+//
+//   bins        [fingerprintSize + 2]  first record with each popcount
+//   words       [recordCount * wordCount]  fingerprints, by popcount
+//   ids         [recordCount]  original index of each record
+//   positions   [recordCount]  record position of each original index
+//   nameOffsets [recordCount + 1]  offset of each name in names
+//   names       [nameOffsets[recordCount]]  characters
+//
+// Values are stored in the byte order of the machine which created
+// the file.
+struct FileHeader
+{
+    char magic[8];
+    boost::uint32_t byteOrder;
+    boost::uint32_t fingerprintSize;
+    boost::uint32_t wordCount;
+    boost::uint32_t reserved;
+    boost::uint64_t recordCount;
+    char fingerprintName[32];
+};
+
+const char FileMagic[8] = { 'C', 'K', 'F', 'P', 'D', 'B', '0', '1' };
+const boost::uint32_t FileByteOrder = 0x01020304;
+
+inline size_t popcount(boost::uint64_t word)
+{
+#if defined(__GNUC__)
+    return __builtin_popcountll(word);
+#else
+    word = word - ((word >> 1) & 0x5555555555555555ULL);
+    word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+    word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+    return static_cast<size_t>((word * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+inline size_t popcount(const boost::uint64_t *words, size_t wordCount)
+{
+    size_t count = 0;
+
+    for(size_t i = 0; i < wordCount; i++){
+        count += popcount(words[i]);
+    }
+
+    return count;
+}
+
+inline size_t intersectionCount(const boost::uint64_t *a, const boost::uint64_t *b, size_t wordCount)
+{
+    size_t count = 0;
+
+    for(size_t i = 0; i < wordCount; i++){
+        count += popcount(a[i] & b[i]);
+    }
+
+    return count;
+}
+
+// Packs the bits from bitset into 64-bit words.
+std::vector<boost::uint64_t> toWords(const Bitset &bitset, size_t wordCount)
+{
+    std::vector<boost::uint64_t> words(wordCount, 0);
+
+    for(size_t i = bitset.find_first(); i != Bitset::npos; i = bitset.find_next(i)){
+        if(i / 64 < wordCount){
+            words[i / 64] |= boost::uint64_t(1) << (i % 64);
+        }
+    }
+
+    return words;
+}
+
+// Returns the upper bound on the tanimoto coefficient between
+// fingerprints with a and b bits set (Swamidass and Baldi, 2007).
+inline Real similarityBound(size_t a, size_t b)
+{
+    return Real(std::min(a, b)) / Real(std::max(a, b));
+}
+
+// Orders hits from most to least similar, breaking ties by index.
+struct HitCompare
+{
+    bool operator()(const FingerprintDatabase::Hit &a, const FingerprintDatabase::Hit &b) const
+    {
+        if(a.second != b.second){
+            return a.second > b.second;
+        }
+
+        return a.first < b.first;
+    }
+};
+
+template<typename T>
+void writeArray(std::ostream &output, const std::vector<T> &values)
+{
+    if(!values.empty()){
+        output.write(reinterpret_cast<const char *>(&values[0]), values.size() * sizeof(T));
+    }
+}
+
+} // end anonymous namespace
+
+// === FingerprintDatabasePrivate ========================================== //
+class FingerprintDatabasePrivate
+{
+public:
+    boost::iostreams::mapped_file_source file;
+    std::string fileName;
+    std::string fingerprintName;
+    std::string errorString;
+    size_t fingerprintSize;
+    size_t wordCount;
+    size_t recordCount;
+    const boost::uint64_t *bins;
+    const boost::uint64_t *words;
+    const boost::uint64_t *ids;
+    const boost::uint64_t *positions;
+    const boost::uint64_t *nameOffsets;
+    const char *names;
+};
+
+// === FingerprintDatabase ================================================= //
+/// \class FingerprintDatabase fingerprintdatabase.h chemkit/fingerprintdatabase.h
+/// \ingroup chemkit-io
+/// \brief The FingerprintDatabase class provides fast similarity
+///        searches over a file of precomputed fingerprints.
+///
+/// Fingerprint databases are binary files created from the molecules
+/// in a molecule file with create(). The database file is memory
+/// mapped when opened so that searching does not require reading the
+/// fingerprints into memory.
+///
+/// Records are stored ordered by the number of bits set in their
+/// fingerprint. Searches use the bound on the tanimoto coefficient
+/// given by the bit counts (Swamidass and Baldi, 2007) to skip
+/// records which cannot be similar enough to be returned.
+///
+/// The following example creates a database using the FP2
+/// fingerprint and finds the ten molecules most similar to phenol:
+/// \code
+/// MoleculeFile input("pubchem.sdf");
+/// input.beginRead();
+///
+/// FingerprintDatabase database;
+/// database.create("pubchem.ckfp", &input, "fp2");
+///
+/// boost::scoped_ptr<Fingerprint> fp2(Fingerprint::create("fp2"));
+/// Molecule phenol("c1ccccc1O", "smiles");
+///
+/// foreach(const FingerprintDatabase::Hit &hit, database.search(fp2->value(&phenol), 10)){
+///     std::cout << database.name(hit.first) << " " << hit.second << std::endl;
+/// }
+/// \endcode
+///
+/// \see Fingerprint
+
+/// \typedef FingerprintDatabase::Hit
+///
+/// A search result containing the index of the record and its
+/// tanimoto coefficient with the query fingerprint.
+
+// --- Construction and Destruction ---------------------------------------- //
+/// Creates a new, closed fingerprint database.
+FingerprintDatabase::FingerprintDatabase()
+    : d(new FingerprintDatabasePrivate)
+{
+    close();
+}
+
+/// Creates a new fingerprint database and opens \p fileName.
+FingerprintDatabase::FingerprintDatabase(const std::string &fileName)
+    : d(new FingerprintDatabasePrivate)
+{
+    close();
+    open(fileName);
+}
+
+/// Destroys the fingerprint database.
+FingerprintDatabase::~FingerprintDatabase()
+{
+    close();
+
+    delete d;
+}
+
+// --- Properties ---------------------------------------------------------- //
+/// Returns the file name of the open database.
+std::string FingerprintDatabase::fileName() const
+{
+    return d->fileName;
+}
+
+/// Returns the name of the fingerprint stored in the database.
+std::string FingerprintDatabase::fingerprintName() const
+{
+    return d->fingerprintName;
+}
+
+/// Returns the number of bits in each fingerprint.
+size_t FingerprintDatabase::fingerprintSize() const
+{
+    return d->fingerprintSize;
+}
+
+/// Returns the number of records in the database.
+size_t FingerprintDatabase::size() const
+{
+    return d->recordCount;
+}
+
+/// Returns \c true if the database contains no records.
+bool FingerprintDatabase::isEmpty() const
+{
+    return size() == 0;
+}
+
+// --- File ---------------------------------------------------------------- //
+/// Opens the database file with \p fileName. Returns \c false if the
+/// file cannot be opened or is not a valid fingerprint database.
+bool FingerprintDatabase::open(const std::string &fileName)
+{
+    close();
+
+    try {
+        d->file.open(fileName);
+    }
+    catch(std::exception &e){
+        setErrorString("Failed to open '" + fileName + "': " + e.what());
+        return false;
+    }
+
+    if(d->file.size() < sizeof(FileHeader)){
+        close();
+        setErrorString("File is not a fingerprint database.");
+        return false;
+    }
+
+    FileHeader header;
+    std::copy(d->file.data(), d->file.data() + sizeof(FileHeader), reinterpret_cast<char *>(&header));
+
+    if(!std::equal(FileMagic, FileMagic + sizeof(FileMagic), header.magic)){
+        close();
+        setErrorString("File is not a fingerprint database.");
+        return false;
+    }
+    else if(header.byteOrder != FileByteOrder){
+        close();
+        setErrorString("Fingerprint database was created on a machine with a different byte order.");
+        return false;
+    }
+
+    size_t fingerprintSize = header.fingerprintSize;
+    size_t wordCount = header.wordCount;
+    size_t recordCount = static_cast<size_t>(header.recordCount);
+
+    // locate each section of the file
+    const boost::uint64_t *data = reinterpret_cast<const boost::uint64_t *>(d->file.data() + sizeof(FileHeader));
+    size_t dataSize = (d->file.size() - sizeof(FileHeader)) / sizeof(boost::uint64_t);
+    size_t nameOffsetsEnd = (fingerprintSize + 2) + recordCount * (wordCount + 3) + 1;
+
+    if(wordCount * 64 < fingerprintSize || dataSize < nameOffsetsEnd){
+        close();
+        setErrorString("Fingerprint database is truncated.");
+        return false;
+    }
+
+    d->bins = data;
+    d->words = d->bins + fingerprintSize + 2;
+    d->ids = d->words + recordCount * wordCount;
+    d->positions = d->ids + recordCount;
+    d->nameOffsets = d->positions + recordCount;
+    d->names = reinterpret_cast<const char *>(d->nameOffsets + recordCount + 1);
+
+    if(d->names + d->nameOffsets[recordCount] > d->file.data() + d->file.size()){
+        close();
+        setErrorString("Fingerprint database is truncated.");
+        return false;
+    }
+
+    d->fileName = fileName;
+    d->fingerprintName = std::string(header.fingerprintName,
+                                     std::find(header.fingerprintName,
+                                               header.fingerprintName + sizeof(header.fingerprintName),
+                                               '\0'));
+    d->fingerprintSize = fingerprintSize;
+    d->wordCount = wordCount;
+    d->recordCount = recordCount;
+
+    return true;
+}
+
+/// Returns \c true if the database is open.
+bool FingerprintDatabase::isOpen() const
+{
+    return d->file.is_open();
+}
+
+/// Closes the database.
+void FingerprintDatabase::close()
+{
+    if(d->file.is_open()){
+        d->file.close();
+    }
+
+    d->fileName.clear();
+    d->fingerprintName.clear();
+    d->fingerprintSize = 0;
+    d->wordCount = 0;
+    d->recordCount = 0;
+    d->bins = 0;
+    d->words = 0;
+    d->ids = 0;
+    d->positions = 0;
+    d->nameOffsets = 0;
+    d->names = 0;
+}
+
+/// Creates a new database file with \p fileName containing the
+/// \p fingerprintName fingerprint for each molecule read from
+/// \p input and then opens it. Molecules are read from \p input with
+/// MoleculeFile::readNext() so beginRead() must be called on it
+/// first.
+///
+/// Each record is named with its molecule's name, or its formula if
+/// the molecule has no name.
+///
+/// Returns \c false if an error occurs.
+bool FingerprintDatabase::create(const std::string &fileName,
+                                 MoleculeFile *input,
+                                 const std::string &fingerprintName)
+{
+    close();
+
+    boost::scoped_ptr<Fingerprint> fingerprint(Fingerprint::create(fingerprintName));
+    if(!fingerprint){
+        setErrorString("Fingerprint '" + fingerprintName + "' is not supported.");
+        return false;
+    }
+    else if(fingerprintName.size() >= sizeof(FileHeader().fingerprintName)){
+        setErrorString("Fingerprint name '" + fingerprintName + "' is too long.");
+        return false;
+    }
+
+    const size_t fingerprintSize = fingerprint->size();
+    const size_t wordCount = fingerprint->wordCount();
+
+    // calculate the fingerprint for each molecule
+    std::vector<boost::uint64_t> words;
+    std::vector<size_t> popcounts;
+    std::vector<boost::uint64_t> nameOffsets(1, 0);
+    std::string names;
+
+    while(boost::shared_ptr<Molecule> molecule = input->readNext()){
+        words.resize(words.size() + wordCount);
+        boost::uint64_t *value = &words[words.size() - wordCount];
+        fingerprint->packedValue(molecule.get(), value);
+        popcounts.push_back(std::min(popcount(value, wordCount), fingerprintSize));
+
+        std::string name = molecule->name();
+        if(name.empty()){
+            name = molecule->formula();
+        }
+
+        names += name;
+        nameOffsets.push_back(names.size());
+    }
+
+    if(!input->errorString().empty()){
+        setErrorString("Failed to read input: " + input->errorString());
+        return false;
+    }
+
+    const size_t recordCount = popcounts.size();
+
+    // order records by popcount
+    std::vector<boost::uint64_t> bins(fingerprintSize + 2, 0);
+    for(size_t i = 0; i < recordCount; i++){
+        bins[popcounts[i] + 1]++;
+    }
+    for(size_t i = 1; i < bins.size(); i++){
+        bins[i] += bins[i - 1];
+    }
+
+    std::vector<boost::uint64_t> ids(recordCount);
+    std::vector<boost::uint64_t> positions(recordCount);
+    std::vector<boost::uint64_t> next(bins.begin(), bins.end() - 1);
+    for(size_t i = 0; i < recordCount; i++){
+        size_t position = static_cast<size_t>(next[popcounts[i]]++);
+        ids[position] = i;
+        positions[i] = position;
+    }
+
+    std::vector<boost::uint64_t> sortedWords(words.size());
+    for(size_t i = 0; i < recordCount; i++){
+        std::copy(words.begin() + i * wordCount,
+                  words.begin() + (i + 1) * wordCount,
+                  sortedWords.begin() + positions[i] * wordCount);
+    }
+
+    // write file
+    std::ofstream output(fileName.c_str(), std::ios_base::out | std::ios_base::binary);
+    if(!output.is_open()){
+        setErrorString("Failed to open '" + fileName + "' for writing.");
+        return false;
+    }
+
+    FileHeader header;
+    std::fill(reinterpret_cast<char *>(&header), reinterpret_cast<char *>(&header) + sizeof(header), 0);
+    std::copy(FileMagic, FileMagic + sizeof(FileMagic), header.magic);
+    header.byteOrder = FileByteOrder;
+    header.fingerprintSize = static_cast<boost::uint32_t>(fingerprintSize);
+    header.wordCount = static_cast<boost::uint32_t>(wordCount);
+    header.recordCount = recordCount;
+    std::copy(fingerprintName.begin(), fingerprintName.end(), header.fingerprintName);
+
+    output.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    writeArray(output, bins);
+    writeArray(output, sortedWords);
+    writeArray(output, ids);
+    writeArray(output, positions);
+    writeArray(output, nameOffsets);
+    output.write(names.data(), names.size());
+    output.close();
+
+    if(!output){
+        setErrorString("Failed to write '" + fileName + "'.");
+        return false;
+    }
+
+    return open(fileName);
+}
+
+// --- Records ------------------------------------------------------------- //
+/// Returns the name of the record at \p index.
+std::string FingerprintDatabase::name(size_t index) const
+{
+    return std::string(d->names + d->nameOffsets[index],
+                       d->names + d->nameOffsets[index + 1]);
+}
+
+/// Returns the fingerprint of the record at \p index.
+Bitset FingerprintDatabase::fingerprint(size_t index) const
+{
+    Bitset fingerprint(d->fingerprintSize);
+
+    const boost::uint64_t *words = d->words + d->positions[index] * d->wordCount;
+    for(size_t i = 0; i < d->fingerprintSize; i++){
+        if(words[i / 64] & (boost::uint64_t(1) << (i % 64))){
+            fingerprint.set(i);
+        }
+    }
+
+    return fingerprint;
+}
+
+// --- Search -------------------------------------------------------------- //
+/// Returns the \p count records most similar to \p fingerprint with a
+/// tanimoto coefficient of at least \p threshold. The hits are ordered
+/// from most to least similar. Records with equal similarity are
+/// ordered by index.
+std::vector<FingerprintDatabase::Hit> FingerprintDatabase::search(const Bitset &fingerprint,
+                                                                  size_t count,
+                                                                  Real threshold) const
+{
+    std::vector<Hit> hits;
+
+    if(!isOpen() || count == 0){
+        return hits;
+    }
+
+    std::vector<boost::uint64_t> query = toWords(fingerprint, d->wordCount);
+    size_t queryCount = popcount(&query[0], d->wordCount);
+    if(queryCount == 0){
+        return hits;
+    }
+
+    // the top of the queue is the least similar hit found so far
+    std::priority_queue<Hit, std::vector<Hit>, HitCompare> best;
+
+    // visit the popcount bins from the highest similarity bound to
+    // the lowest, starting with the bin equal to the query's popcount
+    size_t below = queryCount + 1;
+    size_t above = queryCount + 1;
+
+    for(;;){
+        bool hasBelow = below > 0;
+        bool hasAbove = above <= d->fingerprintSize;
+        if(!hasBelow && !hasAbove){
+            break;
+        }
+
+        size_t bin;
+        if(hasBelow && (!hasAbove || similarityBound(queryCount, below - 1) >= similarityBound(queryCount, above))){
+            bin = --below;
+        }
+        else{
+            bin = above++;
+        }
+
+        // stop once no remaining record can be similar enough
+        Real bound = similarityBound(queryCount, bin);
+        if(bound < threshold || (best.size() == count && bound < best.top().second)){
+            break;
+        }
+
+        for(size_t position = static_cast<size_t>(d->bins[bin]); position < d->bins[bin + 1]; position++){
+            size_t common = intersectionCount(&query[0], d->words + position * d->wordCount, d->wordCount);
+            Real similarity = Real(common) / Real(queryCount + bin - common);
+            if(similarity < threshold){
+                continue;
+            }
+
+            Hit hit(static_cast<size_t>(d->ids[position]), similarity);
+            if(best.size() < count){
+                best.push(hit);
+            }
+            else if(HitCompare()(hit, best.top())){
+                best.pop();
+                best.push(hit);
+            }
+        }
+    }
+
+    hits.resize(best.size());
+    for(size_t i = hits.size(); i > 0; i--){
+        hits[i - 1] = best.top();
+        best.pop();
+    }
+
+    return hits;
+}
+
+/// Returns all records with a tanimoto coefficient of at least
+/// \p threshold to \p fingerprint. The hits are ordered from most to
+/// least similar. Records with equal similarity are ordered by index.
+std::vector<FingerprintDatabase::Hit> FingerprintDatabase::thresholdSearch(const Bitset &fingerprint,
+                                                                           Real threshold) const
+{
+    std::vector<Hit> hits;
+
+    if(!isOpen()){
+        return hits;
+    }
+
+    std::vector<boost::uint64_t> query = toWords(fingerprint, d->wordCount);
+    size_t queryCount = popcount(&query[0], d->wordCount);
+    if(queryCount == 0){
+        return hits;
+    }
+
+    for(size_t bin = 0; bin <= d->fingerprintSize; bin++){
+        // skip bins whose records cannot reach the threshold
+        if(similarityBound(queryCount, bin) < threshold){
+            continue;
+        }
+
+        for(size_t position = static_cast<size_t>(d->bins[bin]); position < d->bins[bin + 1]; position++){
+            size_t common = intersectionCount(&query[0], d->words + position * d->wordCount, d->wordCount);
+            Real similarity = Real(common) / Real(queryCount + bin - common);
+            if(similarity >= threshold){
+                hits.push_back(Hit(static_cast<size_t>(d->ids[position]), similarity));
+            }
+        }
+    }
+
+    std::sort(hits.begin(), hits.end(), HitCompare());
+
+    return hits;
+}
+
+// --- Error Handling ------------------------------------------------------ //
+/// Sets a string describing the last error that occurred.
+void FingerprintDatabase::setErrorString(const std::string &errorString)
+{
+    d->errorString = errorString;
+}
+
+/// Returns a string describing the last error that occurred.
+std::string FingerprintDatabase::errorString() const
+{
+    return d->errorString;
+}
+
+} // end chemkit namespace
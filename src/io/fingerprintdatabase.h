@@ -0,0 +1,98 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+#ifndef CHEMKIT_FINGERPRINTDATABASE_H
+#define CHEMKIT_FINGERPRINTDATABASE_H
+
+#include "io.h"
+
+#include <string>
+#include <vector>
+#include <utility>
+
+#include <chemkit/bitset.h>
+
+namespace chemkit {
+
+class MoleculeFile;
+class FingerprintDatabasePrivate;
+
+class CHEMKIT_IO_EXPORT FingerprintDatabase
+{
+public:
+    // typedefs
+    typedef std::pair<size_t, Real> Hit;
+
+    // construction and destruction
+    FingerprintDatabase();
+    FingerprintDatabase(const std::string &fileName);
+    ~FingerprintDatabase();
+
+    // properties
+    std::string fileName() const;
+    std::string fingerprintName() const;
+    size_t fingerprintSize() const;
+    size_t size() const;
+    bool isEmpty() const;
+
+    // file
+    bool open(const std::string &fileName);
+    bool isOpen() const;
+    void close();
+    bool create(const std::string &fileName, MoleculeFile *input, const std::string &fingerprintName);
+
+    // records
+    std::string name(size_t index) const;
+    Bitset fingerprint(size_t index) const;
+
+    // search
+    std::vector<Hit> search(const Bitset &fingerprint, size_t count, Real threshold = 0) const;
+    std::vector<Hit> thresholdSearch(const Bitset &fingerprint, Real threshold) const;
+
+    // error handling
+    std::string errorString() const;
+
+private:
+    void setErrorString(const std::string &errorString);
+
+    CHEMKIT_DISABLE_COPY(FingerprintDatabase)
+
+private:
+    FingerprintDatabasePrivate* const d;
+};
+
+} // end chemkit namespace
+
+#endif // CHEMKIT_FINGERPRINTDATABASE_H
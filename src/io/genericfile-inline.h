@@ -215,6 +215,9 @@ inline std::string GenericFile<File, Format>::compressionFormat() const
 // --- Input and Output ---------------------------------------------------- //
 /// Reads the file using the current file name. Returns \c false if
 /// no file name is set or if reading of the file fails.
+///
+/// Uncompressed files are memory mapped and read directly from the
+/// mapped data.
 template<typename File, typename Format>
 inline bool GenericFile<File, Format>::read()
 {
@@ -227,6 +230,22 @@ inline bool GenericFile<File, Format>::read()
         return false;
     }
 
+    // map uncompressed files into memory
+    if(m_compressionFormat.empty()){
+        boost::iostreams::mapped_file_source input;
+
+        try {
+            input.open(m_fileName);
+        }
+        catch(std::exception &){
+            // fall back to reading from a stream (e.g. for empty files)
+        }
+
+        if(input.is_open()){
+            return read(input);
+        }
+    }
+
     // open file
     std::ifstream file(m_fileName.c_str());
     if(!file.is_open()){
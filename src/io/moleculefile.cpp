@@ -35,10 +35,22 @@
 
 #include "moleculefile.h"
 
+#include <deque>
+#include <fstream>
+
+#include <boost/format.hpp>
+#include <boost/scoped_ptr.hpp>
 #include <boost/lambda/lambda.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+
+#ifndef CHEMKIT_OS_WIN32
+#include <boost/iostreams/filter/gzip.hpp>
+#include <boost/iostreams/filter/bzip2.hpp>
+#endif
 
 #include <chemkit/foreach.h>
 #include <chemkit/molecule.h>
+#include <chemkit/threadpool.h>
 #include <chemkit/variantmap.h>
 
 namespace chemkit {
@@ -49,6 +61,18 @@ class MoleculeFilePrivate
 public:
     std::vector<boost::shared_ptr<Molecule> > molecules;
     VariantMap fileData;
+    size_t threadCount;
+
+    // streaming input and output
+    boost::scoped_ptr<std::ifstream> inputFile;
+    boost::scoped_ptr<boost::iostreams::filtering_istream> inputStream;
+    boost::scoped_ptr<std::ofstream> outputFile;
+    boost::scoped_ptr<boost::iostreams::filtering_ostream> outputStream;
+
+    // molecules buffered for formats without streaming support
+    bool inputBuffered;
+    std::deque<boost::shared_ptr<Molecule> > inputBuffer;
+    std::vector<boost::shared_ptr<Molecule> > outputBuffer;
 };
 
 // === MoleculeFile ======================================================== //
@@ -79,6 +103,26 @@ public:
 /// boost::shared_ptr<Molecule> molecule = file.molecule();
 /// \endcode
 ///
+/// For large multi-molecule files the molecules can also be read
+/// one at a time with readNext() instead of loading the entire file
+/// into memory with read(). Molecules read this way are not added
+/// to the file:
+/// \code
+/// MoleculeFile file("pubchem.sdf");
+/// file.beginRead();
+///
+/// while(boost::shared_ptr<Molecule> molecule = file.readNext()){
+///     // process molecule
+/// }
+/// \endcode
+///
+/// In the same way, beginWrite() and writeNext() write molecules to
+/// the output one record at a time.
+///
+/// Formats such as SDF and SMILES can also be read in parallel by
+/// setting the number of threads with setThreadCount() before
+/// calling read().
+///
 /// \see PolymerFile
 
 // --- Construction and Destruction ---------------------------------------- //
@@ -86,6 +130,8 @@ public:
 MoleculeFile::MoleculeFile()
     : d(new MoleculeFilePrivate)
 {
+    d->inputBuffered = false;
+    d->threadCount = 1;
 }
 
 /// Creates a new, empty file object with \p fileName.
@@ -93,12 +139,17 @@ MoleculeFile::MoleculeFile(const std::string &fileName)
     : GenericFile<MoleculeFile, MoleculeFileFormat>(fileName),
       d(new MoleculeFilePrivate)
 {
+    d->inputBuffered = false;
+    d->threadCount = 1;
 }
 
 /// Destroys the file object. Destroying the file will also destroy
 /// any molecules that it contains.
 MoleculeFile::~MoleculeFile()
 {
+    endRead();
+    endWrite();
+
     delete d;
 }
 
@@ -186,6 +237,243 @@ void MoleculeFile::clear()
     d->fileData.clear();
 }
 
+// --- Streaming Input and Output ----------------------------------------- //
+/// Opens the file using the current file name for reading molecules
+/// one at a time with readNext(). Returns \c false if no file name
+/// or format is set or if the file could not be opened.
+bool MoleculeFile::beginRead()
+{
+    if(fileName().empty()){
+        setErrorString("No file name set for reading.");
+        return false;
+    }
+    else if(!format()){
+        setErrorString("No file format set for reading.");
+        return false;
+    }
+
+    endRead();
+
+    d->inputFile.reset(new std::ifstream(fileName().c_str()));
+    if(!d->inputFile->is_open()){
+        d->inputFile.reset();
+        setErrorString("Failed to open file for reading.");
+        return false;
+    }
+
+    return beginRead(*d->inputFile);
+}
+
+/// Begins reading molecules one at a time from \p input. The stream
+/// must remain valid until endRead() is called.
+bool MoleculeFile::beginRead(std::istream &input)
+{
+    if(!format()){
+        setErrorString("No file format set for reading.");
+        return false;
+    }
+
+    d->inputStream.reset(new boost::iostreams::filtering_istream);
+    d->inputBuffered = false;
+    d->inputBuffer.clear();
+
+    // insert stream decompressor
+#ifndef CHEMKIT_OS_WIN32
+    if(compressionFormat() == "gz"){
+        d->inputStream->push(boost::iostreams::gzip_decompressor());
+    }
+    else if(compressionFormat() == "bz2"){
+        d->inputStream->push(boost::iostreams::bzip2_decompressor());
+    }
+#endif
+
+    d->inputStream->push(input);
+
+    return true;
+}
+
+/// Reads and returns the next molecule from the input. Returns a null
+/// pointer once all molecules have been read or if an error occurs,
+/// in which case errorString() describes the error.
+///
+/// The molecule is not added to the file, so only the molecule being
+/// processed needs to be kept in memory. For formats which do not
+/// support streaming the entire input is read on the first call and
+/// the molecules are then returned one at a time.
+boost::shared_ptr<Molecule> MoleculeFile::readNext()
+{
+    if(!d->inputStream){
+        setErrorString("File not opened for reading.");
+        return boost::shared_ptr<Molecule>();
+    }
+
+    if(!format()->supportsStreaming()){
+        if(!d->inputBuffered){
+            MoleculeFile file;
+            if(!format()->read(*d->inputStream, &file)){
+                setErrorString(format()->errorString());
+            }
+
+            d->inputBuffer.assign(file.d->molecules.begin(), file.d->molecules.end());
+            d->inputBuffered = true;
+        }
+
+        if(d->inputBuffer.empty()){
+            return boost::shared_ptr<Molecule>();
+        }
+
+        boost::shared_ptr<Molecule> molecule = d->inputBuffer.front();
+        d->inputBuffer.pop_front();
+        return molecule;
+    }
+
+    boost::shared_ptr<Molecule> molecule(format()->readNext(*d->inputStream));
+    if(!molecule && !d->inputStream->eof()){
+        setErrorString(format()->errorString());
+    }
+
+    return molecule;
+}
+
+/// Closes the input opened with beginRead().
+void MoleculeFile::endRead()
+{
+    d->inputStream.reset();
+    d->inputFile.reset();
+    d->inputBuffered = false;
+    d->inputBuffer.clear();
+}
+
+/// Opens the file using the current file name for writing molecules
+/// one at a time with writeNext(). Returns \c false if no file name
+/// or format is set or if the file could not be opened.
+bool MoleculeFile::beginWrite()
+{
+    if(fileName().empty()){
+        setErrorString("No file name set for writing.");
+        return false;
+    }
+    else if(!format()){
+        setErrorString("No format set for writing.");
+        return false;
+    }
+
+    endWrite();
+
+    d->outputFile.reset(new std::ofstream(fileName().c_str()));
+    if(!d->outputFile->is_open()){
+        d->outputFile.reset();
+        setErrorString((boost::format("Failed to open '%s' for writing") % fileName()).str());
+        return false;
+    }
+
+    return beginWrite(*d->outputFile);
+}
+
+/// Begins writing molecules one at a time to \p output. The stream
+/// must remain valid until endWrite() is called.
+bool MoleculeFile::beginWrite(std::ostream &output)
+{
+    if(!format()){
+        setErrorString("No format set for writing.");
+        return false;
+    }
+
+    d->outputStream.reset(new boost::iostreams::filtering_ostream);
+    d->outputBuffer.clear();
+
+    // insert stream compressor
+#ifndef CHEMKIT_OS_WIN32
+    if(compressionFormat() == "gz"){
+        d->outputStream->push(boost::iostreams::gzip_compressor());
+    }
+    else if(compressionFormat() == "bz2"){
+        d->outputStream->push(boost::iostreams::bzip2_compressor());
+    }
+#endif
+
+    d->outputStream->push(output);
+
+    return true;
+}
+
+/// Writes \p molecule as the next record in the output. Returns
+/// \c false if writing fails.
+///
+/// For formats which do not support streaming a copy of \p molecule
+/// is kept and all of the molecules are written by endWrite().
+bool MoleculeFile::writeNext(const Molecule *molecule)
+{
+    if(!d->outputStream){
+        setErrorString("File not opened for writing.");
+        return false;
+    }
+
+    if(!format()->supportsStreaming()){
+        d->outputBuffer.push_back(boost::shared_ptr<Molecule>(new Molecule(*molecule)));
+        return true;
+    }
+
+    bool ok = format()->writeNext(molecule, *d->outputStream);
+    if(!ok){
+        setErrorString(format()->errorString());
+    }
+
+    return ok;
+}
+
+/// Flushes and closes the output opened with beginWrite(). Returns
+/// \c false if writing any buffered molecules fails.
+bool MoleculeFile::endWrite()
+{
+    bool ok = true;
+
+    if(d->outputStream && !d->outputBuffer.empty()){
+        MoleculeFile file;
+        file.d->molecules.swap(d->outputBuffer);
+
+        ok = format()->write(&file, *d->outputStream);
+        if(!ok){
+            setErrorString(format()->errorString());
+        }
+    }
+
+    // destroying the filtering stream flushes any compressor
+    d->outputStream.reset();
+    d->outputFile.reset();
+    d->outputBuffer.clear();
+
+    return ok;
+}
+
+// --- Threading ----------------------------------------------------------- //
+/// Sets the number of threads used to read the file to
+/// \p threadCount. If \p threadCount is \c 0 the value of
+/// ThreadPool::idealThreadCount() is used.
+///
+/// By default files are read with a single thread. When more than
+/// one thread is used, formats which support chunked reading divide
+/// the file into chunks of whole records which are parsed in
+/// parallel. The molecules are always added to the file in the order
+/// they appear in the input. Only uncompressed files read from disk
+/// with read() are read in parallel.
+///
+/// \see MoleculeFileFormat::supportsChunkedReading()
+void MoleculeFile::setThreadCount(size_t threadCount)
+{
+    if(threadCount == 0){
+        threadCount = ThreadPool::idealThreadCount();
+    }
+
+    d->threadCount = threadCount;
+}
+
+/// Returns the number of threads used to read the file.
+size_t MoleculeFile::threadCount() const
+{
+    return d->threadCount;
+}
+
 // --- Static Methods ------------------------------------------------------ //
 /// Reads and returns a molecule from the file. Returns a null pointer if
 /// there was an error reading the file or the file is empty.
@@ -79,6 +79,20 @@ public:
     bool contains(const boost::shared_ptr<Molecule> &molecule) const;
     void clear();
 
+    // streaming input and output
+    bool beginRead();
+    bool beginRead(std::istream &input);
+    boost::shared_ptr<Molecule> readNext();
+    void endRead();
+    bool beginWrite();
+    bool beginWrite(std::ostream &output);
+    bool writeNext(const Molecule *molecule);
+    bool endWrite();
+
+    // threading
+    void setThreadCount(size_t threadCount);
+    size_t threadCount() const;
+
     // static methods
     static boost::shared_ptr<Molecule> quickRead(const std::string &fileName);
     static void quickWrite(const Molecule *molecule, const std::string &fileName);
@@ -36,13 +36,23 @@
 #include "moleculefileformat.h"
 
 #include <map>
+#include <algorithm>
 
+#include <boost/bind.hpp>
 #include <boost/format.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/iostreams/stream.hpp>
+#include <boost/iostreams/device/array.hpp>
 #include <boost/algorithm/string.hpp>
 
+#include <chemkit/foreach.h>
+#include <chemkit/molecule.h>
+#include <chemkit/threadpool.h>
 #include <chemkit/variantmap.h>
 #include <chemkit/pluginmanager.h>
 
+#include "moleculefile.h"
+
 namespace chemkit {
 
 // === MoleculeFileFormatPrivate =========================================== //
@@ -130,15 +140,96 @@ bool MoleculeFileFormat::read(std::istream &input, MoleculeFile *file)
 
 /// Read the data from \p input into \p file.
 ///
+/// For formats which support chunked reading the mapped data is
+/// parsed directly with readChunk(). If the file's thread count is
+/// greater than one the data is divided into chunks at the record
+/// boundaries returned by findRecordStart() and the chunks are
+/// parsed in parallel. The molecules are added to \p file in the
+/// same order as they appear in the data.
+///
+/// Otherwise the default implementation reads the mapped data with
+/// read(). Formats can reimplement this to parse the mapped data
+/// directly.
+///
+/// \see MoleculeFile::setThreadCount()
+///
 /// \internal
 bool MoleculeFileFormat::readMappedFile(const boost::iostreams::mapped_file_source &input,
                                         MoleculeFile *file)
 {
-    CHEMKIT_UNUSED(input);
-    CHEMKIT_UNUSED(file);
+    if(!supportsChunkedReading()){
+        boost::iostreams::stream<boost::iostreams::array_source> stream(input.data(), input.size());
 
-    setErrorString((boost::format("'%s' mapped file reading not supported.") % name()).str());
-    return false;
+        return read(stream, file);
+    }
+
+    const char *data = input.data();
+    size_t size = input.size();
+    size_t threadCount = file->threadCount();
+    if(threadCount == 1){
+        return readChunk(data, size, file);
+    }
+
+    // split the data into several chunks per thread so that chunks
+    // containing larger records do not leave the other threads idle
+    size_t chunkCount = threadCount * 4;
+    std::vector<size_t> boundaries(1, 0);
+    for(size_t i = 1; i < chunkCount; i++){
+        size_t position = std::max(size / chunkCount * i, boundaries.back());
+        size_t start = findRecordStart(data, size, position);
+
+        if(start > boundaries.back() && start < size){
+            boundaries.push_back(start);
+        }
+    }
+    boundaries.push_back(size);
+
+    if(boundaries.size() == 2){
+        return readChunk(data, size, file);
+    }
+
+    // each chunk is read by its own format and file object
+    std::vector<boost::shared_ptr<MoleculeFileFormat> > formats;
+    std::vector<boost::shared_ptr<MoleculeFile> > files;
+    for(size_t i = 0; i < boundaries.size() - 1; i++){
+        MoleculeFileFormat *format = create(name());
+        if(!format){
+            return readChunk(data, size, file);
+        }
+
+        format->d->options = d->options;
+        formats.push_back(boost::shared_ptr<MoleculeFileFormat>(format));
+        files.push_back(boost::make_shared<MoleculeFile>());
+    }
+
+    ThreadPool pool(threadCount);
+    std::vector<boost::shared_future<bool> > results;
+    for(size_t i = 0; i < formats.size(); i++){
+        results.push_back(pool.run(boost::bind(&MoleculeFileFormat::readChunk,
+                                               formats[i].get(),
+                                               data + boundaries[i],
+                                               boundaries[i+1] - boundaries[i],
+                                               files[i].get())));
+    }
+
+    // add the molecules from each chunk in order
+    bool ok = true;
+    for(size_t i = 0; i < results.size(); i++){
+        if(!results[i].get()){
+            if(ok){
+                setErrorString(formats[i]->errorString());
+                ok = false;
+            }
+
+            continue;
+        }
+
+        foreach(const boost::shared_ptr<Molecule> &molecule, files[i]->molecules()){
+            file->addMolecule(molecule);
+        }
+    }
+
+    return ok;
 }
 
 /// Write the contents of \p file to \p output.
@@ -151,6 +242,78 @@ bool MoleculeFileFormat::write(const MoleculeFile *file, std::ostream &output)
     return false;
 }
 
+/// Returns \c true if the format implements readNext() and
+/// writeNext(). The default implementation returns \c false.
+bool MoleculeFileFormat::supportsStreaming() const
+{
+    return false;
+}
+
+/// Reads the next molecule from \p input and returns it. Returns
+/// \c 0 once the end of \p input is reached or if an error occurs.
+///
+/// Formats which support streaming read a single record per call
+/// and leave \p input positioned at the start of the next record.
+/// The caller takes ownership of the returned molecule.
+///
+/// \see MoleculeFile::readNext()
+Molecule* MoleculeFileFormat::readNext(std::istream &input)
+{
+    CHEMKIT_UNUSED(input);
+
+    setErrorString((boost::format("'%s' streaming reading not supported.") % name()).str());
+    return 0;
+}
+
+/// Writes \p molecule as the next record to \p output.
+///
+/// \see MoleculeFile::writeNext()
+bool MoleculeFileFormat::writeNext(const Molecule *molecule, std::ostream &output)
+{
+    CHEMKIT_UNUSED(molecule);
+    CHEMKIT_UNUSED(output);
+
+    setErrorString((boost::format("'%s' streaming writing not supported.") % name()).str());
+    return false;
+}
+
+/// Returns \c true if the format implements findRecordStart() and
+/// readChunk(). The default implementation returns \c false.
+bool MoleculeFileFormat::supportsChunkedReading() const
+{
+    return false;
+}
+
+/// Returns the offset of the first record in \p data which starts
+/// at or after \p position. Returns \p size if there are no more
+/// records.
+///
+/// Formats which support chunked reading use this to divide a file
+/// into chunks which can be read independently with readChunk().
+/// The default implementation returns \c 0 for the first position
+/// and \p size otherwise.
+size_t MoleculeFileFormat::findRecordStart(const char *data, size_t size, size_t position) const
+{
+    CHEMKIT_UNUSED(data);
+
+    return position == 0 ? 0 : size;
+}
+
+/// Reads the records in \p data into \p file. The data starts at a
+/// record boundary and contains only complete records.
+///
+/// Chunks may be read in parallel by separate instances of the
+/// format so implementations must not share state between them.
+bool MoleculeFileFormat::readChunk(const char *data, size_t size, MoleculeFile *file)
+{
+    CHEMKIT_UNUSED(data);
+    CHEMKIT_UNUSED(size);
+    CHEMKIT_UNUSED(file);
+
+    setErrorString((boost::format("'%s' chunked reading not supported.") % name()).str());
+    return false;
+}
+
 // --- Error Handling ------------------------------------------------------ //
 /// Sets a string describing the last error that occurred.
 void MoleculeFileFormat::setErrorString(const std::string &error)
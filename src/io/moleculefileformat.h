@@ -52,6 +52,7 @@
 
 namespace chemkit {
 
+class Molecule;
 class MoleculeFile;
 class MoleculeFileFormatPrivate;
 
@@ -72,6 +73,12 @@ public:
     virtual bool read(std::istream &input, MoleculeFile *file);
     virtual bool readMappedFile(const boost::iostreams::mapped_file_source &input, MoleculeFile *file);
     virtual bool write(const MoleculeFile *file, std::ostream &output);
+    virtual bool supportsStreaming() const;
+    virtual Molecule* readNext(std::istream &input);
+    virtual bool writeNext(const Molecule *molecule, std::ostream &output);
+    virtual bool supportsChunkedReading() const;
+    virtual size_t findRecordStart(const char *data, size_t size, size_t position) const;
+    virtual bool readChunk(const char *data, size_t size, MoleculeFile *file);
 
     // error handling
     std::string errorString() const;
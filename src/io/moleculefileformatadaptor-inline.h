@@ -38,6 +38,9 @@
 
 #include "moleculefileformatadaptor.h"
 
+#include <cstring>
+#include <algorithm>
+
 #ifndef Q_MOC_RUN
 #include <boost/foreach.hpp>
 #include <boost/algorithm/string.hpp>
@@ -73,6 +76,33 @@ inline MoleculeFileFormatAdaptor<LineFormat>::~MoleculeFileFormatAdaptor()
 
 inline bool MoleculeFileFormatAdaptor<LineFormat>::read(std::istream &input, MoleculeFile *file)
 {
+    while(!input.eof()){
+        Molecule *molecule = readNext(input);
+        if(molecule){
+            file->addMolecule(boost::shared_ptr<Molecule>(molecule));
+        }
+    }
+
+    return true;
+}
+
+inline bool MoleculeFileFormatAdaptor<LineFormat>::write(const MoleculeFile *file, std::ostream &output)
+{
+    BOOST_FOREACH(const boost::shared_ptr<Molecule> &molecule, file->molecules()){
+        writeNext(molecule.get(), output);
+    }
+
+    return true;
+}
+
+inline bool MoleculeFileFormatAdaptor<LineFormat>::supportsStreaming() const
+{
+    return true;
+}
+
+inline Molecule* MoleculeFileFormatAdaptor<LineFormat>::readNext(std::istream &input)
+{
+    // skip lines which do not contain a valid formula
     while(!input.eof()){
         std::string line;
         std::getline(input, line);
@@ -80,41 +110,96 @@ inline bool MoleculeFileFormatAdaptor<LineFormat>::read(std::istream &input, Mol
             continue;
         }
 
-        std::vector<std::string> lineItems;
-        boost::split(lineItems, line, boost::is_any_of("\t "));
-        if(lineItems.empty()){
-            continue;
+        Molecule *molecule = readLine(line.c_str(), line.size());
+        if(molecule){
+            return molecule;
         }
+    }
 
-        std::string formula = lineItems[0];
-        boost::shared_ptr<Molecule> molecule(m_format->read(formula));
-        if(!molecule){
-            continue;
-        }
+    return 0;
+}
+
+inline bool MoleculeFileFormatAdaptor<LineFormat>::supportsChunkedReading() const
+{
+    return true;
+}
+
+inline size_t MoleculeFileFormatAdaptor<LineFormat>::findRecordStart(const char *data,
+                                                                     size_t size,
+                                                                     size_t position) const
+{
+    if(position == 0){
+        return 0;
+    }
+
+    // each line contains a single record
+    const char *newline = static_cast<const char *>(std::memchr(data + position - 1, '\n', size - position + 1));
 
-        if(lineItems.size() >= 2){
-            molecule->setName(lineItems[1]);
+    return newline ? newline + 1 - data : size;
+}
+
+inline bool MoleculeFileFormatAdaptor<LineFormat>::readChunk(const char *data, size_t size, MoleculeFile *file)
+{
+    const char *position = data;
+    const char *end = data + size;
+
+    while(position < end){
+        const char *newline = static_cast<const char *>(std::memchr(position, '\n', end - position));
+        const char *lineEnd = newline ? newline : end;
+
+        Molecule *molecule = readLine(position, lineEnd - position);
+        if(molecule){
+            file->addMolecule(boost::shared_ptr<Molecule>(molecule));
         }
 
-        file->addMolecule(molecule);
+        position = newline ? newline + 1 : end;
     }
 
     return true;
 }
 
-inline bool MoleculeFileFormatAdaptor<LineFormat>::write(const MoleculeFile *file, std::ostream &output)
+/// Reads the molecule from the formula at the start of \p line. The
+/// formula may be followed by a space or tab and the molecule's name.
+/// Returns \c 0 if the line does not contain a valid formula.
+inline Molecule* MoleculeFileFormatAdaptor<LineFormat>::readLine(const char *line, size_t length)
 {
-    BOOST_FOREACH(const boost::shared_ptr<Molecule> &molecule, file->molecules()){
-        std::string formula = m_format->write(molecule.get());
-        output << formula;
+    static const char delimiters[] = { ' ', '\t' };
 
-        if(!molecule->name().empty()){
-            output << " " << molecule->name();
-        }
+    // ignore windows line endings
+    if(length && line[length-1] == '\r'){
+        length--;
+    }
+
+    const char *end = line + length;
+    const char *formulaEnd = std::find_first_of(line, end, delimiters, delimiters + 2);
+    if(formulaEnd == line){
+        return 0;
+    }
 
-        output << "\n";
+    Molecule *molecule = m_format->read(std::string(line, formulaEnd));
+    if(!molecule){
+        return 0;
     }
 
+    if(formulaEnd != end){
+        const char *nameEnd = std::find_first_of(formulaEnd + 1, end, delimiters, delimiters + 2);
+        molecule->setName(std::string(formulaEnd + 1, nameEnd));
+    }
+
+    return molecule;
+}
+
+inline bool MoleculeFileFormatAdaptor<LineFormat>::writeNext(const Molecule *molecule, std::ostream &output)
+{
+    std::string formula = m_format->write(molecule);
+    output << formula;
+
+    if(!molecule->name().empty()){
+        output << " " << molecule->name();
+    }
+
+    output << "\n";
+
     return true;
 }
 
@@ -58,6 +58,15 @@ public:
 
     virtual bool read(std::istream &input, MoleculeFile *file) CHEMKIT_OVERRIDE;
     virtual bool write(const MoleculeFile *file, std::ostream &output) CHEMKIT_OVERRIDE;
+    virtual bool supportsStreaming() const CHEMKIT_OVERRIDE;
+    virtual Molecule* readNext(std::istream &input) CHEMKIT_OVERRIDE;
+    virtual bool writeNext(const Molecule *molecule, std::ostream &output) CHEMKIT_OVERRIDE;
+    virtual bool supportsChunkedReading() const CHEMKIT_OVERRIDE;
+    virtual size_t findRecordStart(const char *data, size_t size, size_t position) const CHEMKIT_OVERRIDE;
+    virtual bool readChunk(const char *data, size_t size, MoleculeFile *file) CHEMKIT_OVERRIDE;
+
+private:
+    Molecule* readLine(const char *line, size_t length);
 
 private:
     LineFormat *m_format;
@@ -36,6 +36,8 @@
 #include "polymerfileformat.h"
 
 #include <boost/format.hpp>
+#include <boost/iostreams/stream.hpp>
+#include <boost/iostreams/device/array.hpp>
 
 #include <chemkit/pluginmanager.h>
 
@@ -92,15 +94,16 @@ bool PolymerFileFormat::read(std::istream &input, PolymerFile *file)
 
 /// Read the data from \p input into \p file.
 ///
+/// The default implementation reads the mapped data with read().
+/// Formats can reimplement this to parse the mapped data directly.
+///
 /// \internal
 bool PolymerFileFormat::readMappedFile(const boost::iostreams::mapped_file_source &input,
                                        PolymerFile *file)
 {
-    CHEMKIT_UNUSED(input);
-    CHEMKIT_UNUSED(file);
+    boost::iostreams::stream<boost::iostreams::array_source> stream(input.data(), input.size());
 
-    setErrorString((boost::format("'%s' mapped file reading not supported.") % name()).str());
-    return false;
+    return read(stream, file);
 }
 
 /// Write the contents of \p file to \p output.
@@ -36,6 +36,8 @@
 #include "trajectoryfileformat.h"
 
 #include <boost/format.hpp>
+#include <boost/iostreams/stream.hpp>
+#include <boost/iostreams/device/array.hpp>
 
 #include <chemkit/pluginmanager.h>
 
@@ -91,15 +93,16 @@ bool TrajectoryFileFormat::read(std::istream &input, TrajectoryFile *file)
 
 /// Read the data from \p input into \p file.
 ///
+/// The default implementation reads the mapped data with read().
+/// Formats can reimplement this to parse the mapped data directly.
+///
 /// \internal
 bool TrajectoryFileFormat::readMappedFile(const boost::iostreams::mapped_file_source &input,
                                           TrajectoryFile *file)
 {
-    CHEMKIT_UNUSED(input);
-    CHEMKIT_UNUSED(file);
+    boost::iostreams::stream<boost::iostreams::array_source> stream(input.data(), input.size());
 
-    setErrorString((boost::format("'%s' mapped file reading not supported.") % name()).str());
-    return false;
+    return read(stream, file);
 }
 
 /// Write the contents of \p file to \p output.
@@ -112,6 +115,49 @@ bool TrajectoryFileFormat::write(const TrajectoryFile *file, std::ostream &outpu
     return false;
 }
 
+// --- Random Access ------------------------------------------------------- //
+/// Scans the \p size bytes of trajectory data at \p data and stores
+/// the byte offset and time of each frame in \p offsets and
+/// \p times. Frame \c i spans from \c offsets[i] up to the offset
+/// of the next frame (or the end of the data for the last frame).
+///
+/// Formats implementing this should locate the frames without
+/// decoding their coordinates. Returns \c false if the data could
+/// not be indexed.
+///
+/// \see TrajectoryFileReader
+bool TrajectoryFileFormat::readFrameIndex(const char *data,
+                                          size_t size,
+                                          std::vector<size_t> &offsets,
+                                          std::vector<Real> &times)
+{
+    CHEMKIT_UNUSED(data);
+    CHEMKIT_UNUSED(size);
+    CHEMKIT_UNUSED(offsets);
+    CHEMKIT_UNUSED(times);
+
+    setErrorString((boost::format("'%s' random access reading not supported.") % name()).str());
+    return false;
+}
+
+/// Decodes the single frame stored in the \p size bytes at \p data
+/// into \p frame. The frame's trajectory is resized if the frame
+/// contains more atoms than it. Returns \c false if the frame could
+/// not be read.
+///
+/// \see readFrameIndex()
+bool TrajectoryFileFormat::readFrame(const char *data,
+                                     size_t size,
+                                     TrajectoryFrame *frame)
+{
+    CHEMKIT_UNUSED(data);
+    CHEMKIT_UNUSED(size);
+    CHEMKIT_UNUSED(frame);
+
+    setErrorString((boost::format("'%s' random access reading not supported.") % name()).str());
+    return false;
+}
+
 // --- Error Handling ------------------------------------------------------ //
 /// Sets a string describing the last error that occurred.
 void TrajectoryFileFormat::setErrorString(const std::string &errorString)
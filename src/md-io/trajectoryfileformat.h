@@ -52,6 +52,7 @@
 namespace chemkit {
 
 class TrajectoryFile;
+class TrajectoryFrame;
 class TrajectoryFileFormatPrivate;
 
 class CHEMKIT_MD_IO_EXPORT TrajectoryFileFormat
@@ -68,6 +69,10 @@ public:
     virtual bool readMappedFile(const boost::iostreams::mapped_file_source &input, TrajectoryFile *file);
     virtual bool write(const TrajectoryFile *file, std::ostream &output);
 
+    // random access
+    virtual bool readFrameIndex(const char *data, size_t size, std::vector<size_t> &offsets, std::vector<Real> &times);
+    virtual bool readFrame(const char *data, size_t size, TrajectoryFrame *frame);
+
     // error handling
     std::string errorString() const;
 
@@ -0,0 +1,425 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+#include "trajectoryfilereader.h"
+
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <algorithm>
+
+#include <boost/cstdint.hpp>
+#include <boost/format.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+
+#include <chemkit/trajectory.h>
+#include <chemkit/trajectoryframe.h>
+
+#include "trajectoryfileformat.h"
+
+namespace chemkit {
+
+namespace {
+
+// index files begin with this magic string followed by the size
+// and modification time of the trajectory file they were built from
+const char IndexMagic[8] = { 'C', 'K', 'T', 'R', 'J', 'I', 'X', '1' };
+
+} // end anonymous namespace
+
+// === TrajectoryFileReaderPrivate ========================================= //
+class TrajectoryFileReaderPrivate
+{
+public:
+    std::string fileName;
+    std::string indexFileName;
+    TrajectoryFileFormat *format;
+    boost::iostreams::mapped_file_source file;
+    std::vector<size_t> offsets;
+    std::vector<Real> times;
+    std::string errorString;
+};
+
+// === TrajectoryFileReader ================================================ //
+/// \class TrajectoryFileReader trajectoryfilereader.h chemkit/trajectoryfilereader.h
+/// \ingroup chemkit-md-io
+/// \brief The TrajectoryFileReader class provides random access to
+///        the frames in a trajectory file.
+///
+/// Unlike TrajectoryFile, which decodes every frame into memory,
+/// the trajectory file reader memory maps the file and only decodes
+/// the frames that are requested. When a file is opened the reader
+/// locates each frame using the format's
+/// TrajectoryFileFormat::readFrameIndex() method, so seeking to a
+/// frame does not require decoding any of the frames before it.
+///
+/// The frame index is cached in a file next to the trajectory
+/// (see indexFileName()) and is reused as long as the trajectory
+/// file is not modified.
+///
+/// For example, to read the frame closest to 50 picoseconds:
+/// \code
+/// chemkit::TrajectoryFileReader reader("run.xtc");
+/// chemkit::Trajectory trajectory;
+/// chemkit::TrajectoryFrame *frame =
+///     reader.readFrame(reader.frameAtTime(50), &trajectory);
+/// \endcode
+///
+/// The reader can also be used as the frame source for a paged
+/// Trajectory (see Trajectory::setFrameSource()).
+///
+/// \see TrajectoryFile
+
+// --- Construction and Destruction ---------------------------------------- //
+/// Creates a new, empty trajectory file reader.
+TrajectoryFileReader::TrajectoryFileReader()
+    : d(new TrajectoryFileReaderPrivate)
+{
+    d->format = 0;
+}
+
+/// Creates a new trajectory file reader and opens \p fileName.
+TrajectoryFileReader::TrajectoryFileReader(const std::string &fileName)
+    : d(new TrajectoryFileReaderPrivate)
+{
+    d->format = 0;
+
+    open(fileName);
+}
+
+/// Destroys the trajectory file reader.
+TrajectoryFileReader::~TrajectoryFileReader()
+{
+    close();
+
+    delete d;
+}
+
+// --- Properties ---------------------------------------------------------- //
+/// Returns the name of the open file.
+std::string TrajectoryFileReader::fileName() const
+{
+    return d->fileName;
+}
+
+/// Returns the format used to read the open file.
+TrajectoryFileFormat* TrajectoryFileReader::format() const
+{
+    return d->format;
+}
+
+/// Returns the name of the format used to read the open file.
+std::string TrajectoryFileReader::formatName() const
+{
+    if(d->format){
+        return d->format->name();
+    }
+
+    return std::string();
+}
+
+// --- File ---------------------------------------------------------------- //
+/// Opens the file with \p fileName using its suffix as the format.
+/// Returns \c false if the file could not be opened or indexed.
+bool TrajectoryFileReader::open(const std::string &fileName)
+{
+    std::string::size_type dot = fileName.rfind('.');
+    if(dot == std::string::npos){
+        setErrorString("Unable to determine the file format from the file name.");
+        return false;
+    }
+
+    return open(fileName, fileName.substr(dot + 1));
+}
+
+/// Opens the file with \p fileName using \p formatName. Returns
+/// \c false if the file could not be opened or indexed.
+bool TrajectoryFileReader::open(const std::string &fileName, const std::string &formatName)
+{
+    close();
+
+    d->format = TrajectoryFileFormat::create(formatName);
+    if(!d->format){
+        setErrorString((boost::format("Trajectory file format '%s' is not supported.") % formatName).str());
+        return false;
+    }
+
+    try {
+        d->file.open(fileName);
+    }
+    catch(std::exception &){
+        setErrorString((boost::format("Failed to open '%s' for reading.") % fileName).str());
+        close();
+        return false;
+    }
+
+    d->fileName = fileName;
+
+    // use the cached index if it is up to date, otherwise
+    // scan the file and try to cache the new index
+    if(!readIndex()){
+        d->offsets.clear();
+        d->times.clear();
+
+        bool ok = d->format->readFrameIndex(d->file.data(),
+                                            d->file.size(),
+                                            d->offsets,
+                                            d->times);
+        if(!ok || d->offsets.size() != d->times.size()){
+            setErrorString(d->format->errorString());
+            close();
+            return false;
+        }
+
+        writeIndex();
+    }
+
+    return true;
+}
+
+/// Closes the file.
+void TrajectoryFileReader::close()
+{
+    if(d->file.is_open()){
+        d->file.close();
+    }
+
+    delete d->format;
+    d->format = 0;
+
+    d->fileName.clear();
+    d->offsets.clear();
+    d->times.clear();
+}
+
+/// Returns \c true if a file is open.
+bool TrajectoryFileReader::isOpen() const
+{
+    return d->file.is_open();
+}
+
+// --- Index --------------------------------------------------------------- //
+/// Sets the name of the file used to cache the frame index to
+/// \p fileName. Setting an empty file name restores the default.
+///
+/// This must be set before opening the trajectory file.
+void TrajectoryFileReader::setIndexFileName(const std::string &fileName)
+{
+    d->indexFileName = fileName;
+}
+
+/// Returns the name of the file used to cache the frame index. By
+/// default this is the trajectory file name with \c ".ckidx"
+/// appended.
+std::string TrajectoryFileReader::indexFileName() const
+{
+    if(d->indexFileName.empty() && !d->fileName.empty()){
+        return d->fileName + ".ckidx";
+    }
+
+    return d->indexFileName;
+}
+
+// --- Frames -------------------------------------------------------------- //
+/// Returns the number of frames in the file.
+size_t TrajectoryFileReader::frameCount() const
+{
+    return d->offsets.size();
+}
+
+/// Returns the time of the frame at \p index.
+Real TrajectoryFileReader::frameTime(size_t index) const
+{
+    assert(index < d->times.size());
+
+    return d->times[index];
+}
+
+/// Returns the index of the frame whose time is closest to \p time.
+/// Frame times are expected to be in increasing order. Returns
+/// frameCount() if the file contains no frames.
+size_t TrajectoryFileReader::frameAtTime(Real time) const
+{
+    if(d->times.empty()){
+        return 0;
+    }
+
+    std::vector<Real>::const_iterator iter =
+        std::lower_bound(d->times.begin(), d->times.end(), time);
+
+    if(iter == d->times.end()){
+        return d->times.size() - 1;
+    }
+    else if(iter != d->times.begin() && time - *(iter - 1) < *iter - time){
+        --iter;
+    }
+
+    return iter - d->times.begin();
+}
+
+/// Decodes the frame at \p index and adds it to \p trajectory. Only
+/// the data for the requested frame is read from the file. Returns
+/// \c 0 if the frame could not be read.
+TrajectoryFrame* TrajectoryFileReader::readFrame(size_t index, Trajectory *trajectory)
+{
+    TrajectoryFrame *frame = trajectory->addFrame();
+
+    if(!readFrame(index, frame)){
+        trajectory->removeFrame(frame);
+        return 0;
+    }
+
+    return frame;
+}
+
+/// Decodes the frame at \p index into \p frame. Returns \c false
+/// if the frame could not be read.
+bool TrajectoryFileReader::readFrame(size_t index, TrajectoryFrame *frame)
+{
+    if(index >= d->offsets.size()){
+        setErrorString((boost::format("Invalid frame index: %d.") % index).str());
+        return false;
+    }
+
+    size_t begin = d->offsets[index];
+    size_t end = index + 1 < d->offsets.size() ? d->offsets[index + 1] : d->file.size();
+
+    bool ok = d->format->readFrame(d->file.data() + begin, end - begin, frame);
+    if(!ok){
+        setErrorString(d->format->errorString());
+    }
+
+    return ok;
+}
+
+// --- Error Handling ------------------------------------------------------ //
+/// Sets a string describing the last error that occurred.
+void TrajectoryFileReader::setErrorString(const std::string &errorString)
+{
+    d->errorString = errorString;
+}
+
+/// Returns a string describing the last error that occurred.
+std::string TrajectoryFileReader::errorString() const
+{
+    return d->errorString;
+}
+
+// --- Internal Methods ---------------------------------------------------- //
+bool TrajectoryFileReader::readIndex()
+{
+    std::ifstream input(indexFileName().c_str(), std::ios::binary);
+    if(!input.is_open()){
+        return false;
+    }
+
+    char magic[sizeof(IndexMagic)];
+    boost::uint64_t fileSize = 0;
+    boost::int64_t modificationTime = 0;
+    boost::uint64_t frameCount = 0;
+
+    input.read(magic, sizeof(magic));
+    input.read(reinterpret_cast<char *>(&fileSize), sizeof(fileSize));
+    input.read(reinterpret_cast<char *>(&modificationTime), sizeof(modificationTime));
+    input.read(reinterpret_cast<char *>(&frameCount), sizeof(frameCount));
+
+    boost::system::error_code error;
+    std::time_t fileTime = boost::filesystem::last_write_time(d->fileName, error);
+
+    if(!input ||
+       error ||
+       std::memcmp(magic, IndexMagic, sizeof(magic)) != 0 ||
+       fileSize != d->file.size() ||
+       modificationTime != fileTime ||
+       frameCount > d->file.size()){
+        return false;
+    }
+
+    std::vector<boost::uint64_t> offsets(frameCount);
+    std::vector<double> times(frameCount);
+    if(frameCount){
+        input.read(reinterpret_cast<char *>(&offsets[0]), frameCount * sizeof(boost::uint64_t));
+        input.read(reinterpret_cast<char *>(&times[0]), frameCount * sizeof(double));
+    }
+    if(!input){
+        return false;
+    }
+
+    for(size_t i = 0; i < offsets.size(); i++){
+        if(offsets[i] >= fileSize || (i > 0 && offsets[i] <= offsets[i-1])){
+            return false;
+        }
+    }
+
+    d->offsets.assign(offsets.begin(), offsets.end());
+    d->times.assign(times.begin(), times.end());
+
+    return true;
+}
+
+bool TrajectoryFileReader::writeIndex() const
+{
+    boost::system::error_code error;
+    std::time_t fileTime = boost::filesystem::last_write_time(d->fileName, error);
+    if(error){
+        return false;
+    }
+
+    std::ofstream output(indexFileName().c_str(), std::ios::binary);
+    if(!output.is_open()){
+        return false;
+    }
+
+    boost::uint64_t fileSize = d->file.size();
+    boost::int64_t modificationTime = fileTime;
+    boost::uint64_t frameCount = d->offsets.size();
+
+    std::vector<boost::uint64_t> offsets(d->offsets.begin(), d->offsets.end());
+    std::vector<double> times(d->times.begin(), d->times.end());
+
+    output.write(IndexMagic, sizeof(IndexMagic));
+    output.write(reinterpret_cast<const char *>(&fileSize), sizeof(fileSize));
+    output.write(reinterpret_cast<const char *>(&modificationTime), sizeof(modificationTime));
+    output.write(reinterpret_cast<const char *>(&frameCount), sizeof(frameCount));
+    if(frameCount){
+        output.write(reinterpret_cast<const char *>(&offsets[0]), frameCount * sizeof(boost::uint64_t));
+        output.write(reinterpret_cast<const char *>(&times[0]), frameCount * sizeof(double));
+    }
+
+    return output.good();
+}
+
+} // end chemkit namespace
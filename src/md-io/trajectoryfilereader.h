@@ -0,0 +1,96 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+#ifndef CHEMKIT_TRAJECTORYFILEREADER_H
+#define CHEMKIT_TRAJECTORYFILEREADER_H
+
+#include "md-io.h"
+
+#include <string>
+
+#include <chemkit/trajectoryframesource.h>
+
+namespace chemkit {
+
+class Trajectory;
+class TrajectoryFrame;
+class TrajectoryFileFormat;
+class TrajectoryFileReaderPrivate;
+
+class CHEMKIT_MD_IO_EXPORT TrajectoryFileReader : public TrajectoryFrameSource
+{
+public:
+    // construction and destruction
+    TrajectoryFileReader();
+    TrajectoryFileReader(const std::string &fileName);
+    ~TrajectoryFileReader();
+
+    // properties
+    std::string fileName() const;
+    TrajectoryFileFormat* format() const;
+    std::string formatName() const;
+
+    // file
+    bool open(const std::string &fileName);
+    bool open(const std::string &fileName, const std::string &formatName);
+    void close();
+    bool isOpen() const;
+
+    // index
+    void setIndexFileName(const std::string &fileName);
+    std::string indexFileName() const;
+
+    // frames
+    size_t frameCount() const CHEMKIT_OVERRIDE;
+    Real frameTime(size_t index) const;
+    size_t frameAtTime(Real time) const;
+    TrajectoryFrame* readFrame(size_t index, Trajectory *trajectory);
+    bool readFrame(size_t index, TrajectoryFrame *frame) CHEMKIT_OVERRIDE;
+
+    // error handling
+    std::string errorString() const;
+
+private:
+    bool readIndex();
+    bool writeIndex() const;
+    void setErrorString(const std::string &errorString);
+
+private:
+    TrajectoryFileReaderPrivate* const d;
+};
+
+} // end chemkit namespace
+
+#endif // CHEMKIT_TRAJECTORYFILEREADER_H
@@ -0,0 +1,237 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+#include "conjugategradientintegrator.h"
+
+#include <cmath>
+#include <algorithm>
+
+#include <chemkit/cartesiancoordinates.h>
+
+#include "potential.h"
+
+namespace chemkit {
+
+namespace {
+
+Real dot(const std::vector<Vector3> &a, const std::vector<Vector3> &b)
+{
+    Real sum = 0;
+
+    for(size_t i = 0; i < a.size(); i++){
+        sum += a[i].dot(b[i]);
+    }
+
+    return sum;
+}
+
+} // end anonymous namespace
+
+// === ConjugateGradientIntegratorPrivate ================================== //
+class ConjugateGradientIntegratorPrivate
+{
+public:
+    bool started;
+    Real energy;
+    std::vector<Vector3> gradient;
+    std::vector<Vector3> previousGradient;
+    std::vector<Vector3> direction;
+    Real previousStep;
+    Real previousSlope;
+    size_t iterationCount;
+};
+
+// === ConjugateGradientIntegrator ========================================= //
+/// \class ConjugateGradientIntegrator conjugategradientintegrator.h chemkit/conjugategradientintegrator.h
+/// \ingroup chemkit-md
+/// \brief The ConjugateGradientIntegrator class minimizes the energy
+///        using the Polak-Ribiere conjugate gradient algorithm.
+///
+/// Each call to integrate() performs one iteration of the algorithm.
+/// The search direction is restarted along the negative gradient
+/// every 3N iterations or whenever the conjugate direction is not a
+/// descent direction.
+///
+/// \see LbfgsIntegrator, MoleculeGeometryOptimizer
+
+// --- Construction and Destruction ---------------------------------------- //
+/// Creates a new conjugate gradient integrator.
+ConjugateGradientIntegrator::ConjugateGradientIntegrator()
+    : d(new ConjugateGradientIntegratorPrivate)
+{
+    d->started = false;
+    d->energy = 0;
+    d->previousStep = 1;
+    d->previousSlope = 0;
+    d->iterationCount = 0;
+}
+
+/// Destroys the conjugate gradient integrator.
+ConjugateGradientIntegrator::~ConjugateGradientIntegrator()
+{
+    delete d;
+}
+
+// --- Integration --------------------------------------------------------- //
+/// Performs a single conjugate gradient iteration.
+void ConjugateGradientIntegrator::integrate()
+{
+    CartesianCoordinates *coordinates = this->coordinates();
+    boost::shared_ptr<Potential> potential = this->potential();
+
+    if(!potential || !coordinates || coordinates->isEmpty()){
+        return;
+    }
+
+    size_t size = coordinates->size();
+    bool restart = false;
+
+    if(!d->started){
+        d->energy = potential->energy(coordinates);
+        d->gradient = potential->gradient(coordinates);
+        d->direction.resize(size);
+        d->previousSlope = 0;
+        d->iterationCount = 0;
+        d->started = true;
+        restart = true;
+    }
+    else if(d->previousSlope == 0 || d->iterationCount % (3 * size) == 0){
+        restart = true;
+    }
+    else{
+        // polak-ribiere update
+        Real numerator = 0;
+        for(size_t i = 0; i < size; i++){
+            numerator += d->gradient[i].dot(d->gradient[i] - d->previousGradient[i]);
+        }
+
+        Real denominator = dot(d->previousGradient, d->previousGradient);
+        Real beta = denominator > 0 ? std::max(Real(0), numerator / denominator) : 0;
+
+        for(size_t i = 0; i < size; i++){
+            d->direction[i] = -d->gradient[i] + d->direction[i] * beta;
+        }
+
+        if(dot(d->gradient, d->direction) >= 0){
+            restart = true;
+        }
+    }
+
+    if(restart){
+        for(size_t i = 0; i < size; i++){
+            d->direction[i] = -d->gradient[i];
+        }
+    }
+
+    Real slope = dot(d->gradient, d->direction);
+
+    // estimate the initial step from the previous iteration
+    Real step = 1;
+    if(d->previousSlope < 0 && slope < 0){
+        step = d->previousStep * d->previousSlope / slope;
+    }
+
+    // perform line search
+    d->previousGradient.assign(d->gradient.begin(), d->gradient.end());
+
+    bool ok = lineSearch(d->direction, step, d->energy, d->gradient);
+
+    if(!ok && !restart){
+        for(size_t i = 0; i < size; i++){
+            d->direction[i] = -d->gradient[i];
+        }
+
+        slope = dot(d->gradient, d->direction);
+        step = 1;
+        ok = lineSearch(d->direction, step, d->energy, d->gradient);
+    }
+
+    if(ok){
+        // conjugate gradient requires a more accurate line search than
+        // the sufficient decrease condition alone, so refine the step
+        // with the secant method until the slope along the search
+        // direction is small
+        Real previousStep = 0;
+        Real previousSlope = slope;
+
+        for(size_t iteration = 0; iteration < 3; iteration++){
+            Real finalSlope = dot(d->gradient, d->direction);
+            if(std::abs(finalSlope) <= 0.1 * std::abs(slope) || finalSlope == previousSlope){
+                break;
+            }
+
+            Real nextStep = step - finalSlope * (step - previousStep) / (finalSlope - previousSlope);
+            nextStep = std::min(std::max(nextStep, Real(0.1) * step), Real(4.0) * step);
+
+            for(size_t i = 0; i < size; i++){
+                (*coordinates)[i] += d->direction[i] * (nextStep - step);
+            }
+
+            Real energy = potential->energy(coordinates);
+            if(!(energy < d->energy)){
+                for(size_t i = 0; i < size; i++){
+                    (*coordinates)[i] -= d->direction[i] * (nextStep - step);
+                }
+
+                break;
+            }
+
+            previousStep = step;
+            previousSlope = finalSlope;
+            step = nextStep;
+            d->energy = energy;
+            d->gradient = potential->gradient(coordinates);
+        }
+
+        d->previousStep = step;
+        d->previousSlope = slope;
+        d->iterationCount++;
+    }
+    else{
+        d->previousSlope = 0;
+    }
+
+    setCurrentEnergy(d->energy, d->gradient);
+}
+
+/// Restarts the algorithm along the negative gradient.
+void ConjugateGradientIntegrator::reset()
+{
+    Integrator::reset();
+
+    d->started = false;
+}
+
+} // end chemkit namespace
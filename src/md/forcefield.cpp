@@ -35,9 +35,15 @@
 
 #include "forcefield.h"
 
+#include <boost/bind.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/mutex.hpp>
+
 #include <chemkit/foreach.h>
 #include <chemkit/constants.h>
 #include <chemkit/concurrent.h>
+#include <chemkit/threadpool.h>
 #include <chemkit/pluginmanager.h>
 #include <chemkit/cartesiancoordinates.h>
 
@@ -55,9 +61,17 @@ public:
     int flags;
     boost::shared_ptr<Topology> topology;
     std::vector<ForceFieldCalculation *> calculations;
+    std::vector<ForceFieldCalculationBatch *> batches;
+    std::vector<ForceFieldCalculation *> unbatchedCalculations;
+    bool batchesModified;
+    size_t threadCount;
+    boost::scoped_ptr<ThreadPool> threadPool;
+    boost::mutex mutex;
     std::string parameterSet;
     std::string parameterFile;
     std::map<std::string, std::string> parameterSets;
+    Real nonbondedCutoff;
+    Real neighborListSkin;
     std::string errorString;
 };
 
@@ -93,11 +107,17 @@ ForceField::ForceField(const std::string &name)
 {
     d->name = name;
     d->flags = 0;
+    d->nonbondedCutoff = 0;
+    d->neighborListSkin = 2.0;
+    d->batchesModified = false;
+    d->threadCount = 1;
 }
 
 /// Destroys a force field.
 ForceField::~ForceField()
 {
+    removeCalculationBatches();
+
     // delete all calculations
     foreach(ForceFieldCalculation *calculation, d->calculations){
         delete calculation;
@@ -146,16 +166,21 @@ void ForceField::setTopology(const boost::shared_ptr<Topology> &topology)
         delete calculation;
     }
     d->calculations.clear();
+    removeCalculationBatches();
 }
 
 /// Builds a topology for the molecule and sets it with setTopology().
 ///
+/// If a nonbonded cutoff is set the topology will not contain
+/// explicit nonbonded interactions.
+///
 /// \see TopologyBuilder
 void ForceField::setTopologyFromMolecule(const Molecule *molecule)
 {
     TopologyBuilder builder;
     builder.setAtomTyper(name());
     builder.setPartialChargeModel(name());
+    builder.setNonbondedInteractionsEnabled(d->nonbondedCutoff <= 0);
     builder.addMolecule(molecule);
     setTopology(builder.topology());
 }
@@ -233,20 +258,126 @@ std::string ForceField::parameterFile() const
     return d->parameterFile;
 }
 
+// --- Nonbonded Interactions ---------------------------------------------- //
+/// Sets the cutoff distance for nonbonded interactions to \p cutoff.
+///
+/// By default the cutoff is zero and the force field contains a
+/// separate calculation for every nonbonded interaction in the
+/// topology. This requires time and memory proportional to the square
+/// of the number of atoms which is impractical for large systems such
+/// as proteins.
+///
+/// If the cutoff is greater than zero the nonbonded interactions are
+/// instead calculated by a single calculation which only considers
+/// pairs of atoms closer than the cutoff distance. These pairs are
+/// found with a NeighborList which excludes bonded atoms and atoms
+/// bonded to a common atom.
+///
+/// The cutoff must be set before calling setTopologyFromMolecule()
+/// and setup().
+///
+/// \see NeighborList
+void ForceField::setNonbondedCutoff(Real cutoff)
+{
+    d->nonbondedCutoff = cutoff;
+}
+
+/// Returns the cutoff distance for nonbonded interactions. The
+/// default cutoff is zero which disables the cutoff.
+Real ForceField::nonbondedCutoff() const
+{
+    return d->nonbondedCutoff;
+}
+
+/// Sets the skin distance for the nonbonded neighbor list to
+/// \p skin. The default skin distance is 2 Angstroms.
+///
+/// \see NeighborList::setSkin()
+void ForceField::setNeighborListSkin(Real skin)
+{
+    d->neighborListSkin = skin;
+}
+
+/// Returns the skin distance for the nonbonded neighbor list.
+Real ForceField::neighborListSkin() const
+{
+    return d->neighborListSkin;
+}
+
+// --- Threading ----------------------------------------------------------- //
+/// Sets the number of threads used to calculate the energy and
+/// gradient to \p threadCount. If \p threadCount is \c 0 the value
+/// of ThreadPool::idealThreadCount() is used.
+///
+/// By default the force field uses a single thread. When more than
+/// one thread is used the calculations are divided into a fixed
+/// number of slices which are evaluated by a thread pool owned by
+/// the force field. Each slice accumulates its gradient separately
+/// and the slices are summed in order, so the results are identical
+/// from call to call for a given thread count. Results may differ in
+/// the last few bits between different thread counts.
+///
+/// The energy and gradient may be calculated from multiple threads
+/// at once, but the thread count must not be changed while they are
+/// being calculated.
+void ForceField::setThreadCount(size_t threadCount)
+{
+    if(threadCount == 0){
+        threadCount = ThreadPool::idealThreadCount();
+    }
+
+    if(threadCount == d->threadCount){
+        return;
+    }
+
+    d->threadCount = threadCount;
+    d->threadPool.reset();
+}
+
+/// Returns the number of threads used to calculate the energy and
+/// gradient.
+size_t ForceField::threadCount() const
+{
+    return d->threadCount;
+}
+
 // --- Calculations -------------------------------------------------------- //
 void ForceField::addCalculation(ForceFieldCalculation *calculation)
 {
     calculation->setForceField(this);
 
     d->calculations.push_back(calculation);
+    d->unbatchedCalculations.push_back(calculation);
 }
 
 void ForceField::removeCalculation(ForceFieldCalculation *calculation)
 {
     d->calculations.erase(std::remove(d->calculations.begin(), d->calculations.end(), calculation));
+    removeCalculationBatches();
     delete calculation;
 }
 
+/// Adds \p batch to the force field. The force field takes
+/// ownership of the batch.
+///
+/// Each calculation in the batch must have already been added with
+/// addCalculation(). The energy and gradient of calculations in a
+/// batch are evaluated by the batch rather than individually.
+///
+/// Batches are removed when the topology is changed or a calculation
+/// is removed.
+void ForceField::addCalculationBatch(ForceFieldCalculationBatch *batch)
+{
+    d->batches.push_back(batch);
+
+    foreach(const ForceFieldCalculation *calculation, batch->calculations()){
+        d->unbatchedCalculations.erase(std::remove(d->unbatchedCalculations.begin(),
+                                                   d->unbatchedCalculations.end(),
+                                                   calculation),
+                                       d->unbatchedCalculations.end());
+    }
+}
+
 /// Returns a list of all the calculations in the force field.
 std::vector<ForceFieldCalculation *> ForceField::calculations() const
 {
@@ -259,6 +390,14 @@ size_t ForceField::calculationCount() const
     return d->calculations.size();
 }
 
+/// Returns a list of the calculation batches in the force field.
+///
+/// \see ForceFieldCalculationBatch
+std::vector<ForceFieldCalculationBatch *> ForceField::calculationBatches() const
+{
+    return d->batches;
+}
+
 void ForceField::setCalculationSetup(ForceFieldCalculation *calculation, bool setup)
 {
     calculation->setSetup(setup);
@@ -267,10 +406,28 @@ void ForceField::setCalculationSetup(ForceFieldCalculation *calculation, bool se
 /// \copydoc Potential::energy()
 Real ForceField::energy(const CartesianCoordinates *coordinates) const
 {
+    updateCalculationBatches();
+
+    if(d->threadCount < 2){
+        return energySlice(coordinates, 0, 1);
+    }
+
+    ThreadPool *threadPool = this->threadPool();
+    size_t sliceCount = d->threadCount;
+
+    std::vector<boost::shared_future<Real> > energies;
+    for(size_t i = 0; i < sliceCount; i++){
+        energies.push_back(threadPool->run(boost::bind(&ForceField::energySlice,
+                                                       this,
+                                                       coordinates,
+                                                       i,
+                                                       sliceCount)));
+    }
+
     Real energy = 0;
 
-    foreach(const ForceFieldCalculation *calculation, d->calculations){
-        energy += calculation->energy(coordinates);
+    for(size_t i = 0; i < sliceCount; i++){
+        energy += energies[i].get();
     }
 
     return energy;
@@ -279,23 +436,170 @@ Real ForceField::energy(const CartesianCoordinates *coordinates) const
 /// \copydoc Potential::gradient()
 std::vector<Vector3> ForceField::gradient(const CartesianCoordinates *coordinates) const
 {
-    if(d->flags & AnalyticalGradient){
-        std::vector<Vector3> gradient(size());
-        std::fill(gradient.begin(), gradient.end(), Vector3(0, 0, 0));
+    if(!(d->flags & AnalyticalGradient)){
+        return numericalGradient(coordinates);
+    }
 
-        foreach(const ForceFieldCalculation *calculation, d->calculations){
-            std::vector<Vector3> atomGradients = calculation->gradient(coordinates);
+    updateCalculationBatches();
 
-            for(size_t i = 0; i < atomGradients.size(); i++){
-                gradient[calculation->atom(i)] += atomGradients[i];
-            }
-        }
+    std::vector<Vector3> gradient(size());
+    std::fill(gradient.begin(), gradient.end(), Vector3(0, 0, 0));
 
+    if(d->threadCount < 2){
+        gradientSlice(coordinates, &gradient, 0, 1);
         return gradient;
     }
-    else{
-        return numericalGradient(coordinates);
+
+    ThreadPool *threadPool = this->threadPool();
+    size_t sliceCount = d->threadCount;
+
+    // each slice accumulates into its own gradient
+    std::vector<std::vector<Vector3> > threadGradients(sliceCount,
+                                                       std::vector<Vector3>(size(), Vector3(0, 0, 0)));
+
+    std::vector<boost::shared_future<void> > tasks;
+    for(size_t i = 0; i < sliceCount; i++){
+        tasks.push_back(threadPool->run(boost::bind(&ForceField::gradientSlice,
+                                                    this,
+                                                    coordinates,
+                                                    &threadGradients[i],
+                                                    i,
+                                                    sliceCount)));
+    }
+
+    for(size_t i = 0; i < sliceCount; i++){
+        tasks[i].wait();
+    }
+
+    // sum the slice gradients for each range of atoms
+    tasks.clear();
+    for(size_t i = 0; i < sliceCount; i++){
+        tasks.push_back(threadPool->run(boost::bind(&ForceField::reduceGradientSlice,
+                                                    this,
+                                                    &threadGradients,
+                                                    &gradient,
+                                                    i,
+                                                    sliceCount)));
+    }
+
+    for(size_t i = 0; i < sliceCount; i++){
+        tasks[i].wait();
     }
+
+    return gradient;
+}
+
+// --- Internal Methods ---------------------------------------------------- //
+/// Called by a calculation when its atoms or parameters are changed.
+void ForceField::calculationModified()
+{
+    if(!d->batches.empty()){
+        d->batchesModified = true;
+    }
+}
+
+// Updates the calculation batches if any of their calculations were
+// modified. This is done under a lock so that the energy and gradient
+// can be calculated from multiple threads at once.
+void ForceField::updateCalculationBatches() const
+{
+    boost::lock_guard<boost::mutex> lock(d->mutex);
+
+    if(d->batchesModified){
+        foreach(ForceFieldCalculationBatch *batch, d->batches){
+            batch->update();
+        }
+
+        d->batchesModified = false;
+    }
+}
+
+// Returns the thread pool used to calculate the energy and gradient,
+// creating it if necessary.
+ThreadPool* ForceField::threadPool() const
+{
+    boost::lock_guard<boost::mutex> lock(d->mutex);
+
+    if(!d->threadPool){
+        d->threadPool.reset(new ThreadPool(d->threadCount));
+    }
+
+    return d->threadPool.get();
+}
+
+// Returns the energy of the calculations in slice number slice out
+// of sliceCount. Each batch and the list of unbatched calculations
+// are divided into sliceCount contiguous ranges.
+Real ForceField::energySlice(const CartesianCoordinates *coordinates, size_t slice, size_t sliceCount) const
+{
+    Real energy = 0;
+
+    foreach(const ForceFieldCalculationBatch *batch, d->batches){
+        size_t begin = batch->size() * slice / sliceCount;
+        size_t end = batch->size() * (slice + 1) / sliceCount;
+
+        energy += batch->energy(coordinates, begin, end);
+    }
+
+    size_t begin = d->unbatchedCalculations.size() * slice / sliceCount;
+    size_t end = d->unbatchedCalculations.size() * (slice + 1) / sliceCount;
+
+    for(size_t i = begin; i < end; i++){
+        energy += d->unbatchedCalculations[i]->energy(coordinates);
+    }
+
+    return energy;
+}
+
+// Adds the gradient of the calculations in slice number slice out of
+// sliceCount to gradient.
+void ForceField::gradientSlice(const CartesianCoordinates *coordinates, std::vector<Vector3> *gradient, size_t slice, size_t sliceCount) const
+{
+    foreach(const ForceFieldCalculationBatch *batch, d->batches){
+        size_t begin = batch->size() * slice / sliceCount;
+        size_t end = batch->size() * (slice + 1) / sliceCount;
+
+        batch->gradient(coordinates, *gradient, begin, end);
+    }
+
+    size_t begin = d->unbatchedCalculations.size() * slice / sliceCount;
+    size_t end = d->unbatchedCalculations.size() * (slice + 1) / sliceCount;
+
+    for(size_t i = begin; i < end; i++){
+        const ForceFieldCalculation *calculation = d->unbatchedCalculations[i];
+        std::vector<Vector3> atomGradients = calculation->gradient(coordinates);
+
+        for(size_t j = 0; j < atomGradients.size(); j++){
+            (*gradient)[calculation->atom(j)] += atomGradients[j];
+        }
+    }
+}
+
+// Sums the per-thread gradients for the atoms in slice number slice
+// out of sliceCount into gradient.
+void ForceField::reduceGradientSlice(const std::vector<std::vector<Vector3> > *threadGradients, std::vector<Vector3> *gradient, size_t slice, size_t sliceCount) const
+{
+    size_t begin = gradient->size() * slice / sliceCount;
+    size_t end = gradient->size() * (slice + 1) / sliceCount;
+
+    for(size_t i = 0; i < threadGradients->size(); i++){
+        const std::vector<Vector3> &threadGradient = (*threadGradients)[i];
+
+        for(size_t j = begin; j < end; j++){
+            (*gradient)[j] += threadGradient[j];
+        }
+    }
+}
+
+void ForceField::removeCalculationBatches()
+{
+    foreach(ForceFieldCalculationBatch *batch, d->batches){
+        delete batch;
+    }
+    d->batches.clear();
+
+    d->unbatchedCalculations = d->calculations;
+    d->batchesModified = false;
 }
 
 // --- Error Handling ------------------------------------------------------ //
@@ -51,11 +51,13 @@
 
 #include "potential.h"
 #include "forcefieldcalculation.h"
+#include "forcefieldcalculationbatch.h"
 
 namespace chemkit {
 
 class Molecule;
 class Topology;
+class ThreadPool;
 class ForceFieldPrivate;
 class CartesianCoordinates;
 
@@ -89,9 +91,20 @@ public:
     void setParameterFile(const std::string &fileName);
     std::string parameterFile() const;
 
+    // nonbonded interactions
+    void setNonbondedCutoff(Real cutoff);
+    Real nonbondedCutoff() const;
+    void setNeighborListSkin(Real skin);
+    Real neighborListSkin() const;
+
+    // threading
+    void setThreadCount(size_t threadCount);
+    size_t threadCount() const;
+
     // calculations
     std::vector<ForceFieldCalculation *> calculations() const;
     size_t calculationCount() const;
+    std::vector<ForceFieldCalculationBatch *> calculationBatches() const;
     Real energy(const CartesianCoordinates *coordinates) const CHEMKIT_OVERRIDE;
     std::vector<Vector3> gradient(const CartesianCoordinates *coordinates) const CHEMKIT_OVERRIDE;
 
@@ -107,11 +120,23 @@ protected:
     void setFlags(int flags);
     void addCalculation(ForceFieldCalculation *calculation);
     void removeCalculation(ForceFieldCalculation *calculation);
+    void addCalculationBatch(ForceFieldCalculationBatch *batch);
     void setCalculationSetup(ForceFieldCalculation *calculation, bool setup);
     void addParameterSet(const std::string &name, const std::string &fileName);
     void removeParameterSet(const std::string &name);
     void setErrorString(const std::string &errorString);
 
+private:
+    void calculationModified();
+    void removeCalculationBatches();
+    void updateCalculationBatches() const;
+    ThreadPool* threadPool() const;
+    Real energySlice(const CartesianCoordinates *coordinates, size_t slice, size_t sliceCount) const;
+    void gradientSlice(const CartesianCoordinates *coordinates, std::vector<Vector3> *gradient, size_t slice, size_t sliceCount) const;
+    void reduceGradientSlice(const std::vector<std::vector<Vector3> > *threadGradients, std::vector<Vector3> *gradient, size_t slice, size_t sliceCount) const;
+
+    friend class ForceFieldCalculation;
+
 private:
     ForceFieldPrivate* const d;
 };
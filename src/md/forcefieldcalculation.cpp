@@ -108,6 +108,10 @@ boost::shared_ptr<Topology> ForceFieldCalculation::topology() const
 void ForceFieldCalculation::setAtom(size_t index, size_t atom)
 {
     d->atoms[index] = atom;
+
+    if(d->forceField){
+        d->forceField->calculationModified();
+    }
 }
 
 /// Returns the atom at index in the calculation.
@@ -138,6 +142,10 @@ std::string ForceFieldCalculation::atomType(size_t index) const
 void ForceFieldCalculation::setParameter(int index, Real value)
 {
     d->parameters[index] = value;
+
+    if(d->forceField){
+        d->forceField->calculationModified();
+    }
 }
 
 /// Returns the parameter at index.
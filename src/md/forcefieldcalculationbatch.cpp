@@ -0,0 +1,199 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+#include "forcefieldcalculationbatch.h"
+
+#include "forcefieldcalculation.h"
+
+namespace chemkit {
+
+// === ForceFieldCalculationBatchPrivate =================================== //
+class ForceFieldCalculationBatchPrivate
+{
+public:
+    int type;
+    std::vector<const ForceFieldCalculation *> calculations;
+    std::vector<std::vector<size_t> > atoms;
+    std::vector<std::vector<Real> > parameters;
+};
+
+// === ForceFieldCalculationBatch ========================================== //
+/// \class ForceFieldCalculationBatch forcefieldcalculationbatch.h chemkit/forcefieldcalculationbatch.h
+/// \ingroup chemkit-md
+/// \brief The ForceFieldCalculationBatch class evaluates many
+///        calculations of the same kind together.
+///
+/// A batch stores the atoms and parameters of its calculations as a
+/// structure of arrays with one contiguous array for each atom and
+/// each parameter. Subclasses implement energy() and gradient() as
+/// loops over these arrays which avoids a virtual call and a gradient
+/// allocation for every calculation.
+///
+/// Force fields add batches with ForceField::addCalculationBatch().
+/// The calculations in a batch remain part of the force field and can
+/// still be evaluated individually.
+///
+/// \see ForceField, ForceFieldCalculation
+
+// --- Construction and Destruction ---------------------------------------- //
+/// Creates a new, empty batch for calculations of \p type with
+/// \p atomCount atoms and \p parameterCount parameters.
+ForceFieldCalculationBatch::ForceFieldCalculationBatch(int type, size_t atomCount, size_t parameterCount)
+    : d(new ForceFieldCalculationBatchPrivate)
+{
+    d->type = type;
+    d->atoms.resize(atomCount);
+    d->parameters.resize(parameterCount);
+}
+
+/// Destroys the batch.
+ForceFieldCalculationBatch::~ForceFieldCalculationBatch()
+{
+    delete d;
+}
+
+// --- Properties ---------------------------------------------------------- //
+/// Returns the type of the calculations in the batch.
+int ForceFieldCalculationBatch::type() const
+{
+    return d->type;
+}
+
+/// Returns the number of calculations in the batch.
+size_t ForceFieldCalculationBatch::size() const
+{
+    return d->calculations.size();
+}
+
+/// Returns \c true if the batch contains no calculations.
+bool ForceFieldCalculationBatch::isEmpty() const
+{
+    return d->calculations.empty();
+}
+
+/// Returns the number of atoms in each calculation.
+size_t ForceFieldCalculationBatch::atomCount() const
+{
+    return d->atoms.size();
+}
+
+/// Returns the number of parameters in each calculation.
+size_t ForceFieldCalculationBatch::parameterCount() const
+{
+    return d->parameters.size();
+}
+
+// --- Calculations -------------------------------------------------------- //
+/// Adds \p calculation to the batch. The calculation must have the
+/// same number of atoms and parameters as the batch.
+void ForceFieldCalculationBatch::addCalculation(const ForceFieldCalculation *calculation)
+{
+    d->calculations.push_back(calculation);
+
+    for(size_t i = 0; i < d->atoms.size(); i++){
+        d->atoms[i].push_back(calculation->atom(i));
+    }
+
+    for(size_t i = 0; i < d->parameters.size(); i++){
+        d->parameters[i].push_back(calculation->parameter(i));
+    }
+}
+
+/// Returns the calculations in the batch.
+std::vector<const ForceFieldCalculation *> ForceFieldCalculationBatch::calculations() const
+{
+    return d->calculations;
+}
+
+/// Updates the atoms and parameters in the batch from its
+/// calculations.
+void ForceFieldCalculationBatch::update()
+{
+    for(size_t i = 0; i < d->calculations.size(); i++){
+        const ForceFieldCalculation *calculation = d->calculations[i];
+
+        for(size_t j = 0; j < d->atoms.size(); j++){
+            d->atoms[j][i] = calculation->atom(j);
+        }
+
+        for(size_t j = 0; j < d->parameters.size(); j++){
+            d->parameters[j][i] = calculation->parameter(j);
+        }
+    }
+}
+
+// --- Evaluation ---------------------------------------------------------- //
+/// Returns the total energy of the calculations in the batch.
+Real ForceFieldCalculationBatch::energy(const CartesianCoordinates *coordinates) const
+{
+    return energy(coordinates, 0, size());
+}
+
+/// \fn Real ForceFieldCalculationBatch::energy(const CartesianCoordinates *coordinates, size_t begin, size_t end) const
+///
+/// Returns the total energy of the calculations in the range
+/// [\p begin, \p end).
+
+/// Adds the gradient of the energy of each calculation in the batch
+/// to \p gradient which contains an entry for every atom in the
+/// force field.
+void ForceFieldCalculationBatch::gradient(const CartesianCoordinates *coordinates, std::vector<Vector3> &gradient) const
+{
+    this->gradient(coordinates, gradient, 0, size());
+}
+
+/// \fn void ForceFieldCalculationBatch::gradient(const CartesianCoordinates *coordinates, std::vector<Vector3> &gradient, size_t begin, size_t end) const
+///
+/// Adds the gradient of the energy of each calculation in the range
+/// [\p begin, \p end) to \p gradient.
+///
+/// Different ranges of the same batch may be evaluated concurrently
+/// with separate gradient vectors.
+
+// --- Internal Methods ---------------------------------------------------- //
+/// Returns an array containing atom \p index of each calculation.
+const size_t* ForceFieldCalculationBatch::atoms(size_t index) const
+{
+    return d->atoms[index].empty() ? 0 : &d->atoms[index][0];
+}
+
+/// Returns an array containing parameter \p index of each
+/// calculation.
+const Real* ForceFieldCalculationBatch::parameters(size_t index) const
+{
+    return d->parameters[index].empty() ? 0 : &d->parameters[index][0];
+}
+
+} // end chemkit namespace
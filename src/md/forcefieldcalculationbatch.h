@@ -0,0 +1,89 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+#ifndef CHEMKIT_FORCEFIELDCALCULATIONBATCH_H
+#define CHEMKIT_FORCEFIELDCALCULATIONBATCH_H
+
+#include "md.h"
+
+#include <vector>
+
+#include <chemkit/vector3.h>
+
+namespace chemkit {
+
+class CartesianCoordinates;
+class ForceFieldCalculation;
+class ForceFieldCalculationBatchPrivate;
+
+class CHEMKIT_MD_EXPORT ForceFieldCalculationBatch
+{
+public:
+    // construction and destruction
+    virtual ~ForceFieldCalculationBatch();
+
+    // properties
+    int type() const;
+    size_t size() const;
+    bool isEmpty() const;
+    size_t atomCount() const;
+    size_t parameterCount() const;
+
+    // calculations
+    void addCalculation(const ForceFieldCalculation *calculation);
+    std::vector<const ForceFieldCalculation *> calculations() const;
+    void update();
+
+    // evaluation
+    Real energy(const CartesianCoordinates *coordinates) const;
+    virtual Real energy(const CartesianCoordinates *coordinates, size_t begin, size_t end) const = 0;
+    void gradient(const CartesianCoordinates *coordinates, std::vector<Vector3> &gradient) const;
+    virtual void gradient(const CartesianCoordinates *coordinates, std::vector<Vector3> &gradient, size_t begin, size_t end) const = 0;
+
+protected:
+    ForceFieldCalculationBatch(int type, size_t atomCount, size_t parameterCount);
+    const size_t* atoms(size_t index) const;
+    const Real* parameters(size_t index) const;
+
+private:
+    CHEMKIT_DISABLE_COPY(ForceFieldCalculationBatch)
+
+private:
+    ForceFieldCalculationBatchPrivate* const d;
+};
+
+} // end chemkit namespace
+
+#endif // CHEMKIT_FORCEFIELDCALCULATIONBATCH_H
@@ -35,6 +35,10 @@
 
 #include "integrator.h"
 
+#include <algorithm>
+
+#include <boost/math/special_functions/fpclassify.hpp>
+
 #include <chemkit/cartesiancoordinates.h>
 
 #include "potential.h"
@@ -47,18 +51,33 @@ class IntegratorPrivate
 public:
     boost::shared_ptr<Potential> potential;
     CartesianCoordinates coordinates;
+    bool currentEnergyValid;
+    Real currentEnergy;
+    std::vector<Vector3> currentGradient;
+    std::vector<Point3> initialPositions;
 };
 
 // === Integrator ========================================================== //
 /// \class Integrator integrator.h chemkit/integrator.h
 /// \ingroup chemkit-md
 /// \brief The Integrator class represents an integrator.
+///
+/// Integrators which calculate the energy and gradient as part of
+/// each step may store them with setCurrentEnergy(). The energy(),
+/// gradient() and rmsg() methods then return the stored values
+/// rather than evaluating the potential again. The stored values are
+/// discarded by reset(), which is called whenever the potential or
+/// coordinates are set.
+///
+/// \see LbfgsIntegrator, ConjugateGradientIntegrator
 
 // --- Construction and Destruction ---------------------------------------- //
 /// Creates a new integrator.
 Integrator::Integrator()
     : d(new IntegratorPrivate)
 {
+    d->currentEnergyValid = false;
+    d->currentEnergy = 0;
 }
 
 /// Destroys the integrator object.
@@ -72,6 +91,8 @@ Integrator::~Integrator()
 void Integrator::setPotential(const boost::shared_ptr<Potential> &potential)
 {
     d->potential = potential;
+
+    reset();
 }
 
 /// Returns the potential for the integrator.
@@ -85,9 +106,14 @@ boost::shared_ptr<Potential> Integrator::potential() const
 void Integrator::setCoordinates(const CartesianCoordinates *coordinates)
 {
     d->coordinates = *coordinates;
+
+    reset();
 }
 
 /// Returns the current coordinates.
+///
+/// If the coordinates are modified directly reset() must be called
+/// before the next integration step.
 CartesianCoordinates* Integrator::coordinates() const
 {
     return &d->coordinates;
@@ -100,6 +126,9 @@ Real Integrator::energy() const
     if(!d->potential){
         return 0;
     }
+    else if(d->currentEnergyValid){
+        return d->currentEnergy;
+    }
 
     return d->potential->energy(&d->coordinates);
 }
@@ -110,6 +139,9 @@ std::vector<Vector3> Integrator::gradient() const
     if(!d->potential){
         return std::vector<Vector3>();
     }
+    else if(d->currentEnergyValid){
+        return d->currentGradient;
+    }
 
     return d->potential->gradient(&d->coordinates);
 }
@@ -120,6 +152,19 @@ Real Integrator::rmsg() const
     if(!d->potential){
         return 0;
     }
+    else if(d->currentEnergyValid){
+        if(d->currentGradient.empty()){
+            return 0;
+        }
+
+        Real sum = 0;
+
+        for(size_t i = 0; i < d->currentGradient.size(); i++){
+            sum += d->currentGradient[i].squaredNorm();
+        }
+
+        return sqrt(sum / (3.0 * d->currentGradient.size()));
+    }
 
     return d->potential->rmsg(&d->coordinates);
 }
@@ -130,4 +175,105 @@ void Integrator::integrate()
 {
 }
 
+/// Resets any state kept between integration steps.
+void Integrator::reset()
+{
+    d->currentEnergyValid = false;
+}
+
+/// Stores the \p energy and \p gradient for the current coordinates.
+void Integrator::setCurrentEnergy(Real energy, const std::vector<Vector3> &gradient)
+{
+    d->currentEnergy = energy;
+    d->currentGradient.assign(gradient.begin(), gradient.end());
+    d->currentEnergyValid = true;
+}
+
+/// Moves the coordinates along \p direction until the energy is
+/// sufficiently decreased. This is used by the minimization
+/// integrators.
+///
+/// On entry \p energy and \p gradient must contain the energy and
+/// gradient for the current coordinates and \p step the initial
+/// step length. The step is shortened so that no atom moves further
+/// than 0.5 Angstroms and then reduced until the Armijo condition is
+/// satisfied.
+///
+/// Returns \c true if a step was taken, in which case \p step,
+/// \p energy and \p gradient are updated for the new coordinates.
+/// Returns \c false if \p direction is not a descent direction or
+/// no acceptable step was found, in which case the coordinates are
+/// left unchanged.
+bool Integrator::lineSearch(const std::vector<Vector3> &direction, Real &step, Real &energy, std::vector<Vector3> &gradient)
+{
+    // line search parameters
+    const Real maximumDisplacement = 0.5;
+    const Real sufficientDecrease = 1e-4;
+    const Real minimumStep = 1e-10;
+    const size_t maximumTrialCount = 20;
+
+    if(!d->potential){
+        return false;
+    }
+
+    CartesianCoordinates *coordinates = &d->coordinates;
+    size_t size = coordinates->size();
+
+    // directional derivative
+    Real slope = 0;
+    Real largestDisplacement = 0;
+    for(size_t i = 0; i < size; i++){
+        slope += gradient[i].dot(direction[i]);
+        largestDisplacement = std::max(largestDisplacement, direction[i].norm());
+    }
+
+    if(slope >= 0 || largestDisplacement == 0){
+        return false;
+    }
+
+    if(step * largestDisplacement > maximumDisplacement){
+        step = maximumDisplacement / largestDisplacement;
+    }
+
+    // save the initial positions
+    d->initialPositions.resize(size);
+    for(size_t i = 0; i < size; i++){
+        d->initialPositions[i] = (*coordinates)[i];
+    }
+
+    for(size_t trial = 0; trial < maximumTrialCount && step > minimumStep; trial++){
+        for(size_t i = 0; i < size; i++){
+            (*coordinates)[i] = d->initialPositions[i] + direction[i] * step;
+        }
+
+        Real trialEnergy = d->potential->energy(coordinates);
+
+        if((boost::math::isfinite)(trialEnergy) &&
+           trialEnergy <= energy + sufficientDecrease * step * slope){
+            energy = trialEnergy;
+            gradient = d->potential->gradient(coordinates);
+            return true;
+        }
+
+        // choose the next step by minimizing a quadratic fitted to the
+        // initial energy, the initial slope and the trial energy
+        Real nextStep = 0.5 * step;
+        if((boost::math::isfinite)(trialEnergy)){
+            Real curvature = trialEnergy - energy - slope * step;
+            if(curvature > 0){
+                nextStep = -slope * step * step / (2.0 * curvature);
+            }
+        }
+
+        step = std::min(std::max(nextStep, 0.1 * step), 0.5 * step);
+    }
+
+    // restore the initial positions
+    for(size_t i = 0; i < size; i++){
+        (*coordinates)[i] = d->initialPositions[i];
+    }
+
+    return false;
+}
+
 } // end chemkit namespace
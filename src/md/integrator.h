@@ -74,6 +74,11 @@ public:
 
     // integration
     virtual void integrate() = 0;
+    virtual void reset();
+
+protected:
+    void setCurrentEnergy(Real energy, const std::vector<Vector3> &gradient);
+    bool lineSearch(const std::vector<Vector3> &direction, Real &step, Real &energy, std::vector<Vector3> &gradient);
 
 private:
     IntegratorPrivate* const d;
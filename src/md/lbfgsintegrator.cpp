@@ -0,0 +1,243 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+#include "lbfgsintegrator.h"
+
+#include <chemkit/cartesiancoordinates.h>
+
+#include "potential.h"
+
+namespace chemkit {
+
+namespace {
+
+Real dot(const std::vector<Vector3> &a, const std::vector<Vector3> &b)
+{
+    Real sum = 0;
+
+    for(size_t i = 0; i < a.size(); i++){
+        sum += a[i].dot(b[i]);
+    }
+
+    return sum;
+}
+
+} // end anonymous namespace
+
+// === LbfgsIntegratorPrivate ============================================== //
+class LbfgsIntegratorPrivate
+{
+public:
+    size_t historySize;
+    bool started;
+    Real energy;
+    std::vector<Vector3> gradient;
+    std::vector<Vector3> previousGradient;
+    std::vector<Vector3> direction;
+    std::vector<std::vector<Vector3> > s;
+    std::vector<std::vector<Vector3> > y;
+    std::vector<Real> rho;
+    std::vector<Real> alpha;
+    size_t historyCount;
+    size_t historyNext;
+};
+
+// === LbfgsIntegrator ===================================================== //
+/// \class LbfgsIntegrator lbfgsintegrator.h chemkit/lbfgsintegrator.h
+/// \ingroup chemkit-md
+/// \brief The LbfgsIntegrator class minimizes the energy using the
+///        limited-memory BFGS algorithm.
+///
+/// Each call to integrate() performs one iteration of the algorithm.
+/// The search direction is calculated from the gradient and the
+/// changes in position and gradient over the previous historySize()
+/// iterations, which approximates the inverse hessian without storing
+/// it. A backtracking line search is then performed along the search
+/// direction.
+///
+/// Each iteration usually requires a single energy and gradient
+/// evaluation. The buffers used for the search direction and history
+/// are reused between iterations.
+///
+/// \see ConjugateGradientIntegrator, MoleculeGeometryOptimizer
+
+// --- Construction and Destruction ---------------------------------------- //
+/// Creates a new L-BFGS integrator.
+LbfgsIntegrator::LbfgsIntegrator()
+    : d(new LbfgsIntegratorPrivate)
+{
+    d->historySize = 8;
+    d->started = false;
+    d->energy = 0;
+    d->historyCount = 0;
+    d->historyNext = 0;
+}
+
+/// Destroys the L-BFGS integrator.
+LbfgsIntegrator::~LbfgsIntegrator()
+{
+    delete d;
+}
+
+// --- Properties ---------------------------------------------------------- //
+/// Sets the number of previous iterations used to approximate the
+/// inverse hessian to \p size. The default size is \c 8.
+void LbfgsIntegrator::setHistorySize(size_t size)
+{
+    d->historySize = std::max(size, size_t(1));
+
+    reset();
+}
+
+/// Returns the number of previous iterations used to approximate the
+/// inverse hessian.
+size_t LbfgsIntegrator::historySize() const
+{
+    return d->historySize;
+}
+
+// --- Integration --------------------------------------------------------- //
+/// Performs a single L-BFGS iteration.
+void LbfgsIntegrator::integrate()
+{
+    CartesianCoordinates *coordinates = this->coordinates();
+    boost::shared_ptr<Potential> potential = this->potential();
+
+    if(!potential || !coordinates || coordinates->isEmpty()){
+        return;
+    }
+
+    size_t size = coordinates->size();
+
+    if(!d->started){
+        d->energy = potential->energy(coordinates);
+        d->gradient = potential->gradient(coordinates);
+        d->s.resize(d->historySize);
+        d->y.resize(d->historySize);
+        d->rho.resize(d->historySize);
+        d->alpha.resize(d->historySize);
+        d->historyCount = 0;
+        d->historyNext = 0;
+        d->started = true;
+    }
+
+    // calculate the search direction with the two-loop recursion
+    d->direction.assign(d->gradient.begin(), d->gradient.end());
+
+    for(size_t k = 0; k < d->historyCount; k++){
+        size_t index = (d->historyNext + d->historySize - 1 - k) % d->historySize;
+
+        d->alpha[index] = d->rho[index] * dot(d->s[index], d->direction);
+
+        for(size_t i = 0; i < size; i++){
+            d->direction[i] -= d->y[index][i] * d->alpha[index];
+        }
+    }
+
+    if(d->historyCount > 0){
+        size_t newest = (d->historyNext + d->historySize - 1) % d->historySize;
+        Real gamma = dot(d->s[newest], d->y[newest]) / dot(d->y[newest], d->y[newest]);
+
+        for(size_t i = 0; i < size; i++){
+            d->direction[i] *= gamma;
+        }
+    }
+
+    for(size_t k = d->historyCount; k > 0; k--){
+        size_t index = (d->historyNext + d->historySize - k) % d->historySize;
+
+        Real beta = d->rho[index] * dot(d->y[index], d->direction);
+
+        for(size_t i = 0; i < size; i++){
+            d->direction[i] += d->s[index][i] * (d->alpha[index] - beta);
+        }
+    }
+
+    for(size_t i = 0; i < size; i++){
+        d->direction[i] = -d->direction[i];
+    }
+
+    // perform line search
+    d->previousGradient.assign(d->gradient.begin(), d->gradient.end());
+
+    Real step = 1;
+    bool ok = lineSearch(d->direction, step, d->energy, d->gradient);
+
+    if(!ok && d->historyCount > 0){
+        // discard the history and try the steepest descent direction
+        d->historyCount = 0;
+
+        for(size_t i = 0; i < size; i++){
+            d->direction[i] = -d->gradient[i];
+        }
+
+        step = 1;
+        ok = lineSearch(d->direction, step, d->energy, d->gradient);
+    }
+
+    if(ok){
+        // update history
+        std::vector<Vector3> &s = d->s[d->historyNext];
+        std::vector<Vector3> &y = d->y[d->historyNext];
+        s.resize(size);
+        y.resize(size);
+
+        for(size_t i = 0; i < size; i++){
+            s[i] = d->direction[i] * step;
+            y[i] = d->gradient[i] - d->previousGradient[i];
+        }
+
+        Real sy = dot(s, y);
+        if(sy > 1e-10){
+            d->rho[d->historyNext] = 1.0 / sy;
+            d->historyNext = (d->historyNext + 1) % d->historySize;
+            d->historyCount = std::min(d->historyCount + 1, d->historySize);
+        }
+    }
+
+    setCurrentEnergy(d->energy, d->gradient);
+}
+
+/// Discards the history of previous iterations.
+void LbfgsIntegrator::reset()
+{
+    Integrator::reset();
+
+    d->started = false;
+    d->historyCount = 0;
+    d->historyNext = 0;
+}
+
+} // end chemkit namespace
@@ -36,7 +36,6 @@
 #include "moleculegeometryoptimizer.h"
 
 #include <boost/make_shared.hpp>
-#include <boost/math/special_functions/fpclassify.hpp>
 
 #include <chemkit/atom.h>
 #include <chemkit/molecule.h>
@@ -45,94 +44,12 @@
 
 #include "forcefield.h"
 #include "integrator.h"
+#include "lbfgsintegrator.h"
+#include "steepestdescentintegrator.h"
+#include "conjugategradientintegrator.h"
 
 namespace chemkit {
 
-namespace {
-
-class SteepestDescentIntegrator : public Integrator
-{
-public:
-    void integrate() CHEMKIT_OVERRIDE;
-};
-
-void SteepestDescentIntegrator::integrate()
-{
-    CartesianCoordinates *coordinates = this->coordinates();
-    boost::shared_ptr<Potential> potential = this->potential();
-
-    if(!potential || !coordinates){
-        return;
-    }
-
-    // optimization parameters
-    Real step = 0.05;
-    Real stepConv = 1e-5;
-    size_t stepCount = 10;
-
-    // calculate initial energy and gradient
-    Real initialEnergy = potential->energy(coordinates);
-    std::vector<Vector3> gradient = potential->gradient(coordinates);
-
-    // perform line search
-    for(size_t i = 0; i < stepCount; i++){
-        // save initial coordinates
-        CartesianCoordinates initialCoordinates = *coordinates;
-
-        // move each atom against its gradient
-        for(size_t atomIndex = 0; atomIndex < potential->size(); atomIndex++){
-            (*coordinates)[atomIndex] += -gradient[atomIndex] * step;
-        }
-
-        // calculate new energy
-        Real finalEnergy = potential->energy(coordinates);
-
-        // if the final energy is NaN then most likely the
-        // simulation exploded so we reset the initial atom
-        // positions and then 'wiggle' each atom by one
-        // Angstrom in a random direction
-        if((boost::math::isnan)(finalEnergy)){
-            for(size_t atomIndex = 0; atomIndex < potential->size(); atomIndex++){
-                Point3 position = initialCoordinates.position(atomIndex);
-                position += Vector3::Random().normalized();
-                coordinates->setPosition(atomIndex, position);
-            }
-
-            // recalculate gradient
-            gradient = potential->gradient(coordinates);
-
-            // continue to next step
-            continue;
-        }
-
-        if(finalEnergy < initialEnergy && std::abs(finalEnergy - initialEnergy) < stepConv){
-            break;
-        }
-        else if(finalEnergy < initialEnergy){
-            // we reduced the energy, so set a bigger step size
-            step *= 2;
-
-            // maximum step size is 1
-            if(step > 1){
-                step = 1;
-            }
-
-            // the initial energy for the next step
-            // is the final energy of this step
-            initialEnergy = finalEnergy;
-        }
-        else if(finalEnergy > initialEnergy){
-            // we went too far, so reset initial atom positions
-            *coordinates = initialCoordinates;
-
-            // and reduce step size
-            step *= 0.1;
-        }
-    }
-}
-
-} // end anonymous namespace
-
 // === MoleculeGeometryOptimizerPrivate ==================================== //
 class MoleculeGeometryOptimizerPrivate
 {
@@ -142,6 +59,10 @@ public:
     std::string forceFieldName;
     std::string errorString;
     boost::shared_ptr<Integrator> integrator;
+    MoleculeGeometryOptimizer::Algorithm algorithm;
+    Real gradientTolerance;
+    Real energyTolerance;
+    Real energyChange;
 };
 
 // === MoleculeGeometryOptimizer =========================================== //
@@ -154,7 +75,8 @@ public:
 /// to simplify the process of setting up a force field and
 /// performing an energy minimization run for a single molecule.
 ///
-/// By default the UFF force field is used.
+/// By default the UFF force field and the steepest descent algorithm
+/// are used.
 ///
 /// The easiest way to optimize the geometry for a molecule is to
 /// use the optimizeCoordinate() static method as follows:
@@ -187,6 +109,10 @@ MoleculeGeometryOptimizer::MoleculeGeometryOptimizer(Molecule *molecule)
     d->molecule = molecule;
     d->forceFieldName = "uff";
     d->integrator = boost::make_shared<SteepestDescentIntegrator>();
+    d->algorithm = SteepestDescent;
+    d->gradientTolerance = 0.1;
+    d->energyTolerance = 0;
+    d->energyChange = -1;
 }
 
 /// Destroys the geometry optmizer object.
@@ -228,6 +154,77 @@ std::string MoleculeGeometryOptimizer::forceField() const
     return d->forceFieldName;
 }
 
+/// Sets the minimization algorithm to \p algorithm.
+///
+/// The following algorithms are supported:
+///     - \c SteepestDescent
+///     - \c ConjugateGradient (Polak-Ribiere conjugate gradient)
+///     - \c Lbfgs (limited-memory BFGS)
+///
+/// The conjugate gradient and L-BFGS algorithms usually require far
+/// fewer energy and gradient evaluations to converge than steepest
+/// descent.
+///
+/// The algorithm must be set before calling setup().
+///
+/// \see SteepestDescentIntegrator, ConjugateGradientIntegrator,
+///      LbfgsIntegrator
+void MoleculeGeometryOptimizer::setAlgorithm(Algorithm algorithm)
+{
+    if(algorithm == d->algorithm){
+        return;
+    }
+
+    switch(algorithm){
+        case ConjugateGradient:
+            d->integrator = boost::make_shared<ConjugateGradientIntegrator>();
+            break;
+        case Lbfgs:
+            d->integrator = boost::make_shared<LbfgsIntegrator>();
+            break;
+        default:
+            d->integrator = boost::make_shared<SteepestDescentIntegrator>();
+            break;
+    }
+
+    d->algorithm = algorithm;
+    d->forceField.reset();
+}
+
+/// Returns the minimization algorithm.
+MoleculeGeometryOptimizer::Algorithm MoleculeGeometryOptimizer::algorithm() const
+{
+    return d->algorithm;
+}
+
+/// Sets the root-mean-square gradient below which the optimization
+/// is considered converged to \p tolerance. The default tolerance
+/// is \c 0.1.
+void MoleculeGeometryOptimizer::setGradientTolerance(Real tolerance)
+{
+    d->gradientTolerance = tolerance;
+}
+
+/// Returns the root-mean-square gradient tolerance.
+Real MoleculeGeometryOptimizer::gradientTolerance() const
+{
+    return d->gradientTolerance;
+}
+
+/// Sets the change in energy between steps below which the
+/// optimization is considered converged to \p tolerance. The
+/// default tolerance is \c 0 which disables the energy criterion.
+void MoleculeGeometryOptimizer::setEnergyTolerance(Real tolerance)
+{
+    d->energyTolerance = tolerance;
+}
+
+/// Returns the energy change tolerance.
+Real MoleculeGeometryOptimizer::energyTolerance() const
+{
+    return d->energyTolerance;
+}
+
 // --- Energy -------------------------------------------------------------- //
 /// Returns the current energy of the force field.
 Real MoleculeGeometryOptimizer::energy() const
@@ -256,6 +253,7 @@ bool MoleculeGeometryOptimizer::setup()
 
     d->integrator->setPotential(d->forceField);
     d->integrator->setCoordinates(d->molecule->coordinates());
+    d->energyChange = -1;
 
     d->forceField->setTopologyFromMolecule(d->molecule);
     if(!d->forceField->setup()){
@@ -276,12 +274,21 @@ void MoleculeGeometryOptimizer::step()
     }
 
     // perform a single integration step
-    d->integrator->integrate();
+    if(d->energyTolerance > 0){
+        Real initialEnergy = d->integrator->energy();
+        d->integrator->integrate();
+        d->energyChange = std::abs(d->integrator->energy() - initialEnergy);
+    }
+    else{
+        d->integrator->integrate();
+    }
 }
 
-/// Returns \c true if the optimization algorithm has converged. By
-/// default, the algorithm is considered converged when the
-/// root-mean-square gradient of the force field falls below \c 0.1.
+/// Returns \c true if the optimization algorithm has converged. The
+/// algorithm is considered converged when the root-mean-square
+/// gradient of the force field falls below gradientTolerance() or,
+/// if an energy tolerance is set, when the energy changes by less
+/// than energyTolerance() in a single step.
 bool MoleculeGeometryOptimizer::converged()
 {
     if(!d->forceField){
@@ -289,7 +296,13 @@ bool MoleculeGeometryOptimizer::converged()
     }
 
     // check for convergance
-    return d->integrator->rmsg() < 0.1;
+    if(d->energyTolerance > 0 &&
+       d->energyChange >= 0 &&
+       d->energyChange < d->energyTolerance){
+        return true;
+    }
+
+    return d->integrator->rmsg() < d->gradientTolerance;
 }
 
 /// Optimizes the geometry of the molecule. Returns \c true if the
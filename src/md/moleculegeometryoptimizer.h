@@ -52,6 +52,13 @@ class MoleculeGeometryOptimizerPrivate;
 class CHEMKIT_MD_EXPORT MoleculeGeometryOptimizer
 {
 public:
+    // enumerations
+    enum Algorithm {
+        SteepestDescent,
+        ConjugateGradient,
+        Lbfgs
+    };
+
     // construction and destruction
     MoleculeGeometryOptimizer(Molecule *molecule = 0);
     ~MoleculeGeometryOptimizer();
@@ -61,6 +68,12 @@ public:
     Molecule* molecule() const;
     bool setForceField(const std::string &forceField);
     std::string forceField() const;
+    void setAlgorithm(Algorithm algorithm);
+    Algorithm algorithm() const;
+    void setGradientTolerance(Real tolerance);
+    Real gradientTolerance() const;
+    void setEnergyTolerance(Real tolerance);
+    Real energyTolerance() const;
 
     // energy
     Real energy() const;
@@ -0,0 +1,385 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+#include "neighborlist.h"
+
+#include <cmath>
+#include <algorithm>
+
+#include <chemkit/foreach.h>
+#include <chemkit/cartesiancoordinates.h>
+
+#include "topology.h"
+
+namespace chemkit {
+
+// === NeighborListPrivate ================================================= //
+class NeighborListPrivate
+{
+public:
+    size_t size;
+    Real cutoff;
+    Real skin;
+    std::vector<std::vector<size_t> > exclusions;
+    std::vector<NeighborList::Pair> pairs;
+    std::vector<Point3> referencePositions;
+    bool valid;
+    size_t rebuildCount;
+};
+
+// === NeighborList ======================================================== //
+/// \class NeighborList neighborlist.h chemkit/neighborlist.h
+/// \ingroup chemkit-md
+/// \brief The NeighborList class contains a list of atom pairs
+///        within a cutoff distance.
+///
+/// The neighbor list is a Verlet list containing every pair of atoms
+/// within the cutoff distance plus a skin distance. The list is built
+/// using a cell list in O(N) time and only needs to be rebuilt once an
+/// atom has moved more than half of the skin distance since the list
+/// was last built. Calling update() before each use of the pairs will
+/// rebuild the list only when it is necessary.
+///
+/// Because the list includes pairs up to the cutoff plus the skin
+/// distance users of the pairs must check the distance between the
+/// atoms of each pair against the cutoff themselves.
+///
+/// If the cutoff is zero the list contains every pair of atoms and is
+/// never rebuilt.
+///
+/// Pairs of atoms can be excluded from the list with addExclusion().
+///
+/// \see ForceField::setNonbondedCutoff()
+
+// --- Construction and Destruction ---------------------------------------- //
+/// Creates a new, empty neighbor list.
+NeighborList::NeighborList()
+    : d(new NeighborListPrivate)
+{
+    d->size = 0;
+    d->cutoff = 0;
+    d->skin = 0;
+    d->valid = false;
+    d->rebuildCount = 0;
+}
+
+/// Creates a new neighbor list for \p size atoms with \p cutoff and
+/// \p skin.
+NeighborList::NeighborList(size_t size, Real cutoff, Real skin)
+    : d(new NeighborListPrivate)
+{
+    d->size = size;
+    d->cutoff = cutoff;
+    d->skin = skin;
+    d->exclusions.resize(size);
+    d->valid = false;
+    d->rebuildCount = 0;
+}
+
+/// Destroys the neighbor list.
+NeighborList::~NeighborList()
+{
+    delete d;
+}
+
+// --- Properties ---------------------------------------------------------- //
+/// Sets the number of atoms to \p size.
+void NeighborList::resize(size_t size)
+{
+    d->size = size;
+    d->exclusions.resize(size);
+    d->valid = false;
+}
+
+/// Returns the number of atoms.
+size_t NeighborList::size() const
+{
+    return d->size;
+}
+
+/// Sets the cutoff distance to \p cutoff.
+void NeighborList::setCutoff(Real cutoff)
+{
+    d->cutoff = cutoff;
+    d->valid = false;
+}
+
+/// Returns the cutoff distance.
+Real NeighborList::cutoff() const
+{
+    return d->cutoff;
+}
+
+/// Sets the skin distance to \p skin. Larger skin distances make the
+/// list larger but require it to be rebuilt less often.
+void NeighborList::setSkin(Real skin)
+{
+    d->skin = skin;
+    d->valid = false;
+}
+
+/// Returns the skin distance.
+Real NeighborList::skin() const
+{
+    return d->skin;
+}
+
+// --- Exclusions ---------------------------------------------------------- //
+/// Excludes the pair of atoms \p i and \p j from the list.
+void NeighborList::addExclusion(size_t i, size_t j)
+{
+    if(i == j || i >= d->size || j >= d->size){
+        return;
+    }
+
+    std::vector<size_t> &exclusionsI = d->exclusions[i];
+    std::vector<size_t>::iterator iter = std::lower_bound(exclusionsI.begin(), exclusionsI.end(), j);
+    if(iter != exclusionsI.end() && *iter == j){
+        return;
+    }
+    exclusionsI.insert(iter, j);
+
+    std::vector<size_t> &exclusionsJ = d->exclusions[j];
+    exclusionsJ.insert(std::lower_bound(exclusionsJ.begin(), exclusionsJ.end(), i), i);
+
+    d->valid = false;
+}
+
+/// Excludes each pair of atoms in a bonded interaction and the two
+/// outer atoms of each angle interaction in \p topology.
+///
+/// This excludes the same pairs of atoms as the nonbonded
+/// interactions created by TopologyBuilder.
+void NeighborList::addExclusions(const Topology *topology)
+{
+    foreach(const Topology::BondedInteraction &interaction, topology->bondedInteractions()){
+        addExclusion(interaction[0], interaction[1]);
+    }
+
+    foreach(const Topology::AngleInteraction &interaction, topology->angleInteractions()){
+        addExclusion(interaction[0], interaction[2]);
+    }
+}
+
+/// Returns \c true if the pair of atoms \p i and \p j is excluded.
+bool NeighborList::isExcluded(size_t i, size_t j) const
+{
+    if(i >= d->size){
+        return false;
+    }
+
+    const std::vector<size_t> &exclusions = d->exclusions[i];
+
+    return std::binary_search(exclusions.begin(), exclusions.end(), j);
+}
+
+/// Removes all of the exclusions.
+void NeighborList::clearExclusions()
+{
+    d->exclusions.clear();
+    d->exclusions.resize(d->size);
+    d->valid = false;
+}
+
+// --- Pairs --------------------------------------------------------------- //
+/// Returns a range containing the pairs in the list. Within each pair
+/// the first atom index is less than the second and the pairs are
+/// sorted.
+NeighborList::PairRange NeighborList::pairs() const
+{
+    return boost::make_iterator_range(d->pairs.begin(), d->pairs.end());
+}
+
+/// Returns the number of pairs in the list.
+size_t NeighborList::pairCount() const
+{
+    return d->pairs.size();
+}
+
+/// Rebuilds the list from \p coordinates if needed. Returns \c true
+/// if the list was rebuilt.
+///
+/// \see needsRebuild()
+bool NeighborList::update(const CartesianCoordinates *coordinates)
+{
+    if(!needsRebuild(coordinates)){
+        return false;
+    }
+
+    rebuild(coordinates);
+    return true;
+}
+
+/// Rebuilds the list from \p coordinates.
+void NeighborList::rebuild(const CartesianCoordinates *coordinates)
+{
+    const size_t size = std::min(d->size, coordinates->size());
+
+    d->pairs.clear();
+
+    if(d->cutoff <= 0){
+        for(size_t i = 0; i < size; i++){
+            for(size_t j = i + 1; j < size; j++){
+                if(!isExcluded(i, j)){
+                    Pair pair = {{ i, j }};
+                    d->pairs.push_back(pair);
+                }
+            }
+        }
+    }
+    else if(size > 0){
+        const Real listCutoff = d->cutoff + d->skin;
+        const Real listCutoffSquared = listCutoff * listCutoff;
+
+        // find bounding box
+        Point3 min = (*coordinates)[0];
+        Point3 max = min;
+        for(size_t i = 1; i < size; i++){
+            const Point3 &position = (*coordinates)[i];
+
+            for(int k = 0; k < 3; k++){
+                min[k] = std::min(min[k], position[k]);
+                max[k] = std::max(max[k], position[k]);
+            }
+        }
+
+        // divide the bounding box into cells at least as large as the
+        // list cutoff. the cell size is increased for sparse systems
+        // to limit the number of empty cells
+        Real cellSize = listCutoff;
+        boost::array<size_t, 3> dimensions;
+        for(;;){
+            Real cellCount = 1;
+            for(int k = 0; k < 3; k++){
+                dimensions[k] = static_cast<size_t>((max[k] - min[k]) / cellSize) + 1;
+                cellCount *= dimensions[k];
+            }
+
+            if(cellCount <= 8 * size + 27){
+                break;
+            }
+
+            cellSize *= 2;
+        }
+
+        // place each atom in a cell. each cell is a linked list of
+        // the atoms it contains in increasing order
+        const size_t npos = static_cast<size_t>(-1);
+        std::vector<size_t> head(dimensions[0] * dimensions[1] * dimensions[2], npos);
+        std::vector<size_t> next(size, npos);
+        std::vector<boost::array<size_t, 3> > cells(size);
+
+        for(size_t i = size; i > 0; i--){
+            const Point3 &position = (*coordinates)[i - 1];
+            boost::array<size_t, 3> &cell = cells[i - 1];
+
+            for(int k = 0; k < 3; k++){
+                cell[k] = std::min(static_cast<size_t>((position[k] - min[k]) / cellSize), dimensions[k] - 1);
+            }
+
+            size_t index = (cell[2] * dimensions[1] + cell[1]) * dimensions[0] + cell[0];
+            next[i - 1] = head[index];
+            head[index] = i - 1;
+        }
+
+        // check each atom against the atoms in its own and the
+        // surrounding cells
+        for(size_t i = 0; i < size; i++){
+            const Point3 &position = (*coordinates)[i];
+            const boost::array<size_t, 3> &cell = cells[i];
+
+            for(size_t z = cell[2] > 0 ? cell[2] - 1 : 0; z <= std::min(cell[2] + 1, dimensions[2] - 1); z++){
+                for(size_t y = cell[1] > 0 ? cell[1] - 1 : 0; y <= std::min(cell[1] + 1, dimensions[1] - 1); y++){
+                    for(size_t x = cell[0] > 0 ? cell[0] - 1 : 0; x <= std::min(cell[0] + 1, dimensions[0] - 1); x++){
+                        size_t index = (z * dimensions[1] + y) * dimensions[0] + x;
+
+                        for(size_t j = head[index]; j != npos; j = next[j]){
+                            if(j <= i){
+                                continue;
+                            }
+
+                            if((position - (*coordinates)[j]).squaredNorm() <= listCutoffSquared &&
+                               !isExcluded(i, j)){
+                                Pair pair = {{ i, j }};
+                                d->pairs.push_back(pair);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        std::sort(d->pairs.begin(), d->pairs.end());
+    }
+
+    d->referencePositions.resize(size);
+    for(size_t i = 0; i < size; i++){
+        d->referencePositions[i] = (*coordinates)[i];
+    }
+
+    d->valid = true;
+    d->rebuildCount++;
+}
+
+/// Returns \c true if the list must be rebuilt for \p coordinates.
+/// This is the case if any atom has moved more than half of the skin
+/// distance since the list was last built.
+bool NeighborList::needsRebuild(const CartesianCoordinates *coordinates) const
+{
+    if(!d->valid || d->referencePositions.size() != std::min(d->size, coordinates->size())){
+        return true;
+    }
+    else if(d->cutoff <= 0){
+        return false;
+    }
+
+    const Real limit = 0.25 * d->skin * d->skin;
+
+    for(size_t i = 0; i < d->referencePositions.size(); i++){
+        if(((*coordinates)[i] - d->referencePositions[i]).squaredNorm() > limit){
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/// Returns the number of times the list has been built.
+size_t NeighborList::rebuildCount() const
+{
+    return d->rebuildCount;
+}
+
+} // end chemkit namespace
@@ -0,0 +1,158 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+#include "steepestdescentintegrator.h"
+
+#include <boost/math/special_functions/fpclassify.hpp>
+
+#include <chemkit/cartesiancoordinates.h>
+
+#include "potential.h"
+
+namespace chemkit {
+
+// === SteepestDescentIntegratorPrivate ==================================== //
+class SteepestDescentIntegratorPrivate
+{
+public:
+    std::vector<Point3> initialPositions;
+};
+
+// === SteepestDescentIntegrator =========================================== //
+/// \class SteepestDescentIntegrator steepestdescentintegrator.h chemkit/steepestdescentintegrator.h
+/// \ingroup chemkit-md
+/// \brief The SteepestDescentIntegrator class minimizes the energy
+///        by moving each atom against its gradient.
+///
+/// \see LbfgsIntegrator, ConjugateGradientIntegrator
+
+// --- Construction and Destruction ---------------------------------------- //
+/// Creates a new steepest descent integrator.
+SteepestDescentIntegrator::SteepestDescentIntegrator()
+    : d(new SteepestDescentIntegratorPrivate)
+{
+}
+
+/// Destroys the steepest descent integrator.
+SteepestDescentIntegrator::~SteepestDescentIntegrator()
+{
+    delete d;
+}
+
+// --- Integration --------------------------------------------------------- //
+/// Performs a single steepest descent step.
+void SteepestDescentIntegrator::integrate()
+{
+    CartesianCoordinates *coordinates = this->coordinates();
+    boost::shared_ptr<Potential> potential = this->potential();
+
+    if(!potential || !coordinates){
+        return;
+    }
+
+    // optimization parameters
+    Real step = 0.05;
+    Real stepConv = 1e-5;
+    size_t stepCount = 10;
+
+    // calculate initial energy and gradient
+    Real initialEnergy = potential->energy(coordinates);
+    std::vector<Vector3> gradient = potential->gradient(coordinates);
+
+    std::vector<Point3> &initialPositions = d->initialPositions;
+    initialPositions.resize(potential->size());
+
+    // perform line search
+    for(size_t i = 0; i < stepCount; i++){
+        // save initial positions
+        for(size_t atomIndex = 0; atomIndex < potential->size(); atomIndex++){
+            initialPositions[atomIndex] = (*coordinates)[atomIndex];
+        }
+
+        // move each atom against its gradient
+        for(size_t atomIndex = 0; atomIndex < potential->size(); atomIndex++){
+            (*coordinates)[atomIndex] += -gradient[atomIndex] * step;
+        }
+
+        // calculate new energy
+        Real finalEnergy = potential->energy(coordinates);
+
+        // if the final energy is NaN then most likely the
+        // simulation exploded so we reset the initial atom
+        // positions and then 'wiggle' each atom by one
+        // Angstrom in a random direction
+        if((boost::math::isnan)(finalEnergy)){
+            for(size_t atomIndex = 0; atomIndex < potential->size(); atomIndex++){
+                Point3 position = initialPositions[atomIndex];
+                position += Vector3::Random().normalized();
+                coordinates->setPosition(atomIndex, position);
+            }
+
+            // recalculate gradient
+            gradient = potential->gradient(coordinates);
+
+            // continue to next step
+            continue;
+        }
+
+        if(finalEnergy < initialEnergy && std::abs(finalEnergy - initialEnergy) < stepConv){
+            break;
+        }
+        else if(finalEnergy < initialEnergy){
+            // we reduced the energy, so set a bigger step size
+            step *= 2;
+
+            // maximum step size is 1
+            if(step > 1){
+                step = 1;
+            }
+
+            // the initial energy for the next step
+            // is the final energy of this step
+            initialEnergy = finalEnergy;
+        }
+        else if(finalEnergy > initialEnergy){
+            // we went too far, so reset initial atom positions
+            for(size_t atomIndex = 0; atomIndex < potential->size(); atomIndex++){
+                (*coordinates)[atomIndex] = initialPositions[atomIndex];
+            }
+
+            // and reduce step size
+            step *= 0.1;
+        }
+    }
+}
+
+} // end chemkit namespace
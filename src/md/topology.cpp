@@ -35,6 +35,8 @@
 
 #include "topology.h"
 
+#include <algorithm>
+
 #include <boost/range/algorithm.hpp>
 
 #include <chemkit/foreach.h>
@@ -58,6 +60,8 @@ public:
     std::vector<int> bondedInteractionTypes;
     std::vector<int> angleInteractionTypes;
     std::vector<int> torsionInteractionTypes;
+    std::vector<std::pair<size_t, size_t> > oneFourPairs;
+    bool oneFourPairsValid;
 };
 
 // === Topology ============================================================ //
@@ -73,12 +77,15 @@ Topology::Topology()
     : d(new TopologyPrivate)
 {
     d->size = 0;
+    d->oneFourPairsValid = false;
 }
 
 /// Creates a new topology of size \p size.
 Topology::Topology(size_t size)
     : d(new TopologyPrivate)
 {
+    d->oneFourPairsValid = false;
+
     resize(size);
 }
 
@@ -284,6 +291,7 @@ void Topology::addTorsionInteraction(size_t i, size_t j, size_t k, size_t l)
     interaction[3] = l;
     d->torsionInteractions.push_back(interaction);
     d->torsionInteractionTypes.push_back(0);
+    d->oneFourPairsValid = false;
 }
 
 Topology::TorsionInteractionRange Topology::torsionInteractions() const
@@ -387,14 +395,23 @@ size_t Topology::nonbondedInteractionCount() const
 /// Returns \c true if atoms \p i and \p j are in a one-four configuration.
 bool Topology::isOneFour(size_t i, size_t j)
 {
-    foreach(const TorsionInteraction &torsion, d->torsionInteractions){
-        if((torsion[0] == i && torsion[3] == j) ||
-           (torsion[0] == j && torsion[3] == i)){
-            return true;
+    // build a sorted list of the outer atoms of each torsion
+    if(!d->oneFourPairsValid){
+        d->oneFourPairs.clear();
+        d->oneFourPairs.reserve(d->torsionInteractions.size());
+
+        foreach(const TorsionInteraction &torsion, d->torsionInteractions){
+            d->oneFourPairs.push_back(std::make_pair(std::min(torsion[0], torsion[3]),
+                                                     std::max(torsion[0], torsion[3])));
         }
+
+        std::sort(d->oneFourPairs.begin(), d->oneFourPairs.end());
+        d->oneFourPairsValid = true;
     }
 
-    return false;
+    return std::binary_search(d->oneFourPairs.begin(),
+                              d->oneFourPairs.end(),
+                              std::make_pair(std::min(i, j), std::max(i, j)));
 }
 
 } // end chemkit namespace
@@ -72,6 +72,7 @@ class TopologyBuilderPrivate
 public:
     std::string atomTyper;
     std::string partialChargeModel;
+    bool nonbondedInteractionsEnabled;
     boost::shared_ptr<Topology> topology;
 };
 
@@ -106,6 +107,7 @@ TopologyBuilder::TopologyBuilder()
     : d(new TopologyBuilderPrivate)
 {
     d->topology = boost::make_shared<Topology>();
+    d->nonbondedInteractionsEnabled = true;
 }
 
 /// Destroys the topology builder object.
@@ -143,6 +145,24 @@ bool TopologyBuilder::setPartialChargeModel(const std::string &model)
     return true;
 }
 
+/// Sets whether an explicit nonbonded interaction is added for each
+/// pair of atoms which are not within two bonds of each other. This
+/// is enabled by default.
+///
+/// The number of nonbonded interactions grows with the square of the
+/// number of atoms. Disabling them is useful for large systems where
+/// the nonbonded interactions are found with a NeighborList instead.
+void TopologyBuilder::setNonbondedInteractionsEnabled(bool enabled)
+{
+    d->nonbondedInteractionsEnabled = enabled;
+}
+
+/// Returns \c true if explicit nonbonded interactions are added.
+bool TopologyBuilder::nonbondedInteractionsEnabled() const
+{
+    return d->nonbondedInteractionsEnabled;
+}
+
 // --- Topology ------------------------------------------------------------ //
 /// Adds \p molecule to the topology.
 void TopologyBuilder::addMolecule(const Molecule *molecule)
@@ -288,12 +308,14 @@ void TopologyBuilder::addMolecule(const Molecule *molecule)
     }
 
     // add nonbonded interactions
-    std::vector<const Atom *> atoms(molecule->atoms().begin(), molecule->atoms().end());
-    for(size_t i = 0; i < atoms.size(); i++){
-        for(size_t j = i + 1; j < atoms.size(); j++){
-            if(!atomsWithinTwoBonds(atoms[i], atoms[j])){
-                topology->addNonbondedInteraction(initialSize + atoms[i]->index(),
-                                                  initialSize + atoms[j]->index());
+    if(d->nonbondedInteractionsEnabled){
+        std::vector<const Atom *> atoms(molecule->atoms().begin(), molecule->atoms().end());
+        for(size_t i = 0; i < atoms.size(); i++){
+            for(size_t j = i + 1; j < atoms.size(); j++){
+                if(!atomsWithinTwoBonds(atoms[i], atoms[j])){
+                    topology->addNonbondedInteraction(initialSize + atoms[i]->index(),
+                                                      initialSize + atoms[j]->index());
+                }
             }
         }
     }
@@ -68,6 +68,8 @@ public:
     bool isEmpty() const;
     bool setAtomTyper(const std::string &atomTyper);
     bool setPartialChargeModel(const std::string &model);
+    void setNonbondedInteractionsEnabled(bool enabled);
+    bool nonbondedInteractionsEnabled() const;
 
     // topology
     void addMolecule(const Molecule *molecule);
@@ -35,11 +35,16 @@
 
 #include "trajectory.h"
 
+#include <list>
+#include <sstream>
 #include <algorithm>
 
 #include <chemkit/foreach.h>
+#include <chemkit/unitcell.h>
+#include <chemkit/cartesiancoordinates.h>
 
 #include "trajectoryframe.h"
+#include "trajectoryframesource.h"
 
 namespace chemkit {
 
@@ -48,7 +53,14 @@ class TrajectoryPrivate
 {
 public:
     size_t size;
+    Trajectory::StorageMode storageMode;
     std::vector<TrajectoryFrame *> frames;
+    boost::shared_ptr<TrajectoryFrameSource> source;
+    size_t cacheSize;
+    size_t cacheMemory;
+    std::list<TrajectoryFrame *> cache;
+    std::vector<std::list<TrajectoryFrame *>::iterator> cachePositions;
+    std::string errorString;
 };
 
 // === Trajectory ========================================================== //
@@ -63,6 +75,21 @@ public:
 /// Trajectories are usually associated with a Topology which contains
 /// the atomic properties and atomic interactions for a system.
 ///
+/// Trajectories that are too large to fit in memory can be paged
+/// from disk by setting a frame source with setFrameSource(). Frames
+/// are then loaded when they are first accessed and kept in a least
+/// recently used cache whose memory budget is set with
+/// setCacheSize(). For example, to analyze a large XTC file using
+/// at most 1 GB for frame data:
+/// \code
+/// boost::shared_ptr<chemkit::TrajectoryFileReader> reader =
+///     boost::make_shared<chemkit::TrajectoryFileReader>("run.xtc");
+///
+/// chemkit::Trajectory trajectory;
+/// trajectory.setCacheSize(1024 * 1024 * 1024);
+/// trajectory.setFrameSource(reader);
+/// \endcode
+///
 /// \see Topology, TrajectoryFrame, TrajectoryFile
 
 // --- Construction and Destruction ---------------------------------------- //
@@ -71,6 +98,9 @@ Trajectory::Trajectory(size_t size)
     : d(new TrajectoryPrivate)
 {
     d->size = size;
+    d->storageMode = DoublePrecision;
+    d->cacheSize = 256 * 1024 * 1024;
+    d->cacheMemory = 0;
 }
 
 /// Destroys the trajectory object.
@@ -90,8 +120,12 @@ void Trajectory::resize(size_t size)
     d->size = size;
 
     foreach(TrajectoryFrame *frame, d->frames){
+        size_t previousSize = frame->memorySize();
         frame->resize(size);
+        updateCacheMemory(frame, previousSize);
     }
+
+    trimCache(0);
 }
 
 /// Returns the number of particles in the trajectory.
@@ -106,6 +140,41 @@ bool Trajectory::isEmpty() const
     return frameCount() == 0;
 }
 
+/// Sets the storage mode for the positions in each frame to \p mode.
+///
+/// The storage modes are:
+///     - \c DoublePrecision: Positions are stored as Real values
+///       in CartesianCoordinates. This is the default.
+///     - \c SinglePrecision: Positions are stored as separate
+///       arrays of \c float x, y and z values and converted to
+///       Real when accessed. This halves the memory used by each
+///       frame and is lossless for single precision sources such
+///       as XTC files.
+///
+/// Existing frames are converted to the new storage mode.
+void Trajectory::setStorageMode(StorageMode mode)
+{
+    if(mode == d->storageMode){
+        return;
+    }
+
+    d->storageMode = mode;
+
+    foreach(TrajectoryFrame *frame, d->frames){
+        size_t previousSize = frame->memorySize();
+        frame->setSinglePrecision(mode == SinglePrecision);
+        updateCacheMemory(frame, previousSize);
+    }
+
+    trimCache(0);
+}
+
+/// Returns the storage mode for the positions in each frame.
+Trajectory::StorageMode Trajectory::storageMode() const
+{
+    return d->storageMode;
+}
+
 // --- Frames -------------------------------------------------------------- //
 /// Adds a new frame to the trajectory.
 TrajectoryFrame* Trajectory::addFrame()
@@ -123,6 +192,11 @@ bool Trajectory::removeFrame(TrajectoryFrame *frame)
         return false;
     }
 
+    if(frame->sourceIndex() != size_t(-1) && frame->isLoaded()){
+        d->cacheMemory -= frame->memorySize();
+        d->cache.erase(d->cachePositions[frame->sourceIndex()]);
+    }
+
     d->frames.erase(location);
     delete frame;
 
@@ -130,9 +204,25 @@ bool Trajectory::removeFrame(TrajectoryFrame *frame)
 }
 
 /// Returns the frame at \p index in the trajectory.
+///
+/// For paged trajectories the frame is read from the frame source
+/// if it is not currently loaded. If the frame cannot be read, \c 0
+/// is returned and errorString() describes the error.
 TrajectoryFrame* Trajectory::frame(size_t index) const
 {
-    return d->frames[index];
+    TrajectoryFrame *frame = d->frames[index];
+
+    if(frame->sourceIndex() != size_t(-1)){
+        if(frame->isLoaded()){
+            // mark paged frames as recently used
+            d->cache.splice(d->cache.begin(), d->cache, d->cachePositions[frame->sourceIndex()]);
+        }
+        else if(!loadFrame(frame)){
+            return 0;
+        }
+    }
+
+    return frame;
 }
 
 /// Returns a list of the frames in the trajectory.
@@ -147,4 +237,176 @@ size_t Trajectory::frameCount() const
     return d->frames.size();
 }
 
+// --- Paging -------------------------------------------------------------- //
+/// Sets the frame source for the trajectory to \p source.
+///
+/// This replaces the frames in the trajectory with one frame for
+/// each frame available from \p source. The frames are not read
+/// from the source until they are accessed. Loaded frames are kept
+/// in a cache which is limited to cacheSize() bytes. When the cache
+/// is full, the least recently used frame is unloaded to make room.
+///
+/// Changes made to a paged frame are lost when it is unloaded.
+///
+/// Setting a null frame source removes all of the frames.
+void Trajectory::setFrameSource(const boost::shared_ptr<TrajectoryFrameSource> &source)
+{
+    foreach(TrajectoryFrame *frame, d->frames){
+        delete frame;
+    }
+    d->frames.clear();
+    d->cache.clear();
+    d->cachePositions.clear();
+    d->cacheMemory = 0;
+
+    d->source = source;
+    if(!source){
+        return;
+    }
+
+    size_t frameCount = source->frameCount();
+    d->frames.reserve(frameCount);
+    d->cachePositions.resize(frameCount);
+
+    for(size_t i = 0; i < frameCount; i++){
+        TrajectoryFrame *frame = new TrajectoryFrame(this, 0);
+        frame->setLoaded(false);
+        frame->setSourceIndex(i);
+        d->frames.push_back(frame);
+    }
+
+    // load the first frame to determine the size of the trajectory
+    if(!d->frames.empty()){
+        loadFrame(d->frames.front());
+    }
+}
+
+/// Returns the frame source for the trajectory.
+boost::shared_ptr<TrajectoryFrameSource> Trajectory::frameSource() const
+{
+    return d->source;
+}
+
+/// Sets the maximum amount of memory (in bytes) used to store loaded
+/// frames from the frame source to \p size. At least one frame is
+/// always kept loaded. The default cache size is 256 MB.
+///
+/// For frames stored in single precision the Real coordinates
+/// created by TrajectoryFrame::coordinates() also count towards
+/// the cache size.
+void Trajectory::setCacheSize(size_t size)
+{
+    d->cacheSize = size;
+
+    trimCache(0);
+}
+
+/// Returns the maximum amount of memory (in bytes) used to store
+/// loaded frames from the frame source.
+size_t Trajectory::cacheSize() const
+{
+    return d->cacheSize;
+}
+
+/// Returns the number of frames from the frame source that are
+/// currently loaded.
+size_t Trajectory::cachedFrameCount() const
+{
+    return d->cache.size();
+}
+
+// --- Error Handling ------------------------------------------------------ //
+/// Returns a string describing the last error that occurred.
+std::string Trajectory::errorString() const
+{
+    return d->errorString;
+}
+
+// --- Internal Methods ---------------------------------------------------- //
+/// Reads \p frame from the frame source and adds it to the cache.
+/// Returns \c false and leaves the frame unloaded if the frame could
+/// not be read.
+bool Trajectory::loadFrame(TrajectoryFrame *frame) const
+{
+    if(!d->source || frame->sourceIndex() == size_t(-1)){
+        frame->setLoaded(true);
+        return true;
+    }
+
+    // make room for the new frame
+    size_t frameSize = sizeof(UnitCell);
+    if(d->storageMode == SinglePrecision){
+        frameSize += d->size * 3 * sizeof(float);
+    }
+    else{
+        frameSize += sizeof(CartesianCoordinates) + d->size * sizeof(Point3);
+    }
+    trimCache(frameSize);
+
+    frame->setLoaded(true);
+    d->cache.push_front(frame);
+    d->cachePositions[frame->sourceIndex()] = d->cache.begin();
+
+    // changes to the frame's size while it is read are added by
+    // updateCacheMemory()
+    d->cacheMemory += frame->memorySize();
+
+    if(!d->source->readFrame(frame->sourceIndex(), frame)){
+        d->cacheMemory -= frame->memorySize();
+        d->cache.erase(d->cachePositions[frame->sourceIndex()]);
+        d->cachePositions[frame->sourceIndex()] = d->cache.end();
+        frame->setLoaded(false);
+
+        std::stringstream error;
+        error << "Failed to read frame " << frame->sourceIndex() << " from the frame source.";
+        d->errorString = error.str();
+
+        return false;
+    }
+
+    return true;
+}
+
+/// Unloads the least recently used frames until there is room
+/// for \p size more bytes in the cache. If \p size is \c 0 the most
+/// recently used frame is always kept loaded.
+void Trajectory::trimCache(size_t size) const
+{
+    while(!d->cache.empty() &&
+          d->cacheMemory + size > d->cacheSize &&
+          (size > 0 || d->cache.size() > 1)){
+        TrajectoryFrame *frame = d->cache.back();
+        d->cacheMemory -= frame->memorySize();
+        frame->setLoaded(false);
+        d->cache.pop_back();
+    }
+}
+
+/// Updates the memory used by the cache after the memory used by
+/// \p frame changed from \p previousSize.
+void Trajectory::updateCacheMemory(const TrajectoryFrame *frame, size_t previousSize) const
+{
+    if(frame->sourceIndex() == size_t(-1) || !frame->isLoaded()){
+        return;
+    }
+
+    d->cacheMemory += frame->memorySize();
+    d->cacheMemory -= previousSize;
+}
+
+/// Called by \p frame when the memory it uses changes from
+/// \p previousSize. The frame is marked as recently used so that it
+/// stays loaded while the cache is trimmed.
+void Trajectory::frameMemoryChanged(TrajectoryFrame *frame, size_t previousSize) const
+{
+    if(frame->sourceIndex() == size_t(-1) || !frame->isLoaded()){
+        return;
+    }
+
+    d->cache.splice(d->cache.begin(), d->cache, d->cachePositions[frame->sourceIndex()]);
+    updateCacheMemory(frame, previousSize);
+
+    trimCache(0);
+}
+
 } // end chemkit namespace
@@ -38,16 +38,28 @@
 
 #include "md.h"
 
+#include <string>
 #include <vector>
 
+#ifndef Q_MOC_RUN
+#include <boost/smart_ptr.hpp>
+#endif
+
 namespace chemkit {
 
 class TrajectoryFrame;
+class TrajectoryFrameSource;
 class TrajectoryPrivate;
 
 class CHEMKIT_MD_EXPORT Trajectory
 {
 public:
+    // enumerations
+    enum StorageMode {
+        DoublePrecision,
+        SinglePrecision
+    };
+
     // construction and destruction
     Trajectory(size_t size = 0);
     ~Trajectory();
@@ -56,6 +68,8 @@ public:
     void resize(size_t size);
     size_t size() const;
     bool isEmpty() const;
+    void setStorageMode(StorageMode mode);
+    StorageMode storageMode() const;
 
     // frames
     TrajectoryFrame* addFrame();
@@ -64,6 +78,24 @@ public:
     std::vector<TrajectoryFrame *> frames() const;
     size_t frameCount() const;
 
+    // paging
+    void setFrameSource(const boost::shared_ptr<TrajectoryFrameSource> &source);
+    boost::shared_ptr<TrajectoryFrameSource> frameSource() const;
+    void setCacheSize(size_t size);
+    size_t cacheSize() const;
+    size_t cachedFrameCount() const;
+
+    // error handling
+    std::string errorString() const;
+
+private:
+    bool loadFrame(TrajectoryFrame *frame) const;
+    void trimCache(size_t size) const;
+    void updateCacheMemory(const TrajectoryFrame *frame, size_t previousSize) const;
+    void frameMemoryChanged(TrajectoryFrame *frame, size_t previousSize) const;
+
+    friend class TrajectoryFrame;
+
 private:
     TrajectoryPrivate* const d;
 };
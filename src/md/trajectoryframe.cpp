@@ -51,8 +51,14 @@ class TrajectoryFramePrivate
 public:
     Trajectory *trajectory;
     Real time;
+    bool loaded;
+    bool singlePrecision;
     CartesianCoordinates *coordinates;
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> z;
     UnitCell *unitCell;
+    size_t sourceIndex;
 };
 
 // === TrajectoryFrame ===================================================== //
@@ -64,6 +70,17 @@ public:
 /// TrajectoryFrame objects are created with the
 /// Trajectory::addFrame() method and destroyed with the
 /// Trajectory::removeFrame() method.
+///
+/// Frames in a paged trajectory (see Trajectory::setFrameSource())
+/// load their data from the frame source when they are first
+/// accessed and may be unloaded again when other frames are loaded.
+/// If a frame cannot be read from its source, its accessors return
+/// default values and Trajectory::errorString() describes the error.
+///
+/// Frames in a trajectory using the Trajectory::SinglePrecision
+/// storage mode store their positions as separate arrays of
+/// \c float x, y and z values which are converted to Real when
+/// accessed.
 
 // --- Construction and Destruction ---------------------------------------- //
 /// Creates a new trajectory frame.
@@ -72,8 +89,14 @@ TrajectoryFrame::TrajectoryFrame(Trajectory *trajectory, size_t size)
 {
     d->trajectory = trajectory;
     d->time = 0;
-    d->coordinates = new CartesianCoordinates(size);
+    d->loaded = false;
+    d->singlePrecision = trajectory->storageMode() == Trajectory::SinglePrecision;
+    d->coordinates = 0;
     d->unitCell = 0;
+    d->sourceIndex = size_t(-1);
+
+    setLoaded(true);
+    resize(size);
 }
 
 /// Destroys the trajectory frame object.
@@ -88,19 +111,41 @@ TrajectoryFrame::~TrajectoryFrame()
 /// Sets the number of coordinates in the frame to \p size.
 void TrajectoryFrame::resize(size_t size)
 {
-    d->coordinates->resize(size);
+    if(!d->loaded){
+        return;
+    }
+
+    if(d->singlePrecision){
+        d->x.resize(size);
+        d->y.resize(size);
+        d->z.resize(size);
+
+        // drop the converted coordinates
+        delete d->coordinates;
+        d->coordinates = 0;
+    }
+    else{
+        d->coordinates->resize(size);
+    }
 }
 
 /// Returns the number of coordinates in the frame.
 size_t TrajectoryFrame::size() const
 {
+    if(!d->loaded){
+        return d->trajectory->size();
+    }
+    else if(d->singlePrecision){
+        return d->x.size();
+    }
+
     return d->coordinates->size();
 }
 
 /// Returns \c true if the frame contains no coordinates.
 bool TrajectoryFrame::isEmpty() const
 {
-    return d->coordinates->isEmpty();
+    return size() == 0;
 }
 
 /// Returns the index of the frame in the trajectory.
@@ -121,12 +166,20 @@ Trajectory* TrajectoryFrame::trajectory() const
 /// Sets the time for the trajectory frame to \p time.
 void TrajectoryFrame::setTime(Real time)
 {
+    if(!load()){
+        return;
+    }
+
     d->time = time;
 }
 
 /// Returns the time of the trajectory frame.
 Real TrajectoryFrame::time() const
 {
+    if(!load()){
+        return 0;
+    }
+
     return d->time;
 }
 
@@ -134,18 +187,67 @@ Real TrajectoryFrame::time() const
 /// Sets the coordinates at \p index to \p position.
 void TrajectoryFrame::setPosition(size_t index, const Point3 &position)
 {
-    d->coordinates->setPosition(index, position);
+    if(!load()){
+        return;
+    }
+
+    if(d->singlePrecision){
+        d->x[index] = static_cast<float>(position.x());
+        d->y[index] = static_cast<float>(position.y());
+        d->z[index] = static_cast<float>(position.z());
+
+        if(d->coordinates){
+            d->coordinates->setPosition(index, Point3(d->x[index], d->y[index], d->z[index]));
+        }
+    }
+    else{
+        d->coordinates->setPosition(index, position);
+    }
 }
 
 /// Returns the position at \p index.
 Point3 TrajectoryFrame::position(size_t index) const
 {
+    if(!load()){
+        return Point3(0, 0, 0);
+    }
+
+    if(d->singlePrecision){
+        return Point3(d->x[index], d->y[index], d->z[index]);
+    }
+
     return d->coordinates->position(index);
 }
 
 /// Returns the coordinates for the frame.
+///
+/// For frames in a paged trajectory the returned pointer is only
+/// valid until the frame is unloaded to make room for other frames.
+///
+/// For frames stored in single precision the coordinates are
+/// converted to Real when this is first called and are kept
+/// along with the single precision positions until the frame is
+/// resized or unloaded. In a paged trajectory the converted
+/// coordinates count towards the trajectory's cache size, so
+/// prefer position() when iterating over many frames.
 const CartesianCoordinates* TrajectoryFrame::coordinates() const
 {
+    if(!load()){
+        return 0;
+    }
+
+    if(!d->coordinates){
+        size_t previousSize = memorySize();
+
+        d->coordinates = new CartesianCoordinates(d->x.size());
+
+        for(size_t i = 0; i < d->x.size(); i++){
+            d->coordinates->setPosition(i, Point3(d->x[i], d->y[i], d->z[i]));
+        }
+
+        d->trajectory->frameMemoryChanged(const_cast<TrajectoryFrame *>(this), previousSize);
+    }
+
     return d->coordinates;
 }
 
@@ -153,13 +255,147 @@ const CartesianCoordinates* TrajectoryFrame::coordinates() const
 /// Sets the unit cell for the frame to \p cell.
 void TrajectoryFrame::setUnitCell(UnitCell *cell)
 {
+    if(!load()){
+        return;
+    }
+
     d->unitCell = cell;
 }
 
 /// Returns the unit cell for the frame.
 UnitCell* TrajectoryFrame::unitCell() const
 {
+    if(!load()){
+        return 0;
+    }
+
     return d->unitCell;
 }
 
+// --- Internal Methods ---------------------------------------------------- //
+/// Loads the frame from the trajectory's frame source if it is not
+/// currently loaded. Returns \c false if the frame could not be read.
+bool TrajectoryFrame::load() const
+{
+    if(!d->loaded){
+        return d->trajectory->loadFrame(const_cast<TrajectoryFrame *>(this));
+    }
+
+    return true;
+}
+
+/// Allocates (if \p loaded is \c true) or frees (if \p loaded is
+/// \c false) the coordinates and unit cell for the frame.
+void TrajectoryFrame::setLoaded(bool loaded)
+{
+    if(loaded == d->loaded){
+        return;
+    }
+
+    d->loaded = loaded;
+
+    if(loaded){
+        if(!d->singlePrecision){
+            d->coordinates = new CartesianCoordinates;
+        }
+
+        resize(d->trajectory->size());
+    }
+    else{
+        delete d->coordinates;
+        d->coordinates = 0;
+
+        std::vector<float>().swap(d->x);
+        std::vector<float>().swap(d->y);
+        std::vector<float>().swap(d->z);
+
+        delete d->unitCell;
+        d->unitCell = 0;
+    }
+}
+
+/// Returns \c true if the coordinates for the frame are loaded.
+bool TrajectoryFrame::isLoaded() const
+{
+    return d->loaded;
+}
+
+/// Sets the index of the frame in the trajectory's frame source.
+void TrajectoryFrame::setSourceIndex(size_t index)
+{
+    d->sourceIndex = index;
+}
+
+/// Returns the index of the frame in the trajectory's frame source.
+/// Frames that were not loaded from a frame source return \c -1.
+size_t TrajectoryFrame::sourceIndex() const
+{
+    return d->sourceIndex;
+}
+
+/// Converts the positions in the frame to single precision (if
+/// \p enabled is \c true) or to double precision (if \p enabled
+/// is \c false).
+void TrajectoryFrame::setSinglePrecision(bool enabled)
+{
+    if(enabled == d->singlePrecision){
+        return;
+    }
+
+    if(d->loaded && enabled){
+        size_t size = d->coordinates->size();
+        d->x.resize(size);
+        d->y.resize(size);
+        d->z.resize(size);
+
+        for(size_t i = 0; i < size; i++){
+            const Point3 &position = d->coordinates->position(i);
+            d->x[i] = static_cast<float>(position.x());
+            d->y[i] = static_cast<float>(position.y());
+            d->z[i] = static_cast<float>(position.z());
+        }
+
+        delete d->coordinates;
+        d->coordinates = 0;
+    }
+    else if(d->loaded && !enabled){
+        // the change in memory is counted by Trajectory::setStorageMode()
+        // so the coordinates are converted here instead of with
+        // coordinates()
+        if(!d->coordinates){
+            d->coordinates = new CartesianCoordinates(d->x.size());
+
+            for(size_t i = 0; i < d->x.size(); i++){
+                d->coordinates->setPosition(i, Point3(d->x[i], d->y[i], d->z[i]));
+            }
+        }
+
+        std::vector<float>().swap(d->x);
+        std::vector<float>().swap(d->y);
+        std::vector<float>().swap(d->z);
+    }
+
+    d->singlePrecision = enabled;
+}
+
+/// Returns the number of bytes used to store the frame's data.
+size_t TrajectoryFrame::memorySize() const
+{
+    if(!d->loaded){
+        return 0;
+    }
+
+    size_t size = sizeof(UnitCell);
+
+    if(d->singlePrecision){
+        size += d->x.size() * 3 * sizeof(float);
+    }
+
+    if(d->coordinates){
+        size += sizeof(CartesianCoordinates) + d->coordinates->size() * sizeof(Point3);
+    }
+
+    return size;
+}
+
 } // end chemkit namespace
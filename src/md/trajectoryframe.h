@@ -75,6 +75,13 @@ private:
     ~TrajectoryFrame();
 
     void resize(size_t size);
+    bool load() const;
+    void setLoaded(bool loaded);
+    bool isLoaded() const;
+    void setSourceIndex(size_t index);
+    size_t sourceIndex() const;
+    void setSinglePrecision(bool enabled);
+    size_t memorySize() const;
 
     friend class Trajectory;
 
@@ -0,0 +1,70 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+#include "trajectoryframesource.h"
+
+namespace chemkit {
+
+// === TrajectoryFrameSource =============================================== //
+/// \class TrajectoryFrameSource trajectoryframesource.h chemkit/trajectoryframesource.h
+/// \ingroup chemkit-md
+/// \brief The TrajectoryFrameSource class provides frames on demand
+///        for a paged trajectory.
+///
+/// Frame sources are used with Trajectory::setFrameSource() to keep
+/// the frames of a trajectory on disk and only load them when they
+/// are accessed.
+///
+/// \see Trajectory, TrajectoryFileReader
+
+// --- Construction and Destruction ---------------------------------------- //
+/// Destroys the trajectory frame source object.
+TrajectoryFrameSource::~TrajectoryFrameSource()
+{
+}
+
+// --- Frames -------------------------------------------------------------- //
+/// \fn size_t TrajectoryFrameSource::frameCount() const
+///
+/// Returns the number of frames available from the source.
+
+/// \fn bool TrajectoryFrameSource::readFrame(size_t index, TrajectoryFrame *frame)
+///
+/// Reads the frame at \p index into \p frame. Implementations
+/// should set the time, unit cell and positions of \p frame and
+/// resize its trajectory if the frame contains more atoms than it.
+/// Returns \c false if the frame could not be read.
+
+} // end chemkit namespace
@@ -37,6 +37,9 @@
 
 #include "amberparameters.h"
 
+#include <boost/thread/locks.hpp>
+
+#include <chemkit/foreach.h>
 #include <chemkit/topology.h>
 #include <chemkit/constants.h>
 #include <chemkit/cartesiancoordinates.h>
@@ -337,3 +340,108 @@ std::vector<chemkit::Vector3> AmberNonbondedCalculation::gradient(const chemkit:
 
     return std::vector<chemkit::Vector3>(gradient.begin(), gradient.end());
 }
+
+// === AmberNeighborListCalculation ======================================== //
+// Calculates the nonbonded energy for each pair of atoms within the
+// nonbonded cutoff distance using a neighbor list.
+AmberNeighborListCalculation::AmberNeighborListCalculation(size_t size, chemkit::Real cutoff, chemkit::Real skin)
+    : AmberCalculation(VanDerWaals | Electrostatic, size, 0),
+      m_neighborList(size, cutoff, skin)
+{
+    for(size_t i = 0; i < size; i++){
+        setAtom(i, i);
+    }
+}
+
+bool AmberNeighborListCalculation::setup(const AmberParameters *parameters)
+{
+    const boost::shared_ptr<chemkit::Topology> &topology = this->topology();
+
+    m_neighborList.addExclusions(topology.get());
+
+    m_wellDepths.resize(atomCount());
+    m_radii.resize(atomCount());
+    m_charges.resize(atomCount());
+
+    bool ok = true;
+
+    for(size_t i = 0; i < atomCount(); i++){
+        const struct AmberNonbondedParameters *nonbondedParameters = parameters->nonbondedParameters(atomType(i));
+        if(!nonbondedParameters){
+            ok = false;
+            continue;
+        }
+
+        m_wellDepths[i] = nonbondedParameters->wellDepth;
+        m_radii[i] = nonbondedParameters->vanDerWaalsRadius;
+        m_charges[i] = topology->charge(i);
+    }
+
+    return ok;
+}
+
+chemkit::Real AmberNeighborListCalculation::energy(const chemkit::CartesianCoordinates *coordinates) const
+{
+    boost::lock_guard<boost::mutex> lock(m_neighborListMutex);
+    m_neighborList.update(coordinates);
+
+    chemkit::Real cutoff = m_neighborList.cutoff();
+    chemkit::Real e0 = 1;
+    chemkit::Real energy = 0;
+
+    foreach(const chemkit::NeighborList::Pair &pair, m_neighborList.pairs()){
+        size_t a = pair[0];
+        size_t b = pair[1];
+
+        chemkit::Real r = coordinates->distance(a, b);
+        if(r > cutoff){
+            continue;
+        }
+
+        chemkit::Real epsilon = m_wellDepths[a] + m_wellDepths[b];
+        chemkit::Real sigma = m_radii[a] + m_radii[b];
+
+        chemkit::Real vanDerWaalsTerm = epsilon * (pow(sigma/r, 12) - 2 * pow(sigma/r, 6));
+        chemkit::Real electrostaticTerm = (m_charges[a] * m_charges[b]) / (4.0 * chemkit::constants::Pi * e0 * r);
+
+        energy += vanDerWaalsTerm + electrostaticTerm;
+    }
+
+    return energy;
+}
+
+std::vector<chemkit::Vector3> AmberNeighborListCalculation::gradient(const chemkit::CartesianCoordinates *coordinates) const
+{
+    boost::lock_guard<boost::mutex> lock(m_neighborListMutex);
+    m_neighborList.update(coordinates);
+
+    std::vector<chemkit::Vector3> gradient(atomCount(), chemkit::Vector3(0, 0, 0));
+
+    chemkit::Real cutoff = m_neighborList.cutoff();
+    chemkit::Real e0 = 1;
+    chemkit::Real pi = chemkit::constants::Pi;
+
+    foreach(const chemkit::NeighborList::Pair &pair, m_neighborList.pairs()){
+        size_t a = pair[0];
+        size_t b = pair[1];
+
+        chemkit::Vector3 ab = (*coordinates)[a] - (*coordinates)[b];
+        chemkit::Real r = ab.norm();
+        if(r > cutoff){
+            continue;
+        }
+
+        chemkit::Real epsilon = m_wellDepths[a] + m_wellDepths[b];
+        chemkit::Real sigma = m_radii[a] + m_radii[b];
+        chemkit::Real sr = sigma / r;
+
+        // dE/dr
+        chemkit::Real de_dr = (-12 * epsilon * sigma / pow(r, 2) * (pow(sr, 11) - pow(sr, 5))) - ((m_charges[a] * m_charges[b]) / (4.0 * pi * e0 * pow(r, 2)));
+
+        chemkit::Vector3 de_da = ab * (de_dr / r);
+        gradient[a] += de_da;
+        gradient[b] -= de_da;
+    }
+
+    return gradient;
+}
@@ -36,6 +36,9 @@
 #ifndef AMBERCALCULATION_H
 #define AMBERCALCULATION_H
 
+#include <boost/thread/mutex.hpp>
+
+#include <chemkit/neighborlist.h>
 #include <chemkit/forcefieldcalculation.h>
 
 class AmberParameters;
@@ -89,4 +92,21 @@ public:
     std::vector<chemkit::Vector3> gradient(const chemkit::CartesianCoordinates *coordinates) const CHEMKIT_OVERRIDE;
 };
 
+class AmberNeighborListCalculation : public AmberCalculation
+{
+public:
+    AmberNeighborListCalculation(size_t size, chemkit::Real cutoff, chemkit::Real skin);
+
+    bool setup(const AmberParameters *parameters);
+    chemkit::Real energy(const chemkit::CartesianCoordinates *coordinates) const CHEMKIT_OVERRIDE;
+    std::vector<chemkit::Vector3> gradient(const chemkit::CartesianCoordinates *coordinates) const CHEMKIT_OVERRIDE;
+
+private:
+    mutable chemkit::NeighborList m_neighborList;
+    mutable boost::mutex m_neighborListMutex;
+    std::vector<chemkit::Real> m_wellDepths;
+    std::vector<chemkit::Real> m_radii;
+    std::vector<chemkit::Real> m_charges;
+};
+
 #endif // AMBERCALCULATION_H
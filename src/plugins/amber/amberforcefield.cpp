@@ -85,9 +85,16 @@ bool AmberForceField::setup()
                                                    interaction[3]));
     }
 
-    foreach(const chemkit::Topology::NonbondedInteraction &interaction, topology->nonbondedInteractions()){
-        addCalculation(new AmberNonbondedCalculation(interaction[0],
-                                                     interaction[1]));
+    if(nonbondedCutoff() > 0){
+        addCalculation(new AmberNeighborListCalculation(topology->size(),
+                                                        nonbondedCutoff(),
+                                                        neighborListSkin()));
+    }
+    else{
+        foreach(const chemkit::Topology::NonbondedInteraction &interaction, topology->nonbondedInteractions()){
+            addCalculation(new AmberNonbondedCalculation(interaction[0],
+                                                         interaction[1]));
+        }
     }
 
     bool ok = true;
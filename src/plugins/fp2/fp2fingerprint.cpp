@@ -36,6 +36,8 @@
 
 #include "fp2fingerprint.h"
 
+#include <algorithm>
+
 #include <chemkit/atom.h>
 #include <chemkit/bond.h>
 #include <chemkit/ring.h>
@@ -44,6 +46,17 @@
 // The FP2 fingerprint implementation is adapted from code provided
 // by Chris Morley.
 
+namespace {
+
+const size_t Fp2Size = 1021;
+
+inline void setBit(boost::uint64_t *words, size_t bit)
+{
+    words[bit / 64] |= boost::uint64_t(1) << (bit % 64);
+}
+
+} // end anonymous namespace
+
 Fp2Fingerprint::Fp2Fingerprint()
     : chemkit::Fingerprint("fp2")
 {
@@ -53,11 +66,35 @@ Fp2Fingerprint::~Fp2Fingerprint()
 {
 }
 
+size_t Fp2Fingerprint::size() const
+{
+    return Fp2Size;
+}
+
 // Returns the FP2 fingerprint value for the molecule.
 chemkit::Bitset Fp2Fingerprint::value(const chemkit::Molecule *molecule) const
 {
-    // create bitset
-    chemkit::Bitset fingerprint(1021);
+    std::vector<boost::uint64_t> words(wordCount());
+    packedValue(molecule, &words[0]);
+
+    return unpack(&words[0], Fp2Size);
+}
+
+// Calculates the FP2 fingerprint for the molecule and stores it in
+// words.
+void Fp2Fingerprint::packedValue(const chemkit::Molecule *molecule, boost::uint64_t *words) const
+{
+    std::fill(words, words + wordCount(), boost::uint64_t(0));
+
+    if(!m_scratch.get()){
+        m_scratch.reset(new Scratch);
+    }
+
+    Scratch &scratch = *m_scratch;
+
+    // each fragment marks its atoms as visited and unmarks them when
+    // it is done, so this only needs to be cleared once per molecule
+    scratch.visited.assign(molecule->atomCount(), false);
 
     foreach(const chemkit::Atom *atom, molecule->atoms()){
         // skip fragments starting at terminal hydrogens
@@ -66,29 +103,28 @@ chemkit::Bitset Fp2Fingerprint::value(const chemkit::Molecule *molecule) const
         }
 
         // add each atom fragment to the fingerprint
-        addFragments(atom, fingerprint);
+        addFragments(atom, scratch, words);
     }
-
-    return fingerprint;
 }
 
 // Add all fragments starting at atom to the fingerprint.
 void Fp2Fingerprint::addFragments(const chemkit::Atom *atom,
-                                  chemkit::Bitset &fingerprint) const
+                                  Scratch &scratch,
+                                  boost::uint64_t *words) const
 {
-    Fragment fragment;
-    chemkit::Bitset visited(atom->molecule()->atomCount());
-    extendFragment(fragment, 1, visited, atom, 0, atom, fingerprint);
+    scratch.fragment.clear();
+    extendFragment(1, atom, 0, atom, scratch, words);
 }
 
-// Extend the fragment to atom.
-void Fp2Fingerprint::extendFragment(Fragment fragment,
-                                    size_t depth,
-                                    chemkit::Bitset visited,
+// Extend the fragment to atom. The fragment is built up in
+// scratch.fragment and restored to its previous contents before
+// returning.
+void Fp2Fingerprint::extendFragment(size_t depth,
                                     const chemkit::Atom *atom,
                                     const chemkit::Bond *bond,
                                     const chemkit::Atom *firstAtom,
-                                    chemkit::Bitset &fingerprint) const
+                                    Scratch &scratch,
+                                    boost::uint64_t *words) const
 {
     const size_t MaxFragmentSize = 7;
 
@@ -97,9 +133,13 @@ void Fp2Fingerprint::extendFragment(Fragment fragment,
         bondOrder = bond->isAromatic() ? 5 : bond->order();
     }
 
-    fragment.push_back(bondOrder);
-    fragment.push_back(atom->atomicNumber());
-    visited.set(atom->index());
+    // the first bond order is changed when a ring is found and
+    // must be restored for the enclosing fragment
+    unsigned char firstBondOrder = scratch.fragment.empty() ? 0 : scratch.fragment[0];
+
+    scratch.fragment.push_back(bondOrder);
+    scratch.fragment.push_back(atom->atomicNumber());
+    scratch.visited[atom->index()] = true;
 
     foreach(const chemkit::Bond *neighborBond, atom->bonds()){
         if(neighborBond == bond){
@@ -113,55 +153,62 @@ void Fp2Fingerprint::extendFragment(Fragment fragment,
 
         // if the neighbor is an atom that we've already visited
         // then this fragment forms a ring
-        if(visited.test(neighbor->index())){
+        if(scratch.visited[neighbor->index()]){
             if(neighbor == firstAtom){
                 // add bond at front for the ring
-                fragment[0] = bondOrder;
+                scratch.fragment[0] = bondOrder;
 
                 // insert ring
-                Fragment ring = fragment;
-                Fragment canonicalRing = fragment;
-                for(size_t i = 0; i < ring.size() / 2; i++){
+                scratch.ring = scratch.fragment;
+                scratch.canonicalRing = scratch.fragment;
+                for(size_t i = 0; i < scratch.ring.size() / 2; i++){
                     // rotate atoms in ring
-                    std::rotate(ring.begin(), ring.begin() + 2, ring.end());
-                    if(ring > canonicalRing){
-                        canonicalRing = ring;
+                    std::rotate(scratch.ring.begin(), scratch.ring.begin() + 2, scratch.ring.end());
+                    if(scratch.ring > scratch.canonicalRing){
+                        scratch.canonicalRing = scratch.ring;
                     }
 
                     // reverse the ring
-                    Fragment reversedRing = ring;
-                    std::reverse(reversedRing.begin() + 1, reversedRing.end());
-                    if(reversedRing > canonicalRing){
-                        canonicalRing = reversedRing;
+                    scratch.reversedRing = scratch.ring;
+                    std::reverse(scratch.reversedRing.begin() + 1, scratch.reversedRing.end());
+                    if(scratch.reversedRing > scratch.canonicalRing){
+                        scratch.canonicalRing = scratch.reversedRing;
                     }
 
                     // add the non-ring form of all ring rotations
-                    Fragment ringCopy = ring;
-                    ringCopy[0] = 0;
-                    fingerprint.set(canonicalHash(ringCopy));
+                    unsigned char ringBondOrder = scratch.ring[0];
+                    scratch.ring[0] = 0;
+                    setBit(words, canonicalHash(scratch.ring));
+                    scratch.ring[0] = ringBondOrder;
                 }
 
-                fingerprint.set(canonicalHash(canonicalRing));
+                setBit(words, canonicalHash(scratch.canonicalRing));
             }
         }
         // no ring
         else{
             if(depth < MaxFragmentSize){
                 // extend fragment to the next atom
-                extendFragment(fragment,
-                               depth+1,
-                               visited,
+                extendFragment(depth+1,
                                neighbor,
                                neighborBond,
                                firstAtom,
-                               fingerprint);
+                               scratch,
+                               words);
             }
         }
     }
 
     // do not save C, N, O single atom fragments
-    if(fragment[0] == 0 && (depth > 1 || fragment[1] > 8 || fragment[1] < 6)){
-        fingerprint.set(canonicalHash(fragment));
+    if(scratch.fragment[0] == 0 && (depth > 1 || scratch.fragment[1] > 8 || scratch.fragment[1] < 6)){
+        setBit(words, canonicalHash(scratch.fragment));
+    }
+
+    // restore the fragment for the enclosing call
+    scratch.visited[atom->index()] = false;
+    scratch.fragment.resize(scratch.fragment.size() - 2);
+    if(!scratch.fragment.empty()){
+        scratch.fragment[0] = firstBondOrder;
     }
 }
 
@@ -38,6 +38,8 @@
 
 #include <vector>
 
+#include <boost/thread/tss.hpp>
+
 #include <chemkit/molecule.h>
 #include <chemkit/fingerprint.h>
 
@@ -47,21 +49,37 @@ public:
     Fp2Fingerprint();
     ~Fp2Fingerprint();
 
+    size_t size() const CHEMKIT_OVERRIDE;
     chemkit::Bitset value(const chemkit::Molecule *molecule) const CHEMKIT_OVERRIDE;
+    void packedValue(const chemkit::Molecule *molecule, boost::uint64_t *words) const CHEMKIT_OVERRIDE;
 
 private:
     typedef std::vector<unsigned char> Fragment;
 
+    // scratch buffers reused for each molecule
+    struct Scratch {
+        Fragment fragment;
+        Fragment ring;
+        Fragment canonicalRing;
+        Fragment reversedRing;
+        std::vector<bool> visited;
+    };
+
     void addFragments(const chemkit::Atom *atom,
-                      chemkit::Bitset &fingerprint) const;
-    void extendFragment(Fragment fragment,
-                        size_t depth,
-                        chemkit::Bitset visited,
+                      Scratch &scratch,
+                      boost::uint64_t *words) const;
+    void extendFragment(size_t depth,
                         const chemkit::Atom *atom,
                         const chemkit::Bond *bond,
                         const chemkit::Atom *firstAtom,
-                        chemkit::Bitset &fingerprint) const;
+                        Scratch &scratch,
+                        boost::uint64_t *words) const;
     static size_t canonicalHash(const Fragment &fragment);
+
+private:
+    // each thread has its own scratch buffers so that value() and
+    // packedValue() can be called from multiple threads at once
+    mutable boost::thread_specific_ptr<Scratch> m_scratch;
 };
 
 #endif // FP2FINGERPRINT_H
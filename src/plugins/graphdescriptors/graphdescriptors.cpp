@@ -35,52 +35,10 @@
 
 #include "graphdescriptors.h"
 
-#include <set>
-#include <vector>
+#include <limits>
 
-#include <chemkit/atom.h>
-#include <chemkit/foreach.h>
 #include <chemkit/molecule.h>
-
-namespace {
-
-// Returns the graph distance between the two atoms.
-int distanceBetween(const chemkit::Atom *a, const chemkit::Atom *b)
-{
-    int distance = 0;
-
-    std::set<const chemkit::Atom*> visited;
-
-    std::vector<const chemkit::Atom*> row;
-    row.push_back(a);
-
-    while(!row.empty()){
-        std::vector<const chemkit::Atom*> nextRow;
-
-        foreach(const chemkit::Atom *atom, row){
-            if(atom == b){
-                return distance;
-            }
-
-            visited.insert(atom);
-
-            foreach(const chemkit::Atom *neighbor, atom->neighbors()){
-                if(visited.find(neighbor) != visited.end()){
-                    continue;
-                }
-
-                nextRow.push_back(neighbor);
-            }
-        }
-
-        row = nextRow;
-        distance++;
-    }
-
-    return 0;
-}
-
-} // end anonymous namespace
+#include <chemkit/topologicaldistancematrix.h>
 
 // === GraphDensityDescriptor ============================================== //
 GraphDensityDescriptor::GraphDensityDescriptor()
@@ -110,23 +68,21 @@ GraphDiameterDescriptor::GraphDiameterDescriptor()
 
 chemkit::Variant GraphDiameterDescriptor::value(const chemkit::Molecule *molecule) const
 {
-    int diameter = 0;
+    const chemkit::TopologicalDistanceMatrix *distances = molecule->topologicalDistanceMatrix();
 
-    for(size_t i = 0; i < molecule->size(); i++){
-        const chemkit::Atom *a = molecule->atom(i);
+    size_t diameter = 0;
 
+    for(size_t i = 0; i < molecule->size(); i++){
         for(size_t j = i + 1; j < molecule->size(); j++){
-            const chemkit::Atom *b = molecule->atom(j);
-
-            int distance = distanceBetween(a, b);
+            size_t distance = distances->distance(i, j);
 
-            if(distance > diameter){
+            if(distance != chemkit::TopologicalDistanceMatrix::npos && distance > diameter){
                 diameter = distance;
             }
         }
     }
 
-    return diameter;
+    return static_cast<int>(diameter);
 }
 
 // === GraphOrderDescriptor ================================================ //
@@ -150,19 +106,17 @@ GraphRadiusDescriptor::GraphRadiusDescriptor()
 
 chemkit::Variant GraphRadiusDescriptor::value(const chemkit::Molecule *molecule) const
 {
-    int radius = std::numeric_limits<int>::max();
+    const chemkit::TopologicalDistanceMatrix *distances = molecule->topologicalDistanceMatrix();
 
-    for(size_t i = 0; i < molecule->size(); i++){
-        const chemkit::Atom *a = molecule->atom(i);
+    size_t radius = std::numeric_limits<int>::max();
 
-        int eccentricity = 0;
+    for(size_t i = 0; i < molecule->size(); i++){
+        size_t eccentricity = 0;
 
         for(size_t j = 0; j < molecule->size(); j++){
-            const chemkit::Atom *b = molecule->atom(j);
-
-            int distance = distanceBetween(a, b);
+            size_t distance = distances->distance(i, j);
 
-            if(distance > eccentricity){
+            if(distance != chemkit::TopologicalDistanceMatrix::npos && distance > eccentricity){
                 eccentricity = distance;
             }
         }
@@ -172,7 +126,7 @@ chemkit::Variant GraphRadiusDescriptor::value(const chemkit::Molecule *molecule)
         }
     }
 
-    return radius;
+    return static_cast<int>(radius);
 }
 
 // === GraphSizeDescriptor ================================================= //
@@ -40,6 +40,10 @@
 
 #include "mdlfileformat.h"
 
+#include <cstring>
+#include <algorithm>
+
+#include <boost/cstdint.hpp>
 #include <boost/algorithm/string.hpp>
 
 #include <chemkit/atom.h>
@@ -66,6 +70,253 @@ int readNumber(const char *s, int length)
     return number;
 }
 
+// Reads the integer in the field at column with width from line.
+int readNumber(const char *line, size_t length, size_t column, size_t width)
+{
+    if(column >= length){
+        return 0;
+    }
+
+    return readNumber(line + column, static_cast<int>(std::min(width, length - column)));
+}
+
+// Reads the real number in the field at column with width from line.
+double readReal(const char *line, size_t length, size_t column, size_t width)
+{
+    if(column >= length){
+        return 0;
+    }
+
+    const char *s = line + column;
+    const char *end = s + std::min(width, length - column);
+
+    // skip any leading white space
+    while(s < end && isspace(*s)){
+        s++;
+    }
+
+    bool negative = false;
+    if(s < end && (*s == '-' || *s == '+')){
+        negative = *s++ == '-';
+    }
+
+    // read the digits as an integer and divide by the number
+    // of decimal places (fields are at most 10 characters wide)
+    boost::uint64_t mantissa = 0;
+    int decimalPlaces = 0;
+    bool decimalPoint = false;
+
+    for(; s < end; s++){
+        if(isdigit(*s)){
+            mantissa = mantissa * 10 + (*s - '0');
+            decimalPlaces += decimalPoint;
+        }
+        else if(*s == '.' && !decimalPoint){
+            decimalPoint = true;
+        }
+        else{
+            break;
+        }
+    }
+
+    static const double powersOfTen[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9,
+        1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18
+    };
+
+    double value = static_cast<double>(mantissa) / powersOfTen[std::min(decimalPlaces, 18)];
+
+    return negative ? -value : value;
+}
+
+// Reads the atom symbol which starts at column 31 from line.
+std::string readSymbol(const char *line, size_t length)
+{
+    size_t begin = 30;
+    while(begin < length && isspace(line[begin])){
+        begin++;
+    }
+
+    size_t end = begin;
+    while(end < length && end - begin < 3 && !isspace(line[end])){
+        end++;
+    }
+
+    return std::string(line + std::min(begin, length), line + std::min(end, length));
+}
+
+// Reads lines from a block of memory.
+class LineReader
+{
+public:
+    LineReader(const char *data, size_t size)
+        : m_position(data),
+          m_end(data + size)
+    {
+    }
+
+    bool atEnd() const
+    {
+        return m_position >= m_end;
+    }
+
+    // Sets line and length to the next line (without its line
+    // ending). Returns false if there are no more lines.
+    bool readLine(const char *&line, size_t &length)
+    {
+        if(m_position >= m_end){
+            return false;
+        }
+
+        const char *newline = static_cast<const char *>(memchr(m_position, '\n', m_end - m_position));
+        const char *lineEnd = newline ? newline : m_end;
+
+        line = m_position;
+        length = lineEnd - m_position;
+        if(length && line[length-1] == '\r'){
+            length--;
+        }
+
+        m_position = newline ? newline + 1 : m_end;
+        return true;
+    }
+
+private:
+    const char *m_position;
+    const char *m_end;
+};
+
+bool startsWith(const char *line, size_t length, const char *prefix)
+{
+    size_t prefixLength = strlen(prefix);
+
+    return length >= prefixLength && memcmp(line, prefix, prefixLength) == 0;
+}
+
+chemkit::Atom* addAtom(chemkit::Molecule *molecule, const std::string &symbol)
+{
+    chemkit::Atom *atom = molecule->addAtom(symbol);
+    if(!atom->element().isValid()){
+        if(symbol == "D"){
+            atom->setIsotope(chemkit::Isotope(chemkit::Atom::Hydrogen, 2));
+        }
+        else if(symbol == "T"){
+            atom->setIsotope(chemkit::Isotope(chemkit::Atom::Hydrogen, 3));
+        }
+    }
+
+    return atom;
+}
+
+// Reads the next molecule (and its data block if sdf is true)
+// from reader. Returns 0 if there are no more molecules.
+chemkit::Molecule* readMolecule(LineReader &reader, bool sdf)
+{
+    const char *line;
+    size_t length;
+
+    // title, creator and comment lines
+    if(!reader.readLine(line, length)){
+        return 0;
+    }
+    std::string title(line, length);
+
+    if(!reader.readLine(line, length) || !reader.readLine(line, length)){
+        return 0;
+    }
+
+    // counts line
+    if(!reader.readLine(line, length)){
+        return 0;
+    }
+
+    int atomCount = readNumber(line, length, 0, 3);
+    int bondCount = readNumber(line, length, 3, 3);
+
+    chemkit::Molecule *molecule = new chemkit::Molecule;
+    if(!title.empty()){
+        molecule->setName(title);
+    }
+
+    // atom block
+    for(int i = 0; i < atomCount && reader.readLine(line, length); i++){
+        if(length < 33){
+            // line too short
+            continue;
+        }
+
+        chemkit::Atom *atom = addAtom(molecule, readSymbol(line, length));
+        atom->setPosition(readReal(line, length, 0, 10),
+                          readReal(line, length, 10, 10),
+                          readReal(line, length, 20, 10));
+    }
+
+    // bond block
+    for(int i = 0; i < bondCount && reader.readLine(line, length); i++){
+        if(length < 9){
+            // line too short
+            break;
+        }
+
+        chemkit::Atom *firstAtom = molecule->atom(readNumber(line, length, 0, 3) - 1);
+        chemkit::Atom *secondAtom = molecule->atom(readNumber(line, length, 3, 3) - 1);
+        if(firstAtom && secondAtom){
+            chemkit::Bond *bond = molecule->addBond(firstAtom, secondAtom);
+            bond->setOrder(line[8] - '0');
+        }
+    }
+
+    // property block
+    while(reader.readLine(line, length)){
+        if(startsWith(line, length, "M  END")){
+            break;
+        }
+    }
+
+    if(!sdf){
+        return molecule;
+    }
+
+    // data block
+    std::string dataName;
+    std::string dataValue;
+    bool readingValue = false;
+
+    while(reader.readLine(line, length)){
+        // trim leading and trailing white space
+        while(length && isspace(*line)){
+            line++;
+            length--;
+        }
+        while(length && isspace(line[length-1])){
+            length--;
+        }
+
+        if(startsWith(line, length, "$$$$")){
+            break;
+        }
+        else if(startsWith(line, length, "> <")){
+            dataName.assign(line + 3, length > 4 ? length - 4 : 0);
+            readingValue = true;
+        }
+        else if(readingValue && length == 0){
+            molecule->setData(dataName, dataValue);
+            dataValue.clear();
+        }
+        else if(readingValue){
+            if(!dataValue.empty())
+                dataValue += "\n";
+            dataValue.append(line, length);
+        }
+        else{
+            dataValue.assign(line, length);
+            readingValue = false;
+        }
+    }
+
+    return molecule;
+}
+
 } // end anonymous namespace
 
 // --- Construction and Destruction ---------------------------------------- //
@@ -82,7 +333,13 @@ MdlFileFormat::~MdlFileFormat()
 bool MdlFileFormat::read(std::istream &input, chemkit::MoleculeFile *file)
 {
     if(name() == "mol" || name() == "mdl"){
-        return readMolFile(input, file);
+        chemkit::Molecule *molecule = readMolFile(input);
+        if(!molecule){
+            return false;
+        }
+
+        file->addMolecule(boost::shared_ptr<chemkit::Molecule>(molecule));
+        return true;
     }
     else if(name() == "sdf" || name() == "sd"){
         return readSdfFile(input, file);
@@ -92,6 +349,21 @@ bool MdlFileFormat::read(std::istream &input, chemkit::MoleculeFile *file)
     }
 }
 
+bool MdlFileFormat::readMappedFile(const boost::iostreams::mapped_file_source &input, chemkit::MoleculeFile *file)
+{
+    if(!chemkit::MoleculeFileFormat::readMappedFile(input, file)){
+        return false;
+    }
+
+    // return false if we failed to read any molecules
+    if(file->moleculeCount() == 0){
+        setErrorString("File is empty");
+        return false;
+    }
+
+    return true;
+}
+
 bool MdlFileFormat::write(const chemkit::MoleculeFile *file, std::ostream &output)
 {
     if(file->isEmpty()){
@@ -111,8 +383,92 @@ bool MdlFileFormat::write(const chemkit::MoleculeFile *file, std::ostream &outpu
     return true;
 }
 
+bool MdlFileFormat::supportsStreaming() const
+{
+    return true;
+}
+
+chemkit::Molecule* MdlFileFormat::readNext(std::istream &input)
+{
+    chemkit::Molecule *molecule = readMolFile(input);
+    if(!molecule){
+        return 0;
+    }
+
+    if(name() == "sdf" || name() == "sd"){
+        readDataBlock(input, molecule);
+    }
+
+    return molecule;
+}
+
+bool MdlFileFormat::writeNext(const chemkit::Molecule *molecule, std::ostream &output)
+{
+    writeMolFile(molecule, output);
+
+    if(name() == "sdf" || name() == "sd"){
+        output << "$$$$\n";
+    }
+
+    return true;
+}
+
+bool MdlFileFormat::supportsChunkedReading() const
+{
+    return true;
+}
+
+size_t MdlFileFormat::findRecordStart(const char *data, size_t size, size_t position) const
+{
+    // mol files contain a single record
+    if(position == 0 || (name() != "sdf" && name() != "sd")){
+        return position == 0 ? 0 : size;
+    }
+
+    // move to the start of the next line
+    const char *newline = static_cast<const char *>(memchr(data + position - 1, '\n', size - position + 1));
+    if(!newline){
+        return size;
+    }
+
+    // records start after the next '$$$$' line
+    LineReader reader(newline + 1, data + size - newline - 1);
+
+    const char *line;
+    size_t length;
+    while(reader.readLine(line, length)){
+        while(length && isspace(*line)){
+            line++;
+            length--;
+        }
+
+        if(startsWith(line, length, "$$$$")){
+            const char *next = static_cast<const char *>(memchr(line, '\n', data + size - line));
+            return next ? next + 1 - data : size;
+        }
+    }
+
+    return size;
+}
+
+bool MdlFileFormat::readChunk(const char *data, size_t size, chemkit::MoleculeFile *file)
+{
+    bool sdf = name() == "sdf" || name() == "sd";
+
+    LineReader reader(data, size);
+    while(chemkit::Molecule *molecule = readMolecule(reader, sdf)){
+        file->addMolecule(boost::shared_ptr<chemkit::Molecule>(molecule));
+
+        if(!sdf){
+            break;
+        }
+    }
+
+    return true;
+}
+
 // --- Internal Methods ---------------------------------------------------- //
-bool MdlFileFormat::readMolFile(std::istream &input, chemkit::MoleculeFile *file)
+chemkit::Molecule* MdlFileFormat::readMolFile(std::istream &input)
 {
     // title line
     std::string title;
@@ -128,7 +484,7 @@ bool MdlFileFormat::readMolFile(std::istream &input, chemkit::MoleculeFile *file
 
     if(input.eof()){
         setErrorString("File is empty");
-        return false;
+        return 0;
     }
 
     // read counts line
@@ -139,34 +495,31 @@ bool MdlFileFormat::readMolFile(std::istream &input, chemkit::MoleculeFile *file
     int bondCount = readNumber(&countsLine[3], 3);
 
     // create molecule
-    boost::shared_ptr<chemkit::Molecule> molecule(new chemkit::Molecule);
+    chemkit::Molecule *molecule = new chemkit::Molecule;
     if(!title.empty()){
         molecule->setName(title);
     }
 
     // read atoms
-    readAtomBlock(input, molecule.get(), atomCount);
+    readAtomBlock(input, molecule, atomCount);
 
     // read bonds
-    readBondBlock(input, molecule.get(), bondCount);
+    readBondBlock(input, molecule, bondCount);
 
     // read properties
-    readPropertyBlock(input, molecule.get());
-
-    file->addMolecule(molecule);
+    readPropertyBlock(input, molecule);
 
-    return true;
+    return molecule;
 }
 
 bool MdlFileFormat::readSdfFile(std::istream &input, chemkit::MoleculeFile *file)
 {
     while(!input.eof()){
-        // read molecule
-        readMolFile(input, file);
-
-        // read data block
-        chemkit::Molecule *molecule = file->molecules().back().get();
-        readDataBlock(input, molecule);
+        // read molecule and its data block
+        chemkit::Molecule *molecule = readNext(input);
+        if(molecule){
+            file->addMolecule(boost::shared_ptr<chemkit::Molecule>(molecule));
+        }
     }
 
     // return false if we failed to read any molecules
@@ -188,21 +541,10 @@ bool MdlFileFormat::readAtomBlock(std::istream &input, chemkit::Molecule *molecu
             continue;
         }
 
-        double x, y, z;
-        char symbol[3];
-        sscanf(&line[0], "%10lf%10lf%10lf%3s", &x, &y, &z, symbol);
-
-        chemkit::Atom *atom = molecule->addAtom(symbol);
-        if(!atom->element().isValid()){
-            if(strcmp(symbol, "D") == 0){
-                atom->setIsotope(chemkit::Isotope(chemkit::Atom::Hydrogen, 2));
-            }
-            else if(strcmp(symbol, "T") == 0){
-                atom->setIsotope(chemkit::Isotope(chemkit::Atom::Hydrogen, 3));
-            }
-        }
-
-        atom->setPosition(x, y, z);
+        chemkit::Atom *atom = addAtom(molecule, readSymbol(&line[0], line.size()));
+        atom->setPosition(readReal(&line[0], line.size(), 0, 10),
+                          readReal(&line[0], line.size(), 10, 10),
+                          readReal(&line[0], line.size(), 20, 10));
     }
 
     return true;
@@ -313,8 +655,7 @@ void MdlFileFormat::writeMolFile(const chemkit::Molecule *molecule, std::ostream
 void MdlFileFormat::writeSdfFile(const chemkit::MoleculeFile *file, std::ostream &output)
 {
     foreach(const boost::shared_ptr<chemkit::Molecule> molecule, file->molecules()){
-        writeMolFile(molecule.get(), output);
-        output << "$$$$\n";
+        writeNext(molecule.get(), output);
     }
 }
 
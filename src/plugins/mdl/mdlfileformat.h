@@ -48,10 +48,17 @@ public:
 
     // input and output
     bool read(std::istream &input, chemkit::MoleculeFile *file) CHEMKIT_OVERRIDE;
+    bool readMappedFile(const boost::iostreams::mapped_file_source &input, chemkit::MoleculeFile *file) CHEMKIT_OVERRIDE;
     bool write(const chemkit::MoleculeFile *file, std::ostream &output) CHEMKIT_OVERRIDE;
+    bool supportsStreaming() const CHEMKIT_OVERRIDE;
+    chemkit::Molecule* readNext(std::istream &input) CHEMKIT_OVERRIDE;
+    bool writeNext(const chemkit::Molecule *molecule, std::ostream &output) CHEMKIT_OVERRIDE;
+    bool supportsChunkedReading() const CHEMKIT_OVERRIDE;
+    size_t findRecordStart(const char *data, size_t size, size_t position) const CHEMKIT_OVERRIDE;
+    bool readChunk(const char *data, size_t size, chemkit::MoleculeFile *file) CHEMKIT_OVERRIDE;
 
 private:
-    bool readMolFile(std::istream &input, chemkit::MoleculeFile *file);
+    chemkit::Molecule* readMolFile(std::istream &input);
     bool readSdfFile(std::istream &input, chemkit::MoleculeFile *file);
     bool readAtomBlock(std::istream &input, chemkit::Molecule *molecule, int atomCount);
     bool readBondBlock(std::istream &input, chemkit::Molecule *molecule, int bondCount);
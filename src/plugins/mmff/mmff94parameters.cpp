@@ -0,0 +1,4980 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+// This file was generated from data/mmff94.prm by
+// scripts/mmffparameters.py. Do not edit it by hand.
+
+#include "mmffparametersdata.h"
+
+namespace {
+
+const MmffParametersEntry<MmffBondStrechParameters> BondStrechParameters[] = {
+    {274, {4.258, 1.508}},
+    {276, {4.539, 1.482}},
+    {278, {4.190, 1.492}},
+    {280, {4.707, 1.459}},
+    {282, {4.766, 1.093}},
+    {284, {5.047, 1.418}},
+    {288, {5.084, 1.451}},
+    {290, {4.763, 1.458}},
+    {292, {4.664, 1.436}},
+    {294, {6.011, 1.360}},
+    {296, {2.974, 1.773}},
+    {298, {2.529, 1.949}},
+    {300, {1.706, 2.090}},
+    {302, {2.893, 1.805}},
+    {306, {2.841, 1.813}},
+    {308, {3.258, 1.772}},
+    {310, {2.866, 1.830}},
+    {312, {4.650, 1.504}},
+    {316, {4.286, 1.482}},
+    {322, {2.980, 1.810}},
+    {324, {2.790, 1.830}},
+    {340, {3.844, 1.480}},
+    {342, {7.915, 1.307}},
+    {346, {4.957, 1.486}},
+    {350, {6.114, 1.445}},
+    {352, {4.922, 1.446}},
+    {354, {3.830, 1.510}},
+    {358, {3.971, 1.472}},
+    {362, {3.844, 1.480}},
+    {364, {3.813, 1.482}},
+    {380, {4.267, 1.461}},
+    {382, {4.646, 1.454}},
+    {384, {4.166, 1.453}},
+    {386, {4.669, 1.461}},
+    {388, {4.329, 1.451}},
+    {394, {4.845, 1.424}},
+    {396, {4.456, 1.444}},
+    {398, {4.481, 1.471}},
+    {400, {4.518, 1.469}},
+    {406, {4.188, 1.459}},
+    {408, {4.217, 1.479}},
+    {416, {2.956, 1.801}},
+    {418, {2.608, 1.839}},
+    {422, {2.547, 1.858}},
+    {428, {4.593, 1.465}},
+    {432, {4.373, 1.477}},
+    {434, {4.512, 1.441}},
+    {548, {9.505, 1.333}},
+    {549, {5.310, 1.430}},
+    {551, {4.565, 1.468}},
+    {552, {9.538, 1.297}},
+    {553, {5.657, 1.415}},
+    {554, {5.170, 1.083}},
+    {556, {5.520, 1.373}},
+    {563, {6.385, 1.360}},
+    {564, {6.329, 1.362}},
+    {566, {6.283, 1.350}},
+    {568, {3.390, 1.720}},
+    {570, {3.413, 1.854}},
+    {572, {2.062, 2.025}},
+    {574, {3.896, 1.720}},
+    {578, {3.247, 1.773}},
+    {580, {3.789, 1.728}},
+    {582, {3.052, 1.811}},
+    {584, {4.593, 1.465}},
+    {588, {4.926, 1.448}},
+    {594, {3.750, 1.742}},
+    {604, {8.166, 1.331}},
+    {612, {5.207, 1.407}},
+    {614, {10.343, 1.250}},
+    {619, {5.007, 1.449}},
+    {623, {6.164, 1.368}},
+    {624, {6.110, 1.370}},
+    {626, {3.746, 1.505}},
+    {630, {4.928, 1.420}},
+    {634, {4.725, 1.430}},
+    {636, {7.466, 1.325}},
+    {654, {6.164, 1.368}},
+    {656, {6.246, 1.365}},
+    {668, {7.105, 1.336}},
+    {671, {6.030, 1.400}},
+    {673, {5.754, 1.411}},
+    {679, {4.685, 1.432}},
+    {688, {4.179, 1.700}},
+    {707, {6.357, 1.361}},
+    {823, {4.418, 1.489}},
+    {825, {5.135, 1.438}},
+    {826, {4.650, 1.101}},
+    {828, {5.801, 1.355}},
+    {830, {12.950, 1.222}},
+    {834, {10.077, 1.290}},
+    {835, {6.273, 1.364}},
+    {836, {5.829, 1.369}},
+    {838, {6.570, 1.340}},
+    {840, {3.449, 1.715}},
+    {846, {3.536, 1.748}},
+    {848, {4.735, 1.665}},
+    {850, {2.888, 1.808}},
+    {852, {3.394, 1.760}},
+    {856, {3.298, 1.530}},
+    {860, {4.593, 1.465}},
+    {866, {3.164, 1.792}},
+    {877, {4.481, 1.471}},
+    {886, {11.012, 1.237}},
+    {891, {4.488, 1.457}},
+    {895, {5.978, 1.375}},
+    {896, {6.110, 1.370}},
+    {898, {4.286, 1.482}},
+    {902, {4.928, 1.420}},
+    {906, {4.531, 1.440}},
+    {912, {5.412, 1.398}},
+    {918, {8.562, 1.290}},
+    {922, {7.637, 1.320}},
+    {924, {10.333, 1.280}},
+    {925, {2.771, 1.563}},
+    {926, {4.886, 1.422}},
+    {928, {4.907, 1.421}},
+    {931, {5.492, 1.422}},
+    {933, {5.163, 1.409}},
+    {940, {7.568, 1.322}},
+    {943, {5.468, 1.423}},
+    {945, {5.288, 1.431}},
+    {950, {8.217, 1.304}},
+    {964, {5.204, 1.639}},
+    {966, {4.191, 1.710}},
+    {973, {5.705, 1.413}},
+    {977, {6.719, 1.375}},
+    {1096, {15.206, 1.200}},
+    {1098, {5.726, 1.065}},
+    {1100, {7.193, 1.328}},
+    {1102, {14.916, 1.176}},
+    {1106, {15.589, 1.172}},
+    {1107, {7.041, 1.338}},
+    {1108, {6.824, 1.345}},
+    {1118, {4.330, 1.690}},
+    {1128, {5.178, 1.436}},
+    {1132, {5.400, 1.426}},
+    {1148, {10.227, 1.282}},
+    {1163, {5.445, 1.424}},
+    {1172, {16.582, 1.160}},
+    {1174, {6.947, 1.341}},
+    {1215, {5.633, 1.416}},
+    {1217, {5.492, 1.422}},
+    {1398, {2.254, 1.485}},
+    {1400, {4.852, 1.093}},
+    {1404, {5.191, 1.082}},
+    {1420, {5.176, 1.086}},
+    {1434, {5.306, 1.084}},
+    {1442, {3.256, 1.144}},
+    {1474, {5.633, 1.076}},
+    {1486, {5.531, 1.080}},
+    {1488, {5.506, 1.080}},
+    {1516, {5.506, 1.080}},
+    {1520, {5.633, 1.076}},
+    {1644, {4.088, 1.449}},
+    {1648, {5.059, 1.450}},
+    {1650, {4.491, 1.395}},
+    {1652, {5.982, 1.410}},
+    {1662, {4.757, 1.661}},
+    {1666, {5.779, 1.608}},
+    {1668, {5.326, 1.630}},
+    {1670, {4.661, 1.660}},
+    {1672, {5.623, 1.433}},
+    {1674, {7.794, 0.972}},
+    {1676, {4.556, 1.433}},
+    {1680, {7.403, 0.981}},
+    {1682, {5.243, 1.630}},
+    {1684, {5.481, 1.618}},
+    {1690, {7.839, 0.973}},
+    {1692, {9.359, 1.271}},
+    {1698, {7.143, 0.986}},
+    {1706, {5.614, 1.376}},
+    {1710, {4.629, 1.388}},
+    {1712, {4.609, 1.389}},
+    {1714, {6.754, 1.342}},
+    {1718, {3.937, 1.426}},
+    {1722, {4.321, 1.404}},
+    {1740, {5.117, 1.365}},
+    {1742, {4.772, 1.381}},
+    {1746, {7.128, 1.330}},
+    {1748, {4.792, 1.380}},
+    {1758, {7.324, 1.324}},
+    {1760, {6.664, 1.345}},
+    {1938, {8.770, 1.500}},
+    {1996, {9.329, 1.235}},
+    {2052, {9.129, 1.490}},
+    {2192, {3.264, 1.420}},
+    {2194, {4.581, 1.342}},
+    {2196, {3.909, 1.378}},
+    {2200, {3.371, 1.761}},
+    {2206, {4.060, 1.652}},
+    {2210, {3.901, 1.663}},
+    {2214, {4.254, 1.700}},
+    {2216, {5.107, 1.456}},
+    {2220, {4.223, 1.457}},
+    {2222, {6.490, 1.019}},
+    {2226, {4.629, 1.660}},
+    {2228, {4.027, 1.699}},
+    {2244, {3.775, 1.386}},
+    {2254, {3.435, 1.408}},
+    {2256, {3.710, 1.390}},
+    {2262, {3.977, 1.374}},
+    {2266, {4.267, 1.358}},
+    {2268, {5.519, 1.301}},
+    {2286, {4.229, 1.360}},
+    {2288, {3.995, 1.373}},
+    {2466, {7.256, 1.243}},
+    {2467, {3.808, 1.384}},
+    {2468, {4.480, 1.347}},
+    {2472, {3.635, 1.739}},
+    {2478, {3.791, 1.671}},
+    {2484, {4.465, 1.626}},
+    {2486, {3.687, 1.741}},
+    {2488, {4.401, 1.447}},
+    {2498, {5.379, 1.619}},
+    {2502, {6.230, 1.026}},
+    {2516, {3.223, 1.423}},
+    {2518, {5.095, 1.366}},
+    {2523, {5.529, 1.393}},
+    {2527, {4.685, 1.337}},
+    {2528, {4.382, 1.352}},
+    {2530, {5.650, 1.388}},
+    {2538, {4.857, 1.329}},
+    {2554, {7.291, 1.242}},
+    {2556, {4.991, 1.323}},
+    {2558, {3.825, 1.383}},
+    {2560, {4.602, 1.341}},
+    {2563, {6.824, 1.345}},
+    {2572, {4.749, 1.334}},
+    {2575, {6.824, 1.345}},
+    {2577, {5.458, 1.396}},
+    {2582, {6.752, 1.258}},
+    {2605, {6.644, 1.351}},
+    {2611, {3.909, 1.378}},
+    {2740, {3.977, 1.374}},
+    {2746, {3.110, 1.878}},
+    {2748, {1.967, 2.029}},
+    {2750, {3.593, 1.686}},
+    {2754, {3.930, 1.661}},
+    {2760, {4.240, 1.456}},
+    {2764, {4.970, 1.418}},
+    {2770, {3.820, 1.714}},
+    {2772, {3.651, 1.727}},
+    {2776, {6.663, 1.015}},
+    {2788, {3.960, 1.375}},
+    {2790, {4.898, 1.375}},
+    {2794, {5.482, 1.395}},
+    {2798, {4.382, 1.352}},
+    {2800, {3.841, 1.382}},
+    {2802, {7.466, 1.325}},
+    {2810, {3.524, 1.402}},
+    {2846, {6.137, 1.369}},
+    {2848, {5.952, 1.376}},
+    {3032, {6.339, 1.348}},
+    {3036, {5.296, 1.389}},
+    {3042, {6.019, 1.583}},
+    {3044, {6.204, 1.575}},
+    {3066, {6.511, 1.342}},
+    {3072, {4.187, 1.440}},
+    {3294, {2.978, 2.031}},
+    {3300, {2.808, 2.051}},
+    {3302, {2.838, 2.050}},
+    {3304, {2.859, 1.751}},
+    {3308, {3.056, 1.750}},
+    {3314, {3.063, 2.023}},
+    {3316, {2.448, 2.100}},
+    {3338, {3.378, 1.721}},
+    {3344, {3.737, 1.731}},
+    {3378, {3.714, 1.694}},
+    {3390, {3.413, 1.718}},
+    {3392, {3.649, 1.699}},
+    {3576, {2.767, 1.920}},
+    {3580, {2.928, 1.902}},
+    {3610, {3.031, 1.891}},
+    {3664, {3.031, 1.891}},
+    {3848, {0.884, 2.332}},
+    {3882, {1.781, 2.075}},
+    {4110, {2.531, 2.050}},
+    {4116, {2.214, 2.094}},
+    {4118, {2.022, 2.146}},
+    {4120, {2.757, 1.822}},
+    {4124, {3.802, 1.727}},
+    {4130, {2.319, 2.112}},
+    {4132, {2.359, 2.106}},
+    {4140, {3.750, 1.731}},
+    {4154, {3.565, 1.765}},
+    {4160, {3.859, 1.666}},
+    {4166, {3.221, 1.717}},
+    {4194, {3.993, 1.713}},
+    {4206, {3.724, 1.733}},
+    {4208, {3.548, 1.747}},
+    {4222, {4.014, 1.341}},
+    {4664, {2.397, 1.865}},
+    {4668, {2.566, 1.844}},
+    {4698, {3.098, 1.787}},
+    {4710, {4.900, 1.601}},
+    {4936, {3.172, 1.780}},
+    {4940, {2.757, 1.822}},
+    {4960, {10.748, 1.450}},
+    {4970, {3.281, 1.770}},
+    {4974, {3.504, 1.693}},
+    {4982, {3.301, 1.710}},
+    {4992, {6.186, 1.540}},
+    {5006, {4.432, 1.628}},
+    {5012, {2.568, 1.783}},
+    {5020, {5.510, 1.570}},
+    {5022, {3.524, 1.749}},
+    {5024, {3.856, 1.723}},
+    {5056, {4.150, 1.702}},
+    {5208, {2.288, 1.900}},
+    {5242, {3.072, 1.809}},
+    {5248, {4.470, 1.686}},
+    {5294, {3.219, 1.795}},
+    {5318, {1.600, 2.226}},
+    {5480, {3.663, 1.526}},
+    {5484, {4.251, 1.484}},
+    {5490, {2.718, 1.838}},
+    {5492, {2.588, 1.853}},
+    {5500, {3.977, 1.507}},
+    {5508, {4.171, 1.460}},
+    {5514, {3.740, 1.516}},
+    {5520, {4.784, 1.427}},
+    {5522, {4.286, 1.482}},
+    {5526, {3.737, 1.487}},
+    {5530, {3.844, 1.480}},
+    {6028, {3.969, 1.499}},
+    {6044, {3.785, 1.513}},
+    {6052, {4.103, 1.464}},
+    {6058, {4.481, 1.471}},
+    {6064, {4.188, 1.459}},
+    {6066, {5.071, 1.441}},
+    {6070, {4.070, 1.466}},
+    {6074, {4.311, 1.452}},
+    {6334, {7.112, 1.012}},
+    {6380, {6.339, 1.026}},
+    {6390, {6.610, 1.019}},
+    {6392, {5.899, 1.038}},
+    {6850, {1.514, 2.253}},
+    {6864, {8.296, 1.510}},
+    {6874, {3.586, 1.755}},
+    {6878, {4.370, 1.676}},
+    {6880, {4.629, 1.660}},
+    {6886, {3.237, 1.762}},
+    {6914, {4.356, 1.699}},
+    {6926, {3.711, 1.745}},
+    {6942, {3.001, 1.411}},
+    {6944, {3.744, 1.950}},
+    {7124, {1.414, 2.279}},
+    {7140, {3.395, 1.748}},
+    {7146, {3.207, 1.788}},
+    {7152, {4.870, 1.646}},
+    {7214, {2.959, 1.415}},
+    {7696, {6.576, 1.018}},
+    {7702, {6.265, 1.028}},
+    {7712, {6.413, 1.024}},
+    {8220, {9.579, 1.343}},
+    {8221, {5.355, 1.428}},
+    {8240, {8.447, 1.298}},
+    {8295, {5.274, 1.404}},
+    {8572, {7.880, 0.969}},
+    {8786, {9.756, 1.261}},
+    {8794, {9.420, 1.233}},
+    {8838, {7.926, 1.269}},
+    {8840, {4.398, 1.348}},
+    {8842, {6.098, 1.261}},
+    {8850, {8.427, 1.510}},
+    {8858, {10.648, 1.450}},
+    {8868, {8.594, 1.252}},
+    {9320, {6.163, 1.028}},
+    {9322, {4.347, 1.450}},
+    {9334, {4.401, 1.351}},
+    {9594, {9.767, 1.262}},
+    {9646, {12.760, 1.207}},
+    {9900, {6.529, 1.022}},
+    {9902, {6.744, 1.014}},
+    {9904, {6.490, 1.017}},
+    {9908, {6.610, 1.019}},
+    {9954, {6.980, 1.016}},
+    {10138, {5.573, 1.374}},
+    {10139, {5.178, 1.436}},
+    {10140, {5.737, 1.333}},
+    {10142, {5.978, 1.375}},
+    {10143, {5.650, 1.388}},
+    {10144, {6.168, 1.398}},
+    {10146, {4.537, 1.468}},
+    {10150, {4.764, 1.428}},
+    {10154, {4.705, 1.431}},
+    {10156, {6.191, 1.367}},
+    {10174, {6.615, 1.352}},
+    {10176, {5.055, 1.414}},
+    {10179, {5.092, 1.440}},
+    {10180, {7.432, 1.326}},
+    {10181, {5.055, 1.414}},
+    {10186, {5.724, 1.385}},
+    {10188, {7.137, 1.335}},
+    {10190, {6.095, 1.372}},
+    {10191, {5.178, 1.436}},
+    {10192, {6.161, 1.379}},
+    {10193, {5.265, 1.432}},
+    {10199, {4.725, 1.430}},
+    {10202, {5.396, 1.352}},
+    {10220, {6.719, 1.375}},
+    {10226, {3.987, 1.471}},
+    {10227, {4.531, 1.440}},
+    {10412, {5.002, 1.246}},
+    {10462, {7.299, 1.330}},
+    {10464, {6.978, 1.340}},
+    {10474, {5.036, 1.321}},
+    {10492, {6.218, 1.366}},
+    {10688, {4.101, 1.367}},
+    {10698, {3.524, 1.402}},
+    {10734, {6.301, 1.364}},
+    {10735, {6.137, 1.369}},
+    {10736, {6.357, 1.361}},
+    {10737, {5.482, 1.395}},
+    {10738, {5.513, 1.339}},
+    {10764, {6.137, 1.369}},
+    {10960, {4.248, 1.359}},
+    {10970, {4.305, 1.356}},
+    {10972, {4.727, 1.335}},
+    {10988, {6.817, 1.256}},
+    {11006, {6.733, 1.348}},
+    {11008, {6.644, 1.351}},
+    {11036, {5.900, 1.378}},
+    {11234, {5.029, 1.443}},
+    {11262, {5.577, 1.391}},
+    {11276, {7.137, 1.335}},
+    {11296, {4.519, 1.678}},
+    {11312, {5.222, 1.434}},
+    {11546, {16.223, 1.087}},
+    {11782, {4.211, 1.361}},
+    {11786, {3.710, 1.390}},
+    {11824, {5.389, 1.399}},
+    {12094, {3.589, 1.717}},
+    {12098, {3.374, 1.684}},
+    {12124, {3.711, 1.734}},
+    {12128, {3.910, 1.719}},
+    {12366, {5.119, 1.411}},
+    {12368, {5.076, 1.413}},
+    {12396, {5.724, 1.385}},
+    {12890, {12.192, 1.140}},
+    {13428, {6.812, 0.991}},
+    {13976, {7.100, 0.987}},
+    {15074, {7.227, 1.319}},
+    {15084, {3.977, 1.374}},
+    {15088, {5.529, 1.393}},
+    {15120, {7.500, 1.324}},
+    {15346, {4.137, 1.383}},
+    {15358, {5.900, 1.378}},
+    {15392, {6.470, 1.357}},
+    {15631, {5.400, 1.426}},
+    {15633, {5.135, 1.438}},
+    {15902, {6.794, 1.346}},
+    {15904, {6.164, 1.368}},
+    {16174, {5.787, 1.360}},
+    {16178, {4.756, 1.388}},
+    {16204, {6.127, 1.364}},
+    {16208, {7.064, 1.332}},
+    {16212, {3.855, 1.431}},
+    {16442, {15.749, 1.170}},
+    {16990, {6.947, 1.341}},
+    {16992, {6.273, 1.364}},
+    {17263, {5.729, 1.412}},
+    {17264, {7.118, 1.377}},
+    {17268, {8.326, 1.313}},
+    {17280, {4.503, 1.679}},
+    {17292, {7.434, 1.352}},
+    {17298, {7.778, 1.316}},
+    {17536, {4.313, 1.418}},
+    {17537, {4.926, 1.448}},
+    {17538, {8.258, 1.335}},
+    {17540, {4.456, 1.369}},
+    {17564, {5.492, 1.422}},
+    {17570, {5.824, 1.381}},
+    {17572, {6.794, 1.346}},
+    {17812, {7.243, 1.323}},
+    {17836, {8.447, 1.298}},
+    {17842, {5.223, 1.313}},
+    {17844, {5.622, 1.297}},
+    {18084, {3.874, 1.368}},
+    {18108, {6.385, 1.360}},
+    {18114, {3.960, 1.375}},
+    {18358, {6.085, 1.280}},
+    {19462, {2.852, 1.423}},
+    {19730, {2.628, 2.035}},
+    {20824, {4.286, 1.357}},
+    {20828, {6.824, 1.345}},
+    {21372, {5.573, 1.374}},
+    {21374, {8.890, 1.287}},
+    {21378, {5.046, 1.381}},
+    {21646, {6.408, 1.269}},
+    {21650, {4.305, 1.356}},
+    {21922, {8.237, 1.335}},
+};
+
+const MmffParametersEntry<MmffAngleBendParameters> AngleBendParameters[] = {
+    {166464, {0.000, 108.900}},
+    {167697, {0.851, 109.608}},
+    {167706, {0.736, 109.445}},
+    {167715, {0.777, 107.517}},
+    {167724, {1.006, 110.265}},
+    {167733, {0.636, 110.549}},
+    {167742, {0.992, 108.133}},
+    {167760, {0.777, 108.290}},
+    {167769, {1.136, 108.194}},
+    {167778, {1.050, 109.960}},
+    {167787, {1.225, 108.313}},
+    {167796, {1.056, 108.679}},
+    {167805, {1.078, 106.820}},
+    {167814, {0.980, 109.945}},
+    {167823, {0.743, 107.397}},
+    {167841, {1.089, 108.578}},
+    {167850, {1.093, 109.315}},
+    {167859, {0.755, 115.436}},
+    {167868, {1.021, 108.659}},
+    {167886, {1.001, 110.125}},
+    {167913, {0.803, 112.356}},
+    {167922, {0.833, 109.879}},
+    {167994, {1.179, 106.493}},
+    {168021, {0.756, 108.617}},
+    {168039, {0.927, 109.170}},
+    {168048, {1.130, 108.678}},
+    {168057, {0.330, 98.422}},
+    {168075, {1.135, 108.019}},
+    {168093, {1.197, 105.028}},
+    {168174, {1.173, 106.424}},
+    {168183, {1.150, 107.604}},
+    {168192, {1.199, 110.371}},
+    {168201, {1.012, 109.900}},
+    {168210, {1.179, 106.327}},
+    {168237, {1.125, 109.311}},
+    {168255, {1.006, 110.058}},
+    {168264, {0.988, 111.064}},
+    {168291, {1.216, 104.557}},
+    {168300, {1.018, 107.195}},
+    {168345, {1.160, 104.658}},
+    {168390, {1.012, 109.850}},
+    {168408, {0.947, 113.327}},
+    {168417, {1.108, 109.837}},
+    {168930, {1.113, 111.453}},
+    {168939, {0.667, 104.829}},
+    {168948, {1.022, 109.873}},
+    {168957, {0.632, 110.292}},
+    {168966, {1.074, 108.699}},
+    {168984, {0.884, 111.553}},
+    {168993, {1.118, 109.577}},
+    {169002, {1.160, 107.963}},
+    {169011, {1.192, 110.419}},
+    {169020, {1.070, 109.410}},
+    {169047, {1.078, 109.560}},
+    {169065, {1.077, 109.434}},
+    {169074, {1.188, 105.110}},
+    {169092, {1.053, 107.448}},
+    {169110, {0.942, 114.020}},
+    {169137, {0.893, 106.815}},
+    {169146, {1.029, 99.065}},
+    {169218, {1.066, 111.817}},
+    {169245, {0.985, 111.446}},
+    {169263, {1.124, 109.513}},
+    {169272, {1.149, 108.270}},
+    {169317, {1.232, 103.978}},
+    {169479, {0.935, 114.692}},
+    {169515, {1.224, 104.687}},
+    {170163, {0.974, 111.746}},
+    {170172, {1.019, 109.850}},
+    {170181, {0.650, 108.385}},
+    {170190, {0.528, 104.112}},
+    {170208, {1.197, 105.837}},
+    {170217, {1.201, 105.535}},
+    {170226, {0.634, 102.655}},
+    {170235, {1.189, 110.328}},
+    {170244, {1.136, 106.064}},
+    {170253, {1.147, 103.645}},
+    {170262, {1.048, 106.404}},
+    {170271, {1.125, 107.192}},
+    {170289, {1.092, 108.602}},
+    {170298, {1.120, 108.119}},
+    {170316, {0.969, 111.830}},
+    {170334, {0.999, 110.522}},
+    {170370, {0.742, 116.555}},
+    {170442, {1.141, 107.871}},
+    {170469, {1.011, 109.833}},
+    {170487, {1.136, 108.751}},
+    {170496, {1.174, 106.941}},
+    {170505, {1.033, 108.216}},
+    {170541, {1.221, 104.281}},
+    {170703, {1.069, 107.077}},
+    {170712, {1.028, 109.186}},
+    {170865, {1.167, 107.327}},
+    {171396, {0.954, 114.186}},
+    {171405, {0.615, 111.417}},
+    {171414, {1.273, 109.977}},
+    {171432, {1.099, 111.063}},
+    {171441, {1.187, 106.750}},
+    {171450, {1.117, 110.488}},
+    {171477, {1.021, 110.047}},
+    {171495, {1.028, 112.432}},
+    {171522, {1.187, 105.351}},
+    {171558, {1.174, 102.556}},
+    {171594, {0.853, 108.999}},
+    {171666, {1.148, 108.160}},
+    {171693, {0.993, 111.424}},
+    {172629, {0.516, 108.836}},
+    {172638, {0.781, 108.577}},
+    {172656, {0.653, 110.297}},
+    {172665, {0.733, 109.894}},
+    {172674, {0.740, 107.646}},
+    {172683, {0.875, 107.897}},
+    {172692, {0.698, 108.162}},
+    {172701, {0.613, 106.049}},
+    {172710, {0.508, 113.019}},
+    {172719, {0.576, 109.609}},
+    {172737, {0.634, 107.944}},
+    {172746, {0.663, 106.855}},
+    {172755, {0.450, 113.195}},
+    {172764, {0.706, 111.000}},
+    {172782, {0.618, 110.380}},
+    {172809, {0.487, 109.486}},
+    {172818, {0.466, 111.172}},
+    {172890, {0.872, 106.224}},
+    {172899, {0.644, 125.663}},
+    {172917, {0.627, 109.491}},
+    {172935, {0.811, 106.299}},
+    {172944, {0.719, 109.870}},
+    {172953, {0.525, 108.904}},
+    {172971, {0.692, 109.083}},
+    {172989, {0.741, 105.197}},
+    {172998, {0.719, 106.735}},
+    {173070, {0.874, 106.973}},
+    {173079, {0.861, 108.507}},
+    {173088, {0.814, 108.223}},
+    {173097, {0.626, 110.420}},
+    {173106, {0.750, 105.481}},
+    {173133, {0.710, 109.227}},
+    {173142, {0.655, 113.035}},
+    {173151, {0.621, 110.467}},
+    {173160, {0.622, 110.457}},
+    {173187, {0.732, 106.474}},
+    {173196, {0.748, 103.817}},
+    {173232, {0.547, 116.576}},
+    {173241, {0.633, 107.153}},
+    {173286, {0.640, 109.078}},
+    {173304, {0.684, 105.144}},
+    {173313, {0.721, 107.870}},
+    {173862, {1.156, 111.368}},
+    {173880, {1.333, 112.223}},
+    {173889, {1.224, 116.950}},
+    {173898, {1.432, 108.568}},
+    {173907, {1.593, 106.900}},
+    {173943, {1.273, 112.012}},
+    {173961, {1.348, 108.655}},
+    {173979, {0.906, 117.214}},
+    {173988, {1.293, 108.202}},
+    {174006, {1.287, 108.913}},
+    {174033, {1.171, 103.598}},
+    {174042, {0.888, 118.433}},
+    {174114, {1.257, 114.975}},
+    {174141, {0.878, 107.978}},
+    {174159, {1.485, 106.464}},
+    {174168, {1.371, 110.779}},
+    {174177, {1.333, 106.467}},
+    {174213, {1.523, 104.438}},
+    {174321, {1.308, 108.467}},
+    {174375, {1.351, 106.535}},
+    {174384, {1.238, 111.308}},
+    {176328, {1.203, 110.856}},
+    {176337, {1.133, 114.080}},
+    {176346, {1.258, 108.683}},
+    {176364, {1.217, 107.251}},
+    {176391, {1.120, 112.356}},
+    {176436, {1.116, 109.353}},
+    {176481, {1.143, 98.698}},
+    {176562, {1.138, 113.412}},
+    {176589, {1.090, 110.992}},
+    {176607, {1.364, 104.193}},
+    {176616, {0.964, 123.962}},
+    {176625, {1.234, 103.868}},
+    {176643, {1.137, 113.596}},
+    {176661, {1.583, 96.139}},
+    {176769, {1.038, 114.266}},
+    {176823, {1.104, 110.598}},
+    {176832, {1.156, 108.127}},
+    {177570, {1.209, 110.720}},
+    {177588, {1.173, 109.152}},
+    {177615, {1.024, 117.465}},
+    {177705, {1.060, 102.432}},
+    {177813, {1.077, 111.565}},
+    {177840, {1.084, 116.728}},
+    {178200, {1.163, 107.509}},
+    {178794, {1.191, 111.995}},
+    {178839, {1.161, 110.502}},
+    {178857, {1.269, 105.509}},
+    {178884, {1.220, 104.838}},
+    {178902, {1.132, 109.262}},
+    {178929, {1.015, 104.822}},
+    {179037, {1.107, 110.423}},
+    {179064, {1.264, 108.536}},
+    {179073, {1.087, 110.961}},
+    {179217, {1.268, 103.622}},
+    {180027, {1.638, 106.081}},
+    {180063, {1.254, 109.517}},
+    {180108, {1.243, 107.637}},
+    {180153, {1.244, 97.532}},
+    {180234, {1.338, 108.669}},
+    {180243, {1.556, 110.367}},
+    {180261, {1.151, 112.278}},
+    {180297, {1.301, 105.053}},
+    {180333, {1.550, 100.991}},
+    {180585, {1.303, 106.569}},
+    {180603, {0.884, 114.378}},
+    {181260, {1.096, 110.422}},
+    {181287, {1.146, 111.064}},
+    {181314, {1.299, 104.827}},
+    {181323, {0.932, 108.971}},
+    {181332, {1.081, 108.605}},
+    {181350, {1.097, 108.028}},
+    {181377, {0.989, 106.118}},
+    {181485, {1.076, 109.030}},
+    {181503, {1.150, 110.359}},
+    {181557, {1.353, 101.430}},
+    {181719, {1.071, 109.474}},
+    {181728, {1.093, 108.338}},
+    {182493, {1.093, 111.645}},
+    {182556, {1.084, 106.534}},
+    {182574, {1.068, 107.469}},
+    {182781, {1.305, 101.383}},
+    {183780, {1.021, 107.718}},
+    {184959, {1.147, 111.896}},
+    {185049, {1.059, 103.308}},
+    {185130, {1.222, 107.318}},
+    {185157, {1.051, 110.959}},
+    {185184, {1.149, 111.005}},
+    {185193, {1.263, 100.981}},
+    {185391, {1.060, 110.596}},
+    {185400, {1.059, 110.703}},
+    {185481, {1.289, 105.029}},
+    {187605, {1.065, 110.049}},
+    {188676, {1.121, 107.960}},
+    {188694, {1.283, 101.125}},
+    {188829, {1.203, 104.390}},
+    {188901, {1.287, 105.273}},
+    {189072, {1.093, 109.683}},
+    {190206, {0.772, 119.506}},
+    {191124, {1.229, 99.084}},
+    {191277, {1.052, 107.428}},
+    {191349, {1.169, 106.335}},
+    {193590, {0.990, 111.226}},
+    {193617, {0.885, 107.293}},
+    {193698, {1.045, 112.940}},
+    {193725, {1.037, 108.586}},
+    {193797, {1.182, 106.181}},
+    {197289, {0.551, 127.138}},
+    {197370, {0.779, 119.271}},
+    {197397, {0.784, 113.945}},
+    {197424, {1.062, 102.417}},
+    {197586, {0.916, 110.234}},
+    {198522, {0.625, 118.700}},
+    {208386, {1.216, 109.167}},
+    {208413, {1.075, 111.275}},
+    {208449, {1.048, 112.238}},
+    {208647, {1.077, 111.412}},
+    {208737, {1.142, 110.240}},
+    {212085, {0.986, 111.315}},
+    {212112, {1.129, 109.188}},
+    {212139, {1.074, 111.478}},
+    {212157, {1.259, 102.800}},
+    {212265, {0.981, 112.047}},
+    {212328, {1.175, 102.239}},
+    {212364, {1.100, 109.983}},
+    {212454, {1.005, 110.638}},
+    {212481, {1.176, 107.040}},
+    {214551, {1.260, 108.547}},
+    {215784, {1.182, 112.005}},
+    {215919, {1.322, 105.786}},
+    {215991, {1.032, 114.505}},
+    {216000, {1.000, 116.376}},
+    {217017, {1.082, 105.400}},
+    {217215, {1.061, 107.112}},
+    {217377, {1.093, 110.553}},
+    {221949, {1.391, 102.088}},
+    {332928, {0.000, 119.400}},
+    {332929, {0.000, 118.200}},
+    {332930, {0.000, 120.800}},
+    {332931, {0.000, 62.600}},
+    {332934, {0.000, 60.500}},
+    {334161, {0.752, 118.043}},
+    {334170, {0.672, 122.141}},
+    {334171, {0.684, 116.929}},
+    {334180, {0.698, 116.104}},
+    {334188, {0.828, 125.045}},
+    {334189, {0.846, 121.613}},
+    {334197, {0.446, 120.108}},
+    {334206, {1.160, 115.518}},
+    {334242, {1.015, 116.707}},
+    {334260, {0.983, 115.343}},
+    {334269, {0.964, 115.395}},
+    {334287, {0.939, 119.465}},
+    {334305, {0.883, 121.868}},
+    {334314, {0.961, 117.918}},
+    {334332, {0.880, 118.310}},
+    {334350, {0.873, 119.114}},
+    {334422, {0.826, 124.605}},
+    {334486, {0.721, 116.064}},
+    {334512, {0.982, 118.515}},
+    {334557, {1.121, 109.921}},
+    {334656, {1.006, 117.192}},
+    {334720, {0.768, 127.945}},
+    {334729, {0.966, 113.884}},
+    {334756, {1.115, 110.185}},
+    {335395, {0.747, 121.550}},
+    {335396, {0.796, 126.284}},
+    {335400, {0.173, 60.549}},
+    {335404, {0.545, 111.297}},
+    {335405, {0.893, 118.456}},
+    {335408, {0.184, 59.145}},
+    {335413, {0.902, 121.053}},
+    {335414, {0.889, 119.794}},
+    {335421, {0.535, 121.004}},
+    {335422, {0.463, 118.442}},
+    {335430, {1.117, 121.267}},
+    {335431, {1.204, 114.538}},
+    {335458, {0.960, 123.536}},
+    {335459, {1.045, 116.273}},
+    {335466, {1.003, 120.828}},
+    {335467, {1.026, 117.324}},
+    {335475, {1.089, 119.100}},
+    {335476, {1.090, 116.828}},
+    {335484, {0.931, 120.132}},
+    {335485, {0.957, 117.526}},
+    {335493, {0.867, 122.717}},
+    {335502, {0.818, 122.584}},
+    {335503, {0.819, 122.344}},
+    {335511, {0.931, 121.553}},
+    {335512, {0.949, 119.466}},
+    {335529, {0.977, 117.167}},
+    {335538, {1.044, 114.561}},
+    {335547, {0.668, 124.721}},
+    {335556, {0.931, 117.784}},
+    {335574, {0.809, 126.820}},
+    {335577, {0.149, 66.165}},
+    {335601, {0.700, 123.830}},
+    {335682, {1.066, 116.151}},
+    {335691, {0.911, 137.103}},
+    {335710, {0.598, 117.508}},
+    {335711, {0.817, 124.229}},
+    {335728, {0.976, 122.360}},
+    {335736, {0.773, 126.830}},
+    {335737, {0.976, 120.132}},
+    {335745, {0.432, 110.442}},
+    {335763, {1.144, 111.808}},
+    {335781, {1.194, 109.231}},
+    {335782, {1.062, 113.984}},
+    {335790, {1.005, 121.534}},
+    {335871, {0.995, 121.154}},
+    {335880, {1.234, 108.879}},
+    {335934, {0.808, 135.269}},
+    {335944, {0.948, 118.277}},
+    {335953, {0.866, 123.528}},
+    {335954, {0.859, 121.998}},
+    {335980, {1.132, 112.136}},
+    {336024, {0.770, 134.269}},
+    {336106, {1.078, 116.541}},
+    {336629, {0.853, 120.370}},
+    {336638, {0.878, 119.739}},
+    {336646, {0.487, 117.291}},
+    {336655, {1.142, 116.738}},
+    {336683, {1.005, 117.648}},
+    {336691, {1.039, 115.698}},
+    {336700, {1.150, 112.876}},
+    {336709, {0.997, 114.732}},
+    {336718, {0.946, 116.643}},
+    {336727, {0.891, 117.111}},
+    {336736, {1.023, 114.635}},
+    {336781, {0.870, 119.265}},
+    {336799, {0.816, 123.510}},
+    {336871, {1.025, 112.209}},
+    {336907, {1.099, 111.723}},
+    {336916, {1.141, 118.767}},
+    {336935, {0.868, 119.758}},
+    {336961, {1.024, 116.408}},
+    {336970, {0.855, 119.505}},
+    {336988, {1.046, 114.257}},
+    {337006, {1.077, 112.401}},
+    {337015, {1.066, 114.841}},
+    {337862, {0.832, 124.158}},
+    {337869, {0.573, 121.000}},
+    {337870, {0.545, 120.000}},
+    {337907, {0.973, 120.845}},
+    {337960, {0.906, 122.447}},
+    {337987, {0.947, 119.537}},
+    {338095, {0.819, 126.938}},
+    {338159, {0.864, 121.093}},
+    {338185, {1.083, 114.355}},
+    {338230, {1.158, 109.426}},
+    {338393, {0.860, 122.442}},
+    {339093, {0.365, 119.523}},
+    {339102, {0.589, 108.757}},
+    {339130, {0.643, 117.000}},
+    {339138, {0.667, 114.859}},
+    {339147, {0.795, 108.186}},
+    {339156, {0.622, 110.650}},
+    {339165, {0.566, 113.513}},
+    {339183, {0.546, 119.562}},
+    {339201, {0.492, 124.000}},
+    {339210, {0.548, 119.053}},
+    {339246, {0.534, 120.000}},
+    {339273, {0.395, 124.000}},
+    {339318, {0.572, 120.000}},
+    {339363, {0.682, 124.164}},
+    {339382, {0.491, 117.423}},
+    {339400, {0.655, 115.724}},
+    {339408, {0.568, 112.322}},
+    {339417, {0.294, 123.706}},
+    {339453, {0.728, 107.774}},
+    {339543, {0.651, 116.000}},
+    {339606, {0.568, 125.344}},
+    {339616, {0.550, 120.000}},
+    {339625, {0.546, 120.000}},
+    {339696, {0.531, 122.009}},
+    {339778, {0.665, 115.000}},
+    {340354, {1.214, 120.520}},
+    {340362, {1.311, 115.921}},
+    {340470, {1.080, 120.560}},
+    {340587, {1.172, 132.391}},
+    {340606, {1.198, 114.441}},
+    {340632, {1.239, 119.073}},
+    {340677, {1.637, 102.438}},
+    {344035, {1.098, 119.802}},
+    {344080, {0.915, 127.574}},
+    {344279, {0.981, 119.536}},
+    {344305, {0.922, 130.521}},
+    {345276, {1.144, 112.723}},
+    {345303, {1.078, 117.519}},
+    {345393, {1.144, 100.818}},
+    {345502, {1.021, 117.139}},
+    {345528, {0.988, 126.034}},
+    {345537, {0.951, 120.000}},
+    {347724, {1.012, 119.105}},
+    {347769, {1.110, 114.206}},
+    {347778, {1.201, 110.553}},
+    {347787, {0.704, 126.646}},
+    {347796, {0.903, 120.563}},
+    {347886, {0.892, 122.753}},
+    {347950, {0.976, 116.136}},
+    {348021, {1.076, 115.543}},
+    {349002, {1.132, 113.616}},
+    {351423, {0.996, 123.027}},
+    {351603, {0.950, 133.654}},
+    {351622, {1.007, 115.757}},
+    {351648, {0.895, 128.924}},
+    {353889, {1.051, 117.955}},
+    {355294, {1.183, 106.608}},
+    {360054, {0.841, 122.108}},
+    {360057, {0.180, 58.963}},
+    {360190, {0.806, 124.693}},
+    {369982, {0.849, 123.816}},
+    {376102, {0.991, 128.032}},
+    {382248, {0.949, 128.436}},
+    {382392, {1.072, 120.987}},
+    {382456, {0.922, 124.268}},
+    {382465, {0.955, 121.881}},
+    {382536, {0.820, 135.317}},
+    {388413, {1.284, 108.095}},
+    {411842, {0.888, 120.342}},
+    {499392, {0.000, 117.300}},
+    {499393, {0.000, 115.800}},
+    {499396, {0.000, 90.800}},
+    {499399, {0.000, 91.100}},
+    {499400, {0.000, 88.900}},
+    {500625, {1.151, 118.016}},
+    {500635, {1.106, 116.853}},
+    {500644, {1.214, 114.612}},
+    {500661, {0.808, 117.280}},
+    {500670, {1.043, 109.716}},
+    {500679, {0.938, 124.410}},
+    {500697, {0.978, 119.788}},
+    {500698, {1.038, 115.132}},
+    {500706, {0.984, 112.735}},
+    {500724, {1.007, 113.972}},
+    {500751, {1.024, 113.612}},
+    {500760, {0.949, 119.986}},
+    {500778, {0.732, 134.097}},
+    {500796, {0.830, 120.312}},
+    {500814, {0.928, 115.001}},
+    {500931, {1.058, 122.808}},
+    {500950, {1.051, 115.191}},
+    {500968, {1.178, 107.895}},
+    {500976, {0.979, 118.457}},
+    {500985, {0.897, 116.681}},
+    {501003, {1.046, 113.731}},
+    {501021, {1.132, 109.019}},
+    {501075, {1.160, 116.573}},
+    {501093, {1.052, 115.065}},
+    {501102, {1.135, 111.322}},
+    {501139, {1.162, 108.129}},
+    {501174, {1.119, 111.523}},
+    {501184, {0.909, 117.001}},
+    {501193, {0.887, 118.253}},
+    {501219, {1.142, 110.666}},
+    {501282, {1.010, 116.851}},
+    {501291, {0.646, 128.037}},
+    {501860, {0.976, 112.562}},
+    {501864, {0.157, 62.792}},
+    {501869, {0.957, 113.239}},
+    {501886, {0.901, 115.350}},
+    {501895, {0.932, 106.510}},
+    {501904, {0.936, 122.623}},
+    {501922, {0.831, 122.253}},
+    {501923, {1.120, 111.408}},
+    {501931, {1.042, 111.721}},
+    {501949, {0.901, 120.769}},
+    {501976, {1.057, 112.105}},
+    {501985, {0.881, 124.850}},
+    {502039, {0.969, 113.027}},
+    {502066, {0.853, 109.794}},
+    {502175, {0.973, 112.935}},
+    {502193, {1.197, 107.592}},
+    {502201, {0.910, 123.437}},
+    {502228, {1.105, 111.169}},
+    {502318, {1.082, 114.032}},
+    {502327, {1.012, 118.588}},
+    {502336, {1.186, 107.278}},
+    {502345, {1.151, 108.909}},
+    {502409, {0.918, 116.947}},
+    {502418, {1.033, 110.084}},
+    {502444, {1.022, 117.597}},
+    {503093, {0.822, 121.775}},
+    {503099, {1.280, 89.965}},
+    {503110, {0.943, 113.762}},
+    {503119, {0.935, 103.030}},
+    {503128, {0.919, 117.024}},
+    {503146, {1.050, 115.704}},
+    {503155, {1.129, 110.421}},
+    {503173, {1.053, 111.492}},
+    {503200, {1.390, 97.562}},
+    {503209, {1.092, 111.888}},
+    {503245, {0.977, 110.910}},
+    {503263, {1.010, 110.295}},
+    {503342, {1.353, 87.789}},
+    {503399, {0.932, 114.949}},
+    {503417, {1.237, 105.384}},
+    {503425, {1.003, 117.124}},
+    {503434, {0.790, 124.361}},
+    {503470, {0.919, 121.023}},
+    {503542, {1.170, 109.169}},
+    {503633, {0.981, 112.685}},
+    {503642, {0.880, 118.840}},
+    {503668, {1.119, 111.860}},
+    {504343, {1.269, 111.750}},
+    {504352, {1.126, 120.852}},
+    {504370, {1.192, 109.833}},
+    {504623, {0.964, 114.081}},
+    {505557, {0.594, 116.699}},
+    {505566, {0.819, 108.253}},
+    {505575, {0.670, 123.439}},
+    {505593, {0.623, 119.491}},
+    {505594, {0.638, 117.168}},
+    {505602, {0.874, 111.761}},
+    {505656, {0.522, 124.405}},
+    {505846, {0.564, 116.400}},
+    {505872, {0.959, 111.684}},
+    {505989, {0.644, 118.000}},
+    {505998, {0.816, 115.471}},
+    {506080, {0.559, 118.000}},
+    {506089, {0.566, 117.000}},
+    {506115, {0.700, 113.698}},
+    {506790, {1.678, 109.094}},
+    {506799, {1.155, 124.425}},
+    {506817, {1.275, 119.478}},
+    {506818, {1.416, 111.868}},
+    {506826, {1.405, 112.187}},
+    {506880, {1.269, 116.317}},
+    {506916, {1.182, 113.581}},
+    {506920, {1.495, 93.130}},
+    {506934, {1.276, 110.826}},
+    {507013, {1.530, 93.191}},
+    {507070, {0.808, 102.881}},
+    {507088, {1.611, 104.655}},
+    {507096, {1.371, 113.565}},
+    {507105, {1.477, 102.658}},
+    {507123, {1.330, 114.183}},
+    {507168, {1.315, 115.328}},
+    {507195, {1.409, 120.427}},
+    {507222, {1.495, 110.510}},
+    {507294, {1.421, 112.542}},
+    {507304, {1.339, 109.082}},
+    {507313, {1.267, 111.993}},
+    {507457, {1.256, 113.698}},
+    {508042, {1.147, 127.084}},
+    {508050, {0.907, 127.152}},
+    {508068, {0.984, 130.049}},
+    {508095, {1.101, 123.313}},
+    {508140, {0.713, 129.492}},
+    {508158, {1.093, 121.851}},
+    {508231, {0.972, 129.010}},
+    {508294, {0.734, 119.968}},
+    {508312, {1.352, 116.727}},
+    {508329, {1.281, 112.087}},
+    {508347, {1.163, 124.549}},
+    {508392, {1.114, 127.879}},
+    {508447, {1.288, 114.184}},
+    {508455, {1.258, 120.056}},
+    {508464, {1.175, 123.854}},
+    {508483, {1.323, 117.081}},
+    {508518, {1.129, 129.349}},
+    {508528, {1.036, 126.456}},
+    {508537, {1.071, 124.133}},
+    {508663, {0.955, 132.047}},
+    {510490, {1.119, 120.094}},
+    {510491, {1.021, 124.131}},
+    {510498, {1.105, 120.697}},
+    {510499, {1.154, 116.608}},
+    {510516, {1.056, 118.046}},
+    {510543, {1.036, 119.679}},
+    {510544, {1.042, 118.787}},
+    {510553, {0.936, 127.665}},
+    {510561, {1.035, 117.902}},
+    {510570, {1.121, 114.698}},
+    {510588, {0.951, 120.437}},
+    {510606, {1.040, 116.861}},
+    {510633, {0.955, 109.442}},
+    {510723, {1.054, 134.470}},
+    {510742, {0.997, 119.569}},
+    {510743, {1.060, 114.740}},
+    {510768, {0.844, 128.078}},
+    {510769, {1.018, 124.152}},
+    {510777, {1.114, 112.513}},
+    {510813, {1.497, 102.140}},
+    {510896, {1.244, 108.056}},
+    {510922, {1.038, 118.096}},
+    {510976, {1.004, 120.054}},
+    {510985, {1.053, 117.060}},
+    {511129, {0.959, 124.150}},
+    {511722, {1.612, 114.923}},
+    {511767, {1.167, 112.206}},
+    {511776, {1.005, 123.150}},
+    {511794, {1.299, 106.052}},
+    {511812, {1.019, 115.213}},
+    {511816, {1.338, 92.724}},
+    {511830, {1.076, 113.651}},
+    {511909, {1.438, 90.508}},
+    {511947, {1.223, 122.649}},
+    {511966, {1.101, 112.495}},
+    {511984, {1.434, 104.419}},
+    {511992, {1.093, 119.697}},
+    {512019, {1.144, 115.929}},
+    {512091, {1.375, 114.685}},
+    {512127, {1.286, 109.590}},
+    {512136, {1.200, 113.168}},
+    {512200, {1.075, 114.623}},
+    {512209, {1.098, 113.233}},
+    {512335, {1.182, 109.543}},
+    {513216, {1.296, 113.244}},
+    {513531, {0.850, 120.964}},
+    {514440, {1.095, 115.284}},
+    {514648, {0.965, 117.217}},
+    {514746, {1.110, 116.502}},
+    {517887, {1.109, 115.620}},
+    {517896, {0.981, 124.329}},
+    {517905, {1.191, 110.607}},
+    {517914, {1.061, 118.034}},
+    {517936, {1.345, 91.041}},
+    {518023, {1.026, 113.753}},
+    {518086, {1.037, 113.305}},
+    {518112, {1.066, 117.388}},
+    {518266, {0.896, 122.260}},
+    {518355, {1.407, 102.583}},
+    {518418, {1.076, 119.117}},
+    {519247, {0.991, 117.695}},
+    {519291, {1.030, 130.230}},
+    {519310, {0.934, 121.415}},
+    {519328, {1.004, 123.196}},
+    {519534, {0.963, 126.347}},
+    {519544, {1.006, 117.454}},
+    {519553, {1.064, 114.110}},
+    {520353, {0.939, 123.528}},
+    {521758, {0.948, 118.188}},
+    {524056, {1.495, 94.800}},
+    {524074, {1.286, 89.459}},
+    {524212, {1.282, 89.733}},
+    {524263, {1.384, 90.526}},
+    {526518, {0.932, 115.334}},
+    {526522, {1.496, 83.915}},
+    {526654, {0.940, 114.995}},
+    {530326, {0.677, 123.404}},
+    {530595, {0.661, 131.520}},
+    {545015, {0.933, 115.566}},
+    {545041, {0.987, 118.790}},
+    {545050, {0.864, 119.565}},
+    {545068, {1.125, 110.383}},
+    {545086, {1.120, 110.268}},
+    {545167, {1.033, 117.645}},
+    {545239, {1.085, 114.132}},
+    {545249, {0.934, 116.163}},
+    {545258, {0.955, 114.701}},
+    {545284, {1.084, 114.460}},
+    {547481, {1.231, 112.582}},
+    {548712, {1.146, 117.002}},
+    {548920, {0.888, 126.089}},
+    {548929, {1.145, 110.889}},
+    {549027, {0.790, 122.163}},
+    {554949, {1.382, 105.849}},
+    {567289, {1.267, 104.747}},
+    {578306, {0.989, 113.280}},
+    {665856, {0.000, 180.000}},
+    {665857, {0.000, 180.000}},
+    {667116, {0.423, 180.000}},
+    {667458, {0.463, 180.000}},
+    {668322, {0.442, 180.000}},
+    {668341, {0.432, 180.000}},
+    {668574, {0.444, 180.000}},
+    {668683, {0.474, 180.000}},
+    {669565, {0.427, 180.000}},
+    {669907, {0.469, 180.000}},
+    {670797, {0.281, 180.000}},
+    {670806, {0.551, 180.000}},
+    {670842, {0.486, 180.000}},
+    {671086, {0.430, 180.000}},
+    {674505, {0.648, 180.000}},
+    {677251, {0.537, 180.000}},
+    {684594, {0.487, 180.000}},
+    {690714, {0.469, 180.000}},
+    {693162, {0.472, 180.000}},
+    {711523, {0.472, 180.000}},
+    {717651, {0.541, 180.000}},
+    {717832, {0.474, 180.000}},
+    {717841, {0.473, 180.000}},
+    {998784, {0.000, 110.400}},
+    {998787, {0.000, 57.900}},
+    {998788, {0.000, 90.200}},
+    {1000017, {1.197, 106.926}},
+    {1000026, {0.967, 103.614}},
+    {1000035, {0.923, 108.055}},
+    {1000062, {1.884, 103.905}},
+    {1000080, {1.629, 105.422}},
+    {1000089, {1.628, 106.496}},
+    {1000098, {1.656, 105.317}},
+    {1000143, {1.480, 111.230}},
+    {1000161, {1.493, 111.951}},
+    {1000170, {1.370, 116.346}},
+    {1000179, {1.093, 114.943}},
+    {1000188, {1.316, 112.833}},
+    {1000197, {0.793, 106.503}},
+    {1000206, {1.391, 109.759}},
+    {1000233, {1.095, 115.581}},
+    {1000242, {1.170, 112.081}},
+    {1000341, {1.075, 102.846}},
+    {1000368, {1.719, 103.733}},
+    {1000377, {1.454, 109.046}},
+    {1000395, {1.642, 105.462}},
+    {1000413, {1.642, 105.875}},
+    {1000575, {1.449, 109.545}},
+    {1000584, {1.512, 106.848}},
+    {1001250, {1.354, 113.339}},
+    {1001259, {0.671, 98.438}},
+    {1001394, {1.365, 117.169}},
+    {1001457, {1.025, 120.078}},
+    {1001493, {0.816, 105.727}},
+    {1001565, {1.418, 110.694}},
+    {1001745, {1.341, 114.785}},
+    {1002483, {1.455, 110.067}},
+    {1002492, {1.409, 112.404}},
+    {1002528, {1.648, 105.872}},
+    {1002546, {1.596, 108.437}},
+    {1002618, {1.274, 121.468}},
+    {1002627, {1.019, 119.840}},
+    {1002636, {1.379, 111.381}},
+    {1002640, {1.748, 91.216}},
+    {1002654, {1.328, 113.491}},
+    {1002672, {0.583, 111.948}},
+    {1002681, {1.006, 121.410}},
+    {1002717, {0.876, 111.417}},
+    {1002789, {0.614, 95.300}},
+    {1003032, {1.424, 111.483}},
+    {1003842, {1.423, 115.233}},
+    {1006317, {1.362, 95.697}},
+    {1008765, {0.832, 99.409}},
+    {1009989, {1.115, 101.592}},
+    {1011213, {0.923, 99.688}},
+    {1020978, {1.334, 125.242}},
+    {1021113, {0.812, 115.364}},
+    {1021149, {1.429, 114.473}},
+    {1021167, {1.558, 114.152}},
+    {1021203, {1.710, 108.479}},
+    {1022211, {0.642, 141.096}},
+    {1022229, {0.597, 118.204}},
+    {1022373, {0.941, 124.421}},
+    {1023448, {1.339, 89.100}},
+    {1023453, {0.944, 104.587}},
+    {1023597, {1.394, 110.394}},
+    {1024848, {1.124, 101.417}},
+    {1024875, {1.058, 103.253}},
+    {1024974, {1.175, 100.000}},
+    {1024983, {1.139, 101.000}},
+    {1025913, {0.242, 58.680}},
+    {1026102, {0.279, 57.087}},
+    {1028385, {0.607, 118.533}},
+    {1029609, {0.777, 129.375}},
+    {1029717, {1.099, 115.923}},
+    {1030941, {1.090, 116.692}},
+    {1034550, {0.986, 108.000}},
+    {1034613, {0.726, 105.409}},
+    {1034856, {0.923, 108.922}},
+    {1044405, {1.462, 108.967}},
+    {1044594, {1.607, 108.274}},
+    {1331712, {0.000, 110.400}},
+    {1331715, {0.000, 58.500}},
+    {1331716, {0.000, 95.000}},
+    {1332945, {1.090, 107.018}},
+    {1332990, {1.297, 102.829}},
+    {1333008, {1.347, 105.708}},
+    {1333017, {1.182, 114.240}},
+    {1333026, {1.307, 108.079}},
+    {1333071, {1.085, 118.283}},
+    {1333089, {1.096, 117.478}},
+    {1333107, {0.779, 122.759}},
+    {1333116, {1.221, 105.873}},
+    {1333134, {1.147, 109.200}},
+    {1333143, {0.763, 109.062}},
+    {1333161, {0.865, 117.482}},
+    {1333170, {0.926, 112.630}},
+    {1333296, {1.363, 105.609}},
+    {1333341, {1.266, 110.149}},
+    {1333350, {1.265, 111.092}},
+    {1339110, {1.776, 107.296}},
+    {1339209, {1.664, 105.334}},
+    {1339254, {1.456, 107.100}},
+    {1339263, {0.861, 100.510}},
+    {1341579, {0.230, 60.000}},
+    {1341711, {0.792, 108.917}},
+    {1341729, {1.068, 110.595}},
+    {1341738, {1.047, 110.816}},
+    {1342935, {0.832, 108.864}},
+    {1344136, {1.805, 84.690}},
+    {1344159, {0.846, 106.788}},
+    {1346598, {1.227, 107.439}},
+    {1350243, {0.845, 125.674}},
+    {1352677, {1.198, 110.056}},
+    {1352727, {0.647, 116.842}},
+    {1355175, {0.542, 112.000}},
+    {1356376, {1.103, 90.370}},
+    {1356399, {0.684, 113.359}},
+    {1358841, {0.209, 57.087}},
+    {1358847, {0.697, 110.033}},
+    {1358865, {0.896, 115.361}},
+    {1360071, {0.595, 105.998}},
+    {1360089, {0.510, 117.000}},
+    {1360098, {0.553, 110.959}},
+    {1360170, {0.808, 109.000}},
+    {1360215, {0.757, 111.820}},
+    {1360224, {0.819, 108.120}},
+    {1360251, {0.857, 106.222}},
+    {1360359, {0.868, 106.000}},
+    {1360368, {0.876, 105.092}},
+    {1498176, {0.000, 111.500}},
+    {1498177, {0.000, 109.100}},
+    {1499427, {0.878, 106.409}},
+    {1499481, {1.306, 110.005}},
+    {1499877, {1.216, 113.995}},
+    {1500003, {1.391, 106.413}},
+    {1500652, {1.242, 109.856}},
+    {1500706, {1.306, 112.528}},
+    {1501876, {1.204, 111.488}},
+    {1501885, {1.194, 113.272}},
+    {1501902, {1.579, 106.872}},
+    {1501920, {1.386, 108.822}},
+    {1501930, {1.390, 108.355}},
+    {1501938, {1.365, 109.548}},
+    {1501956, {1.373, 103.303}},
+    {1501983, {1.265, 110.780}},
+    {1502010, {1.205, 114.743}},
+    {1502028, {1.198, 109.751}},
+    {1502073, {0.873, 119.927}},
+    {1502091, {0.818, 108.779}},
+    {1502154, {1.355, 108.199}},
+    {1502163, {1.511, 109.907}},
+    {1502182, {1.185, 111.663}},
+    {1502200, {1.396, 108.538}},
+    {1502208, {1.365, 109.440}},
+    {1502217, {1.169, 112.551}},
+    {1502253, {1.369, 109.796}},
+    {1502326, {1.351, 110.578}},
+    {1502335, {1.643, 98.943}},
+    {1502343, {1.431, 106.195}},
+    {1502352, {1.375, 109.289}},
+    {1502362, {1.125, 115.780}},
+    {1502416, {1.247, 109.989}},
+    {1502425, {1.302, 106.461}},
+    {1502551, {1.323, 106.641}},
+    {1502578, {1.567, 101.581}},
+    {1503243, {0.456, 161.741}},
+    {1503676, {1.402, 108.868}},
+    {1506123, {1.794, 105.043}},
+    {1509282, {1.518, 109.154}},
+    {1509526, {1.397, 108.014}},
+    {1509552, {1.594, 106.413}},
+    {1509750, {1.390, 114.417}},
+    {1509760, {1.320, 112.325}},
+    {1509769, {1.352, 109.711}},
+    {1543942, {1.343, 110.162}},
+    {1544068, {1.296, 111.871}},
+    {1547739, {1.538, 108.056}},
+    {1563625, {1.318, 111.149}},
+    {1664640, {0.000, 117.500}},
+    {1664643, {0.000, 58.900}},
+    {1664644, {0.000, 92.900}},
+    {1665873, {1.117, 117.909}},
+    {1665882, {1.004, 118.916}},
+    {1665891, {0.821, 119.600}},
+    {1665918, {1.179, 108.865}},
+    {1665936, {1.137, 116.189}},
+    {1665945, {1.132, 117.005}},
+    {1665954, {1.247, 111.009}},
+    {1666017, {1.014, 122.388}},
+    {1666044, {0.960, 119.679}},
+    {1666089, {0.745, 125.390}},
+    {1666116, {0.552, 120.066}},
+    {1666197, {1.038, 116.332}},
+    {1666215, {1.060, 120.838}},
+    {1666224, {1.194, 113.314}},
+    {1666233, {1.031, 118.033}},
+    {1666269, {1.268, 109.599}},
+    {1666431, {0.949, 122.185}},
+    {1666440, {0.960, 121.315}},
+    {1667106, {1.146, 112.878}},
+    {1667115, {1.000, 120.703}},
+    {1667142, {1.405, 111.609}},
+    {1667268, {1.132, 111.544}},
+    {1667340, {0.638, 118.553}},
+    {1667421, {0.977, 121.506}},
+    {1668339, {0.709, 120.274}},
+    {1668348, {0.864, 130.236}},
+    {1668366, {0.960, 110.133}},
+    {1668384, {1.168, 116.075}},
+    {1668388, {1.527, 93.608}},
+    {1668393, {1.174, 116.443}},
+    {1668402, {1.184, 115.377}},
+    {1668429, {0.998, 118.867}},
+    {1668438, {0.871, 124.162}},
+    {1668447, {1.076, 118.969}},
+    {1668465, {1.132, 116.612}},
+    {1668492, {0.936, 122.540}},
+    {1668496, {1.371, 93.349}},
+    {1668510, {0.975, 120.929}},
+    {1668537, {0.794, 122.157}},
+    {1668546, {0.848, 117.912}},
+    {1668564, {0.575, 120.277}},
+    {1668618, {1.251, 112.201}},
+    {1668627, {1.395, 112.633}},
+    {1668645, {1.023, 118.596}},
+    {1668672, {1.216, 113.680}},
+    {1668681, {1.098, 115.913}},
+    {1668717, {1.212, 113.447}},
+    {1668879, {1.091, 115.381}},
+    {1668888, {1.048, 117.574}},
+    {1669716, {0.816, 131.702}},
+    {1672236, {0.829, 113.214}},
+    {1672317, {1.393, 111.476}},
+    {1674684, {0.703, 117.160}},
+    {1674765, {1.167, 115.599}},
+    {1675890, {0.847, 123.206}},
+    {1675908, {0.751, 114.501}},
+    {1675989, {1.222, 113.553}},
+    {1676007, {1.310, 115.309}},
+    {1677132, {0.735, 114.715}},
+    {1677249, {1.237, 113.743}},
+    {1683252, {0.614, 119.033}},
+    {1689304, {1.381, 91.694}},
+    {1689372, {0.555, 123.394}},
+    {1689453, {1.006, 117.703}},
+    {1691769, {0.202, 58.894}},
+    {1691820, {0.605, 119.583}},
+    {1695492, {0.447, 122.785}},
+    {1699164, {0.435, 115.630}},
+    {1699218, {0.757, 113.000}},
+    {1699227, {0.836, 114.000}},
+    {1699245, {0.628, 118.227}},
+    {1699272, {0.754, 113.000}},
+    {1699281, {0.560, 128.067}},
+    {1699479, {0.640, 118.099}},
+    {1699488, {0.643, 117.575}},
+    {1710288, {1.232, 112.412}},
+    {2496960, {0.000, 97.900}},
+    {2496964, {0.000, 80.200}},
+    {2498193, {1.654, 97.335}},
+    {2498202, {1.321, 97.853}},
+    {2498211, {1.325, 97.326}},
+    {2498220, {1.344, 97.370}},
+    {2498265, {1.725, 89.814}},
+    {2498319, {1.377, 100.316}},
+    {2498346, {1.309, 101.641}},
+    {2498355, {1.007, 102.069}},
+    {2498364, {1.366, 94.913}},
+    {2498382, {1.268, 99.768}},
+    {2498409, {0.967, 104.732}},
+    {2498454, {1.379, 95.613}},
+    {2498517, {1.439, 97.111}},
+    {2498544, {1.555, 94.643}},
+    {2498697, {1.301, 98.686}},
+    {2498751, {1.304, 98.330}},
+    {2498760, {1.306, 98.066}},
+    {2498823, {0.931, 96.494}},
+    {2499426, {1.434, 95.108}},
+    {2499435, {1.318, 98.813}},
+    {2499444, {1.426, 95.780}},
+    {2499543, {1.457, 97.789}},
+    {2499741, {1.362, 96.942}},
+    {2499795, {1.709, 90.872}},
+    {2500659, {1.402, 95.424}},
+    {2500686, {1.804, 94.075}},
+    {2500767, {1.403, 99.399}},
+    {2500816, {1.666, 79.842}},
+    {2500965, {1.308, 98.541}},
+    {2501199, {1.390, 96.051}},
+    {2501271, {0.830, 97.000}},
+    {2504637, {1.679, 97.231}},
+    {2506824, {1.444, 105.143}},
+    {2507085, {1.446, 98.976}},
+    {2508057, {1.626, 98.524}},
+    {2508552, {1.504, 97.105}},
+    {2509335, {1.415, 103.715}},
+    {2511981, {1.428, 97.534}},
+    {2515455, {1.413, 104.893}},
+    {2515482, {1.563, 99.173}},
+    {2515653, {1.361, 100.790}},
+    {2515896, {1.332, 102.040}},
+    {2515959, {0.787, 99.239}},
+    {2521714, {1.978, 73.428}},
+    {2521773, {1.361, 95.589}},
+    {2527785, {0.947, 99.505}},
+    {2527789, {1.030, 87.982}},
+    {2527794, {1.002, 96.851}},
+    {2527893, {1.172, 95.428}},
+    {2529117, {1.144, 96.710}},
+    {2533954, {1.732, 79.546}},
+    {2542581, {1.295, 98.802}},
+    {2542815, {1.379, 96.197}},
+    {2542824, {1.286, 99.423}},
+    {2542887, {0.813, 96.222}},
+    {2584503, {0.734, 93.377}},
+    {2829888, {0.000, 99.400}},
+    {2829892, {0.000, 78.400}},
+    {2831121, {1.415, 93.266}},
+    {2831130, {1.387, 94.732}},
+    {2831139, {1.430, 92.852}},
+    {2831166, {1.863, 92.132}},
+    {2831175, {1.408, 107.104}},
+    {2831184, {1.661, 91.498}},
+    {2831202, {1.547, 94.839}},
+    {2831292, {1.453, 91.368}},
+    {2831310, {1.423, 92.591}},
+    {2831445, {1.376, 94.911}},
+    {2832354, {1.313, 97.901}},
+    {2832399, {1.478, 105.412}},
+    {2832723, {1.207, 108.882}},
+    {2833623, {1.513, 103.431}},
+    {2837286, {2.164, 97.766}},
+    {2837295, {1.850, 107.431}},
+    {2838528, {1.438, 113.808}},
+    {2838546, {1.525, 110.549}},
+    {2838636, {1.442, 104.737}},
+    {2838654, {1.449, 104.928}},
+    {2838789, {1.500, 104.313}},
+    {2839864, {1.891, 78.354}},
+    {2840013, {1.687, 91.169}},
+    {2875509, {1.487, 91.633}},
+    {2996352, {0.000, 104.600}},
+    {2996356, {0.000, 80.300}},
+    {2997585, {1.230, 101.166}},
+    {2997594, {1.264, 100.420}},
+    {2997603, {1.242, 100.883}},
+    {2997630, {1.744, 95.671}},
+    {2997657, {1.438, 99.465}},
+    {2997756, {1.224, 101.315}},
+    {2997774, {1.207, 101.417}},
+    {2997864, {1.446, 107.066}},
+    {2997909, {1.234, 101.070}},
+    {2997963, {1.449, 98.014}},
+    {2998008, {1.277, 106.586}},
+    {2998134, {1.374, 102.402}},
+    {2998818, {1.254, 101.492}},
+    {2998854, {1.664, 98.668}},
+    {2998881, {1.539, 96.849}},
+    {2999088, {1.422, 108.979}},
+    {2999133, {1.263, 100.489}},
+    {2999232, {1.083, 116.668}},
+    {3000105, {1.418, 100.361}},
+    {3000312, {1.557, 103.453}},
+    {3000411, {1.350, 101.747}},
+    {3003750, {1.922, 103.052}},
+    {3003777, {1.916, 97.446}},
+    {3003984, {1.837, 108.063}},
+    {3004029, {1.528, 102.229}},
+    {3004083, {1.644, 103.815}},
+    {3007476, {1.464, 101.180}},
+    {3007656, {1.583, 109.945}},
+    {3007701, {1.358, 102.378}},
+    {3007755, {1.323, 109.227}},
+    {3011328, {1.584, 103.959}},
+    {3011373, {1.376, 98.976}},
+    {3015000, {1.497, 107.170}},
+    {3015045, {1.324, 101.399}},
+    {3021120, {1.383, 109.292}},
+    {3021165, {1.108, 106.508}},
+    {3021223, {1.831, 80.297}},
+    {3023568, {1.465, 105.247}},
+    {3035808, {1.569, 120.924}},
+    {3035853, {1.497, 105.280}},
+    {3035871, {1.804, 101.600}},
+    {3035907, {1.569, 108.548}},
+    {3035952, {1.229, 126.841}},
+    {3036015, {1.509, 112.548}},
+    {3036042, {1.592, 106.139}},
+    {3036078, {1.326, 121.426}},
+    {3036087, {1.571, 103.212}},
+    {3036096, {1.634, 101.771}},
+    {3036240, {1.400, 110.401}},
+    {3041973, {1.157, 104.380}},
+    {3041991, {1.404, 99.854}},
+    {3042027, {1.416, 99.200}},
+    {3042072, {1.330, 104.466}},
+    {3042135, {1.397, 100.926}},
+    {3042198, {1.178, 110.665}},
+    {3042207, {1.202, 102.735}},
+    {3049371, {1.545, 99.905}},
+    {3049560, {1.285, 104.868}},
+    {3162816, {0.000, 108.700}},
+    {3162820, {0.000, 89.900}},
+    {3164049, {0.616, 113.339}},
+    {3164085, {0.390, 110.795}},
+    {3164094, {0.777, 113.958}},
+    {3164112, {0.716, 111.521}},
+    {3164121, {0.779, 106.380}},
+    {3164148, {0.729, 108.947}},
+    {3164220, {0.656, 108.828}},
+    {3164400, {0.754, 108.858}},
+    {3164607, {0.699, 106.924}},
+    {3164715, {0.530, 111.633}},
+    {3165372, {0.819, 102.981}},
+    {3168981, {0.258, 108.699}},
+    {3168990, {0.520, 109.677}},
+    {3169008, {0.461, 109.070}},
+    {3169044, {0.446, 106.756}},
+    {3170214, {1.051, 111.280}},
+    {3170268, {0.968, 106.022}},
+    {3170493, {0.870, 108.096}},
+    {3172680, {0.862, 108.099}},
+    {3172716, {0.786, 110.683}},
+    {3177612, {0.879, 104.597}},
+    {3181311, {0.816, 108.681}},
+    {3187480, {0.802, 89.931}},
+    {3208437, {0.726, 105.045}},
+    {3329280, {0.000, 113.200}},
+    {3329284, {0.000, 88.800}},
+    {3330513, {0.943, 113.131}},
+    {3330531, {0.906, 114.940}},
+    {3330549, {0.417, 114.057}},
+    {3330558, {1.231, 110.677}},
+    {3330576, {1.080, 111.090}},
+    {3330594, {1.100, 110.057}},
+    {3330603, {1.173, 110.993}},
+    {3330612, {0.976, 114.773}},
+    {3330639, {1.035, 111.226}},
+    {3330666, {0.978, 115.383}},
+    {3330684, {0.502, 113.313}},
+    {3330702, {0.915, 115.201}},
+    {3330729, {0.744, 116.096}},
+    {3330738, {0.721, 117.611}},
+    {3330774, {0.908, 115.220}},
+    {3330810, {1.090, 110.505}},
+    {3330837, {0.947, 112.650}},
+    {3330873, {0.973, 111.787}},
+    {3330891, {1.087, 110.187}},
+    {3330909, {1.132, 108.074}},
+    {3331755, {0.982, 111.060}},
+    {3331773, {0.596, 113.035}},
+    {3331782, {1.139, 115.851}},
+    {3331836, {0.951, 116.750}},
+    {3331908, {0.931, 114.138}},
+    {3332979, {0.982, 109.919}},
+    {3332997, {0.624, 112.989}},
+    {3333006, {1.157, 113.611}},
+    {3333028, {1.473, 87.271}},
+    {3333042, {1.016, 113.988}},
+    {3333051, {1.184, 109.849}},
+    {3333060, {0.969, 114.891}},
+    {3333069, {1.008, 110.951}},
+    {3333132, {0.849, 118.273}},
+    {3333136, {1.524, 88.961}},
+    {3333258, {1.137, 107.667}},
+    {3333289, {1.382, 85.619}},
+    {3333339, {0.960, 116.707}},
+    {3334221, {0.584, 115.078}},
+    {3334356, {0.920, 115.312}},
+    {3335445, {0.439, 109.107}},
+    {3335454, {0.818, 111.352}},
+    {3335472, {0.728, 114.011}},
+    {3335481, {0.657, 112.826}},
+    {3335490, {0.663, 112.010}},
+    {3335508, {0.339, 114.117}},
+    {3335535, {0.562, 114.339}},
+    {3335553, {0.561, 113.000}},
+    {3335562, {0.605, 111.570}},
+    {3335580, {0.564, 113.940}},
+    {3335634, {0.472, 109.722}},
+    {3335670, {0.688, 116.038}},
+    {3335706, {0.661, 112.000}},
+    {3335733, {0.552, 115.670}},
+    {3335760, {0.682, 111.331}},
+    {3335787, {0.655, 111.686}},
+    {3336678, {1.443, 114.408}},
+    {3336714, {1.225, 116.666}},
+    {3336741, {1.162, 114.868}},
+    {3336804, {1.109, 116.117}},
+    {3336808, {1.433, 93.413}},
+    {3336822, {1.106, 117.205}},
+    {3336894, {1.144, 114.705}},
+    {3336898, {1.658, 87.873}},
+    {3339252, {1.185, 105.606}},
+    {3339256, {1.486, 91.244}},
+    {3339306, {0.874, 111.782}},
+    {3340476, {1.103, 109.640}},
+    {3341655, {1.170, 109.525}},
+    {3341673, {1.127, 110.564}},
+    {3341682, {1.404, 100.845}},
+    {3341700, {1.032, 113.170}},
+    {3341704, {1.468, 87.497}},
+    {3341794, {1.507, 86.657}},
+    {3341853, {0.963, 117.360}},
+    {3342843, {1.504, 108.020}},
+    {3342897, {1.221, 109.460}},
+    {3342924, {1.051, 116.673}},
+    {3343014, {0.997, 120.309}},
+    {3344076, {1.020, 117.603}},
+    {3344139, {0.973, 105.821}},
+    {3344148, {0.866, 118.108}},
+    {3344238, {0.887, 120.399}},
+    {3345309, {1.077, 113.361}},
+    {3345372, {0.938, 115.037}},
+    {3346596, {0.837, 112.888}},
+    {3347775, {1.094, 114.048}},
+    {3347820, {1.058, 109.793}},
+    {3347824, {1.324, 90.483}},
+    {3347910, {0.960, 115.468}},
+    {3347914, {1.447, 86.726}},
+    {3350245, {1.309, 94.977}},
+    {3350268, {0.930, 116.108}},
+    {3351492, {1.007, 113.480}},
+    {3351496, {1.355, 90.185}},
+    {3351681, {1.241, 102.656}},
+    {3352707, {0.567, 122.298}},
+    {3352711, {0.921, 88.477}},
+    {3353940, {1.008, 108.644}},
+    {3353944, {1.149, 90.294}},
+    {3353958, {0.840, 119.817}},
+    {3353962, {1.364, 86.669}},
+    {3353989, {1.181, 84.818}},
+    {3354030, {0.994, 109.745}},
+    {3354034, {1.399, 85.303}},
+    {3354066, {1.069, 111.143}},
+    {3354070, {1.382, 90.128}},
+    {3354093, {0.833, 119.709}},
+    {3354097, {1.346, 86.810}},
+    {3354120, {1.097, 110.254}},
+    {3354129, {0.922, 114.408}},
+    {3354147, {0.964, 116.540}},
+    {3354151, {1.290, 92.879}},
+    {3354165, {1.083, 110.090}},
+    {3356406, {0.866, 118.829}},
+    {3356410, {1.649, 79.399}},
+    {3361342, {0.789, 96.811}},
+    {3361410, {0.843, 113.805}},
+    {3371265, {1.070, 111.943}},
+    {3374955, {0.954, 117.365}},
+    {3662208, {0.000, 116.100}},
+    {3662211, {0.000, 59.400}},
+    {3662212, {0.000, 91.600}},
+    {3663441, {0.903, 116.483}},
+    {3663450, {0.884, 118.360}},
+    {3663459, {0.836, 121.424}},
+    {3663468, {0.900, 117.720}},
+    {3663477, {0.604, 111.788}},
+    {3663486, {1.179, 113.545}},
+    {3663504, {0.973, 117.469}},
+    {3663585, {1.070, 109.087}},
+    {3663594, {1.097, 108.265}},
+    {3663630, {0.871, 118.246}},
+    {3663765, {0.882, 118.041}},
+    {3663819, {1.014, 114.899}},
+    {3664677, {0.263, 48.820}},
+    {3664683, {0.956, 114.147}},
+    {3664692, {0.784, 126.957}},
+    {3664701, {0.573, 115.869}},
+    {3664710, {1.012, 123.319}},
+    {3664854, {0.880, 118.260}},
+    {3664857, {0.166, 60.845}},
+    {3665061, {1.009, 116.146}},
+    {3665907, {0.819, 122.977}},
+    {3665916, {0.876, 119.718}},
+    {3665925, {0.559, 116.738}},
+    {3665934, {1.184, 113.646}},
+    {3665952, {1.072, 112.261}},
+    {3665970, {0.987, 117.750}},
+    {3665988, {0.930, 118.047}},
+    {3666064, {1.267, 90.869}},
+    {3666078, {0.861, 119.252}},
+    {3666082, {1.196, 93.287}},
+    {3666154, {1.301, 89.217}},
+    {3666213, {0.852, 120.464}},
+    {3666240, {1.033, 114.288}},
+    {3666267, {1.124, 109.441}},
+    {3666285, {1.117, 110.033}},
+    {3667149, {0.560, 118.000}},
+    {3667158, {1.200, 113.650}},
+    {3667176, {0.966, 119.034}},
+    {3667239, {0.931, 120.455}},
+    {3667302, {0.877, 118.890}},
+    {3667509, {1.089, 112.227}},
+    {3668373, {0.242, 114.938}},
+    {3668382, {0.683, 117.836}},
+    {3668400, {0.621, 115.758}},
+    {3668418, {0.658, 113.806}},
+    {3668427, {0.776, 108.296}},
+    {3668436, {0.620, 109.865}},
+    {3668508, {0.623, 110.000}},
+    {3668526, {0.583, 117.875}},
+    {3668661, {0.532, 119.438}},
+    {3668688, {0.653, 112.855}},
+    {3668697, {0.519, 122.000}},
+    {3668715, {0.658, 112.128}},
+    {3668733, {0.665, 112.000}},
+    {3669660, {1.136, 118.409}},
+    {3669705, {1.328, 108.583}},
+    {3669714, {1.381, 107.009}},
+    {3669750, {1.124, 115.942}},
+    {3669753, {0.205, 60.711}},
+    {3669885, {1.093, 118.170}},
+    {3669942, {0.179, 68.138}},
+    {3669957, {1.422, 108.368}},
+    {3672198, {0.925, 120.144}},
+    {3672201, {0.176, 61.507}},
+    {3674646, {0.916, 121.411}},
+    {3674649, {0.184, 60.603}},
+    {3675771, {1.610, 102.859}},
+    {3675870, {1.062, 116.086}},
+    {3677004, {1.067, 114.988}},
+    {3677094, {0.925, 117.971}},
+    {3678237, {1.085, 113.473}},
+    {3678318, {0.908, 117.606}},
+    {3680766, {0.918, 120.404}},
+    {3683214, {1.029, 111.106}},
+    {3684438, {1.078, 109.054}},
+    {3686886, {0.812, 122.430}},
+    {3686890, {1.198, 92.930}},
+    {3689334, {0.787, 124.070}},
+    {3689337, {0.171, 60.000}},
+    {3689338, {1.225, 91.653}},
+    {3689406, {0.777, 124.514}},
+    {3689442, {0.983, 116.415}},
+    {3689469, {0.847, 120.135}},
+    {3689499, {0.178, 61.163}},
+    {3689505, {0.886, 118.045}},
+    {3689526, {0.176, 61.536}},
+    {3689541, {1.022, 114.380}},
+    {3704193, {1.008, 116.095}},
+    {3707829, {0.846, 120.774}},
+    {3707832, {0.237, 51.029}},
+    {3707883, {0.936, 119.789}},
+    {4161600, {0.000, 106.500}},
+    {4161604, {0.000, 89.100}},
+    {4162833, {1.072, 99.158}},
+    {4162851, {1.268, 91.423}},
+    {4162878, {1.394, 98.288}},
+    {4162896, {1.150, 101.775}},
+    {4162932, {1.180, 98.890}},
+    {4162959, {1.074, 103.431}},
+    {4163049, {0.852, 100.707}},
+    {4163112, {1.186, 107.891}},
+    {4163157, {0.972, 104.924}},
+    {4163184, {1.358, 93.644}},
+    {4163211, {1.190, 98.760}},
+    {4163463, {0.537, 109.363}},
+    {4163472, {0.976, 111.306}},
+    {4164102, {1.302, 102.892}},
+    {4164120, {1.022, 109.148}},
+    {4164138, {1.629, 85.839}},
+    {4164336, {0.983, 120.127}},
+    {4164696, {0.863, 119.249}},
+    {4165326, {1.277, 103.026}},
+    {4165560, {1.164, 109.307}},
+    {4168998, {1.769, 99.311}},
+    {4169016, {1.419, 104.161}},
+    {4169025, {1.403, 105.407}},
+    {4169034, {1.448, 102.194}},
+    {4169043, {1.680, 99.260}},
+    {4169052, {1.489, 98.818}},
+    {4169232, {1.501, 109.688}},
+    {4169277, {1.312, 102.280}},
+    {4169295, {1.617, 97.314}},
+    {4169304, {1.380, 105.601}},
+    {4169583, {0.844, 100.242}},
+    {4169592, {1.219, 112.058}},
+    {4171464, {1.224, 105.341}},
+    {4171482, {1.214, 104.893}},
+    {4171491, {1.411, 101.655}},
+    {4171572, {1.010, 108.094}},
+    {4171680, {1.217, 114.325}},
+    {4171725, {1.106, 104.742}},
+    {4171752, {1.265, 103.617}},
+    {4172040, {0.977, 117.767}},
+    {4172904, {1.232, 114.493}},
+    {4173930, {1.346, 98.856}},
+    {4174128, {1.273, 110.640}},
+    {4174488, {1.021, 114.624}},
+    {4175352, {1.528, 106.045}},
+    {4176396, {1.303, 99.224}},
+    {4176576, {1.305, 106.320}},
+    {4180095, {1.113, 107.673}},
+    {4180099, {1.264, 93.138}},
+    {4180248, {1.248, 107.964}},
+    {4180608, {0.933, 119.729}},
+    {4186264, {1.220, 85.039}},
+    {4186728, {0.965, 111.595}},
+    {4192848, {0.890, 106.612}},
+    {4201056, {1.248, 122.857}},
+    {4201101, {1.097, 113.430}},
+    {4201119, {1.605, 99.255}},
+    {4201128, {1.122, 119.057}},
+    {4201155, {1.257, 110.308}},
+    {4201281, {1.219, 108.740}},
+    {4201335, {1.211, 108.168}},
+    {4201407, {0.642, 117.733}},
+    {4201416, {1.050, 121.823}},
+    {4207221, {0.947, 107.124}},
+    {4207248, {0.965, 112.107}},
+    {4207536, {0.868, 118.776}},
+    {4210920, {1.496, 95.270}},
+    {4211208, {1.035, 114.441}},
+    {4231881, {1.059, 102.995}},
+    {4239279, {1.032, 102.950}},
+    {4249143, {0.419, 100.483}},
+    {4328064, {0.000, 98.100}},
+    {4328068, {0.000, 83.600}},
+    {4329297, {1.085, 98.054}},
+    {4329360, {1.263, 96.331}},
+    {4329378, {1.115, 102.175}},
+    {4329396, {1.147, 98.926}},
+    {4329423, {1.141, 100.260}},
+    {4329468, {1.075, 98.171}},
+    {4329522, {0.997, 92.571}},
+    {4329621, {1.081, 98.754}},
+    {4329927, {0.672, 97.353}},
+    {4335462, {1.833, 97.935}},
+    {4335507, {1.663, 100.061}},
+    {4335516, {1.442, 99.021}},
+    {4337928, {1.189, 105.662}},
+    {4337964, {1.028, 110.069}},
+    {4338162, {1.509, 93.096}},
+    {4341627, {1.757, 94.795}},
+    {4342887, {1.271, 99.730}},
+    {4343058, {1.508, 90.565}},
+    {4343112, {1.165, 103.783}},
+    {4343391, {0.704, 96.577}},
+    {4346658, {1.047, 96.592}},
+    {4346784, {1.543, 91.164}},
+    {4352728, {1.252, 83.624}},
+    {4415607, {0.473, 94.470}},
+    {4993920, {0.000, 134.200}},
+    {4993921, {0.000, 131.800}},
+    {4993924, {0.000, 97.700}},
+    {4993927, {0.000, 92.300}},
+    {4996396, {0.778, 128.756}},
+    {4996503, {0.805, 130.439}},
+    {4996548, {0.727, 132.187}},
+    {4996566, {0.737, 131.100}},
+    {4996639, {0.751, 132.225}},
+    {4997629, {0.721, 134.566}},
+    {4997638, {0.410, 135.975}},
+    {4997647, {0.845, 137.596}},
+    {4997773, {0.714, 130.677}},
+    {4997779, {1.280, 89.957}},
+    {4997863, {0.857, 122.418}},
+    {4997869, {1.260, 93.102}},
+    {4998996, {0.690, 136.444}},
+    {5000220, {0.390, 131.835}},
+    {5000310, {0.364, 132.652}},
+    {5001534, {0.876, 139.045}},
+    {5012415, {0.876, 130.718}},
+    {5012419, {1.239, 101.359}},
+    {5012550, {0.782, 132.228}},
+    {5012554, {1.141, 100.902}},
+    {5018674, {1.117, 95.513}},
+    {5018677, {1.191, 93.909}},
+    {5018760, {0.769, 134.526}},
+    {5019004, {0.704, 138.631}},
+    {5021050, {1.179, 93.007}},
+    {5030918, {1.230, 93.732}},
+    {5031000, {0.706, 145.470}},
+    {5031244, {0.907, 125.792}},
+    {5659776, {0.000, 109.400}},
+    {5659780, {0.000, 89.400}},
+    {5661009, {0.862, 112.251}},
+    {5661018, {1.154, 109.212}},
+    {5661072, {1.330, 106.399}},
+    {5661081, {1.166, 112.989}},
+    {5661090, {1.388, 104.291}},
+    {5661180, {1.201, 106.135}},
+    {5661234, {0.913, 112.004}},
+    {5661324, {0.576, 111.206}},
+    {5661333, {1.141, 109.045}},
+    {5662548, {0.694, 112.000}},
+    {5669892, {0.796, 109.753}},
+    {5671116, {0.793, 108.649}},
+    {5672340, {0.828, 108.000}},
+    {5684440, {1.448, 89.411}},
+    {5684580, {0.665, 112.526}},
+    {5687028, {0.694, 110.000}},
+    {5704164, {0.578, 107.787}},
+    {5704173, {0.717, 108.668}},
+    {5704227, {0.840, 108.000}},
+    {6159168, {0.000, 118.800}},
+    {6159169, {0.000, 115.900}},
+    {6159171, {0.000, 64.700}},
+    {6159172, {0.000, 91.800}},
+    {6160725, {0.803, 120.419}},
+    {6160734, {0.992, 118.432}},
+    {6160914, {1.027, 116.528}},
+    {6160959, {0.837, 123.024}},
+    {6160968, {0.821, 124.073}},
+    {6161013, {1.038, 115.506}},
+    {6161950, {0.712, 119.695}},
+    {6161959, {1.029, 117.220}},
+    {6163174, {0.798, 114.475}},
+    {6163180, {1.320, 90.784}},
+    {6163183, {1.109, 112.724}},
+    {6163363, {1.134, 111.566}},
+    {6163462, {1.119, 111.916}},
+    {6164398, {0.906, 119.614}},
+    {6164407, {1.087, 114.623}},
+    {6165621, {0.563, 120.571}},
+    {6165630, {0.693, 115.588}},
+    {6165810, {0.699, 113.316}},
+    {6165855, {0.702, 121.238}},
+    {6165864, {0.523, 121.446}},
+    {6165909, {0.794, 111.638}},
+    {6165990, {0.563, 119.432}},
+    {6166845, {0.968, 116.495}},
+    {6166854, {1.324, 115.886}},
+    {6167088, {1.139, 118.868}},
+    {6170518, {0.974, 121.003}},
+    {6170527, {1.137, 117.591}},
+    {6171741, {1.025, 117.918}},
+    {6171750, {1.088, 120.135}},
+    {6171930, {1.077, 120.925}},
+    {6172965, {1.094, 118.065}},
+    {6172974, {1.223, 117.328}},
+    {6174189, {0.950, 118.495}},
+    {6174198, {1.126, 113.859}},
+    {6174432, {1.076, 111.320}},
+    {6175413, {0.917, 118.117}},
+    {6176637, {0.861, 118.045}},
+    {6177861, {0.755, 121.037}},
+    {6177870, {1.027, 119.421}},
+    {6178104, {0.976, 117.125}},
+    {6180309, {0.930, 119.408}},
+    {6180318, {1.179, 110.828}},
+    {6180552, {0.946, 118.357}},
+    {6181533, {1.029, 113.991}},
+    {6181542, {1.278, 106.908}},
+    {6181776, {0.975, 117.029}},
+    {6182757, {0.660, 125.278}},
+    {6183981, {0.744, 129.614}},
+    {6183985, {1.217, 93.425}},
+    {6186429, {0.805, 125.777}},
+    {6186432, {0.152, 64.704}},
+    {6186438, {0.904, 124.494}},
+    {6190101, {0.718, 121.600}},
+    {6191325, {0.691, 122.967}},
+    {6201117, {1.030, 116.423}},
+    {6201360, {1.074, 113.905}},
+    {6202341, {0.964, 131.858}},
+    {6202350, {1.187, 124.980}},
+    {6204789, {0.669, 119.977}},
+    {6204790, {0.864, 122.227}},
+    {6204793, {1.380, 90.193}},
+    {6204798, {0.596, 126.139}},
+    {6204799, {1.033, 117.271}},
+    {6204807, {1.038, 117.619}},
+    {6204808, {1.078, 114.622}},
+    {6204816, {1.045, 121.633}},
+    {6204825, {0.892, 119.572}},
+    {6204843, {1.013, 117.860}},
+    {6204861, {1.114, 112.337}},
+    {6204870, {0.999, 120.038}},
+    {6204951, {1.002, 120.163}},
+    {6204960, {1.020, 117.801}},
+    {6204970, {0.881, 120.932}},
+    {6204978, {1.014, 120.052}},
+    {6204979, {1.127, 112.251}},
+    {6205005, {1.072, 115.515}},
+    {6205014, {0.941, 124.384}},
+    {6205023, {0.478, 111.243}},
+    {6205024, {0.894, 120.190}},
+    {6205032, {0.423, 112.567}},
+    {6205033, {0.912, 118.973}},
+    {6205060, {1.064, 114.980}},
+    {6205077, {0.872, 116.778}},
+    {6205078, {1.042, 116.438}},
+    {6205158, {0.974, 116.439}},
+    {6205185, {1.034, 115.664}},
+    {6205186, {1.104, 111.759}},
+    {6206022, {0.725, 128.938}},
+    {6206040, {1.024, 123.755}},
+    {6206067, {1.165, 115.355}},
+    {6206202, {0.979, 128.362}},
+    {6206203, {1.257, 111.356}},
+    {6206238, {1.148, 118.349}},
+    {6206247, {1.095, 115.386}},
+    {6206248, {1.076, 114.910}},
+    {6206256, {1.070, 116.605}},
+    {6206284, {1.289, 109.610}},
+    {6208650, {1.103, 119.417}},
+    {6208695, {0.943, 122.904}},
+    {6208704, {0.931, 123.541}},
+    {6208830, {0.931, 123.604}},
+    {6209874, {0.967, 120.535}},
+    {6214815, {1.031, 116.781}},
+    {6214824, {1.156, 110.199}},
+    {6214869, {1.248, 111.041}},
+    {6230718, {1.016, 125.987}},
+    {6230727, {1.152, 112.628}},
+    {6230736, {1.291, 106.250}},
+    {6230737, {1.108, 113.166}},
+    {6230862, {1.188, 110.842}},
+    {6325632, {0.000, 113.800}},
+    {6371253, {1.085, 115.406}},
+    {6371262, {1.289, 112.016}},
+    {6371487, {1.230, 110.181}},
+    {6371496, {1.207, 111.032}},
+    {6371541, {1.238, 114.692}},
+    {6371622, {1.118, 114.813}},
+    {6372486, {1.343, 118.516}},
+    {6492096, {0.000, 120.700}},
+    {6492097, {0.000, 125.400}},
+    {6493887, {0.854, 123.380}},
+    {6493905, {1.111, 118.049}},
+    {6495112, {0.858, 130.275}},
+    {6495130, {0.900, 133.220}},
+    {6496336, {0.900, 127.045}},
+    {6496354, {1.126, 118.909}},
+    {6500007, {1.166, 122.985}},
+    {6500025, {1.396, 117.707}},
+    {6502455, {1.000, 124.868}},
+    {6502473, {1.057, 127.145}},
+    {6503680, {0.981, 127.725}},
+    {6503698, {1.170, 122.487}},
+    {6504903, {1.109, 119.788}},
+    {6504921, {1.118, 124.961}},
+    {6514695, {1.108, 117.061}},
+    {6520815, {0.551, 127.770}},
+    {6520833, {0.752, 118.352}},
+    {6520950, {0.581, 124.000}},
+    {6523263, {0.667, 134.561}},
+    {6523281, {0.944, 118.135}},
+    {6537951, {0.900, 127.009}},
+    {6537952, {0.922, 125.312}},
+    {6537970, {1.080, 121.090}},
+    {6541623, {0.984, 126.832}},
+    {6547743, {1.056, 121.641}},
+    {6547761, {1.354, 112.464}},
+    {6569775, {1.152, 109.599}},
+    {6569776, {0.887, 128.078}},
+    {6569784, {1.004, 120.577}},
+    {6569785, {0.899, 126.936}},
+    {6569793, {1.284, 112.087}},
+    {6569794, {1.146, 117.990}},
+    {6569910, {1.300, 105.800}},
+    {6571017, {1.007, 126.117}},
+    {6572241, {1.462, 116.898}},
+    {6658560, {0.000, 115.000}},
+    {6658563, {0.000, 57.800}},
+    {6659793, {1.064, 113.703}},
+    {6659802, {0.998, 118.873}},
+    {6659811, {1.007, 118.319}},
+    {6659838, {1.421, 109.742}},
+    {6659865, {1.203, 113.198}},
+    {6659874, {1.232, 111.320}},
+    {6659883, {1.436, 104.665}},
+    {6659892, {1.202, 109.320}},
+    {6659964, {1.047, 114.970}},
+    {6660009, {0.912, 114.483}},
+    {6660036, {0.689, 112.374}},
+    {6660054, {1.024, 118.604}},
+    {6660117, {0.835, 107.349}},
+    {6660135, {1.254, 110.622}},
+    {6660144, {1.183, 114.011}},
+    {6660189, {1.223, 112.226}},
+    {6660198, {1.025, 122.982}},
+    {6660351, {1.084, 114.473}},
+    {6660360, {1.064, 115.483}},
+    {6661026, {0.997, 120.651}},
+    {6661035, {0.981, 121.660}},
+    {6661062, {1.316, 115.626}},
+    {6661089, {1.118, 119.196}},
+    {6661098, {1.142, 117.260}},
+    {6661179, {0.732, 128.087}},
+    {6661260, {0.767, 111.053}},
+    {6661341, {1.049, 117.022}},
+    {6661359, {1.192, 115.106}},
+    {6661368, {1.060, 122.253}},
+    {6661575, {1.008, 120.447}},
+    {6662259, {0.883, 128.240}},
+    {6662304, {1.259, 111.557}},
+    {6662313, {1.106, 119.822}},
+    {6662322, {1.269, 111.261}},
+    {6662340, {1.146, 112.718}},
+    {6662367, {1.105, 117.871}},
+    {6662412, {1.130, 112.139}},
+    {6662430, {1.072, 114.420}},
+    {6662457, {0.820, 121.724}},
+    {6662484, {0.700, 114.808}},
+    {6662565, {1.056, 116.655}},
+    {6662592, {1.147, 117.511}},
+    {6662808, {1.132, 113.602}},
+    {6666156, {0.889, 110.000}},
+    {6668604, {0.764, 111.915}},
+    {6668685, {1.216, 112.920}},
+    {6668919, {1.351, 108.085}},
+    {6669828, {0.774, 112.549}},
+    {6669909, {1.236, 112.751}},
+    {6671052, {0.799, 109.725}},
+    {6671133, {1.316, 108.686}},
+    {6672357, {1.546, 101.687}},
+    {6677055, {1.154, 121.497}},
+    {6685689, {0.204, 57.777}},
+    {6685821, {1.066, 114.220}},
+    {6686055, {1.126, 112.006}},
+    {6689412, {0.485, 120.000}},
+    {6689493, {0.868, 117.977}},
+    {6690636, {0.506, 118.000}},
+    {6690717, {0.812, 122.336}},
+    {6693084, {0.560, 109.160}},
+    {6693102, {0.656, 119.230}},
+    {6693165, {0.662, 110.288}},
+    {6693183, {0.789, 110.951}},
+    {6693192, {0.782, 111.731}},
+    {6693237, {0.674, 120.000}},
+    {6693318, {0.738, 118.714}},
+    {6693399, {0.670, 116.188}},
+    {6693408, {0.659, 117.057}},
+    {6693534, {0.618, 119.829}},
+    {6704181, {1.004, 119.018}},
+    {6704253, {1.376, 106.579}},
+    {6704334, {1.394, 107.777}},
+    {6704415, {1.060, 116.867}},
+    {6714216, {1.283, 111.332}},
+    {6714342, {1.410, 105.678}},
+    {6715440, {1.189, 116.345}},
+    {6825024, {0.000, 118.300}},
+    {6826536, {1.209, 114.689}},
+    {6826896, {1.024, 114.936}},
+    {6827760, {1.309, 115.461}},
+    {6828984, {1.210, 114.810}},
+    {6831432, {0.912, 113.960}},
+    {6833016, {1.319, 113.899}},
+    {6836688, {1.089, 117.795}},
+    {6837912, {1.039, 121.240}},
+    {6849792, {1.090, 120.965}},
+    {6852240, {1.079, 122.748}},
+    {6864480, {1.181, 130.600}},
+    {6864525, {1.136, 118.871}},
+    {6864561, {1.401, 107.694}},
+    {6870960, {1.035, 114.919}},
+    {6892992, {0.982, 123.972}},
+    {6901560, {1.052, 120.425}},
+    {6913800, {0.912, 130.128}},
+    {6913872, {1.094, 112.175}},
+    {7157952, {0.000, 113.300}},
+    {7159185, {1.109, 110.353}},
+    {7159194, {1.052, 114.321}},
+    {7159203, {0.938, 121.050}},
+    {7159212, {0.927, 123.204}},
+    {7159338, {1.116, 115.011}},
+    {7159401, {0.853, 115.637}},
+    {7159428, {0.646, 113.739}},
+    {7159509, {1.083, 112.511}},
+    {7159581, {1.140, 115.034}},
+    {7159752, {1.025, 116.188}},
+    {7160562, {1.227, 110.268}},
+    {7161786, {1.011, 121.488}},
+    {7161804, {1.053, 113.913}},
+    {7161808, {1.327, 93.575}},
+    {7161876, {0.626, 117.464}},
+    {7163100, {0.616, 122.000}},
+    {7163253, {1.253, 112.373}},
+    {7165458, {1.673, 104.311}},
+    {7165497, {0.279, 54.827}},
+    {7165548, {0.868, 110.000}},
+    {7165629, {1.519, 105.833}},
+    {7165683, {1.603, 108.652}},
+    {7167906, {1.511, 104.036}},
+    {7167996, {0.794, 110.320}},
+    {7176447, {1.558, 103.008}},
+    {7176474, {1.409, 108.458}},
+    {7178922, {1.367, 111.904}},
+    {7180146, {1.144, 120.463}},
+    {7180164, {0.961, 123.768}},
+    {7180168, {1.451, 92.867}},
+    {7180182, {1.171, 112.379}},
+    {7180236, {0.628, 116.881}},
+    {7180290, {1.324, 111.347}},
+    {7180317, {1.185, 112.132}},
+    {7180371, {1.379, 109.036}},
+    {7180560, {1.108, 116.279}},
+    {7182684, {0.626, 115.000}},
+    {7185081, {0.209, 57.032}},
+    {7188804, {0.468, 118.274}},
+    {7192476, {0.477, 112.596}},
+    {7192530, {0.810, 110.000}},
+    {7192557, {0.669, 113.350}},
+    {7192800, {0.658, 115.293}},
+    {7324416, {0.000, 91.600}},
+    {7402095, {1.962, 88.495}},
+    {7402113, {2.261, 94.137}},
+    {7402230, {1.738, 86.270}},
+    {7402248, {1.748, 86.194}},
+    {7404561, {1.530, 101.147}},
+    {7404696, {1.629, 93.534}},
+    {7420590, {0.903, 119.401}},
+    {7490880, {0.000, 116.700}},
+    {7492392, {1.260, 118.182}},
+    {7493616, {1.294, 118.082}},
+    {7494840, {1.343, 115.589}},
+    {7498512, {1.787, 111.682}},
+    {7500960, {1.515, 115.695}},
+    {7502184, {1.339, 123.850}},
+    {7503408, {1.578, 112.194}},
+    {7515648, {1.245, 118.893}},
+    {7518096, {1.293, 117.503}},
+    {7530336, {1.467, 128.036}},
+    {7530381, {1.298, 117.857}},
+    {7530399, {1.715, 107.633}},
+    {7530408, {1.497, 116.432}},
+    {7530435, {1.545, 113.711}},
+    {7530615, {1.335, 116.765}},
+    {7530624, {1.330, 116.908}},
+    {7530750, {1.394, 114.962}},
+    {7657344, {0.000, 111.000}},
+    {7658631, {1.440, 110.492}},
+    {7659855, {1.489, 112.709}},
+    {7665984, {1.724, 109.817}},
+    {7666245, {1.519, 110.569}},
+    {7666272, {1.650, 111.405}},
+    {7990272, {0.000, 118.400}},
+    {7994106, {1.065, 122.928}},
+    {8012556, {0.736, 113.969}},
+    {8156736, {0.000, 111.400}},
+    {8218386, {0.522, 111.433}},
+    {8489664, {0.000, 111.400}},
+    {8493804, {0.913, 111.360}},
+    {8822592, {0.000, 180.000}},
+    {8826687, {0.574, 180.000}},
+    {8834031, {0.649, 180.000}},
+    {8989056, {0.000, 119.500}},
+    {8989057, {0.000, 115.700}},
+    {8990289, {0.923, 121.439}},
+    {8990307, {0.707, 124.083}},
+    {8990604, {0.294, 122.881}},
+    {8992782, {1.376, 115.398}},
+    {8992810, {1.128, 114.457}},
+    {8993052, {0.685, 119.698}},
+    {8993089, {1.105, 116.439}},
+    {8996724, {0.826, 115.000}},
+    {9000432, {1.195, 123.403}},
+    {9033444, {0.300, 113.943}},
+    {9155520, {0.000, 120.800}},
+    {9156753, {0.951, 119.946}},
+    {9157068, {0.307, 126.448}},
+    {9157077, {1.032, 117.035}},
+    {9157257, {0.751, 120.606}},
+    {9157464, {0.972, 121.082}},
+    {9157995, {1.041, 116.994}},
+    {9158292, {0.621, 120.000}},
+    {9158481, {1.047, 118.847}},
+    {9159273, {1.053, 121.298}},
+    {9159516, {0.567, 124.000}},
+    {9159705, {0.953, 123.573}},
+    {9159750, {1.041, 122.163}},
+    {9163188, {0.833, 114.000}},
+    {9163377, {1.408, 112.958}},
+    {9165636, {0.656, 122.000}},
+    {9165825, {1.259, 113.209}},
+    {9167049, {1.001, 126.373}},
+    {9177876, {0.578, 125.000}},
+    {9178065, {1.054, 122.320}},
+    {9199908, {0.355, 117.729}},
+    {9199917, {0.623, 120.405}},
+    {9199953, {0.485, 134.689}},
+    {9200097, {0.663, 119.499}},
+    {9200160, {0.632, 118.000}},
+    {9200304, {0.684, 115.880}},
+    {9201321, {1.110, 115.816}},
+    {9206217, {0.911, 126.801}},
+    {9225846, {1.054, 123.366}},
+    {9225864, {1.026, 119.465}},
+    {9321984, {0.000, 119.100}},
+    {9323532, {0.472, 123.585}},
+    {9323721, {0.774, 119.267}},
+    {9324513, {1.181, 116.311}},
+    {9324756, {0.582, 124.037}},
+    {9324945, {1.029, 118.607}},
+    {9325980, {0.585, 121.521}},
+    {9326169, {0.885, 126.567}},
+    {9332100, {0.785, 111.009}},
+    {9332289, {1.288, 110.357}},
+    {9333324, {0.683, 120.258}},
+    {9333513, {1.186, 115.661}},
+    {9366372, {0.450, 117.534}},
+    {9366381, {0.602, 120.000}},
+    {9366561, {0.646, 120.649}},
+    {9366615, {0.579, 123.766}},
+    {9366768, {0.625, 120.000}},
+    {9367785, {1.058, 115.912}},
+    {9392319, {1.019, 118.915}},
+    {9488448, {0.000, 120.900}},
+    {9488449, {0.000, 118.100}},
+    {9490167, {1.017, 117.865}},
+    {9492616, {1.085, 115.034}},
+    {9495063, {0.674, 116.747}},
+    {9496287, {1.279, 119.257}},
+    {9499960, {0.980, 128.143}},
+    {9503631, {1.058, 118.327}},
+    {9507303, {0.983, 123.646}},
+    {9519543, {0.790, 122.889}},
+    {9534232, {0.967, 121.379}},
+    {9556263, {0.855, 126.476}},
+    {9556336, {1.016, 118.800}},
+    {9556345, {1.039, 117.166}},
+    {9557496, {1.342, 120.010}},
+    {9654912, {0.000, 119.000}},
+    {9654913, {0.000, 119.900}},
+    {9656469, {1.003, 119.236}},
+    {9656712, {0.961, 121.070}},
+    {9658918, {0.983, 121.506}},
+    {9662589, {1.371, 114.370}},
+    {9677277, {1.005, 120.665}},
+    {9699309, {0.650, 118.713}},
+    {9699543, {0.650, 118.000}},
+    {9699552, {0.620, 120.051}},
+    {9700533, {0.996, 122.710}},
+    {9700534, {1.036, 118.260}},
+    {9700767, {1.087, 116.989}},
+    {9700776, {1.061, 117.942}},
+    {9821376, {0.000, 105.600}},
+    {9899055, {1.273, 106.313}},
+    {9899073, {1.750, 107.755}},
+    {9899190, {1.713, 101.179}},
+    {9899208, {1.599, 105.341}},
+    {9901521, {1.754, 107.683}},
+    {9901638, {1.644, 107.142}},
+    {9901674, {1.864, 103.624}},
+    {10154304, {0.000, 180.000}},
+    {10156068, {0.475, 180.000}},
+    {10199970, {0.536, 180.000}},
+    {10200132, {0.484, 180.000}},
+    {10320768, {0.000, 108.300}},
+    {10322154, {1.316, 109.273}},
+    {10323423, {0.817, 105.542}},
+    {10324467, {1.318, 106.821}},
+    {10324602, {1.311, 111.144}},
+    {10324935, {1.528, 102.414}},
+    {10331946, {1.515, 107.660}},
+    {10343133, {1.229, 114.618}},
+    {10343169, {1.366, 108.722}},
+    {10343367, {1.427, 106.284}},
+    {10343376, {1.317, 110.366}},
+    {10487232, {0.000, 123.300}},
+    {10487233, {0.000, 124.300}},
+    {10488807, {0.935, 121.832}},
+    {10488852, {0.902, 122.101}},
+    {10488987, {1.175, 115.253}},
+    {10489032, {0.737, 131.378}},
+    {10489050, {0.865, 127.610}},
+    {10490032, {1.027, 117.864}},
+    {10490212, {0.987, 127.524}},
+    {10490257, {0.730, 133.818}},
+    {10490275, {0.828, 132.383}},
+    {10491256, {0.900, 125.395}},
+    {10491301, {0.935, 120.481}},
+    {10491436, {1.158, 117.219}},
+    {10491481, {0.766, 130.065}},
+    {10491499, {0.950, 123.049}},
+    {10492525, {0.848, 126.602}},
+    {10492660, {1.211, 114.804}},
+    {10492705, {0.795, 127.817}},
+    {10493703, {0.617, 121.127}},
+    {10493748, {0.393, 126.141}},
+    {10493883, {0.784, 114.076}},
+    {10493928, {0.577, 131.721}},
+    {10493946, {0.643, 125.134}},
+    {10494054, {0.482, 130.000}},
+    {10494081, {0.588, 124.000}},
+    {10494927, {1.234, 120.509}},
+    {10495107, {1.564, 113.514}},
+    {10495152, {0.951, 131.301}},
+    {10498600, {1.068, 121.741}},
+    {10498645, {0.963, 124.598}},
+    {10498825, {0.804, 134.237}},
+    {10498843, {0.912, 133.020}},
+    {10499823, {1.084, 120.356}},
+    {10499868, {1.112, 115.732}},
+    {10500003, {1.307, 116.218}},
+    {10500048, {0.867, 128.750}},
+    {10500066, {0.981, 127.617}},
+    {10502271, {1.111, 114.439}},
+    {10502316, {1.035, 119.321}},
+    {10502496, {0.838, 126.226}},
+    {10502514, {0.980, 122.280}},
+    {10505943, {1.064, 117.958}},
+    {10505988, {0.952, 125.654}},
+    {10506168, {0.813, 129.284}},
+    {10506186, {0.962, 124.490}},
+    {10509660, {1.110, 116.077}},
+    {10509840, {0.740, 135.028}},
+    {10510839, {0.647, 132.369}},
+    {10511064, {0.517, 141.986}},
+    {10518183, {0.597, 139.439}},
+    {10518426, {0.776, 122.699}},
+    {10530603, {1.351, 124.475}},
+    {10530648, {0.808, 145.098}},
+    {10532871, {1.011, 132.046}},
+    {10532872, {0.934, 123.481}},
+    {10532916, {0.764, 133.930}},
+    {10532917, {0.915, 121.637}},
+    {10533051, {1.041, 124.836}},
+    {10533052, {1.214, 114.211}},
+    {10533096, {0.679, 122.881}},
+    {10533097, {0.742, 131.784}},
+    {10533114, {0.742, 140.668}},
+    {10533115, {0.871, 128.130}},
+    {10534095, {1.022, 124.814}},
+    {10534320, {0.910, 126.513}},
+    {10535319, {0.910, 131.461}},
+    {10535320, {1.105, 119.174}},
+    {10535328, {1.112, 119.261}},
+    {10535365, {1.144, 114.126}},
+    {10535373, {1.166, 115.115}},
+    {10535482, {0.931, 123.222}},
+    {10535490, {1.042, 123.231}},
+    {10535536, {0.949, 122.353}},
+    {10535544, {0.813, 107.255}},
+    {10535545, {0.943, 123.441}},
+    {10535562, {1.012, 110.865}},
+    {10535563, {1.095, 120.834}},
+    {10536588, {0.943, 125.881}},
+    {10536723, {1.298, 117.078}},
+    {10536768, {0.845, 130.865}},
+    {10536786, {0.940, 130.926}},
+    {10541493, {1.125, 114.633}},
+    {10541592, {1.030, 120.178}},
+    {10541646, {0.991, 122.899}},
+    {10541656, {0.894, 123.341}},
+    {10541664, {0.853, 108.480}},
+    {10541682, {0.854, 114.516}},
+    {10541736, {0.915, 129.129}},
+    {10541790, {1.217, 106.254}},
+    {10541817, {1.278, 108.400}},
+    {10542843, {1.467, 108.824}},
+    {10542888, {0.940, 122.725}},
+    {10542906, {1.164, 116.157}},
+    {10556370, {0.875, 134.888}},
+    {10557595, {0.945, 123.246}},
+    {10558800, {0.965, 122.522}},
+    {10560024, {1.035, 110.108}},
+    {10560042, {1.181, 115.592}},
+    {10563714, {0.976, 128.662}},
+    {10564921, {0.776, 129.499}},
+    {10564939, {0.929, 124.689}},
+    {10568664, {0.911, 129.610}},
+    {10653696, {0.000, 121.400}},
+    {10653697, {0.000, 121.700}},
+    {10655487, {0.776, 128.041}},
+    {10655496, {0.766, 128.061}},
+    {10655505, {0.963, 120.640}},
+    {10655514, {0.952, 120.685}},
+    {10655649, {1.050, 114.735}},
+    {10655658, {1.013, 117.414}},
+    {10656712, {0.861, 122.947}},
+    {10656721, {0.816, 125.433}},
+    {10656730, {0.907, 125.781}},
+    {10656739, {1.010, 118.540}},
+    {10656883, {0.923, 124.473}},
+    {10657936, {0.828, 124.890}},
+    {10657945, {0.774, 128.286}},
+    {10657954, {0.973, 120.954}},
+    {10657963, {0.949, 121.821}},
+    {10658098, {0.995, 118.754}},
+    {10659160, {0.845, 123.889}},
+    {10659169, {0.804, 126.131}},
+    {10659178, {1.036, 117.401}},
+    {10659187, {1.010, 118.254}},
+    {10660383, {0.501, 126.170}},
+    {10660392, {0.546, 127.405}},
+    {10660401, {0.664, 118.412}},
+    {10660410, {0.699, 120.478}},
+    {10660518, {0.482, 127.331}},
+    {10660545, {0.605, 120.000}},
+    {10660554, {0.597, 122.000}},
+    {10661607, {1.112, 120.985}},
+    {10661616, {1.043, 123.922}},
+    {10661625, {1.348, 115.506}},
+    {10661634, {1.156, 123.890}},
+    {10665289, {0.959, 120.924}},
+    {10665298, {1.098, 119.529}},
+    {10665307, {1.013, 123.743}},
+    {10666503, {0.937, 123.695}},
+    {10666512, {0.893, 125.735}},
+    {10666521, {1.016, 124.788}},
+    {10666530, {1.065, 121.125}},
+    {10668951, {0.845, 126.259}},
+    {10668960, {0.869, 124.058}},
+    {10668969, {1.020, 120.198}},
+    {10668978, {0.971, 122.900}},
+    {10670175, {0.845, 123.004}},
+    {10670184, {0.883, 120.111}},
+    {10672623, {0.870, 124.581}},
+    {10672632, {0.882, 123.309}},
+    {10672641, {1.008, 121.049}},
+    {10672650, {0.990, 121.826}},
+    {10676313, {1.065, 118.404}},
+    {10676322, {1.067, 118.002}},
+    {10699551, {0.906, 117.966}},
+    {10699560, {0.854, 136.087}},
+    {10699561, {0.772, 128.673}},
+    {10699569, {0.799, 134.844}},
+    {10699570, {0.942, 122.866}},
+    {10699578, {0.845, 130.337}},
+    {10699686, {0.706, 135.432}},
+    {10699713, {0.917, 124.856}},
+    {10699722, {0.946, 123.684}},
+    {10699723, {1.000, 119.086}},
+    {10700775, {0.988, 121.242}},
+    {10700784, {0.858, 129.014}},
+    {10700793, {0.989, 127.335}},
+    {10700802, {1.022, 124.454}},
+    {10702008, {1.086, 114.312}},
+    {10702017, {1.060, 122.481}},
+    {10702018, {1.204, 114.188}},
+    {10702027, {1.170, 115.157}},
+    {10703223, {0.948, 123.538}},
+    {10703232, {0.928, 123.853}},
+    {10703241, {0.958, 129.125}},
+    {10703385, {1.035, 123.154}},
+    {10703394, {1.183, 115.934}},
+    {10706895, {0.885, 126.749}},
+    {10706904, {0.898, 124.876}},
+    {10706913, {1.024, 123.706}},
+    {10706922, {1.017, 123.409}},
+    {10709343, {0.981, 120.063}},
+    {10709352, {0.921, 123.014}},
+    {10709361, {1.276, 110.521}},
+    {10709370, {1.199, 113.371}},
+    {10721592, {0.907, 124.405}},
+    {10721601, {1.002, 125.220}},
+    {10724050, {1.020, 117.950}},
+    {10724059, {0.959, 121.017}},
+    {10725255, {1.075, 115.646}},
+    {10725264, {0.815, 131.812}},
+    {10725282, {0.978, 126.562}},
+    {10730160, {0.885, 126.560}},
+    {10730169, {1.073, 121.703}},
+    {10731384, {0.866, 108.239}},
+    {10731385, {0.827, 124.584}},
+    {10731402, {1.038, 111.621}},
+    {10731510, {1.172, 105.176}},
+    {10731537, {1.164, 110.895}},
+    {10731546, {1.395, 101.902}},
+    {10732608, {0.967, 115.037}},
+    {10732617, {0.916, 113.570}},
+    {10732627, {1.003, 118.067}},
+    {10732734, {1.194, 103.479}},
+    {10732770, {1.210, 108.553}},
+    {10733850, {1.055, 115.369}},
+    {10733985, {1.168, 116.240}},
+    {10735074, {0.932, 129.624}},
+    {10820160, {0.000, 104.500}},
+    {10868472, {1.738, 101.550}},
+    {10868490, {1.589, 106.360}},
+    {10868634, {1.740, 101.208}},
+    {10874592, {1.430, 103.829}},
+    {10874610, {1.366, 110.552}},
+    {10874718, {1.419, 104.213}},
+    {10892952, {1.788, 103.452}},
+    {10893105, {1.774, 104.872}},
+    {10986624, {0.000, 106.900}},
+    {11064312, {1.206, 103.779}},
+    {11064330, {1.406, 106.735}},
+    {11064438, {1.339, 105.365}},
+    {11064465, {1.408, 106.806}},
+    {11065545, {1.709, 107.658}},
+    {11066778, {1.932, 111.306}},
+    {11153088, {0.000, 119.900}},
+    {11153089, {0.000, 116.600}},
+    {11154339, {0.982, 120.683}},
+    {11154393, {1.178, 115.581}},
+    {11154600, {1.233, 119.589}},
+    {11154915, {1.257, 111.574}},
+    {11155825, {1.118, 126.320}},
+    {11156140, {1.231, 113.438}},
+    {11156967, {0.567, 128.000}},
+    {11157048, {1.290, 120.945}},
+    {11157094, {1.122, 113.631}},
+    {11164375, {1.142, 118.899}},
+    {11164392, {1.325, 125.531}},
+    {11164438, {1.186, 115.979}},
+    {11181528, {0.805, 120.000}},
+    {11190097, {1.370, 114.854}},
+    {11192590, {1.240, 120.019}},
+    {11192859, {1.504, 117.327}},
+    {11198980, {1.310, 110.017}},
+    {11319552, {0.000, 108.800}},
+    {11320785, {1.159, 108.238}},
+    {11320983, {0.772, 107.200}},
+    {11321064, {0.958, 110.757}},
+    {11347911, {0.650, 104.892}},
+    {11347992, {0.659, 112.977}},
+    {11486016, {0.000, 120.300}},
+    {11525517, {1.123, 121.777}},
+    {11525526, {1.486, 117.217}},
+    {11531637, {1.223, 116.447}},
+    {11532870, {1.122, 125.930}},
+    {11690703, {0.658, 103.978}},
+    {12151872, {0.000, 106.600}},
+    {12153384, {1.590, 100.180}},
+    {12153744, {1.481, 96.166}},
+    {12191328, {1.665, 115.012}},
+    {12191688, {1.326, 115.134}},
+    {12318336, {0.000, 113.000}},
+    {12322071, {1.357, 113.010}},
+    {12484800, {0.000, 94.900}},
+    {12486051, {1.138, 96.779}},
+    {12488643, {1.044, 91.970}},
+    {12489111, {0.729, 95.899}},
+    {12651264, {0.000, 107.600}},
+    {12744972, {1.434, 109.889}},
+    {12744990, {1.493, 103.519}},
+    {12747438, {1.235, 109.421}},
+    {12817728, {0.000, 109.500}},
+    {12857184, {1.652, 109.472}},
+    {12984192, {0.000, 121.900}},
+    {12984193, {0.000, 126.100}},
+    {12986118, {0.744, 130.960}},
+    {12986145, {0.938, 121.477}},
+    {12988567, {0.827, 125.468}},
+    {12988594, {0.922, 123.748}},
+    {12990996, {0.584, 123.407}},
+    {12991014, {0.546, 128.000}},
+    {12991023, {0.617, 122.000}},
+    {12991041, {0.542, 109.881}},
+    {12995911, {0.863, 129.501}},
+    {12995938, {0.991, 125.857}},
+    {13030164, {0.770, 137.282}},
+    {13030182, {0.803, 128.249}},
+    {13030209, {0.864, 128.714}},
+    {13031406, {0.844, 130.617}},
+    {13031433, {1.023, 123.532}},
+    {13032504, {0.734, 138.714}},
+    {13032630, {1.202, 109.426}},
+    {13033836, {0.930, 130.150}},
+    {13033854, {0.778, 135.746}},
+    {13033881, {1.058, 121.251}},
+    {13038615, {0.677, 141.902}},
+    {13038624, {0.663, 142.589}},
+    {13038642, {0.816, 134.701}},
+    {13038750, {1.089, 111.702}},
+    {13039956, {1.199, 114.467}},
+    {13039974, {0.915, 125.050}},
+    {13040001, {1.216, 112.926}},
+    {13056984, {0.963, 128.471}},
+    {13056993, {1.097, 128.375}},
+    {13057110, {1.443, 105.916}},
+    {13061880, {0.942, 117.779}},
+    {13063113, {0.835, 131.530}},
+    {13063230, {1.038, 111.834}},
+    {13065678, {1.030, 118.376}},
+    {13077900, {1.245, 113.179}},
+    {13077918, {1.159, 111.900}},
+    {13080366, {1.336, 99.459}},
+    {13080393, {1.302, 105.130}},
+    {13081617, {1.217, 114.792}},
+    {13150656, {0.000, 103.400}},
+    {13246857, {1.569, 102.043}},
+    {13248081, {1.625, 104.857}},
+    {13317120, {0.000, 121.900}},
+    {13317121, {0.000, 128.200}},
+    {13319073, {0.864, 127.147}},
+    {13321522, {0.886, 128.181}},
+    {13323969, {0.651, 125.682}},
+    {13339881, {1.032, 120.869}},
+    {13368033, {0.909, 125.057}},
+    {13371471, {0.918, 127.755}},
+    {13371705, {1.184, 112.411}},
+    {13384971, {1.254, 120.263}},
+    {13385169, {0.991, 127.612}},
+    {13386393, {1.003, 126.038}},
+    {13390065, {1.439, 112.030}},
+    {13416993, {1.205, 108.609}},
+    {13483584, {0.000, 119.500}},
+    {13485375, {0.996, 120.129}},
+    {13485384, {0.978, 119.970}},
+    {13485510, {0.879, 126.535}},
+    {13485519, {1.144, 116.113}},
+    {13485528, {0.895, 126.324}},
+    {13486735, {0.927, 125.080}},
+    {13486753, {0.895, 128.399}},
+    {13495303, {1.015, 124.270}},
+    {13495321, {1.106, 120.028}},
+    {13528224, {0.522, 130.295}},
+    {13528242, {0.583, 128.738}},
+    {13528350, {0.578, 124.658}},
+    {13528368, {0.575, 124.787}},
+    {13529448, {0.929, 122.408}},
+    {13529449, {0.983, 119.722}},
+    {13529457, {1.184, 114.158}},
+    {13529458, {1.281, 110.477}},
+    {13529575, {0.884, 126.208}},
+    {13529593, {0.940, 123.333}},
+    {13561272, {1.115, 114.945}},
+    {13562505, {1.075, 122.099}},
+    {13562640, {1.143, 113.176}},
+    {13565088, {1.067, 122.250}},
+    {13579776, {0.957, 110.556}},
+    {13581000, {1.379, 107.936}},
+    {13689747, {1.666, 114.660}},
+    {13689792, {1.075, 131.706}},
+    {13689801, {1.238, 129.293}},
+    {13722840, {1.563, 105.660}},
+    {13728969, {1.281, 112.955}},
+};
+
+const MmffParametersEntry<MmffStrechBendParameters> StrechBendParameters[] = {
+    {223596, {0.206, 0.206}},
+    {223608, {0.136, 0.197}},
+    {223620, {0.211, 0.092}},
+    {223644, {0.227, 0.070}},
+    {223656, {0.173, 0.417}},
+    {223680, {0.136, 0.282}},
+    {223704, {0.187, 0.338}},
+    {223716, {0.209, 0.633}},
+    {223728, {0.176, 0.386}},
+    {223764, {0.139, 0.217}},
+    {223992, {0.236, 0.436}},
+    {224028, {0.152, 0.260}},
+    {224052, {0.144, 0.595}},
+    {224076, {0.122, 0.051}},
+    {224256, {0.262, 0.451}},
+    {224400, {0.186, 0.125}},
+    {225240, {0.282, 0.282}},
+    {225252, {0.206, 0.022}},
+    {225276, {0.234, 0.088}},
+    {225288, {0.183, 0.387}},
+    {225312, {0.214, 0.363}},
+    {226908, {0.157, 0.115}},
+    {226920, {-0.036, 0.456}},
+    {226968, {0.038, 0.195}},
+    {230172, {0.115, 0.115}},
+    {230184, {0.013, 0.436}},
+    {230208, {0.027, 0.358}},
+    {230220, {0.040, 0.418}},
+    {230232, {0.043, 0.261}},
+    {230244, {0.003, 0.452}},
+    {230256, {-0.018, 0.380}},
+    {230292, {0.018, 0.255}},
+    {230328, {0.121, 0.218}},
+    {230352, {0.069, 0.327}},
+    {230376, {0.055, 0.267}},
+    {230520, {-0.003, 0.342}},
+    {230556, {0.074, 0.287}},
+    {230580, {0.092, 0.607}},
+    {230592, {0.023, 0.335}},
+    {230604, {0.093, 0.118}},
+    {230760, {0.016, 0.343}},
+    {230772, {0.030, 0.397}},
+    {230784, {0.031, 0.384}},
+    {230928, {0.041, 0.216}},
+    {231816, {0.320, 0.320}},
+    {232188, {0.310, 0.160}},
+    {240036, {0.586, 0.586}},
+    {241680, {0.508, 0.508}},
+    {445548, {0.250, 0.250}},
+    {445560, {0.203, 0.207}},
+    {445562, {0.222, 0.269}},
+    {445574, {0.244, 0.292}},
+    {445596, {0.215, 0.128}},
+    {445982, {0.246, 0.260}},
+    {447193, {0.250, 0.219}},
+    {447206, {0.155, 0.112}},
+    {447228, {0.207, 0.157}},
+    {447229, {0.267, 0.159}},
+    {447240, {0.118, 0.576}},
+    {447614, {0.143, 0.172}},
+    {447648, {0.289, 0.390}},
+    {447660, {0.191, -0.047}},
+    {448861, {0.264, 0.156}},
+    {452124, {0.140, 0.140}},
+    {452136, {0.213, 0.502}},
+    {452510, {0.153, 0.288}},
+    {452544, {0.070, 0.463}},
+    {452556, {0.191, 0.005}},
+    {667500, {0.358, 0.358}},
+    {667514, {0.246, 0.409}},
+    {667526, {0.303, 0.145}},
+    {667548, {0.321, 0.183}},
+    {667560, {0.338, 0.732}},
+    {667572, {0.154, 0.856}},
+    {667608, {0.223, 0.732}},
+    {667934, {0.217, 0.207}},
+    {669181, {0.407, 0.159}},
+    {669193, {0.429, 0.473}},
+    {669205, {0.214, 0.794}},
+    {669229, {0.227, 0.610}},
+    {669241, {0.298, 0.600}},
+    {670813, {0.251, 0.133}},
+    {670825, {0.066, 0.668}},
+    {670837, {-0.093, 0.866}},
+    {674076, {0.126, 0.126}},
+    {674088, {0.174, 0.734}},
+    {674100, {0.032, 0.805}},
+    {674124, {0.037, 0.669}},
+    {674136, {0.169, 0.619}},
+    {674496, {0.087, 0.685}},
+    {674664, {0.098, 0.210}},
+    {675732, {0.494, 0.578}},
+    {675892, {1.179, 0.752}},
+    {676094, {0.350, 0.175}},
+    {677400, {0.771, 0.353}},
+    {677520, {0.865, -0.181}},
+    {677726, {0.707, 0.007}},
+    {681024, {0.680, 0.260}},
+    {682296, {1.050, 1.050}},
+    {698740, {0.536, 0.536}},
+    {731616, {0.482, 0.482}},
+    {1333356, {0.309, 0.309}},
+    {1333368, {0.157, 0.375}},
+    {1333380, {-0.153, 0.252}},
+    {1333596, {0.256, 0.143}},
+    {1333788, {0.163, 0.375}},
+    {1335012, {-0.228, 0.052}},
+    {1335324, {0.259, 0.163}},
+    {1336852, {0.456, 0.379}},
+    {1336896, {0.215, 0.064}},
+    {1337052, {-0.225, -0.320}},
+    {1345020, {0.304, 0.055}},
+    {1348284, {0.419, 0.158}},
+    {1361484, {0.309, 0.120}},
+    {1364596, {0.739, 0.739}},
+    {1379484, {0.130, 0.241}},
+    {1382676, {0.227, 0.227}},
+    {1777260, {0.312, 0.312}},
+    {1777320, {0.212, 0.354}},
+    {1777524, {0.309, 0.135}},
+    {1785684, {0.418, 0.020}},
+    {1808500, {0.653, 0.653}},
+    {1808532, {0.128, 0.122}},
+    {1813428, {0.190, 0.190}},
+    {1999236, {0.326, 0.580}},
+    {2002788, {0.464, 0.222}},
+    {2221164, {0.063, 0.063}},
+    {2221188, {-0.021, 0.340}},
+    {2221224, {-0.024, 0.374}},
+    {2221488, {0.155, -0.051}},
+    {2224452, {-0.219, -0.219}},
+    {2224488, {0.497, 0.513}},
+    {2224752, {0.137, 0.066}},
+    {2265552, {0.081, 0.081}},
+    {3330924, {0.125, 0.125}},
+    {3331092, {0.012, 0.238}},
+    {3331356, {0.048, 0.229}},
+    {3331764, {0.080, -0.012}},
+    {3354612, {0.172, -0.068}},
+    {3390516, {0.187, -0.027}},
+    {3446004, {0.045, 0.045}},
+    {3996780, {0.023, 0.023}},
+    {3996840, {0.003, 0.213}},
+    {3997152, {-0.091, 0.390}},
+    {3997284, {-0.008, 0.607}},
+    {4005000, {0.088, 0.088}},
+    {4005312, {0.123, 0.369}},
+    {4047744, {0.404, 0.404}},
+    {4047876, {0.384, 0.281}},
+    {4065828, {0.428, 0.428}},
+    {4440732, {0.290, 0.098}},
+    {4440912, {0.179, 0.004}},
+    {4443996, {-0.049, 0.171}},
+    {4444180, {0.607, 0.437}},
+    {4447260, {0.182, 0.182}},
+    {4447272, {0.051, 0.312}},
+    {4447296, {0.072, 0.226}},
+    {4447344, {0.014, 0.597}},
+    {4447440, {0.101, 0.079}},
+    {4447560, {0.108, 0.123}},
+    {4449076, {0.823, 0.396}},
+    {4452340, {0.701, 0.369}},
+    {4458864, {0.310, 0.000}},
+    {4471924, {0.283, 0.283}},
+    {4472044, {0.340, 0.529}},
+    {4884636, {0.067, 0.174}},
+    {4884840, {0.199, 0.039}},
+    {4891164, {0.254, 0.254}},
+    {4891368, {0.181, 0.108}},
+    {4919117, {0.000, 0.000}},
+    {5778972, {-0.121, -0.121}},
+    {6666960, {0.251, 0.007}},
+    {6667080, {0.267, 0.054}},
+    {6691564, {0.413, 0.705}},
+    {7548012, {0.202, 0.202}},
+    {7548432, {0.160, -0.009}},
+    {7605552, {0.087, 0.087}},
+    {8214300, {0.485, 0.311}},
+    {8215933, {0.321, 0.235}},
+    {8217565, {0.179, 0.217}},
+    {8220828, {0.279, 0.250}},
+    {8220840, {0.267, 0.389}},
+    {8221140, {0.216, 0.434}},
+    {8221152, {0.167, 0.364}},
+    {8221212, {0.273, 0.391}},
+    {8222460, {0.830, 0.339}},
+    {8237148, {0.650, 0.259}},
+    {8273052, {-0.411, -0.411}},
+    {8273064, {-0.424, -0.466}},
+    {8273088, {0.429, 0.901}},
+    {8273364, {-0.173, -0.215}},
+    {8273376, {-0.229, -0.229}},
+    {8273436, {-0.244, -0.555}},
+    {8274696, {-0.516, -0.516}},
+    {8495004, {-0.342, -0.342}},
+    {8495016, {-0.164, -1.130}},
+    {8658516, {0.313, 0.500}},
+    {8694420, {-0.131, 0.422}},
+    {8694444, {-0.122, 0.281}},
+    {8759700, {0.469, 0.469}},
+    {8759724, {0.741, 0.506}},
+    {8762988, {0.706, 0.706}},
+    {8880048, {0.238, 0.091}},
+    {8880156, {0.153, 0.590}},
+    {8881680, {0.342, 0.156}},
+    {8883312, {0.228, 0.104}},
+    {8924112, {0.094, 0.094}},
+    {8924220, {0.186, 0.423}},
+    {9102048, {0.503, 0.943}},
+    {9103680, {0.594, 0.969}},
+    {9108576, {0.276, 0.852}},
+    {9152640, {0.652, 0.652}},
+    {9573588, {0.377, 0.057}},
+    {9581748, {0.082, 0.082}},
+    {9869460, {0.591, 0.591}},
+    {9869484, {0.857, 0.978}},
+    {10957848, {0.072, 0.072}},
+    {11987076, {0.192, -0.051}},
+    {11987472, {0.240, 0.079}},
+    {11990736, {0.005, 0.127}},
+    {12044592, {0.148, 0.148}},
+    {12209424, {0.189, 0.033}},
+    {12209676, {0.166, 0.211}},
+    {12266544, {0.106, 0.106}},
+    {12266796, {0.093, 0.080}},
+    {12431376, {0.211, -0.040}},
+    {12431628, {0.026, 0.386}},
+    {12488496, {0.101, 0.101}},
+    {12488748, {0.108, 0.068}},
+    {12660084, {0.043, 0.420}},
+    {12741684, {0.125, 0.125}},
+    {12743328, {0.431, 0.431}},
+    {12746616, {0.732, 0.732}},
+    {13198740, {0.497, 0.497}},
+    {13198764, {0.723, 0.874}},
+    {13991604, {0.009, 0.654}},
+    {13991664, {-0.015, 0.446}},
+    {13991844, {0.067, 0.588}},
+    {13991904, {0.055, 0.370}},
+    {13991928, {0.110, 0.464}},
+    {14043828, {0.178, 0.523}},
+    {14044128, {-0.045, 0.497}},
+    {14047392, {0.422, 0.409}},
+    {14047416, {0.436, 0.525}},
+    {14055552, {0.581, 0.426}},
+    {14055576, {0.542, 0.365}},
+    {14080032, {0.852, 0.332}},
+    {14080056, {0.775, 0.300}},
+    {14213844, {0.086, 0.345}},
+    {14213856, {0.085, 0.369}},
+    {14213868, {0.051, 0.436}},
+    {14213880, {0.113, 0.452}},
+    {14266068, {0.059, 0.299}},
+    {14266080, {0.277, 0.377}},
+    {14308512, {0.206, 0.030}},
+    {14308536, {0.171, 0.078}},
+    {14310156, {0.079, 0.403}},
+    {14311800, {0.406, 0.066}},
+    {14491296, {0.528, 0.644}},
+    {14491320, {0.397, 0.258}},
+    {14499456, {0.816, 0.543}},
+    {14523936, {1.177, 0.594}},
+    {14752416, {0.213, -0.173}},
+    {14752440, {0.234, 0.077}},
+    {14754060, {-0.149, 0.383}},
+    {14755704, {0.199, 0.101}},
+    {15094380, {0.217, 0.217}},
+    {15094644, {0.285, 0.050}},
+    {15094752, {-0.047, 0.503}},
+    {15130548, {0.145, 0.145}},
+    {15130656, {-0.182, 0.504}},
+    {15367356, {1.018, 0.418}},
+    {15375516, {-0.169, -0.169}},
+    {15587604, {0.210, 0.210}},
+    {17321352, {0.279, 0.250}},
+    {17321388, {0.083, 0.250}},
+    {17440524, {-0.398, 0.314}},
+    {17765292, {-0.101, 0.691}},
+    {17889324, {0.732, 0.732}},
+    {18037800, {0.021, 0.368}},
+    {18037824, {0.018, 0.422}},
+    {18106368, {0.366, 0.419}},
+};
+
+const MmffDefaultStrechBendParameters DefaultStrechBendParameters[] = {
+    {0, 1, 0, {0.15, 0.15}},
+    {0, 1, 1, {0.10, 0.30}},
+    {0, 1, 2, {0.05, 0.35}},
+    {0, 1, 3, {0.05, 0.35}},
+    {0, 1, 4, {0.05, 0.35}},
+    {0, 2, 0, {0.00, 0.00}},
+    {0, 2, 1, {0.00, 0.15}},
+    {0, 2, 2, {0.00, 0.15}},
+    {0, 2, 3, {0.00, 0.15}},
+    {0, 2, 4, {0.00, 0.15}},
+    {1, 1, 1, {0.30, 0.30}},
+    {1, 1, 2, {0.30, 0.50}},
+    {1, 1, 3, {0.30, 0.50}},
+    {1, 1, 4, {0.30, 0.50}},
+    {2, 1, 2, {0.50, 0.50}},
+    {2, 1, 3, {0.50, 0.50}},
+    {2, 1, 4, {0.50, 0.50}},
+    {3, 1, 3, {0.50, 0.50}},
+    {3, 1, 4, {0.50, 0.50}},
+    {4, 1, 4, {0.50, 0.50}},
+    {1, 2, 1, {0.30, 0.30}},
+    {1, 2, 2, {0.25, 0.25}},
+    {1, 2, 3, {0.25, 0.25}},
+    {1, 2, 4, {0.25, 0.25}},
+    {2, 2, 2, {0.25, 0.25}},
+    {2, 2, 3, {0.25, 0.25}},
+    {2, 2, 4, {0.25, 0.25}},
+    {3, 2, 3, {0.25, 0.25}},
+    {3, 2, 4, {0.25, 0.25}},
+    {4, 2, 4, {0.25, 0.25}},
+};
+
+const MmffParametersEntry<MmffOutOfPlaneBendingParameters> OutOfPlaneBendingParameters[] = {
+    {5030912, {0.020}},
+    {5049546, {0.030}},
+    {5049682, {0.027}},
+    {5049683, {0.026}},
+    {5049685, {0.013}},
+    {5049717, {0.032}},
+    {5068181, {0.013}},
+    {5068317, {0.012}},
+    {5068589, {0.006}},
+    {5068590, {0.027}},
+    {5068621, {0.017}},
+    {5068624, {0.012}},
+    {5068625, {0.008}},
+    {7546368, {0.130}},
+    {7565007, {0.146}},
+    {7565143, {0.138}},
+    {7565279, {0.134}},
+    {7565551, {0.122}},
+    {7565687, {0.141}},
+    {7565826, {0.129}},
+    {7565853, {0.138}},
+    {7584047, {0.113}},
+    {7584049, {0.081}},
+    {7584183, {0.127}},
+    {7584322, {0.116}},
+    {7602543, {0.113}},
+    {7602679, {0.127}},
+    {7639535, {0.103}},
+    {7639537, {0.074}},
+    {7639582, {0.078}},
+    {7639671, {0.119}},
+    {7639810, {0.102}},
+    {7640112, {0.067}},
+    {7658333, {0.127}},
+    {7677210, {0.113}},
+    {7678580, {0.151}},
+    {7718312, {0.057}},
+    {20123648, {0.000}},
+    {25154560, {-0.020}},
+    {25173195, {-0.02}},
+    {25173470, {-0.033}},
+    {25173492, {-0.02}},
+    {25210484, {-0.030}},
+    {25213884, {-0.019}},
+    {42762752, {0.000}},
+    {65401856, {0.000}},
+    {75463680, {0.010}},
+    {75558910, {0.008}},
+    {93071872, {0.035}},
+    {93095437, {0.040}},
+    {93113933, {0.031}},
+    {93132429, {0.027}},
+    {93169421, {0.015}},
+    {93169422, {0.046}},
+    {93169447, {0.008}},
+    {93169448, {0.012}},
+    {93169453, {0.016}},
+    {93169558, {0.084}},
+    {93187917, {0.048}},
+    {93354381, {0.025}},
+    {93761296, {0.046}},
+    {98102784, {0.020}},
+    {98129911, {0.012}},
+    {98536823, {-0.014}},
+    {98536825, {0.021}},
+    {98537097, {0.062}},
+    {100618240, {-0.005}},
+    {100640581, {-0.006}},
+    {100659068, {-0.007}},
+    {100677564, {-0.007}},
+    {101139973, {0.004}},
+    {103133696, {0.180}},
+    {103156576, {0.178}},
+    {103175072, {0.161}},
+    {103230560, {0.158}},
+    {108164608, {0.000}},
+    {113195520, {0.150}},
+    {123257344, {0.000}},
+    {124188994, {0.000}},
+    {135834624, {0.020}},
+    {135853564, {0.016}},
+    {135895044, {0.018}},
+    {138350080, {0.020}},
+    {138373529, {0.020}},
+    {139020889, {0.020}},
+    {140865536, {0.020}},
+    {140888985, {0.020}},
+    {141536345, {0.020}},
+    {143380992, {0.080}},
+    {143481007, {0.038}},
+    {144424440, {0.158}},
+    {145896448, {0.025}},
+    {158473728, {0.050}},
+    {158571576, {0.019}},
+    {158571578, {0.068}},
+    {158572256, {0.014}},
+    {158572258, {0.055}},
+    {158574296, {0.033}},
+    {158574298, {0.085}},
+    {159163448, {0.010}},
+    {160989184, {0.040}},
+    {161090296, {0.006}},
+    {161090298, {0.043}},
+    {161090433, {0.052}},
+    {161090570, {0.094}},
+    {161682168, {-0.011}},
+    {168535552, {0.070}},
+    {173566464, {0.070}},
+    {174163405, {0.067}},
+    {183628288, {0.000}},
+    {196205568, {0.045}},
+    {196308737, {0.046}},
+    {201236480, {0.080}},
+    {201340057, {0.057}},
+    {203751936, {0.025}},
+    {204428480, {0.016}},
+    {206267392, {0.000}},
+};
+
+const MmffParametersEntry<MmffTorsionParameters> TorsionParameters[] = {
+    {15203712, {0.000, 0.000, 0.300}},
+    {15203717, {0.200, -0.800, 1.500}},
+    {15204534, {0.103, 0.681, 0.332}},
+    {15204539, {0.144, -0.547, 1.126}},
+    {15204540, {-0.295, 0.438, 0.584}},
+    {15204546, {0.066, -0.156, 0.143}},
+    {15204558, {0.639, -0.630, 0.264}},
+    {15204564, {-0.688, 1.757, 0.477}},
+    {15204569, {0.000, 0.000, 0.054}},
+    {15204576, {-1.420, -0.092, 1.101}},
+    {15204581, {0.000, -0.158, 0.323}},
+    {15204594, {0.593, 0.662, 1.120}},
+    {15204600, {-0.678, 0.417, 0.624}},
+    {15204618, {-0.714, 0.698, 0.000}},
+    {15204732, {-0.647, 0.550, 0.590}},
+    {15205374, {0.321, -0.411, 0.144}},
+    {15206178, {0.443, 0.000, -1.140}},
+    {15206190, {-0.256, 0.058, 0.000}},
+    {15206196, {-0.679, -0.029, 0.000}},
+    {15207822, {0.284, -1.386, 0.314}},
+    {15207828, {-0.654, 1.072, 0.279}},
+    {15207840, {-0.744, -1.235, 0.337}},
+    {15207852, {0.000, 0.000, 0.427}},
+    {15207858, {0.000, 0.516, 0.291}},
+    {15207864, {0.678, -0.602, 0.398}},
+    {15207882, {1.142, -0.644, 0.367}},
+    {15207942, {0.000, 0.000, 0.295}},
+    {15207996, {0.692, -0.530, 0.278}},
+    {15208014, {0.000, 0.000, 0.389}},
+    {15208026, {0.000, 0.000, 0.278}},
+    {15208038, {0.000, 0.000, -0.141}},
+    {15208128, {0.000, 0.000, 0.324}},
+    {15208200, {0.000, 0.000, 0.136}},
+    {15208644, {0.408, 1.397, 0.961}},
+    {15208649, {0.313, -1.035, 1.631}},
+    {15210288, {1.055, 0.834, 0.000}},
+    {15212754, {-0.387, -0.543, 1.405}},
+    {15213576, {0.000, 0.000, 0.893}},
+    {15216042, {-0.177, 0.000, 0.049}},
+    {15314688, {0.000, 0.000, 0.000}},
+    {15314690, {0.000, 0.000, 0.000}},
+    {15314693, {0.000, 0.000, 0.000}},
+    {15314700, {0.000, 0.000, -0.650}},
+    {15314705, {0.000, 0.000, -0.650}},
+    {15315510, {0.419, 0.296, 0.282}},
+    {15315516, {-0.494, 0.274, -0.630}},
+    {15315534, {0.075, 0.000, 0.358}},
+    {15316332, {-0.293, 0.115, -0.508}},
+    {15316350, {0.301, 0.104, 0.507}},
+    {15317142, {0.565, -0.554, 0.234}},
+    {15317148, {-0.577, -0.482, -0.427}},
+    {15317166, {0.082, 0.000, 0.123}},
+    {15318774, {0.000, -0.184, 0.220}},
+    {15318780, {0.501, -0.410, -0.535}},
+    {15318782, {0.000, 0.000, 0.055}},
+    {15318788, {0.000, 0.000, -0.108}},
+    {15318798, {-0.523, -0.228, 0.208}},
+    {15318992, {0.000, 0.000, 0.000}},
+    {15319590, {-0.467, 0.000, 0.490}},
+    {15319596, {0.425, 0.168, -0.875}},
+    {15319614, {0.000, 0.136, 0.396}},
+    {15321222, {-0.504, 0.371, 0.557}},
+    {15321228, {0.541, 0.539, -1.009}},
+    {15321246, {0.000, 0.204, 0.464}},
+    {15425664, {0.000, 0.400, 0.300}},
+    {15425666, {0.000, 0.500, 0.350}},
+    {15425669, {0.000, 0.000, 0.000}},
+    {15425670, {0.000, 0.000, 0.550}},
+    {15425694, {0.000, 0.200, 0.700}},
+    {15425706, {0.000, 0.400, 0.400}},
+    {15426486, {0.103, 0.177, 0.545}},
+    {15426510, {-0.072, 0.316, 0.674}},
+    {15426516, {-0.117, -0.333, 0.202}},
+    {15426522, {0.825, 0.139, 0.325}},
+    {15426540, {-0.927, 1.112, 1.388}},
+    {15427326, {0.663, -0.167, 0.426}},
+    {15427338, {-0.758, 0.112, 0.563}},
+    {15429750, {-0.073, 0.085, 0.531}},
+    {15429758, {0.000, 0.000, 0.115}},
+    {15429764, {0.000, 0.000, 0.446}},
+    {15429774, {-0.822, 0.501, 1.008}},
+    {15429780, {0.000, -0.624, 0.330}},
+    {15429786, {0.659, -1.407, 0.308}},
+    {15429804, {-0.412, 0.693, 0.087}},
+    {15429968, {0.000, 0.000, 0.056}},
+    {15430002, {0.000, 1.027, 0.360}},
+    {15430050, {0.000, 1.543, 0.350}},
+    {15430062, {0.000, 0.501, 0.000}},
+    {15430188, {0.000, 0.513, -0.344}},
+    {15430194, {0.000, 0.511, -0.186}},
+    {15430596, {0.447, 0.652, 0.318}},
+    {15430602, {-0.395, 0.730, -0.139}},
+    {15433866, {0.338, 2.772, 2.145}},
+    {15433884, {0.548, 0.000, 1.795}},
+    {15536640, {0.000, 0.000, 0.000}},
+    {15758592, {0.000, 0.000, 0.200}},
+    {15758597, {0.000, -0.200, 0.400}},
+    {15759414, {-0.681, 0.755, 0.755}},
+    {15759419, {0.000, 0.243, -0.596}},
+    {15759426, {-0.547, 0.000, 0.320}},
+    {15759534, {0.000, 0.270, 0.237}},
+    {15760350, {0.102, 0.460, -0.128}},
+    {15761166, {-1.652, -1.660, 0.283}},
+    {15762678, {0.571, 0.319, 0.570}},
+    {15762684, {0.000, 0.000, 0.306}},
+    {15762690, {0.572, 0.000, -0.304}},
+    {15762798, {0.596, -0.276, 0.346}},
+    {15762822, {0.000, 0.000, 0.061}},
+    {15762894, {0.000, 0.000, 0.106}},
+    {15762942, {0.000, 0.000, -0.174}},
+    {15763494, {0.229, -0.710, 0.722}},
+    {15763499, {0.000, 0.000, 0.040}},
+    {15763614, {1.488, -3.401, -0.320}},
+    {15788910, {0.712, 1.320, -0.507}},
+    {15980544, {0.000, -0.300, 0.500}},
+    {15980549, {0.000, 0.000, 0.297}},
+    {15981366, {-0.439, 0.786, 0.272}},
+    {15981371, {0.115, -0.390, 0.658}},
+    {15981396, {-0.608, 0.339, 1.496}},
+    {15981498, {-0.428, 0.323, 0.280}},
+    {15982314, {0.594, -0.409, 0.155}},
+    {15984630, {0.393, -0.385, 0.562}},
+    {15984660, {0.598, -0.158, 0.399}},
+    {15984762, {-0.152, -0.440, 0.357}},
+    {16091520, {0.000, 0.000, 0.000}},
+    {16091525, {0.000, 0.000, 0.000}},
+    {16095618, {0.204, -0.335, -0.352}},
+    {16095918, {0.000, 0.000, 0.097}},
+    {16202496, {0.000, 0.000, 0.300}},
+    {16202501, {0.000, 0.000, 0.000}},
+    {16202514, {0.000, 0.000, 1.000}},
+    {16203330, {-1.027, 0.694, 0.948}},
+    {16203348, {0.159, -0.552, 0.198}},
+    {16203480, {0.552, -0.380, 0.326}},
+    {16204962, {3.100, -2.529, 1.494}},
+    {16205112, {0.079, 0.280, 0.402}},
+    {16206582, {0.000, 0.000, 0.779}},
+    {16206594, {-2.099, 1.363, 0.021}},
+    {16206612, {-0.162, 0.832, 0.552}},
+    {16206744, {-0.616, 0.000, 0.274}},
+    {16757376, {0.000, 0.000, 0.400}},
+    {16757381, {0.000, 0.000, 0.336}},
+    {16758198, {-1.047, 0.170, 0.398}},
+    {16758282, {-1.438, 0.263, 0.501}},
+    {16758618, {-0.376, -0.133, 0.288}},
+    {16761462, {1.143, -0.231, 0.447}},
+    {16761546, {1.555, -0.323, 0.456}},
+    {16761678, {0.000, 0.000, 0.459}},
+    {16761882, {0.229, 0.203, 0.440}},
+    {16979328, {0.000, 0.000, 0.350}},
+    {16979333, {0.000, 0.000, 0.000}},
+    {16983414, {0.000, 0.000, 0.536}},
+    {16983450, {0.000, 0.000, 0.212}},
+    {17090304, {0.000, 0.000, 0.100}},
+    {17090309, {0.000, 0.000, 0.112}},
+    {17094390, {0.000, 0.000, 0.000}},
+    {17094420, {0.000, 0.000, 0.099}},
+    {17094576, {0.000, 0.585, 0.388}},
+    {17094642, {0.000, -0.412, 0.121}},
+    {17094672, {0.000, 0.000, 0.195}},
+    {17094756, {0.000, 0.000, -0.088}},
+    {17201280, {0.000, 0.000, 0.150}},
+    {17201285, {0.000, 0.000, 0.179}},
+    {17205390, {0.000, 0.000, 0.196}},
+    {17205396, {0.000, 0.000, 0.176}},
+    {17205432, {0.000, 0.000, 0.152}},
+    {17312256, {0.000, 0.000, 0.350}},
+    {17312261, {0.000, 0.000, 0.350}},
+    {17316366, {0.000, 0.000, 0.344}},
+    {17316456, {0.000, 0.000, 0.361}},
+    {17534208, {0.000, 0.000, 0.236}},
+    {17534213, {0.000, 0.000, 0.236}},
+    {17867136, {0.000, 0.000, 0.300}},
+    {17867141, {0.000, 0.000, 0.251}},
+    {17867958, {0.000, -0.207, 0.232}},
+    {17868144, {0.000, 0.288, 0.218}},
+    {17871222, {0.000, 0.152, 0.235}},
+    {17871252, {0.000, 0.000, 0.495}},
+    {17871408, {0.000, -0.130, 0.214}},
+    {17871474, {0.000, 0.000, 0.466}},
+    {17871648, {0.000, 0.000, 0.243}},
+    {17978112, {0.000, 0.000, 0.450}},
+    {17978117, {0.000, 0.000, 0.376}},
+    {17982264, {0.000, 0.000, 0.439}},
+    {17982618, {0.000, 0.000, 0.472}},
+    {18865920, {0.000, 0.000, 0.250}},
+    {18865925, {0.000, 0.000, 0.198}},
+    {18866952, {0.000, 0.000, 0.187}},
+    {18870006, {0.000, 0.000, 0.247}},
+    {18870216, {0.000, 0.000, 0.259}},
+    {19198848, {0.000, 0.000, 0.200}},
+    {19198853, {0.000, 0.000, 0.000}},
+    {19199886, {0.000, 0.449, 0.000}},
+    {19203150, {0.000, -0.420, 0.391}},
+    {19203966, {0.000, 0.000, 0.150}},
+    {19420800, {0.000, 0.000, 0.000}},
+    {19420805, {0.000, 0.000, 0.000}},
+    {19421994, {0.000, -0.080, -0.056}},
+    {19425258, {0.000, 0.000, -0.113}},
+    {19531776, {0.000, 0.000, 0.250}},
+    {19531781, {0.000, 0.000, 0.297}},
+    {19536024, {0.000, -0.097, 0.203}},
+    {19536078, {0.000, 0.000, 0.329}},
+    {19642752, {0.000, 0.600, 0.000}},
+    {19643760, {0.000, 1.263, 0.000}},
+    {19647024, {0.000, 0.000, -0.106}},
+    {19647264, {0.000, 0.632, 0.000}},
+    {19864704, {0.000, 0.000, 0.150}},
+    {19864709, {0.000, 0.000, 0.297}},
+    {19868892, {0.357, -0.918, 0.000}},
+    {19868934, {0.000, 0.000, 0.061}},
+    {19868952, {-0.249, 0.382, 0.343}},
+    {20086656, {0.000, 0.000, 0.100}},
+    {20090928, {0.000, 0.000, 0.125}},
+    {20197632, {0.000, 0.000, -0.500}},
+    {20201754, {0.000, 0.000, -0.540}},
+    {21085440, {0.000, 0.000, 0.000}},
+    {21085442, {0.000, 0.000, 0.000}},
+    {21085445, {0.000, 0.000, 0.000}},
+    {21089538, {0.000, 0.000, -0.315}},
+    {21089736, {0.000, 0.000, 0.315}},
+    {21196416, {0.000, 0.000, 0.000}},
+    {21196421, {0.000, 0.000, 0.000}},
+    {21200712, {0.000, -0.058, 0.084}},
+    {21200838, {0.000, -0.058, -0.092}},
+    {21307392, {0.000, 0.000, -0.300}},
+    {21308424, {0.875, 0.668, -0.015}},
+    {21308550, {-0.870, 0.775, -0.406}},
+    {21311688, {-0.958, -0.629, -0.372}},
+    {21311814, {0.952, -0.715, -0.483}},
+    {21418368, {0.000, 0.000, 0.000}},
+    {21418373, {0.000, 0.000, 0.000}},
+    {21529344, {0.000, 0.000, 0.000}},
+    {21973248, {0.000, 0.000, 0.250}},
+    {21977436, {0.000, 0.000, 0.270}},
+    {22084224, {0.000, 0.000, 0.000}},
+    {22084229, {0.000, 0.000, 0.000}},
+    {22195200, {0.000, 0.000, 0.000}},
+    {22195205, {0.000, 0.000, 0.000}},
+    {22528128, {0.000, 0.000, 0.000}},
+    {22528133, {0.000, 0.000, 0.000}},
+    {22639104, {0.000, 0.000, 0.400}},
+    {22639926, {-0.117, 0.090, 0.751}},
+    {22640058, {0.373, 0.153, 0.635}},
+    {22640112, {-0.090, -0.169, 0.075}},
+    {22643190, {0.134, -0.112, 0.329}},
+    {22643322, {-0.361, -0.202, 0.560}},
+    {22643376, {0.072, 0.218, 0.093}},
+    {23193984, {0.000, 0.000, 0.500}},
+    {23198256, {0.000, 0.000, 0.509}},
+    {23198496, {0.000, 0.000, 0.443}},
+    {23415936, {0.000, 0.000, 0.000}},
+    {23748864, {0.000, 0.000, 0.000}},
+    {23970816, {0.000, 0.000, 0.000}},
+    {24081792, {0.000, 0.000, 0.000}},
+    {30407424, {0.000, 12.000, 0.000}},
+    {30407425, {0.000, 1.800, 0.000}},
+    {30407429, {0.000, 12.000, 0.000}},
+    {30408246, {-0.403, 12.000, 0.000}},
+    {30408252, {0.000, 12.000, 0.000}},
+    {30408253, {-0.418, 2.089, -0.310}},
+    {30408270, {0.000, 12.000, 0.000}},
+    {30408271, {0.412, 2.120, 0.269}},
+    {30409069, {0.094, 1.621, 0.877}},
+    {30409086, {0.000, 12.000, 0.000}},
+    {30409087, {0.317, 1.421, -0.870}},
+    {30409902, {0.000, 12.000, 0.000}},
+    {30411534, {0.000, 12.000, 0.000}},
+    {30411535, {-0.406, 1.767, 0.000}},
+    {30411540, {0.000, 12.000, 0.000}},
+    {30411726, {0.000, 12.000, 0.000}},
+    {30411744, {0.000, 12.000, 0.000}},
+    {30411750, {0.000, 12.000, 0.000}},
+    {30411774, {0.000, 12.000, 0.000}},
+    {30411876, {0.000, 12.000, 0.000}},
+    {30518401, {0.000, 2.500, 0.000}},
+    {30519223, {0.136, 1.798, 0.630}},
+    {30519247, {0.497, 2.405, 0.357}},
+    {30519253, {-0.211, 1.925, -0.131}},
+    {30519259, {-0.401, 2.028, -0.318}},
+    {30519277, {-0.084, 2.214, -0.610}},
+    {30520039, {-0.325, 1.553, -0.487}},
+    {30520063, {-0.295, 2.024, -0.590}},
+    {30520069, {-0.143, 1.466, 0.000}},
+    {30520075, {0.362, 1.978, 0.000}},
+    {30520087, {0.296, 1.514, 0.481}},
+    {30520093, {0.095, 1.583, 0.380}},
+    {30522487, {0.213, 1.728, -0.042}},
+    {30522511, {-0.208, 1.622, 0.223}},
+    {30522517, {0.359, 1.539, 0.194}},
+    {30522523, {0.000, 2.046, 0.000}},
+    {30522535, {-0.290, 1.519, -0.470}},
+    {30522541, {0.000, 1.395, 0.227}},
+    {30629377, {0.000, 0.000, 0.000}},
+    {30851328, {0.000, 3.100, 0.000}},
+    {30851330, {0.000, 3.600, 0.000}},
+    {30851333, {0.000, 3.600, 0.000}},
+    {30852966, {-1.953, 3.953, -1.055}},
+    {30852978, {-1.712, 2.596, -0.330}},
+    {30853134, {-0.215, 2.810, -0.456}},
+    {30855414, {1.951, 3.936, 1.130}},
+    {30855426, {1.719, 2.628, 0.360}},
+    {30855582, {0.216, 2.808, 0.456}},
+    {31184257, {0.000, 1.800, 0.000}},
+    {31295232, {0.000, 6.000, 0.000}},
+    {31295234, {0.000, 6.000, 0.000}},
+    {31295237, {0.000, 6.000, 0.000}},
+    {31850112, {0.000, 1.423, 0.000}},
+    {31850114, {0.000, 1.423, 0.000}},
+    {31850117, {0.000, 1.423, 0.000}},
+    {32072064, {0.000, 1.423, 0.000}},
+    {32183040, {0.000, 0.000, 0.000}},
+    {32183042, {0.000, 0.000, 0.000}},
+    {32183045, {0.000, 0.000, 0.000}},
+    {32294016, {0.000, 0.000, 0.000}},
+    {32404992, {0.000, 0.000, 0.000}},
+    {32404994, {0.000, 0.000, 0.000}},
+    {32626944, {0.000, 0.000, 0.000}},
+    {32626946, {0.000, 0.000, 0.000}},
+    {32626949, {0.000, 0.000, 0.000}},
+    {32959872, {0.000, 0.000, 0.000}},
+    {33514752, {0.000, 12.000, 0.000}},
+    {33958656, {0.000, 0.000, 0.000}},
+    {33958658, {0.000, 0.000, 0.000}},
+    {34291585, {0.000, 2.000, 0.000}},
+    {34292623, {0.000, 2.952, -0.079}},
+    {34293439, {0.000, 1.542, 0.434}},
+    {34295887, {0.000, 1.308, -0.357}},
+    {34513537, {0.000, 6.000, 0.000}},
+    {34624512, {0.000, 3.700, 0.000}},
+    {34624514, {0.000, 3.600, 0.000}},
+    {34624517, {0.000, 3.600, 0.000}},
+    {34626312, {0.000, 3.756, -0.530}},
+    {34628760, {0.073, 3.698, 0.291}},
+    {34735488, {0.000, 1.200, 0.000}},
+    {34735490, {0.000, 1.800, 0.000}},
+    {34737312, {0.000, 1.235, 0.000}},
+    {34739760, {0.000, 1.231, 0.000}},
+    {34957440, {0.000, 3.600, 0.000}},
+    {34957442, {0.000, 3.600, 0.000}},
+    {35179392, {0.000, 2.200, 0.000}},
+    {35179394, {0.000, 1.800, 0.000}},
+    {35181216, {0.000, 2.212, 0.000}},
+    {35183664, {0.000, 2.225, 0.000}},
+    {35290368, {0.000, 1.800, 0.000}},
+    {35290370, {0.000, 1.800, 0.000}},
+    {36289152, {0.000, 4.800, 0.000}},
+    {36400128, {0.000, 4.800, 0.000}},
+    {37065984, {0.000, 8.000, 0.000}},
+    {37067754, {1.693, 7.903, 0.532}},
+    {37070202, {-1.696, 7.897, -0.482}},
+    {37176961, {0.000, 1.800, 0.000}},
+    {37287937, {0.000, 1.800, 0.000}},
+    {37620865, {0.000, 1.800, 0.000}},
+    {39174529, {0.000, 4.800, 0.000}},
+    {45611137, {0.000, 0.600, 0.000}},
+    {45611140, {0.000, 1.800, 0.000}},
+    {45611959, {-0.486, 0.714, 0.000}},
+    {45611989, {-0.081, -0.125, 0.132}},
+    {45611995, {1.053, 1.327, 0.000}},
+    {45615253, {0.000, 0.188, 0.436}},
+    {45615259, {0.000, 0.177, -0.412}},
+    {45616069, {0.269, 0.437, 0.000}},
+    {45616075, {-0.495, 0.793, -0.318}},
+    {45616891, {-0.260, 1.084, 0.193}},
+    {45944064, {0.000, 5.500, 0.000}},
+    {45944066, {0.000, 5.500, 0.000}},
+    {45944068, {0.000, 3.600, 0.000}},
+    {45944069, {0.000, 3.600, 0.000}},
+    {45944886, {-1.244, 5.482, 0.365}},
+    {45945024, {-1.166, 5.078, -0.545}},
+    {45945102, {-0.677, 5.854, 0.521}},
+    {45945842, {0.256, 4.519, 0.258}},
+    {45946658, {1.663, 4.073, 0.094}},
+    {45948150, {0.526, 5.631, 0.691}},
+    {45948156, {0.159, 6.586, 0.216}},
+    {45948288, {-2.285, 4.737, 0.468}},
+    {45949776, {0.700, 6.500, -0.400}},
+    {45949782, {0.682, 7.184, -0.935}},
+    {45949788, {-0.168, 6.572, -0.151}},
+    {45949920, {1.662, 6.152, -0.058}},
+    {45949998, {0.635, 5.890, -0.446}},
+    {45974402, {0.000, 3.892, -0.094}},
+    {46276992, {0.000, 16.000, 0.000}},
+    {46276993, {0.000, 1.800, 0.000}},
+    {46276997, {0.000, 12.000, 0.000}},
+    {46278786, {0.000, 16.000, 0.000}},
+    {46281078, {0.687, 16.152, 0.894}},
+    {46281234, {0.000, 16.000, 0.000}},
+    {46309638, {-0.758, 18.216, -0.188}},
+    {46309794, {0.000, 16.000, 0.000}},
+    {46387968, {0.000, 6.000, 0.000}},
+    {46387970, {0.000, 6.000, 0.000}},
+    {46387972, {0.000, 6.000, 0.000}},
+    {46387973, {0.000, 6.000, 0.000}},
+    {46388790, {0.647, 6.159, 0.507}},
+    {46388820, {-1.035, 8.791, 1.464}},
+    {46388952, {-0.294, 5.805, 1.342}},
+    {46389770, {-0.287, 7.142, 0.120}},
+    {46392054, {-0.183, 6.314, 1.753}},
+    {46392066, {-0.751, 5.348, 0.209}},
+    {46392216, {-0.388, 5.972, 0.459}},
+    {46393686, {-0.319, 6.294, -0.147}},
+    {46393698, {0.776, -0.585, -0.145}},
+    {46393716, {1.107, 8.631, -0.452}},
+    {46393848, {1.435, 4.975, -0.454}},
+    {46396296, {0.000, 3.495, 1.291}},
+    {46942848, {0.000, 1.423, 0.000}},
+    {46942850, {0.000, 1.423, 0.000}},
+    {46942852, {0.000, 1.423, 0.000}},
+    {46942853, {0.000, 1.423, 0.000}},
+    {47164800, {0.000, 1.423, 0.000}},
+    {47164805, {0.000, 1.423, 0.000}},
+    {47275776, {0.000, 0.000, 0.000}},
+    {47275778, {0.000, 0.000, 0.000}},
+    {47497728, {0.000, 0.000, -0.300}},
+    {47497730, {0.000, 0.000, 0.000}},
+    {47497732, {0.000, 0.000, -0.300}},
+    {47497733, {0.000, 0.000, 0.000}},
+    {47503440, {0.000, 0.400, 0.400}},
+    {47503470, {0.000, 0.000, -0.131}},
+    {47503560, {0.000, 0.000, 0.000}},
+    {47514078, {0.000, 0.000, 0.085}},
+    {47514168, {0.000, 0.000, 0.000}},
+    {47719680, {0.000, 0.000, 0.000}},
+    {47719682, {0.000, 0.000, 0.000}},
+    {47719684, {0.000, 0.000, 0.000}},
+    {47719685, {0.000, 0.000, 0.000}},
+    {47725392, {0.000, 0.400, 0.400}},
+    {48052608, {0.000, 0.000, 0.000}},
+    {48052610, {0.000, 0.000, 0.000}},
+    {48607489, {0.000, 1.800, 0.000}},
+    {48607492, {0.000, 1.800, 0.000}},
+    {49384321, {0.000, 2.500, 0.000}},
+    {49384324, {0.000, 1.800, 0.000}},
+    {49385359, {0.000, 2.428, 0.000}},
+    {49389439, {0.000, 1.743, 0.000}},
+    {49390255, {0.000, 2.256, 0.000}},
+    {49419631, {-0.241, 3.385, -0.838}},
+    {49606273, {0.000, 5.500, 0.000}},
+    {49717248, {0.000, 3.900, 0.000}},
+    {49717250, {0.000, 3.600, 0.000}},
+    {49717253, {0.000, 3.600, 0.000}},
+    {49721496, {-1.477, 4.362, 0.902}},
+    {49724760, {1.496, 4.369, -0.417}},
+    {49750056, {0.178, 3.149, 0.778}},
+    {49828224, {0.000, 1.800, 0.000}},
+    {49828226, {0.000, 1.800, 0.000}},
+    {50050176, {0.000, 4.500, 0.000}},
+    {50050178, {0.000, 3.600, 0.000}},
+    {50050180, {0.000, 3.600, 0.000}},
+    {50050181, {0.000, 3.600, 0.000}},
+    {50051100, {1.712, 3.309, 0.233}},
+    {50051160, {-0.414, 4.168, -0.875}},
+    {50055996, {-0.880, 5.091, -0.129}},
+    {50056056, {0.536, 5.276, -0.556}},
+    {50080478, {-0.701, 4.871, 1.225}},
+    {50080538, {-0.086, 5.073, 0.878}},
+    {50272128, {0.000, 1.800, 0.000}},
+    {50272130, {0.000, 1.800, 0.000}},
+    {50605056, {0.000, 0.000, 0.892}},
+    {50937984, {0.000, 13.500, 0.000}},
+    {50939112, {0.000, 13.549, 0.000}},
+    {51270912, {0.000, 8.000, 0.000}},
+    {51270913, {0.000, 2.500, 0.000}},
+    {51270917, {0.000, 12.000, 0.000}},
+    {51274998, {0.000, 8.000, 0.000}},
+    {51275208, {0.000, 8.000, 0.000}},
+    {51381888, {0.000, 4.800, 0.000}},
+    {51381890, {0.000, 4.800, 0.000}},
+    {51492864, {0.000, 4.800, 0.000}},
+    {51492866, {0.000, 4.800, 0.000}},
+    {51603841, {0.000, 2.500, 0.000}},
+    {51714817, {0.000, 4.800, 0.000}},
+    {52158720, {0.000, 3.600, 0.000}},
+    {52158722, {0.000, 3.600, 0.000}},
+    {52158725, {0.000, 3.600, 0.000}},
+    {52269697, {0.000, 2.500, 0.000}},
+    {52380673, {0.000, 2.500, 0.000}},
+    {52713600, {0.000, 12.000, 0.000}},
+    {53490432, {0.000, 19.000, 0.000}},
+    {53491290, {0.000, 19.349, 0.000}},
+    {53601408, {0.000, 19.000, 0.000}},
+    {53602650, {0.000, 18.751, 0.000}},
+    {53934337, {0.000, 2.500, 0.000}},
+    {54156289, {0.000, 2.500, 0.000}},
+    {91222272, {0.000, -2.000, 0.000}},
+    {91222277, {0.000, -2.000, 0.000}},
+    {91444224, {0.900, -1.100, -0.500}},
+    {91444229, {0.000, 0.000, 0.274}},
+    {91461366, {0.261, -0.330, -0.542}},
+    {91461498, {1.503, -1.853, -0.476}},
+    {91555200, {0.000, 3.600, 0.000}},
+    {91555205, {0.000, 3.600, 0.000}},
+    {91666176, {1.200, 0.500, -1.000}},
+    {91683318, {0.875, 0.180, -0.733}},
+    {91683330, {0.529, 0.000, -1.163}},
+    {92221056, {0.000, -4.000, 0.000}},
+    {92443008, {0.000, 1.423, 0.000}},
+    {92443013, {0.000, 1.423, 0.000}},
+    {92553984, {0.000, 0.000, 0.100}},
+    {92553989, {0.000, 0.000, 0.103}},
+    {92580918, {-0.520, -0.471, -0.267}},
+    {92580948, {-1.623, 0.204, 0.438}},
+    {92581104, {1.616, 0.425, 0.191}},
+    {92664960, {0.000, 0.000, 0.150}},
+    {92664965, {0.000, 0.000, 0.165}},
+    {92682102, {-0.620, -0.329, 0.303}},
+    {92682126, {0.683, 0.220, 0.000}},
+    {92775936, {0.000, 0.000, 0.400}},
+    {92775940, {0.000, 0.000, 0.217}},
+    {92775941, {0.000, 0.000, 0.217}},
+    {92792286, {0.000, 0.000, -0.079}},
+    {92792380, {0.000, 0.000, 0.000}},
+    {92997888, {0.000, 0.000, 0.217}},
+    {93330816, {0.000, 0.000, 0.650}},
+    {93330821, {0.000, 0.000, 0.231}},
+    {93331638, {-1.704, -0.452, 0.556}},
+    {93331668, {0.000, 0.000, 0.777}},
+    {93331824, {1.205, 0.914, 0.612}},
+    {93350436, {-3.209, -7.622, 1.065}},
+    {93350592, {-5.891, -3.332, 0.290}},
+    {93441792, {0.000, 0.000, 0.346}},
+    {93885696, {0.000, 3.600, 0.000}},
+    {93885698, {0.000, 3.600, 0.000}},
+    {94662528, {0.000, 3.200, 0.000}},
+    {94662533, {0.000, 3.600, 0.000}},
+    {94663566, {0.000, 4.382, 0.000}},
+    {94665198, {0.000, 2.576, 0.000}},
+    {94686414, {0.000, 2.801, 0.000}},
+    {94884480, {0.000, 0.000, 0.000}},
+    {94995456, {0.000, 0.000, 0.274}},
+    {95106432, {0.000, 3.600, 0.000}},
+    {95328384, {0.000, 0.000, 0.274}},
+    {95550336, {0.000, 6.000, 0.000}},
+    {95551344, {0.000, 6.208, 0.000}},
+    {96549120, {0.000, 3.600, 0.000}},
+    {96660096, {0.000, 3.600, 0.000}},
+    {96882048, {0.000, 3.600, 0.000}},
+    {96993024, {0.000, 3.600, 0.000}},
+    {97547904, {0.000, 3.600, 0.000}},
+    {97658880, {0.000, 3.600, 0.000}},
+    {121629696, {0.000, 0.000, 0.375}},
+    {121629701, {0.000, 0.000, 0.375}},
+    {121740672, {0.000, 3.600, 0.000}},
+    {121740677, {0.000, 3.600, 0.000}},
+    {121851648, {0.000, 0.000, 0.000}},
+    {121851652, {0.000, 0.000, 0.000}},
+    {122406528, {0.000, 0.000, 0.424}},
+    {122628480, {0.000, 1.423, 0.000}},
+    {122628484, {0.000, 1.423, 0.000}},
+    {122628485, {0.000, 1.423, 0.000}},
+    {122850432, {0.000, 0.000, 0.225}},
+    {122961408, {0.000, 0.000, 0.350}},
+    {122961412, {0.000, 0.000, 0.300}},
+    {122961413, {0.000, 0.000, 0.297}},
+    {122977758, {0.000, 0.120, 0.472}},
+    {122977852, {0.000, -0.097, 0.200}},
+    {122980206, {-0.101, -0.324, 0.371}},
+    {122980296, {0.107, 0.253, 0.151}},
+    {123183360, {0.000, 0.000, 0.297}},
+    {123516288, {0.000, 0.000, 0.316}},
+    {123516293, {0.000, 0.000, 0.316}},
+    {123627264, {0.000, 0.000, 0.474}},
+    {123627269, {0.000, 0.000, 0.474}},
+    {124515072, {0.000, 0.000, 0.250}},
+    {125069952, {0.000, 0.000, 0.000}},
+    {125180928, {0.000, 0.000, 0.375}},
+    {125513856, {0.000, 0.000, 0.375}},
+    {125735808, {0.000, 3.600, 0.000}},
+    {125846784, {0.000, 3.600, 0.000}},
+    {126845568, {0.000, 3.600, 0.000}},
+    {126956544, {0.000, 3.600, 0.000}},
+    {136833408, {0.000, 12.000, 0.000}},
+    {136833409, {0.000, 1.800, 0.000}},
+    {136833413, {0.000, 12.000, 0.000}},
+    {136944384, {0.000, 6.000, 0.000}},
+    {136944389, {0.000, 6.000, 0.000}},
+    {137499264, {0.000, 1.423, 0.000}},
+    {137832192, {0.000, 0.000, 0.000}},
+    {137943168, {0.000, 0.000, 0.000}},
+    {138054144, {0.000, 0.000, 0.000}},
+    {138609024, {0.000, 0.000, 0.000}},
+    {139607808, {0.000, 0.000, 0.000}},
+    {139607813, {0.000, 0.000, 0.000}},
+    {139940737, {0.000, 1.800, 0.000}},
+    {140162689, {0.000, 6.000, 0.000}},
+    {140273664, {0.000, 3.600, 0.000}},
+    {140384640, {0.000, 4.800, 0.000}},
+    {140828544, {0.000, 1.800, 0.000}},
+    {141827328, {0.000, 12.000, 0.000}},
+    {141938304, {0.000, 4.800, 0.000}},
+    {142049280, {0.000, 4.800, 0.000}},
+    {142160257, {0.000, 1.800, 0.000}},
+    {142715136, {0.000, 3.600, 0.000}},
+    {142826113, {0.000, 1.800, 0.000}},
+    {142937089, {0.000, 1.800, 0.000}},
+    {143270016, {0.000, 12.000, 0.000}},
+    {144490753, {0.000, 1.800, 0.000}},
+    {144823681, {0.000, 4.800, 0.000}},
+    {152037120, {0.000, 0.000, 0.000}},
+    {152037125, {0.000, 0.000, 0.000}},
+    {152592000, {0.000, 0.000, 0.000}},
+    {152813952, {0.000, 4.743, 0.000}},
+    {153146880, {0.000, 0.000, 0.000}},
+    {153146884, {0.000, 0.000, 0.000}},
+    {153146885, {0.000, 0.000, 0.000}},
+    {153368832, {0.000, 0.000, 0.000}},
+    {153701760, {0.000, 0.000, 0.000}},
+    {153812736, {0.000, 0.000, 0.000}},
+    {153812741, {0.000, 0.000, 0.000}},
+    {154700544, {0.000, 0.000, 0.000}},
+    {155033472, {0.000, 6.000, 0.000}},
+    {155255424, {0.000, 0.000, 0.000}},
+    {155366400, {0.000, 0.000, 0.000}},
+    {155366405, {0.000, 0.000, 0.000}},
+    {155477376, {0.000, 6.000, 0.000}},
+    {155921280, {0.000, 6.000, 0.000}},
+    {157918848, {0.000, 6.000, 0.000}},
+    {158029824, {0.000, 6.000, 0.000}},
+    {228055680, {-1.400, -8.300, 1.000}},
+    {228055685, {0.000, -8.000, 0.000}},
+    {228056502, {-1.663, -8.408, 1.433}},
+    {228056922, {-1.088, -8.245, 0.411}},
+    {228388608, {0.000, 0.000, 0.160}},
+    {228499584, {0.000, 0.000, 0.255}},
+    {228499589, {0.000, 0.000, 0.255}},
+    {228610560, {0.000, 0.000, 0.336}},
+    {228610564, {0.000, 0.000, 0.336}},
+    {228832512, {0.000, 0.000, 0.336}},
+    {229165440, {0.000, 0.000, 0.358}},
+    {229165444, {0.000, 0.000, 0.358}},
+    {229276416, {0.000, 0.000, 0.537}},
+    {229720320, {0.000, 1.423, 0.000}},
+    {229720324, {0.000, 1.423, 0.000}},
+    {230497152, {0.000, 1.300, 0.000}},
+    {230497157, {0.000, 1.423, 0.000}},
+    {230498190, {0.000, 2.177, 0.000}},
+    {230555310, {0.000, 0.505, 0.333}},
+    {230830080, {0.000, 0.000, 0.424}},
+    {231163008, {0.000, 0.000, 0.424}},
+    {232716672, {0.000, 1.423, 0.000}},
+    {233382528, {0.000, 1.423, 0.000}},
+    {233493504, {0.000, 1.423, 0.000}},
+    {258796032, {0.000, 0.000, 0.000}},
+    {258796036, {0.000, 0.000, 0.000}},
+    {258796037, {0.000, 0.000, 0.000}},
+    {259017984, {0.000, 0.000, 0.000}},
+    {260682624, {0.000, 1.423, 0.000}},
+    {261348480, {0.000, 3.795, 0.000}},
+    {273888768, {0.000, 0.000, 0.112}},
+    {273888772, {0.000, 0.000, 0.112}},
+    {273888773, {0.000, 0.000, 0.112}},
+    {274110720, {0.000, 0.000, 0.112}},
+    {275775360, {0.000, -1.200, -0.300}},
+    {275801694, {-0.173, -0.965, -0.610}},
+    {275807406, {0.000, -0.760, 0.227}},
+    {275810670, {0.228, -1.741, -0.371}},
+    {275997312, {0.000, 0.000, 0.500}},
+    {276023802, {0.000, 0.687, 0.680}},
+    {276027882, {0.000, -0.513, 0.357}},
+    {276441216, {0.000, 0.000, 0.350}},
+    {276441220, {0.000, 0.000, 0.141}},
+    {276441221, {0.000, 0.000, 0.141}},
+    {276442038, {-0.914, -0.482, 0.179}},
+    {276442050, {-0.392, -2.724, 0.312}},
+    {276442200, {-1.508, -1.816, -0.175}},
+    {276442254, {0.823, -1.220, -0.770}},
+    {276467334, {1.588, 1.499, 1.410}},
+    {276467346, {0.653, 0.254, 0.000}},
+    {276467496, {0.528, 0.342, 0.000}},
+    {276467550, {0.812, 1.513, 1.266}},
+    {276471414, {-1.139, -0.703, 1.088}},
+    {276471576, {-2.014, -1.646, -2.068}},
+    {276471630, {-1.519, -0.328, 1.437}},
+    {276476472, {3.011, -1.405, 2.038}},
+    {276996096, {0.000, 0.000, 0.400}},
+    {276997080, {1.767, 1.606, 0.408}},
+    {277022376, {-1.463, -2.548, 0.310}},
+    {277772928, {0.000, 0.000, 0.000}},
+    {278105856, {0.000, 0.000, 0.000}},
+    {278549760, {0.000, 0.000, 0.500}},
+    {278550582, {-0.403, -0.273, 0.440}},
+    {278575878, {0.291, 0.385, 0.582}},
+    {278660736, {0.000, 0.000, 0.000}},
+    {278771712, {0.000, 0.000, 0.000}},
+    {280547328, {0.000, 0.000, 0.000}},
+    {288981504, {0.000, 0.000, 0.179}},
+    {288981508, {0.000, 0.000, 0.179}},
+    {290868096, {0.000, 0.000, 0.000}},
+    {291201024, {0.000, 0.000, 0.225}},
+    {293753472, {0.000, 0.000, 0.000}},
+    {295085184, {0.000, 0.000, 0.000}},
+    {304074240, {0.000, 0.000, 0.200}},
+    {304074244, {0.000, 0.000, 0.000}},
+    {304074245, {0.000, 0.000, 0.236}},
+    {304075086, {0.067, 0.081, 0.347}},
+    {304075176, {-0.063, -0.064, 0.140}},
+    {304076718, {0.000, 0.000, 0.083}},
+    {304076808, {0.000, 0.000, 0.000}},
+    {304078350, {0.000, 0.000, 0.424}},
+    {304078356, {0.000, 0.000, -0.080}},
+    {304078368, {0.000, 0.127, 0.450}},
+    {304078392, {-0.072, -0.269, 0.439}},
+    {304078440, {-0.057, 0.000, 0.307}},
+    {304079260, {0.000, 0.000, 0.000}},
+    {304080892, {0.000, -0.091, 0.192}},
+    {304084152, {0.077, 0.202, 0.183}},
+    {304090684, {0.000, 0.000, 0.000}},
+    {304296192, {0.000, 0.000, 0.236}},
+    {304296196, {0.000, 0.000, 0.236}},
+    {304629120, {0.000, 0.000, 0.251}},
+    {304629124, {0.000, 0.000, 0.251}},
+    {304740096, {0.000, 0.000, 0.376}},
+    {304740100, {0.000, 0.000, 0.376}},
+    {304740101, {0.000, 0.000, 0.376}},
+    {305184000, {0.000, 0.000, 0.000}},
+    {305184002, {0.000, 0.000, 0.000}},
+    {305184004, {0.000, 0.000, 0.000}},
+    {305184180, {0.000, 0.000, -0.500}},
+    {305627904, {0.000, 0.000, 0.198}},
+    {305627908, {0.000, 0.000, 0.198}},
+    {305960832, {0.000, 0.000, 0.000}},
+    {305960836, {0.000, 0.000, 0.000}},
+    {306293760, {0.000, 0.000, 0.297}},
+    {306404736, {0.000, 0.000, 0.000}},
+    {306626688, {0.000, 0.000, 0.297}},
+    {306626692, {0.000, 0.000, 0.297}},
+    {306848640, {0.000, 0.000, 0.000}},
+    {334481664, {0.000, 0.000, 0.236}},
+    {334481668, {0.000, 0.000, 0.236}},
+    {334481669, {0.000, 0.000, 0.236}},
+    {335369472, {0.000, 0.000, 0.000}},
+    {335369476, {0.000, 0.000, 0.000}},
+    {335813376, {0.000, 0.000, 0.198}},
+    {336146304, {0.000, 0.000, 0.000}},
+    {336479232, {0.000, 0.000, 0.297}},
+    {336590208, {0.000, 0.000, 0.000}},
+    {336812160, {0.000, 0.000, 0.297}},
+    {336812165, {0.000, 0.000, 0.297}},
+    {337034112, {0.000, 0.000, 0.000}},
+    {380092800, {0.000, 0.000, 0.267}},
+    {381424512, {0.000, 0.000, 0.000}},
+    {381424517, {0.000, 0.000, 0.000}},
+    {381646464, {0.000, 0.000, 0.000}},
+    {381757440, {0.000, 0.000, 0.316}},
+    {381757445, {0.000, 0.000, 0.316}},
+    {382090368, {0.000, 0.000, 0.250}},
+    {382091190, {-2.686, -1.512, 0.591}},
+    {382091352, {-3.730, -0.531, 0.000}},
+    {382116486, {2.108, 1.896, 0.965}},
+    {382116648, {2.977, 0.732, -0.502}},
+    {383644032, {0.000, 0.000, 0.000}},
+    {384309888, {0.000, 0.000, 0.000}},
+    {395296512, {0.000, 0.000, 0.600}},
+    {395296517, {0.000, 0.000, 0.600}},
+    {396184320, {0.000, 0.000, 0.316}},
+    {396184325, {0.000, 0.000, 0.316}},
+    {396517248, {0.000, 1.423, 0.000}},
+    {396850176, {0.000, 0.000, 0.474}},
+    {456111360, {0.000, 12.000, 0.000}},
+    {456111361, {0.000, 1.800, 0.000}},
+    {456111364, {0.000, 1.800, 0.000}},
+    {457221120, {0.000, 3.600, 0.000}},
+    {460217473, {0.000, 1.800, 0.000}},
+    {517259136, {0.000, 0.000, 0.000}},
+    {517924992, {0.000, 0.000, 0.250}},
+    {562537344, {0.000, 7.000, 0.000}},
+    {562537345, {0.000, 2.000, 0.000}},
+    {562537348, {0.000, 6.000, 0.000}},
+    {562537349, {0.000, 6.000, 0.000}},
+    {562538190, {0.000, 7.000, 0.000}},
+    {562538382, {0.000, 7.000, 0.000}},
+    {562539006, {0.000, 7.000, 0.000}},
+    {562539198, {0.000, 7.000, 0.000}},
+    {562539822, {0.000, 7.000, 0.000}},
+    {562540014, {0.000, 7.000, 0.000}},
+    {562541454, {0.000, 7.000, 0.000}},
+    {562541460, {0.000, 7.000, 0.000}},
+    {562541514, {0.000, 7.000, 0.000}},
+    {562541532, {0.000, 7.000, 0.000}},
+    {562541646, {0.000, 7.000, 0.000}},
+    {562541664, {0.000, 7.000, 0.000}},
+    {562541682, {0.000, 7.000, 0.000}},
+    {562542462, {0.000, 7.000, 0.000}},
+    {562549806, {0.000, 7.000, 0.000}},
+    {562552254, {0.000, 7.000, 0.000}},
+    {562567758, {0.000, 7.000, 0.000}},
+    {562567776, {0.000, 7.000, 0.000}},
+    {562567794, {0.000, 7.000, 0.000}},
+    {562648320, {0.000, 7.000, 0.000}},
+    {562759296, {0.000, 3.600, 0.000}},
+    {562759297, {0.000, 6.000, 0.000}},
+    {562870272, {0.000, 4.000, 0.000}},
+    {562870277, {0.000, 3.600, 0.000}},
+    {562900470, {0.000, 4.336, 0.370}},
+    {562900632, {0.715, 2.628, 3.355}},
+    {562981248, {0.000, 1.800, 0.000}},
+    {563203200, {0.000, 2.000, 1.800}},
+    {563203205, {0.000, 3.600, 0.000}},
+    {563233500, {0.372, 2.284, 2.034}},
+    {563233560, {0.000, 1.694, 1.508}},
+    {563425152, {0.000, 1.800, 0.000}},
+    {563536128, {0.000, 1.800, 0.000}},
+    {564534912, {0.000, 4.800, 0.000}},
+    {564645888, {0.000, 4.800, 0.000}},
+    {564756865, {0.000, 1.800, 0.000}},
+    {564867840, {0.000, 6.000, 0.000}},
+    {564867841, {0.000, 4.800, 0.000}},
+    {565311744, {0.000, 3.600, 0.000}},
+    {565422720, {0.000, 7.000, 0.000}},
+    {565422721, {0.000, 1.800, 0.000}},
+    {565533696, {0.000, 7.000, 0.000}},
+    {565533697, {0.000, 1.800, 0.000}},
+    {565866625, {0.000, 1.800, 0.000}},
+    {566088576, {0.000, 7.000, 0.000}},
+    {567087360, {0.000, 6.000, 0.000}},
+    {567420288, {0.000, 6.000, 0.000}},
+    {567420289, {0.000, 4.800, 0.000}},
+    {577741056, {0.000, 7.000, 0.000}},
+    {579960576, {0.000, 7.000, 0.000}},
+    {580515456, {0.000, 7.000, 0.000}},
+    {580626432, {0.000, 7.000, 0.000}},
+    {581181312, {0.000, 6.000, 0.000}},
+    {582180096, {0.000, 6.000, 0.000}},
+    {593055744, {0.000, 0.000, 0.000}},
+    {593610624, {0.000, 6.000, 0.000}},
+    {595608192, {0.000, 4.000, 0.000}},
+    {595608193, {0.000, 6.000, 0.000}},
+    {595608197, {0.000, 3.600, 0.000}},
+    {595609038, {0.000, 4.000, 0.000}},
+    {595609392, {0.000, 4.000, 0.000}},
+    {595622910, {0.000, 4.000, 0.000}},
+    {595623264, {0.000, 4.000, 0.000}},
+    {595659630, {0.000, 4.000, 0.000}},
+    {595659984, {0.000, 4.000, 0.000}},
+    {595719168, {0.000, 3.600, 0.000}},
+    {595719169, {0.000, 6.000, 0.000}},
+    {595830144, {0.000, 4.000, 0.000}},
+    {597272832, {0.000, 3.600, 0.000}},
+    {608148480, {0.000, 0.000, 0.375}},
+    {608703360, {0.000, 3.600, 0.000}},
+    {608814336, {0.000, 3.600, 0.000}},
+    {609702144, {0.000, 3.600, 0.000}},
+    {609702146, {0.000, 3.600, 0.000}},
+    {610700928, {0.000, 3.600, 0.000}},
+    {610811904, {0.000, 3.600, 0.000}},
+    {612365568, {0.000, 3.600, 0.000}},
+    {623352192, {0.000, 1.800, 0.000}},
+    {624905856, {0.000, 4.800, 0.000}},
+    {625682688, {0.000, 3.600, 0.000}},
+    {627680256, {0.000, 1.800, 0.000}},
+    {653759616, {0.000, 0.000, 0.375}},
+    {653981568, {0.000, 3.600, 0.000}},
+    {656090112, {0.000, 3.600, 0.000}},
+    {670406016, {0.000, 7.000, 0.000}},
+    {671071872, {0.000, 7.000, 0.000}},
+    {671293824, {0.000, 7.000, 0.000}},
+    {672736512, {0.000, 2.846, 0.000}},
+    {672958464, {0.000, 2.846, 0.000}},
+    {686164608, {0.000, 1.800, 0.000}},
+    {686275584, {0.000, 1.800, 0.000}},
+    {687829248, {0.000, 1.800, 0.000}},
+    {836426112, {0.000, 10.000, 0.000}},
+    {836426114, {0.000, 4.800, 0.000}},
+    {836426117, {0.000, 4.800, 0.000}},
+    {836426958, {0.423, 12.064, 0.090}},
+    {836427258, {-0.428, 12.044, 0.000}},
+    {836455518, {-0.268, 8.077, -0.806}},
+    {836455818, {0.273, 8.025, 0.692}},
+    {836980992, {0.000, 3.600, 0.000}},
+    {837202944, {0.000, 4.800, 0.000}},
+    {838978560, {0.000, 4.800, 0.000}},
+    {851518848, {0.000, 6.000, 0.000}},
+    {851520000, {0.000, 6.886, -0.161}},
+    {851548560, {0.000, 4.688, 0.107}},
+    {852184704, {0.000, 4.800, 0.000}},
+    {854071296, {0.000, 4.800, 0.000}},
+    {867277441, {0.000, 1.800, 0.000}},
+    {867388417, {0.000, 1.800, 0.000}},
+    {882370176, {0.000, 6.000, 0.000}},
+    {882481152, {0.000, 6.000, 0.000}},
+    {897462912, {0.000, 7.000, 0.000}},
+    {897684864, {0.000, 7.000, 0.000}},
+    {899127552, {0.000, 3.600, 0.000}},
+    {899349504, {0.000, 3.600, 0.000}},
+    {899571456, {0.000, 3.600, 0.000}},
+    {942741120, {0.000, 3.600, 0.000}},
+    {942852096, {0.000, 3.600, 0.000}},
+    {957833857, {0.000, 1.800, 0.000}},
+    {957944832, {0.000, 7.000, 0.000}},
+    {957948942, {0.000, 7.000, 0.000}},
+    {957949296, {0.000, 7.000, 0.000}},
+    {957976686, {0.000, 7.000, 0.000}},
+    {957977040, {0.000, 7.000, 0.000}},
+    {958166784, {0.000, 7.000, 0.000}},
+    {959498496, {0.000, 6.000, 0.000}},
+    {959831424, {0.000, 6.000, 0.000}},
+    {973037568, {0.000, 7.000, 0.000}},
+    {973037569, {0.000, 1.800, 0.000}},
+    {973041678, {0.000, 7.000, 0.000}},
+    {973042026, {0.000, 7.000, 0.000}},
+    {973089354, {0.000, 7.000, 0.000}},
+    {973148544, {0.000, 7.000, 0.000}},
+    {973259520, {0.000, 7.000, 0.000}},
+    {974591232, {0.000, 6.000, 0.000}},
+    {974924160, {0.000, 6.000, 0.000}},
+    {974924165, {0.000, 6.000, 0.000}},
+    {975035136, {0.000, 6.000, 0.000}},
+    {988352256, {0.000, 7.000, 0.000}},
+    {989683968, {0.000, 6.000, 0.000}},
+    {990016896, {0.000, 6.000, 0.000}},
+    {990127872, {0.000, 6.000, 0.000}},
+    {1003444992, {0.000, 7.000, 0.000}},
+    {1004776704, {0.000, 6.000, 0.000}},
+    {1005109632, {0.000, 6.000, 0.000}},
+    {1018648704, {0.000, 12.000, 0.000}},
+    {1018648709, {0.000, 12.000, 0.000}},
+    {1155482112, {0.000, 3.600, 0.000}},
+    {1155704064, {0.000, 3.600, 0.000}},
+    {1185889536, {0.000, 7.000, 0.000}},
+    {1186000512, {0.000, 6.000, 0.000}},
+    {1186222464, {0.000, 4.000, 0.000}},
+    {1201093248, {0.000, 6.000, 0.000}},
+    {1201315200, {0.000, 6.000, 0.000}},
+    {1216407936, {0.000, 4.000, 0.000}},
+};
+
+const MmffParametersEntry<MmffVanDerWaalsParameters> VanDerWaalsParameters[] = {
+    {1, {1.050, 2.490, 3.890, 1.282, '-'}},
+    {2, {1.350, 2.490, 3.890, 1.282, '-'}},
+    {3, {1.100, 2.490, 3.890, 1.282, '-'}},
+    {4, {1.300, 2.490, 3.890, 1.282, '-'}},
+    {5, {0.250, 0.800, 4.200, 1.209, '-'}},
+    {6, {0.70, 3.150, 3.890, 1.282, 'A'}},
+    {7, {0.65, 3.150, 3.890, 1.282, 'A'}},
+    {8, {1.15, 2.820, 3.890, 1.282, 'A'}},
+    {9, {0.90, 2.820, 3.890, 1.282, 'A'}},
+    {10, {1.000, 2.820, 3.890, 1.282, 'A'}},
+    {11, {0.35, 3.480, 3.890, 1.282, 'A'}},
+    {12, {2.300, 5.100, 3.320, 1.345, 'A'}},
+    {13, {3.400, 6.000, 3.190, 1.359, 'A'}},
+    {14, {5.500, 6.950, 3.080, 1.404, 'A'}},
+    {15, {3.00, 4.800, 3.320, 1.345, 'A'}},
+    {16, {3.900, 4.800, 3.320, 1.345, 'A'}},
+    {17, {2.700, 4.800, 3.320, 1.345, '-'}},
+    {18, {2.100, 4.800, 3.320, 1.345, '-'}},
+    {19, {4.500, 4.200, 3.320, 1.345, '-'}},
+    {20, {1.050, 2.490, 3.890, 1.282, '-'}},
+    {21, {0.150, 0.800, 4.200, 1.209, 'D'}},
+    {22, {1.100, 2.490, 3.890, 1.282, '-'}},
+    {23, {0.150, 0.800, 4.200, 1.209, 'D'}},
+    {24, {0.150, 0.800, 4.200, 1.209, 'D'}},
+    {25, {1.600, 4.500, 3.320, 1.345, '-'}},
+    {26, {3.600, 4.500, 3.320, 1.345, 'A'}},
+    {27, {0.150, 0.800, 4.200, 1.209, 'D'}},
+    {28, {0.150, 0.800, 4.200, 1.209, 'D'}},
+    {29, {0.150, 0.800, 4.200, 1.209, 'D'}},
+    {30, {1.350, 2.490, 3.890, 1.282, '-'}},
+    {31, {0.150, 0.800, 4.200, 1.209, 'D'}},
+    {32, {0.75, 3.150, 3.890, 1.282, 'A'}},
+    {33, {0.150, 0.800, 4.200, 1.209, 'D'}},
+    {34, {1.00, 2.820, 3.890, 1.282, '-'}},
+    {35, {1.50, 3.150, 3.890, 1.282, 'A'}},
+    {36, {0.150, 0.800, 4.200, 1.209, 'D'}},
+    {37, {1.350, 2.490, 3.890, 1.282, '-'}},
+    {38, {0.85, 2.820, 3.890, 1.282, 'A'}},
+    {39, {1.10, 2.820, 3.890, 1.282, '-'}},
+    {40, {1.00, 2.820, 3.890, 1.282, 'A'}},
+    {41, {1.100, 2.490, 3.890, 1.282, '-'}},
+    {42, {1.000, 2.820, 3.890, 1.282, 'A'}},
+    {43, {1.000, 2.820, 3.890, 1.282, 'A'}},
+    {44, {3.00, 4.800, 3.320, 1.345, 'A'}},
+    {45, {1.150, 2.820, 3.890, 1.282, '-'}},
+    {46, {1.300, 2.820, 3.890, 1.282, '-'}},
+    {47, {1.000, 2.820, 3.890, 1.282, 'A'}},
+    {48, {1.200, 2.820, 3.890, 1.282, 'A'}},
+    {49, {1.00, 3.150, 3.890, 1.282, '-'}},
+    {50, {0.150, 0.800, 4.200, 1.209, 'D'}},
+    {51, {0.400, 3.150, 3.890, 1.282, '-'}},
+    {52, {0.150, 0.800, 4.200, 1.209, 'D'}},
+    {53, {1.000, 2.820, 3.890, 1.282, '-'}},
+    {54, {1.30, 2.820, 3.890, 1.282, '-'}},
+    {55, {0.80, 2.820, 3.890, 1.282, '-'}},
+    {56, {0.80, 2.820, 3.890, 1.282, '-'}},
+    {57, {1.000, 2.490, 3.890, 1.282, '-'}},
+    {58, {0.80, 2.820, 3.890, 1.282, '-'}},
+    {59, {0.65, 3.150, 3.890, 1.282, 'A'}},
+    {60, {1.800, 2.490, 3.890, 1.282, 'A'}},
+    {61, {0.800, 2.820, 3.890, 1.282, 'A'}},
+    {62, {1.300, 2.820, 3.890, 1.282, 'A'}},
+    {63, {1.350, 2.490, 3.890, 1.282, '-'}},
+    {64, {1.350, 2.490, 3.890, 1.282, '-'}},
+    {65, {1.000, 2.820, 3.890, 1.282, 'A'}},
+    {66, {0.75, 2.820, 3.890, 1.282, 'A'}},
+    {67, {0.950, 2.82, 3.890, 1.282, 'A'}},
+    {68, {0.90, 2.82, 3.890, 1.282, 'A'}},
+    {69, {0.950, 2.82, 3.890, 1.282, 'A'}},
+    {70, {0.87, 3.150, 3.890, 1.282, 'A'}},
+    {71, {0.150, 0.800, 4.200, 1.209, 'D'}},
+    {72, {4.000, 4.800, 3.320, 1.345, 'A'}},
+    {73, {3.000, 4.800, 3.320, 1.345, '-'}},
+    {74, {3.000, 4.800, 3.320, 1.345, '-'}},
+    {75, {4.000, 4.500, 3.320, 1.345, 'A'}},
+    {76, {1.200, 2.820, 3.890, 1.282, 'A'}},
+    {77, {1.500, 5.100, 3.320, 1.345, 'A'}},
+    {78, {1.350, 2.490, 3.890, 1.282, '-'}},
+    {79, {1.000, 2.820, 3.890, 1.282, 'A'}},
+    {80, {1.000, 2.490, 3.890, 1.282, '-'}},
+    {81, {0.80, 2.820, 3.890, 1.282, '-'}},
+    {82, {0.950, 2.82, 3.890, 1.282, 'A'}},
+    {87, {0.45, 6., 4., 1.4, '-'}},
+    {88, {0.55, 6., 4., 1.4, '-'}},
+    {89, {1.4, 3.48, 3.890, 1.282, 'A'}},
+    {90, {4.5, 5.100, 3.320, 1.345, 'A'}},
+    {91, {6.0, 6.000, 3.190, 1.359, 'A'}},
+    {92, {0.15, 2., 4., 1.3, '-'}},
+    {93, {0.4, 3.5, 4., 1.3, '-'}},
+    {94, {1.0, 5., 4., 1.3, '-'}},
+    {95, {0.43, 6., 4., 1.4, '-'}},
+    {96, {0.9, 5., 4., 1.4, '-'}},
+    {97, {0.35, 6., 4., 1.4, '-'}},
+    {98, {0.40, 6., 4., 1.4, '-'}},
+    {99, {0.35, 3.5, 4., 1.3, '-'}},
+};
+
+const MmffParametersEntry<MmffChargeParameters> ChargeParameters[] = {
+    {274, {0, 1, 1, 0.0000}},
+    {276, {0, 1, 2, -0.1382}},
+    {278, {0, 1, 3, -0.0610}},
+    {280, {0, 1, 4, -0.2000}},
+    {282, {0, 1, 5, 0.0000}},
+    {284, {0, 1, 6, -0.2800}},
+    {288, {0, 1, 8, -0.2700}},
+    {290, {0, 1, 9, -0.2460}},
+    {292, {0, 1, 10, -0.3001}},
+    {294, {0, 1, 11, -0.3400}},
+    {296, {0, 1, 12, -0.2900}},
+    {298, {0, 1, 13, -0.2300}},
+    {300, {0, 1, 14, -0.1900}},
+    {302, {0, 1, 15, -0.2300}},
+    {306, {0, 1, 17, -0.1935}},
+    {308, {0, 1, 18, -0.1052}},
+    {310, {0, 1, 19, 0.0805}},
+    {312, {0, 1, 20, 0.0000}},
+    {316, {0, 1, 22, -0.0950}},
+    {322, {0, 1, 25, 0.0000}},
+    {324, {0, 1, 26, -0.1669}},
+    {340, {0, 1, 34, -0.5030}},
+    {342, {0, 1, 35, -0.4274}},
+    {346, {0, 1, 37, -0.1435}},
+    {350, {0, 1, 39, -0.2556}},
+    {352, {0, 1, 40, -0.3691}},
+    {354, {0, 1, 41, 0.1060}},
+    {358, {0, 1, 43, -0.3557}},
+    {362, {0, 1, 45, -0.2402}},
+    {364, {0, 1, 46, -0.3332}},
+    {380, {0, 1, 54, -0.3461}},
+    {382, {0, 1, 55, -0.4895}},
+    {384, {0, 1, 56, -0.3276}},
+    {386, {0, 1, 57, -0.1050}},
+    {388, {0, 1, 58, -0.4880}},
+    {394, {0, 1, 61, -0.2657}},
+    {396, {0, 1, 62, -0.2000}},
+    {398, {0, 1, 63, -0.1800}},
+    {400, {0, 1, 64, -0.1810}},
+    {406, {0, 1, 67, -0.0990}},
+    {408, {0, 1, 68, -0.2560}},
+    {416, {0, 1, 72, -0.5500}},
+    {418, {0, 1, 73, -0.0877}},
+    {422, {0, 1, 75, -0.2550}},
+    {428, {0, 1, 78, -0.1680}},
+    {432, {0, 1, 80, -0.1440}},
+    {434, {0, 1, 81, -0.5140}},
+    {548, {0, 2, 2, 0.0000}},
+    {549, {1, 2, 2, 0.0000}},
+    {551, {1, 2, 3, -0.0144}},
+    {552, {0, 2, 4, -0.0650}},
+    {553, {1, 2, 4, -0.0650}},
+    {554, {0, 2, 5, 0.1500}},
+    {556, {0, 2, 6, -0.0767}},
+    {563, {1, 2, 9, -0.1710}},
+    {564, {0, 2, 10, -0.1090}},
+    {566, {0, 2, 11, -0.1495}},
+    {568, {0, 2, 12, -0.1400}},
+    {570, {0, 2, 13, -0.1100}},
+    {572, {0, 2, 14, -0.0900}},
+    {574, {0, 2, 15, -0.1010}},
+    {578, {0, 2, 17, -0.0560}},
+    {580, {0, 2, 18, 0.0170}},
+    {582, {0, 2, 19, 0.2290}},
+    {584, {0, 2, 20, 0.1160}},
+    {588, {0, 2, 22, 0.0400}},
+    {594, {0, 2, 25, 0.1470}},
+    {604, {0, 2, 30, -0.0310}},
+    {612, {0, 2, 34, -0.3560}},
+    {614, {0, 2, 35, -0.3500}},
+    {619, {1, 2, 37, 0.0284}},
+    {623, {1, 2, 39, 0.0310}},
+    {624, {0, 2, 40, -0.1000}},
+    {626, {0, 2, 41, 0.2500}},
+    {630, {0, 2, 43, -0.1910}},
+    {634, {0, 2, 45, -0.2044}},
+    {636, {0, 2, 46, -0.2940}},
+    {654, {0, 2, 55, -0.3410}},
+    {656, {0, 2, 56, -0.3030}},
+    {668, {0, 2, 62, -0.0500}},
+    {671, {1, 2, 63, -0.0450}},
+    {673, {1, 2, 64, -0.0460}},
+    {679, {1, 2, 67, 0.0360}},
+    {688, {0, 2, 72, -0.4500}},
+    {707, {1, 2, 81, -0.3790}},
+    {823, {1, 3, 3, 0.0000}},
+    {825, {1, 3, 4, -0.1050}},
+    {826, {0, 3, 5, 0.0600}},
+    {828, {0, 3, 6, -0.1500}},
+    {830, {0, 3, 7, -0.5700}},
+    {834, {0, 3, 9, -0.4500}},
+    {835, {1, 3, 9, -0.2110}},
+    {836, {0, 3, 10, -0.0600}},
+    {838, {0, 3, 11, -0.2220}},
+    {840, {0, 3, 12, -0.2090}},
+    {846, {0, 3, 15, -0.1410}},
+    {848, {0, 3, 16, -0.3800}},
+    {850, {0, 3, 17, -0.0960}},
+    {852, {0, 3, 18, -0.0230}},
+    {856, {0, 3, 20, 0.0530}},
+    {860, {0, 3, 22, 0.0000}},
+    {866, {0, 3, 25, 0.1070}},
+    {877, {1, 3, 30, -0.0710}},
+    {886, {0, 3, 35, -0.3610}},
+    {891, {1, 3, 37, 0.0862}},
+    {895, {1, 3, 39, -0.0090}},
+    {896, {0, 3, 40, -0.0500}},
+    {898, {0, 3, 41, 0.1470}},
+    {902, {0, 3, 43, -0.2363}},
+    {906, {0, 3, 45, -0.1650}},
+    {912, {0, 3, 48, -0.4300}},
+    {918, {0, 3, 51, -0.9500}},
+    {922, {0, 3, 53, -0.0134}},
+    {924, {0, 3, 54, -0.4000}},
+    {925, {1, 3, 54, -0.3290}},
+    {926, {0, 3, 55, -0.3810}},
+    {928, {0, 3, 56, -0.3430}},
+    {931, {1, 3, 57, -0.0100}},
+    {933, {1, 3, 58, -0.3930}},
+    {940, {0, 3, 62, -0.0300}},
+    {943, {1, 3, 63, -0.0850}},
+    {945, {1, 3, 64, -0.0860}},
+    {950, {0, 3, 67, -0.0040}},
+    {964, {0, 3, 74, -0.3190}},
+    {966, {0, 3, 75, -0.2474}},
+    {973, {1, 3, 78, -0.0730}},
+    {977, {1, 3, 80, -0.0490}},
+    {1098, {0, 4, 5, 0.1770}},
+    {1100, {0, 4, 6, -0.0430}},
+    {1102, {0, 4, 7, -0.4870}},
+    {1106, {0, 4, 9, -0.3000}},
+    {1107, {1, 4, 9, -0.1060}},
+    {1108, {0, 4, 10, -0.0440}},
+    {1118, {0, 4, 15, -0.0360}},
+    {1128, {0, 4, 20, 0.1810}},
+    {1132, {0, 4, 22, 0.1050}},
+    {1148, {0, 4, 30, 0.0340}},
+    {1163, {1, 4, 37, 0.0730}},
+    {1168, {0, 4, 40, -0.0640}},
+    {1172, {0, 4, 42, -0.5571}},
+    {1174, {0, 4, 43, -0.1260}},
+    {1215, {1, 4, 63, 0.0200}},
+    {1217, {1, 4, 64, 0.0190}},
+    {1398, {0, 5, 19, 0.2000}},
+    {1400, {0, 5, 20, 0.0000}},
+    {1404, {0, 5, 22, -0.1000}},
+    {1420, {0, 5, 30, -0.1500}},
+    {1434, {0, 5, 37, -0.1500}},
+    {1442, {0, 5, 41, 0.2203}},
+    {1474, {0, 5, 57, -0.1500}},
+    {1486, {0, 5, 63, -0.1500}},
+    {1488, {0, 5, 64, -0.1500}},
+    {1516, {0, 5, 78, -0.1500}},
+    {1520, {0, 5, 80, -0.1500}},
+    {1644, {0, 6, 6, 0.0000}},
+    {1648, {0, 6, 8, -0.1000}},
+    {1650, {0, 6, 9, -0.0630}},
+    {1652, {0, 6, 10, 0.0355}},
+    {1662, {0, 6, 15, 0.0070}},
+    {1666, {0, 6, 17, 0.0520}},
+    {1668, {0, 6, 18, 0.1837}},
+    {1670, {0, 6, 19, 0.2974}},
+    {1672, {0, 6, 20, 0.2579}},
+    {1674, {0, 6, 21, 0.4000}},
+    {1676, {0, 6, 22, 0.1480}},
+    {1680, {0, 6, 24, 0.5000}},
+    {1682, {0, 6, 25, 0.2712}},
+    {1684, {0, 6, 26, 0.1010}},
+    {1690, {0, 6, 29, 0.4500}},
+    {1692, {0, 6, 30, 0.0770}},
+    {1698, {0, 6, 33, 0.5000}},
+    {1706, {0, 6, 37, 0.0825}},
+    {1710, {0, 6, 39, 0.1390}},
+    {1712, {0, 6, 40, -0.0210}},
+    {1714, {0, 6, 41, 0.2950}},
+    {1718, {0, 6, 43, -0.0830}},
+    {1722, {0, 6, 45, -0.0090}},
+    {1740, {0, 6, 54, -0.1810}},
+    {1742, {0, 6, 55, -0.2330}},
+    {1746, {0, 6, 57, 0.1380}},
+    {1748, {0, 6, 58, -0.2450}},
+    {1758, {0, 6, 63, 0.0630}},
+    {1760, {0, 6, 64, 0.0620}},
+    {1938, {0, 7, 17, 0.5000}},
+    {1996, {0, 7, 46, 0.1618}},
+    {2052, {0, 7, 74, 0.5000}},
+    {2192, {0, 8, 8, 0.0000}},
+    {2194, {0, 8, 9, -0.0530}},
+    {2196, {0, 8, 10, 0.0090}},
+    {2200, {0, 8, 12, -0.0510}},
+    {2206, {0, 8, 15, 0.0170}},
+    {2210, {0, 8, 17, 0.0620}},
+    {2214, {0, 8, 19, 0.3470}},
+    {2216, {0, 8, 20, 0.2096}},
+    {2220, {0, 8, 22, 0.1580}},
+    {2222, {0, 8, 23, 0.3600}},
+    {2226, {0, 8, 25, 0.2679}},
+    {2228, {0, 8, 26, 0.1110}},
+    {2244, {0, 8, 34, -0.2380}},
+    {2254, {0, 8, 39, 0.1490}},
+    {2256, {0, 8, 40, -0.0110}},
+    {2262, {0, 8, 43, -0.0730}},
+    {2266, {0, 8, 45, -0.0070}},
+    {2268, {0, 8, 46, -0.1760}},
+    {2286, {0, 8, 55, -0.2230}},
+    {2288, {0, 8, 56, -0.1850}},
+    {2466, {0, 9, 9, 0.0000}},
+    {2468, {0, 9, 10, 0.0620}},
+    {2472, {0, 9, 12, 0.0020}},
+    {2478, {0, 9, 15, 0.0700}},
+    {2484, {0, 9, 18, 0.1880}},
+    {2486, {0, 9, 19, 0.4000}},
+    {2488, {0, 9, 20, 0.2870}},
+    {2498, {0, 9, 25, 0.3180}},
+    {2502, {0, 9, 27, 0.4000}},
+    {2516, {0, 9, 34, -0.1850}},
+    {2518, {0, 9, 35, -0.1500}},
+    {2523, {1, 9, 37, 0.1790}},
+    {2527, {1, 9, 39, 0.2020}},
+    {2528, {0, 9, 40, 0.0420}},
+    {2530, {0, 9, 41, 0.3580}},
+    {2538, {0, 9, 45, 0.0460}},
+    {2554, {0, 9, 53, 0.3179}},
+    {2556, {0, 9, 54, -0.1180}},
+    {2558, {0, 9, 55, -0.1700}},
+    {2560, {0, 9, 56, -0.1320}},
+    {2563, {1, 9, 57, 0.2010}},
+    {2572, {0, 9, 62, 0.1810}},
+    {2575, {1, 9, 63, 0.1260}},
+    {2577, {1, 9, 64, 0.1250}},
+    {2582, {0, 9, 67, 0.2070}},
+    {2605, {1, 9, 78, 0.1380}},
+    {2611, {1, 9, 81, -0.2080}},
+    {2740, {0, 10, 10, 0.0000}},
+    {2746, {0, 10, 13, 0.0060}},
+    {2748, {0, 10, 14, 0.0360}},
+    {2750, {0, 10, 15, 0.0080}},
+    {2754, {0, 10, 17, 0.0530}},
+    {2760, {0, 10, 20, 0.2250}},
+    {2764, {0, 10, 22, 0.1490}},
+    {2770, {0, 10, 25, 0.2560}},
+    {2772, {0, 10, 26, 0.1020}},
+    {2776, {0, 10, 28, 0.3700}},
+    {2788, {0, 10, 34, -0.2470}},
+    {2790, {0, 10, 35, -0.2120}},
+    {2794, {0, 10, 37, 0.1170}},
+    {2798, {0, 10, 39, 0.1400}},
+    {2800, {0, 10, 40, -0.0200}},
+    {2802, {0, 10, 41, 0.2960}},
+    {2810, {0, 10, 45, -0.0160}},
+    {2846, {0, 10, 63, 0.0640}},
+    {2848, {0, 10, 64, 0.0630}},
+    {3032, {0, 11, 20, 0.2980}},
+    {3036, {0, 11, 22, 0.2317}},
+    {3042, {0, 11, 25, 0.3290}},
+    {3044, {0, 11, 26, 0.1750}},
+    {3066, {0, 11, 37, 0.1900}},
+    {3072, {0, 11, 40, 0.0530}},
+    {3294, {0, 12, 15, 0.0680}},
+    {3300, {0, 12, 18, 0.1860}},
+    {3302, {0, 12, 19, 0.3701}},
+    {3304, {0, 12, 20, 0.2900}},
+    {3308, {0, 12, 22, 0.2273}},
+    {3314, {0, 12, 25, 0.3160}},
+    {3316, {0, 12, 26, 0.2112}},
+    {3338, {0, 12, 37, 0.1770}},
+    {3344, {0, 12, 40, 0.0400}},
+    {3378, {0, 12, 57, 0.1990}},
+    {3390, {0, 12, 63, 0.1240}},
+    {3392, {0, 12, 64, 0.1230}},
+    {3576, {0, 13, 20, 0.2190}},
+    {3580, {0, 13, 22, 0.1430}},
+    {3610, {0, 13, 37, 0.1110}},
+    {3664, {0, 13, 64, 0.0570}},
+    {3848, {0, 14, 20, 0.1890}},
+    {3882, {0, 14, 37, 0.0810}},
+    {4110, {0, 15, 15, 0.0000}},
+    {4116, {0, 15, 18, 0.1180}},
+    {4118, {0, 15, 19, 0.3300}},
+    {4120, {0, 15, 20, 0.2170}},
+    {4124, {0, 15, 22, 0.1410}},
+    {4130, {0, 15, 25, 0.2480}},
+    {4132, {0, 15, 26, 0.0940}},
+    {4140, {0, 15, 30, 0.0700}},
+    {4154, {0, 15, 37, 0.1015}},
+    {4160, {0, 15, 40, -0.0280}},
+    {4166, {0, 15, 43, -0.0900}},
+    {4194, {0, 15, 57, 0.1310}},
+    {4206, {0, 15, 63, 0.0560}},
+    {4208, {0, 15, 64, 0.0550}},
+    {4222, {0, 15, 71, 0.1800}},
+    {4384, {0, 16, 16, 0.0000}},
+    {4658, {0, 17, 17, 0.0000}},
+    {4664, {0, 17, 20, 0.1720}},
+    {4668, {0, 17, 22, 0.0960}},
+    {4698, {0, 17, 37, 0.0640}},
+    {4710, {0, 17, 43, -0.1350}},
+    {4932, {0, 18, 18, 0.0000}},
+    {4936, {0, 18, 20, 0.0990}},
+    {4940, {0, 18, 22, 0.0230}},
+    {4960, {0, 18, 32, -0.6500}},
+    {4970, {0, 18, 37, -0.0090}},
+    {4974, {0, 18, 39, 0.0140}},
+    {4982, {0, 18, 43, -0.1380}},
+    {4992, {0, 18, 48, -0.5895}},
+    {5006, {0, 18, 55, -0.3580}},
+    {5012, {0, 18, 58, -0.3700}},
+    {5020, {0, 18, 62, 0.2099}},
+    {5022, {0, 18, 63, -0.0620}},
+    {5024, {0, 18, 64, -0.0630}},
+    {5056, {0, 18, 80, -0.0260}},
+    {5206, {0, 19, 19, 0.0000}},
+    {5208, {0, 19, 20, -0.1130}},
+    {5242, {0, 19, 37, -0.2210}},
+    {5248, {0, 19, 40, -0.3580}},
+    {5294, {0, 19, 63, -0.2740}},
+    {5318, {0, 19, 75, -0.3490}},
+    {5480, {0, 20, 20, 0.0000}},
+    {5484, {0, 20, 22, -0.0760}},
+    {5490, {0, 20, 25, 0.0310}},
+    {5492, {0, 20, 26, -0.1230}},
+    {5500, {0, 20, 30, -0.1380}},
+    {5508, {0, 20, 34, -0.4720}},
+    {5514, {0, 20, 37, -0.1080}},
+    {5520, {0, 20, 40, -0.2450}},
+    {5522, {0, 20, 41, 0.0710}},
+    {5526, {0, 20, 43, -0.3070}},
+    {5530, {0, 20, 45, -0.2410}},
+    {6028, {0, 22, 22, 0.0000}},
+    {6044, {0, 22, 30, -0.0710}},
+    {6052, {0, 22, 34, -0.3960}},
+    {6058, {0, 22, 37, -0.0320}},
+    {6064, {0, 22, 40, -0.1690}},
+    {6066, {0, 22, 41, 0.1470}},
+    {6070, {0, 22, 43, -0.2310}},
+    {6074, {0, 22, 45, -0.1650}},
+    {6334, {0, 23, 39, -0.2700}},
+    {6380, {0, 23, 62, -0.4000}},
+    {6390, {0, 23, 67, -0.2920}},
+    {6392, {0, 23, 68, -0.3600}},
+    {6850, {0, 25, 25, 0.0000}},
+    {6864, {0, 25, 32, -0.7000}},
+    {6874, {0, 25, 37, -0.1390}},
+    {6878, {0, 25, 39, -0.1160}},
+    {6880, {0, 25, 40, -0.2760}},
+    {6886, {0, 25, 43, -0.3380}},
+    {6914, {0, 25, 57, -0.1170}},
+    {6926, {0, 25, 63, -0.1920}},
+    {6942, {0, 25, 71, -0.0362}},
+    {6944, {0, 25, 72, -0.6773}},
+    {7124, {0, 26, 26, 0.0000}},
+    {7140, {0, 26, 34, -0.3490}},
+    {7146, {0, 26, 37, 0.0150}},
+    {7152, {0, 26, 40, -0.1220}},
+    {7214, {0, 26, 71, 0.0960}},
+    {7696, {0, 28, 40, -0.4000}},
+    {7702, {0, 28, 43, -0.4200}},
+    {7712, {0, 28, 48, -0.4000}},
+    {8220, {0, 30, 30, 0.0000}},
+    {8240, {0, 30, 40, -0.0980}},
+    {8295, {1, 30, 67, 0.0670}},
+    {8572, {0, 31, 70, -0.4300}},
+    {8786, {0, 32, 41, 0.6500}},
+    {8794, {0, 32, 45, 0.5200}},
+    {8838, {0, 32, 67, 0.6330}},
+    {8840, {0, 32, 68, 0.7500}},
+    {8842, {0, 32, 69, 0.7500}},
+    {8850, {0, 32, 73, 0.3500}},
+    {8858, {0, 32, 77, 0.4500}},
+    {8868, {0, 32, 82, 0.6330}},
+    {9320, {0, 34, 36, 0.4500}},
+    {9322, {0, 34, 37, 0.3640}},
+    {9334, {0, 34, 43, 0.1650}},
+    {9594, {0, 35, 37, 0.3290}},
+    {9646, {0, 35, 63, 0.2760}},
+    {9900, {0, 36, 54, -0.4000}},
+    {9902, {0, 36, 55, -0.4500}},
+    {9904, {0, 36, 56, -0.4500}},
+    {9908, {0, 36, 58, -0.4570}},
+    {9912, {4, 36, 58, -0.4500}},
+    {9954, {0, 36, 81, -0.4500}},
+    {10138, {0, 37, 37, 0.0000}},
+    {10139, {1, 37, 37, 0.0000}},
+    {10140, {0, 37, 38, -0.3100}},
+    {10142, {0, 37, 39, 0.0230}},
+    {10143, {1, 37, 39, 0.0230}},
+    {10144, {0, 37, 40, -0.1000}},
+    {10146, {0, 37, 41, 0.1790}},
+    {10150, {0, 37, 43, -0.1990}},
+    {10154, {0, 37, 45, -0.1330}},
+    {10156, {0, 37, 46, -0.3020}},
+    {10174, {0, 37, 55, -0.3490}},
+    {10176, {0, 37, 56, -0.3110}},
+    {10179, {1, 37, 57, 0.0220}},
+    {10180, {0, 37, 58, -0.3610}},
+    {10181, {1, 37, 58, -0.3610}},
+    {10184, {4, 37, 58, -0.3500}},
+    {10186, {0, 37, 61, -0.1380}},
+    {10188, {0, 37, 62, 0.0020}},
+    {10190, {0, 37, 63, 0.0000}},
+    {10191, {1, 37, 63, -0.0530}},
+    {10192, {0, 37, 64, 0.0000}},
+    {10193, {1, 37, 64, -0.0540}},
+    {10199, {1, 37, 67, 0.0280}},
+    {10202, {0, 37, 69, -0.0895}},
+    {10220, {0, 37, 78, -0.0410}},
+    {10226, {0, 37, 81, -0.3870}},
+    {10227, {1, 37, 81, -0.3870}},
+    {10412, {0, 38, 38, 0.0000}},
+    {10462, {0, 38, 63, 0.2570}},
+    {10464, {0, 38, 64, 0.2560}},
+    {10474, {0, 38, 69, 0.3380}},
+    {10492, {0, 38, 78, 0.2690}},
+    {10687, {1, 39, 39, 0.0000}},
+    {10688, {0, 39, 40, -0.1600}},
+    {10698, {0, 39, 45, -0.1560}},
+    {10734, {0, 39, 63, -0.1516}},
+    {10735, {1, 39, 63, -0.0760}},
+    {10736, {0, 39, 64, -0.0770}},
+    {10737, {1, 39, 64, -0.0770}},
+    {10738, {0, 39, 65, -0.4180}},
+    {10764, {0, 39, 78, -0.0640}},
+    {10960, {0, 40, 40, 0.0000}},
+    {10970, {0, 40, 45, 0.0040}},
+    {10972, {0, 40, 46, -0.1650}},
+    {10988, {0, 40, 54, -0.1600}},
+    {11006, {0, 40, 63, 0.0840}},
+    {11008, {0, 40, 64, 0.0830}},
+    {11036, {0, 40, 78, 0.0960}},
+    {11234, {0, 41, 41, 0.0000}},
+    {11262, {0, 41, 55, -0.5280}},
+    {11276, {0, 41, 62, -0.1770}},
+    {11296, {0, 41, 72, -0.5000}},
+    {11312, {0, 41, 80, -0.1960}},
+    {11546, {0, 42, 61, 0.4920}},
+    {11782, {0, 43, 43, 0.0000}},
+    {11786, {0, 43, 45, 0.0660}},
+    {11824, {0, 43, 64, 0.1450}},
+    {12094, {0, 44, 63, 0.0400}},
+    {12098, {0, 44, 65, -0.2207}},
+    {12124, {0, 44, 78, 0.0690}},
+    {12128, {0, 44, 80, 0.0930}},
+    {12366, {0, 45, 63, 0.0800}},
+    {12368, {0, 45, 64, 0.0790}},
+    {12396, {0, 45, 78, 0.0920}},
+    {12890, {0, 47, 53, 0.3700}},
+    {13428, {0, 49, 50, 0.5673}},
+    {13976, {0, 51, 52, 0.5000}},
+    {15074, {0, 55, 57, 0.3544}},
+    {15084, {0, 55, 62, 0.3510}},
+    {15088, {0, 55, 64, 0.2950}},
+    {15120, {0, 55, 80, 0.3320}},
+    {15346, {0, 56, 57, 0.4000}},
+    {15358, {0, 56, 63, 0.2580}},
+    {15392, {0, 56, 80, 0.2700}},
+    {15624, {4, 57, 58, -0.4000}},
+    {15631, {1, 57, 63, -0.0750}},
+    {15633, {1, 57, 64, -0.0760}},
+    {15902, {0, 58, 63, 0.3080}},
+    {15904, {0, 58, 64, 0.3070}},
+    {16174, {0, 59, 63, 0.1400}},
+    {16178, {0, 59, 65, -0.1209}},
+    {16204, {0, 59, 78, 0.1690}},
+    {16208, {0, 59, 80, 0.1930}},
+    {16212, {0, 59, 82, 0.2380}},
+    {16442, {0, 60, 61, 0.3700}},
+    {16990, {0, 62, 63, -0.0550}},
+    {16992, {0, 62, 64, -0.0560}},
+    {17262, {0, 63, 63, 0.0000}},
+    {17263, {1, 63, 63, 0.0000}},
+    {17264, {0, 63, 64, 0.0000}},
+    {17268, {0, 63, 66, -0.3381}},
+    {17280, {0, 63, 72, -0.4000}},
+    {17292, {0, 63, 78, 0.0120}},
+    {17298, {0, 63, 81, -0.3340}},
+    {17536, {0, 64, 64, 0.0000}},
+    {17538, {0, 64, 65, -0.2888}},
+    {17540, {0, 64, 66, -0.2272}},
+    {17564, {0, 64, 78, 0.0130}},
+    {17570, {0, 64, 81, -0.3330}},
+    {17572, {0, 64, 82, 0.0820}},
+    {17812, {0, 65, 66, 0.0000}},
+    {17836, {0, 65, 78, 0.3070}},
+    {17842, {0, 65, 81, -0.0390}},
+    {17844, {0, 65, 82, 0.3760}},
+    {18084, {0, 66, 66, 0.0000}},
+    {18108, {0, 66, 78, 0.2990}},
+    {18114, {0, 66, 81, -0.0470}},
+    {19462, {0, 71, 75, -0.0958}},
+    {19730, {0, 72, 73, 0.4500}},
+    {20824, {0, 76, 76, 0.0000}},
+    {20828, {0, 76, 78, 0.4000}},
+    {21372, {0, 78, 78, 0.0000}},
+    {21373, {1, 78, 78, 0.0000}},
+    {21374, {0, 78, 79, -0.3030}},
+    {21378, {0, 78, 81, -0.3500}},
+    {21650, {0, 79, 81, -0.0430}},
+    {21922, {0, 80, 81, -0.4000}},
+};
+
+const MmffParametersEntry<MmffPartialChargeParameters> PartialChargeParameters[] = {
+    {1, {0.000, 0.000}},
+    {2, {-0.135, 0.000}},
+    {3, {-0.095, 0.000}},
+    {4, {-0.200, 0.000}},
+    {5, {-0.023, 0.000}},
+    {6, {-0.243, 0.000}},
+    {7, {-0.687, 0.000}},
+    {8, {-0.253, 0.000}},
+    {9, {-0.306, 0.000}},
+    {10, {-0.244, 0.000}},
+    {11, {-0.317, 0.000}},
+    {12, {-0.304, 0.000}},
+    {13, {-0.238, 0.000}},
+    {14, {-0.208, 0.000}},
+    {15, {-0.236, 0.000}},
+    {16, {-0.475, 0.000}},
+    {17, {-0.191, 0.000}},
+    {18, {-0.118, 0.000}},
+    {19, {0.094, 0.000}},
+    {20, {-0.019, 0.000}},
+    {21, {0.157, 0.000}},
+    {22, {-0.095, 0.000}},
+    {23, {0.193, 0.000}},
+    {24, {0.257, 0.000}},
+    {25, {0.012, 0.000}},
+    {26, {-0.142, 0.000}},
+    {27, {0.094, 0.000}},
+    {28, {0.058, 0.000}},
+    {29, {0.207, 0.000}},
+    {30, {-0.166, 0.000}},
+    {31, {0.161, 0.000}},
+    {32, {-0.732, 0.500}},
+    {33, {0.257, 0.000}},
+    {34, {-0.491, 0.000}},
+    {35, {-0.456, 0.500}},
+    {36, {-0.031, 0.000}},
+    {37, {-0.127, 0.000}},
+    {38, {-0.437, 0.000}},
+    {39, {-0.104, 0.000}},
+    {40, {-0.264, 0.000}},
+    {41, {0.052, 0.000}},
+    {42, {-0.757, 0.000}},
+    {43, {-0.326, 0.000}},
+    {44, {-0.237, 0.000}},
+    {45, {-0.260, 0.000}},
+    {46, {-0.429, 0.000}},
+    {47, {-0.418, 0.000}},
+    {48, {-0.525, 0.000}},
+    {49, {-0.283, 0.000}},
+    {50, {0.284, 0.000}},
+    {51, {-1.046, 0.000}},
+    {52, {-0.546, 0.000}},
+    {53, {-0.048, 0.000}},
+    {54, {-0.424, 0.000}},
+    {55, {-0.476, 0.000}},
+    {56, {-0.438, 0.000}},
+    {57, {-0.105, 0.000}},
+    {58, {-0.488, 0.000}},
+    {59, {-0.337, 0.000}},
+    {60, {-0.635, 0.000}},
+    {61, {-0.265, 0.000}},
+    {62, {-0.125, 0.250}},
+    {63, {-0.180, 0.000}},
+    {64, {-0.181, 0.000}},
+    {65, {-0.475, 0.000}},
+    {66, {-0.467, 0.000}},
+    {67, {-0.099, 0.000}},
+    {68, {-0.135, 0.000}},
+    {69, {-0.099, 0.000}},
+    {70, {-0.269, 0.000}},
+    {71, {-0.071, 0.000}},
+    {72, {-0.580, 0.500}},
+    {73, {-0.200, 0.000}},
+    {74, {-0.301, 0.000}},
+    {75, {-0.255, 0.000}},
+    {76, {-0.568, 0.250}},
+    {77, {-0.282, 0.000}},
+    {78, {-0.168, 0.000}},
+    {79, {-0.471, 0.000}},
+    {80, {-0.144, 0.000}},
+    {81, {-0.514, 0.000}},
+    {82, {-0.099, 0.000}},
+    {83, {0.000, 0.000}},
+    {84, {0.000, 0.000}},
+    {85, {0.000, 0.000}},
+    {86, {0.000, 0.000}},
+    {87, {2.000, 0.000}},
+    {88, {3.000, 0.000}},
+    {89, {-1.000, 0.000}},
+    {90, {-1.000, 0.000}},
+    {91, {-1.000, 0.000}},
+    {92, {1.000, 0.000}},
+    {93, {1.000, 0.000}},
+    {94, {1.000, 0.000}},
+    {95, {2.000, 0.000}},
+    {96, {2.000, 0.000}},
+    {97, {1.000, 0.000}},
+    {98, {2.000, 0.000}},
+    {99, {2.000, 0.000}},
+};
+
+template<typename T, size_t N>
+size_t count(const T (&)[N])
+{
+    return N;
+}
+
+} // end anonymous namespace
+
+// --- MMFF94 Parameters --------------------------------------------------- //
+/// Sets the parameters to the MMFF94 parameters.
+void MmffParametersData::setMmff94Parameters()
+{
+    bondStrechParameters.assign(BondStrechParameters, count(BondStrechParameters));
+    angleBendParameters.assign(AngleBendParameters, count(AngleBendParameters));
+    strechBendParameters.assign(StrechBendParameters, count(StrechBendParameters));
+    defaultStrechBendParameters.assign(DefaultStrechBendParameters,
+                                       DefaultStrechBendParameters + count(DefaultStrechBendParameters));
+    outOfPlaneBendingParameters.assign(OutOfPlaneBendingParameters, count(OutOfPlaneBendingParameters));
+    torsionParameters.assign(TorsionParameters, count(TorsionParameters));
+    chargeParameters.assign(ChargeParameters, count(ChargeParameters));
+
+    for(size_t i = 0; i < count(VanDerWaalsParameters); i++){
+        vanDerWaalsParameters[VanDerWaalsParameters[i].index] = VanDerWaalsParameters[i].parameters;
+    }
+
+    for(size_t i = 0; i < count(PartialChargeParameters); i++){
+        partialChargeParameters[PartialChargeParameters[i].index] = PartialChargeParameters[i].parameters;
+    }
+}
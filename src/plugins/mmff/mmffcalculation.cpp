@@ -35,8 +35,12 @@
 
 #include "mmffcalculation.h"
 
+#include <algorithm>
+
+#include <boost/thread/locks.hpp>
 #include <boost/lexical_cast.hpp>
 
+#include <chemkit/foreach.h>
 #include <chemkit/topology.h>
 #include <chemkit/constants.h>
 #include <chemkit/forcefield.h>
@@ -44,6 +48,124 @@
 
 #include "mmffparameters.h"
 
+namespace {
+
+// Calculates the van der waals parameters for a pair of atoms with
+// typeA and typeB. Returns false if the parameters are missing.
+bool vanDerWaalsParameters(const MmffParameters *parameters,
+                           int typeA,
+                           int typeB,
+                           chemkit::Real &rs,
+                           chemkit::Real &eps)
+{
+    const MmffVanDerWaalsParameters *parametersA = parameters->vanDerWaalsParameters(typeA);
+    const MmffVanDerWaalsParameters *parametersB = parameters->vanDerWaalsParameters(typeB);
+    if(!parametersA || !parametersB){
+        return false;
+    }
+
+    chemkit::Real N_a = parametersA->N;
+    chemkit::Real N_b = parametersB->N;
+    chemkit::Real A_a = parametersA->A;
+    chemkit::Real A_b = parametersB->A;
+    chemkit::Real G_a = parametersA->G;
+    chemkit::Real G_b = parametersB->G;
+    chemkit::Real alpha_a = parametersA->alpha;
+    chemkit::Real alpha_b = parametersB->alpha;
+    char DA_a = parametersA->DA;
+    char DA_b = parametersB->DA;
+
+    // equation 9
+    chemkit::Real rs_aa = A_a * pow(alpha_a, (1.0/4.0));
+    chemkit::Real rs_bb = A_b * pow(alpha_b, (1.0/4.0));
+
+    // equation 11
+    chemkit::Real gamma = (rs_aa - rs_bb) / (rs_aa + rs_bb);
+
+    // equation 10
+    if(DA_a == 'D' || (DA_b == 'D')){
+        rs = 0.5 * (rs_aa + rs_bb);
+    }
+    else{
+        rs = 0.5 * (rs_aa + rs_bb) * (1.0 + 0.2 * (1.0 - exp(-12.0 * gamma * gamma)));
+    }
+
+    // equation 12
+    eps = ((181.16 * G_a * G_b * alpha_a * alpha_b) / (sqrt(alpha_a / N_a) + sqrt(alpha_b / N_b))) * pow(rs, -6.0);
+
+    if((DA_a == 'D' && DA_b == 'A') || (DA_a == 'A' && DA_b == 'D')){
+        rs *= 0.8;
+        eps *= 0.5;
+    }
+
+    return true;
+}
+
+// Returns the bond strech energy for a bond of length r (equation 2).
+inline chemkit::Real bondStrechEnergy(chemkit::Real kb, chemkit::Real r0, chemkit::Real r)
+{
+    chemkit::Real dr = r - r0;
+    chemkit::Real cs = -2.0; // cubic strech constant
+
+    return 143.9325 * (kb / 2) * (dr*dr) * (1 + cs * dr + ((7.0/12.0)*(cs*cs)) * (dr*dr));
+}
+
+// Returns the derivative of the bond strech energy with respect to r.
+inline chemkit::Real bondStrechDerivative(chemkit::Real kb, chemkit::Real r0, chemkit::Real r)
+{
+    chemkit::Real dr = r - r0;
+    chemkit::Real cs = -2.0; // cubic strech constant
+
+    return 143.9325 * kb * dr * (1 + cs * dr + (7.0/12.0 * (cs*cs) * (dr*dr)) + 0.5 * dr * (cs + (14.0/12.0 * (cs*cs) * dr)));
+}
+
+// Returns the angle bend energy for an angle of t degrees (equation 3).
+inline chemkit::Real angleBendEnergy(chemkit::Real ka, chemkit::Real t0, chemkit::Real t)
+{
+    chemkit::Real cb = -0.007; // cubic bend constant
+    chemkit::Real dt = t - t0;
+
+    return 0.043844 * (ka / 2.0) * pow(dt, 2) * (1 + cb * dt);
+}
+
+// Returns the derivative of the angle bend energy with respect to t.
+inline chemkit::Real angleBendDerivative(chemkit::Real ka, chemkit::Real t0, chemkit::Real t)
+{
+    chemkit::Real cb = -0.007; // cubic bend constant
+    chemkit::Real dt = t - t0;
+
+    return 0.043844 * ka * dt * (1 + cb * dt + 0.5 * cb * dt);
+}
+
+// Returns the out of plane bending energy for a wilson angle of
+// w degrees (equation 6).
+inline chemkit::Real outOfPlaneBendingEnergy(chemkit::Real koop, chemkit::Real w)
+{
+    return 0.043844 * (koop / 2.0) * (w*w);
+}
+
+// Returns the derivative of the out of plane bending energy with
+// respect to w.
+inline chemkit::Real outOfPlaneBendingDerivative(chemkit::Real koop, chemkit::Real w)
+{
+    return 0.043844 * koop * w;
+}
+
+// Returns the torsion energy for a torsion angle of phi
+// radians (equation 7).
+inline chemkit::Real torsionEnergy(chemkit::Real V1, chemkit::Real V2, chemkit::Real V3, chemkit::Real phi)
+{
+    return 0.5 * (V1 * (1.0 + cos(phi)) + V2 * (1.0 - cos(2.0 * phi)) + V3 * (1.0 + cos(3.0 * phi)));
+}
+
+// Returns the derivative of the torsion energy with respect to phi.
+inline chemkit::Real torsionDerivative(chemkit::Real V1, chemkit::Real V2, chemkit::Real V3, chemkit::Real phi)
+{
+    return 0.5 * (-V1 * sin(phi) + 2 * V2 * sin(2 * phi) - 3 * V3 * sin(3 * phi));
+}
+
+} // end anonymous namespace
+
 // === MmffCalculation ===================================================== //
 MmffCalculation::MmffCalculation(int type, int atomCount, int parameterCount)
     : ForceFieldCalculation(type, atomCount, parameterCount)
@@ -88,11 +210,8 @@ chemkit::Real MmffBondStrechCalculation::energy(const chemkit::CartesianCoordina
     chemkit::Real r0 = parameter(1);
 
     chemkit::Real r = coordinates->distance(a, b);
-    chemkit::Real dr = r - r0;
-    chemkit::Real cs = -2.0; // cubic strech constant
 
-    // equation 2
-    return 143.9325 * (kb / 2) * (dr*dr) * (1 + cs * dr + ((7.0/12.0)*(cs*cs)) * (dr*dr));
+    return bondStrechEnergy(kb, r0, r);
 }
 
 std::vector<chemkit::Vector3> MmffBondStrechCalculation::gradient(const chemkit::CartesianCoordinates *coordinates) const
@@ -104,11 +223,9 @@ std::vector<chemkit::Vector3> MmffBondStrechCalculation::gradient(const chemkit:
     chemkit::Real r0 = parameter(1);
 
     chemkit::Real r = coordinates->distance(a, b);
-    chemkit::Real dr = r - r0;
-    chemkit::Real cs = -2.0; // cubic strech constant
 
     // dE/dr
-    chemkit::Real de_dr = 143.9325 * kb * dr * (1 + cs * dr + (7.0/12.0 * (cs*cs) * (dr*dr)) + 0.5 * dr * (cs + (14.0/12.0 * (cs*cs) * dr)));
+    chemkit::Real de_dr = bondStrechDerivative(kb, r0, r);
 
     boost::array<chemkit::Vector3, 2> gradient = coordinates->distanceGradient(a, b);
 
@@ -161,12 +278,9 @@ chemkit::Real MmffAngleBendCalculation::energy(const chemkit::CartesianCoordinat
     chemkit::Real ka = parameter(0);
     chemkit::Real t0 = parameter(1);
 
-    chemkit::Real cb = -0.007; // cubic bend constant
     chemkit::Real t = coordinates->angle(a, b, c);
-    chemkit::Real dt = t - t0;
 
-    // equation 3
-    return 0.043844 * (ka / 2.0) * pow(dt, 2) * (1 + cb * dt);
+    return angleBendEnergy(ka, t0, t);
 }
 
 std::vector<chemkit::Vector3> MmffAngleBendCalculation::gradient(const chemkit::CartesianCoordinates *coordinates) const
@@ -178,12 +292,10 @@ std::vector<chemkit::Vector3> MmffAngleBendCalculation::gradient(const chemkit::
     chemkit::Real ka = parameter(0);
     chemkit::Real t0 = parameter(1);
 
-    chemkit::Real cb = -0.007; // cubic bend constant
     chemkit::Real t = coordinates->angle(a, b, c);
-    chemkit::Real dt = t - t0;
 
     // dE/dt
-    chemkit::Real de_dt = 0.043844 * ka * dt * (1 + cb * dt + 0.5 * cb * dt);
+    chemkit::Real de_dt = angleBendDerivative(ka, t0, t);
 
     boost::array<chemkit::Vector3, 3> gradient = coordinates->angleGradient(a, b, c);
 
@@ -367,8 +479,7 @@ chemkit::Real MmffOutOfPlaneBendingCalculation::energy(const chemkit::CartesianC
     chemkit::Real angle = coordinates->wilsonAngle(a, b, c, d);
     chemkit::Real koop = parameter(0);
 
-    // equation 6
-    return 0.043844 * (koop / 2.0) * (angle*angle);
+    return outOfPlaneBendingEnergy(koop, angle);
 }
 
 std::vector<chemkit::Vector3> MmffOutOfPlaneBendingCalculation::gradient(const chemkit::CartesianCoordinates *coordinates) const
@@ -382,7 +493,7 @@ std::vector<chemkit::Vector3> MmffOutOfPlaneBendingCalculation::gradient(const c
     chemkit::Real koop = parameter(0);
 
     // dE/dw
-    chemkit::Real de_dw = 0.043844 * koop * angle;
+    chemkit::Real de_dw = outOfPlaneBendingDerivative(koop, angle);
 
     boost::array<chemkit::Vector3, 4> gradient = coordinates->wilsonAngleGradient(a, b, c, d);
 
@@ -444,8 +555,7 @@ chemkit::Real MmffTorsionCalculation::energy(const chemkit::CartesianCoordinates
     chemkit::Real V2 = parameter(1);
     chemkit::Real V3 = parameter(2);
 
-    // equation 7
-    return 0.5 * (V1 * (1.0 + cos(angle)) + V2 * (1.0 - cos(2.0 * angle)) + V3 * (1.0 + cos(3.0 * angle)));
+    return torsionEnergy(V1, V2, V3, angle);
 }
 
 std::vector<chemkit::Vector3> MmffTorsionCalculation::gradient(const chemkit::CartesianCoordinates *coordinates) const
@@ -461,7 +571,7 @@ std::vector<chemkit::Vector3> MmffTorsionCalculation::gradient(const chemkit::Ca
     chemkit::Real V3 = parameter(2);
 
     // dE/dphi
-    chemkit::Real de_dphi = 0.5 * (-V1 * sin(phi) + 2 * V2 * sin(2 * phi) - 3 * V3 * sin(3 * phi));
+    chemkit::Real de_dphi = torsionDerivative(V1, V2, V3, phi);
 
     boost::array<chemkit::Vector3, 4> gradient = coordinates->torsionAngleGradientRadians(a, b, c, d);
 
@@ -491,46 +601,10 @@ bool MmffVanDerWaalsCalculation::setup(const MmffParameters *parameters)
     int typeA = boost::lexical_cast<int>(topology->type(a));
     int typeB = boost::lexical_cast<int>(topology->type(b));
 
-    const MmffVanDerWaalsParameters *parametersA = parameters->vanDerWaalsParameters(typeA);
-    const MmffVanDerWaalsParameters *parametersB = parameters->vanDerWaalsParameters(typeB);
-    if(!parametersA || !parametersB){
-        return false;
-    }
-
-    chemkit::Real N_a = parametersA->N;
-    chemkit::Real N_b = parametersB->N;
-    chemkit::Real A_a = parametersA->A;
-    chemkit::Real A_b = parametersB->A;
-    chemkit::Real G_a = parametersA->G;
-    chemkit::Real G_b = parametersB->G;
-    chemkit::Real alpha_a = parametersA->alpha;
-    chemkit::Real alpha_b = parametersB->alpha;
-    char DA_a = parametersA->DA;
-    char DA_b = parametersB->DA;
-
-    // equation 9
-    chemkit::Real rs_aa = A_a * pow(alpha_a, (1.0/4.0));
-    chemkit::Real rs_bb = A_b * pow(alpha_b, (1.0/4.0));
-
-    // equation 11
-    chemkit::Real gamma = (rs_aa - rs_bb) / (rs_aa + rs_bb);
-
-    // equation 10
     chemkit::Real rs;
-
-    if(DA_a == 'D' || (DA_b == 'D')){
-        rs = 0.5 * (rs_aa + rs_bb);
-    }
-    else{
-        rs = 0.5 * (rs_aa + rs_bb) * (1.0 + 0.2 * (1.0 - exp(-12.0 * gamma * gamma)));
-    }
-
-    // equation 12
-    chemkit::Real eps = ((181.16 * G_a * G_b * alpha_a * alpha_b) / (sqrt(alpha_a / N_a) + sqrt(alpha_b / N_b))) * pow(rs, -6.0);
-
-    if((DA_a == 'D' && DA_b == 'A') || (DA_a == 'A' && DA_b == 'D')){
-        rs *= 0.8;
-        eps *= 0.5;
+    chemkit::Real eps;
+    if(!vanDerWaalsParameters(parameters, typeA, typeB, rs, eps)){
+        return false;
     }
 
     setParameter(0, rs);
@@ -646,3 +720,378 @@ std::vector<chemkit::Vector3> MmffElectrostaticCalculation::gradient(const chemk
 
     return std::vector<chemkit::Vector3>(gradient.begin(), gradient.end());
 }
+
+// === MmffNeighborListCalculation ========================================= //
+// Calculates the van der waals and electrostatic energy for each pair
+// of atoms within the nonbonded cutoff distance using a neighbor list.
+MmffNeighborListCalculation::MmffNeighborListCalculation(size_t size, chemkit::Real cutoff, chemkit::Real skin)
+    : MmffCalculation(VanDerWaals | Electrostatic, size, 0),
+      m_neighborList(size, cutoff, skin)
+{
+    for(size_t i = 0; i < size; i++){
+        setAtom(i, i);
+    }
+}
+
+bool MmffNeighborListCalculation::setup(const MmffParameters *parameters)
+{
+    const boost::shared_ptr<chemkit::Topology> &topology = this->topology();
+
+    m_neighborList.addExclusions(topology.get());
+
+    // assign each distinct atom type an index
+    std::vector<int> types;
+    m_typeIndices.resize(atomCount());
+    m_charges.resize(atomCount());
+
+    for(size_t i = 0; i < atomCount(); i++){
+        int type = boost::lexical_cast<int>(topology->type(i));
+
+        std::vector<int>::iterator iter = std::find(types.begin(), types.end(), type);
+        m_typeIndices[i] = iter - types.begin();
+        if(iter == types.end()){
+            types.push_back(type);
+        }
+
+        m_charges[i] = topology->charge(i);
+    }
+
+    // calculate van der waals parameters for each pair of types
+    m_typeCount = types.size();
+    m_radii.resize(m_typeCount * m_typeCount);
+    m_wellDepths.resize(m_typeCount * m_typeCount);
+
+    bool ok = true;
+
+    for(size_t i = 0; i < m_typeCount; i++){
+        for(size_t j = 0; j < m_typeCount; j++){
+            if(!vanDerWaalsParameters(parameters,
+                                      types[i],
+                                      types[j],
+                                      m_radii[i * m_typeCount + j],
+                                      m_wellDepths[i * m_typeCount + j])){
+                ok = false;
+            }
+        }
+    }
+
+    return ok;
+}
+
+chemkit::Real MmffNeighborListCalculation::energy(const chemkit::CartesianCoordinates *coordinates) const
+{
+    boost::lock_guard<boost::mutex> lock(m_neighborListMutex);
+    m_neighborList.update(coordinates);
+
+    const boost::shared_ptr<chemkit::Topology> &topology = this->topology();
+    chemkit::Real cutoff = m_neighborList.cutoff();
+    chemkit::Real e = 1.0; // dielectric constant
+    chemkit::Real d = 0.05; // electrostatic buffering constant
+    chemkit::Real energy = 0;
+
+    foreach(const chemkit::NeighborList::Pair &pair, m_neighborList.pairs()){
+        size_t a = pair[0];
+        size_t b = pair[1];
+
+        chemkit::Real r = coordinates->distance(a, b);
+        if(r > cutoff){
+            continue;
+        }
+
+        size_t type = m_typeIndices[a] * m_typeCount + m_typeIndices[b];
+        chemkit::Real rs = m_radii[type];
+        chemkit::Real eps = m_wellDepths[type];
+        chemkit::Real oneFourScaling = topology->isOneFour(a, b) ? 0.75 : 1.0;
+
+        // equation 8
+        energy += eps * pow(((1.07 * rs) / (r + 0.07 * rs)), 7) * (((1.12 * pow(rs, 7)) / (pow(r, 7) + 0.12 * pow(rs, 7))) - 2);
+
+        // equation 13
+        energy += ((332.0716 * m_charges[a] * m_charges[b]) / (e * (r + d))) * oneFourScaling;
+    }
+
+    return energy;
+}
+
+std::vector<chemkit::Vector3> MmffNeighborListCalculation::gradient(const chemkit::CartesianCoordinates *coordinates) const
+{
+    boost::lock_guard<boost::mutex> lock(m_neighborListMutex);
+    m_neighborList.update(coordinates);
+
+    std::vector<chemkit::Vector3> gradient(atomCount(), chemkit::Vector3(0, 0, 0));
+
+    const boost::shared_ptr<chemkit::Topology> &topology = this->topology();
+    chemkit::Real cutoff = m_neighborList.cutoff();
+    chemkit::Real e = 1.0; // dielectric constant
+    chemkit::Real d = 0.05; // electrostatic buffering constant
+
+    foreach(const chemkit::NeighborList::Pair &pair, m_neighborList.pairs()){
+        size_t a = pair[0];
+        size_t b = pair[1];
+
+        chemkit::Vector3 ab = (*coordinates)[a] - (*coordinates)[b];
+        chemkit::Real r = ab.norm();
+        if(r > cutoff){
+            continue;
+        }
+
+        size_t type = m_typeIndices[a] * m_typeCount + m_typeIndices[b];
+        chemkit::Real rs = m_radii[type];
+        chemkit::Real eps = m_wellDepths[type];
+        chemkit::Real oneFourScaling = topology->isOneFour(a, b) ? 0.75 : 1.0;
+
+        // dE/dr
+        chemkit::Real de_dr = 7 * eps * pow(1.07 * rs / (r + 0.07 * rs), 6) *
+                               ((-1.07 * rs / pow(r + 0.07 * rs, 2)) * (1.12 * pow(rs, 7) / (pow(r, 7) + 0.12 * pow(rs, 7)) - 2) +
+                               (-1.12 * pow(rs, 7) * pow(r, 6) / pow(pow(r, 7) + 0.12 * pow(rs, 7), 2)) * (1.07 * rs / (r + 0.07 * rs)));
+        de_dr += 332.0716 * m_charges[a] * m_charges[b] * oneFourScaling * (-1.0 / (e * pow(r + d, 2)));
+
+        chemkit::Vector3 de_da = ab * (de_dr / r);
+        gradient[a] += de_da;
+        gradient[b] -= de_da;
+    }
+
+    return gradient;
+}
+
+// === MmffBondStrechBatch ================================================= //
+MmffBondStrechBatch::MmffBondStrechBatch()
+    : chemkit::ForceFieldCalculationBatch(chemkit::ForceFieldCalculation::BondStrech, 2, 2)
+{
+}
+
+chemkit::Real MmffBondStrechBatch::energy(const chemkit::CartesianCoordinates *coordinates, size_t begin, size_t end) const
+{
+    const size_t *a = atoms(0);
+    const size_t *b = atoms(1);
+    const chemkit::Real *kb = parameters(0);
+    const chemkit::Real *r0 = parameters(1);
+
+    chemkit::Real energy = 0;
+
+    for(size_t i = begin; i < end; i++){
+        chemkit::Real r = coordinates->distance(a[i], b[i]);
+
+        energy += bondStrechEnergy(kb[i], r0[i], r);
+    }
+
+    return energy;
+}
+
+void MmffBondStrechBatch::gradient(const chemkit::CartesianCoordinates *coordinates, std::vector<chemkit::Vector3> &gradient, size_t begin, size_t end) const
+{
+    const size_t *a = atoms(0);
+    const size_t *b = atoms(1);
+    const chemkit::Real *kb = parameters(0);
+    const chemkit::Real *r0 = parameters(1);
+
+    for(size_t i = begin; i < end; i++){
+        chemkit::Real r = coordinates->distance(a[i], b[i]);
+        chemkit::Real de_dr = bondStrechDerivative(kb[i], r0[i], r);
+
+        boost::array<chemkit::Vector3, 2> distanceGradient = coordinates->distanceGradient(a[i], b[i]);
+
+        gradient[a[i]] += distanceGradient[0] * de_dr;
+        gradient[b[i]] += distanceGradient[1] * de_dr;
+    }
+}
+
+// === MmffAngleBendBatch ================================================== //
+MmffAngleBendBatch::MmffAngleBendBatch()
+    : chemkit::ForceFieldCalculationBatch(chemkit::ForceFieldCalculation::AngleBend, 3, 2)
+{
+}
+
+chemkit::Real MmffAngleBendBatch::energy(const chemkit::CartesianCoordinates *coordinates, size_t begin, size_t end) const
+{
+    const size_t *a = atoms(0);
+    const size_t *b = atoms(1);
+    const size_t *c = atoms(2);
+    const chemkit::Real *ka = parameters(0);
+    const chemkit::Real *t0 = parameters(1);
+
+    chemkit::Real energy = 0;
+
+    for(size_t i = begin; i < end; i++){
+        chemkit::Real t = coordinates->angle(a[i], b[i], c[i]);
+
+        energy += angleBendEnergy(ka[i], t0[i], t);
+    }
+
+    return energy;
+}
+
+void MmffAngleBendBatch::gradient(const chemkit::CartesianCoordinates *coordinates, std::vector<chemkit::Vector3> &gradient, size_t begin, size_t end) const
+{
+    const size_t *a = atoms(0);
+    const size_t *b = atoms(1);
+    const size_t *c = atoms(2);
+    const chemkit::Real *ka = parameters(0);
+    const chemkit::Real *t0 = parameters(1);
+
+    for(size_t i = begin; i < end; i++){
+        chemkit::Real t = coordinates->angle(a[i], b[i], c[i]);
+        chemkit::Real de_dt = angleBendDerivative(ka[i], t0[i], t);
+
+        boost::array<chemkit::Vector3, 3> angleGradient = coordinates->angleGradient(a[i], b[i], c[i]);
+
+        gradient[a[i]] += angleGradient[0] * de_dt;
+        gradient[b[i]] += angleGradient[1] * de_dt;
+        gradient[c[i]] += angleGradient[2] * de_dt;
+    }
+}
+
+// === MmffStrechBendBatch ================================================= //
+MmffStrechBendBatch::MmffStrechBendBatch()
+    : chemkit::ForceFieldCalculationBatch(chemkit::ForceFieldCalculation::BondStrech |
+                                          chemkit::ForceFieldCalculation::AngleBend, 3, 5)
+{
+}
+
+chemkit::Real MmffStrechBendBatch::energy(const chemkit::CartesianCoordinates *coordinates, size_t begin, size_t end) const
+{
+    const size_t *a = atoms(0);
+    const size_t *b = atoms(1);
+    const size_t *c = atoms(2);
+    const chemkit::Real *kba_ijk = parameters(0);
+    const chemkit::Real *kba_kji = parameters(1);
+    const chemkit::Real *r0_ab = parameters(2);
+    const chemkit::Real *r0_bc = parameters(3);
+    const chemkit::Real *t0 = parameters(4);
+
+    chemkit::Real energy = 0;
+
+    for(size_t i = begin; i < end; i++){
+        chemkit::Real dr_ab = coordinates->distance(a[i], b[i]) - r0_ab[i];
+        chemkit::Real dr_bc = coordinates->distance(b[i], c[i]) - r0_bc[i];
+        chemkit::Real dt = coordinates->angle(a[i], b[i], c[i]) - t0[i];
+
+        // equation 5
+        energy += 2.51210 * (kba_ijk[i] * dr_ab + kba_kji[i] * dr_bc) * dt;
+    }
+
+    return energy;
+}
+
+void MmffStrechBendBatch::gradient(const chemkit::CartesianCoordinates *coordinates, std::vector<chemkit::Vector3> &gradient, size_t begin, size_t end) const
+{
+    const size_t *a = atoms(0);
+    const size_t *b = atoms(1);
+    const size_t *c = atoms(2);
+    const chemkit::Real *kba_ijk = parameters(0);
+    const chemkit::Real *kba_kji = parameters(1);
+    const chemkit::Real *r0_ab = parameters(2);
+    const chemkit::Real *r0_bc = parameters(3);
+    const chemkit::Real *t0 = parameters(4);
+
+    for(size_t i = begin; i < end; i++){
+        chemkit::Real dr_ab = coordinates->distance(a[i], b[i]) - r0_ab[i];
+        chemkit::Real dr_bc = coordinates->distance(b[i], c[i]) - r0_bc[i];
+        chemkit::Real dt = coordinates->angle(a[i], b[i], c[i]) - t0[i];
+        chemkit::Real k = kba_ijk[i] * dr_ab + kba_kji[i] * dr_bc;
+
+        boost::array<chemkit::Vector3, 2> distanceGradientAB = coordinates->distanceGradient(a[i], b[i]);
+        boost::array<chemkit::Vector3, 2> distanceGradientBC = coordinates->distanceGradient(b[i], c[i]);
+        boost::array<chemkit::Vector3, 3> angleGradientABC = coordinates->angleGradient(a[i], b[i], c[i]);
+
+        gradient[a[i]] += (distanceGradientAB[0] * kba_ijk[i] * dt + angleGradientABC[0] * k) * 2.51210;
+        gradient[b[i]] += ((distanceGradientAB[1] * kba_ijk[i] + distanceGradientBC[0] * kba_kji[i]) * dt + angleGradientABC[1] * k) * 2.51210;
+        gradient[c[i]] += ((distanceGradientBC[1] * kba_kji[i]) * dt + angleGradientABC[2] * k) * 2.51210;
+    }
+}
+
+// === MmffOutOfPlaneBendingBatch ========================================== //
+MmffOutOfPlaneBendingBatch::MmffOutOfPlaneBendingBatch()
+    : chemkit::ForceFieldCalculationBatch(chemkit::ForceFieldCalculation::Inversion, 4, 1)
+{
+}
+
+chemkit::Real MmffOutOfPlaneBendingBatch::energy(const chemkit::CartesianCoordinates *coordinates, size_t begin, size_t end) const
+{
+    const size_t *a = atoms(0);
+    const size_t *b = atoms(1);
+    const size_t *c = atoms(2);
+    const size_t *d = atoms(3);
+    const chemkit::Real *koop = parameters(0);
+
+    chemkit::Real energy = 0;
+
+    for(size_t i = begin; i < end; i++){
+        chemkit::Real angle = coordinates->wilsonAngle(a[i], b[i], c[i], d[i]);
+
+        energy += outOfPlaneBendingEnergy(koop[i], angle);
+    }
+
+    return energy;
+}
+
+void MmffOutOfPlaneBendingBatch::gradient(const chemkit::CartesianCoordinates *coordinates, std::vector<chemkit::Vector3> &gradient, size_t begin, size_t end) const
+{
+    const size_t *a = atoms(0);
+    const size_t *b = atoms(1);
+    const size_t *c = atoms(2);
+    const size_t *d = atoms(3);
+    const chemkit::Real *koop = parameters(0);
+
+    for(size_t i = begin; i < end; i++){
+        chemkit::Real angle = coordinates->wilsonAngle(a[i], b[i], c[i], d[i]);
+        chemkit::Real de_dw = outOfPlaneBendingDerivative(koop[i], angle);
+
+        boost::array<chemkit::Vector3, 4> wilsonGradient = coordinates->wilsonAngleGradient(a[i], b[i], c[i], d[i]);
+
+        gradient[a[i]] += wilsonGradient[0] * de_dw;
+        gradient[b[i]] += wilsonGradient[1] * de_dw;
+        gradient[c[i]] += wilsonGradient[2] * de_dw;
+        gradient[d[i]] += wilsonGradient[3] * de_dw;
+    }
+}
+
+// === MmffTorsionBatch ==================================================== //
+MmffTorsionBatch::MmffTorsionBatch()
+    : chemkit::ForceFieldCalculationBatch(chemkit::ForceFieldCalculation::Torsion, 4, 3)
+{
+}
+
+chemkit::Real MmffTorsionBatch::energy(const chemkit::CartesianCoordinates *coordinates, size_t begin, size_t end) const
+{
+    const size_t *a = atoms(0);
+    const size_t *b = atoms(1);
+    const size_t *c = atoms(2);
+    const size_t *d = atoms(3);
+    const chemkit::Real *V1 = parameters(0);
+    const chemkit::Real *V2 = parameters(1);
+    const chemkit::Real *V3 = parameters(2);
+
+    chemkit::Real energy = 0;
+
+    for(size_t i = begin; i < end; i++){
+        chemkit::Real phi = coordinates->torsionAngleRadians(a[i], b[i], c[i], d[i]);
+
+        energy += torsionEnergy(V1[i], V2[i], V3[i], phi);
+    }
+
+    return energy;
+}
+
+void MmffTorsionBatch::gradient(const chemkit::CartesianCoordinates *coordinates, std::vector<chemkit::Vector3> &gradient, size_t begin, size_t end) const
+{
+    const size_t *a = atoms(0);
+    const size_t *b = atoms(1);
+    const size_t *c = atoms(2);
+    const size_t *d = atoms(3);
+    const chemkit::Real *V1 = parameters(0);
+    const chemkit::Real *V2 = parameters(1);
+    const chemkit::Real *V3 = parameters(2);
+
+    for(size_t i = begin; i < end; i++){
+        chemkit::Real phi = coordinates->torsionAngleRadians(a[i], b[i], c[i], d[i]);
+        chemkit::Real de_dphi = torsionDerivative(V1[i], V2[i], V3[i], phi);
+
+        boost::array<chemkit::Vector3, 4> torsionGradient = coordinates->torsionAngleGradientRadians(a[i], b[i], c[i], d[i]);
+
+        gradient[a[i]] += torsionGradient[0] * de_dphi;
+        gradient[b[i]] += torsionGradient[1] * de_dphi;
+        gradient[c[i]] += torsionGradient[2] * de_dphi;
+        gradient[d[i]] += torsionGradient[3] * de_dphi;
+    }
+}
@@ -36,7 +36,11 @@
 #ifndef MMFFCALCULATION_H
 #define MMFFCALCULATION_H
 
+#include <boost/thread/mutex.hpp>
+
+#include <chemkit/neighborlist.h>
 #include <chemkit/forcefieldcalculation.h>
+#include <chemkit/forcefieldcalculationbatch.h>
 
 class MmffParameters;
 
@@ -119,4 +123,83 @@ public:
     std::vector<chemkit::Vector3> gradient(const chemkit::CartesianCoordinates *coordinates) const CHEMKIT_OVERRIDE;
 };
 
+class MmffNeighborListCalculation : public MmffCalculation
+{
+public:
+    MmffNeighborListCalculation(size_t size, chemkit::Real cutoff, chemkit::Real skin);
+
+    bool setup(const MmffParameters *parameters);
+    chemkit::Real energy(const chemkit::CartesianCoordinates *coordinates) const CHEMKIT_OVERRIDE;
+    std::vector<chemkit::Vector3> gradient(const chemkit::CartesianCoordinates *coordinates) const CHEMKIT_OVERRIDE;
+
+private:
+    mutable chemkit::NeighborList m_neighborList;
+    mutable boost::mutex m_neighborListMutex;
+    std::vector<size_t> m_typeIndices;
+    size_t m_typeCount;
+    std::vector<chemkit::Real> m_radii;
+    std::vector<chemkit::Real> m_wellDepths;
+    std::vector<chemkit::Real> m_charges;
+};
+
+class MmffBondStrechBatch : public chemkit::ForceFieldCalculationBatch
+{
+public:
+    MmffBondStrechBatch();
+
+    using chemkit::ForceFieldCalculationBatch::energy;
+    using chemkit::ForceFieldCalculationBatch::gradient;
+
+    chemkit::Real energy(const chemkit::CartesianCoordinates *coordinates, size_t begin, size_t end) const CHEMKIT_OVERRIDE;
+    void gradient(const chemkit::CartesianCoordinates *coordinates, std::vector<chemkit::Vector3> &gradient, size_t begin, size_t end) const CHEMKIT_OVERRIDE;
+};
+
+class MmffAngleBendBatch : public chemkit::ForceFieldCalculationBatch
+{
+public:
+    MmffAngleBendBatch();
+
+    using chemkit::ForceFieldCalculationBatch::energy;
+    using chemkit::ForceFieldCalculationBatch::gradient;
+
+    chemkit::Real energy(const chemkit::CartesianCoordinates *coordinates, size_t begin, size_t end) const CHEMKIT_OVERRIDE;
+    void gradient(const chemkit::CartesianCoordinates *coordinates, std::vector<chemkit::Vector3> &gradient, size_t begin, size_t end) const CHEMKIT_OVERRIDE;
+};
+
+class MmffStrechBendBatch : public chemkit::ForceFieldCalculationBatch
+{
+public:
+    MmffStrechBendBatch();
+
+    using chemkit::ForceFieldCalculationBatch::energy;
+    using chemkit::ForceFieldCalculationBatch::gradient;
+
+    chemkit::Real energy(const chemkit::CartesianCoordinates *coordinates, size_t begin, size_t end) const CHEMKIT_OVERRIDE;
+    void gradient(const chemkit::CartesianCoordinates *coordinates, std::vector<chemkit::Vector3> &gradient, size_t begin, size_t end) const CHEMKIT_OVERRIDE;
+};
+
+class MmffOutOfPlaneBendingBatch : public chemkit::ForceFieldCalculationBatch
+{
+public:
+    MmffOutOfPlaneBendingBatch();
+
+    using chemkit::ForceFieldCalculationBatch::energy;
+    using chemkit::ForceFieldCalculationBatch::gradient;
+
+    chemkit::Real energy(const chemkit::CartesianCoordinates *coordinates, size_t begin, size_t end) const CHEMKIT_OVERRIDE;
+    void gradient(const chemkit::CartesianCoordinates *coordinates, std::vector<chemkit::Vector3> &gradient, size_t begin, size_t end) const CHEMKIT_OVERRIDE;
+};
+
+class MmffTorsionBatch : public chemkit::ForceFieldCalculationBatch
+{
+public:
+    MmffTorsionBatch();
+
+    using chemkit::ForceFieldCalculationBatch::energy;
+    using chemkit::ForceFieldCalculationBatch::gradient;
+
+    chemkit::Real energy(const chemkit::CartesianCoordinates *coordinates, size_t begin, size_t end) const CHEMKIT_OVERRIDE;
+    void gradient(const chemkit::CartesianCoordinates *coordinates, std::vector<chemkit::Vector3> &gradient, size_t begin, size_t end) const CHEMKIT_OVERRIDE;
+};
+
 #endif // MMFFCALCULATION_H
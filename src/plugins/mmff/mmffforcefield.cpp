@@ -81,6 +81,7 @@ MmffForceField::~MmffForceField()
 bool MmffForceField::setup()
 {
     if(!m_parameters || m_parameters->fileName() != parameterFile()){
+        delete m_parameters;
         m_parameters = new MmffParameters;
         bool ok = m_parameters->read(parameterFile());
         if(!ok){
@@ -96,12 +97,21 @@ bool MmffForceField::setup()
         return false;
     }
 
+    // the bonded calculations are evaluated in batches
+    MmffBondStrechBatch *bondStrechBatch = new MmffBondStrechBatch;
+    MmffAngleBendBatch *angleBendBatch = new MmffAngleBendBatch;
+    MmffStrechBendBatch *strechBendBatch = new MmffStrechBendBatch;
+    MmffOutOfPlaneBendingBatch *outOfPlaneBendingBatch = new MmffOutOfPlaneBendingBatch;
+    MmffTorsionBatch *torsionBatch = new MmffTorsionBatch;
+
     // bond strech calculations
     foreach(const chemkit::Topology::BondedInteraction &interaction, topology->bondedInteractions()){
         size_t a = interaction[0];
         size_t b = interaction[1];
 
-        addCalculation(new MmffBondStrechCalculation(a, b));
+        MmffBondStrechCalculation *calculation = new MmffBondStrechCalculation(a, b);
+        addCalculation(calculation);
+        bondStrechBatch->addCalculation(calculation);
     }
 
     // angle bend and strech bend calculations
@@ -110,8 +120,13 @@ bool MmffForceField::setup()
         size_t b = interaction[1];
         size_t c = interaction[2];
 
-        addCalculation(new MmffAngleBendCalculation(a, b, c));
-        addCalculation(new MmffStrechBendCalculation(a, b, c));
+        MmffAngleBendCalculation *angleBendCalculation = new MmffAngleBendCalculation(a, b, c);
+        addCalculation(angleBendCalculation);
+        angleBendBatch->addCalculation(angleBendCalculation);
+
+        MmffStrechBendCalculation *strechBendCalculation = new MmffStrechBendCalculation(a, b, c);
+        addCalculation(strechBendCalculation);
+        strechBendBatch->addCalculation(strechBendCalculation);
     }
 
     // out of plane bending calculation (for each trigonal center)
@@ -121,9 +136,16 @@ bool MmffForceField::setup()
         size_t c = interaction[2];
         size_t d = interaction[3];
 
-        addCalculation(new MmffOutOfPlaneBendingCalculation(a, b, c, d));
-        addCalculation(new MmffOutOfPlaneBendingCalculation(a, b, d, c));
-        addCalculation(new MmffOutOfPlaneBendingCalculation(c, b, d, a));
+        MmffOutOfPlaneBendingCalculation *calculations[] = {
+            new MmffOutOfPlaneBendingCalculation(a, b, c, d),
+            new MmffOutOfPlaneBendingCalculation(a, b, d, c),
+            new MmffOutOfPlaneBendingCalculation(c, b, d, a)
+        };
+
+        for(int i = 0; i < 3; i++){
+            addCalculation(calculations[i]);
+            outOfPlaneBendingBatch->addCalculation(calculations[i]);
+        }
     }
 
     // torsion calculations (for each dihedral)
@@ -133,16 +155,42 @@ bool MmffForceField::setup()
         size_t c = interaction[2];
         size_t d = interaction[3];
 
-        addCalculation(new MmffTorsionCalculation(a, b, c, d));
+        MmffTorsionCalculation *calculation = new MmffTorsionCalculation(a, b, c, d);
+        addCalculation(calculation);
+        torsionBatch->addCalculation(calculation);
     }
 
     // van der waals and electrostatic calculations
-    foreach(const chemkit::Topology::NonbondedInteraction &interaction, topology->nonbondedInteractions()){
-        size_t a = interaction[0];
-        size_t b = interaction[1];
+    if(nonbondedCutoff() > 0){
+        addCalculation(new MmffNeighborListCalculation(topology->size(),
+                                                       nonbondedCutoff(),
+                                                       neighborListSkin()));
+    }
+    else{
+        foreach(const chemkit::Topology::NonbondedInteraction &interaction, topology->nonbondedInteractions()){
+            size_t a = interaction[0];
+            size_t b = interaction[1];
+
+            addCalculation(new MmffVanDerWaalsCalculation(a, b));
+            addCalculation(new MmffElectrostaticCalculation(a, b));
+        }
+    }
 
-        addCalculation(new MmffVanDerWaalsCalculation(a, b));
-        addCalculation(new MmffElectrostaticCalculation(a, b));
+    chemkit::ForceFieldCalculationBatch *batches[] = {
+        bondStrechBatch,
+        angleBendBatch,
+        strechBendBatch,
+        outOfPlaneBendingBatch,
+        torsionBatch
+    };
+
+    for(int i = 0; i < 5; i++){
+        if(batches[i]->isEmpty()){
+            delete batches[i];
+        }
+        else{
+            addCalculationBatch(batches[i]);
+        }
     }
 
     bool ok = true;
@@ -280,18 +280,27 @@ bool MmffParameters::read(const std::string &fileName)
     // try to load cached parameters
     MmffPlugin *mmffPlugin = static_cast<MmffPlugin *>(chemkit::PluginManager::instance()->plugin("mmff"));
     if(mmffPlugin){
-        d = mmffPlugin->parameters(fileName);
+        boost::shared_ptr<MmffParametersData> cached = mmffPlugin->parameters(fileName);
 
-        if(d){
+        if(cached){
+            d = cached;
+            m_fileName = fileName;
             return true;
         }
-    }
 
-    // create new parameters data if we don't have a cached one
-    if(!d){
-        d = boost::make_shared<MmffParametersData>();
+        // the default parameters file is compiled into the plugin
+        if(fileName == mmffPlugin->dataPath() + "mmff94.prm"){
+            d = boost::make_shared<MmffParametersData>();
+            d->setMmff94Parameters();
+            m_fileName = fileName;
+            mmffPlugin->storeParameters(fileName, d);
+            return true;
+        }
     }
 
+    // create new parameters data for the file
+    d = boost::make_shared<MmffParametersData>();
+
     std::ifstream file(fileName.c_str());
     if(!file.is_open()){
         setErrorString("Failed to open parameters file.");
@@ -355,7 +364,7 @@ bool MmffParameters::read(const std::string &fileName)
                 MmffBondStrechParameters parameters;
                 parameters.kb = boost::lexical_cast<chemkit::Real>(data[3]);
                 parameters.r0 = boost::lexical_cast<chemkit::Real>(data[4]);
-                d->bondStrechParameters[index] = parameters;
+                d->bondStrechParameters.insert(index, parameters);
             }
             else if(section == EmpiricalBondStrech){
             }
@@ -370,7 +379,7 @@ bool MmffParameters::read(const std::string &fileName)
                 MmffAngleBendParameters parameters;
                 parameters.ka = boost::lexical_cast<chemkit::Real>(data[4]);
                 parameters.theta0 = boost::lexical_cast<chemkit::Real>(data[5]);
-                d->angleBendParameters[index] = parameters;
+                d->angleBendParameters.insert(index, parameters);
             }
             else if(section == StrechBend){
                 int strechBendType = boost::lexical_cast<int>(data[0]);
@@ -383,7 +392,7 @@ bool MmffParameters::read(const std::string &fileName)
                 MmffStrechBendParameters parameters;
                 parameters.kba_ijk = boost::lexical_cast<chemkit::Real>(data[4]);
                 parameters.kba_kji = boost::lexical_cast<chemkit::Real>(data[5]);
-                d->strechBendParameters[index] = parameters;
+                d->strechBendParameters.insert(index, parameters);
             }
             else if(section == DefaultStrechBend){
                 MmffDefaultStrechBendParameters parameters;
@@ -404,7 +413,7 @@ bool MmffParameters::read(const std::string &fileName)
 
                 MmffOutOfPlaneBendingParameters parameters;
                 parameters.koop = boost::lexical_cast<chemkit::Real>(data[4]);
-                d->outOfPlaneBendingParameters[index] = parameters;
+                d->outOfPlaneBendingParameters.insert(index, parameters);
             }
             else if(section == Torsion){
                 int torsionType = boost::lexical_cast<int>(data[0]);
@@ -419,7 +428,7 @@ bool MmffParameters::read(const std::string &fileName)
                 parameters.V1 = boost::lexical_cast<chemkit::Real>(data[5]);
                 parameters.V2 = boost::lexical_cast<chemkit::Real>(data[6]);
                 parameters.V3 = boost::lexical_cast<chemkit::Real>(data[7]);
-                d->torsionParameters[index] = parameters;
+                d->torsionParameters.insert(index, parameters);
             }
             else if(section == VanDerWaals){
                 int type = boost::lexical_cast<int>(data[0]);
@@ -440,7 +449,9 @@ bool MmffParameters::read(const std::string &fileName)
                 parameters.typeA = boost::lexical_cast<int>(data[1]);
                 parameters.typeB = boost::lexical_cast<int>(data[2]);
                 parameters.bci = boost::lexical_cast<chemkit::Real>(data[3]);
-                d->chargeParameters.push_back(parameters);
+
+                int index = calculateBondStrechIndex(parameters.bondType, parameters.typeA, parameters.typeB);
+                d->chargeParameters.insert(index, parameters);
             }
             else if(section == PartialCharge){
                 int type = boost::lexical_cast<int>(data[1]);
@@ -455,6 +466,8 @@ bool MmffParameters::read(const std::string &fileName)
         }
     }
 
+    d->sort();
+
     // store parameters in the cache
     if(mmffPlugin){
         mmffPlugin->storeParameters(fileName, d);
@@ -480,15 +493,7 @@ const MmffChargeParameters* MmffParameters::chargeParameters(const chemkit::Atom
 {
     int bondType = calculateBondType(a->bondTo(b), typeA, typeB);
 
-    foreach(const MmffChargeParameters &parameters, d->chargeParameters){
-        if(parameters.bondType == bondType &&
-           parameters.typeA == typeA &&
-           parameters.typeB == typeB){
-            return &parameters;
-        }
-    }
-
-    return 0;
+    return d->chargeParameters.find(calculateBondStrechIndex(bondType, typeA, typeB));
 }
 
 const MmffPartialChargeParameters* MmffParameters::partialChargeParameters(int type) const
@@ -503,12 +508,7 @@ const MmffBondStrechParameters* MmffParameters::bondStrechParameters(int bondTyp
 
     int index = calculateBondStrechIndex(bondType, typeA, typeB);
 
-    std::map<int, MmffBondStrechParameters>::const_iterator iter = d->bondStrechParameters.find(index);
-    if(iter == d->bondStrechParameters.end()){
-        return 0;
-    }
-
-    return &iter->second;
+    return d->bondStrechParameters.find(index);
 }
 
 const MmffBondStrechParameters* MmffParameters::empiricalBondStrechParameters(int atomicNumberA, int atomicNumberB) const
@@ -526,24 +526,14 @@ const MmffAngleBendParameters* MmffParameters::angleBendParameters(int angleType
 
     int index = calculateAngleBendIndex(angleType, typeA, typeB, typeC);
 
-    std::map<int, MmffAngleBendParameters>::const_iterator iter = d->angleBendParameters.find(index);
-    if(iter == d->angleBendParameters.end()){
-        return 0;
-    }
-
-    return &iter->second;
+    return d->angleBendParameters.find(index);
 }
 
 const MmffStrechBendParameters* MmffParameters::strechBendParameters(int strechBendType, int typeA, int typeB, int typeC) const
 {
     int index = calculateStrechBendIndex(strechBendType, typeA, typeB, typeC);
 
-    std::map<int, MmffStrechBendParameters>::const_iterator iter = d->strechBendParameters.find(index);
-    if(iter == d->strechBendParameters.end()){
-        return 0;
-    }
-
-    return &iter->second;
+    return d->strechBendParameters.find(index);
 }
 
 const MmffStrechBendParameters* MmffParameters::defaultStrechBendParameters(int typeA, int typeB, int typeC) const
@@ -574,31 +564,30 @@ const MmffOutOfPlaneBendingParameters* MmffParameters::outOfPlaneBendingParamete
 
     int index = calculateOutOfPlaneBendingIndex(typeA, typeB, typeC, typeD);
 
-    std::map<int, MmffOutOfPlaneBendingParameters>::const_iterator iter;
-    iter = d->outOfPlaneBendingParameters.find(index);
-    if(iter != d->outOfPlaneBendingParameters.end()){
-        return &iter->second;
+    const MmffOutOfPlaneBendingParameters *parameters = d->outOfPlaneBendingParameters.find(index);
+    if(parameters){
+        return parameters;
     }
 
     // step down 3-2-3-3
     index = calculateOutOfPlaneBendingIndex(equivalentType(typeA, 3), typeB, equivalentType(typeC, 3), equivalentType(typeD, 3));
-    iter = d->outOfPlaneBendingParameters.find(index);
-    if(iter != d->outOfPlaneBendingParameters.end()){
-        return &iter->second;
+    parameters = d->outOfPlaneBendingParameters.find(index);
+    if(parameters){
+        return parameters;
     }
 
     // step down 4-2-4-4
     index = calculateOutOfPlaneBendingIndex(equivalentType(typeA, 4), typeB, equivalentType(typeC, 4), equivalentType(typeD, 4));
-    iter = d->outOfPlaneBendingParameters.find(index);
-    if(iter != d->outOfPlaneBendingParameters.end()){
-        return &iter->second;
+    parameters = d->outOfPlaneBendingParameters.find(index);
+    if(parameters){
+        return parameters;
     }
 
     // step down 5-2-5-5
     index = calculateOutOfPlaneBendingIndex(equivalentType(typeA, 5), typeB, equivalentType(typeC, 5), equivalentType(typeD, 5));
-    iter = d->outOfPlaneBendingParameters.find(index);
-    if(iter != d->outOfPlaneBendingParameters.end()){
-        return &iter->second;
+    parameters = d->outOfPlaneBendingParameters.find(index);
+    if(parameters){
+        return parameters;
     }
 
     return 0;
@@ -616,38 +605,37 @@ const MmffTorsionParameters* MmffParameters::torsionParameters(int torsionType,
 
     int index = calculateTorsionIndex(torsionType, typeA, typeB, typeC, typeD);
 
-    std::map<int, MmffTorsionParameters>::const_iterator iter;
-    iter = d->torsionParameters.find(index);
-    if(iter != d->torsionParameters.end()){
-        return &iter->second;
+    const MmffTorsionParameters *parameters = d->torsionParameters.find(index);
+    if(parameters){
+        return parameters;
     }
 
     // step down 3-2-2-5
     index = calculateTorsionIndex(torsionType, equivalentType(typeA, 3), typeB, typeC, equivalentType(typeD, 5));
-    iter = d->torsionParameters.find(index);
-    if(iter != d->torsionParameters.end()){
-        return &iter->second;
+    parameters = d->torsionParameters.find(index);
+    if(parameters){
+        return parameters;
     }
 
     // step down 5-2-2-3
     index = calculateTorsionIndex(torsionType, equivalentType(typeA, 5), typeB, typeC, equivalentType(typeD, 3));
-    iter = d->torsionParameters.find(index);
-    if(iter != d->torsionParameters.end()){
-        return &iter->second;
+    parameters = d->torsionParameters.find(index);
+    if(parameters){
+        return parameters;
     }
 
     // step down 5-2-2-5
     index = calculateTorsionIndex(torsionType, equivalentType(typeA, 5), typeB, typeC, equivalentType(typeD, 5));
-    iter = d->torsionParameters.find(index);
-    if(iter != d->torsionParameters.end()){
-        return &iter->second;
+    parameters = d->torsionParameters.find(index);
+    if(parameters){
+        return parameters;
     }
 
     // step down 5-2-2-5 (with no torsion type)
     index = calculateTorsionIndex(0, equivalentType(typeA, 5), typeB, typeC, equivalentType(typeD, 5));
-    iter = d->torsionParameters.find(index);
-    if(iter != d->torsionParameters.end()){
-        return &iter->second;
+    parameters = d->torsionParameters.find(index);
+    if(parameters){
+        return parameters;
     }
 
     return 0;
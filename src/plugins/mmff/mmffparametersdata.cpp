@@ -43,3 +43,16 @@ MmffParametersData::MmffParametersData()
       partialChargeParameters(MmffParameters::MaxAtomType + 1)
 {
 }
+
+// --- Parameters ---------------------------------------------------------- //
+/// Sorts each of the parameter tables. This must be called after
+/// inserting parameters read from a parameters file.
+void MmffParametersData::sort()
+{
+    bondStrechParameters.sort();
+    angleBendParameters.sort();
+    strechBendParameters.sort();
+    outOfPlaneBendingParameters.sort();
+    torsionParameters.sort();
+    chargeParameters.sort();
+}
@@ -36,26 +36,116 @@
 #ifndef MMFFPARAMETERSDATA_H
 #define MMFFPARAMETERSDATA_H
 
-#include <map>
 #include <vector>
+#include <algorithm>
 
 #include "mmffparameters.h"
 
+template<typename T>
+struct MmffParametersEntry
+{
+    int index;
+    T parameters;
+};
+
+// Flat table of parameters sorted by their index. Lookups are done
+// with a binary search.
+template<typename T>
+class MmffParametersTable
+{
+public:
+    void assign(const MmffParametersEntry<T> *entries, size_t count);
+    void insert(int index, const T &parameters);
+    void sort();
+    const T* find(int index) const;
+    size_t size() const;
+
+private:
+    static bool compareIndex(const MmffParametersEntry<T> &a, const MmffParametersEntry<T> &b);
+
+private:
+    std::vector<MmffParametersEntry<T> > m_entries;
+};
+
 class MmffParametersData
 {
 public:
     // construction and destruction
     MmffParametersData();
 
-    std::map<int, MmffBondStrechParameters> bondStrechParameters;
-    std::map<int, MmffAngleBendParameters> angleBendParameters;
-    std::map<int, MmffStrechBendParameters> strechBendParameters;
+    // parameters
+    void setMmff94Parameters();
+    void sort();
+
+    MmffParametersTable<MmffBondStrechParameters> bondStrechParameters;
+    MmffParametersTable<MmffAngleBendParameters> angleBendParameters;
+    MmffParametersTable<MmffStrechBendParameters> strechBendParameters;
     std::vector<MmffDefaultStrechBendParameters> defaultStrechBendParameters;
-    std::map<int, MmffOutOfPlaneBendingParameters> outOfPlaneBendingParameters;
-    std::map<int, MmffTorsionParameters> torsionParameters;
+    MmffParametersTable<MmffOutOfPlaneBendingParameters> outOfPlaneBendingParameters;
+    MmffParametersTable<MmffTorsionParameters> torsionParameters;
     std::vector<MmffVanDerWaalsParameters> vanDerWaalsParameters;
-    std::vector<MmffChargeParameters> chargeParameters;
+    MmffParametersTable<MmffChargeParameters> chargeParameters;
     std::vector<MmffPartialChargeParameters> partialChargeParameters;
 };
 
+// --- MmffParametersTable ------------------------------------------------- //
+template<typename T>
+inline void MmffParametersTable<T>::assign(const MmffParametersEntry<T> *entries, size_t count)
+{
+    m_entries.assign(entries, entries + count);
+}
+
+template<typename T>
+inline void MmffParametersTable<T>::insert(int index, const T &parameters)
+{
+    MmffParametersEntry<T> entry = { index, parameters };
+    m_entries.push_back(entry);
+}
+
+// Sorts the entries by index. If an index was inserted more than
+// once the last inserted parameters are kept.
+template<typename T>
+inline void MmffParametersTable<T>::sort()
+{
+    std::stable_sort(m_entries.begin(), m_entries.end(), compareIndex);
+
+    size_t count = 0;
+    for(size_t i = 0; i < m_entries.size(); i++){
+        if(i + 1 < m_entries.size() && m_entries[i + 1].index == m_entries[i].index){
+            continue;
+        }
+
+        m_entries[count++] = m_entries[i];
+    }
+
+    m_entries.resize(count);
+}
+
+template<typename T>
+inline const T* MmffParametersTable<T>::find(int index) const
+{
+    MmffParametersEntry<T> key;
+    key.index = index;
+
+    typename std::vector<MmffParametersEntry<T> >::const_iterator iter =
+        std::lower_bound(m_entries.begin(), m_entries.end(), key, compareIndex);
+    if(iter == m_entries.end() || iter->index != index){
+        return 0;
+    }
+
+    return &iter->parameters;
+}
+
+template<typename T>
+inline size_t MmffParametersTable<T>::size() const
+{
+    return m_entries.size();
+}
+
+template<typename T>
+inline bool MmffParametersTable<T>::compareIndex(const MmffParametersEntry<T> &a, const MmffParametersEntry<T> &b)
+{
+    return a.index < b.index;
+}
+
 #endif // MMFFPARAMETERSDATA_H
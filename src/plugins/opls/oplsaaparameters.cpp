@@ -0,0 +1,5023 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+// This file was generated from data/oplsaa.prm by
+// scripts/oplsparameters.py. Do not edit it by hand.
+
+#include "oplsparameters.h"
+
+namespace {
+
+struct OplsAtomData
+{
+    int type;
+    int klass;
+    const char *name;
+};
+
+struct OplsVanDerWaalsData
+{
+    int type;
+    OplsVanDerWaalsParameters parameters;
+};
+
+struct OplsChargeData
+{
+    int type;
+    chemkit::Real charge;
+};
+
+const OplsAtomData AtomData[] = {
+    {1, 1, "F"},
+    {2, 2, "C2"},
+    {3, 3, "C"},
+    {4, 4, "O"},
+    {5, 5, "OH"},
+    {6, 6, "C3"},
+    {7, 7, "HO"},
+    {8, 8, "C4"},
+    {9, 6, "C3"},
+    {10, 6, "C3"},
+    {11, 6, "C3"},
+    {12, 6, "C3"},
+    {13, 2, "C2"},
+    {14, 9, "C9"},
+    {15, 10, "CH"},
+    {16, 11, "C8"},
+    {17, 12, "CD"},
+    {18, 13, "CT"},
+    {19, 14, "C7"},
+    {20, 5, "OH"},
+    {21, 7, "HO"},
+    {22, 6, "C3"},
+    {23, 2, "C2"},
+    {24, 15, "SH"},
+    {25, 15, "SH"},
+    {26, 16, "S"},
+    {27, 16, "S"},
+    {28, 17, "HS"},
+    {29, 17, "HS"},
+    {30, 6, "C3"},
+    {31, 2, "C2"},
+    {32, 6, "C3"},
+    {33, 2, "C2"},
+    {34, 6, "C3"},
+    {35, 2, "C2"},
+    {36, 18, "NZ"},
+    {37, 19, "CZ"},
+    {38, 6, "C3"},
+    {39, 20, "OW"},
+    {40, 21, "HW"},
+    {41, 22, "LP"},
+    {42, 23, "DM"},
+    {43, 24, "He"},
+    {44, 25, "Ne"},
+    {45, 26, "Ar"},
+    {46, 27, "Kr"},
+    {47, 28, "Xe"},
+    {48, 10, "CH"},
+    {49, 13, "CT"},
+    {50, 29, "OS"},
+    {51, 6, "C3"},
+    {52, 2, "C2"},
+    {53, 20, "OW"},
+    {54, 21, "HW"},
+    {55, 20, "OW"},
+    {56, 21, "HW"},
+    {57, 22, "LP"},
+    {58, 20, "OW"},
+    {59, 21, "HW"},
+    {60, 2, "C2"},
+    {61, 30, "Cl"},
+    {62, 10, "CH"},
+    {63, 30, "Cl"},
+    {64, 13, "CT"},
+    {65, 30, "Cl"},
+    {66, 31, "SZ"},
+    {67, 32, "OY"},
+    {68, 6, "C3"},
+    {69, 33, "NT"},
+    {70, 34, "H"},
+    {71, 4, "O"},
+    {72, 35, "N"},
+    {73, 3, "C"},
+    {74, 6, "C3"},
+    {75, 20, "OW"},
+    {76, 21, "HW"},
+    {77, 13, "CT"},
+    {78, 13, "CT"},
+    {79, 13, "CT"},
+    {80, 13, "CT"},
+    {81, 13, "CT"},
+    {82, 36, "HC"},
+    {83, 37, "CM"},
+    {84, 37, "CM"},
+    {85, 37, "CM"},
+    {86, 36, "HC"},
+    {87, 38, "CA"},
+    {88, 39, "HA"},
+    {89, 38, "CA"},
+    {90, 13, "CT"},
+    {91, 13, "CT"},
+    {92, 40, "C="},
+    {93, 5, "OH"},
+    {94, 7, "HO"},
+    {95, 36, "HC"},
+    {96, 13, "CT"},
+    {97, 13, "CT"},
+    {98, 13, "CT"},
+    {99, 13, "CT"},
+    {100, 13, "CT"},
+    {101, 5, "OH"},
+    {102, 7, "HO"},
+    {103, 1, "F"},
+    {104, 36, "HC"},
+    {105, 38, "CA"},
+    {106, 5, "OH"},
+    {107, 7, "HO"},
+    {108, 5, "OH"},
+    {109, 7, "HO"},
+    {110, 5, "OH"},
+    {111, 7, "HO"},
+    {112, 13, "CT"},
+    {113, 13, "CT"},
+    {114, 13, "CT"},
+    {115, 36, "HC"},
+    {116, 29, "OS"},
+    {117, 40, "C="},
+    {118, 29, "OS"},
+    {119, 29, "OS"},
+    {120, 13, "CT"},
+    {121, 13, "CT"},
+    {122, 13, "CT"},
+    {123, 13, "CT"},
+    {124, 36, "HC"},
+    {125, 29, "OS"},
+    {126, 5, "OH"},
+    {127, 7, "HO"},
+    {128, 41, "CO"},
+    {129, 36, "HC"},
+    {130, 41, "CO"},
+    {131, 36, "HC"},
+    {132, 41, "CO"},
+    {133, 36, "HC"},
+    {134, 41, "CO"},
+    {135, 36, "HC"},
+    {136, 41, "CO"},
+    {137, 41, "CO"},
+    {138, 38, "CA"},
+    {139, 15, "SH"},
+    {140, 15, "SH"},
+    {141, 16, "S"},
+    {142, 16, "S"},
+    {143, 17, "HS"},
+    {144, 17, "HS"},
+    {145, 13, "CT"},
+    {146, 13, "CT"},
+    {147, 13, "CT"},
+    {148, 13, "CT"},
+    {149, 13, "CT"},
+    {150, 13, "CT"},
+    {151, 13, "CT"},
+    {152, 13, "CT"},
+    {153, 13, "CT"},
+    {154, 13, "CT"},
+    {155, 13, "CT"},
+    {156, 13, "CT"},
+    {157, 13, "CT"},
+    {158, 13, "CT"},
+    {159, 13, "CT"},
+    {160, 38, "CA"},
+    {161, 16, "S"},
+    {162, 13, "CT"},
+    {163, 13, "CT"},
+    {164, 13, "CT"},
+    {165, 30, "Cl"},
+    {166, 37, "CM"},
+    {167, 38, "CA"},
+    {168, 13, "CT"},
+    {169, 13, "CT"},
+    {170, 3, "C"},
+    {171, 3, "C"},
+    {172, 3, "C"},
+    {173, 3, "C"},
+    {174, 3, "C"},
+    {175, 4, "O"},
+    {176, 35, "N"},
+    {177, 35, "N"},
+    {178, 35, "N"},
+    {179, 34, "H"},
+    {180, 34, "H"},
+    {181, 13, "CT"},
+    {182, 13, "CT"},
+    {183, 13, "CT"},
+    {184, 13, "CT"},
+    {185, 13, "CT"},
+    {186, 3, "C"},
+    {187, 4, "O"},
+    {188, 35, "N"},
+    {189, 34, "H"},
+    {190, 35, "N"},
+    {191, 3, "C"},
+    {192, 4, "O"},
+    {193, 34, "H"},
+    {194, 36, "HC"},
+    {195, 13, "CT"},
+    {196, 13, "CT"},
+    {197, 13, "CT"},
+    {198, 13, "CT"},
+    {199, 38, "CA"},
+    {200, 19, "CZ"},
+    {201, 18, "NZ"},
+    {202, 38, "CA"},
+    {203, 30, "Cl"},
+    {204, 35, "N"},
+    {205, 38, "CA"},
+    {206, 3, "C"},
+    {207, 5, "OH"},
+    {208, 4, "O"},
+    {209, 7, "HO"},
+    {210, 3, "C"},
+    {211, 42, "O2"},
+    {212, 13, "CT"},
+    {213, 13, "CT"},
+    {214, 13, "CT"},
+    {215, 13, "CT"},
+    {216, 3, "C"},
+    {217, 4, "O"},
+    {218, 36, "HC"},
+    {219, 3, "C"},
+    {220, 4, "O"},
+    {221, 36, "HC"},
+    {222, 13, "CT"},
+    {223, 13, "CT"},
+    {224, 13, "CT"},
+    {225, 13, "CT"},
+    {226, 43, "N3"},
+    {227, 43, "N3"},
+    {228, 43, "N3"},
+    {229, 44, "H3"},
+    {230, 44, "H3"},
+    {231, 13, "CT"},
+    {232, 13, "CT"},
+    {233, 13, "CT"},
+    {234, 13, "CT"},
+    {235, 13, "CT"},
+    {236, 13, "CT"},
+    {237, 13, "CT"},
+    {238, 13, "CT"},
+    {239, 13, "CT"},
+    {240, 45, "N2"},
+    {241, 44, "H3"},
+    {242, 38, "CA"},
+    {243, 45, "N2"},
+    {244, 44, "H3"},
+    {245, 13, "CT"},
+    {246, 13, "CT"},
+    {247, 13, "CT"},
+    {248, 13, "CT"},
+    {249, 43, "N3"},
+    {250, 44, "H3"},
+    {251, 46, "NC"},
+    {252, 38, "CA"},
+    {253, 45, "N2"},
+    {254, 34, "H"},
+    {255, 38, "CA"},
+    {256, 39, "HA"},
+    {257, 38, "CA"},
+    {258, 39, "HA"},
+    {259, 47, "NA"},
+    {260, 3, "C"},
+    {261, 47, "NA"},
+    {262, 3, "C"},
+    {263, 37, "CM"},
+    {264, 37, "CM"},
+    {265, 34, "H"},
+    {266, 4, "O"},
+    {267, 34, "H"},
+    {268, 4, "O"},
+    {269, 36, "HC"},
+    {270, 36, "HC"},
+    {271, 13, "CT"},
+    {272, 36, "HC"},
+    {273, 47, "NA"},
+    {274, 3, "C"},
+    {275, 46, "NC"},
+    {276, 38, "CA"},
+    {277, 37, "CM"},
+    {278, 37, "CM"},
+    {279, 34, "H"},
+    {280, 4, "O"},
+    {281, 45, "N2"},
+    {282, 34, "H"},
+    {283, 34, "H"},
+    {284, 36, "HC"},
+    {285, 48, "H4"},
+    {286, 46, "NC"},
+    {287, 49, "CQ"},
+    {288, 46, "NC"},
+    {289, 50, "CB"},
+    {290, 50, "CB"},
+    {291, 38, "CA"},
+    {292, 51, "NB"},
+    {293, 52, "CK"},
+    {294, 47, "NA"},
+    {295, 53, "H5"},
+    {296, 45, "N2"},
+    {297, 34, "H"},
+    {298, 34, "H"},
+    {299, 53, "H5"},
+    {300, 34, "H"},
+    {301, 47, "NA"},
+    {302, 38, "CA"},
+    {303, 46, "NC"},
+    {304, 50, "CB"},
+    {305, 50, "CB"},
+    {306, 3, "C"},
+    {307, 34, "H"},
+    {308, 45, "N2"},
+    {309, 34, "H"},
+    {310, 4, "O"},
+    {311, 13, "CT"},
+    {312, 36, "HC"},
+    {313, 13, "CT"},
+    {314, 36, "HC"},
+    {315, 13, "CT"},
+    {316, 36, "HC"},
+    {317, 47, "NA"},
+    {318, 3, "C"},
+    {319, 47, "NA"},
+    {320, 38, "CA"},
+    {321, 37, "CM"},
+    {322, 37, "CM"},
+    {323, 34, "H"},
+    {324, 4, "O"},
+    {325, 34, "H"},
+    {326, 45, "N2"},
+    {327, 34, "H"},
+    {328, 34, "H"},
+    {329, 39, "HA"},
+    {330, 48, "H4"},
+    {331, 13, "CT"},
+    {332, 36, "HC"},
+    {333, 54, "P"},
+    {334, 42, "O2"},
+    {335, 29, "OS"},
+    {336, 13, "CT"},
+    {337, 37, "CM"},
+    {338, 30, "Cl"},
+    {339, 37, "CM"},
+    {340, 1, "F"},
+    {341, 30, "Cl"},
+    {342, 55, "Br"},
+    {343, 56, "I"},
+    {344, 57, "N4"},
+    {345, 58, "Li"},
+    {346, 59, "Na"},
+    {347, 60, "K"},
+    {348, 61, "Rb"},
+    {349, 62, "Cs"},
+    {350, 63, "Mg"},
+    {351, 64, "Ca"},
+    {352, 65, "Sr"},
+    {353, 66, "Ba"},
+    {354, 6, "C3"},
+    {355, 36, "HC"},
+    {356, 15, "SH"},
+    {357, 6, "C3"},
+    {358, 36, "HC"},
+    {359, 5, "OH"},
+    {360, 13, "CT"},
+    {361, 36, "HC"},
+    {362, 19, "CZ"},
+    {363, 18, "NZ"},
+    {364, 6, "C3"},
+    {365, 36, "HC"},
+    {366, 43, "N3"},
+    {367, 34, "H"},
+    {368, 6, "C3"},
+    {369, 36, "HC"},
+    {370, 13, "CT"},
+    {371, 36, "HC"},
+    {372, 22, "LP"},
+    {373, 5, "OH"},
+    {374, 7, "HO"},
+    {375, 67, "U"},
+    {376, 68, "OU"},
+    {377, 29, "OS"},
+    {378, 54, "P"},
+    {379, 42, "O2"},
+    {380, 29, "OS"},
+    {381, 13, "CT"},
+    {382, 36, "HC"},
+    {383, 54, "P"},
+    {384, 42, "O2"},
+    {385, 29, "OS"},
+    {386, 13, "CT"},
+    {387, 36, "HC"},
+    {388, 54, "P"},
+    {389, 42, "O2"},
+    {390, 29, "OS"},
+    {391, 13, "CT"},
+    {392, 36, "HC"},
+    {393, 13, "CT"},
+    {394, 36, "HC"},
+    {395, 38, "CA"},
+    {396, 13, "CT"},
+    {397, 36, "HC"},
+    {398, 38, "CA"},
+    {399, 13, "CT"},
+    {400, 36, "HC"},
+    {401, 38, "CA"},
+    {402, 13, "CT"},
+    {403, 3, "C"},
+    {404, 4, "O"},
+    {405, 29, "OS"},
+    {406, 13, "CT"},
+    {407, 36, "HC"},
+    {408, 3, "C"},
+    {409, 3, "C"},
+    {410, 38, "CA"},
+    {411, 29, "OS"},
+    {412, 69, "SY"},
+    {413, 32, "OY"},
+    {414, 13, "CT"},
+    {415, 36, "HC"},
+    {416, 35, "N"},
+    {417, 34, "H"},
+    {418, 35, "N"},
+    {419, 34, "H"},
+    {420, 13, "CT"},
+    {421, 36, "HC"},
+    {422, 13, "CT"},
+    {423, 36, "HC"},
+    {424, 13, "CT"},
+    {425, 36, "HC"},
+    {426, 38, "CA"},
+    {427, 38, "CA"},
+    {428, 13, "CT"},
+    {429, 13, "CT"},
+    {430, 13, "CT"},
+    {431, 69, "SY"},
+    {432, 32, "OY"},
+    {433, 31, "SZ"},
+    {434, 31, "SZ"},
+    {435, 32, "OY"},
+    {436, 13, "CT"},
+    {437, 13, "CT"},
+    {438, 70, "C*"},
+    {439, 50, "CB"},
+    {440, 71, "CN"},
+    {441, 47, "NA"},
+    {442, 34, "H"},
+    {443, 13, "CT"},
+    {444, 72, "CR"},
+    {445, 73, "CV"},
+    {446, 74, "CW"},
+    {447, 72, "CR"},
+    {448, 75, "CX"},
+    {449, 51, "NB"},
+    {450, 47, "NA"},
+    {451, 34, "H"},
+    {452, 74, "CW"},
+    {453, 13, "CT"},
+    {454, 13, "CT"},
+    {455, 37, "CM"},
+    {456, 37, "CM"},
+    {457, 76, "C!"},
+    {458, 46, "NC"},
+    {459, 38, "CA"},
+    {460, 38, "CA"},
+    {461, 38, "CA"},
+    {462, 39, "HA"},
+    {463, 39, "HA"},
+    {464, 39, "HA"},
+    {465, 46, "NC"},
+    {466, 38, "CA"},
+    {467, 39, "HA"},
+    {468, 46, "NC"},
+    {469, 49, "CQ"},
+    {470, 38, "CA"},
+    {471, 38, "CA"},
+    {472, 39, "HA"},
+    {473, 39, "HA"},
+    {474, 39, "HA"},
+    {475, 46, "NC"},
+    {476, 38, "CA"},
+    {477, 38, "CA"},
+    {478, 39, "HA"},
+    {479, 39, "HA"},
+    {480, 47, "NA"},
+    {481, 74, "CW"},
+    {482, 77, "CS"},
+    {483, 34, "H"},
+    {484, 39, "HA"},
+    {485, 39, "HA"},
+    {486, 47, "NA"},
+    {487, 51, "NB"},
+    {488, 78, "CU"},
+    {489, 77, "CS"},
+    {490, 74, "CW"},
+    {491, 34, "H"},
+    {492, 39, "HA"},
+    {493, 39, "HA"},
+    {494, 39, "HA"},
+    {495, 47, "NA"},
+    {496, 72, "CR"},
+    {497, 51, "NB"},
+    {498, 73, "CV"},
+    {499, 74, "CW"},
+    {500, 34, "H"},
+    {501, 39, "HA"},
+    {502, 39, "HA"},
+    {503, 39, "HA"},
+    {504, 29, "OS"},
+    {505, 74, "CW"},
+    {506, 77, "CS"},
+    {507, 39, "HA"},
+    {508, 39, "HA"},
+    {509, 29, "OS"},
+    {510, 72, "CR"},
+    {511, 51, "NB"},
+    {512, 73, "CV"},
+    {513, 74, "CW"},
+    {514, 39, "HA"},
+    {515, 39, "HA"},
+    {516, 39, "HA"},
+    {517, 29, "OS"},
+    {518, 51, "NB"},
+    {519, 78, "CU"},
+    {520, 77, "CS"},
+    {521, 74, "CW"},
+    {522, 39, "HA"},
+    {523, 39, "HA"},
+    {524, 39, "HA"},
+    {525, 47, "NA"},
+    {526, 74, "CW"},
+    {527, 77, "CS"},
+    {528, 38, "CA"},
+    {529, 38, "CA"},
+    {530, 38, "CA"},
+    {531, 38, "CA"},
+    {532, 71, "CN"},
+    {533, 50, "CB"},
+    {534, 34, "H"},
+    {535, 39, "HA"},
+    {536, 39, "HA"},
+    {537, 39, "HA"},
+    {538, 39, "HA"},
+    {539, 39, "HA"},
+    {540, 39, "HA"},
+    {541, 46, "NC"},
+    {542, 38, "CA"},
+    {543, 38, "CA"},
+    {544, 38, "CA"},
+    {545, 38, "CA"},
+    {546, 38, "CA"},
+    {547, 38, "CA"},
+    {548, 38, "CA"},
+    {549, 38, "CA"},
+    {550, 38, "CA"},
+    {551, 39, "HA"},
+    {552, 39, "HA"},
+    {553, 39, "HA"},
+    {554, 39, "HA"},
+    {555, 39, "HA"},
+    {556, 39, "HA"},
+    {557, 39, "HA"},
+    {558, 46, "NC"},
+    {559, 49, "CQ"},
+    {560, 46, "NC"},
+    {561, 50, "CB"},
+    {562, 50, "CB"},
+    {563, 38, "CA"},
+    {564, 51, "NB"},
+    {565, 52, "CK"},
+    {566, 47, "NA"},
+    {567, 39, "HA"},
+    {568, 39, "HA"},
+    {569, 39, "HA"},
+    {570, 34, "H"},
+    {571, 16, "S"},
+    {572, 72, "CR"},
+    {573, 51, "NB"},
+    {574, 73, "CV"},
+    {575, 74, "CW"},
+    {576, 39, "HA"},
+    {577, 39, "HA"},
+    {578, 39, "HA"},
+    {579, 46, "NC"},
+    {580, 49, "CQ"},
+    {581, 39, "HA"},
+    {582, 38, "CA"},
+    {583, 13, "CT"},
+    {584, 46, "NC"},
+    {585, 38, "CA"},
+    {586, 38, "CA"},
+    {587, 38, "CA"},
+    {588, 38, "CA"},
+    {589, 38, "CA"},
+    {590, 38, "CA"},
+    {591, 39, "HA"},
+    {592, 39, "HA"},
+    {593, 39, "HA"},
+    {594, 39, "HA"},
+    {595, 47, "NA"},
+    {596, 72, "CR"},
+    {597, 51, "NB"},
+    {598, 73, "CV"},
+    {599, 74, "CW"},
+    {600, 13, "CT"},
+    {601, 39, "HA"},
+    {602, 39, "HA"},
+    {603, 39, "HA"},
+    {604, 36, "HC"},
+    {605, 13, "CT"},
+    {606, 13, "CT"},
+    {607, 13, "CT"},
+    {608, 13, "CT"},
+    {609, 13, "CT"},
+    {610, 13, "CT"},
+    {611, 13, "CT"},
+    {612, 13, "CT"},
+    {613, 13, "CT"},
+    {614, 13, "CT"},
+    {615, 13, "CT"},
+    {616, 13, "CT"},
+    {617, 13, "CT"},
+    {618, 13, "CT"},
+    {619, 13, "CT"},
+    {620, 15, "SH"},
+    {621, 17, "HS"},
+    {622, 38, "CA"},
+    {623, 79, "C$"},
+    {624, 80, "N$"},
+    {625, 81, "CY"},
+    {626, 81, "CY"},
+    {627, 13, "CT"},
+    {628, 76, "C!"},
+    {629, 76, "C!"},
+    {630, 76, "C!"},
+    {631, 76, "C!"},
+    {632, 76, "C!"},
+    {633, 76, "C!"},
+    {634, 16, "S"},
+    {635, 82, "Ac"},
+    {636, 83, "Th"},
+    {637, 84, "Am"},
+    {638, 85, "C+"},
+    {639, 13, "CT"},
+    {640, 36, "HC"},
+    {641, 86, "La"},
+    {642, 87, "Nd"},
+    {643, 88, "Eu"},
+    {644, 89, "Gd"},
+    {645, 90, "Yb"},
+    {646, 37, "CM"},
+    {647, 30, "Cl"},
+    {648, 36, "HC"},
+    {649, 81, "CY"},
+    {650, 81, "CY"},
+    {651, 81, "CY"},
+    {652, 38, "CA"},
+    {653, 39, "HA"},
+    {654, 38, "CA"},
+    {655, 39, "HA"},
+    {656, 38, "CA"},
+    {657, 1, "F"},
+    {658, 38, "CA"},
+    {659, 1, "F"},
+    {660, 55, "Br"},
+    {661, 2, "C2"},
+    {662, 38, "CA"},
+    {663, 13, "CT"},
+    {664, 1, "F"},
+    {665, 38, "CA"},
+    {666, 1, "F"},
+    {667, 38, "CA"},
+    {668, 55, "Br"},
+    {669, 38, "CA"},
+    {670, 56, "I"},
+    {671, 81, "CY"},
+    {672, 15, "SH"},
+    {673, 38, "CA"},
+    {674, 38, "CA"},
+    {675, 38, "CA"},
+    {676, 38, "CA"},
+    {677, 38, "CA"},
+    {678, 39, "HA"},
+    {679, 39, "HA"},
+    {680, 38, "CA"},
+    {681, 45, "N2"},
+    {682, 34, "H"},
+    {683, 34, "H"},
+    {684, 39, "HA"},
+    {685, 13, "CT"},
+    {686, 13, "CT"},
+    {687, 91, "NY"},
+    {688, 46, "NC"},
+    {689, 91, "NY"},
+    {690, 38, "CA"},
+    {691, 18, "NZ"},
+    {692, 19, "CZ"},
+    {693, 13, "CT"},
+    {694, 13, "CT"},
+    {695, 13, "CT"},
+    {696, 13, "CT"},
+    {697, 36, "HC"},
+    {698, 92, "NO"},
+    {699, 93, "ON"},
+    {700, 13, "CT"},
+    {701, 36, "HC"},
+    {702, 13, "CT"},
+    {703, 13, "CT"},
+    {704, 13, "CT"},
+    {705, 92, "NO"},
+    {706, 38, "CA"},
+    {707, 13, "CT"},
+    {708, 46, "NC"},
+    {709, 4, "O"},
+    {710, 3, "C"},
+    {711, 29, "OS"},
+    {712, 13, "CT"},
+    {713, 13, "CT"},
+    {714, 13, "CT"},
+    {715, 36, "HC"},
+    {716, 36, "HC"},
+    {717, 36, "HC"},
+    {718, 29, "OS"},
+    {719, 94, "P+"},
+    {720, 13, "CT"},
+    {721, 13, "CT"},
+    {722, 36, "HC"},
+    {723, 54, "P"},
+    {724, 1, "F"},
+    {725, 35, "N"},
+    {726, 4, "O"},
+    {727, 20, "OW"},
+    {728, 21, "HW"},
+    {729, 22, "LP"},
+    {730, 33, "NT"},
+    {731, 33, "NT"},
+    {732, 33, "NT"},
+    {733, 13, "CT"},
+    {734, 13, "CT"},
+    {735, 13, "CT"},
+    {736, 13, "CT"},
+    {737, 13, "CT"},
+    {738, 13, "CT"},
+    {739, 34, "H"},
+    {740, 34, "H"},
+    {741, 36, "HC"},
+    {742, 13, "CT"},
+    {743, 13, "CT"},
+    {744, 13, "CT"},
+    {745, 13, "CT"},
+    {746, 38, "CA"},
+    {747, 38, "CA"},
+    {748, 38, "CA"},
+    {749, 13, "CT"},
+    {750, 13, "CT"},
+    {751, 13, "CT"},
+    {752, 13, "CT"},
+    {753, 13, "CT"},
+    {754, 13, "CT"},
+    {755, 19, "CZ"},
+    {756, 36, "HC"},
+    {757, 19, "CZ"},
+    {758, 19, "CZ"},
+    {759, 19, "CZ"},
+    {760, 36, "HC"},
+    {761, 41, "CO"},
+    {762, 41, "CO"},
+    {763, 41, "CO"},
+    {764, 5, "OH"},
+    {765, 7, "HO"},
+    {766, 95, "N*"},
+    {767, 95, "N*"},
+    {768, 95, "N*"},
+    {769, 19, "CZ"},
+    {770, 43, "N3"},
+    {771, 44, "H3"},
+    {772, 13, "CT"},
+    {773, 13, "CT"},
+    {774, 13, "CT"},
+    {775, 13, "CT"},
+    {776, 74, "CW"},
+    {777, 77, "CS"},
+    {778, 76, "C!"},
+    {779, 76, "C!"},
+    {780, 36, "HC"},
+    {781, 13, "CT"},
+    {782, 3, "C"},
+    {783, 43, "N3"},
+    {784, 42, "O2"},
+    {785, 44, "H3"},
+    {786, 1, "F"},
+    {787, 13, "CT"},
+    {788, 36, "HC"},
+    {789, 13, "CT"},
+    {790, 13, "CT"},
+    {791, 13, "CT"},
+    {792, 13, "CT"},
+    {793, 13, "CT"},
+    {794, 13, "CT"},
+    {795, 1, "F"},
+    {796, 13, "CT"},
+    {797, 36, "HC"},
+    {798, 13, "CT"},
+    {799, 13, "CT"},
+    {800, 30, "Cl"},
+    {801, 13, "CT"},
+    {802, 36, "HC"},
+    {803, 13, "CT"},
+    {804, 13, "CT"},
+    {805, 55, "Br"},
+    {806, 13, "CT"},
+    {807, 36, "HC"},
+    {808, 13, "CT"},
+    {809, 13, "CT"},
+    {810, 1, "F"},
+    {811, 30, "Cl"},
+    {812, 55, "Br"},
+    {813, 38, "CA"},
+    {814, 29, "OS"},
+    {815, 13, "CT"},
+    {816, 1, "F"},
+    {817, 35, "N"},
+    {818, 38, "CA"},
+    {819, 13, "CT"},
+    {820, 3, "C"},
+    {821, 3, "C"},
+    {822, 4, "O"},
+    {823, 35, "N"},
+    {824, 34, "H"},
+    {825, 5, "OH"},
+    {826, 7, "HO"},
+    {827, 13, "CT"},
+    {828, 13, "CT"},
+    {829, 76, "C!"},
+    {830, 76, "C!"},
+    {831, 76, "C!"},
+    {832, 76, "C!"},
+    {833, 38, "CA"},
+    {834, 96, "Zn"},
+    {835, 13, "CT"},
+    {836, 13, "CT"},
+    {837, 13, "CT"},
+    {838, 56, "I"},
+    {839, 36, "HC"},
+    {840, 35, "N"},
+    {841, 38, "CA"},
+    {842, 38, "CA"},
+    {843, 35, "N"},
+    {844, 38, "CA"},
+    {845, 3, "C"},
+    {846, 4, "O"},
+    {847, 97, "NM"},
+    {848, 13, "CT"},
+    {849, 13, "CT"},
+    {850, 13, "CT"},
+    {851, 13, "CT"},
+    {852, 36, "HC"},
+    {853, 3, "C"},
+    {854, 4, "O"},
+    {855, 36, "HC"},
+    {856, 13, "CT"},
+    {857, 13, "CT"},
+    {858, 13, "CT"},
+    {859, 13, "CT"},
+    {860, 13, "CT"},
+    {861, 13, "CT"},
+    {862, 13, "CT"},
+    {863, 13, "CT"},
+    {864, 13, "CT"},
+    {865, 13, "CT"},
+    {866, 98, "Si"},
+    {867, 98, "Si"},
+    {868, 98, "Si"},
+    {869, 98, "Si"},
+    {870, 34, "H"},
+    {871, 13, "CT"},
+    {872, 13, "CT"},
+    {873, 13, "CT"},
+    {874, 13, "CT"},
+    {875, 1, "F"},
+    {876, 30, "Cl"},
+    {877, 55, "Br"},
+    {878, 56, "I"},
+    {879, 58, "Li"},
+    {880, 59, "Na"},
+    {881, 60, "K"},
+    {882, 61, "Rb"},
+    {883, 62, "Cs"},
+    {884, 63, "Mg"},
+    {885, 64, "Ca"},
+    {886, 65, "Sr"},
+    {887, 66, "Ba"},
+    {888, 13, "CT"},
+    {889, 13, "CT"},
+    {890, 13, "CT"},
+    {891, 13, "CT"},
+    {892, 36, "HC"},
+    {893, 43, "N3"},
+    {894, 38, "CA"},
+    {895, 43, "N3"},
+    {896, 38, "CA"},
+    {897, 99, "C#"},
+    {898, 99, "C#"},
+    {899, 36, "HC"},
+    {900, 37, "CM"},
+    {901, 37, "CM"},
+    {902, 37, "CM"},
+    {903, 100, "C:"},
+    {904, 100, "C:"},
+    {905, 4, "O"},
+    {906, 13, "CT"},
+};
+
+const OplsBondStrechParameters BondStrechParameters[] = {
+    {1, 2, 367.00, 1.3800},
+    {1, 3, 420.00, 1.3570},
+    {1, 13, 367.00, 1.3600},
+    {1, 19, 450.00, 1.2790},
+    {1, 23, 300.00, 0.3000},
+    {1, 37, 420.00, 1.3400},
+    {1, 38, 420.00, 1.3540},
+    {1, 72, 420.00, 1.3540},
+    {1, 73, 420.00, 1.3540},
+    {1, 74, 420.00, 1.3540},
+    {1, 77, 420.00, 1.3540},
+    {1, 78, 420.00, 1.3540},
+    {1, 98, 461.00, 1.5700},
+    {2, 2, 260.00, 1.5260},
+    {2, 3, 317.00, 1.5220},
+    {2, 5, 386.00, 1.4250},
+    {2, 6, 260.00, 1.5260},
+    {2, 10, 260.00, 1.5260},
+    {2, 11, 317.00, 1.5000},
+    {2, 12, 317.00, 1.5100},
+    {2, 13, 260.00, 1.5260},
+    {2, 14, 317.00, 1.5000},
+    {2, 15, 222.00, 1.8100},
+    {2, 16, 222.00, 1.8100},
+    {2, 29, 320.00, 1.4250},
+    {2, 33, 382.00, 1.4480},
+    {2, 35, 337.00, 1.4490},
+    {2, 38, 317.00, 1.5100},
+    {2, 41, 260.00, 1.5260},
+    {2, 43, 367.00, 1.4710},
+    {2, 45, 337.00, 1.4630},
+    {2, 70, 317.00, 1.4950},
+    {3, 3, 350.00, 1.5100},
+    {3, 4, 570.00, 1.2290},
+    {3, 5, 450.00, 1.3640},
+    {3, 6, 317.00, 1.5220},
+    {3, 10, 317.00, 1.5220},
+    {3, 12, 469.00, 1.4000},
+    {3, 13, 317.00, 1.5220},
+    {3, 19, 400.00, 1.4440},
+    {3, 29, 214.00, 1.3270},
+    {3, 30, 300.00, 1.7900},
+    {3, 33, 317.00, 1.5220},
+    {3, 35, 490.00, 1.3350},
+    {3, 36, 340.00, 1.0900},
+    {3, 37, 410.00, 1.4440},
+    {3, 38, 400.00, 1.4900},
+    {3, 40, 385.00, 1.4600},
+    {3, 42, 656.00, 1.2500},
+    {3, 46, 457.00, 1.3580},
+    {3, 47, 418.00, 1.3880},
+    {3, 50, 447.00, 1.4190},
+    {3, 55, 300.00, 1.9800},
+    {3, 74, 400.00, 1.4900},
+    {3, 76, 385.00, 1.4600},
+    {3, 95, 424.00, 1.3830},
+    {3, 97, 490.00, 1.3350},
+    {4, 23, 553.00, 0.3000},
+    {4, 54, 525.00, 1.4800},
+    {4, 79, 570.00, 1.2290},
+    {4, 100, 700.00, 1.1710},
+    {5, 6, 386.00, 1.4250},
+    {5, 7, 553.00, 0.9450},
+    {5, 10, 386.00, 1.4250},
+    {5, 13, 320.00, 1.4100},
+    {5, 23, 340.00, 0.3000},
+    {5, 29, 250.00, 1.4700},
+    {5, 33, 320.00, 1.4500},
+    {5, 35, 400.00, 1.3800},
+    {5, 37, 450.00, 1.3700},
+    {5, 38, 450.00, 1.3640},
+    {5, 41, 320.00, 1.3800},
+    {5, 54, 230.00, 1.6100},
+    {5, 69, 450.00, 1.6700},
+    {5, 96, 94.00, 1.8000},
+    {5, 98, 374.00, 1.6400},
+    {6, 6, 260.00, 1.5260},
+    {6, 10, 260.00, 1.5260},
+    {6, 11, 317.00, 1.5000},
+    {6, 13, 260.00, 1.5260},
+    {6, 14, 317.00, 1.5000},
+    {6, 15, 222.00, 1.8100},
+    {6, 16, 222.00, 1.8100},
+    {6, 29, 320.00, 1.4250},
+    {6, 33, 382.00, 1.4480},
+    {6, 35, 337.00, 1.4490},
+    {6, 37, 317.00, 1.5100},
+    {6, 41, 260.00, 1.5260},
+    {6, 43, 367.00, 1.4710},
+    {6, 45, 337.00, 1.4630},
+    {6, 69, 222.00, 1.8100},
+    {6, 95, 337.00, 1.4750},
+    {7, 23, 340.00, 0.1000},
+    {7, 29, 553.00, 0.9450},
+    {9, 9, 530.00, 1.3400},
+    {9, 11, 530.00, 1.3400},
+    {9, 14, 530.00, 1.3400},
+    {10, 10, 260.00, 1.5260},
+    {10, 11, 317.00, 1.5000},
+    {10, 14, 317.00, 1.5000},
+    {10, 29, 320.00, 1.4250},
+    {10, 33, 382.00, 1.4480},
+    {10, 35, 337.00, 1.4490},
+    {10, 95, 337.00, 1.4750},
+    {11, 11, 530.00, 1.3400},
+    {11, 13, 317.00, 1.5000},
+    {11, 14, 530.00, 1.3400},
+    {11, 69, 222.00, 1.7600},
+    {12, 12, 469.00, 1.4000},
+    {12, 38, 469.00, 1.4000},
+    {12, 50, 469.00, 1.4000},
+    {12, 71, 469.00, 1.4000},
+    {13, 13, 268.00, 1.5290},
+    {13, 14, 317.00, 1.5000},
+    {13, 15, 222.00, 1.8100},
+    {13, 16, 222.00, 1.8100},
+    {13, 18, 390.00, 1.4300},
+    {13, 19, 390.00, 1.4700},
+    {13, 23, 340.00, 0.3000},
+    {13, 29, 320.00, 1.4100},
+    {13, 30, 245.00, 1.7810},
+    {13, 31, 340.00, 1.7900},
+    {13, 33, 382.00, 1.4480},
+    {13, 35, 337.00, 1.4490},
+    {13, 36, 340.00, 1.0900},
+    {13, 37, 317.00, 1.5100},
+    {13, 38, 317.00, 1.5100},
+    {13, 40, 317.00, 1.5100},
+    {13, 41, 268.00, 1.5290},
+    {13, 43, 367.00, 1.4710},
+    {13, 45, 337.00, 1.4630},
+    {13, 46, 337.00, 1.4490},
+    {13, 47, 337.00, 1.4750},
+    {13, 50, 317.00, 1.5100},
+    {13, 54, 212.00, 1.8430},
+    {13, 55, 245.00, 1.9450},
+    {13, 56, 200.00, 2.1900},
+    {13, 69, 340.00, 1.7700},
+    {13, 70, 317.00, 1.4950},
+    {13, 73, 317.00, 1.5040},
+    {13, 74, 317.00, 1.5040},
+    {13, 75, 317.00, 1.5040},
+    {13, 77, 317.00, 1.4950},
+    {13, 80, 337.00, 1.4490},
+    {13, 81, 280.00, 1.5100},
+    {13, 85, 532.80, 1.4600},
+    {13, 91, 382.00, 1.4480},
+    {13, 92, 375.00, 1.4900},
+    {13, 94, 212.00, 1.8200},
+    {13, 95, 337.00, 1.4750},
+    {13, 97, 337.00, 1.4490},
+    {13, 98, 187.00, 1.8600},
+    {13, 99, 317.00, 1.5100},
+    {14, 14, 530.00, 1.3400},
+    {15, 17, 274.00, 1.3360},
+    {15, 38, 250.00, 1.7400},
+    {16, 16, 166.00, 2.0380},
+    {16, 19, 300.00, 1.6850},
+    {16, 23, 340.00, 0.5000},
+    {16, 35, 250.00, 1.7300},
+    {16, 37, 250.00, 1.7600},
+    {16, 38, 250.00, 1.7600},
+    {16, 51, 250.00, 1.7300},
+    {16, 72, 250.00, 1.7600},
+    {16, 74, 250.00, 1.7400},
+    {16, 81, 222.00, 1.8100},
+    {16, 98, 144.00, 2.1500},
+    {17, 23, 340.00, 0.1000},
+    {18, 18, 550.00, 1.1200},
+    {18, 19, 650.00, 1.1570},
+    {18, 38, 400.00, 1.4100},
+    {18, 46, 550.00, 1.2400},
+    {19, 19, 1150.00, 1.2100},
+    {19, 30, 330.00, 1.6370},
+    {19, 36, 420.00, 1.0800},
+    {19, 37, 400.00, 1.4260},
+    {19, 38, 400.00, 1.4510},
+    {19, 40, 400.00, 1.4260},
+    {19, 55, 330.00, 1.7840},
+    {19, 78, 400.00, 1.4510},
+    {19, 81, 400.00, 1.4510},
+    {20, 21, 600.00, 0.9572},
+    {20, 22, 900.00, 0.1750},
+    {20, 96, 40.00, 2.0500},
+    {23, 23, 340.00, 0.3000},
+    {23, 29, 340.00, 0.3000},
+    {23, 30, 300.00, 0.3000},
+    {23, 31, 340.00, 0.5000},
+    {23, 32, 340.00, 0.3000},
+    {23, 33, 340.00, 0.3000},
+    {23, 34, 340.00, 0.1000},
+    {23, 35, 367.00, 0.3000},
+    {23, 36, 340.00, 0.3000},
+    {23, 37, 340.00, 0.3000},
+    {23, 38, 367.00, 0.3000},
+    {23, 39, 340.00, 0.3000},
+    {23, 43, 340.00, 0.3000},
+    {23, 46, 367.00, 0.3000},
+    {23, 51, 367.00, 0.3000},
+    {23, 55, 300.00, 0.3000},
+    {23, 93, 340.00, 0.1000},
+    {29, 29, 250.00, 1.4700},
+    {29, 30, 200.00, 1.6900},
+    {29, 33, 320.00, 1.4500},
+    {29, 35, 320.00, 1.4500},
+    {29, 37, 450.00, 1.3700},
+    {29, 38, 450.00, 1.3640},
+    {29, 41, 320.00, 1.3800},
+    {29, 50, 340.00, 1.3600},
+    {29, 51, 462.00, 1.3990},
+    {29, 54, 230.00, 1.6100},
+    {29, 72, 462.00, 1.3570},
+    {29, 74, 340.00, 1.3600},
+    {29, 98, 374.00, 1.6400},
+    {30, 37, 300.00, 1.7250},
+    {30, 38, 300.00, 1.7250},
+    {30, 72, 300.00, 1.7250},
+    {30, 73, 300.00, 1.7250},
+    {30, 74, 300.00, 1.7250},
+    {30, 77, 300.00, 1.7250},
+    {30, 78, 300.00, 1.7250},
+    {30, 98, 223.00, 2.0200},
+    {31, 32, 700.00, 1.5300},
+    {32, 69, 700.00, 1.4400},
+    {33, 33, 350.00, 1.4450},
+    {33, 34, 434.00, 1.0100},
+    {33, 38, 481.00, 1.3400},
+    {33, 69, 340.00, 1.7700},
+    {33, 81, 382.00, 1.4480},
+    {33, 98, 266.00, 1.7400},
+    {34, 35, 434.00, 1.0100},
+    {34, 43, 434.00, 1.0100},
+    {34, 45, 434.00, 1.0100},
+    {34, 46, 434.00, 1.0100},
+    {34, 47, 434.00, 1.0100},
+    {34, 91, 434.00, 1.0100},
+    {34, 95, 434.00, 1.0100},
+    {34, 98, 166.00, 1.4800},
+    {35, 38, 427.00, 1.3810},
+    {35, 49, 427.00, 1.3810},
+    {35, 69, 434.00, 1.6700},
+    {35, 74, 427.00, 1.3810},
+    {35, 78, 427.00, 1.3810},
+    {35, 81, 337.00, 1.4490},
+    {35, 93, 500.00, 1.2700},
+    {35, 96, 40.00, 2.0500},
+    {36, 37, 340.00, 1.0800},
+    {36, 40, 340.00, 1.0800},
+    {36, 41, 340.00, 1.0900},
+    {36, 70, 340.00, 1.0800},
+    {36, 81, 340.00, 1.0880},
+    {36, 85, 532.80, 1.0840},
+    {36, 98, 166.00, 1.4800},
+    {36, 99, 340.00, 1.0800},
+    {37, 37, 549.00, 1.3400},
+    {37, 38, 427.00, 1.4330},
+    {37, 40, 549.00, 1.3400},
+    {37, 47, 448.00, 1.3650},
+    {37, 48, 367.00, 1.0800},
+    {37, 55, 300.00, 1.9000},
+    {37, 56, 250.00, 2.0800},
+    {37, 76, 385.00, 1.4600},
+    {37, 81, 317.00, 1.5100},
+    {37, 95, 448.00, 1.3650},
+    {37, 100, 700.00, 1.3050},
+    {38, 38, 469.00, 1.4000},
+    {38, 39, 367.00, 1.0800},
+    {38, 40, 427.00, 1.4330},
+    {38, 43, 400.00, 1.4500},
+    {38, 45, 481.00, 1.3400},
+    {38, 46, 483.00, 1.3390},
+    {38, 47, 427.00, 1.3810},
+    {38, 50, 469.00, 1.4040},
+    {38, 51, 414.00, 1.3910},
+    {38, 54, 220.00, 1.7800},
+    {38, 55, 300.00, 1.8700},
+    {38, 56, 250.00, 2.0800},
+    {38, 69, 340.00, 1.7700},
+    {38, 71, 469.00, 1.4000},
+    {38, 74, 546.00, 1.3670},
+    {38, 76, 469.00, 1.4000},
+    {38, 78, 469.00, 1.4210},
+    {38, 81, 317.00, 1.4900},
+    {38, 91, 382.00, 1.3850},
+    {38, 92, 400.00, 1.4600},
+    {38, 99, 427.00, 1.4330},
+    {39, 49, 367.00, 1.0800},
+    {39, 52, 340.00, 1.0800},
+    {39, 72, 367.00, 1.0800},
+    {39, 73, 367.00, 1.0800},
+    {39, 74, 367.00, 1.0800},
+    {39, 75, 367.00, 1.0800},
+    {39, 77, 367.00, 1.0800},
+    {39, 78, 367.00, 1.0800},
+    {40, 40, 385.00, 1.4600},
+    {40, 46, 457.00, 1.2900},
+    {40, 74, 549.00, 1.3650},
+    {40, 99, 385.00, 1.4600},
+    {41, 95, 337.00, 1.4750},
+    {42, 54, 525.00, 1.4800},
+    {43, 44, 434.00, 1.0100},
+    {44, 45, 434.00, 1.0100},
+    {45, 49, 481.00, 1.3400},
+    {45, 72, 481.00, 1.3400},
+    {46, 46, 500.00, 1.3200},
+    {46, 49, 502.00, 1.3240},
+    {46, 50, 461.00, 1.3540},
+    {46, 72, 461.00, 1.3540},
+    {46, 76, 483.00, 1.3390},
+    {46, 93, 550.00, 1.2100},
+    {46, 99, 457.00, 1.2900},
+    {47, 50, 436.00, 1.3740},
+    {47, 51, 400.00, 1.3490},
+    {47, 52, 440.00, 1.3710},
+    {47, 71, 428.00, 1.3800},
+    {47, 72, 477.00, 1.3430},
+    {47, 74, 427.00, 1.3810},
+    {47, 75, 427.00, 1.3810},
+    {47, 76, 385.00, 1.4400},
+    {48, 73, 367.00, 1.0800},
+    {48, 74, 367.00, 1.0800},
+    {49, 53, 367.00, 1.0800},
+    {50, 50, 520.00, 1.3700},
+    {50, 51, 414.00, 1.3910},
+    {50, 70, 388.00, 1.4590},
+    {50, 71, 447.00, 1.4190},
+    {50, 77, 469.00, 1.4240},
+    {50, 95, 436.00, 1.3740},
+    {51, 51, 400.00, 1.2800},
+    {51, 52, 529.00, 1.3040},
+    {51, 72, 488.00, 1.3350},
+    {51, 73, 410.00, 1.3940},
+    {51, 74, 410.00, 1.3940},
+    {51, 78, 410.00, 1.3200},
+    {52, 53, 367.00, 1.0800},
+    {52, 95, 440.00, 1.3710},
+    {53, 72, 367.00, 1.0800},
+    {54, 98, 108.00, 2.2500},
+    {55, 72, 300.00, 1.8700},
+    {55, 73, 300.00, 1.8700},
+    {55, 74, 300.00, 1.8700},
+    {55, 77, 300.00, 1.8700},
+    {55, 78, 300.00, 1.8700},
+    {55, 98, 151.00, 2.1900},
+    {56, 72, 250.00, 2.0800},
+    {56, 73, 250.00, 2.0800},
+    {56, 74, 250.00, 2.0800},
+    {56, 77, 250.00, 2.0800},
+    {56, 78, 250.00, 2.0800},
+    {56, 98, 108.00, 2.4400},
+    {67, 68, 500.00, 1.8000},
+    {70, 74, 546.00, 1.3520},
+    {72, 76, 385.00, 1.4600},
+    {72, 77, 520.00, 1.3700},
+    {73, 74, 520.00, 1.3700},
+    {73, 76, 385.00, 1.4600},
+    {74, 74, 512.00, 1.3750},
+    {74, 76, 385.00, 1.4600},
+    {74, 77, 546.00, 1.3670},
+    {74, 78, 520.00, 1.3700},
+    {75, 75, 520.00, 1.3700},
+    {76, 76, 385.00, 1.4600},
+    {76, 77, 385.00, 1.4600},
+    {76, 78, 385.00, 1.4600},
+    {77, 77, 469.00, 1.4240},
+    {77, 78, 469.00, 1.4240},
+    {79, 80, 490.00, 1.3350},
+    {79, 81, 317.00, 1.5220},
+    {80, 81, 337.00, 1.4490},
+    {81, 81, 260.00, 1.5200},
+    {92, 93, 550.00, 1.2250},
+    {98, 98, 94.00, 2.3200},
+    {99, 99, 549.00, 1.3450},
+};
+
+const OplsAngleBendParameters AngleBendParameters[] = {
+    {1, 2, 2, 50.00, 109.50},
+    {1, 3, 4, 80.00, 121.00},
+    {1, 3, 13, 80.00, 111.00},
+    {1, 13, 1, 77.00, 109.10},
+    {1, 13, 3, 50.00, 109.50},
+    {1, 13, 13, 50.00, 109.50},
+    {1, 13, 36, 40.00, 107.00},
+    {1, 13, 37, 50.00, 109.50},
+    {1, 13, 38, 50.00, 109.50},
+    {1, 13, 69, 50.00, 109.50},
+    {1, 37, 1, 80.00, 108.00},
+    {1, 37, 3, 80.00, 121.50},
+    {1, 37, 36, 50.00, 112.00},
+    {1, 37, 37, 80.00, 121.50},
+    {1, 37, 100, 80.00, 125.00},
+    {1, 38, 38, 80.00, 120.00},
+    {1, 98, 13, 35.00, 110.50},
+    {2, 2, 2, 63.00, 112.40},
+    {2, 2, 3, 63.00, 112.40},
+    {2, 2, 5, 80.00, 109.50},
+    {2, 2, 6, 63.00, 112.40},
+    {2, 2, 10, 63.00, 112.40},
+    {2, 2, 16, 50.00, 114.70},
+    {2, 2, 29, 80.00, 109.50},
+    {2, 2, 33, 56.20, 109.47},
+    {2, 2, 35, 80.00, 111.20},
+    {2, 2, 38, 63.00, 112.40},
+    {2, 2, 41, 63.00, 112.40},
+    {2, 2, 43, 80.00, 111.20},
+    {2, 2, 45, 80.00, 111.20},
+    {2, 3, 4, 80.00, 120.40},
+    {2, 3, 35, 70.00, 116.60},
+    {2, 3, 42, 70.00, 117.00},
+    {2, 5, 7, 55.00, 108.50},
+    {2, 10, 2, 63.00, 112.40},
+    {2, 10, 3, 63.00, 111.10},
+    {2, 10, 5, 80.00, 109.50},
+    {2, 10, 6, 63.00, 112.40},
+    {2, 10, 10, 63.00, 111.50},
+    {2, 10, 29, 80.00, 109.50},
+    {2, 10, 33, 56.20, 109.47},
+    {2, 10, 35, 80.00, 109.70},
+    {2, 10, 38, 63.00, 112.40},
+    {2, 10, 95, 80.00, 109.50},
+    {2, 11, 2, 70.00, 124.00},
+    {2, 11, 6, 70.00, 124.00},
+    {2, 11, 9, 70.00, 118.00},
+    {2, 11, 10, 70.00, 124.00},
+    {2, 11, 11, 70.00, 118.00},
+    {2, 11, 13, 70.00, 124.00},
+    {2, 12, 12, 70.00, 120.00},
+    {2, 13, 2, 40.00, 109.50},
+    {2, 13, 3, 63.00, 111.10},
+    {2, 13, 6, 40.00, 109.50},
+    {2, 13, 33, 56.20, 109.47},
+    {2, 13, 35, 80.00, 109.70},
+    {2, 13, 36, 35.00, 109.50},
+    {2, 13, 38, 63.00, 114.00},
+    {2, 14, 2, 70.00, 124.00},
+    {2, 14, 6, 70.00, 124.00},
+    {2, 14, 9, 70.00, 118.00},
+    {2, 14, 10, 70.00, 124.00},
+    {2, 14, 11, 70.00, 118.00},
+    {2, 14, 13, 70.00, 124.00},
+    {2, 14, 14, 70.00, 118.00},
+    {2, 15, 17, 44.00, 96.00},
+    {2, 15, 22, 150.00, 96.70},
+    {2, 16, 6, 62.00, 98.90},
+    {2, 16, 16, 68.00, 103.70},
+    {2, 16, 22, 150.00, 96.70},
+    {2, 29, 2, 100.00, 111.80},
+    {2, 29, 3, 83.00, 116.90},
+    {2, 29, 6, 100.00, 111.80},
+    {2, 29, 7, 55.00, 108.50},
+    {2, 29, 38, 100.00, 111.80},
+    {2, 29, 41, 100.00, 113.00},
+    {2, 29, 54, 100.00, 120.50},
+    {2, 33, 2, 51.80, 107.20},
+    {2, 33, 6, 51.80, 107.20},
+    {2, 33, 10, 51.80, 107.20},
+    {2, 33, 13, 51.80, 107.20},
+    {2, 33, 34, 43.20, 108.10},
+    {2, 35, 3, 50.00, 121.90},
+    {2, 35, 6, 50.00, 121.90},
+    {2, 35, 10, 50.00, 118.00},
+    {2, 35, 34, 38.00, 118.40},
+    {2, 38, 12, 70.00, 120.00},
+    {2, 38, 38, 70.00, 120.00},
+    {2, 38, 50, 70.00, 128.60},
+    {2, 41, 29, 80.00, 109.50},
+    {2, 43, 44, 35.00, 109.50},
+    {2, 45, 38, 50.00, 123.20},
+    {2, 45, 44, 35.00, 118.40},
+    {2, 70, 50, 70.00, 128.60},
+    {2, 70, 74, 70.00, 125.00},
+    {2, 77, 74, 70.00, 125.00},
+    {3, 2, 10, 63.00, 112.40},
+    {3, 2, 33, 80.00, 111.20},
+    {3, 2, 35, 80.00, 110.30},
+    {3, 3, 4, 80.00, 121.40},
+    {3, 3, 13, 80.00, 117.20},
+    {3, 3, 35, 70.00, 116.60},
+    {3, 4, 23, 35.00, 113.00},
+    {3, 5, 7, 35.00, 113.00},
+    {3, 10, 6, 63.00, 111.10},
+    {3, 10, 10, 63.00, 111.10},
+    {3, 10, 33, 80.00, 109.70},
+    {3, 10, 35, 63.00, 110.10},
+    {3, 12, 12, 85.00, 120.00},
+    {3, 13, 3, 63.00, 111.10},
+    {3, 13, 6, 63.00, 109.50},
+    {3, 13, 13, 63.00, 111.10},
+    {3, 13, 29, 50.00, 109.50},
+    {3, 13, 30, 69.00, 109.80},
+    {3, 13, 33, 80.00, 111.20},
+    {3, 13, 35, 63.00, 110.10},
+    {3, 13, 36, 35.00, 109.50},
+    {3, 13, 38, 63.00, 112.00},
+    {3, 13, 43, 80.00, 111.20},
+    {3, 13, 46, 63.00, 110.10},
+    {3, 13, 55, 69.00, 109.80},
+    {3, 13, 80, 80.00, 113.00},
+    {3, 29, 6, 83.00, 116.90},
+    {3, 29, 10, 83.00, 116.90},
+    {3, 29, 13, 83.00, 116.90},
+    {3, 29, 38, 83.00, 116.90},
+    {3, 33, 13, 63.00, 111.10},
+    {3, 33, 38, 63.00, 112.00},
+    {3, 35, 3, 70.00, 126.40},
+    {3, 35, 5, 46.00, 115.70},
+    {3, 35, 6, 50.00, 121.90},
+    {3, 35, 10, 50.00, 121.90},
+    {3, 35, 13, 50.00, 121.90},
+    {3, 35, 16, 70.00, 112.00},
+    {3, 35, 23, 10.00, 109.50},
+    {3, 35, 29, 70.00, 108.60},
+    {3, 35, 34, 35.00, 119.80},
+    {3, 35, 38, 50.00, 121.90},
+    {3, 35, 49, 70.00, 125.20},
+    {3, 35, 81, 55.00, 128.00},
+    {3, 35, 96, 20.00, 126.00},
+    {3, 37, 6, 85.00, 119.70},
+    {3, 37, 13, 70.00, 119.70},
+    {3, 37, 36, 35.00, 119.70},
+    {3, 37, 37, 85.00, 120.70},
+    {3, 37, 81, 70.00, 119.70},
+    {3, 38, 13, 70.00, 119.70},
+    {3, 38, 38, 85.00, 120.00},
+    {3, 38, 39, 35.00, 120.00},
+    {3, 40, 37, 70.00, 118.70},
+    {3, 46, 13, 70.00, 120.50},
+    {3, 46, 38, 70.00, 120.50},
+    {3, 47, 3, 70.00, 126.40},
+    {3, 47, 34, 35.00, 116.80},
+    {3, 47, 37, 70.00, 121.60},
+    {3, 47, 38, 70.00, 125.20},
+    {3, 50, 50, 85.00, 119.20},
+    {3, 50, 51, 70.00, 130.00},
+    {3, 50, 74, 70.00, 130.00},
+    {3, 74, 47, 85.00, 120.00},
+    {3, 74, 77, 85.00, 120.00},
+    {3, 77, 74, 70.00, 130.00},
+    {3, 95, 10, 70.00, 117.60},
+    {3, 95, 13, 70.00, 117.60},
+    {3, 95, 34, 35.00, 119.20},
+    {3, 95, 37, 70.00, 121.60},
+    {3, 95, 41, 70.00, 117.60},
+    {3, 97, 13, 50.00, 121.90},
+    {4, 3, 4, 80.00, 126.00},
+    {4, 3, 5, 80.00, 121.00},
+    {4, 3, 6, 80.00, 120.40},
+    {4, 3, 10, 80.00, 120.40},
+    {4, 3, 13, 80.00, 120.40},
+    {4, 3, 29, 83.00, 123.40},
+    {4, 3, 30, 75.00, 119.00},
+    {4, 3, 33, 80.00, 120.40},
+    {4, 3, 35, 80.00, 122.90},
+    {4, 3, 36, 35.00, 123.00},
+    {4, 3, 37, 80.00, 125.30},
+    {4, 3, 38, 80.00, 120.40},
+    {4, 3, 40, 80.00, 124.00},
+    {4, 3, 42, 80.00, 126.00},
+    {4, 3, 46, 80.00, 122.50},
+    {4, 3, 47, 80.00, 120.60},
+    {4, 3, 50, 80.00, 128.80},
+    {4, 3, 55, 75.00, 119.00},
+    {4, 3, 74, 80.00, 120.40},
+    {4, 3, 77, 80.00, 128.20},
+    {4, 3, 95, 80.00, 120.90},
+    {4, 3, 97, 80.00, 122.90},
+    {4, 54, 5, 100.00, 108.23},
+    {4, 54, 13, 45.00, 109.50},
+    {4, 54, 29, 100.00, 108.23},
+    {4, 54, 38, 45.00, 109.50},
+    {4, 79, 80, 80.00, 134.00},
+    {4, 79, 81, 80.00, 134.00},
+    {4, 96, 35, 20.00, 109.50},
+    {4, 100, 37, 160.00, 180.00},
+    {5, 2, 6, 80.00, 109.50},
+    {5, 2, 10, 80.00, 109.50},
+    {5, 3, 10, 70.00, 115.00},
+    {5, 3, 12, 70.00, 120.00},
+    {5, 3, 13, 70.00, 108.00},
+    {5, 3, 36, 40.00, 115.00},
+    {5, 3, 38, 70.00, 120.00},
+    {5, 7, 23, 10.00, 109.47},
+    {5, 10, 6, 80.00, 109.50},
+    {5, 10, 10, 80.00, 109.50},
+    {5, 13, 13, 50.00, 109.50},
+    {5, 13, 36, 35.00, 109.50},
+    {5, 13, 38, 50.00, 109.50},
+    {5, 13, 41, 50.00, 109.50},
+    {5, 35, 34, 35.00, 110.20},
+    {5, 37, 37, 70.00, 123.00},
+    {5, 37, 40, 70.00, 123.00},
+    {5, 38, 38, 70.00, 120.00},
+    {5, 38, 46, 70.00, 120.00},
+    {5, 41, 13, 50.00, 109.50},
+    {5, 41, 29, 92.60, 111.55},
+    {5, 41, 36, 35.00, 109.50},
+    {5, 54, 5, 45.00, 102.60},
+    {5, 54, 29, 45.00, 102.60},
+    {5, 54, 38, 45.00, 109.50},
+    {5, 54, 42, 45.00, 108.23},
+    {5, 69, 13, 75.00, 96.40},
+    {5, 69, 32, 74.00, 108.70},
+    {5, 69, 38, 75.00, 96.40},
+    {6, 2, 6, 63.00, 112.40},
+    {6, 2, 10, 63.00, 112.40},
+    {6, 2, 13, 63.00, 112.40},
+    {6, 2, 29, 80.00, 109.50},
+    {6, 2, 33, 56.20, 109.47},
+    {6, 2, 41, 63.00, 112.40},
+    {6, 3, 35, 70.00, 116.60},
+    {6, 3, 42, 70.00, 117.00},
+    {6, 5, 7, 55.00, 108.50},
+    {6, 10, 6, 63.00, 111.50},
+    {6, 10, 10, 63.00, 111.50},
+    {6, 10, 29, 80.00, 109.50},
+    {6, 10, 33, 56.20, 109.47},
+    {6, 10, 35, 80.00, 109.50},
+    {6, 11, 6, 70.00, 124.00},
+    {6, 11, 9, 70.00, 118.00},
+    {6, 11, 10, 70.00, 124.00},
+    {6, 11, 11, 70.00, 118.00},
+    {6, 11, 13, 70.00, 124.00},
+    {6, 13, 6, 40.00, 109.50},
+    {6, 13, 33, 56.20, 109.47},
+    {6, 14, 6, 70.00, 124.00},
+    {6, 14, 9, 70.00, 118.00},
+    {6, 14, 10, 70.00, 124.00},
+    {6, 14, 11, 70.00, 118.00},
+    {6, 14, 13, 70.00, 124.00},
+    {6, 14, 14, 70.00, 118.00},
+    {6, 15, 17, 44.00, 96.00},
+    {6, 15, 22, 150.00, 96.70},
+    {6, 16, 16, 68.00, 103.70},
+    {6, 16, 22, 150.00, 96.70},
+    {6, 29, 41, 100.00, 113.00},
+    {6, 29, 54, 100.00, 120.50},
+    {6, 33, 6, 51.80, 107.20},
+    {6, 33, 10, 51.80, 107.20},
+    {6, 33, 13, 51.80, 107.20},
+    {6, 33, 34, 43.20, 108.10},
+    {6, 35, 34, 38.00, 118.40},
+    {6, 41, 6, 40.00, 109.50},
+    {6, 41, 29, 80.00, 109.50},
+    {6, 43, 44, 35.00, 109.50},
+    {6, 45, 38, 50.00, 123.20},
+    {6, 69, 11, 62.00, 98.90},
+    {6, 95, 50, 70.00, 125.80},
+    {6, 95, 52, 70.00, 128.80},
+    {7, 5, 10, 55.00, 108.50},
+    {7, 5, 13, 55.00, 108.50},
+    {7, 5, 23, 10.00, 109.47},
+    {7, 5, 35, 49.00, 105.40},
+    {7, 5, 37, 35.00, 109.00},
+    {7, 5, 38, 35.00, 113.00},
+    {7, 5, 41, 55.00, 108.50},
+    {7, 5, 54, 55.00, 108.50},
+    {7, 5, 69, 74.00, 110.00},
+    {7, 5, 96, 100.00, 126.00},
+    {7, 29, 10, 55.00, 108.50},
+    {9, 11, 10, 70.00, 118.00},
+    {9, 11, 11, 70.00, 118.00},
+    {9, 11, 13, 70.00, 118.00},
+    {9, 11, 14, 70.00, 118.00},
+    {9, 11, 69, 70.00, 118.00},
+    {9, 14, 10, 70.00, 118.00},
+    {9, 14, 11, 70.00, 118.00},
+    {9, 14, 13, 70.00, 118.00},
+    {9, 14, 14, 70.00, 118.00},
+    {10, 2, 10, 63.00, 112.40},
+    {10, 2, 12, 63.00, 114.00},
+    {10, 2, 15, 50.00, 108.60},
+    {10, 2, 16, 50.00, 114.70},
+    {10, 2, 29, 80.00, 109.50},
+    {10, 2, 33, 56.20, 109.47},
+    {10, 2, 38, 63.00, 114.00},
+    {10, 2, 70, 63.00, 115.60},
+    {10, 3, 29, 81.00, 111.40},
+    {10, 3, 35, 70.00, 116.60},
+    {10, 3, 42, 65.00, 117.00},
+    {10, 10, 10, 63.00, 111.50},
+    {10, 10, 29, 80.00, 109.50},
+    {10, 10, 33, 56.20, 109.47},
+    {10, 10, 35, 80.00, 109.70},
+    {10, 10, 95, 80.00, 109.50},
+    {10, 11, 10, 70.00, 124.00},
+    {10, 11, 11, 70.00, 118.00},
+    {10, 11, 13, 70.00, 124.00},
+    {10, 13, 33, 56.20, 109.47},
+    {10, 14, 10, 70.00, 124.00},
+    {10, 14, 11, 70.00, 118.00},
+    {10, 14, 13, 70.00, 124.00},
+    {10, 14, 14, 70.00, 118.00},
+    {10, 29, 10, 100.00, 111.80},
+    {10, 29, 41, 100.00, 113.00},
+    {10, 29, 54, 100.00, 120.50},
+    {10, 33, 10, 51.80, 107.20},
+    {10, 33, 13, 51.80, 107.20},
+    {10, 33, 34, 43.20, 108.10},
+    {10, 35, 34, 38.00, 118.40},
+    {10, 38, 38, 70.00, 120.00},
+    {10, 95, 50, 70.00, 125.80},
+    {10, 95, 52, 70.00, 128.80},
+    {11, 11, 11, 70.00, 118.00},
+    {11, 11, 13, 70.00, 118.00},
+    {11, 11, 14, 70.00, 118.00},
+    {11, 14, 11, 70.00, 118.00},
+    {11, 14, 13, 70.00, 118.00},
+    {11, 14, 14, 70.00, 118.00},
+    {12, 3, 12, 85.00, 120.00},
+    {12, 12, 12, 85.00, 120.00},
+    {12, 12, 38, 85.00, 120.00},
+    {12, 12, 50, 85.00, 120.00},
+    {12, 12, 71, 85.00, 120.00},
+    {12, 38, 12, 85.00, 120.00},
+    {12, 50, 70, 85.00, 134.90},
+    {12, 50, 71, 85.00, 116.20},
+    {12, 50, 77, 85.00, 134.90},
+    {12, 71, 47, 70.00, 132.80},
+    {12, 71, 50, 85.00, 122.70},
+    {13, 2, 33, 56.20, 109.47},
+    {13, 3, 13, 70.00, 116.00},
+    {13, 3, 29, 81.00, 111.40},
+    {13, 3, 30, 75.00, 109.00},
+    {13, 3, 33, 70.00, 116.00},
+    {13, 3, 35, 70.00, 116.60},
+    {13, 3, 36, 35.00, 115.00},
+    {13, 3, 38, 70.00, 116.00},
+    {13, 3, 40, 70.00, 116.00},
+    {13, 3, 42, 70.00, 117.00},
+    {13, 3, 55, 75.00, 109.00},
+    {13, 3, 97, 70.00, 116.60},
+    {13, 5, 23, 10.00, 109.47},
+    {13, 5, 54, 100.00, 120.50},
+    {13, 10, 33, 56.20, 109.47},
+    {13, 11, 13, 70.00, 124.00},
+    {13, 13, 13, 58.35, 112.70},
+    {13, 13, 15, 50.00, 108.60},
+    {13, 13, 16, 50.00, 114.70},
+    {13, 13, 19, 58.35, 112.70},
+    {13, 13, 29, 50.00, 109.50},
+    {13, 13, 30, 69.00, 109.80},
+    {13, 13, 31, 50.00, 108.60},
+    {13, 13, 33, 56.20, 109.47},
+    {13, 13, 35, 80.00, 109.70},
+    {13, 13, 36, 37.50, 110.70},
+    {13, 13, 37, 63.00, 111.10},
+    {13, 13, 38, 63.00, 114.00},
+    {13, 13, 41, 58.35, 112.70},
+    {13, 13, 43, 80.00, 111.20},
+    {13, 13, 45, 80.00, 111.20},
+    {13, 13, 46, 65.00, 109.00},
+    {13, 13, 50, 63.00, 114.00},
+    {13, 13, 54, 43.00, 109.50},
+    {13, 13, 55, 69.00, 110.00},
+    {13, 13, 56, 75.00, 112.00},
+    {13, 13, 69, 50.00, 108.60},
+    {13, 13, 70, 63.00, 115.60},
+    {13, 13, 73, 63.00, 114.00},
+    {13, 13, 74, 63.00, 114.00},
+    {13, 13, 75, 63.00, 114.00},
+    {13, 13, 77, 63.00, 115.60},
+    {13, 13, 80, 80.00, 110.00},
+    {13, 13, 85, 63.00, 105.00},
+    {13, 13, 91, 80.00, 111.20},
+    {13, 13, 92, 63.00, 111.10},
+    {13, 13, 94, 43.00, 109.50},
+    {13, 13, 95, 50.00, 109.50},
+    {13, 13, 97, 80.00, 109.70},
+    {13, 13, 98, 60.00, 112.00},
+    {13, 14, 13, 70.00, 124.00},
+    {13, 14, 14, 70.00, 118.00},
+    {13, 15, 17, 44.00, 96.00},
+    {13, 15, 22, 150.00, 96.70},
+    {13, 15, 23, 10.00, 109.47},
+    {13, 16, 13, 62.00, 98.90},
+    {13, 16, 16, 68.00, 103.70},
+    {13, 16, 19, 65.00, 100.00},
+    {13, 16, 22, 150.00, 96.70},
+    {13, 16, 23, 10.00, 109.47},
+    {13, 16, 38, 62.00, 104.20},
+    {13, 16, 81, 62.00, 94.00},
+    {13, 18, 19, 150.00, 180.00},
+    {13, 19, 18, 150.00, 180.00},
+    {13, 19, 19, 150.00, 180.00},
+    {13, 29, 13, 60.00, 109.50},
+    {13, 29, 23, 10.00, 109.47},
+    {13, 29, 37, 75.00, 111.00},
+    {13, 29, 38, 75.00, 111.00},
+    {13, 29, 41, 60.00, 109.50},
+    {13, 29, 54, 100.00, 120.50},
+    {13, 29, 98, 40.00, 130.00},
+    {13, 31, 13, 62.00, 96.00},
+    {13, 31, 32, 74.00, 107.00},
+    {13, 33, 13, 51.80, 107.20},
+    {13, 33, 34, 35.00, 109.50},
+    {13, 33, 38, 50.00, 116.00},
+    {13, 33, 69, 50.00, 108.60},
+    {13, 35, 13, 50.00, 118.00},
+    {13, 35, 34, 38.00, 118.40},
+    {13, 35, 38, 50.00, 118.00},
+    {13, 35, 69, 50.00, 120.00},
+    {13, 36, 23, 37.50, 109.47},
+    {13, 37, 13, 70.00, 130.00},
+    {13, 37, 36, 35.00, 117.00},
+    {13, 37, 37, 70.00, 124.00},
+    {13, 37, 38, 85.00, 119.70},
+    {13, 37, 40, 70.00, 124.00},
+    {13, 37, 47, 70.00, 120.00},
+    {13, 37, 95, 70.00, 120.00},
+    {13, 37, 100, 80.00, 122.00},
+    {13, 38, 38, 70.00, 120.00},
+    {13, 38, 46, 70.00, 116.00},
+    {13, 38, 47, 70.00, 120.00},
+    {13, 38, 50, 70.00, 128.60},
+    {13, 40, 37, 70.00, 124.00},
+    {13, 40, 40, 70.00, 124.00},
+    {13, 40, 99, 70.00, 124.00},
+    {13, 41, 29, 50.00, 109.50},
+    {13, 41, 36, 37.50, 110.70},
+    {13, 41, 95, 50.00, 109.50},
+    {13, 43, 13, 50.00, 113.00},
+    {13, 43, 23, 10.00, 100.00},
+    {13, 43, 38, 55.00, 114.00},
+    {13, 43, 44, 35.00, 109.50},
+    {13, 45, 13, 50.00, 118.00},
+    {13, 45, 34, 35.00, 118.40},
+    {13, 45, 38, 50.00, 123.20},
+    {13, 45, 44, 35.00, 118.40},
+    {13, 46, 18, 70.00, 120.00},
+    {13, 46, 38, 50.00, 118.00},
+    {13, 46, 46, 70.00, 117.00},
+    {13, 46, 93, 70.00, 114.00},
+    {13, 47, 50, 70.00, 125.80},
+    {13, 47, 51, 70.00, 118.40},
+    {13, 47, 52, 70.00, 128.80},
+    {13, 49, 46, 70.00, 115.50},
+    {13, 50, 38, 70.00, 120.00},
+    {13, 50, 50, 70.00, 120.00},
+    {13, 54, 29, 45.00, 109.50},
+    {13, 54, 42, 45.00, 109.50},
+    {13, 69, 13, 62.00, 102.00},
+    {13, 69, 32, 74.00, 108.90},
+    {13, 69, 33, 62.00, 102.00},
+    {13, 69, 35, 100.00, 103.00},
+    {13, 69, 38, 62.00, 102.00},
+    {13, 69, 72, 62.00, 102.00},
+    {13, 70, 50, 70.00, 128.60},
+    {13, 70, 74, 70.00, 125.00},
+    {13, 72, 16, 70.00, 125.00},
+    {13, 72, 47, 70.00, 125.00},
+    {13, 72, 51, 70.00, 125.00},
+    {13, 73, 51, 70.00, 124.50},
+    {13, 73, 74, 70.00, 130.70},
+    {13, 74, 16, 70.00, 125.00},
+    {13, 74, 29, 70.00, 121.60},
+    {13, 74, 47, 70.00, 121.60},
+    {13, 74, 51, 70.00, 118.90},
+    {13, 74, 73, 70.00, 130.70},
+    {13, 74, 74, 70.00, 120.00},
+    {13, 74, 77, 70.00, 132.10},
+    {13, 75, 47, 70.00, 121.60},
+    {13, 75, 75, 70.00, 130.70},
+    {13, 77, 50, 70.00, 128.60},
+    {13, 77, 74, 70.00, 125.00},
+    {13, 78, 51, 70.00, 118.90},
+    {13, 80, 79, 55.00, 127.00},
+    {13, 80, 81, 50.00, 126.00},
+    {13, 81, 36, 35.00, 114.30},
+    {13, 81, 81, 37.50, 117.20},
+    {13, 85, 13, 172.80, 120.00},
+    {13, 85, 36, 144.00, 120.00},
+    {13, 91, 34, 35.00, 109.50},
+    {13, 91, 38, 50.00, 120.50},
+    {13, 92, 93, 80.00, 117.50},
+    {13, 94, 13, 45.00, 109.50},
+    {13, 95, 37, 70.00, 121.20},
+    {13, 95, 50, 70.00, 125.80},
+    {13, 95, 52, 70.00, 128.80},
+    {13, 97, 13, 50.00, 118.00},
+    {13, 98, 13, 60.00, 110.00},
+    {13, 98, 29, 60.00, 100.00},
+    {13, 98, 30, 35.00, 110.50},
+    {13, 98, 34, 35.00, 110.50},
+    {13, 98, 36, 35.00, 110.50},
+    {13, 98, 55, 35.00, 110.50},
+    {13, 98, 56, 35.00, 110.50},
+    {13, 98, 98, 50.00, 112.00},
+    {13, 99, 40, 70.00, 124.00},
+    {13, 99, 99, 70.00, 124.00},
+    {14, 14, 14, 70.00, 118.00},
+    {15, 13, 36, 35.00, 109.50},
+    {15, 17, 23, 10.00, 109.47},
+    {15, 38, 38, 70.00, 120.00},
+    {16, 13, 33, 50.00, 114.70},
+    {16, 13, 36, 35.00, 109.50},
+    {16, 13, 38, 50.00, 114.70},
+    {16, 13, 74, 50.00, 114.70},
+    {16, 16, 22, 150.00, 96.70},
+    {16, 19, 19, 140.00, 180.00},
+    {16, 35, 76, 70.00, 117.00},
+    {16, 37, 37, 85.00, 119.40},
+    {16, 37, 47, 85.00, 119.40},
+    {16, 37, 95, 85.00, 119.40},
+    {16, 38, 38, 85.00, 119.40},
+    {16, 50, 50, 70.00, 111.00},
+    {16, 72, 33, 70.00, 120.20},
+    {16, 72, 35, 70.00, 125.00},
+    {16, 72, 39, 35.00, 125.00},
+    {16, 72, 51, 70.00, 113.60},
+    {16, 72, 51, 70.00, 115.00},
+    {16, 74, 35, 70.00, 125.00},
+    {16, 74, 39, 35.00, 125.00},
+    {16, 74, 73, 70.00, 111.00},
+    {16, 74, 77, 70.00, 111.00},
+    {16, 81, 36, 37.50, 108.00},
+    {16, 81, 80, 55.00, 109.00},
+    {16, 81, 81, 55.00, 128.00},
+    {17, 15, 17, 35.00, 92.07},
+    {17, 15, 22, 150.00, 96.70},
+    {17, 15, 38, 50.00, 96.00},
+    {18, 13, 36, 35.00, 108.50},
+    {18, 18, 46, 100.00, 180.00},
+    {18, 19, 23, 10.00, 90.00},
+    {18, 19, 37, 150.00, 180.00},
+    {18, 19, 38, 150.00, 180.00},
+    {18, 19, 45, 150.00, 180.00},
+    {18, 19, 78, 150.00, 180.00},
+    {18, 38, 38, 80.00, 120.00},
+    {19, 13, 36, 35.00, 108.50},
+    {19, 18, 38, 170.00, 180.00},
+    {19, 19, 36, 112.00, 180.00},
+    {19, 19, 37, 160.00, 180.00},
+    {19, 19, 38, 160.00, 180.00},
+    {19, 19, 40, 160.00, 180.00},
+    {19, 37, 36, 35.00, 120.00},
+    {19, 37, 37, 70.00, 124.00},
+    {19, 38, 38, 70.00, 120.00},
+    {19, 40, 36, 35.00, 120.00},
+    {19, 78, 51, 70.00, 118.90},
+    {21, 20, 21, 75.00, 109.50},
+    {21, 20, 22, 50.00, 54.75},
+    {22, 15, 22, 10.00, 160.00},
+    {22, 16, 22, 10.00, 160.00},
+    {23, 1, 23, 33.00, 109.47},
+    {23, 4, 23, 10.00, 117.00},
+    {23, 5, 23, 5.00, 109.47},
+    {23, 5, 38, 10.00, 109.47},
+    {23, 7, 23, 33.00, 109.47},
+    {23, 15, 23, 5.00, 109.47},
+    {23, 16, 23, 5.00, 109.47},
+    {23, 16, 51, 10.00, 130.00},
+    {23, 16, 72, 10.00, 130.00},
+    {23, 16, 74, 10.00, 130.00},
+    {23, 17, 23, 33.00, 109.47},
+    {23, 23, 23, 33.00, 109.47},
+    {23, 29, 23, 5.00, 109.47},
+    {23, 29, 38, 10.00, 109.47},
+    {23, 29, 51, 10.00, 125.00},
+    {23, 29, 72, 10.00, 125.00},
+    {23, 29, 74, 10.00, 125.00},
+    {23, 30, 23, 33.00, 109.47},
+    {23, 31, 32, 10.00, 90.00},
+    {23, 33, 34, 10.00, 100.00},
+    {23, 33, 38, 10.00, 109.50},
+    {23, 34, 23, 33.00, 109.47},
+    {23, 34, 33, 10.00, 109.50},
+    {23, 35, 34, 10.00, 100.00},
+    {23, 36, 23, 33.00, 109.47},
+    {23, 37, 36, 10.00, 90.00},
+    {23, 37, 37, 2.00, 90.00},
+    {23, 37, 40, 2.00, 90.00},
+    {23, 38, 38, 10.00, 90.00},
+    {23, 38, 39, 2.00, 90.00},
+    {23, 40, 36, 10.00, 90.00},
+    {23, 40, 37, 2.00, 90.00},
+    {23, 40, 40, 2.00, 90.00},
+    {23, 43, 38, 10.00, 100.00},
+    {23, 43, 72, 10.00, 100.00},
+    {23, 46, 38, 5.00, 120.00},
+    {23, 46, 49, 5.00, 119.80},
+    {23, 51, 47, 10.00, 125.00},
+    {23, 51, 51, 10.00, 125.00},
+    {23, 51, 72, 10.00, 125.00},
+    {23, 55, 23, 33.00, 109.47},
+    {23, 56, 23, 33.00, 109.47},
+    {23, 93, 23, 10.00, 109.50},
+    {23, 93, 92, 10.00, 109.50},
+    {29, 3, 35, 81.00, 111.40},
+    {29, 3, 36, 40.00, 115.00},
+    {29, 3, 38, 81.00, 111.40},
+    {29, 10, 38, 80.00, 109.50},
+    {29, 10, 95, 80.00, 109.50},
+    {29, 13, 35, 50.00, 109.50},
+    {29, 13, 36, 35.00, 109.50},
+    {29, 13, 38, 50.00, 109.50},
+    {29, 13, 95, 50.00, 109.50},
+    {29, 37, 36, 35.00, 114.50},
+    {29, 37, 37, 70.00, 123.00},
+    {29, 37, 40, 70.00, 123.00},
+    {29, 37, 47, 70.00, 120.00},
+    {29, 37, 95, 70.00, 120.00},
+    {29, 38, 38, 70.00, 120.00},
+    {29, 41, 29, 92.60, 111.55},
+    {29, 41, 36, 35.00, 109.50},
+    {29, 41, 95, 50.00, 109.50},
+    {29, 50, 50, 70.00, 110.60},
+    {29, 51, 78, 70.00, 105.30},
+    {29, 54, 29, 45.00, 102.60},
+    {29, 54, 38, 45.00, 109.50},
+    {29, 54, 42, 100.00, 108.23},
+    {29, 72, 39, 35.00, 117.00},
+    {29, 72, 51, 70.00, 115.00},
+    {29, 72, 76, 70.00, 122.00},
+    {29, 74, 39, 35.00, 113.40},
+    {29, 74, 40, 70.00, 110.00},
+    {29, 74, 73, 70.00, 108.00},
+    {29, 74, 76, 70.00, 121.60},
+    {29, 74, 77, 70.00, 110.60},
+    {29, 98, 29, 60.00, 110.00},
+    {30, 13, 30, 78.00, 111.70},
+    {30, 13, 36, 51.00, 107.60},
+    {30, 37, 36, 60.00, 114.00},
+    {30, 37, 37, 75.00, 121.50},
+    {30, 38, 38, 75.00, 120.00},
+    {30, 38, 46, 75.00, 120.00},
+    {31, 13, 36, 35.00, 109.50},
+    {32, 69, 32, 104.00, 119.00},
+    {32, 69, 33, 74.00, 108.90},
+    {32, 69, 35, 120.00, 107.00},
+    {32, 69, 38, 74.00, 107.20},
+    {33, 3, 74, 70.00, 116.00},
+    {33, 13, 36, 35.00, 109.50},
+    {33, 13, 38, 80.00, 111.20},
+    {33, 38, 38, 70.00, 120.00},
+    {33, 38, 46, 70.00, 116.00},
+    {33, 72, 51, 70.00, 126.10},
+    {33, 81, 36, 35.00, 114.30},
+    {33, 81, 81, 37.50, 117.20},
+    {34, 33, 34, 43.60, 106.40},
+    {34, 33, 38, 35.00, 116.00},
+    {34, 33, 69, 35.00, 115.00},
+    {34, 35, 34, 35.00, 120.00},
+    {34, 35, 38, 35.00, 119.80},
+    {34, 35, 49, 35.00, 118.00},
+    {34, 35, 69, 100.00, 111.00},
+    {34, 35, 74, 35.00, 119.80},
+    {34, 35, 77, 35.00, 119.80},
+    {34, 35, 78, 35.00, 119.80},
+    {34, 35, 81, 40.00, 113.00},
+    {34, 43, 34, 43.60, 109.50},
+    {34, 45, 34, 35.00, 113.00},
+    {34, 45, 38, 35.00, 120.00},
+    {34, 45, 49, 35.00, 120.00},
+    {34, 46, 38, 35.00, 113.00},
+    {34, 47, 37, 35.00, 119.20},
+    {34, 47, 38, 35.00, 118.00},
+    {34, 47, 50, 30.00, 125.80},
+    {34, 47, 51, 56.00, 118.40},
+    {34, 47, 52, 30.00, 128.80},
+    {34, 47, 71, 35.00, 123.10},
+    {34, 47, 72, 35.00, 120.00},
+    {34, 47, 74, 35.00, 120.00},
+    {34, 47, 75, 35.00, 120.00},
+    {34, 91, 34, 43.60, 106.40},
+    {34, 91, 38, 50.00, 112.50},
+    {34, 95, 37, 35.00, 119.20},
+    {34, 95, 50, 30.00, 125.80},
+    {34, 95, 52, 30.00, 128.80},
+    {34, 98, 34, 35.00, 109.50},
+    {35, 3, 35, 70.00, 114.20},
+    {35, 3, 36, 40.00, 114.00},
+    {35, 3, 37, 70.00, 115.50},
+    {35, 3, 38, 70.00, 115.50},
+    {35, 3, 50, 70.00, 111.30},
+    {35, 13, 36, 35.00, 109.50},
+    {35, 16, 50, 74.00, 92.40},
+    {35, 29, 50, 70.00, 104.50},
+    {35, 38, 38, 70.00, 120.00},
+    {35, 38, 39, 35.00, 119.10},
+    {35, 49, 45, 70.00, 116.00},
+    {35, 49, 46, 70.00, 123.30},
+    {35, 50, 50, 70.00, 127.70},
+    {35, 50, 51, 70.00, 126.20},
+    {35, 69, 38, 100.00, 103.00},
+    {35, 72, 51, 70.00, 126.20},
+    {35, 81, 36, 35.00, 108.00},
+    {35, 81, 79, 70.00, 117.00},
+    {35, 81, 81, 37.50, 126.00},
+    {35, 96, 35, 20.00, 109.50},
+    {36, 3, 36, 35.00, 115.00},
+    {36, 3, 38, 35.00, 115.00},
+    {36, 3, 40, 80.00, 116.00},
+    {36, 3, 46, 35.00, 116.00},
+    {36, 3, 46, 35.00, 122.00},
+    {36, 13, 36, 33.00, 107.80},
+    {36, 13, 37, 35.00, 109.50},
+    {36, 13, 38, 35.00, 109.50},
+    {36, 13, 40, 35.00, 109.50},
+    {36, 13, 41, 37.50, 110.70},
+    {36, 13, 43, 35.00, 109.50},
+    {36, 13, 45, 35.00, 109.50},
+    {36, 13, 46, 35.00, 109.50},
+    {36, 13, 47, 35.00, 109.50},
+    {36, 13, 50, 35.00, 109.50},
+    {36, 13, 54, 41.00, 109.50},
+    {36, 13, 55, 51.00, 107.60},
+    {36, 13, 56, 75.00, 111.00},
+    {36, 13, 69, 35.00, 109.50},
+    {36, 13, 70, 35.00, 109.50},
+    {36, 13, 73, 35.00, 109.50},
+    {36, 13, 74, 35.00, 109.50},
+    {36, 13, 75, 35.00, 109.50},
+    {36, 13, 77, 35.00, 109.50},
+    {36, 13, 80, 35.00, 109.50},
+    {36, 13, 81, 37.50, 110.70},
+    {36, 13, 85, 35.00, 105.00},
+    {36, 13, 91, 35.00, 109.50},
+    {36, 13, 92, 35.00, 105.00},
+    {36, 13, 94, 41.00, 109.50},
+    {36, 13, 95, 35.00, 109.50},
+    {36, 13, 97, 35.00, 109.50},
+    {36, 13, 98, 35.00, 109.50},
+    {36, 37, 36, 35.00, 117.00},
+    {36, 37, 37, 35.00, 120.00},
+    {36, 37, 38, 35.00, 123.30},
+    {36, 37, 40, 35.00, 120.00},
+    {36, 37, 47, 35.00, 119.10},
+    {36, 37, 55, 60.00, 114.00},
+    {36, 37, 81, 35.00, 135.00},
+    {36, 37, 95, 35.00, 119.10},
+    {36, 37, 100, 40.00, 121.00},
+    {36, 40, 37, 35.00, 120.00},
+    {36, 40, 38, 35.00, 123.30},
+    {36, 40, 40, 35.00, 120.00},
+    {36, 40, 74, 35.00, 122.00},
+    {36, 40, 99, 35.00, 120.00},
+    {36, 41, 36, 33.00, 109.50},
+    {36, 41, 95, 35.00, 109.50},
+    {36, 70, 50, 35.00, 126.80},
+    {36, 70, 74, 35.00, 126.80},
+    {36, 77, 50, 35.00, 126.80},
+    {36, 77, 74, 35.00, 126.80},
+    {36, 81, 36, 35.00, 114.30},
+    {36, 81, 37, 35.00, 109.50},
+    {36, 81, 79, 37.50, 110.00},
+    {36, 81, 80, 35.00, 111.00},
+    {36, 81, 81, 37.50, 117.20},
+    {36, 98, 36, 35.00, 109.50},
+    {36, 99, 38, 35.00, 123.30},
+    {36, 99, 40, 35.00, 120.00},
+    {36, 99, 99, 35.00, 120.00},
+    {37, 3, 47, 70.00, 114.10},
+    {37, 13, 37, 63.00, 112.40},
+    {37, 13, 38, 40.00, 109.50},
+    {37, 16, 38, 62.00, 104.20},
+    {37, 29, 38, 75.00, 111.00},
+    {37, 37, 38, 85.00, 117.00},
+    {37, 37, 47, 70.00, 121.20},
+    {37, 37, 48, 35.00, 119.70},
+    {37, 37, 55, 75.00, 120.00},
+    {37, 37, 81, 70.00, 124.00},
+    {37, 37, 95, 70.00, 121.20},
+    {37, 38, 38, 70.00, 124.00},
+    {37, 38, 45, 70.00, 120.10},
+    {37, 38, 46, 70.00, 121.50},
+    {37, 38, 47, 70.00, 121.50},
+    {37, 40, 38, 85.00, 117.00},
+    {37, 40, 40, 70.00, 124.00},
+    {37, 40, 99, 70.00, 124.00},
+    {37, 81, 81, 63.00, 114.00},
+    {37, 95, 41, 70.00, 121.20},
+    {37, 100, 37, 160.00, 180.00},
+    {38, 3, 38, 85.00, 120.00},
+    {38, 3, 42, 70.00, 117.00},
+    {38, 13, 38, 40.00, 109.50},
+    {38, 13, 47, 80.00, 111.20},
+    {38, 13, 54, 43.00, 109.50},
+    {38, 13, 55, 69.00, 110.00},
+    {38, 29, 38, 75.00, 111.00},
+    {38, 29, 54, 100.00, 120.50},
+    {38, 33, 38, 50.00, 116.00},
+    {38, 33, 69, 50.00, 108.60},
+    {38, 33, 81, 50.00, 109.50},
+    {38, 35, 38, 70.00, 118.00},
+    {38, 35, 74, 70.00, 118.00},
+    {38, 35, 77, 70.00, 118.00},
+    {38, 35, 78, 70.00, 118.00},
+    {38, 35, 93, 70.00, 121.00},
+    {38, 37, 100, 80.00, 122.00},
+    {38, 38, 38, 63.00, 120.00},
+    {38, 38, 39, 35.00, 120.00},
+    {38, 38, 40, 70.00, 124.00},
+    {38, 38, 43, 70.00, 120.00},
+    {38, 38, 45, 70.00, 120.10},
+    {38, 38, 46, 70.00, 124.00},
+    {38, 38, 47, 70.00, 108.70},
+    {38, 38, 50, 63.00, 120.00},
+    {38, 38, 51, 70.00, 108.70},
+    {38, 38, 54, 85.00, 119.40},
+    {38, 38, 55, 75.00, 120.00},
+    {38, 38, 56, 75.00, 120.00},
+    {38, 38, 69, 85.00, 119.40},
+    {38, 38, 71, 85.00, 120.00},
+    {38, 38, 74, 70.00, 107.40},
+    {38, 38, 76, 63.00, 120.00},
+    {38, 38, 92, 85.00, 120.00},
+    {38, 38, 99, 70.00, 124.00},
+    {38, 43, 44, 35.00, 109.50},
+    {38, 45, 44, 35.00, 120.00},
+    {38, 46, 38, 70.00, 117.00},
+    {38, 46, 46, 70.00, 117.00},
+    {38, 46, 49, 70.00, 118.60},
+    {38, 46, 50, 70.00, 112.20},
+    {38, 46, 76, 70.00, 117.00},
+    {38, 47, 38, 70.00, 125.20},
+    {38, 47, 51, 70.00, 118.40},
+    {38, 47, 52, 70.00, 109.80},
+    {38, 50, 38, 85.00, 134.90},
+    {38, 50, 50, 85.00, 117.30},
+    {38, 50, 51, 70.00, 132.40},
+    {38, 50, 70, 85.00, 134.90},
+    {38, 50, 71, 85.00, 116.20},
+    {38, 50, 77, 85.00, 134.90},
+    {38, 51, 38, 70.00, 125.20},
+    {38, 71, 47, 70.00, 132.80},
+    {38, 71, 50, 85.00, 122.70},
+    {38, 72, 47, 70.00, 125.00},
+    {38, 73, 51, 70.00, 111.00},
+    {38, 74, 39, 35.00, 130.70},
+    {38, 74, 47, 70.00, 121.60},
+    {38, 74, 77, 70.00, 132.10},
+    {38, 76, 38, 63.00, 120.00},
+    {38, 76, 46, 70.00, 124.00},
+    {38, 76, 72, 63.00, 120.00},
+    {38, 76, 73, 63.00, 120.00},
+    {38, 76, 74, 63.00, 120.00},
+    {38, 76, 76, 63.00, 120.00},
+    {38, 76, 77, 63.00, 120.00},
+    {38, 76, 78, 63.00, 120.00},
+    {38, 78, 39, 35.00, 128.60},
+    {38, 92, 93, 80.00, 117.50},
+    {38, 99, 99, 85.00, 117.00},
+    {39, 38, 46, 35.00, 116.00},
+    {39, 38, 47, 35.00, 120.00},
+    {39, 38, 50, 35.00, 120.00},
+    {39, 38, 51, 35.00, 119.10},
+    {39, 38, 71, 35.00, 120.00},
+    {39, 38, 74, 35.00, 126.90},
+    {39, 38, 76, 35.00, 120.00},
+    {39, 38, 78, 35.00, 128.20},
+    {39, 49, 46, 35.00, 115.45},
+    {39, 52, 47, 35.00, 120.00},
+    {39, 52, 51, 35.00, 120.00},
+    {39, 52, 95, 35.00, 120.00},
+    {39, 72, 47, 35.00, 120.00},
+    {39, 72, 51, 35.00, 120.00},
+    {39, 73, 51, 35.00, 120.00},
+    {39, 73, 74, 35.00, 128.20},
+    {39, 74, 40, 35.00, 130.70},
+    {39, 74, 47, 35.00, 121.60},
+    {39, 74, 70, 35.00, 120.00},
+    {39, 74, 73, 35.00, 130.70},
+    {39, 74, 77, 35.00, 132.10},
+    {39, 75, 47, 35.00, 120.00},
+    {39, 75, 75, 35.00, 130.70},
+    {39, 77, 50, 35.00, 120.00},
+    {39, 77, 74, 35.00, 125.70},
+    {39, 77, 77, 35.00, 127.50},
+    {39, 78, 51, 35.00, 118.90},
+    {40, 38, 46, 70.00, 121.50},
+    {40, 40, 74, 35.00, 106.00},
+    {40, 99, 99, 70.00, 124.00},
+    {41, 95, 50, 70.00, 125.80},
+    {41, 95, 52, 70.00, 128.80},
+    {42, 3, 42, 80.00, 126.00},
+    {42, 54, 42, 140.00, 119.90},
+    {44, 35, 44, 35.00, 120.00},
+    {44, 43, 44, 35.00, 109.50},
+    {44, 45, 44, 35.00, 120.00},
+    {45, 38, 45, 70.00, 120.00},
+    {45, 38, 46, 70.00, 119.30},
+    {45, 38, 47, 70.00, 116.00},
+    {45, 38, 50, 70.00, 123.50},
+    {45, 49, 46, 70.00, 119.30},
+    {46, 3, 47, 70.00, 118.60},
+    {46, 3, 95, 70.00, 118.60},
+    {46, 38, 47, 70.00, 123.30},
+    {46, 38, 50, 70.00, 117.30},
+    {46, 38, 76, 70.00, 124.00},
+    {46, 38, 91, 70.00, 124.10},
+    {46, 49, 46, 70.00, 129.10},
+    {46, 49, 53, 35.00, 115.45},
+    {46, 50, 47, 70.00, 126.20},
+    {46, 50, 50, 70.00, 127.70},
+    {46, 50, 95, 70.00, 126.20},
+    {46, 72, 47, 70.00, 126.20},
+    {46, 72, 77, 70.00, 127.70},
+    {46, 76, 76, 70.00, 124.00},
+    {47, 3, 47, 70.00, 118.60},
+    {47, 3, 50, 70.00, 111.30},
+    {47, 3, 95, 70.00, 115.40},
+    {47, 37, 48, 35.00, 119.10},
+    {47, 38, 50, 70.00, 108.70},
+    {47, 38, 51, 70.00, 123.30},
+    {47, 50, 50, 70.00, 106.20},
+    {47, 50, 77, 70.00, 107.70},
+    {47, 51, 74, 70.00, 104.10},
+    {47, 51, 78, 70.00, 104.10},
+    {47, 52, 51, 70.00, 113.90},
+    {47, 52, 53, 35.00, 123.05},
+    {47, 71, 50, 70.00, 104.40},
+    {47, 72, 47, 70.00, 120.00},
+    {47, 72, 51, 70.00, 120.00},
+    {47, 72, 69, 70.00, 120.00},
+    {47, 72, 77, 70.00, 106.20},
+    {47, 74, 48, 35.00, 120.00},
+    {47, 74, 70, 70.00, 108.70},
+    {47, 74, 73, 70.00, 106.30},
+    {47, 74, 74, 70.00, 120.00},
+    {47, 74, 76, 70.00, 121.60},
+    {47, 74, 77, 70.00, 107.70},
+    {47, 75, 75, 70.00, 106.30},
+    {48, 37, 95, 35.00, 119.10},
+    {49, 46, 49, 70.00, 118.60},
+    {49, 46, 50, 70.00, 111.00},
+    {49, 46, 72, 70.00, 111.00},
+    {50, 16, 72, 74.00, 97.00},
+    {50, 16, 74, 74.00, 97.00},
+    {50, 29, 72, 70.00, 106.50},
+    {50, 29, 74, 70.00, 106.50},
+    {50, 38, 74, 63.00, 106.40},
+    {50, 47, 51, 56.00, 113.10},
+    {50, 47, 52, 70.00, 105.40},
+    {50, 47, 72, 70.00, 109.80},
+    {50, 47, 74, 70.00, 109.80},
+    {50, 50, 51, 70.00, 111.00},
+    {50, 50, 77, 70.00, 107.30},
+    {50, 50, 95, 70.00, 106.20},
+    {50, 51, 52, 70.00, 103.80},
+    {50, 51, 72, 70.00, 110.00},
+    {50, 70, 74, 85.00, 106.40},
+    {50, 77, 74, 85.00, 106.40},
+    {50, 77, 77, 70.00, 107.30},
+    {50, 95, 52, 70.00, 105.40},
+    {51, 29, 74, 70.00, 108.90},
+    {51, 47, 72, 56.00, 113.10},
+    {51, 47, 74, 56.00, 113.10},
+    {51, 51, 72, 70.00, 109.00},
+    {51, 52, 53, 35.00, 123.05},
+    {51, 52, 95, 70.00, 113.90},
+    {51, 72, 69, 70.00, 120.00},
+    {51, 72, 76, 70.00, 130.00},
+    {51, 73, 74, 70.00, 111.00},
+    {51, 74, 74, 70.00, 120.00},
+    {51, 74, 77, 70.00, 111.90},
+    {51, 78, 77, 70.00, 111.90},
+    {53, 52, 95, 35.00, 123.05},
+    {54, 29, 54, 100.00, 120.50},
+    {55, 13, 55, 78.00, 111.70},
+    {68, 67, 68, 150.00, 180.00},
+    {70, 50, 71, 85.00, 108.80},
+    {71, 47, 74, 70.00, 111.60},
+    {71, 50, 77, 85.00, 108.80},
+    {72, 16, 74, 74.00, 90.00},
+    {72, 29, 72, 70.00, 107.00},
+    {72, 29, 74, 70.00, 104.00},
+    {72, 47, 74, 70.00, 109.80},
+    {72, 47, 75, 70.00, 109.80},
+    {72, 51, 73, 70.00, 110.00},
+    {72, 51, 74, 70.00, 110.00},
+    {72, 77, 74, 70.00, 110.40},
+    {74, 16, 74, 74.00, 97.00},
+    {74, 29, 74, 70.00, 106.50},
+    {74, 47, 74, 70.00, 109.80},
+    {74, 77, 74, 70.00, 103.80},
+    {74, 77, 76, 70.00, 125.70},
+    {74, 77, 77, 70.00, 107.30},
+    {74, 77, 78, 70.00, 103.80},
+    {76, 74, 77, 70.00, 132.10},
+    {76, 77, 77, 70.00, 127.50},
+    {79, 80, 81, 50.00, 94.00},
+    {79, 81, 81, 63.00, 85.00},
+    {80, 79, 81, 70.00, 91.00},
+    {80, 81, 81, 80.00, 89.00},
+    {81, 81, 81, 30.00, 79.20},
+    {91, 38, 91, 70.00, 111.80},
+    {93, 92, 93, 80.00, 125.00},
+    {98, 29, 98, 20.00, 145.00},
+};
+
+const OplsTorsionParameters TorsionParameters[] = {
+    {0, 2, 2, 2, -2.500, 1.250, 3.100},
+    {0, 2, 2, 6, -2.500, 1.250, 3.100},
+    {0, 2, 10, 2, -2.500, 1.250, 3.100},
+    {0, 3, 37, 13, 0.900, 0.230, -0.505},
+    {0, 3, 40, 13, 0.900, 0.230, -0.505},
+    {0, 3, 50, 0, 0.000, 7.000, 0.000},
+    {0, 3, 77, 0, 0.000, 7.250, 0.000},
+    {0, 4, 96, 0, 0.000, 0.000, 0.000},
+    {0, 13, 13, 3, -4.344, -1.714, 0.000},
+    {0, 13, 13, 13, 1.711, -0.500, 0.663},
+    {0, 13, 13, 35, 1.428, 0.086, 0.029},
+    {0, 13, 18, 19, 0.000, 0.000, 0.000},
+    {0, 13, 19, 18, 0.000, 0.000, 0.000},
+    {0, 13, 19, 19, 0.000, 0.000, 0.000},
+    {0, 13, 29, 13, -0.521, -2.018, 1.996},
+    {0, 13, 35, 34, 0.000, 0.000, 0.000},
+    {0, 13, 37, 13, 1.711, -0.500, 0.663},
+    {0, 13, 37, 36, 0.000, 0.000, 0.468},
+    {0, 13, 37, 37, 0.500, 0.000, 0.000},
+    {0, 13, 37, 40, 0.500, 0.000, 0.000},
+    {0, 13, 38, 38, 0.000, 0.000, 0.000},
+    {0, 13, 40, 37, 0.500, 0.000, 0.000},
+    {0, 13, 47, 0, 0.000, 0.000, 0.000},
+    {0, 13, 69, 32, 0.000, 0.000, 0.000},
+    {0, 13, 69, 35, 0.000, 0.000, 0.000},
+    {0, 13, 80, 0, 0.000, 0.000, 0.000},
+    {0, 13, 95, 0, 0.000, 0.000, 0.000},
+    {0, 16, 81, 0, 0.000, 0.000, 0.000},
+    {0, 19, 19, 0, 0.000, 0.000, 0.000},
+    {0, 29, 54, 42, 0.000, 0.000, 0.562},
+    {0, 35, 38, 38, 0.000, 2.100, 0.000},
+    {0, 35, 49, 0, 0.000, 7.250, 0.000},
+    {0, 35, 49, 39, 0.000, 7.250, 0.000},
+    {0, 35, 50, 0, 0.000, 7.250, 0.000},
+    {0, 35, 69, 32, 0.000, 0.000, 0.000},
+    {0, 35, 74, 0, 0.000, 2.170, 0.000},
+    {0, 35, 77, 0, 0.000, 2.170, 0.000},
+    {0, 35, 78, 0, 0.000, 2.170, 0.000},
+    {0, 35, 96, 0, 0.000, 0.000, 0.000},
+    {0, 37, 37, 0, 0.000, 14.000, 0.000},
+    {0, 37, 37, 19, 0.000, 14.000, 0.000},
+    {0, 37, 74, 0, 0.000, 2.170, 0.000},
+    {0, 37, 76, 38, 0.000, 2.170, 0.000},
+    {0, 37, 77, 0, 0.000, 2.170, 0.000},
+    {0, 37, 78, 0, 0.000, 2.170, 0.000},
+    {0, 38, 38, 0, 0.000, 7.250, 0.000},
+    {0, 38, 38, 13, 0.000, 7.250, 0.000},
+    {0, 38, 38, 38, 0.000, 7.250, 0.000},
+    {0, 38, 38, 39, 0.000, 7.250, 0.000},
+    {0, 38, 45, 34, 0.000, 2.030, 0.000},
+    {0, 38, 46, 0, 0.000, 7.250, 0.000},
+    {0, 38, 50, 0, 0.000, 7.000, 0.000},
+    {0, 38, 69, 32, 0.000, 0.000, 0.000},
+    {0, 38, 71, 0, 0.000, 7.250, 0.000},
+    {0, 40, 40, 39, 0.000, 7.250, 0.000},
+    {0, 46, 49, 0, 0.000, 7.250, 0.000},
+    {0, 46, 49, 39, 0.000, 7.250, 0.000},
+    {0, 46, 50, 0, 0.000, 7.250, 0.000},
+    {0, 46, 52, 0, 0.000, 10.000, 0.000},
+    {0, 46, 72, 0, 0.000, 7.250, 0.000},
+    {0, 47, 50, 0, 0.000, 7.250, 0.000},
+    {0, 47, 51, 0, 0.000, 10.000, 0.000},
+    {0, 47, 52, 0, 0.000, 10.000, 0.000},
+    {0, 47, 71, 0, 0.000, 3.050, 0.000},
+    {0, 47, 72, 0, 0.000, 4.650, 0.000},
+    {0, 47, 72, 39, 0.000, 10.000, 0.000},
+    {0, 47, 74, 0, 0.000, 2.800, 0.000},
+    {0, 47, 75, 0, 0.000, 5.000, 0.000},
+    {0, 50, 50, 0, 0.000, 7.250, 0.000},
+    {0, 50, 51, 0, 0.000, 7.250, 0.000},
+    {0, 50, 70, 0, 0.000, 3.350, 0.000},
+    {0, 50, 71, 0, 0.000, 6.000, 0.000},
+    {0, 50, 77, 0, 0.000, 7.250, 0.000},
+    {0, 51, 51, 0, 0.000, 10.000, 0.000},
+    {0, 51, 52, 0, 0.000, 10.000, 0.000},
+    {0, 51, 72, 0, 0.000, 7.250, 0.000},
+    {0, 51, 72, 39, 0.000, 10.000, 0.000},
+    {0, 51, 73, 0, 0.000, 4.800, 0.000},
+    {0, 51, 74, 0, 0.000, 10.000, 0.000},
+    {0, 51, 78, 0, 0.000, 7.250, 0.000},
+    {0, 70, 74, 0, 0.000, 13.050, 0.000},
+    {0, 72, 74, 0, 0.000, 2.170, 0.000},
+    {0, 72, 77, 0, 0.000, 7.250, 0.000},
+    {0, 73, 74, 0, 0.000, 10.750, 0.000},
+    {0, 73, 74, 39, 0.000, 10.750, 0.000},
+    {0, 73, 76, 38, 0.000, 2.170, 0.000},
+    {0, 74, 74, 0, 0.000, 10.750, 0.000},
+    {0, 74, 74, 39, 0.000, 10.750, 0.000},
+    {0, 74, 76, 38, 0.000, 2.170, 0.000},
+    {0, 74, 77, 0, 0.000, 7.250, 0.000},
+    {0, 74, 77, 39, 0.000, 7.250, 0.000},
+    {0, 74, 78, 39, 0.000, 7.250, 0.000},
+    {0, 75, 75, 0, 0.000, 10.750, 0.000},
+    {0, 77, 77, 29, 0.000, 2.170, 0.000},
+    {0, 77, 77, 47, 0.000, 2.170, 0.000},
+    {0, 77, 77, 77, 0.000, 2.170, 0.000},
+    {0, 79, 81, 0, 0.000, 0.000, 0.000},
+    {0, 80, 81, 0, 0.000, 0.000, 0.000},
+    {0, 80, 81, 36, 0.000, 0.000, 0.000},
+    {0, 80, 81, 81, 0.000, 0.000, 0.000},
+    {0, 81, 81, 0, 0.000, 0.000, 0.000},
+    {0, 81, 81, 35, 0.000, 0.000, 0.000},
+    {0, 99, 99, 0, 0.000, 14.000, 0.000},
+    {1, 2, 2, 2, -2.000, 0.700, 3.000},
+    {1, 2, 2, 6, -2.000, 0.700, 3.000},
+    {1, 3, 13, 13, 0.000, 0.000, 0.000},
+    {1, 3, 13, 36, 0.000, 0.000, 0.360},
+    {1, 13, 13, 1, -2.500, 0.000, 0.250},
+    {1, 13, 13, 5, 0.000, 0.000, 0.540},
+    {1, 13, 13, 13, 0.300, -0.400, 0.400},
+    {1, 13, 13, 36, 0.000, 0.000, 0.400},
+    {1, 13, 37, 37, 0.500, 0.000, 0.000},
+    {1, 13, 38, 38, 0.000, 0.450, 0.000},
+    {1, 13, 74, 0, 0.000, 0.450, 0.000},
+    {1, 13, 77, 0, 0.000, 0.450, 0.000},
+    {1, 38, 38, 38, 0.000, 7.250, 0.000},
+    {1, 38, 38, 39, 0.000, 7.250, 0.000},
+    {2, 2, 2, 2, -3.400, 1.250, 3.100},
+    {2, 2, 2, 6, -3.400, 1.250, 3.100},
+    {2, 2, 2, 10, -3.400, 1.250, 3.100},
+    {2, 2, 2, 13, -3.400, 1.250, 3.100},
+    {2, 2, 2, 55, -2.000, 0.500, 3.250},
+    {2, 2, 5, 7, 0.300, 0.000, 1.300},
+    {2, 2, 10, 2, -3.400, 1.250, 3.100},
+    {2, 2, 13, 2, -3.400, 1.250, 3.100},
+    {3, 3, 5, 7, 3.000, 5.500, 0.000},
+    {3, 3, 13, 36, 0.000, 0.000, 0.085},
+    {3, 3, 35, 13, 0.400, 4.900, 0.000},
+    {3, 3, 35, 34, 0.000, 4.900, 0.000},
+    {3, 13, 13, 3, -0.550, 0.000, 1.000},
+    {3, 13, 13, 5, -6.180, 0.000, 0.000},
+    {3, 13, 13, 13, -2.060, -0.313, 0.315},
+    {3, 13, 13, 15, -4.344, -1.714, 0.000},
+    {3, 13, 13, 16, -4.344, -1.714, 0.000},
+    {3, 13, 13, 35, -9.000, 2.000, 0.800},
+    {3, 13, 13, 36, 0.000, 0.000, -0.100},
+    {3, 13, 13, 38, -1.697, -0.456, 0.585},
+    {3, 13, 13, 43, 1.000, 0.000, 0.000},
+    {3, 13, 13, 70, -1.697, -0.456, 0.585},
+    {3, 13, 13, 73, -1.697, -0.456, 0.585},
+    {3, 13, 13, 74, -1.697, -0.456, 0.585},
+    {3, 13, 13, 75, -1.697, -0.456, 0.585},
+    {3, 13, 35, 3, -2.365, 0.912, -0.850},
+    {3, 13, 35, 13, -1.737, 1.251, -3.501},
+    {3, 13, 35, 34, 0.000, 0.000, 0.000},
+    {3, 13, 43, 13, 1.438, -0.124, 0.264},
+    {3, 13, 43, 44, 0.000, 0.000, 0.347},
+    {3, 13, 97, 13, -1.737, 1.251, -3.501},
+    {3, 29, 38, 38, 0.000, 2.500, 0.000},
+    {3, 35, 38, 38, 0.000, 2.100, 0.000},
+    {3, 35, 74, 74, 0.000, 3.000, 0.000},
+    {3, 35, 76, 38, 0.000, 2.170, 0.000},
+    {3, 35, 76, 46, 0.000, 2.170, 0.000},
+    {3, 35, 76, 76, 0.000, 7.250, 0.000},
+    {3, 35, 81, 36, 0.000, 0.000, 0.000},
+    {3, 35, 81, 79, -1.396, -0.427, 0.000},
+    {3, 35, 81, 81, -1.396, -0.427, 0.000},
+    {3, 37, 37, 35, 0.000, 14.000, 0.000},
+    {3, 37, 37, 36, 0.000, 14.000, 0.000},
+    {3, 37, 76, 76, 0.000, 7.250, 0.000},
+    {3, 40, 40, 3, 0.000, 7.250, 0.000},
+    {4, 3, 3, 4, 1.600, 3.200, 0.000},
+    {4, 3, 3, 13, 0.000, 0.500, 0.000},
+    {4, 3, 3, 35, 0.000, 0.000, 0.000},
+    {4, 3, 3, 36, 0.000, 0.000, 0.000},
+    {4, 3, 5, 7, 0.000, 5.000, 0.000},
+    {4, 3, 13, 0, 0.000, 0.000, 0.000},
+    {4, 3, 13, 13, 0.000, 0.000, 0.000},
+    {4, 3, 13, 30, -0.650, 0.000, 0.000},
+    {4, 3, 13, 33, 0.000, 0.820, 0.000},
+    {4, 3, 13, 35, 0.000, 0.000, 0.000},
+    {4, 3, 13, 36, 0.000, 0.000, 0.000},
+    {4, 3, 13, 38, 0.000, 0.546, 0.000},
+    {4, 3, 29, 13, 0.000, 5.124, 0.000},
+    {4, 3, 29, 38, 0.000, 5.000, 0.000},
+    {4, 3, 35, 5, 0.000, 6.603, 0.000},
+    {4, 3, 35, 13, 0.000, 6.089, 0.000},
+    {4, 3, 35, 34, 0.000, 4.900, 0.000},
+    {4, 3, 35, 37, 0.000, 6.089, 0.000},
+    {4, 3, 35, 38, 0.000, 6.089, 0.000},
+    {4, 3, 35, 81, 0.000, 6.089, 0.000},
+    {4, 3, 37, 36, 0.000, 0.000, 0.000},
+    {4, 3, 37, 37, 2.500, 6.000, 0.000},
+    {4, 3, 38, 38, 0.000, 2.100, 0.000},
+    {4, 3, 40, 37, 2.500, 6.000, 0.000},
+    {4, 3, 50, 0, 0.000, 7.000, 0.000},
+    {4, 3, 72, 0, 0.000, 0.000, 0.000},
+    {4, 3, 72, 47, 2.000, 1.000, 0.000},
+    {4, 3, 72, 51, 0.000, 1.000, 0.000},
+    {4, 3, 74, 29, -0.750, 1.500, 0.000},
+    {4, 3, 74, 77, 0.750, 1.500, 0.000},
+    {4, 3, 77, 74, 0.000, 2.100, 0.000},
+    {4, 3, 77, 77, 0.000, 2.100, 0.000},
+    {4, 3, 97, 13, 0.000, 4.900, 0.000},
+    {4, 3, 99, 99, 2.500, 6.000, 0.000},
+    {4, 79, 80, 13, 0.000, 6.089, 0.000},
+    {4, 79, 80, 34, 0.000, 4.900, 0.000},
+    {4, 79, 80, 38, 0.000, 6.089, 0.000},
+    {4, 79, 80, 81, 0.000, 20.000, 0.000},
+    {4, 79, 81, 36, 0.000, 0.000, 0.000},
+    {4, 79, 81, 81, 0.000, 0.000, 0.000},
+    {5, 3, 13, 13, 0.000, 1.412, 0.000},
+    {5, 3, 13, 33, 5.260, 0.820, 0.000},
+    {5, 3, 13, 36, 0.000, 0.000, 0.000},
+    {5, 3, 35, 13, 2.300, 6.089, 0.000},
+    {5, 3, 35, 34, 0.000, 4.900, 0.000},
+    {5, 3, 37, 37, 3.200, -3.000, 0.000},
+    {5, 3, 38, 38, 0.000, 2.100, 0.000},
+    {5, 3, 40, 37, 3.200, -3.000, 0.000},
+    {5, 3, 99, 99, 3.200, -3.000, 0.000},
+    {5, 13, 13, 5, 9.508, 0.000, 0.000},
+    {5, 13, 13, 13, -1.552, 0.000, 0.000},
+    {5, 13, 13, 29, 4.319, 0.000, 0.000},
+    {5, 13, 13, 33, 8.000, 0.000, 0.000},
+    {5, 13, 13, 35, 6.280, -1.467, 2.030},
+    {5, 13, 13, 36, 0.000, 0.000, 0.468},
+    {5, 13, 13, 43, 6.280, -1.467, 2.030},
+    {5, 37, 37, 13, 0.000, 14.000, 0.000},
+    {5, 37, 37, 36, 0.000, 14.000, 0.000},
+    {6, 2, 2, 6, -3.400, 1.250, 3.100},
+    {6, 2, 2, 55, -2.000, 0.500, 3.250},
+    {6, 2, 5, 7, 0.300, 0.000, 1.300},
+    {6, 2, 29, 2, -7.400, 3.000, 1.800},
+    {6, 2, 29, 6, -8.400, 3.000, 1.800},
+    {7, 5, 10, 2, 0.300, 0.000, 0.500},
+    {7, 5, 10, 6, 0.300, 0.000, 0.500},
+    {7, 5, 13, 2, 0.000, 0.000, 0.200},
+    {7, 5, 13, 6, 0.000, 0.000, 0.200},
+    {7, 5, 13, 13, -0.356, -0.174, 0.492},
+    {7, 5, 13, 36, 0.000, 0.000, 0.352},
+    {7, 5, 13, 37, -0.900, 0.000, 0.000},
+    {7, 5, 13, 38, -0.900, 0.000, 0.000},
+    {7, 5, 13, 40, -0.900, 0.000, 0.000},
+    {7, 5, 33, 13, 0.000, 0.000, 0.300},
+    {7, 5, 33, 34, 0.000, 0.000, 0.300},
+    {7, 5, 35, 3, 5.519, -6.700, 0.581},
+    {7, 5, 35, 34, 2.722, -5.154, 0.000},
+    {7, 5, 37, 37, 0.000, 1.682, 0.000},
+    {7, 5, 38, 38, 0.000, 1.682, 0.000},
+    {7, 5, 41, 29, -1.257, -1.806, 0.003},
+    {7, 5, 46, 3, 3.000, 3.000, 0.000},
+    {7, 5, 54, 4, 0.000, 0.000, 0.000},
+    {7, 5, 54, 5, 0.000, 0.000, 0.000},
+    {7, 5, 69, 13, -0.750, 0.000, 0.000},
+    {7, 5, 69, 32, 0.750, 0.000, 0.000},
+    {7, 5, 69, 38, 2.000, 0.000, 0.000},
+    {10, 2, 2, 10, -3.400, 1.250, 3.100},
+    {10, 2, 5, 7, 0.300, 0.000, 1.300},
+    {13, 3, 3, 13, 0.700, -1.500, 0.000},
+    {13, 3, 3, 35, -0.500, 0.200, 0.000},
+    {13, 3, 3, 36, 0.800, -0.760, 0.000},
+    {13, 3, 5, 7, 1.500, 5.500, 0.000},
+    {13, 3, 13, 13, 1.454, -0.144, -0.775},
+    {13, 3, 13, 36, 0.000, 0.000, 0.275},
+    {13, 3, 29, 13, 4.669, 5.124, 0.000},
+    {13, 3, 29, 38, 1.500, 5.000, 0.000},
+    {13, 3, 35, 5, 4.542, 6.603, 1.045},
+    {13, 3, 35, 13, 2.300, 6.089, 0.000},
+    {13, 3, 35, 34, 0.000, 4.900, 0.000},
+    {13, 3, 35, 38, 2.300, 6.089, 0.000},
+    {13, 3, 38, 38, 0.000, 0.200, 0.000},
+    {13, 3, 40, 37, 0.800, -3.000, 0.000},
+    {13, 3, 46, 0, 0.000, 14.000, 0.000},
+    {13, 3, 46, 13, 0.000, 14.000, 0.000},
+    {13, 3, 97, 13, 0.000, 4.900, 0.000},
+    {13, 13, 13, 13, 1.300, -0.050, 0.200},
+    {13, 13, 13, 15, 1.262, -0.198, 0.465},
+    {13, 13, 13, 16, 2.619, -0.620, 0.258},
+    {13, 13, 13, 19, 0.000, -0.650, 0.000},
+    {13, 13, 13, 30, 0.000, 0.000, 0.400},
+    {13, 13, 13, 33, 2.392, -0.674, 0.550},
+    {13, 13, 13, 35, 0.845, -0.962, 0.713},
+    {13, 13, 13, 36, 0.000, 0.000, 0.300},
+    {13, 13, 13, 41, 1.300, -0.050, 0.200},
+    {13, 13, 13, 43, 2.732, -0.229, 0.485},
+    {13, 13, 13, 45, 2.732, -0.229, 0.485},
+    {13, 13, 13, 55, 0.000, 0.000, 0.400},
+    {13, 13, 13, 56, 0.000, 0.000, 0.400},
+    {13, 13, 13, 69, 1.262, -0.198, 0.465},
+    {13, 13, 13, 97, 1.964, 0.000, 0.659},
+    {13, 13, 13, 98, 0.000, 0.000, 0.000},
+    {13, 13, 15, 17, -0.759, -0.282, 0.680},
+    {13, 13, 16, 13, 0.925, -0.576, 0.677},
+    {13, 13, 16, 16, 1.941, -0.836, 0.935},
+    {13, 13, 19, 19, 0.000, 0.000, 0.000},
+    {13, 13, 29, 3, -1.220, -0.126, 0.422},
+    {13, 13, 29, 13, 0.650, -0.250, 0.670},
+    {13, 13, 29, 54, -1.420, -0.620, 0.100},
+    {13, 13, 33, 13, 0.416, -0.128, 0.695},
+    {13, 13, 33, 34, -0.190, -0.417, 0.418},
+    {13, 13, 35, 3, 0.000, 0.462, 0.000},
+    {13, 13, 35, 13, 4.753, -0.734, 0.000},
+    {13, 13, 35, 34, 0.000, 0.000, 0.000},
+    {13, 13, 35, 49, 0.000, 0.000, 0.000},
+    {13, 13, 35, 69, 2.929, -2.533, 0.497},
+    {13, 13, 35, 81, 2.300, 6.089, 0.000},
+    {13, 13, 37, 13, 2.817, -0.169, 0.543},
+    {13, 13, 37, 37, 0.346, 0.405, -0.904},
+    {13, 13, 37, 40, 0.346, 0.405, -0.904},
+    {13, 13, 38, 38, 0.000, 0.000, 0.000},
+    {13, 13, 38, 46, -0.500, 0.500, -0.500},
+    {13, 13, 40, 40, 0.346, 0.405, -0.904},
+    {13, 13, 41, 0, 1.711, -0.500, 0.663},
+    {13, 13, 41, 36, 0.000, 0.000, 0.300},
+    {13, 13, 43, 13, 1.438, -0.124, 0.264},
+    {13, 13, 43, 34, 0.000, 0.000, 0.347},
+    {13, 13, 43, 44, 0.000, 0.000, 0.347},
+    {13, 13, 45, 34, -0.190, -0.417, 0.418},
+    {13, 13, 45, 38, 1.829, 0.243, -0.498},
+    {13, 13, 45, 44, -0.190, -0.417, 0.418},
+    {13, 13, 46, 18, 0.000, 0.000, 0.000},
+    {13, 13, 47, 0, 1.000, -0.350, 0.000},
+    {13, 13, 47, 52, 2.756, -0.872, -3.680},
+    {13, 13, 47, 72, -1.000, -0.350, 0.000},
+    {13, 13, 49, 0, 0.000, 0.000, 0.000},
+    {13, 13, 49, 46, 0.000, 0.500, -0.500},
+    {13, 13, 52, 0, 0.000, 0.000, 0.000},
+    {13, 13, 69, 13, 0.000, 0.000, 0.000},
+    {13, 13, 69, 32, 0.000, 0.000, 0.000},
+    {13, 13, 70, 0, 0.000, 0.000, 0.000},
+    {13, 13, 70, 50, 0.000, 0.000, 0.000},
+    {13, 13, 70, 74, -0.714, 0.000, 0.000},
+    {13, 13, 72, 0, 0.000, 0.000, 0.000},
+    {13, 13, 73, 0, 0.000, 0.000, 0.000},
+    {13, 13, 74, 0, 0.000, 0.000, 0.000},
+    {13, 13, 74, 47, 1.700, -0.600, 0.000},
+    {13, 13, 75, 0, 0.000, 0.000, 0.000},
+    {13, 13, 75, 47, 1.700, -0.600, 0.000},
+    {13, 13, 77, 0, 0.000, 0.000, 0.000},
+    {13, 13, 78, 0, 0.000, 0.000, 0.000},
+    {13, 13, 85, 13, 0.000, -1.000, 0.000},
+    {13, 13, 85, 36, 0.000, -1.000, 0.000},
+    {13, 13, 92, 93, 0.000, 0.400, 0.000},
+    {13, 13, 94, 13, 1.000, -0.500, 0.500},
+    {13, 13, 95, 0, 1.000, -0.350, 0.000},
+    {13, 13, 95, 52, -1.000, -0.350, 0.000},
+    {13, 13, 95, 72, -1.000, -0.350, 0.000},
+    {13, 13, 97, 3, -1.396, -0.427, 0.000},
+    {13, 13, 97, 13, 4.753, -0.734, 0.000},
+    {13, 13, 98, 13, 1.000, 0.000, 0.000},
+    {13, 13, 98, 34, 0.000, 0.000, 0.260},
+    {13, 13, 99, 99, 0.346, 0.405, -0.904},
+    {13, 16, 16, 13, 0.000, -7.414, 1.705},
+    {13, 16, 38, 38, 0.000, 0.600, 0.000},
+    {13, 16, 38, 46, 1.600, 5.100, 0.000},
+    {13, 16, 49, 46, 0.000, 4.800, 0.000},
+    {13, 19, 19, 13, 0.000, 0.000, 0.000},
+    {13, 19, 19, 36, 0.000, 0.000, 0.000},
+    {13, 19, 19, 37, 0.000, 0.000, 0.000},
+    {13, 19, 19, 99, 0.000, 0.000, 0.000},
+    {13, 29, 33, 13, 0.000, 0.000, 0.300},
+    {13, 29, 33, 34, 0.000, 0.000, 0.300},
+    {13, 29, 37, 13, 0.650, -0.250, 0.670},
+    {13, 29, 37, 36, 0.000, 0.000, 0.760},
+    {13, 29, 37, 37, -3.500, 3.000, 0.000},
+    {13, 29, 37, 40, -3.500, 3.000, 0.000},
+    {13, 29, 38, 38, 0.000, 3.000, 0.000},
+    {13, 29, 38, 46, 0.400, 5.500, 0.000},
+    {13, 29, 41, 5, -0.375, -1.358, 0.004},
+    {13, 29, 41, 13, 0.650, -0.250, 0.670},
+    {13, 29, 41, 29, -0.375, -1.358, 0.004},
+    {13, 29, 41, 36, 0.000, 0.000, 0.760},
+    {13, 29, 46, 3, 3.000, 3.000, 0.000},
+    {13, 29, 49, 46, 0.000, 5.200, 0.000},
+    {13, 29, 54, 13, 3.500, -3.300, 1.500},
+    {13, 29, 54, 42, 0.000, 0.000, 0.000},
+    {13, 33, 33, 13, 0.000, 0.000, 0.300},
+    {13, 33, 33, 34, 0.000, 0.000, 0.300},
+    {13, 33, 38, 38, -7.582, 3.431, 3.198},
+    {13, 35, 38, 38, 0.000, 2.100, 0.000},
+    {13, 35, 69, 38, 2.074, -2.966, 2.473},
+    {13, 35, 72, 51, 0.000, 2.100, 0.000},
+    {13, 37, 37, 13, 0.000, 14.000, 0.000},
+    {13, 37, 37, 19, 0.000, 14.000, 0.000},
+    {13, 37, 37, 29, 0.000, 14.000, 0.000},
+    {13, 37, 37, 36, 0.000, 14.000, 0.000},
+    {13, 37, 38, 38, 0.205, -0.531, 0.000},
+    {13, 37, 40, 13, 0.000, 14.000, 0.000},
+    {13, 37, 40, 36, 0.000, 14.000, 0.000},
+    {13, 37, 40, 38, 0.000, 14.000, 0.000},
+    {13, 37, 40, 40, 0.000, 14.000, 0.000},
+    {13, 37, 40, 99, 0.000, 14.000, 0.000},
+    {13, 37, 100, 37, 0.000, 0.000, 0.000},
+    {13, 38, 38, 13, 0.000, 7.250, 0.000},
+    {13, 38, 38, 38, 0.000, 7.250, 0.000},
+    {13, 38, 38, 39, 0.000, 7.250, 0.000},
+    {13, 38, 38, 40, 0.000, 7.250, 0.000},
+    {13, 40, 40, 13, 0.000, 0.000, 0.300},
+    {13, 40, 40, 36, 0.000, 0.000, 0.300},
+    {13, 40, 40, 37, 0.000, 0.000, -0.372},
+    {13, 40, 99, 13, 0.000, 0.000, 0.300},
+    {13, 40, 99, 99, 0.000, 0.000, -0.372},
+    {13, 43, 72, 51, 0.000, 2.100, 0.000},
+    {13, 46, 46, 13, 0.000, 7.250, 0.000},
+    {13, 46, 46, 38, 0.000, 7.250, 0.000},
+    {13, 81, 81, 13, 0.000, 0.000, 0.000},
+    {13, 81, 81, 36, 0.000, 0.000, 0.000},
+    {13, 99, 99, 13, 0.000, 14.000, 0.000},
+    {13, 99, 99, 36, 0.000, 14.000, 0.000},
+    {13, 99, 99, 38, 0.000, 14.000, 0.000},
+    {13, 99, 99, 40, 0.000, 14.000, 0.000},
+    {13, 99, 99, 99, 0.000, 14.000, 0.000},
+    {15, 13, 13, 36, 0.000, 0.000, 0.452},
+    {15, 13, 13, 43, 1.428, 0.086, 0.029},
+    {16, 13, 13, 36, 0.000, 0.000, 0.452},
+    {16, 13, 13, 43, 1.428, 0.086, 0.029},
+    {16, 72, 76, 38, 0.000, 2.170, 0.000},
+    {16, 74, 74, 39, 0.000, 10.750, 0.000},
+    {16, 74, 76, 38, 0.000, 2.170, 0.000},
+    {16, 74, 78, 39, 0.000, 10.750, 0.000},
+    {16, 74, 78, 51, 0.000, 7.250, 0.000},
+    {17, 15, 38, 0, 0.000, 1.100, 0.000},
+    {17, 15, 38, 38, 0.000, 1.100, 0.000},
+    {18, 18, 46, 13, 0.000, 0.000, 0.000},
+    {18, 18, 46, 36, 0.000, 0.000, 0.000},
+    {19, 13, 13, 36, 0.000, 0.000, 0.366},
+    {19, 18, 38, 0, 0.000, 0.000, 0.000},
+    {19, 18, 38, 38, 0.000, 0.000, 0.000},
+    {19, 19, 37, 13, 0.000, 0.000, 0.000},
+    {19, 19, 37, 36, 0.000, 0.000, 0.000},
+    {19, 19, 37, 37, 0.000, 0.000, 0.000},
+    {19, 37, 37, 36, 0.000, 14.000, 0.000},
+    {29, 3, 13, 13, 0.000, 0.000, -0.553},
+    {29, 3, 13, 36, 0.000, 0.000, 0.132},
+    {29, 3, 35, 13, 2.300, 6.089, 0.000},
+    {29, 3, 35, 34, 0.000, 4.900, 0.000},
+    {29, 3, 38, 38, 0.000, 2.100, 0.000},
+    {29, 13, 13, 29, -0.550, 0.000, 0.000},
+    {29, 13, 13, 36, 0.000, 0.000, 0.468},
+    {29, 13, 47, 0, 1.500, -1.500, 0.000},
+    {29, 13, 47, 52, -1.500, -1.500, 0.000},
+    {29, 13, 47, 72, -1.500, -1.500, 0.000},
+    {29, 13, 95, 0, 1.500, -1.500, 0.000},
+    {29, 13, 95, 52, 3.132, -1.491, 2.744},
+    {29, 13, 95, 72, -1.500, -1.500, 0.000},
+    {29, 37, 37, 36, 0.000, 14.000, 0.000},
+    {29, 72, 76, 38, 0.000, 2.170, 0.000},
+    {29, 74, 76, 38, 0.000, 2.170, 0.000},
+    {29, 74, 78, 51, 0.000, 7.250, 0.000},
+    {30, 3, 13, 13, 0.000, 0.000, 0.000},
+    {30, 3, 13, 36, 0.000, 0.000, 0.360},
+    {30, 13, 13, 30, -0.250, 0.000, 0.000},
+    {30, 13, 13, 33, 2.000, 0.000, 0.000},
+    {30, 13, 13, 36, 0.000, 0.000, 0.400},
+    {30, 13, 38, 38, 0.000, -0.400, 0.000},
+    {30, 13, 74, 0, 0.000, -0.400, 0.000},
+    {30, 13, 77, 0, 0.000, -0.400, 0.000},
+    {30, 37, 37, 30, -1.600, 14.000, 0.000},
+    {30, 37, 37, 36, 0.000, 14.000, 0.000},
+    {30, 38, 38, 38, 0.000, 7.250, 0.000},
+    {30, 38, 38, 39, 0.000, 7.250, 0.000},
+    {33, 13, 13, 33, 11.035, -0.968, 0.270},
+    {33, 13, 13, 36, -1.013, -0.709, 0.473},
+    {33, 13, 13, 38, -0.800, 0.000, 0.000},
+    {33, 38, 38, 39, 0.000, 7.250, 0.000},
+    {34, 33, 33, 34, 0.000, 0.000, 0.300},
+    {34, 33, 38, 38, 0.000, 2.030, 0.000},
+    {34, 33, 72, 16, 0.000, 2.100, 0.000},
+    {34, 33, 72, 51, 0.000, 2.100, 0.000},
+    {34, 35, 38, 38, 0.000, 2.100, 0.000},
+    {34, 35, 49, 0, 0.000, 7.250, 0.000},
+    {34, 35, 69, 38, 1.671, -4.901, 0.669},
+    {34, 35, 72, 16, 0.000, 2.100, 0.000},
+    {34, 35, 72, 29, 0.000, 2.100, 0.000},
+    {34, 35, 72, 51, 0.000, 2.100, 0.000},
+    {34, 35, 74, 16, 0.000, 2.100, 0.000},
+    {34, 35, 74, 29, 0.000, 2.100, 0.000},
+    {34, 35, 81, 36, 0.000, 0.000, 0.000},
+    {34, 35, 81, 79, 0.000, 0.000, 0.000},
+    {34, 35, 81, 81, 0.000, 0.000, 0.000},
+    {34, 45, 49, 0, 0.000, 2.030, 0.000},
+    {34, 47, 50, 0, 0.000, 5.000, 0.000},
+    {34, 47, 72, 0, 0.000, 5.000, 0.000},
+    {34, 47, 74, 0, 0.000, 5.000, 0.000},
+    {35, 3, 3, 36, -0.900, 0.300, 0.000},
+    {35, 3, 5, 7, -2.000, 5.000, 0.000},
+    {35, 3, 13, 13, 1.173, 0.189, -1.200},
+    {35, 3, 13, 30, 0.650, 0.000, 0.000},
+    {35, 3, 13, 35, 1.816, 1.222, 1.581},
+    {35, 3, 13, 36, 0.000, 0.000, 0.000},
+    {35, 3, 13, 43, 1.816, 1.222, 1.581},
+    {35, 3, 29, 13, -2.000, 5.000, 0.000},
+    {35, 3, 35, 3, 2.300, 6.089, 0.000},
+    {35, 3, 35, 13, 4.600, 0.000, 0.000},
+    {35, 3, 35, 34, 0.000, 4.900, 0.000},
+    {35, 3, 37, 36, 0.000, 0.000, 0.000},
+    {35, 3, 37, 37, 2.000, 0.000, 0.000},
+    {35, 3, 38, 38, 0.000, 1.100, 0.000},
+    {35, 3, 77, 74, 0.000, 1.100, 0.000},
+    {35, 3, 77, 77, 0.000, 1.100, 0.000},
+    {35, 13, 13, 36, 0.000, 0.000, 0.464},
+    {35, 13, 13, 38, 0.845, -0.962, 0.713},
+    {35, 13, 13, 70, 0.845, -0.962, 0.713},
+    {35, 13, 13, 73, 0.845, -0.962, 0.713},
+    {35, 13, 13, 74, 0.845, -0.962, 0.713},
+    {35, 13, 13, 75, 0.845, -0.962, 0.713},
+    {35, 37, 40, 3, 0.000, 14.000, 0.000},
+    {36, 3, 3, 36, 0.000, 0.000, 0.300},
+    {36, 3, 5, 7, 1.500, 5.500, 0.000},
+    {36, 3, 13, 13, 0.000, 0.000, 0.000},
+    {36, 3, 13, 36, 0.000, 0.000, 0.360},
+    {36, 3, 29, 13, 4.669, 5.124, 0.000},
+    {36, 3, 35, 13, 2.300, 6.089, 0.000},
+    {36, 3, 35, 34, 0.000, 4.900, 0.000},
+    {36, 3, 38, 38, 0.000, 0.200, 0.000},
+    {36, 3, 46, 0, 0.000, 14.000, 0.000},
+    {36, 3, 46, 34, 0.000, 14.000, 0.000},
+    {36, 13, 13, 36, 0.000, 0.000, 0.300},
+    {36, 13, 13, 37, 0.000, 0.000, 0.366},
+    {36, 13, 13, 38, 0.000, 0.000, 0.462},
+    {36, 13, 13, 41, 0.000, 0.000, 0.300},
+    {36, 13, 13, 43, 0.000, 0.000, 0.384},
+    {36, 13, 13, 45, 0.000, 0.000, -0.582},
+    {36, 13, 13, 49, 0.000, 0.000, 0.462},
+    {36, 13, 13, 52, 0.000, 0.000, 0.462},
+    {36, 13, 13, 55, 0.000, 0.000, 0.400},
+    {36, 13, 13, 56, 0.000, 0.000, 0.400},
+    {36, 13, 13, 69, 0.000, 0.000, 0.452},
+    {36, 13, 13, 70, 0.000, 0.000, 0.462},
+    {36, 13, 13, 72, 0.000, 0.000, 0.462},
+    {36, 13, 13, 73, 0.000, 0.000, 0.462},
+    {36, 13, 13, 74, 0.000, 0.000, 0.462},
+    {36, 13, 13, 75, 0.000, 0.000, 0.462},
+    {36, 13, 13, 77, 0.000, 0.000, 0.462},
+    {36, 13, 13, 78, 0.000, 0.000, 0.462},
+    {36, 13, 13, 92, 0.000, 0.000, -0.225},
+    {36, 13, 13, 94, 0.000, 0.000, 0.300},
+    {36, 13, 13, 97, 0.000, 0.000, 0.464},
+    {36, 13, 13, 98, 0.000, 0.000, 0.450},
+    {36, 13, 13, 99, 0.000, 0.000, 0.366},
+    {36, 13, 15, 17, 0.000, 0.000, 0.480},
+    {36, 13, 16, 13, 0.000, 0.000, 0.647},
+    {36, 13, 16, 16, 0.000, 0.000, 0.558},
+    {36, 13, 16, 38, 0.000, 0.000, 0.647},
+    {36, 13, 18, 19, 0.000, 0.000, 0.000},
+    {36, 13, 19, 19, 0.000, 0.000, 0.000},
+    {36, 13, 29, 0, 0.000, 0.000, 0.760},
+    {36, 13, 29, 3, 0.000, 0.000, 0.198},
+    {36, 13, 29, 37, 0.000, 0.000, 0.760},
+    {36, 13, 29, 38, 0.000, 0.000, 0.760},
+    {36, 13, 29, 41, 0.000, 0.000, 0.760},
+    {36, 13, 29, 54, 0.000, 0.000, 0.300},
+    {36, 13, 33, 13, 0.000, 0.000, 0.560},
+    {36, 13, 33, 34, 0.000, 0.000, 0.400},
+    {36, 13, 33, 38, 0.000, 0.000, 0.560},
+    {36, 13, 35, 3, 0.000, 0.000, 0.000},
+    {36, 13, 35, 13, 0.000, 0.000, 0.000},
+    {36, 13, 35, 34, 0.000, 0.000, 0.000},
+    {36, 13, 35, 38, 0.000, 0.000, 0.000},
+    {36, 13, 35, 69, 1.362, -1.457, 0.149},
+    {36, 13, 37, 13, 0.000, 0.000, 0.300},
+    {36, 13, 37, 36, 0.000, 0.000, 0.318},
+    {36, 13, 37, 37, 0.000, 0.000, -0.372},
+    {36, 13, 37, 40, 0.000, 0.000, -0.372},
+    {36, 13, 37, 100, 0.000, 0.000, -0.250},
+    {36, 13, 38, 38, 0.000, 0.000, 0.000},
+    {36, 13, 40, 37, 0.000, 0.000, -0.372},
+    {36, 13, 40, 40, 0.000, 0.000, -0.372},
+    {36, 13, 40, 99, 0.000, 0.000, -0.372},
+    {36, 13, 41, 29, 0.000, 0.000, 0.468},
+    {36, 13, 43, 13, 0.000, 0.000, 0.302},
+    {36, 13, 43, 34, 0.000, 0.000, 0.261},
+    {36, 13, 43, 38, 0.000, 0.000, 0.462},
+    {36, 13, 43, 44, 0.000, 0.000, 0.300},
+    {36, 13, 45, 13, 0.000, 0.000, 0.000},
+    {36, 13, 45, 34, 0.000, 0.000, 0.000},
+    {36, 13, 45, 38, 0.000, 0.000, 0.177},
+    {36, 13, 45, 44, 0.000, 0.000, 0.000},
+    {36, 13, 49, 0, 0.000, 0.000, 0.000},
+    {36, 13, 52, 0, 0.000, 0.000, 0.000},
+    {36, 13, 54, 29, 0.000, 0.000, 0.250},
+    {36, 13, 54, 42, 0.000, 0.000, 0.250},
+    {36, 13, 69, 5, 0.000, 0.000, 0.350},
+    {36, 13, 69, 13, 0.000, 0.000, 0.350},
+    {36, 13, 69, 32, 0.000, 0.000, 0.350},
+    {36, 13, 69, 38, 0.000, 0.000, 0.350},
+    {36, 13, 70, 0, 0.000, 0.000, 0.000},
+    {36, 13, 70, 50, 0.000, 0.000, 0.000},
+    {36, 13, 70, 74, 0.000, 0.000, -0.480},
+    {36, 13, 72, 0, 0.000, 0.000, 0.000},
+    {36, 13, 73, 0, 0.000, 0.000, 0.000},
+    {36, 13, 74, 0, 0.000, 0.000, 0.000},
+    {36, 13, 75, 0, 0.000, 0.000, 0.000},
+    {36, 13, 77, 0, 0.000, 0.000, 0.000},
+    {36, 13, 78, 0, 0.000, 0.000, 0.000},
+    {36, 13, 80, 0, 0.000, 0.000, 0.000},
+    {36, 13, 81, 81, 0.000, 0.000, 0.300},
+    {36, 13, 92, 93, 0.000, 0.000, 0.000},
+    {36, 13, 94, 13, 0.000, 0.000, 0.300},
+    {36, 13, 97, 3, 0.000, 0.000, -0.139},
+    {36, 13, 97, 13, 0.000, 0.000, 0.000},
+    {36, 13, 97, 38, 0.000, 0.000, 0.000},
+    {36, 13, 98, 13, 0.000, 0.000, 0.180},
+    {36, 13, 98, 29, 0.000, 0.000, 0.000},
+    {36, 13, 98, 34, 0.000, 0.000, 0.180},
+    {36, 13, 99, 13, 0.000, 0.000, 0.300},
+    {36, 13, 99, 36, 0.000, 0.000, 0.318},
+    {36, 13, 99, 99, 0.000, 0.000, -0.372},
+    {36, 19, 19, 37, 0.000, 0.000, 0.000},
+    {36, 19, 19, 99, 0.000, 0.000, 0.000},
+    {36, 37, 37, 36, 0.000, 14.000, 0.000},
+    {36, 37, 37, 38, 0.000, 14.000, 0.000},
+    {36, 37, 38, 38, 0.000, 0.000, -0.372},
+    {36, 37, 38, 46, 0.000, 0.000, -0.372},
+    {36, 37, 40, 13, 0.000, 14.000, 0.000},
+    {36, 37, 40, 36, 0.000, 14.000, 0.000},
+    {36, 37, 40, 38, 0.000, 14.000, 0.000},
+    {36, 37, 40, 40, 0.000, 14.000, 0.000},
+    {36, 37, 40, 99, 0.000, 14.000, 0.000},
+    {36, 37, 100, 37, 0.000, 0.000, 0.000},
+    {36, 40, 40, 36, 0.000, 0.000, 0.300},
+    {36, 40, 40, 37, 0.000, 0.000, -0.372},
+    {36, 40, 99, 13, 0.000, 0.000, 0.300},
+    {36, 40, 99, 36, 0.000, 0.000, 0.300},
+    {36, 40, 99, 99, 0.000, 0.000, -0.372},
+    {36, 81, 81, 36, 0.000, 0.000, 0.000},
+    {36, 81, 81, 81, 0.000, 0.000, 0.000},
+    {36, 99, 99, 36, 0.000, 14.000, 0.000},
+    {36, 99, 99, 38, 0.000, 14.000, 0.000},
+    {36, 99, 99, 40, 0.000, 14.000, 0.000},
+    {36, 99, 99, 99, 0.000, 14.000, 0.000},
+    {37, 3, 35, 34, 0.000, 4.900, 0.000},
+    {37, 13, 37, 13, 0.000, -8.000, 0.000},
+    {37, 13, 37, 36, 0.000, -8.000, 0.000},
+    {37, 35, 76, 38, 0.000, 2.170, 0.000},
+    {37, 35, 76, 46, 0.000, 2.170, 0.000},
+    {37, 36, 37, 13, 0.000, -8.000, 0.000},
+    {37, 36, 37, 36, 0.000, -8.000, 0.000},
+    {37, 37, 38, 38, 1.241, 3.353, -0.286},
+    {37, 38, 38, 39, 0.000, 7.250, 0.000},
+    {37, 40, 40, 37, 1.423, 4.055, 0.858},
+    {37, 40, 99, 13, 0.000, 0.000, -0.372},
+    {37, 40, 99, 36, 0.000, 0.000, -0.372},
+    {37, 40, 99, 99, 1.423, 4.055, 0.858},
+    {38, 3, 5, 7, 4.000, 5.000, 0.000},
+    {38, 3, 13, 36, 0.000, 0.000, 0.275},
+    {38, 3, 29, 13, 4.000, 5.000, 0.000},
+    {38, 3, 35, 34, 0.000, 4.900, 0.000},
+    {38, 3, 35, 38, 2.300, 6.089, 0.000},
+    {38, 3, 35, 74, 2.300, 6.089, 0.000},
+    {38, 3, 35, 77, 2.300, 6.089, 0.000},
+    {38, 3, 76, 38, 0.000, 2.170, 0.000},
+    {38, 13, 13, 43, 1.000, 0.000, 0.000},
+    {38, 13, 35, 49, 0.000, 0.000, 0.000},
+    {38, 13, 54, 29, 2.250, 0.000, 0.000},
+    {38, 13, 54, 42, 0.000, 0.000, 0.000},
+    {38, 29, 54, 4, 0.000, 0.000, 0.000},
+    {38, 33, 72, 16, 0.000, 2.100, 0.000},
+    {38, 33, 72, 51, 0.000, 2.100, 0.000},
+    {38, 35, 72, 16, 0.000, 2.100, 0.000},
+    {38, 35, 72, 29, 0.000, 2.100, 0.000},
+    {38, 35, 72, 51, 0.000, 2.100, 0.000},
+    {38, 35, 74, 16, 0.000, 2.100, 0.000},
+    {38, 35, 74, 29, 0.000, 2.100, 0.000},
+    {38, 38, 38, 38, 0.000, 7.250, 0.000},
+    {38, 38, 38, 39, 0.000, 7.250, 0.000},
+    {38, 38, 38, 40, 0.000, 7.250, 0.000},
+    {38, 38, 38, 45, 0.0, 1.62, 0.0},
+    {38, 38, 38, 50, 0.000, 7.250, 0.000},
+    {38, 38, 38, 55, 0.000, 7.250, 0.000},
+    {38, 38, 38, 56, 0.000, 7.250, 0.000},
+    {38, 38, 38, 76, 0.000, 7.250, 0.000},
+    {38, 38, 38, 99, 0.000, 7.250, 0.000},
+    {38, 38, 40, 36, 0.000, 0.000, -0.372},
+    {38, 38, 40, 37, 1.241, 3.353, -0.286},
+    {38, 38, 43, 13, 0.000, 0.000, 0.000},
+    {38, 38, 43, 44, 0.000, 0.000, 0.000},
+    {38, 38, 45, 34, 0.000, 3.900, 0.000},
+    {38, 38, 46, 38, 0.000, 7.250, 0.000},
+    {38, 38, 69, 13, 0.000, -0.900, 0.000},
+    {38, 38, 69, 35, 1.656, -0.768, -0.117},
+    {38, 38, 76, 38, 0.000, 7.250, 0.000},
+    {38, 38, 76, 46, 0.000, 7.250, 0.000},
+    {38, 38, 76, 76, 0.000, 7.250, 0.000},
+    {38, 38, 92, 93, 0.000, 1.150, 0.000},
+    {38, 38, 99, 13, 0.205, -0.531, 0.000},
+    {38, 38, 99, 36, 0.000, 0.000, -0.372},
+    {38, 38, 99, 99, 1.241, 3.353, -0.286},
+    {38, 43, 72, 51, 0.000, 2.100, 0.000},
+    {38, 46, 46, 38, 0.000, 7.250, 0.000},
+    {38, 46, 76, 38, 0.000, 7.250, 0.000},
+    {38, 46, 76, 76, 0.000, 7.250, 0.000},
+    {38, 50, 77, 74, 0.000, 7.250, 0.000},
+    {38, 76, 76, 38, 0.000, 2.170, 0.000},
+    {38, 76, 76, 46, 0.000, 2.170, 0.000},
+    {38, 76, 77, 0, 0.000, 2.170, 0.000},
+    {38, 76, 78, 0, 0.000, 2.170, 0.000},
+    {38, 76, 78, 51, 0.000, 2.170, 0.000},
+    {38, 99, 99, 38, 0.000, 14.000, 0.000},
+    {38, 99, 99, 40, 0.000, 14.000, 0.000},
+    {38, 99, 99, 99, 0.000, 14.000, 0.000},
+    {39, 37, 76, 0, 0.000, 7.250, 0.000},
+    {39, 37, 76, 35, 0.000, 7.250, 0.000},
+    {39, 38, 38, 39, 0.000, 7.250, 0.000},
+    {39, 38, 38, 40, 0.000, 7.250, 0.000},
+    {39, 38, 38, 50, 0.000, 7.250, 0.000},
+    {39, 38, 38, 55, 0.000, 7.250, 0.000},
+    {39, 38, 38, 56, 0.000, 7.250, 0.000},
+    {39, 38, 38, 76, 0.000, 7.250, 0.000},
+    {39, 38, 38, 99, 0.000, 7.250, 0.000},
+    {39, 38, 46, 38, 0.000, 7.250, 0.000},
+    {39, 38, 76, 38, 0.000, 7.250, 0.000},
+    {39, 38, 76, 46, 0.000, 7.250, 0.000},
+    {39, 38, 76, 76, 0.000, 7.250, 0.000},
+    {39, 38, 78, 39, 0.000, 7.250, 0.000},
+    {39, 73, 74, 0, 0.000, 10.750, 0.000},
+    {39, 73, 74, 16, 0.000, 10.750, 0.000},
+    {39, 73, 74, 39, 0.000, 10.750, 0.000},
+    {39, 74, 74, 39, 0.000, 10.750, 0.000},
+    {39, 74, 77, 39, 0.000, 7.250, 0.000},
+    {39, 74, 78, 0, 0.000, 7.250, 0.000},
+    {39, 74, 78, 51, 0.000, 7.250, 0.000},
+    {39, 77, 77, 39, 0.000, 7.250, 0.000},
+    {40, 99, 99, 40, 0.000, 14.000, 0.000},
+    {40, 99, 99, 99, 0.000, 14.000, 0.000},
+    {42, 3, 13, 13, 0.000, 0.820, 0.000},
+    {42, 3, 13, 33, 0.000, 0.820, 0.000},
+    {42, 3, 13, 35, 0.000, 0.820, 0.000},
+    {42, 3, 13, 36, 0.000, 0.000, 0.000},
+    {43, 13, 13, 73, 1.000, 0.000, 0.000},
+    {43, 13, 13, 74, 1.000, 0.000, 0.000},
+    {43, 13, 13, 75, 1.000, 0.000, 0.000},
+    {45, 38, 45, 13, 0.000, 7.936, 0.000},
+    {45, 38, 45, 34, 0.000, 3.900, 0.000},
+    {45, 38, 45, 44, 0.000, 3.900, 0.000},
+    {46, 13, 29, 13, -0.500, -1.500, 1.000},
+    {46, 38, 38, 76, 0.000, 7.250, 0.000},
+    {46, 38, 40, 36, 0.000, 0.000, -0.372},
+    {46, 38, 40, 37, 1.241, 3.353, -0.286},
+    {46, 38, 76, 38, 0.000, 7.250, 0.000},
+    {46, 38, 76, 76, 0.000, 7.250, 0.000},
+    {46, 38, 91, 13, 0.000, 3.651, 0.000},
+    {46, 76, 78, 0, 0.000, 2.170, 0.000},
+    {47, 13, 29, 13, -0.500, -1.500, 1.000},
+    {47, 72, 76, 38, 0.000, 2.170, 0.000},
+    {47, 74, 76, 38, 0.000, 2.170, 0.000},
+    {49, 33, 38, 38, 0.000, 2.100, 0.000},
+    {49, 35, 38, 38, 0.000, 2.100, 0.000},
+    {50, 38, 45, 34, 0.000, 2.030, 0.000},
+    {50, 50, 77, 74, 0.000, 7.250, 0.000},
+    {51, 47, 76, 38, 0.000, 2.170, 0.000},
+    {51, 72, 76, 38, 0.000, 2.170, 0.000},
+    {51, 73, 74, 16, 0.000, 7.250, 0.000},
+    {51, 73, 74, 29, 0.000, 7.250, 0.000},
+    {51, 73, 74, 39, 0.000, 7.250, 0.000},
+    {51, 73, 76, 38, 0.000, 2.170, 0.000},
+    {51, 73, 77, 0, 0.000, 2.170, 0.000},
+    {54, 13, 38, 38, 0.000, 0.000, 0.000},
+    {54, 29, 38, 38, 0.000, 2.990, 0.000},
+    {55, 3, 13, 13, 0.000, 0.000, 0.000},
+    {55, 3, 13, 36, 0.000, 0.000, 0.360},
+    {55, 13, 38, 38, 0.000, 0.000, 0.400},
+    {72, 3, 72, 47, -2.000, 1.000, 0.000},
+    {72, 3, 72, 51, 0.000, 1.000, 0.000},
+    {72, 16, 74, 39, 0.000, 7.250, 0.000},
+    {72, 16, 74, 73, 0.000, 7.250, 0.000},
+    {72, 16, 74, 78, 0.000, 7.250, 0.000},
+    {72, 29, 74, 78, 0.000, 7.250, 0.000},
+    {72, 33, 38, 38, 0.000, 2.100, 0.000},
+    {72, 35, 38, 38, 0.000, 2.100, 0.000},
+    {72, 51, 73, 39, 0.000, 7.250, 0.000},
+    {72, 51, 73, 74, 0.000, 7.250, 0.000},
+    {72, 51, 78, 74, 0.000, 7.250, 0.000},
+    {73, 51, 72, 16, 0.000, 7.250, 0.000},
+    {74, 3, 35, 38, 2.300, 6.089, 0.000},
+    {74, 3, 35, 74, 2.300, 6.089, 0.000},
+    {74, 3, 35, 77, 2.300, 6.089, 0.000},
+    {74, 3, 74, 29, 0.000, 1.500, 0.000},
+    {74, 3, 74, 77, 0.000, 1.500, 0.000},
+    {74, 16, 72, 0, 0.000, 7.250, 0.000},
+    {74, 16, 72, 51, 0.000, 7.250, 0.000},
+    {74, 29, 72, 51, 0.000, 7.250, 0.000},
+    {74, 29, 74, 39, 0.000, 7.250, 0.000},
+    {74, 29, 74, 77, 0.000, 7.250, 0.000},
+    {74, 33, 38, 38, 0.000, 2.100, 0.000},
+    {74, 35, 38, 38, 0.000, 2.100, 0.000},
+    {74, 47, 76, 38, 0.000, 2.170, 0.000},
+    {74, 73, 77, 0, 0.000, 2.170, 0.000},
+    {77, 3, 35, 34, 0.000, 4.900, 0.000},
+    {77, 3, 35, 38, 2.300, 6.089, 0.000},
+    {77, 3, 35, 74, 2.300, 6.089, 0.000},
+    {77, 3, 35, 77, 2.300, 6.089, 0.000},
+    {78, 51, 72, 16, 0.000, 7.250, 0.000},
+    {78, 51, 72, 29, 0.000, 7.250, 0.000},
+    {80, 79, 81, 36, 0.000, 0.000, 0.000},
+    {80, 79, 81, 81, 0.000, 0.000, 0.000},
+    {81, 79, 80, 13, 2.300, 6.089, 0.000},
+    {81, 79, 80, 34, 0.000, 4.900, 0.000},
+    {81, 79, 80, 38, 2.300, 6.089, 0.000},
+    {81, 79, 80, 81, 2.300, 6.089, 0.000},
+    {81, 81, 81, 81, 0.000, 0.000, 0.000},
+    {97, 3, 13, 36, 0.000, 0.000, 0.000},
+    {97, 3, 37, 36, 0.000, 0.000, 0.000},
+    {97, 3, 37, 37, 2.000, 0.000, 0.000},
+    {98, 13, 13, 98, 5.200, -0.500, 0.000},
+    {98, 29, 98, 13, 0.000, 0.000, 0.000},
+    {98, 29, 98, 29, 0.000, 0.000, 0.000},
+    {99, 99, 99, 99, 1.423, 4.055, 0.858},
+};
+
+const OplsVanDerWaalsData VanDerWaalsData[] = {
+    {1, {2.9400, 0.0610}},
+    {2, {3.9050, 0.1180}},
+    {3, {3.7500, 0.1050}},
+    {4, {2.9600, 0.2100}},
+    {5, {3.0000, 0.1700}},
+    {6, {3.9100, 0.1600}},
+    {7, {0.0000, 0.0000}},
+    {8, {3.7300, 0.2940}},
+    {9, {3.7750, 0.2070}},
+    {10, {3.9050, 0.1750}},
+    {11, {3.9100, 0.1600}},
+    {12, {3.9600, 0.1450}},
+    {13, {3.9050, 0.1180}},
+    {14, {3.8500, 0.1400}},
+    {15, {3.8500, 0.0800}},
+    {16, {3.8000, 0.1150}},
+    {17, {3.7500, 0.1100}},
+    {18, {3.8000, 0.0500}},
+    {19, {3.7500, 0.1050}},
+    {20, {3.0700, 0.1700}},
+    {21, {0.0000, 0.0000}},
+    {22, {3.7750, 0.2070}},
+    {23, {3.9050, 0.1180}},
+    {24, {3.7000, 0.2500}},
+    {25, {3.5500, 0.2500}},
+    {26, {3.5500, 0.2500}},
+    {27, {3.5500, 0.2500}},
+    {28, {0.0000, 0.0000}},
+    {29, {0.0000, 0.0000}},
+    {30, {3.7750, 0.2070}},
+    {31, {3.9050, 0.1180}},
+    {32, {3.8000, 0.1700}},
+    {33, {3.8000, 0.1180}},
+    {34, {3.8000, 0.1700}},
+    {35, {3.8000, 0.1180}},
+    {36, {3.2000, 0.1700}},
+    {37, {3.6500, 0.1500}},
+    {38, {3.7750, 0.2070}},
+    {39, {3.1200, 0.1600}},
+    {40, {0.0000, 0.0000}},
+    {41, {0.0000, 0.0000}},
+    {42, {0.0000, 0.0000}},
+    {43, {2.5560, 0.0200}},
+    {44, {2.7800, 0.0690}},
+    {45, {3.4010, 0.2339}},
+    {46, {3.6240, 0.3170}},
+    {47, {3.9350, 0.4330}},
+    {48, {3.8500, 0.0800}},
+    {49, {3.8000, 0.0500}},
+    {50, {3.0000, 0.1700}},
+    {51, {3.8000, 0.1700}},
+    {52, {3.8000, 0.1180}},
+    {53, {3.15061, 0.1521}},
+    {54, {0.0000, 0.0000}},
+    {55, {3.15365, 0.1550}},
+    {56, {0.0000, 0.0000}},
+    {57, {0.0000, 0.0000}},
+    {58, {3.1760, 0.1500}},
+    {59, {0.0000, 0.0000}},
+    {60, {3.8000, 0.1180}},
+    {61, {3.4000, 0.3000}},
+    {62, {3.8000, 0.0800}},
+    {63, {3.4700, 0.3000}},
+    {64, {3.8000, 0.0500}},
+    {65, {3.4700, 0.2660}},
+    {66, {3.5600, 0.3950}},
+    {67, {2.9300, 0.2800}},
+    {68, {3.8100, 0.1600}},
+    {69, {3.4200, 0.1700}},
+    {70, {0.0000, 0.0000}},
+    {71, {2.9600, 0.2100}},
+    {72, {3.2500, 0.1700}},
+    {73, {3.8000, 0.1150}},
+    {74, {3.8000, 0.1700}},
+    {75, {3.16557, 0.1554}},
+    {76, {0.0000, 0.0000}},
+    {77, {3.5000, 0.0660}},
+    {78, {3.5000, 0.0660}},
+    {79, {3.5000, 0.0660}},
+    {80, {3.5000, 0.0660}},
+    {81, {3.5000, 0.0660}},
+    {82, {2.5000, 0.0300}},
+    {83, {3.5500, 0.0760}},
+    {84, {3.5500, 0.0760}},
+    {85, {3.5500, 0.0760}},
+    {86, {2.4200, 0.0300}},
+    {87, {3.5500, 0.0700}},
+    {88, {2.4200, 0.0300}},
+    {89, {3.5500, 0.0700}},
+    {90, {3.5000, 0.0660}},
+    {91, {3.5000, 0.0660}},
+    {92, {3.5500, 0.0760}},
+    {93, {3.1200, 0.1700}},
+    {94, {0.0000, 0.0000}},
+    {95, {2.5000, 0.0300}},
+    {96, {3.5000, 0.0660}},
+    {97, {3.5000, 0.0660}},
+    {98, {3.5000, 0.0660}},
+    {99, {3.5000, 0.0660}},
+    {100, {3.2500, 0.0620}},
+    {101, {3.0700, 0.1700}},
+    {102, {0.0000, 0.0000}},
+    {103, {2.9400, 0.0610}},
+    {104, {2.5000, 0.0300}},
+    {105, {3.5500, 0.0700}},
+    {106, {3.0700, 0.1700}},
+    {107, {0.0000, 0.0000}},
+    {108, {3.0700, 0.1700}},
+    {109, {0.0000, 0.0000}},
+    {110, {3.0700, 0.1700}},
+    {111, {0.0000, 0.0000}},
+    {112, {3.5000, 0.0660}},
+    {113, {3.5000, 0.0660}},
+    {114, {3.5000, 0.0660}},
+    {115, {2.5000, 0.0300}},
+    {116, {2.9000, 0.1400}},
+    {117, {3.5500, 0.0760}},
+    {118, {2.9000, 0.1400}},
+    {119, {2.9000, 0.1400}},
+    {120, {3.5000, 0.0660}},
+    {121, {3.5000, 0.0660}},
+    {122, {3.5000, 0.0660}},
+    {123, {3.5000, 0.0660}},
+    {124, {2.5000, 0.0300}},
+    {125, {2.9000, 0.1400}},
+    {126, {3.0700, 0.1700}},
+    {127, {0.0000, 0.0000}},
+    {128, {3.5000, 0.0660}},
+    {129, {2.5000, 0.0300}},
+    {130, {3.5000, 0.0660}},
+    {131, {2.5000, 0.0300}},
+    {132, {3.5000, 0.0660}},
+    {133, {2.5000, 0.0300}},
+    {134, {3.5000, 0.0660}},
+    {135, {2.5000, 0.0300}},
+    {136, {3.5000, 0.0660}},
+    {137, {3.5000, 0.0660}},
+    {138, {3.5500, 0.0700}},
+    {139, {3.5500, 0.2500}},
+    {140, {3.7000, 0.2500}},
+    {141, {3.5500, 0.2500}},
+    {142, {3.5500, 0.2500}},
+    {143, {0.0000, 0.0000}},
+    {144, {0.0000, 0.0000}},
+    {145, {3.5000, 0.0660}},
+    {146, {3.5000, 0.0660}},
+    {147, {3.5000, 0.0660}},
+    {148, {3.5000, 0.0660}},
+    {149, {3.5000, 0.0660}},
+    {150, {3.5000, 0.0660}},
+    {151, {3.5000, 0.0660}},
+    {152, {3.5000, 0.0660}},
+    {153, {3.5000, 0.0660}},
+    {154, {3.5000, 0.0660}},
+    {155, {3.5000, 0.0660}},
+    {156, {3.5000, 0.0660}},
+    {157, {3.5000, 0.0660}},
+    {158, {3.5000, 0.0660}},
+    {159, {3.5000, 0.0660}},
+    {160, {3.5500, 0.0700}},
+    {161, {3.5500, 0.2500}},
+    {162, {3.5000, 0.0660}},
+    {163, {3.5000, 0.0660}},
+    {164, {3.5000, 0.0660}},
+    {165, {3.4000, 0.3000}},
+    {166, {3.5500, 0.0760}},
+    {167, {3.5500, 0.0700}},
+    {168, {3.5000, 0.0660}},
+    {169, {3.5000, 0.0660}},
+    {170, {3.7500, 0.1050}},
+    {171, {3.7500, 0.1050}},
+    {172, {3.7500, 0.1050}},
+    {173, {3.7500, 0.1050}},
+    {174, {3.7500, 0.1050}},
+    {175, {2.9600, 0.2100}},
+    {176, {3.2500, 0.1700}},
+    {177, {3.2500, 0.1700}},
+    {178, {3.2500, 0.1700}},
+    {179, {0.0000, 0.0000}},
+    {180, {0.0000, 0.0000}},
+    {181, {3.5000, 0.0660}},
+    {182, {3.5000, 0.0660}},
+    {183, {3.5000, 0.0660}},
+    {184, {3.5000, 0.0660}},
+    {185, {3.5000, 0.0660}},
+    {186, {3.7500, 0.1050}},
+    {187, {2.9600, 0.2100}},
+    {188, {3.2500, 0.1700}},
+    {189, {0.0000, 0.0000}},
+    {190, {3.2500, 0.1700}},
+    {191, {3.7500, 0.1050}},
+    {192, {2.9600, 0.2100}},
+    {193, {0.0000, 0.0000}},
+    {194, {2.5000, 0.0200}},
+    {195, {3.5000, 0.0660}},
+    {196, {3.5000, 0.0660}},
+    {197, {3.5000, 0.0660}},
+    {198, {3.5000, 0.0660}},
+    {199, {3.5500, 0.0700}},
+    {200, {3.6500, 0.1500}},
+    {201, {3.2000, 0.1700}},
+    {202, {3.5500, 0.0700}},
+    {203, {3.4000, 0.3000}},
+    {204, {3.2500, 0.1700}},
+    {205, {3.5500, 0.0700}},
+    {206, {3.7500, 0.1050}},
+    {207, {3.0000, 0.1700}},
+    {208, {2.9600, 0.2100}},
+    {209, {0.0000, 0.0000}},
+    {210, {3.7500, 0.1050}},
+    {211, {2.9600, 0.2100}},
+    {212, {3.5000, 0.0660}},
+    {213, {3.5000, 0.0660}},
+    {214, {3.5000, 0.0660}},
+    {215, {3.5000, 0.0660}},
+    {216, {3.7500, 0.1050}},
+    {217, {2.9600, 0.2100}},
+    {218, {2.4200, 0.0150}},
+    {219, {3.7500, 0.1050}},
+    {220, {2.9600, 0.2100}},
+    {221, {2.4200, 0.0150}},
+    {222, {3.5000, 0.0660}},
+    {223, {3.5000, 0.0660}},
+    {224, {3.5000, 0.0660}},
+    {225, {3.5000, 0.0660}},
+    {226, {3.2500, 0.1700}},
+    {227, {3.2500, 0.1700}},
+    {228, {3.2500, 0.1700}},
+    {229, {0.0000, 0.0000}},
+    {230, {0.0000, 0.0000}},
+    {231, {3.5000, 0.0660}},
+    {232, {3.5000, 0.0660}},
+    {233, {3.5000, 0.0660}},
+    {234, {3.5000, 0.0660}},
+    {235, {3.5000, 0.0660}},
+    {236, {3.5000, 0.0660}},
+    {237, {3.5000, 0.0660}},
+    {238, {3.5000, 0.0660}},
+    {239, {3.5000, 0.0660}},
+    {240, {3.2500, 0.1700}},
+    {241, {0.0000, 0.0000}},
+    {242, {3.5500, 0.0500}},
+    {243, {3.2500, 0.1700}},
+    {244, {0.0000, 0.0000}},
+    {245, {3.5000, 0.0660}},
+    {246, {3.5000, 0.0660}},
+    {247, {3.5000, 0.0660}},
+    {248, {3.5000, 0.0660}},
+    {249, {3.2500, 0.1700}},
+    {250, {0.0000, 0.0000}},
+    {251, {3.2500, 0.1700}},
+    {252, {3.5000, 0.0800}},
+    {253, {3.2500, 0.1700}},
+    {254, {0.0000, 0.0000}},
+    {255, {3.5000, 0.0800}},
+    {256, {2.5000, 0.0500}},
+    {257, {3.5000, 0.0800}},
+    {258, {2.5000, 0.0500}},
+    {259, {3.2500, 0.1700}},
+    {260, {3.7500, 0.1050}},
+    {261, {3.2500, 0.1700}},
+    {262, {3.7500, 0.1050}},
+    {263, {3.5000, 0.0800}},
+    {264, {3.5000, 0.0800}},
+    {265, {0.0000, 0.0000}},
+    {266, {2.9600, 0.2100}},
+    {267, {0.0000, 0.0000}},
+    {268, {2.9600, 0.2100}},
+    {269, {2.5000, 0.0500}},
+    {270, {2.5000, 0.0500}},
+    {271, {3.5000, 0.0800}},
+    {272, {2.5000, 0.0500}},
+    {273, {3.2500, 0.1700}},
+    {274, {3.7500, 0.1050}},
+    {275, {3.2500, 0.1700}},
+    {276, {3.5000, 0.0800}},
+    {277, {3.5000, 0.0800}},
+    {278, {3.5000, 0.0800}},
+    {279, {0.0000, 0.0000}},
+    {280, {2.9600, 0.2100}},
+    {281, {3.2500, 0.1700}},
+    {282, {0.0000, 0.0000}},
+    {283, {0.0000, 0.0000}},
+    {284, {2.5000, 0.0500}},
+    {285, {2.5000, 0.0500}},
+    {286, {3.2500, 0.1700}},
+    {287, {3.5000, 0.0800}},
+    {288, {3.2500, 0.1700}},
+    {289, {3.5000, 0.0800}},
+    {290, {3.5000, 0.0800}},
+    {291, {3.5000, 0.0800}},
+    {292, {3.2500, 0.1700}},
+    {293, {3.5000, 0.0800}},
+    {294, {3.2500, 0.1700}},
+    {295, {2.5000, 0.0500}},
+    {296, {3.2500, 0.1700}},
+    {297, {0.0000, 0.0000}},
+    {298, {0.0000, 0.0000}},
+    {299, {2.5000, 0.0500}},
+    {300, {0.0000, 0.0000}},
+    {301, {3.2500, 0.1700}},
+    {302, {3.5000, 0.0800}},
+    {303, {3.2500, 0.1700}},
+    {304, {3.5000, 0.0800}},
+    {305, {3.5000, 0.0800}},
+    {306, {3.7500, 0.1050}},
+    {307, {0.0000, 0.0000}},
+    {308, {3.2500, 0.1700}},
+    {309, {0.0000, 0.0000}},
+    {310, {2.9600, 0.2100}},
+    {311, {3.5000, 0.0800}},
+    {312, {2.5000, 0.0500}},
+    {313, {3.5000, 0.0800}},
+    {314, {2.5000, 0.0500}},
+    {315, {3.5000, 0.0800}},
+    {316, {2.5000, 0.0500}},
+    {317, {3.2500, 0.1700}},
+    {318, {3.7500, 0.1050}},
+    {319, {3.2500, 0.1700}},
+    {320, {3.5000, 0.0800}},
+    {321, {3.5000, 0.0800}},
+    {322, {3.5000, 0.0800}},
+    {323, {0.0000, 0.0000}},
+    {324, {2.9600, 0.2100}},
+    {325, {0.0000, 0.0000}},
+    {326, {3.2500, 0.1700}},
+    {327, {0.0000, 0.0000}},
+    {328, {0.0000, 0.0000}},
+    {329, {2.5000, 0.0500}},
+    {330, {2.5000, 0.0500}},
+    {331, {3.5000, 0.0800}},
+    {332, {2.5000, 0.0500}},
+    {333, {3.7400, 0.2000}},
+    {334, {2.9600, 0.2100}},
+    {335, {3.0000, 0.1700}},
+    {336, {3.5500, 0.0660}},
+    {337, {3.5000, 0.0800}},
+    {338, {3.4000, 0.3000}},
+    {339, {3.5500, 0.0760}},
+    {340, {3.0500, 0.7100}},
+    {341, {4.0200, 0.7100}},
+    {342, {4.2800, 0.7100}},
+    {343, {4.8100, 0.7100}},
+    {344, {5.3400, 0.0005}},
+    {345, {2.8700, 0.0005}},
+    {346, {4.0700, 0.0005}},
+    {347, {5.1700, 0.0005}},
+    {348, {5.6000, 0.0005}},
+    {349, {6.2000, 0.0005}},
+    {350, {1.644471, 0.875044}},
+    {351, {2.412031, 0.449657}},
+    {352, {3.102688, 0.118226}},
+    {353, {3.816610, 0.047096}},
+    {354, {4.2000, 0.3000}},
+    {355, {2.5000, 0.0500}},
+    {356, {4.2500, 0.5000}},
+    {357, {4.2000, 0.3000}},
+    {358, {2.5000, 0.0500}},
+    {359, {3.1500, 0.2500}},
+    {360, {4.2000, 0.3000}},
+    {361, {2.5000, 0.0500}},
+    {362, {3.6500, 0.1500}},
+    {363, {3.4000, 0.2500}},
+    {364, {4.2000, 0.3000}},
+    {365, {2.5000, 0.0500}},
+    {366, {3.4000, 0.2500}},
+    {367, {2.5000, 0.0500}},
+    {368, {4.2000, 0.3000}},
+    {369, {2.5000, 0.0500}},
+    {370, {4.2000, 0.3000}},
+    {371, {2.5000, 0.0500}},
+    {372, {0.0000, 0.0000}},
+    {373, {3.2000, 0.2500}},
+    {374, {0.0000, 0.0000}},
+    {375, {2.81524, 0.4000}},
+    {376, {3.11815, 0.2000}},
+    {377, {2.9000, 0.1400}},
+    {378, {3.7400, 0.2000}},
+    {379, {3.1500, 0.2000}},
+    {380, {2.9000, 0.1400}},
+    {381, {3.5000, 0.0660}},
+    {382, {2.5000, 0.0300}},
+    {383, {3.7400, 0.2000}},
+    {384, {3.1500, 0.2000}},
+    {385, {2.9000, 0.1400}},
+    {386, {3.5000, 0.0660}},
+    {387, {2.5000, 0.0300}},
+    {388, {3.7400, 0.2000}},
+    {389, {3.1500, 0.2000}},
+    {390, {2.9000, 0.1400}},
+    {391, {3.5000, 0.0660}},
+    {392, {2.5000, 0.0300}},
+    {393, {3.5000, 0.0660}},
+    {394, {2.5000, 0.0300}},
+    {395, {3.5500, 0.0700}},
+    {396, {3.5000, 0.0660}},
+    {397, {2.5000, 0.0300}},
+    {398, {3.5500, 0.0700}},
+    {399, {3.5000, 0.0660}},
+    {400, {2.5000, 0.0300}},
+    {401, {3.5500, 0.0700}},
+    {402, {3.5000, 0.0660}},
+    {403, {3.7500, 0.1050}},
+    {404, {2.9600, 0.2100}},
+    {405, {3.0000, 0.1700}},
+    {406, {3.5000, 0.0660}},
+    {407, {2.4200, 0.0150}},
+    {408, {3.7500, 0.1050}},
+    {409, {3.7500, 0.1050}},
+    {410, {3.5500, 0.0700}},
+    {411, {3.0000, 0.1700}},
+    {412, {3.5500, 0.2500}},
+    {413, {2.9600, 0.1700}},
+    {414, {3.5000, 0.0660}},
+    {415, {2.5000, 0.0300}},
+    {416, {3.2500, 0.1700}},
+    {417, {0.0000, 0.0000}},
+    {418, {3.2500, 0.1700}},
+    {419, {0.0000, 0.0000}},
+    {420, {3.5000, 0.0660}},
+    {421, {2.5000, 0.0300}},
+    {422, {3.5000, 0.0660}},
+    {423, {2.5000, 0.0300}},
+    {424, {3.5000, 0.0660}},
+    {425, {2.5000, 0.0300}},
+    {426, {3.5500, 0.0700}},
+    {427, {3.5500, 0.0700}},
+    {428, {3.5000, 0.0660}},
+    {429, {3.5000, 0.0660}},
+    {430, {3.5000, 0.0660}},
+    {431, {3.5500, 0.2500}},
+    {432, {2.9600, 0.1700}},
+    {433, {3.5600, 0.3950}},
+    {434, {3.5600, 0.3950}},
+    {435, {2.9300, 0.2800}},
+    {436, {3.5000, 0.0660}},
+    {437, {3.5000, 0.0660}},
+    {438, {3.5500, 0.0700}},
+    {439, {3.5500, 0.0700}},
+    {440, {3.5500, 0.0700}},
+    {441, {3.2500, 0.1700}},
+    {442, {0.0000, 0.0000}},
+    {443, {3.5000, 0.0660}},
+    {444, {3.5500, 0.0700}},
+    {445, {3.5500, 0.0700}},
+    {446, {3.5500, 0.0700}},
+    {447, {3.5500, 0.0700}},
+    {448, {3.5500, 0.0700}},
+    {449, {3.2500, 0.1700}},
+    {450, {3.2500, 0.1700}},
+    {451, {0.0000, 0.0000}},
+    {452, {3.5500, 0.0700}},
+    {453, {3.5000, 0.0660}},
+    {454, {3.5000, 0.0660}},
+    {455, {3.5500, 0.0760}},
+    {456, {3.5500, 0.0760}},
+    {457, {3.5500, 0.0700}},
+    {458, {3.2500, 0.1700}},
+    {459, {3.5500, 0.0700}},
+    {460, {3.5500, 0.0700}},
+    {461, {3.5500, 0.0700}},
+    {462, {2.4200, 0.0300}},
+    {463, {2.4200, 0.0300}},
+    {464, {2.4200, 0.0300}},
+    {465, {3.2500, 0.1700}},
+    {466, {3.5500, 0.0700}},
+    {467, {2.4200, 0.0300}},
+    {468, {3.2500, 0.1700}},
+    {469, {3.5500, 0.0700}},
+    {470, {3.5500, 0.0700}},
+    {471, {3.5500, 0.0700}},
+    {472, {2.4200, 0.0300}},
+    {473, {2.4200, 0.0300}},
+    {474, {2.4200, 0.0300}},
+    {475, {3.2500, 0.1700}},
+    {476, {3.5500, 0.0700}},
+    {477, {3.5500, 0.0700}},
+    {478, {2.4200, 0.0300}},
+    {479, {2.4200, 0.0300}},
+    {480, {3.2500, 0.1700}},
+    {481, {3.5500, 0.0700}},
+    {482, {3.5500, 0.0700}},
+    {483, {0.0000, 0.0000}},
+    {484, {2.4200, 0.0300}},
+    {485, {2.4200, 0.0300}},
+    {486, {3.2500, 0.1700}},
+    {487, {3.2500, 0.1700}},
+    {488, {3.5500, 0.0700}},
+    {489, {3.5500, 0.0700}},
+    {490, {3.5500, 0.0700}},
+    {491, {0.0000, 0.0000}},
+    {492, {2.4200, 0.0300}},
+    {493, {2.4200, 0.0300}},
+    {494, {2.4200, 0.0300}},
+    {495, {3.2500, 0.1700}},
+    {496, {3.5500, 0.0700}},
+    {497, {3.2500, 0.1700}},
+    {498, {3.5500, 0.0700}},
+    {499, {3.5500, 0.0700}},
+    {500, {0.0000, 0.0000}},
+    {501, {2.4200, 0.0300}},
+    {502, {2.4200, 0.0300}},
+    {503, {2.4200, 0.0300}},
+    {504, {2.9000, 0.1400}},
+    {505, {3.5500, 0.0700}},
+    {506, {3.5500, 0.0760}},
+    {507, {2.4200, 0.0300}},
+    {508, {2.4200, 0.0300}},
+    {509, {2.9000, 0.1400}},
+    {510, {3.5500, 0.0700}},
+    {511, {3.2500, 0.1700}},
+    {512, {3.5500, 0.0700}},
+    {513, {3.5500, 0.0700}},
+    {514, {2.4200, 0.0300}},
+    {515, {2.4200, 0.0300}},
+    {516, {2.4200, 0.0300}},
+    {517, {2.9000, 0.1400}},
+    {518, {3.2500, 0.1700}},
+    {519, {3.5500, 0.0700}},
+    {520, {3.5500, 0.0700}},
+    {521, {3.5500, 0.0700}},
+    {522, {2.4200, 0.0300}},
+    {523, {2.4200, 0.0300}},
+    {524, {2.4200, 0.0300}},
+    {525, {3.2500, 0.1700}},
+    {526, {3.5500, 0.0700}},
+    {527, {3.5500, 0.0700}},
+    {528, {3.5500, 0.0700}},
+    {529, {3.5500, 0.0700}},
+    {530, {3.5500, 0.0700}},
+    {531, {3.5500, 0.0700}},
+    {532, {3.5500, 0.0700}},
+    {533, {3.5500, 0.0700}},
+    {534, {0.0000, 0.0000}},
+    {535, {2.4200, 0.0300}},
+    {536, {2.4200, 0.0300}},
+    {537, {2.4200, 0.0300}},
+    {538, {2.4200, 0.0300}},
+    {539, {2.4200, 0.0300}},
+    {540, {2.4200, 0.0300}},
+    {541, {3.2500, 0.1700}},
+    {542, {3.5500, 0.0700}},
+    {543, {3.5500, 0.0700}},
+    {544, {3.5500, 0.0700}},
+    {545, {3.5500, 0.0700}},
+    {546, {3.5500, 0.0700}},
+    {547, {3.5500, 0.0700}},
+    {548, {3.5500, 0.0700}},
+    {549, {3.5500, 0.0700}},
+    {550, {3.5500, 0.0700}},
+    {551, {2.4200, 0.0300}},
+    {552, {2.4200, 0.0300}},
+    {553, {2.4200, 0.0300}},
+    {554, {2.4200, 0.0300}},
+    {555, {2.4200, 0.0300}},
+    {556, {2.4200, 0.0300}},
+    {557, {2.4200, 0.0300}},
+    {558, {3.2500, 0.1700}},
+    {559, {3.5500, 0.0700}},
+    {560, {3.2500, 0.1700}},
+    {561, {3.5500, 0.0700}},
+    {562, {3.5500, 0.0700}},
+    {563, {3.5500, 0.0700}},
+    {564, {3.2500, 0.1700}},
+    {565, {3.5500, 0.0700}},
+    {566, {3.2500, 0.1700}},
+    {567, {2.4200, 0.0300}},
+    {568, {2.4200, 0.0300}},
+    {569, {2.4200, 0.0300}},
+    {570, {0.0000, 0.0000}},
+    {571, {3.5500, 0.2500}},
+    {572, {3.5500, 0.0700}},
+    {573, {3.2500, 0.1700}},
+    {574, {3.5500, 0.0700}},
+    {575, {3.5500, 0.0700}},
+    {576, {2.4200, 0.0300}},
+    {577, {2.4200, 0.0300}},
+    {578, {2.4200, 0.0300}},
+    {579, {3.2500, 0.1700}},
+    {580, {3.5500, 0.0700}},
+    {581, {2.4200, 0.0300}},
+    {582, {3.5500, 0.0700}},
+    {583, {3.5000, 0.0660}},
+    {584, {3.2500, 0.1700}},
+    {585, {3.5500, 0.0700}},
+    {586, {3.5500, 0.0700}},
+    {587, {3.5500, 0.0700}},
+    {588, {3.5500, 0.0700}},
+    {589, {3.5500, 0.0700}},
+    {590, {3.5500, 0.0700}},
+    {591, {2.4200, 0.0300}},
+    {592, {2.4200, 0.0300}},
+    {593, {2.4200, 0.0300}},
+    {594, {2.4200, 0.0300}},
+    {595, {3.2500, 0.1700}},
+    {596, {3.5500, 0.0700}},
+    {597, {3.2500, 0.1700}},
+    {598, {3.5500, 0.0700}},
+    {599, {3.5500, 0.0700}},
+    {600, {3.5000, 0.0660}},
+    {601, {2.4200, 0.0300}},
+    {602, {2.4200, 0.0300}},
+    {603, {2.4200, 0.0300}},
+    {604, {2.5000, 0.0300}},
+    {605, {3.5000, 0.0660}},
+    {606, {3.5000, 0.0660}},
+    {607, {3.5000, 0.0660}},
+    {608, {3.5000, 0.0660}},
+    {609, {3.5000, 0.0660}},
+    {610, {3.5000, 0.0660}},
+    {611, {3.5000, 0.0660}},
+    {612, {3.5000, 0.0660}},
+    {613, {3.5000, 0.0660}},
+    {614, {3.5000, 0.0660}},
+    {615, {3.5000, 0.0660}},
+    {616, {3.5000, 0.0660}},
+    {617, {3.5000, 0.0660}},
+    {618, {3.5000, 0.0660}},
+    {619, {3.5000, 0.0660}},
+    {620, {3.5500, 0.2500}},
+    {621, {0.0000, 0.0000}},
+    {622, {3.5500, 0.0700}},
+    {623, {3.7500, 0.1050}},
+    {624, {3.2500, 0.1700}},
+    {625, {3.5000, 0.0660}},
+    {626, {3.5000, 0.0660}},
+    {627, {3.5000, 0.0660}},
+    {628, {3.5500, 0.0700}},
+    {629, {3.5500, 0.0700}},
+    {630, {3.5500, 0.0700}},
+    {631, {3.5500, 0.0700}},
+    {632, {3.5500, 0.0700}},
+    {633, {3.5500, 0.0700}},
+    {634, {3.5500, 0.2500}},
+    {635, {3.4730, 0.0540}},
+    {636, {3.3000, 0.0500}},
+    {637, {3.3000, 0.0500}},
+    {638, {3.5500, 0.0760}},
+    {639, {3.5000, 0.0660}},
+    {640, {2.5000, 0.0300}},
+    {641, {3.7500, 0.0600}},
+    {642, {3.4730, 0.0540}},
+    {643, {3.3000, 0.0500}},
+    {644, {3.3000, 0.0500}},
+    {645, {2.9500, 0.0400}},
+    {646, {3.5500, 0.0760}},
+    {647, {3.4000, 0.3000}},
+    {648, {2.4200, 0.0300}},
+    {649, {3.5000, 0.0660}},
+    {650, {3.5000, 0.0660}},
+    {651, {3.5000, 0.0660}},
+    {652, {3.5500, 0.0700}},
+    {653, {2.4200, 0.0300}},
+    {654, {3.5500, 0.0700}},
+    {655, {2.4200, 0.0300}},
+    {656, {3.5500, 0.0700}},
+    {657, {2.8500, 0.0610}},
+    {658, {3.5500, 0.0700}},
+    {659, {2.8500, 0.0610}},
+    {660, {3.4700, 0.4700}},
+    {661, {3.9050, 0.1180}},
+    {662, {3.5500, 0.0700}},
+    {663, {3.2500, 0.0620}},
+    {664, {2.9400, 0.0610}},
+    {665, {3.5500, 0.0700}},
+    {666, {2.8500, 0.0610}},
+    {667, {3.5500, 0.0700}},
+    {668, {3.4700, 0.4700}},
+    {669, {3.5500, 0.0700}},
+    {670, {3.7500, 0.6000}},
+    {671, {3.5000, 0.0660}},
+    {672, {3.5500, 0.2500}},
+    {673, {3.5500, 0.0700}},
+    {674, {3.5500, 0.0700}},
+    {675, {3.5500, 0.0700}},
+    {676, {3.5500, 0.0700}},
+    {677, {3.5500, 0.0700}},
+    {678, {2.4200, 0.0300}},
+    {679, {2.4200, 0.0300}},
+    {680, {3.5500, 0.0500}},
+    {681, {3.2500, 0.1700}},
+    {682, {0.0000, 0.0000}},
+    {683, {0.0000, 0.0000}},
+    {684, {2.4200, 0.0300}},
+    {685, {3.5000, 0.0660}},
+    {686, {3.5000, 0.0660}},
+    {687, {3.2500, 0.1700}},
+    {688, {3.2500, 0.1700}},
+    {689, {3.2500, 0.1700}},
+    {690, {3.5500, 0.0500}},
+    {691, {3.2000, 0.1700}},
+    {692, {3.3000, 0.0660}},
+    {693, {3.3000, 0.0660}},
+    {694, {3.3000, 0.0660}},
+    {695, {3.3000, 0.0660}},
+    {696, {3.3000, 0.0660}},
+    {697, {2.5000, 0.0150}},
+    {698, {3.2500, 0.1200}},
+    {699, {2.9600, 0.1700}},
+    {700, {3.5000, 0.0660}},
+    {701, {2.5000, 0.0150}},
+    {702, {3.5000, 0.0660}},
+    {703, {3.5000, 0.0660}},
+    {704, {3.5000, 0.0660}},
+    {705, {3.2500, 0.1200}},
+    {706, {3.5500, 0.0700}},
+    {707, {3.3000, 0.0660}},
+    {708, {3.2500, 0.1700}},
+    {709, {2.9600, 0.2100}},
+    {710, {3.7500, 0.1050}},
+    {711, {3.0000, 0.1700}},
+    {712, {3.5000, 0.0660}},
+    {713, {3.5000, 0.0660}},
+    {714, {3.5000, 0.0660}},
+    {715, {2.4200, 0.0150}},
+    {716, {2.4200, 0.0150}},
+    {717, {2.4200, 0.0150}},
+    {718, {2.9000, 0.1400}},
+    {719, {3.7400, 0.2000}},
+    {720, {3.5000, 0.0660}},
+    {721, {3.5000, 0.0660}},
+    {722, {2.5000, 0.0300}},
+    {723, {3.7400, 0.2000}},
+    {724, {3.1181, 0.0610}},
+    {725, {3.1500, 0.1700}},
+    {726, {2.8600, 0.2100}},
+    {727, {3.2700, 0.1000}},
+    {728, {0.0000, 0.0000}},
+    {729, {0.0000, 0.0000}},
+    {730, {3.3000, 0.1700}},
+    {731, {3.3000, 0.1700}},
+    {732, {3.3000, 0.1700}},
+    {733, {3.5000, 0.0660}},
+    {734, {3.5000, 0.0660}},
+    {735, {3.5000, 0.0660}},
+    {736, {3.5000, 0.0660}},
+    {737, {3.5000, 0.0660}},
+    {738, {3.5000, 0.0660}},
+    {739, {0.0000, 0.0000}},
+    {740, {0.0000, 0.0000}},
+    {741, {2.5000, 0.0150}},
+    {742, {3.5000, 0.0660}},
+    {743, {3.5000, 0.0660}},
+    {744, {3.5000, 0.0660}},
+    {745, {3.5000, 0.0660}},
+    {746, {3.5500, 0.0700}},
+    {747, {3.5500, 0.0700}},
+    {748, {3.5500, 0.0700}},
+    {749, {3.5000, 0.0660}},
+    {750, {3.5000, 0.0660}},
+    {751, {3.5000, 0.0660}},
+    {752, {3.5000, 0.0660}},
+    {753, {3.5000, 0.0660}},
+    {754, {3.5000, 0.0660}},
+    {755, {3.3000, 0.0860}},
+    {756, {2.4200, 0.0150}},
+    {757, {3.3000, 0.2100}},
+    {758, {3.3000, 0.1350}},
+    {759, {3.3000, 0.1000}},
+    {760, {2.5000, 0.0150}},
+    {761, {3.5000, 0.0660}},
+    {762, {3.5000, 0.0660}},
+    {763, {3.5000, 0.0660}},
+    {764, {3.1200, 0.1700}},
+    {765, {0.0000, 0.0000}},
+    {766, {3.2500, 0.1700}},
+    {767, {3.2500, 0.1700}},
+    {768, {3.2500, 0.1700}},
+    {769, {3.3000, 0.2100}},
+    {770, {3.2500, 0.1700}},
+    {771, {0.0000, 0.0000}},
+    {772, {3.5000, 0.0660}},
+    {773, {3.5000, 0.0660}},
+    {774, {3.5000, 0.0660}},
+    {775, {3.5000, 0.0660}},
+    {776, {3.5500, 0.0700}},
+    {777, {3.5500, 0.0760}},
+    {778, {3.5500, 0.0700}},
+    {779, {3.5500, 0.0700}},
+    {780, {2.5000, 0.0300}},
+    {781, {3.5000, 0.0660}},
+    {782, {3.7500, 0.1050}},
+    {783, {3.2500, 0.1700}},
+    {784, {2.9600, 0.2100}},
+    {785, {0.0000, 0.0000}},
+    {786, {2.9400, 0.0610}},
+    {787, {3.5000, 0.0660}},
+    {788, {2.5000, 0.0300}},
+    {789, {3.5000, 0.0660}},
+    {790, {3.5000, 0.0660}},
+    {791, {3.5000, 0.0660}},
+    {792, {3.5000, 0.0660}},
+    {793, {3.5000, 0.0660}},
+    {794, {3.5000, 0.0970}},
+    {795, {2.9500, 0.0530}},
+    {796, {3.2500, 0.0620}},
+    {797, {2.5000, 0.0300}},
+    {798, {3.5000, 0.0660}},
+    {799, {3.5000, 0.0660}},
+    {800, {3.4000, 0.3000}},
+    {801, {3.5000, 0.0660}},
+    {802, {2.5000, 0.0300}},
+    {803, {3.5000, 0.0660}},
+    {804, {3.5000, 0.0660}},
+    {805, {3.4700, 0.4700}},
+    {806, {3.5000, 0.0660}},
+    {807, {2.5000, 0.0300}},
+    {808, {3.5000, 0.0660}},
+    {809, {3.5000, 0.0660}},
+    {810, {2.9400, 0.0610}},
+    {811, {3.4000, 0.3000}},
+    {812, {3.4700, 0.4700}},
+    {813, {3.5500, 0.0700}},
+    {814, {2.9000, 0.1400}},
+    {815, {3.5000, 0.0660}},
+    {816, {2.9000, 0.0600}},
+    {817, {3.2500, 0.1700}},
+    {818, {3.5500, 0.0700}},
+    {819, {3.5000, 0.0660}},
+    {820, {3.7500, 0.1050}},
+    {821, {3.7500, 0.1050}},
+    {822, {2.9600, 0.2100}},
+    {823, {3.2500, 0.1700}},
+    {824, {0.0000, 0.0000}},
+    {825, {3.1200, 0.1700}},
+    {826, {0.0000, 0.0000}},
+    {827, {3.5000, 0.0660}},
+    {828, {3.5000, 0.0660}},
+    {829, {3.5500, 0.0700}},
+    {830, {3.5500, 0.0700}},
+    {831, {3.5500, 0.0700}},
+    {832, {3.5500, 0.0700}},
+    {833, {3.5500, 0.0700}},
+    {834, {1.9600, 0.0125}},
+    {835, {3.5000, 0.0660}},
+    {836, {3.5000, 0.0660}},
+    {837, {3.5000, 0.0660}},
+    {838, {3.7500, 0.6000}},
+    {839, {2.5000, 0.0300}},
+    {840, {3.2500, 0.1700}},
+    {841, {3.5500, 0.0700}},
+    {842, {3.5500, 0.0700}},
+    {843, {3.2500, 0.1700}},
+    {844, {3.5500, 0.0700}},
+    {845, {3.7500, 0.1050}},
+    {846, {2.9600, 0.2100}},
+    {847, {3.2500, 0.1700}},
+    {848, {3.5000, 0.0660}},
+    {849, {3.5000, 0.0660}},
+    {850, {3.5000, 0.0660}},
+    {851, {3.5000, 0.0660}},
+    {852, {2.4200, 0.0150}},
+    {853, {3.7500, 0.1050}},
+    {854, {2.9600, 0.2100}},
+    {855, {2.4200, 0.0150}},
+    {856, {3.5000, 0.0660}},
+    {857, {3.5000, 0.0660}},
+    {858, {3.5000, 0.0660}},
+    {859, {3.5000, 0.0660}},
+    {860, {3.5000, 0.0660}},
+    {861, {3.5000, 0.0660}},
+    {862, {3.5000, 0.0660}},
+    {863, {3.5000, 0.0660}},
+    {864, {3.5000, 0.0660}},
+    {865, {3.5000, 0.0660}},
+    {866, {4.0000, 0.1000}},
+    {867, {4.0000, 0.1000}},
+    {868, {4.0000, 0.1000}},
+    {869, {4.0000, 0.1000}},
+    {870, {2.5000, 0.0300}},
+    {871, {3.5000, 0.0660}},
+    {872, {3.5000, 0.0660}},
+    {873, {3.5000, 0.0660}},
+    {874, {3.5000, 0.0660}},
+    {875, {3.0800, 0.7200}},
+    {876, {4.1800, 0.11779}},
+    {877, {4.5100, 0.0900}},
+    {878, {5.1500, 0.0700}},
+    {879, {2.7000, 0.018279}},
+    {880, {3.3500, 0.002772}},
+    {881, {4.0600, 0.000328}},
+    {882, {4.3200, 0.000171}},
+    {883, {4.8200, 0.000081}},
+    {884, {2.9100, 0.875044}},
+    {885, {3.4700, 0.449657}},
+    {886, {3.8200, 0.118226}},
+    {887, {4.1800, 0.047096}},
+    {888, {3.5000, 0.0660}},
+    {889, {3.5000, 0.0660}},
+    {890, {3.5000, 0.0660}},
+    {891, {3.5000, 0.0660}},
+    {892, {2.5000, 0.0300}},
+    {893, {3.2500, 0.1700}},
+    {894, {3.5500, 0.0700}},
+    {895, {3.2500, 0.1700}},
+    {896, {3.5500, 0.0700}},
+    {897, {3.5500, 0.0760}},
+    {898, {3.5500, 0.0760}},
+    {899, {2.4200, 0.0300}},
+    {900, {3.3000, 0.0860}},
+    {901, {3.3000, 0.0860}},
+    {902, {3.3000, 0.0860}},
+    {903, {3.3000, 0.0860}},
+    {904, {3.3000, 0.0860}},
+    {905, {2.9600, 0.2100}},
+    {906, {3.5000, 0.0660}},
+};
+
+const OplsChargeData ChargeData[] = {
+    {1, -0.2200},
+    {2, 0.2200},
+    {3, 0.5500},
+    {4, -0.5000},
+    {5, -0.5800},
+    {6, 0.0800},
+    {7, 0.4500},
+    {8, 0.0000},
+    {9, 0.0000},
+    {10, 0.0000},
+    {11, 0.0000},
+    {12, 0.0000},
+    {13, 0.0000},
+    {14, 0.0000},
+    {15, 0.0000},
+    {16, 0.0000},
+    {17, 0.0000},
+    {18, 0.0000},
+    {19, 0.0000},
+    {20, -0.7000},
+    {21, 0.4350},
+    {22, 0.2650},
+    {23, 0.2650},
+    {24, -0.4700},
+    {25, -0.4500},
+    {26, -0.4700},
+    {27, -0.3000},
+    {28, 0.2350},
+    {29, 0.2700},
+    {30, 0.1800},
+    {31, 0.1800},
+    {32, 0.2350},
+    {33, 0.2350},
+    {34, 0.3000},
+    {35, 0.3000},
+    {36, -0.4300},
+    {37, 0.2800},
+    {38, 0.1500},
+    {39, 0.0000},
+    {40, 0.2410},
+    {41, -0.2410},
+    {42, 0.0000},
+    {43, 0.0000},
+    {44, 0.0000},
+    {45, 0.0000},
+    {46, 0.0000},
+    {47, 0.0000},
+    {48, 0.2650},
+    {49, 0.2650},
+    {50, -0.5000},
+    {51, 0.2500},
+    {52, 0.2500},
+    {53, -0.8340},
+    {54, 0.4170},
+    {55, 0.0000},
+    {56, 0.5200},
+    {57, -1.0400},
+    {58, -0.8220},
+    {59, 0.4110},
+    {60, 0.5000},
+    {61, -0.2500},
+    {62, 0.4200},
+    {63, -0.1400},
+    {64, 0.2480},
+    {65, -0.0620},
+    {66, 0.1390},
+    {67, -0.4590},
+    {68, 0.1600},
+    {69, -1.0200},
+    {70, 0.3400},
+    {71, -0.5000},
+    {72, -0.5700},
+    {73, 0.5000},
+    {74, 0.2850},
+    {75, -0.8200},
+    {76, 0.4100},
+    {77, -0.1800},
+    {78, -0.1200},
+    {79, -0.0600},
+    {80, -0.2400},
+    {81, 0.0000},
+    {82, 0.0600},
+    {83, 0.0000},
+    {84, -0.1150},
+    {85, -0.2300},
+    {86, 0.1150},
+    {87, -0.1150},
+    {88, 0.1150},
+    {89, 0.0000},
+    {90, -0.0650},
+    {91, -0.0050},
+    {92, -0.1150},
+    {93, -0.6830},
+    {94, 0.4180},
+    {95, 0.0400},
+    {96, 0.1450},
+    {97, 0.2050},
+    {98, 0.2650},
+    {99, 0.1263},
+    {100, 0.5323},
+    {101, -0.6351},
+    {102, 0.4286},
+    {103, -0.2057},
+    {104, 0.0825},
+    {105, 0.1500},
+    {106, -0.5850},
+    {107, 0.4350},
+    {108, -0.7000},
+    {109, 0.4350},
+    {110, -0.7300},
+    {111, 0.4650},
+    {112, 0.1450},
+    {113, 0.2050},
+    {114, 0.2650},
+    {115, 0.0600},
+    {116, -0.1700},
+    {117, 0.0000},
+    {118, -0.2850},
+    {119, -0.4000},
+    {120, 0.1100},
+    {121, 0.1400},
+    {122, 0.1700},
+    {123, 0.2000},
+    {124, 0.0300},
+    {125, -0.4000},
+    {126, -0.7000},
+    {127, 0.4350},
+    {128, 0.2000},
+    {129, 0.1000},
+    {130, 0.2650},
+    {131, 0.1000},
+    {132, 0.3000},
+    {133, 0.1000},
+    {134, 0.3650},
+    {135, 0.1000},
+    {136, 0.4000},
+    {137, 0.4650},
+    {138, 0.0850},
+    {139, -0.3350},
+    {140, -0.4700},
+    {141, -0.4350},
+    {142, -0.2175},
+    {143, 0.1550},
+    {144, 0.2350},
+    {145, 0.0600},
+    {146, 0.1200},
+    {147, 0.1800},
+    {148, 0.0375},
+    {149, 0.0975},
+    {150, 0.1575},
+    {151, 0.2175},
+    {152, 0.0375},
+    {153, 0.0975},
+    {154, 0.1575},
+    {155, 0.2175},
+    {156, 0.0000},
+    {157, 0.2000},
+    {158, 0.2600},
+    {159, 0.3200},
+    {160, -0.0550},
+    {161, -0.3200},
+    {162, 0.0800},
+    {163, 0.1400},
+    {164, 0.2000},
+    {165, -0.1200},
+    {166, 0.0050},
+    {167, 0.1025},
+    {168, 0.1400},
+    {169, 0.2000},
+    {170, 0.7000},
+    {171, 0.5650},
+    {172, 0.5850},
+    {173, 0.6150},
+    {174, 0.5000},
+    {175, -0.5000},
+    {176, -0.7600},
+    {177, -0.5000},
+    {178, -0.1400},
+    {179, 0.3800},
+    {180, 0.3000},
+    {181, 0.0200},
+    {182, -0.1100},
+    {183, 0.0800},
+    {184, -0.0500},
+    {185, 0.0100},
+    {186, 0.1420},
+    {187, -0.3900},
+    {188, -0.5420},
+    {189, 0.3330},
+    {190, -0.4900},
+    {191, 0.4200},
+    {192, -0.4200},
+    {193, 0.3700},
+    {194, 0.0600},
+    {195, -0.1200},
+    {196, -0.0600},
+    {197, 0.0000},
+    {198, 0.0600},
+    {199, 0.0350},
+    {200, 0.3950},
+    {201, -0.4300},
+    {202, 0.1800},
+    {203, -0.1800},
+    {204, -0.3850},
+    {205, 0.0850},
+    {206, 0.5200},
+    {207, -0.5300},
+    {208, -0.4400},
+    {209, 0.4500},
+    {210, 0.7000},
+    {211, -0.8000},
+    {212, -0.2800},
+    {213, -0.2200},
+    {214, -0.1600},
+    {215, -0.1000},
+    {216, 0.4500},
+    {217, -0.4500},
+    {218, 0.0000},
+    {219, 0.4700},
+    {220, -0.4700},
+    {221, 0.0600},
+    {222, 0.0400},
+    {223, -0.0200},
+    {224, 0.1000},
+    {225, -0.0900},
+    {226, -0.4000},
+    {227, -0.3000},
+    {228, 0.0000},
+    {229, 0.3500},
+    {230, 0.3300},
+    {231, 0.1300},
+    {232, 0.1900},
+    {233, 0.2500},
+    {234, 0.3100},
+    {235, 0.2300},
+    {236, 0.1700},
+    {237, 0.1100},
+    {238, 0.0900},
+    {239, 0.1500},
+    {240, -0.8000},
+    {241, 0.4600},
+    {242, 0.6400},
+    {243, -0.7000},
+    {244, 0.4400},
+    {245, 0.2000},
+    {246, -0.1100},
+    {247, 0.1900},
+    {248, -0.0500},
+    {249, -0.2000},
+    {250, 0.3100},
+    {251, -0.4600},
+    {252, 0.3600},
+    {253, -0.8500},
+    {254, 0.3700},
+    {255, -0.1500},
+    {256, 0.1000},
+    {257, -0.0400},
+    {258, 0.1000},
+    {259, -0.6000},
+    {260, 0.5000},
+    {261, -0.5100},
+    {262, 0.4500},
+    {263, -0.0700},
+    {264, 0.0800},
+    {265, 0.4100},
+    {266, -0.4000},
+    {267, 0.3600},
+    {268, -0.4200},
+    {269, 0.1000},
+    {270, 0.1000},
+    {271, -0.1400},
+    {272, 0.0800},
+    {273, -0.5600},
+    {274, 0.5500},
+    {275, -0.5400},
+    {276, 0.4600},
+    {277, -0.0600},
+    {278, 0.1000},
+    {279, 0.3800},
+    {280, -0.4800},
+    {281, -0.7900},
+    {282, 0.3850},
+    {283, 0.3550},
+    {284, 0.1000},
+    {285, 0.1000},
+    {286, -0.5300},
+    {287, 0.2200},
+    {288, -0.5500},
+    {289, 0.3800},
+    {290, 0.1500},
+    {291, 0.4400},
+    {292, -0.4900},
+    {293, 0.2000},
+    {294, -0.5000},
+    {295, 0.2000},
+    {296, -0.8100},
+    {297, 0.3850},
+    {298, 0.3550},
+    {299, 0.2000},
+    {300, 0.3500},
+    {301, -0.5600},
+    {302, 0.4600},
+    {303, -0.5100},
+    {304, 0.3400},
+    {305, 0.1200},
+    {306, 0.5200},
+    {307, 0.3800},
+    {308, -0.8000},
+    {309, 0.4000},
+    {310, -0.5100},
+    {311, -0.0100},
+    {312, 0.1200},
+    {313, -0.0100},
+    {314, 0.1400},
+    {315, -0.0100},
+    {316, 0.1300},
+    {317, -0.6400},
+    {318, 0.6500},
+    {319, -0.7400},
+    {320, 0.6600},
+    {321, -0.0600},
+    {322, 0.1000},
+    {323, 0.4900},
+    {324, -0.3000},
+    {325, 0.4800},
+    {326, -0.8100},
+    {327, 0.4600},
+    {328, 0.4300},
+    {329, 0.1400},
+    {330, 0.1400},
+    {331, 0.0100},
+    {332, 0.1600},
+    {333, 0.7800},
+    {334, -0.6600},
+    {335, -0.4300},
+    {336, 0.2000},
+    {337, 0.1800},
+    {338, -0.0600},
+    {339, 0.1200},
+    {340, -1.0000},
+    {341, -1.0000},
+    {342, -1.0000},
+    {343, -1.0000},
+    {344, 1.0000},
+    {345, 1.0000},
+    {346, 1.0000},
+    {347, 1.0000},
+    {348, 1.0000},
+    {349, 1.0000},
+    {350, 2.0000},
+    {351, 2.0000},
+    {352, 2.0000},
+    {353, 2.0000},
+    {354, -0.4000},
+    {355, 0.1000},
+    {356, -0.9000},
+    {357, -0.2000},
+    {358, 0.0600},
+    {359, -0.9800},
+    {360, -1.0700},
+    {361, 0.1900},
+    {362, 0.5100},
+    {363, -0.8200},
+    {364, -0.3000},
+    {365, 0.0700},
+    {366, -1.3100},
+    {367, 0.4000},
+    {368, -0.4000},
+    {369, 0.0800},
+    {370, 0.0000},
+    {371, 0.0700},
+    {372, -0.9800},
+    {373, -1.3000},
+    {374, 0.3000},
+    {375, 2.5000},
+    {376, -0.2500},
+    {377, -0.8650},
+    {378, 1.6200},
+    {379, -0.9200},
+    {380, -0.6000},
+    {381, 0.3000},
+    {382, -0.0300},
+    {383, 1.9200},
+    {384, -1.1200},
+    {385, -0.7000},
+    {386, 0.4400},
+    {387, -0.1000},
+    {388, 1.6200},
+    {389, -0.9700},
+    {390, -0.6300},
+    {391, 0.2800},
+    {392, -0.0200},
+    {393, -0.5100},
+    {394, 0.0800},
+    {395, -0.1400},
+    {396, 0.3200},
+    {397, 0.0200},
+    {398, -0.0400},
+    {399, -0.4700},
+    {400, 0.1200},
+    {401, 0.1400},
+    {402, 0.2400},
+    {403, 0.5100},
+    {404, -0.4300},
+    {405, -0.3300},
+    {406, 0.1600},
+    {407, 0.0300},
+    {408, 0.6350},
+    {409, 0.6250},
+    {410, 0.1350},
+    {411, -0.2150},
+    {412, 1.4800},
+    {413, -0.6800},
+    {414, -0.5400},
+    {415, 0.1800},
+    {416, -1.0000},
+    {417, 0.4400},
+    {418, -0.8000},
+    {419, 0.4100},
+    {420, 0.1800},
+    {421, 0.0300},
+    {422, 0.3900},
+    {423, -0.0600},
+    {424, -0.1800},
+    {425, 0.0600},
+    {426, 0.0000},
+    {427, 0.0300},
+    {428, 0.1900},
+    {429, 0.2200},
+    {430, 0.2500},
+    {431, 1.3740},
+    {432, -0.6870},
+    {433, 0.2450},
+    {434, 0.1300},
+    {435, -0.4200},
+    {436, -0.0350},
+    {437, 0.0250},
+    {438, 0.0750},
+    {439, -0.0550},
+    {440, 0.1300},
+    {441, -0.5700},
+    {442, 0.4200},
+    {443, -0.0050},
+    {444, 0.2950},
+    {445, -0.0150},
+    {446, 0.0150},
+    {447, 0.3850},
+    {448, 0.2150},
+    {449, -0.4900},
+    {450, -0.5400},
+    {451, 0.4600},
+    {452, -0.1150},
+    {453, 0.0550},
+    {454, 0.1150},
+    {455, -0.0300},
+    {456, 0.0850},
+    {457, 0.0000},
+    {458, -0.6780},
+    {459, 0.4730},
+    {460, -0.4470},
+    {461, 0.2270},
+    {462, 0.0120},
+    {463, 0.1550},
+    {464, 0.0650},
+    {465, -0.4680},
+    {466, 0.1920},
+    {467, 0.0420},
+    {468, -0.8390},
+    {469, 0.8740},
+    {470, 0.6530},
+    {471, -0.6890},
+    {472, -0.0320},
+    {473, 0.0110},
+    {474, 0.1970},
+    {475, -0.3310},
+    {476, 0.3780},
+    {477, -0.1600},
+    {478, -0.0090},
+    {479, 0.1220},
+    {480, -0.2390},
+    {481, -0.1630},
+    {482, -0.1490},
+    {483, 0.3170},
+    {484, 0.1550},
+    {485, 0.1180},
+    {486, -0.0590},
+    {487, -0.4910},
+    {488, 0.2460},
+    {489, -0.3200},
+    {490, -0.0340},
+    {491, 0.3010},
+    {492, 0.0720},
+    {493, 0.1500},
+    {494, 0.1350},
+    {495, -0.2570},
+    {496, 0.2750},
+    {497, -0.5630},
+    {498, 0.1850},
+    {499, -0.2860},
+    {500, 0.3060},
+    {501, 0.0780},
+    {502, 0.0750},
+    {503, 0.1870},
+    {504, -0.1900},
+    {505, -0.0190},
+    {506, -0.1540},
+    {507, 0.1420},
+    {508, 0.1260},
+    {509, -0.2570},
+    {510, 0.5110},
+    {511, -0.5900},
+    {512, 0.1690},
+    {513, -0.1480},
+    {514, 0.0430},
+    {515, 0.0910},
+    {516, 0.1810},
+    {517, -0.1220},
+    {518, -0.4130},
+    {519, 0.4050},
+    {520, -0.4550},
+    {521, 0.2500},
+    {522, 0.0530},
+    {523, 0.1840},
+    {524, 0.0980},
+    {525, -0.5000},
+    {526, 0.0010},
+    {527, -0.3900},
+    {528, -0.2700},
+    {529, -0.1270},
+    {530, -0.1080},
+    {531, -0.2580},
+    {532, 0.2200},
+    {533, 0.2250},
+    {534, 0.3760},
+    {535, 0.1470},
+    {536, 0.1720},
+    {537, 0.1550},
+    {538, 0.1070},
+    {539, 0.1100},
+    {540, 0.1400},
+    {541, -0.6940},
+    {542, 0.4250},
+    {543, -0.3590},
+    {544, -0.0080},
+    {545, -0.1970},
+    {546, -0.1120},
+    {547, -0.0700},
+    {548, -0.3070},
+    {549, 0.5630},
+    {550, -0.0510},
+    {551, 0.0280},
+    {552, 0.1460},
+    {553, 0.1190},
+    {554, 0.1330},
+    {555, 0.1130},
+    {556, 0.1140},
+    {557, 0.1570},
+    {558, -0.7600},
+    {559, 0.6790},
+    {560, -0.7880},
+    {561, 0.7360},
+    {562, 0.0380},
+    {563, 0.3430},
+    {564, -0.6420},
+    {565, 0.4520},
+    {566, -0.6820},
+    {567, 0.0240},
+    {568, 0.1010},
+    {569, 0.0860},
+    {570, 0.4130},
+    {571, -0.0300},
+    {572, 0.2420},
+    {573, -0.5150},
+    {574, 0.2280},
+    {575, -0.2990},
+    {576, 0.1010},
+    {577, 0.0680},
+    {578, 0.2050},
+    {579, -0.9510},
+    {580, 0.9650},
+    {581, -0.0140},
+    {582, 0.1300},
+    {583, 0.0520},
+    {584, -0.5990},
+    {585, 0.3920},
+    {586, -0.3480},
+    {587, 0.0200},
+    {588, -0.0420},
+    {589, 0.3470},
+    {590, -0.1960},
+    {591, 0.0320},
+    {592, 0.1460},
+    {593, 0.1080},
+    {594, 0.1400},
+    {595, 0.1220},
+    {596, 0.1660},
+    {597, -0.5800},
+    {598, 0.1730},
+    {599, -0.3950},
+    {600, -0.1990},
+    {601, 0.1180},
+    {602, 0.0930},
+    {603, 0.2080},
+    {604, 0.0980},
+    {605, -0.1390},
+    {606, -0.0790},
+    {607, 0.0990},
+    {608, -0.1680},
+    {609, -0.1080},
+    {610, -0.1890},
+    {611, -0.1290},
+    {612, -0.1690},
+    {613, -0.1090},
+    {614, -0.1380},
+    {615, -0.0780},
+    {616, -0.0250},
+    {617, 0.0350},
+    {618, -0.0380},
+    {619, 0.0220},
+    {620, -0.3340},
+    {621, 0.2550},
+    {622, 0.5230},
+    {623, 0.5000},
+    {624, -0.1400},
+    {625, 0.2275},
+    {626, 0.1400},
+    {627, -0.0080},
+    {628, 0.5880},
+    {629, -0.1030},
+    {630, -0.3320},
+    {631, 0.0400},
+    {632, 0.3420},
+    {633, -0.0500},
+    {634, -0.2050},
+    {635, 3.0000},
+    {636, 4.0000},
+    {637, 3.0000},
+    {638, 0.6190},
+    {639, -0.3950},
+    {640, 0.1740},
+    {641, 3.0000},
+    {642, 3.0000},
+    {643, 3.0000},
+    {644, 3.0000},
+    {645, 3.0000},
+    {646, -0.3440},
+    {647, -0.6280},
+    {648, 0.2000},
+    {649, -0.1200},
+    {650, -0.0600},
+    {651, 0.0000},
+    {652, -0.2300},
+    {653, 0.0300},
+    {654, -0.0990},
+    {655, 0.0990},
+    {656, 0.2200},
+    {657, -0.2200},
+    {658, 0.1300},
+    {659, -0.1300},
+    {660, -0.2200},
+    {661, 0.2200},
+    {662, 0.1500},
+    {663, 0.4500},
+    {664, -0.2000},
+    {665, 0.2000},
+    {666, -0.2000},
+    {667, 0.2000},
+    {668, -0.2000},
+    {669, 0.1000},
+    {670, -0.1000},
+    {671, 0.0550},
+    {672, -0.2200},
+    {673, 0.0650},
+    {674, 0.0130},
+    {675, -0.1060},
+    {676, -0.0900},
+    {677, -0.1190},
+    {678, 0.1410},
+    {679, 0.1290},
+    {680, 0.8270},
+    {681, -0.8850},
+    {682, 0.4260},
+    {683, 0.4650},
+    {684, 0.1190},
+    {685, -0.0200},
+    {686, 0.0400},
+    {687, -0.6200},
+    {688, -0.7850},
+    {689, -0.7850},
+    {690, 0.5500},
+    {691, -0.5600},
+    {692, 0.4600},
+    {693, -0.0800},
+    {694, -0.0200},
+    {695, 0.0400},
+    {696, 0.1000},
+    {697, 0.0600},
+    {698, 0.5400},
+    {699, -0.3700},
+    {700, 0.0200},
+    {701, 0.0600},
+    {702, 0.0800},
+    {703, 0.1400},
+    {704, 0.2000},
+    {705, 0.6500},
+    {706, 0.0900},
+    {707, 0.0350},
+    {708, -0.9000},
+    {709, -0.5000},
+    {710, 0.8600},
+    {711, -0.4500},
+    {712, 0.2100},
+    {713, 0.1600},
+    {714, -0.1000},
+    {715, 0.0300},
+    {716, 0.0300},
+    {717, 0.0600},
+    {718, -0.7800},
+    {719, 0.9684},
+    {720, -0.5081},
+    {721, -0.0080},
+    {722, 0.1720},
+    {723, 1.3400},
+    {724, -0.3900},
+    {725, 0.7940},
+    {726, -0.5980},
+    {727, 0.0000},
+    {728, 0.5110},
+    {729, -1.0220},
+    {730, -0.9000},
+    {731, -0.7800},
+    {732, -0.6300},
+    {733, 0.0000},
+    {734, 0.0200},
+    {735, 0.0300},
+    {736, 0.0600},
+    {737, 0.0800},
+    {738, 0.0900},
+    {739, 0.3600},
+    {740, 0.3800},
+    {741, 0.0600},
+    {742, 0.1200},
+    {743, 0.1800},
+    {744, 0.1400},
+    {745, 0.1500},
+    {746, 0.1800},
+    {747, 0.2000},
+    {748, 0.2100},
+    {749, 0.1150},
+    {750, 0.1750},
+    {751, 0.2350},
+    {752, 0.1950},
+    {753, 0.1525},
+    {754, 0.1350},
+    {755, -0.2100},
+    {756, 0.2000},
+    {757, 0.0100},
+    {758, 0.0100},
+    {759, 0.0100},
+    {760, 0.0600},
+    {761, 0.4500},
+    {762, 0.4800},
+    {763, 0.5100},
+    {764, -0.6550},
+    {765, 0.3900},
+    {766, -0.5000},
+    {767, -0.5600},
+    {768, -0.6000},
+    {769, 0.0000},
+    {770, -0.1000},
+    {771, 0.2900},
+    {772, 0.0900},
+    {773, 0.1500},
+    {774, 0.2100},
+    {775, 0.2700},
+    {776, 0.0960},
+    {777, -0.0390},
+    {778, 0.0270},
+    {779, 0.0110},
+    {780, 0.0740},
+    {781, -0.0290},
+    {782, 0.7000},
+    {783, -0.3520},
+    {784, -0.7090},
+    {785, 0.3170},
+    {786, -0.2200},
+    {787, 0.0200},
+    {788, 0.1000},
+    {789, 0.1200},
+    {790, 0.2200},
+    {791, 0.3600},
+    {792, 0.2400},
+    {793, 0.1200},
+    {794, 0.4800},
+    {795, -0.1200},
+    {796, 0.2500},
+    {797, 0.1500},
+    {798, -0.0800},
+    {799, -0.1060},
+    {800, -0.2000},
+    {801, -0.0060},
+    {802, 0.1030},
+    {803, 0.0970},
+    {804, 0.2000},
+    {805, -0.2000},
+    {806, -0.0060},
+    {807, 0.1030},
+    {808, 0.0970},
+    {809, 0.2000},
+    {810, -0.0800},
+    {811, -0.0800},
+    {812, -0.0800},
+    {813, 0.1000},
+    {814, -0.2500},
+    {815, 0.6000},
+    {816, -0.1500},
+    {817, -0.0250},
+    {818, -0.0450},
+    {819, 0.1450},
+    {820, 0.8880},
+    {821, 1.0030},
+    {822, -0.6580},
+    {823, -0.6340},
+    {824, 0.4110},
+    {825, -0.4420},
+    {826, 0.4350},
+    {827, 0.2250},
+    {828, 0.2550},
+    {829, -0.0340},
+    {830, 0.0030},
+    {831, 0.3000},
+    {832, -0.0400},
+    {833, -0.0575},
+    {834, 2.0000},
+    {835, -0.0700},
+    {836, 0.0300},
+    {837, 0.1300},
+    {838, -0.1300},
+    {839, 0.1000},
+    {840, -0.6850},
+    {841, 0.1550},
+    {842, -0.1000},
+    {843, -0.4270},
+    {844, 0.2180},
+    {845, 0.6000},
+    {846, -0.6000},
+    {847, -0.3600},
+    {848, 0.0000},
+    {849, 0.0600},
+    {850, 0.1200},
+    {851, 0.1800},
+    {852, 0.0600},
+    {853, 0.5700},
+    {854, -0.5700},
+    {855, 0.0000},
+    {856, 0.0200},
+    {857, -0.0400},
+    {858, 0.0000},
+    {859, 0.0600},
+    {860, -0.0700},
+    {861, -0.1400},
+    {862, 0.1700},
+    {863, 0.1100},
+    {864, 0.1500},
+    {865, 0.1700},
+    {866, 1.0000},
+    {867, 0.8500},
+    {868, 0.7000},
+    {869, 0.5500},
+    {870, -0.1000},
+    {871, -0.4300},
+    {872, -0.3700},
+    {873, -0.3100},
+    {874, -0.2500},
+    {875, -1.0000},
+    {876, -1.0000},
+    {877, -1.0000},
+    {878, -1.0000},
+    {879, 1.0000},
+    {880, 1.0000},
+    {881, 1.0000},
+    {882, 1.0000},
+    {883, 1.0000},
+    {884, 2.0000},
+    {885, 2.0000},
+    {886, 2.0000},
+    {887, 2.0000},
+    {888, -0.0500},
+    {889, 0.0500},
+    {890, 0.1500},
+    {891, 0.2500},
+    {892, 0.1000},
+    {893, 0.1150},
+    {894, 0.1350},
+    {895, 0.0150},
+    {896, 0.1550},
+    {897, 0.0000},
+    {898, -0.1150},
+    {899, 0.1500},
+    {900, -0.2500},
+    {901, -0.1000},
+    {902, 0.0500},
+    {903, -0.1000},
+    {904, 0.2000},
+    {905, -0.2500},
+    {906, 0.0880},
+};
+
+template<typename T, size_t N>
+size_t count(const T (&)[N])
+{
+    return N;
+}
+
+} // end anonymous namespace
+
+// --- OPLS-AA Parameters -------------------------------------------------- //
+void OplsParameters::setOplsAaParameters()
+{
+    for(size_t i = 0; i < count(AtomData); i++){
+        const OplsAtomData &data = AtomData[i];
+
+        if(m_typeToClass.size() < static_cast<size_t>(data.type + 1))
+            m_typeToClass.resize(data.type + 1);
+        m_typeToClass[data.type] = data.klass;
+
+        if(m_typeToName.size() < static_cast<size_t>(data.type + 1))
+            m_typeToName.resize(data.type + 1);
+        m_typeToName[data.type] = data.name;
+    }
+
+    m_bondStrechParameters.assign(BondStrechParameters, BondStrechParameters + count(BondStrechParameters));
+    m_angleBendParameters.assign(AngleBendParameters, AngleBendParameters + count(AngleBendParameters));
+    m_torsionParameters.assign(TorsionParameters, TorsionParameters + count(TorsionParameters));
+
+    for(size_t i = 0; i < count(VanDerWaalsData); i++){
+        const OplsVanDerWaalsData &data = VanDerWaalsData[i];
+
+        if(m_vanDerWaalsParameters.size() < static_cast<size_t>(data.type + 1))
+            m_vanDerWaalsParameters.resize(data.type + 1);
+        m_vanDerWaalsParameters[data.type] = data.parameters;
+    }
+
+    for(size_t i = 0; i < count(ChargeData); i++){
+        const OplsChargeData &data = ChargeData[i];
+
+        if(m_typeToCharge.size() < static_cast<size_t>(data.type + 1))
+            m_typeToCharge.resize(data.type + 1);
+        m_typeToCharge[data.type] = data.charge;
+    }
+}
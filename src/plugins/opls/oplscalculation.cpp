@@ -35,8 +35,10 @@
 
 #include "oplscalculation.h"
 
+#include <boost/thread/locks.hpp>
 #include <boost/lexical_cast.hpp>
 
+#include <chemkit/foreach.h>
 #include <chemkit/topology.h>
 #include <chemkit/constants.h>
 #include <chemkit/cartesiancoordinates.h>
@@ -324,3 +326,114 @@ std::vector<chemkit::Vector3> OplsNonbondedCalculation::gradient(const chemkit::
 
     return gradient;
 }
+
+// === OplsNeighborListCalculation ========================================= //
+// Calculates the nonbonded energy for each pair of atoms within the
+// nonbonded cutoff distance using a neighbor list.
+OplsNeighborListCalculation::OplsNeighborListCalculation(size_t size, chemkit::Real cutoff, chemkit::Real skin)
+    : OplsCalculation(VanDerWaals | Electrostatic, size, 0),
+      m_neighborList(size, cutoff, skin)
+{
+    for(size_t i = 0; i < size; i++){
+        setAtom(i, i);
+    }
+}
+
+bool OplsNeighborListCalculation::setup(const OplsParameters *parameters)
+{
+    m_neighborList.addExclusions(topology().get());
+
+    m_charges.resize(atomCount());
+    m_sigmas.resize(atomCount());
+    m_epsilons.resize(atomCount());
+
+    bool ok = true;
+
+    for(size_t i = 0; i < atomCount(); i++){
+        int type = boost::lexical_cast<int>(atomType(i));
+
+        const OplsVanDerWaalsParameters *p = parameters->vanDerWaalsParameters(type);
+        if(!p){
+            ok = false;
+            continue;
+        }
+
+        // store square roots so that the geometric mean of sigma and
+        // epsilon becomes a product for each pair
+        m_charges[i] = parameters->partialCharge(type);
+        m_sigmas[i] = sqrt(p->sigma);
+        m_epsilons[i] = sqrt(p->epsilon);
+    }
+
+    return ok;
+}
+
+chemkit::Real OplsNeighborListCalculation::energy(const chemkit::CartesianCoordinates *coordinates) const
+{
+    boost::lock_guard<boost::mutex> lock(m_neighborListMutex);
+    m_neighborList.update(coordinates);
+
+    const boost::shared_ptr<chemkit::Topology> &topology = this->topology();
+    chemkit::Real cutoff = m_neighborList.cutoff();
+    chemkit::Real e = 332.06; // vacuum permitivity
+    chemkit::Real energy = 0;
+
+    foreach(const chemkit::NeighborList::Pair &pair, m_neighborList.pairs()){
+        size_t a = pair[0];
+        size_t b = pair[1];
+
+        chemkit::Real r = coordinates->distance(a, b);
+        if(r > cutoff){
+            continue;
+        }
+
+        chemkit::Real qa = m_charges[a];
+        chemkit::Real qb = m_charges[b];
+        chemkit::Real sigma = m_sigmas[a] * m_sigmas[b];
+        chemkit::Real epsilon = m_epsilons[a] * m_epsilons[b];
+        chemkit::Real scale = topology->isOneFour(a, b) ? 0.5 : 1.0;
+
+        energy += scale * ((qa * qb * e) / r + 4.0 * epsilon * (pow(sigma / r, 12) - pow(sigma / r, 6)));
+    }
+
+    return energy;
+}
+
+std::vector<chemkit::Vector3> OplsNeighborListCalculation::gradient(const chemkit::CartesianCoordinates *coordinates) const
+{
+    boost::lock_guard<boost::mutex> lock(m_neighborListMutex);
+    m_neighborList.update(coordinates);
+
+    std::vector<chemkit::Vector3> gradient(atomCount(), chemkit::Vector3(0, 0, 0));
+
+    const boost::shared_ptr<chemkit::Topology> &topology = this->topology();
+    chemkit::Real cutoff = m_neighborList.cutoff();
+    chemkit::Real e = 332.06; // vacuum permitivity
+
+    foreach(const chemkit::NeighborList::Pair &pair, m_neighborList.pairs()){
+        size_t a = pair[0];
+        size_t b = pair[1];
+
+        chemkit::Vector3 ab = (*coordinates)[a] - (*coordinates)[b];
+        chemkit::Real r = ab.norm();
+        if(r > cutoff){
+            continue;
+        }
+
+        chemkit::Real qa = m_charges[a];
+        chemkit::Real qb = m_charges[b];
+        chemkit::Real sigma = m_sigmas[a] * m_sigmas[b];
+        chemkit::Real epsilon = m_epsilons[a] * m_epsilons[b];
+        chemkit::Real scale = topology->isOneFour(a, b) ? 0.5 : 1.0;
+        chemkit::Real sr = sigma / r;
+
+        // dE/dr divided by r
+        chemkit::Real de_dr = scale * ((1.0 / pow(r, 3)) * (-qa * qb * e + -4.0 * epsilon * sigma * (12.0 * pow(sr, 11) - 6.0 * pow(sr, 5))));
+
+        chemkit::Vector3 de_da = ab * de_dr;
+        gradient[a] += de_da;
+        gradient[b] -= de_da;
+    }
+
+    return gradient;
+}
@@ -36,6 +36,9 @@
 #ifndef OPLSCALCULATION_H
 #define OPLSCALCULATION_H
 
+#include <boost/thread/mutex.hpp>
+
+#include <chemkit/neighborlist.h>
 #include <chemkit/forcefieldcalculation.h>
 
 #include "oplsparameters.h"
@@ -89,4 +92,21 @@ public:
     std::vector<chemkit::Vector3> gradient(const chemkit::CartesianCoordinates *coordinates) const CHEMKIT_OVERRIDE;
 };
 
+class OplsNeighborListCalculation : public OplsCalculation
+{
+public:
+    OplsNeighborListCalculation(size_t size, chemkit::Real cutoff, chemkit::Real skin);
+
+    bool setup(const OplsParameters *parameters);
+    chemkit::Real energy(const chemkit::CartesianCoordinates *coordinates) const CHEMKIT_OVERRIDE;
+    std::vector<chemkit::Vector3> gradient(const chemkit::CartesianCoordinates *coordinates) const CHEMKIT_OVERRIDE;
+
+private:
+    mutable chemkit::NeighborList m_neighborList;
+    mutable boost::mutex m_neighborListMutex;
+    std::vector<chemkit::Real> m_charges;
+    std::vector<chemkit::Real> m_sigmas;
+    std::vector<chemkit::Real> m_epsilons;
+};
+
 #endif // OPLSCALCULATION_H
@@ -55,7 +55,9 @@ OplsForceField::OplsForceField()
 
     const chemkit::Plugin *oplsPlugin = chemkit::PluginManager::instance()->plugin("opls");
     if(oplsPlugin){
-        m_parameters = new OplsParameters(oplsPlugin->dataPath() + "oplsaa.prm");
+        m_defaultParameterFile = oplsPlugin->dataPath() + "oplsaa.prm";
+        addParameterSet("oplsaa", m_defaultParameterFile);
+        setParameterSet("oplsaa");
     }
 }
 
@@ -72,6 +74,19 @@ bool OplsForceField::setup()
         return false;
     }
 
+    if(!m_parameters || m_parameters->fileName() != parameterFile()){
+        delete m_parameters;
+
+        // the default parameters are compiled into the plugin
+        if(parameterFile() == m_defaultParameterFile){
+            m_parameters = new OplsParameters;
+            m_parameters->setFileName(m_defaultParameterFile);
+        }
+        else{
+            m_parameters = new OplsParameters(parameterFile());
+        }
+    }
+
     foreach(const chemkit::Topology::BondedInteraction &interaction, topology->bondedInteractions()){
         addCalculation(new OplsBondStrechCalculation(interaction[0],
                                                      interaction[1]));
@@ -90,9 +105,16 @@ bool OplsForceField::setup()
                                                   interaction[3]));
     }
 
-    foreach(const chemkit::Topology::NonbondedInteraction &interaction, topology->nonbondedInteractions()){
-        addCalculation(new OplsNonbondedCalculation(interaction[0],
-                                                    interaction[1]));
+    if(nonbondedCutoff() > 0){
+        addCalculation(new OplsNeighborListCalculation(topology->size(),
+                                                       nonbondedCutoff(),
+                                                       neighborListSkin()));
+    }
+    else{
+        foreach(const chemkit::Topology::NonbondedInteraction &interaction, topology->nonbondedInteractions()){
+            addCalculation(new OplsNonbondedCalculation(interaction[0],
+                                                        interaction[1]));
+        }
     }
 
     bool ok = true;
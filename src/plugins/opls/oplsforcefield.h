@@ -36,6 +36,8 @@
 #ifndef OPLSFORCEFIELD_H
 #define OPLSFORCEFIELD_H
 
+#include <string>
+
 #include <chemkit/forcefield.h>
 
 class OplsParameters;
@@ -52,6 +54,7 @@ public:
 
 private:
     OplsParameters *m_parameters;
+    std::string m_defaultParameterFile;
 };
 
 #endif // OPLSFORCEFIELD_H
@@ -36,13 +36,72 @@
 #include "oplsparameters.h"
 
 #include <fstream>
+#include <algorithm>
 
 #include <boost/lexical_cast.hpp>
 #include <boost/algorithm/string.hpp>
 
 #include <chemkit/foreach.h>
 
+namespace {
+
+// orders the bond, angle and torsion parameters by their atom classes
+// so that they can be found with a binary search
+struct ClassOrder
+{
+    bool operator()(const OplsBondStrechParameters &a, const OplsBondStrechParameters &b) const
+    {
+        if(a.typeA != b.typeA)
+            return a.typeA < b.typeA;
+
+        return a.typeB < b.typeB;
+    }
+
+    bool operator()(const OplsAngleBendParameters &a, const OplsAngleBendParameters &b) const
+    {
+        if(a.typeA != b.typeA)
+            return a.typeA < b.typeA;
+        if(a.typeB != b.typeB)
+            return a.typeB < b.typeB;
+
+        return a.typeC < b.typeC;
+    }
+
+    bool operator()(const OplsTorsionParameters &a, const OplsTorsionParameters &b) const
+    {
+        if(a.typeA != b.typeA)
+            return a.typeA < b.typeA;
+        if(a.typeB != b.typeB)
+            return a.typeB < b.typeB;
+        if(a.typeC != b.typeC)
+            return a.typeC < b.typeC;
+
+        return a.typeD < b.typeD;
+    }
+};
+
+// returns the first parameters with the same atom classes as key
+template<typename T>
+const T* findParameters(const std::vector<T> &parameters, const T &key)
+{
+    typename std::vector<T>::const_iterator iter =
+        std::lower_bound(parameters.begin(), parameters.end(), key, ClassOrder());
+
+    if(iter == parameters.end() || ClassOrder()(key, *iter)){
+        return 0;
+    }
+
+    return &*iter;
+}
+
+} // end anonymous namespace
+
 // --- Construction and Destruction ---------------------------------------- //
+OplsParameters::OplsParameters()
+{
+    setOplsAaParameters();
+}
+
 OplsParameters::OplsParameters(const std::string &fileName)
     : m_fileName(fileName)
 {
@@ -89,13 +148,11 @@ const OplsBondStrechParameters* OplsParameters::bondStrechParameters(int a, int
         std::swap(a, b);
     }
 
-    foreach(const OplsBondStrechParameters &p, m_bondStrechParameters){
-        if(p.typeA == a && p.typeB == b){
-            return &p;
-        }
-    }
+    OplsBondStrechParameters key;
+    key.typeA = a;
+    key.typeB = b;
 
-    return 0;
+    return findParameters(m_bondStrechParameters, key);
 }
 
 const OplsAngleBendParameters* OplsParameters::angleBendParameters(int a, int b, int c) const
@@ -108,13 +165,12 @@ const OplsAngleBendParameters* OplsParameters::angleBendParameters(int a, int b,
         std::swap(a, c);
     }
 
-    foreach(const OplsAngleBendParameters &p, m_angleBendParameters){
-        if(p.typeA == a && p.typeB == b && p.typeC == c){
-            return &p;
-        }
-    }
+    OplsAngleBendParameters key;
+    key.typeA = a;
+    key.typeB = b;
+    key.typeC = c;
 
-    return 0;
+    return findParameters(m_angleBendParameters, key);
 }
 
 const OplsTorsionParameters* OplsParameters::torsionParameters(int a, int b, int c, int d) const
@@ -132,13 +188,13 @@ const OplsTorsionParameters* OplsParameters::torsionParameters(int a, int b, int
         std::swap(a, d);
     }
 
-    foreach(const OplsTorsionParameters &p, m_torsionParameters){
-        if(p.typeA == a && p.typeB == b && p.typeC == c && p.typeD == d){
-            return &p;
-        }
-    }
+    OplsTorsionParameters key;
+    key.typeA = a;
+    key.typeB = b;
+    key.typeC = c;
+    key.typeD = d;
 
-    return 0;
+    return findParameters(m_torsionParameters, key);
 }
 
 const OplsVanDerWaalsParameters* OplsParameters::vanDerWaalsParameters(int type) const
@@ -285,5 +341,16 @@ bool OplsParameters::read(const std::string &fileName)
         }
     }
 
+    sort();
+
     return true;
 }
+
+void OplsParameters::sort()
+{
+    // stable sorts keep duplicate parameters in file order so the
+    // first one in the file is still the one that is found
+    std::stable_sort(m_bondStrechParameters.begin(), m_bondStrechParameters.end(), ClassOrder());
+    std::stable_sort(m_angleBendParameters.begin(), m_angleBendParameters.end(), ClassOrder());
+    std::stable_sort(m_torsionParameters.begin(), m_torsionParameters.end(), ClassOrder());
+}
@@ -79,6 +79,7 @@ class OplsParameters
 {
 public:
     // construction and destruction
+    OplsParameters();
     OplsParameters(const std::string &fileName);
     ~OplsParameters();
 
@@ -97,6 +98,8 @@ public:
 
 private:
     bool read(const std::string &fileName);
+    void setOplsAaParameters();
+    void sort();
 
 private:
     std::string m_fileName;
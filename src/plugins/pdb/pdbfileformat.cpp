@@ -36,6 +36,11 @@
 #include <iostream>
 #include "pdbfileformat.h"
 
+#include <cstring>
+#include <iterator>
+#include <algorithm>
+
+#include <boost/cstdint.hpp>
 #include <boost/algorithm/string.hpp>
 
 #include <chemkit/atom.h>
@@ -52,11 +57,169 @@
 
 namespace {
 
+// --- Field Parsing ------------------------------------------------------- //
+// The fields in each record are read in place from fixed columns in
+// the line. Columns are zero-based and fields past the end of the
+// line are treated as blank.
+
+// Reads the integer in the field at column with width from line.
+int readInteger(const char *line, size_t length, size_t column, size_t width)
+{
+    if(column >= length){
+        return 0;
+    }
+
+    const char *s = line + column;
+    const char *end = s + std::min(width, length - column);
+
+    // skip any leading white space
+    while(s < end && isspace(*s)){
+        s++;
+    }
+
+    bool negative = false;
+    if(s < end && (*s == '-' || *s == '+')){
+        negative = *s++ == '-';
+    }
+
+    int number = 0;
+    for(; s < end && isdigit(*s); s++){
+        number = number * 10 + (*s - '0');
+    }
+
+    return negative ? -number : number;
+}
+
+// Reads the real number in the field at column with width from line.
+double readReal(const char *line, size_t length, size_t column, size_t width)
+{
+    if(column >= length){
+        return 0;
+    }
+
+    const char *s = line + column;
+    const char *end = s + std::min(width, length - column);
+
+    // skip any leading white space
+    while(s < end && isspace(*s)){
+        s++;
+    }
+
+    bool negative = false;
+    if(s < end && (*s == '-' || *s == '+')){
+        negative = *s++ == '-';
+    }
+
+    // read the digits as an integer and divide by the number
+    // of decimal places (fields are at most 8 characters wide)
+    boost::uint64_t mantissa = 0;
+    int decimalPlaces = 0;
+    bool decimalPoint = false;
+
+    for(; s < end; s++){
+        if(isdigit(*s)){
+            mantissa = mantissa * 10 + (*s - '0');
+            decimalPlaces += decimalPoint;
+        }
+        else if(*s == '.' && !decimalPoint){
+            decimalPoint = true;
+        }
+        else{
+            break;
+        }
+    }
+
+    static const double powersOfTen[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9,
+        1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18
+    };
+
+    double value = static_cast<double>(mantissa) / powersOfTen[std::min(decimalPlaces, 18)];
+
+    return negative ? -value : value;
+}
+
+// Returns the field at column with width from line with any leading
+// and trailing white space removed.
+std::string readString(const char *line, size_t length, size_t column, size_t width)
+{
+    size_t begin = std::min(column, length);
+    size_t end = std::min(column + width, length);
+
+    while(begin < end && isspace(line[begin])){
+        begin++;
+    }
+    while(end > begin && isspace(line[end-1])){
+        end--;
+    }
+
+    return std::string(line + begin, line + end);
+}
+
+// Returns the element for symbol ignoring the case of its letters.
+chemkit::Element elementFromSymbol(const char *symbol, size_t length)
+{
+    if(length == 0 || length > 3){
+        return chemkit::Element();
+    }
+
+    char buffer[3];
+    buffer[0] = toupper(symbol[0]);
+    for(size_t i = 1; i < length; i++){
+        buffer[i] = tolower(symbol[i]);
+    }
+
+    return chemkit::Element::fromSymbol(buffer, length);
+}
+
+bool startsWith(const char *line, size_t length, const char *prefix)
+{
+    size_t prefixLength = strlen(prefix);
+
+    return length >= prefixLength && memcmp(line, prefix, prefixLength) == 0;
+}
+
+// Reads lines from a block of memory.
+class LineReader
+{
+public:
+    LineReader(const char *data, size_t size)
+        : m_position(data),
+          m_end(data + size)
+    {
+    }
+
+    // Sets line and length to the next line (without its line
+    // ending). Returns false if there are no more lines.
+    bool readLine(const char *&line, size_t &length)
+    {
+        if(m_position >= m_end){
+            return false;
+        }
+
+        const char *newline = static_cast<const char *>(memchr(m_position, '\n', m_end - m_position));
+        const char *lineEnd = newline ? newline : m_end;
+
+        line = m_position;
+        length = lineEnd - m_position;
+        if(length && line[length-1] == '\r'){
+            length--;
+        }
+
+        m_position = newline ? newline + 1 : m_end;
+        return true;
+    }
+
+private:
+    const char *m_position;
+    const char *m_end;
+};
+
 // === PdbAtom ============================================================= //
 class PdbAtom
 {
 public:
-    PdbAtom(const char *data);
+    PdbAtom(const char *line, size_t length);
 
     int id;
     std::string name;
@@ -64,37 +227,34 @@ public:
     chemkit::Element element;
 };
 
-PdbAtom::PdbAtom(const char *data)
+PdbAtom::PdbAtom(const char *line, size_t length)
 {
     // atom id
-    sscanf(&data[7], "%d", &id);
+    id = readInteger(line, length, 6, 5);
 
     // atom name
-    name.clear();
-    for(int i = 13; i < 16; i++){
-        name += data[i];
-    }
-    boost::trim(name);
+    name = readString(line, length, 13, 3);
 
     // coordinates
-    double x, y, z;
-    sscanf(&data[31], "%lf%lf%lf", &x, &y, &z);
-    position = chemkit::Point3(x, y, z);
-
-    // atomic number
-    std::string symbol;
-    for(int i = 77; i < 79 && isalpha(data[i]); i++){
-        symbol += tolower(data[i]);
+    position = chemkit::Point3(readReal(line, length, 30, 8),
+                               readReal(line, length, 38, 8),
+                               readReal(line, length, 46, 8));
+
+    // element symbol (columns 77-78)
+    size_t begin = std::min(size_t(76), length);
+    size_t end = std::min(size_t(78), length);
+    while(begin < end && isspace(line[begin])){
+        begin++;
+    }
+    size_t symbolEnd = begin;
+    while(symbolEnd < end && isalpha(line[symbolEnd])){
+        symbolEnd++;
     }
-    boost::trim(symbol);
-    symbol[0] = toupper(symbol[0]);
-    element = chemkit::Element::fromSymbol(symbol);
+    element = elementFromSymbol(line + begin, symbolEnd - begin);
 
     if(!element.isValid()){
         // try atomic number from name
-        symbol = boost::to_lower_copy(name);
-        symbol[0] = toupper(symbol[0]);
-        element = chemkit::Element::fromSymbol(symbol);
+        element = elementFromSymbol(name.c_str(), name.length());
     }
 }
 
@@ -103,10 +263,9 @@ class PdbResidue
 {
 public:
     PdbResidue(const std::string &name, int index);
-    ~PdbResidue();
 
-    void addAtom(PdbAtom *atom);
-    std::vector<PdbAtom *> atoms() const;
+    void addAtom(const PdbAtom &atom);
+    const std::vector<PdbAtom>& atoms() const;
 
     std::string name() const;
     int index() const;
@@ -114,7 +273,7 @@ public:
 private:
     std::string m_name;
     int m_index;
-    std::vector<PdbAtom *> m_atoms;
+    std::vector<PdbAtom> m_atoms;
 };
 
 PdbResidue::PdbResidue(const std::string &name, int index)
@@ -123,19 +282,12 @@ PdbResidue::PdbResidue(const std::string &name, int index)
 {
 }
 
-PdbResidue::~PdbResidue()
-{
-    foreach(PdbAtom *atom, m_atoms){
-        delete atom;
-    }
-}
-
-void PdbResidue::addAtom(PdbAtom *atom)
+void PdbResidue::addAtom(const PdbAtom &atom)
 {
     m_atoms.push_back(atom);
 }
 
-std::vector<PdbAtom *> PdbResidue::atoms() const
+const std::vector<PdbAtom>& PdbResidue::atoms() const
 {
     return m_atoms;
 }
@@ -167,7 +319,8 @@ public:
     std::string name() const;
 
     void addResidue(PdbResidue *residue);
-    std::vector<PdbResidue *> residues() const;
+    const std::vector<PdbResidue *>& residues() const;
+    size_t atomCount() const;
 
     Type guessType() const;
     void buildIndex();
@@ -211,11 +364,21 @@ void PdbChain::addResidue(PdbResidue *residue)
     m_residues.push_back(residue);
 }
 
-std::vector<PdbResidue *> PdbChain::residues() const
+const std::vector<PdbResidue *>& PdbChain::residues() const
 {
     return m_residues;
 }
 
+size_t PdbChain::atomCount() const
+{
+    size_t count = 0;
+    foreach(const PdbResidue *residue, m_residues){
+        count += residue->atoms().size();
+    }
+
+    return count;
+}
+
 PdbChain::Type PdbChain::guessType() const
 {
     if(m_residues.empty())
@@ -267,7 +430,7 @@ int PdbChain::getResIdfromPdbResId(int pdb_res_id) const
 class PdbConformation
 {
 public:
-    PdbConformation(const char *data);
+    PdbConformation(const char *line, size_t length);
 
     chemkit::AminoAcid::Conformation type() const { return m_type; }
     char chain() const { return m_chain; }
@@ -281,21 +444,24 @@ private:
     int m_lastResidue;
 };
 
-PdbConformation::PdbConformation(const char *data)
+PdbConformation::PdbConformation(const char *line, size_t length)
 {
     m_type = chemkit::AminoAcid::Coil;
+    m_chain = 0;
+    m_firstResidue = 0;
+    m_lastResidue = 0;
 
-    if(strncmp("HELIX", data, 5) == 0){
+    if(startsWith(line, length, "HELIX")){
         m_type = chemkit::AminoAcid::AlphaHelix;
-        m_chain = data[19];
-        sscanf(&data[21], "%d", &m_firstResidue);
-        sscanf(&data[33], "%d", &m_lastResidue);
+        m_chain = length > 19 ? line[19] : ' ';
+        m_firstResidue = readInteger(line, length, 21, 4);
+        m_lastResidue = readInteger(line, length, 33, 4);
     }
-    else if(strncmp("SHEET", data, 5) == 0){
+    else if(startsWith(line, length, "SHEET")){
         m_type = chemkit::AminoAcid::BetaSheet;
-        m_chain = data[21];
-        sscanf(&data[22], "%d", &m_firstResidue);
-        sscanf(&data[33], "%d", &m_lastResidue);
+        m_chain = length > 21 ? line[21] : ' ';
+        m_firstResidue = readInteger(line, length, 22, 4);
+        m_lastResidue = readInteger(line, length, 33, 4);
     }
 }
 
@@ -303,7 +469,7 @@ PdbConformation::PdbConformation(const char *data)
 class PdbConformer
 {
 public:
-    PdbConformer(std::istream &input);
+    PdbConformer(LineReader &reader, size_t atomCount);
 
     chemkit::Point3 position(int atom) const;
 
@@ -311,24 +477,19 @@ private:
     std::vector<chemkit::Point3> m_positions;
 };
 
-PdbConformer::PdbConformer(std::istream &input)
+PdbConformer::PdbConformer(LineReader &reader, size_t atomCount)
 {
-    for(;;){
-        std::string line;
-        std::getline(input, line);
+    m_positions.reserve(atomCount);
 
-        if(line.empty() || input.eof()){
-            break;
+    const char *line;
+    size_t length;
+    while(reader.readLine(line, length) && length){
+        if(startsWith(line, length, "ATOM")){
+            m_positions.push_back(chemkit::Point3(readReal(line, length, 30, 8),
+                                                  readReal(line, length, 38, 8),
+                                                  readReal(line, length, 46, 8)));
         }
-
-        if(boost::starts_with(line, "ATOM")){
-            chemkit::Real x = boost::lexical_cast<chemkit::Real>(boost::trim_left_copy(line.substr(30, 8)));
-            chemkit::Real y = boost::lexical_cast<chemkit::Real>(boost::trim_left_copy(line.substr(38, 8)));
-            chemkit::Real z = boost::lexical_cast<chemkit::Real>(boost::trim_left_copy(line.substr(46, 8)));
-
-            m_positions.push_back(chemkit::Point3(x, y, z));
-        }
-        else if(boost::starts_with(line, "ENDMDL")){
+        else if(startsWith(line, length, "ENDMDL")){
             break;
         }
     }
@@ -344,17 +505,16 @@ class PdbLigand
 {
 public:
     PdbLigand(const std::string &name, int index);
-    ~PdbLigand();
 
     std::string name() const;
     int index() const;
-    void addAtom(PdbAtom *atom);
-    std::vector<PdbAtom *> atoms() const;
+    void addAtom(const PdbAtom &atom);
+    const std::vector<PdbAtom>& atoms() const;
 
 private:
     int m_index;
     std::string m_name;
-    std::vector<PdbAtom *> m_atoms;
+    std::vector<PdbAtom> m_atoms;
 };
 
 PdbLigand::PdbLigand(const std::string &name, int index)
@@ -363,13 +523,6 @@ PdbLigand::PdbLigand(const std::string &name, int index)
     m_index = index;
 }
 
-PdbLigand::~PdbLigand()
-{
-    foreach(PdbAtom *atom, m_atoms){
-        delete atom;
-    }
-}
-
 std::string PdbLigand::name() const
 {
     return m_name;
@@ -380,12 +533,12 @@ int PdbLigand::index() const
     return m_index;
 }
 
-void PdbLigand::addAtom(PdbAtom *atom)
+void PdbLigand::addAtom(const PdbAtom &atom)
 {
     m_atoms.push_back(atom);
 }
 
-std::vector<PdbAtom *> PdbLigand::atoms() const
+const std::vector<PdbAtom>& PdbLigand::atoms() const
 {
     return m_atoms;
 }
@@ -397,7 +550,7 @@ public:
     PdbFile();
     ~PdbFile();
 
-    bool read(std::istream &input);
+    bool read(const char *data, size_t size);
 
     void addChain(PdbChain *chain);
     void addLigand(PdbLigand *ligand);
@@ -427,27 +580,24 @@ PdbFile::~PdbFile()
         delete conformer;
     foreach(PdbConformation *conformation, m_conformations)
         delete conformation;
+    foreach(PdbLigand *ligand, m_ligands)
+        delete ligand;
 }
 
-bool PdbFile::read(std::istream &input)
+bool PdbFile::read(const char *data, size_t size)
 {
     PdbChain *currentChain = 0;
     PdbLigand *currentLigand = 0;
     PdbResidue *currentResidue = 0;
+    size_t atomCount = 0;
 
-    for(;;){
-        std::string lineString;
-        std::getline(input, lineString);
-        if(lineString.empty() || input.eof()){
-            break;
-        }
-
-        const char *line = lineString.c_str();
+    LineReader reader(data, size);
 
-        if(strncmp("ATOM", line, 4) == 0){
-            PdbAtom *atom = new PdbAtom(line);
-
-            char chainId = line[21];
+    const char *line;
+    size_t length;
+    while(reader.readLine(line, length) && length){
+        if(startsWith(line, length, "ATOM")){
+            char chainId = length > 21 ? line[21] : ' ';
             if(!currentChain || currentChain->id() != chainId){
                 if (currentChain)
                 {
@@ -457,69 +607,47 @@ bool PdbFile::read(std::istream &input)
                 addChain(currentChain);
             }
 
-            int residueIndex = strtol(&line[22], 0, 10);
+            int residueIndex = readInteger(line, length, 22, 4);
             if(!currentResidue || currentResidue->index() != residueIndex){
-                std::string name;
-                for(int i = 17; i < 21; i++){
-                    name += line[i];
-                }
-
-                boost::trim(name);
-
-                currentResidue = new PdbResidue(name, residueIndex);
+                currentResidue = new PdbResidue(readString(line, length, 17, 4), residueIndex);
                 currentChain->addResidue(currentResidue);
             }
 
-            currentResidue->addAtom(atom);
+            currentResidue->addAtom(PdbAtom(line, length));
+            atomCount++;
         }
-        else if(strncmp("HETATM", line, 6) == 0){
-            PdbAtom *atom = new PdbAtom(line);
-
-            int ligandIndex = strtol(&line[22], 0, 10);
+        else if(startsWith(line, length, "HETATM")){
+            int ligandIndex = readInteger(line, length, 22, 4);
             if(!currentLigand || currentLigand->index() != ligandIndex){
-                std::string ligandName;
-                for(int i = 17; i < 21; i++){
-                    ligandName += line[i];
-                }
-
-                boost::trim(ligandName);
-
-                currentLigand = new PdbLigand(ligandName, ligandIndex);
+                currentLigand = new PdbLigand(readString(line, length, 17, 4), ligandIndex);
                 addLigand(currentLigand);
             }
 
-            currentLigand->addAtom(atom);
+            currentLigand->addAtom(PdbAtom(line, length));
         }
-        else if(strncmp("HELIX", line, 5) == 0 ||
-                strncmp("SHEET", line, 5) == 0){
-            m_conformations.push_back(new PdbConformation(line));
+        else if(startsWith(line, length, "HELIX") ||
+                startsWith(line, length, "SHEET")){
+            m_conformations.push_back(new PdbConformation(line, length));
         }
-        else if(strncmp("MODEL", line, 5) == 0 && !m_chains.empty()){
-            PdbConformer *conformer = new PdbConformer(input);
+        else if(startsWith(line, length, "MODEL") && !m_chains.empty()){
+            PdbConformer *conformer = new PdbConformer(reader, atomCount);
             m_conformers.push_back(conformer);
         }
-        else if(strncmp("CONECT", line, 6) == 0){
-            std::string string = &line[7];
-            boost::trim(string);
-
-            std::vector<std::string> tokens;
-            boost::split(tokens, string, boost::is_any_of(" "), boost::token_compress_on);
-
+        else if(startsWith(line, length, "CONECT")){
+            // atom serial numbers in columns 7-11, 12-16, 17-21, ...
             std::vector<int> ids;
 
-            foreach(const std::string &idString, tokens){
-                try {
-                    ids.push_back(boost::lexical_cast<int>(idString));
-                }
-                catch(boost::bad_lexical_cast&){
+            for(size_t column = 6; column < length; column += 5){
+                int id = readInteger(line, length, column, 5);
+                if(id){
+                    ids.push_back(id);
                 }
             }
 
             addConnections(ids);
         }
-        else if(strncmp("HETNAM", line, 6) == 0){
-            std::string string = &line[7];
-            boost::trim(string);
+        else if(startsWith(line, length, "HETNAM")){
+            std::string string = readString(line, length, 7, length);
 
             std::vector<std::string> tokens;
             boost::split(tokens, string, boost::is_any_of(" "), boost::token_compress_on);
@@ -533,8 +661,8 @@ bool PdbFile::read(std::istream &input)
                 m_ligandNames[residueName] = name;
             }
         }
-        else if(strncmp("TITLE", line, 5) == 0){
-            std::string title = &line[10];
+        else if(startsWith(line, length, "TITLE")){
+            std::string title(line + std::min(size_t(10), length), line + length);
             boost::trim_right(title);
             m_title += title;
         }
@@ -569,6 +697,12 @@ void PdbFile::writePolymerFile(chemkit::PolymerFile *file)
         polymer->setName(m_title);
     }
 
+    size_t atomCount = 0;
+    foreach(const PdbChain *pdbChain, m_chains){
+        atomCount += pdbChain->atomCount();
+    }
+    polymer->setAtomCapacity(atomCount);
+
     std::map<int, chemkit::Atom *> atomIds;
     PdbChain::Type chainType = PdbChain::Protein;
 
@@ -618,29 +752,29 @@ void PdbFile::writePolymerFile(chemkit::PolymerFile *file)
                 }
             }
 
-            foreach(PdbAtom *pdbAtom, pdbResidue->atoms()){
-                chemkit::Atom *atom = polymer->addAtom(pdbAtom->element);
+            foreach(const PdbAtom &pdbAtom, pdbResidue->atoms()){
+                chemkit::Atom *atom = polymer->addAtom(pdbAtom.element);
                 if(!atom){
                     continue;
                 }
 
-                atomIds[pdbAtom->id] = atom;
+                atomIds[pdbAtom.id] = atom;
 
-                atom->setType(pdbAtom->name);
-                atom->setPosition(pdbAtom->position);
+                atom->setType(pdbAtom.name);
+                atom->setPosition(pdbAtom.position);
                 residue->addAtom(atom);
 
                 if(chainType == PdbChain::Protein){
-                    if(pdbAtom->name == "CA"){
+                    if(pdbAtom.name == "CA"){
                         aminoAcid->setAlphaCarbon(atom);
                     }
-                    else if(pdbAtom->name == "N"){
+                    else if(pdbAtom.name == "N"){
                         aminoAcid->setAminoNitrogen(atom);
                     }
-                    else if(pdbAtom->name == "C"){
+                    else if(pdbAtom.name == "C"){
                         aminoAcid->setCarbonylCarbon(atom);
                     }
-                    else if(pdbAtom->name == "O"){
+                    else if(pdbAtom.name == "O"){
                         aminoAcid->setCarbonylOxygen(atom);
                     }
                 }
@@ -704,15 +838,17 @@ void PdbFile::writePolymerFile(chemkit::PolymerFile *file)
             ligand->setName(pdbLigand->name());
         }
 
-        foreach(const PdbAtom *pdbAtom, pdbLigand->atoms()){
-            chemkit::Atom *atom = ligand->addAtom(pdbAtom->element);
+        ligand->setAtomCapacity(pdbLigand->atoms().size());
+
+        foreach(const PdbAtom &pdbAtom, pdbLigand->atoms()){
+            chemkit::Atom *atom = ligand->addAtom(pdbAtom.element);
             if(!atom){
                 continue;
             }
 
-            atom->setPosition(pdbAtom->position);
+            atom->setPosition(pdbAtom.position);
 
-            atomIds[pdbAtom->id] = atom;
+            atomIds[pdbAtom.id] = atom;
         }
 
         file->addLigand(ligand);
@@ -752,9 +888,24 @@ PdbFileFormat::PdbFileFormat()
 }
 
 bool PdbFileFormat::read(std::istream &input, chemkit::PolymerFile *file)
+{
+    std::string data((std::istreambuf_iterator<char>(input)),
+                     std::istreambuf_iterator<char>());
+
+    PdbFile pdb;
+    bool ok = pdb.read(data.c_str(), data.size());
+    if(!ok){
+        return false;
+    }
+
+    pdb.writePolymerFile(file);
+    return true;
+}
+
+bool PdbFileFormat::readMappedFile(const boost::iostreams::mapped_file_source &input, chemkit::PolymerFile *file)
 {
     PdbFile pdb;
-    bool ok = pdb.read(input);
+    bool ok = pdb.read(input.data(), input.size());
     if(!ok){
         return false;
     }
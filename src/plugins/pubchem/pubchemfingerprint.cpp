@@ -35,6 +35,8 @@
 
 #include "pubchemfingerprint.h"
 
+#include <algorithm>
+
 #include <chemkit/atom.h>
 #include <chemkit/bond.h>
 #include <chemkit/foreach.h>
@@ -43,6 +45,19 @@
 // PubChem Fingerprint Specification:
 // ftp://ftp.ncbi.nlm.nih.gov/pubchem/specifications/pubchem_fingerprints.txt
 
+namespace {
+
+const size_t PubChemSize = 881;
+
+inline void setBit(boost::uint64_t *words, size_t bit, bool value = true)
+{
+    if(value){
+        words[bit / 64] |= boost::uint64_t(1) << (bit % 64);
+    }
+}
+
+} // end anonymous namespace
+
 PubChemFingerprint::PubChemFingerprint()
     : chemkit::Fingerprint("pubchem")
 {
@@ -52,156 +67,175 @@ PubChemFingerprint::~PubChemFingerprint()
 {
 }
 
+size_t PubChemFingerprint::size() const
+{
+    return PubChemSize;
+}
+
 chemkit::Bitset PubChemFingerprint::value(const chemkit::Molecule *molecule) const
 {
-    chemkit::Bitset bitset(881);
+    std::vector<boost::uint64_t> words(wordCount());
+    packedValue(molecule, &words[0]);
+
+    return unpack(&words[0], PubChemSize);
+}
+
+void PubChemFingerprint::packedValue(const chemkit::Molecule *molecule, boost::uint64_t *words) const
+{
+    std::fill(words, words + wordCount(), boost::uint64_t(0));
+
+    // count each element in a single pass over the atoms
+    size_t elementCounts[256] = { 0 };
+    foreach(const chemkit::Atom *atom, molecule->atoms()){
+        elementCounts[atom->atomicNumber()]++;
+    }
 
     // section 1 - hierarchic element counts
-    size_t hydrogenCount = molecule->atomCount(chemkit::Atom::Hydrogen);
-    bitset[0] = hydrogenCount >= 4;
-    bitset[1] = hydrogenCount >= 8;
-    bitset[2] = hydrogenCount >= 16;
-    bitset[3] = hydrogenCount >= 32;
-
-    size_t lithiumCount = molecule->atomCount(chemkit::Atom::Lithium);
-    bitset[4] = lithiumCount >= 1;
-    bitset[5] = lithiumCount >= 2;
-
-    size_t boronCount = molecule->atomCount(chemkit::Atom::Boron);
-    bitset[6] = boronCount >= 1;
-    bitset[7] = boronCount >= 2;
-    bitset[8] = boronCount >= 4;
-
-    size_t carbonCount = molecule->atomCount(chemkit::Atom::Carbon);
-    bitset[9] = carbonCount >= 2;
-    bitset[10] = carbonCount >= 4;
-    bitset[11] = carbonCount >= 8;
-    bitset[12] = carbonCount >= 16;
-    bitset[13] = carbonCount >= 32;
-
-    size_t nitrogenCount = molecule->atomCount(chemkit::Atom::Nitrogen);
-    bitset[14] = nitrogenCount >= 1;
-    bitset[15] = nitrogenCount >= 2;
-    bitset[16] = nitrogenCount >= 4;
-    bitset[17] = nitrogenCount >= 8;
-
-    size_t oxygenCount = molecule->atomCount(chemkit::Atom::Oxygen);
-    bitset[18] = oxygenCount >= 1;
-    bitset[19] = oxygenCount >= 2;
-    bitset[20] = oxygenCount >= 4;
-    bitset[21] = oxygenCount >= 8;
-    bitset[22] = oxygenCount >= 16;
-
-    size_t fluorineCount = molecule->atomCount(chemkit::Atom::Fluorine);
-    bitset[23] = fluorineCount >= 1;
-    bitset[24] = fluorineCount >= 2;
-    bitset[25] = fluorineCount >= 4;
-
-    size_t sodiumCount = molecule->atomCount(chemkit::Atom::Sodium);
-    bitset[26] = sodiumCount >= 1;
-    bitset[27] = sodiumCount >= 2;
-
-    size_t siliconCount = molecule->atomCount(chemkit::Atom::Silicon);
-    bitset[28] = siliconCount >= 1;
-    bitset[29] = siliconCount >= 2;
-
-    size_t phosphorusCount = molecule->atomCount(chemkit::Atom::Phosphorus);
-    bitset[30] = phosphorusCount >= 1;
-    bitset[31] = phosphorusCount >= 2;
-    bitset[32] = phosphorusCount >= 4;
-
-    size_t sulfurCount = molecule->atomCount(chemkit::Atom::Sulfur);
-    bitset[33] = sulfurCount >= 1;
-    bitset[34] = sulfurCount >= 2;
-    bitset[35] = sulfurCount >= 4;
-    bitset[36] = sulfurCount >= 8;
-
-    size_t chlorineCount = molecule->atomCount(chemkit::Atom::Chlorine);
-    bitset[37] = chlorineCount >= 1;
-    bitset[38] = chlorineCount >= 2;
-    bitset[39] = chlorineCount >= 4;
-    bitset[40] = chlorineCount >= 8;
-
-    size_t potassiumCount = molecule->atomCount(chemkit::Atom::Potassium);
-    bitset[41] = potassiumCount >= 1;
-    bitset[42] = potassiumCount >= 2;
-
-    size_t bromineCount = molecule->atomCount(chemkit::Atom::Bromine);
-    bitset[43] = bromineCount >= 1;
-    bitset[44] = bromineCount >= 2;
-    bitset[45] = bromineCount >= 4;
-
-    size_t iodineCount = molecule->atomCount(chemkit::Atom::Iodine);
-    bitset[46] = iodineCount >= 1;
-    bitset[47] = iodineCount >= 2;
-    bitset[48] = iodineCount >= 4;
-
-    bitset[49] = molecule->contains(chemkit::Atom::Beryllium);
-    bitset[50] = molecule->contains(chemkit::Atom::Magnesium);
-    bitset[51] = molecule->contains(chemkit::Atom::Aluminum);
-    bitset[52] = molecule->contains(chemkit::Atom::Calcium);
-    bitset[53] = molecule->contains(chemkit::Atom::Scandium);
-    bitset[54] = molecule->contains(chemkit::Atom::Titanium);
-    bitset[55] = molecule->contains(chemkit::Atom::Vanadium);
-    bitset[56] = molecule->contains(chemkit::Atom::Chromium);
-    bitset[57] = molecule->contains(chemkit::Atom::Manganese);
-    bitset[58] = molecule->contains(chemkit::Atom::Iron);
-    bitset[59] = molecule->contains(chemkit::Atom::Cobalt);
-    bitset[60] = molecule->contains(chemkit::Atom::Nickel);
-    bitset[61] = molecule->contains(chemkit::Atom::Copper);
-    bitset[62] = molecule->contains(chemkit::Atom::Zinc);
-    bitset[63] = molecule->contains(chemkit::Atom::Gallium);
-    bitset[64] = molecule->contains(chemkit::Atom::Germanium);
-    bitset[65] = molecule->contains(chemkit::Atom::Arsenic);
-    bitset[66] = molecule->contains(chemkit::Atom::Selenium);
-    bitset[67] = molecule->contains(chemkit::Atom::Krypton);
-    bitset[68] = molecule->contains(chemkit::Atom::Rubidium);
-    bitset[69] = molecule->contains(chemkit::Atom::Strontium);
-    bitset[70] = molecule->contains(chemkit::Atom::Yttrium);
-    bitset[71] = molecule->contains(chemkit::Atom::Zirconium);
-    bitset[72] = molecule->contains(chemkit::Atom::Niobium);
-    bitset[73] = molecule->contains(chemkit::Atom::Molybdenum);
-    bitset[74] = molecule->contains(chemkit::Atom::Ruthenium);
-    bitset[75] = molecule->contains(chemkit::Atom::Rhodium);
-    bitset[76] = molecule->contains(chemkit::Atom::Palladium);
-    bitset[77] = molecule->contains(chemkit::Atom::Silver);
-    bitset[78] = molecule->contains(chemkit::Atom::Cadmium);
-    bitset[79] = molecule->contains(chemkit::Atom::Indium);
-    bitset[80] = molecule->contains(chemkit::Atom::Tin);
-    bitset[81] = molecule->contains(chemkit::Atom::Antimony);
-    bitset[82] = molecule->contains(chemkit::Atom::Tellurium);
-    bitset[83] = molecule->contains(chemkit::Atom::Xenon);
-    bitset[84] = molecule->contains(chemkit::Atom::Cesium);
-    bitset[85] = molecule->contains(chemkit::Atom::Barium);
-    bitset[86] = molecule->contains(chemkit::Atom::Lutetium);
-    bitset[87] = molecule->contains(chemkit::Atom::Hafnium);
-    bitset[88] = molecule->contains(chemkit::Atom::Tantalum);
-    bitset[89] = molecule->contains(chemkit::Atom::Tungsten);
-    bitset[90] = molecule->contains(chemkit::Atom::Rhenium);
-    bitset[91] = molecule->contains(chemkit::Atom::Osmium);
-    bitset[92] = molecule->contains(chemkit::Atom::Iridium);
-    bitset[93] = molecule->contains(chemkit::Atom::Platinum);
-    bitset[94] = molecule->contains(chemkit::Atom::Gold);
-    bitset[95] = molecule->contains(chemkit::Atom::Mercury);
-    bitset[96] = molecule->contains(chemkit::Atom::Thallium);
-    bitset[97] = molecule->contains(chemkit::Atom::Lead);
-    bitset[98] = molecule->contains(chemkit::Atom::Bismuth);
-    bitset[99] = molecule->contains(chemkit::Atom::Lanthanum);
-    bitset[100] = molecule->contains(chemkit::Atom::Cerium);
-    bitset[101] = molecule->contains(chemkit::Atom::Praseodymium);
-    bitset[102] = molecule->contains(chemkit::Atom::Neodymium);
-    bitset[103] = molecule->contains(chemkit::Atom::Promethium);
-    bitset[104] = molecule->contains(chemkit::Atom::Samarium);
-    bitset[105] = molecule->contains(chemkit::Atom::Europium);
-    bitset[106] = molecule->contains(chemkit::Atom::Gadolinium);
-    bitset[107] = molecule->contains(chemkit::Atom::Terbium);
-    bitset[108] = molecule->contains(chemkit::Atom::Dysprosium);
-    bitset[109] = molecule->contains(chemkit::Atom::Holmium);
-    bitset[110] = molecule->contains(chemkit::Atom::Erbium);
-    bitset[111] = molecule->contains(chemkit::Atom::Thulium);
-    bitset[112] = molecule->contains(chemkit::Atom::Ytterbium);
-    bitset[113] = molecule->contains(chemkit::Atom::Technetium);
-    bitset[114] = molecule->contains(chemkit::Atom::Uranium);
+    size_t hydrogenCount = elementCounts[chemkit::Atom::Hydrogen];
+    setBit(words, 0, hydrogenCount >= 4);
+    setBit(words, 1, hydrogenCount >= 8);
+    setBit(words, 2, hydrogenCount >= 16);
+    setBit(words, 3, hydrogenCount >= 32);
+
+    size_t lithiumCount = elementCounts[chemkit::Atom::Lithium];
+    setBit(words, 4, lithiumCount >= 1);
+    setBit(words, 5, lithiumCount >= 2);
+
+    size_t boronCount = elementCounts[chemkit::Atom::Boron];
+    setBit(words, 6, boronCount >= 1);
+    setBit(words, 7, boronCount >= 2);
+    setBit(words, 8, boronCount >= 4);
+
+    size_t carbonCount = elementCounts[chemkit::Atom::Carbon];
+    setBit(words, 9, carbonCount >= 2);
+    setBit(words, 10, carbonCount >= 4);
+    setBit(words, 11, carbonCount >= 8);
+    setBit(words, 12, carbonCount >= 16);
+    setBit(words, 13, carbonCount >= 32);
+
+    size_t nitrogenCount = elementCounts[chemkit::Atom::Nitrogen];
+    setBit(words, 14, nitrogenCount >= 1);
+    setBit(words, 15, nitrogenCount >= 2);
+    setBit(words, 16, nitrogenCount >= 4);
+    setBit(words, 17, nitrogenCount >= 8);
+
+    size_t oxygenCount = elementCounts[chemkit::Atom::Oxygen];
+    setBit(words, 18, oxygenCount >= 1);
+    setBit(words, 19, oxygenCount >= 2);
+    setBit(words, 20, oxygenCount >= 4);
+    setBit(words, 21, oxygenCount >= 8);
+    setBit(words, 22, oxygenCount >= 16);
+
+    size_t fluorineCount = elementCounts[chemkit::Atom::Fluorine];
+    setBit(words, 23, fluorineCount >= 1);
+    setBit(words, 24, fluorineCount >= 2);
+    setBit(words, 25, fluorineCount >= 4);
+
+    size_t sodiumCount = elementCounts[chemkit::Atom::Sodium];
+    setBit(words, 26, sodiumCount >= 1);
+    setBit(words, 27, sodiumCount >= 2);
+
+    size_t siliconCount = elementCounts[chemkit::Atom::Silicon];
+    setBit(words, 28, siliconCount >= 1);
+    setBit(words, 29, siliconCount >= 2);
+
+    size_t phosphorusCount = elementCounts[chemkit::Atom::Phosphorus];
+    setBit(words, 30, phosphorusCount >= 1);
+    setBit(words, 31, phosphorusCount >= 2);
+    setBit(words, 32, phosphorusCount >= 4);
+
+    size_t sulfurCount = elementCounts[chemkit::Atom::Sulfur];
+    setBit(words, 33, sulfurCount >= 1);
+    setBit(words, 34, sulfurCount >= 2);
+    setBit(words, 35, sulfurCount >= 4);
+    setBit(words, 36, sulfurCount >= 8);
+
+    size_t chlorineCount = elementCounts[chemkit::Atom::Chlorine];
+    setBit(words, 37, chlorineCount >= 1);
+    setBit(words, 38, chlorineCount >= 2);
+    setBit(words, 39, chlorineCount >= 4);
+    setBit(words, 40, chlorineCount >= 8);
+
+    size_t potassiumCount = elementCounts[chemkit::Atom::Potassium];
+    setBit(words, 41, potassiumCount >= 1);
+    setBit(words, 42, potassiumCount >= 2);
+
+    size_t bromineCount = elementCounts[chemkit::Atom::Bromine];
+    setBit(words, 43, bromineCount >= 1);
+    setBit(words, 44, bromineCount >= 2);
+    setBit(words, 45, bromineCount >= 4);
+
+    size_t iodineCount = elementCounts[chemkit::Atom::Iodine];
+    setBit(words, 46, iodineCount >= 1);
+    setBit(words, 47, iodineCount >= 2);
+    setBit(words, 48, iodineCount >= 4);
+
+    setBit(words, 49, elementCounts[chemkit::Atom::Beryllium] > 0);
+    setBit(words, 50, elementCounts[chemkit::Atom::Magnesium] > 0);
+    setBit(words, 51, elementCounts[chemkit::Atom::Aluminum] > 0);
+    setBit(words, 52, elementCounts[chemkit::Atom::Calcium] > 0);
+    setBit(words, 53, elementCounts[chemkit::Atom::Scandium] > 0);
+    setBit(words, 54, elementCounts[chemkit::Atom::Titanium] > 0);
+    setBit(words, 55, elementCounts[chemkit::Atom::Vanadium] > 0);
+    setBit(words, 56, elementCounts[chemkit::Atom::Chromium] > 0);
+    setBit(words, 57, elementCounts[chemkit::Atom::Manganese] > 0);
+    setBit(words, 58, elementCounts[chemkit::Atom::Iron] > 0);
+    setBit(words, 59, elementCounts[chemkit::Atom::Cobalt] > 0);
+    setBit(words, 60, elementCounts[chemkit::Atom::Nickel] > 0);
+    setBit(words, 61, elementCounts[chemkit::Atom::Copper] > 0);
+    setBit(words, 62, elementCounts[chemkit::Atom::Zinc] > 0);
+    setBit(words, 63, elementCounts[chemkit::Atom::Gallium] > 0);
+    setBit(words, 64, elementCounts[chemkit::Atom::Germanium] > 0);
+    setBit(words, 65, elementCounts[chemkit::Atom::Arsenic] > 0);
+    setBit(words, 66, elementCounts[chemkit::Atom::Selenium] > 0);
+    setBit(words, 67, elementCounts[chemkit::Atom::Krypton] > 0);
+    setBit(words, 68, elementCounts[chemkit::Atom::Rubidium] > 0);
+    setBit(words, 69, elementCounts[chemkit::Atom::Strontium] > 0);
+    setBit(words, 70, elementCounts[chemkit::Atom::Yttrium] > 0);
+    setBit(words, 71, elementCounts[chemkit::Atom::Zirconium] > 0);
+    setBit(words, 72, elementCounts[chemkit::Atom::Niobium] > 0);
+    setBit(words, 73, elementCounts[chemkit::Atom::Molybdenum] > 0);
+    setBit(words, 74, elementCounts[chemkit::Atom::Ruthenium] > 0);
+    setBit(words, 75, elementCounts[chemkit::Atom::Rhodium] > 0);
+    setBit(words, 76, elementCounts[chemkit::Atom::Palladium] > 0);
+    setBit(words, 77, elementCounts[chemkit::Atom::Silver] > 0);
+    setBit(words, 78, elementCounts[chemkit::Atom::Cadmium] > 0);
+    setBit(words, 79, elementCounts[chemkit::Atom::Indium] > 0);
+    setBit(words, 80, elementCounts[chemkit::Atom::Tin] > 0);
+    setBit(words, 81, elementCounts[chemkit::Atom::Antimony] > 0);
+    setBit(words, 82, elementCounts[chemkit::Atom::Tellurium] > 0);
+    setBit(words, 83, elementCounts[chemkit::Atom::Xenon] > 0);
+    setBit(words, 84, elementCounts[chemkit::Atom::Cesium] > 0);
+    setBit(words, 85, elementCounts[chemkit::Atom::Barium] > 0);
+    setBit(words, 86, elementCounts[chemkit::Atom::Lutetium] > 0);
+    setBit(words, 87, elementCounts[chemkit::Atom::Hafnium] > 0);
+    setBit(words, 88, elementCounts[chemkit::Atom::Tantalum] > 0);
+    setBit(words, 89, elementCounts[chemkit::Atom::Tungsten] > 0);
+    setBit(words, 90, elementCounts[chemkit::Atom::Rhenium] > 0);
+    setBit(words, 91, elementCounts[chemkit::Atom::Osmium] > 0);
+    setBit(words, 92, elementCounts[chemkit::Atom::Iridium] > 0);
+    setBit(words, 93, elementCounts[chemkit::Atom::Platinum] > 0);
+    setBit(words, 94, elementCounts[chemkit::Atom::Gold] > 0);
+    setBit(words, 95, elementCounts[chemkit::Atom::Mercury] > 0);
+    setBit(words, 96, elementCounts[chemkit::Atom::Thallium] > 0);
+    setBit(words, 97, elementCounts[chemkit::Atom::Lead] > 0);
+    setBit(words, 98, elementCounts[chemkit::Atom::Bismuth] > 0);
+    setBit(words, 99, elementCounts[chemkit::Atom::Lanthanum] > 0);
+    setBit(words, 100, elementCounts[chemkit::Atom::Cerium] > 0);
+    setBit(words, 101, elementCounts[chemkit::Atom::Praseodymium] > 0);
+    setBit(words, 102, elementCounts[chemkit::Atom::Neodymium] > 0);
+    setBit(words, 103, elementCounts[chemkit::Atom::Promethium] > 0);
+    setBit(words, 104, elementCounts[chemkit::Atom::Samarium] > 0);
+    setBit(words, 105, elementCounts[chemkit::Atom::Europium] > 0);
+    setBit(words, 106, elementCounts[chemkit::Atom::Gadolinium] > 0);
+    setBit(words, 107, elementCounts[chemkit::Atom::Terbium] > 0);
+    setBit(words, 108, elementCounts[chemkit::Atom::Dysprosium] > 0);
+    setBit(words, 109, elementCounts[chemkit::Atom::Holmium] > 0);
+    setBit(words, 110, elementCounts[chemkit::Atom::Erbium] > 0);
+    setBit(words, 111, elementCounts[chemkit::Atom::Thulium] > 0);
+    setBit(words, 112, elementCounts[chemkit::Atom::Ytterbium] > 0);
+    setBit(words, 113, elementCounts[chemkit::Atom::Technetium] > 0);
+    setBit(words, 114, elementCounts[chemkit::Atom::Uranium] > 0);
 
     // section 2 - ring counts
     // TODO
@@ -209,196 +243,196 @@ chemkit::Bitset PubChemFingerprint::value(const chemkit::Molecule *molecule) con
     // section 3 - simple atom pairs
     foreach(const chemkit::Bond *bond, molecule->bonds()){
         if(bond->containsBoth(chemkit::Atom::Lithium, chemkit::Atom::Hydrogen)){
-            bitset[263] = 1;
+            setBit(words, 263);
         }
         else if(bond->containsBoth(chemkit::Atom::Lithium, chemkit::Atom::Lithium)){
-            bitset[264] = 1;
+            setBit(words, 264);
         }
         else if(bond->containsBoth(chemkit::Atom::Lithium, chemkit::Atom::Boron)){
-            bitset[265] = 1;
+            setBit(words, 265);
         }
         else if(bond->containsBoth(chemkit::Atom::Lithium, chemkit::Atom::Carbon)){
-            bitset[266] = 1;
+            setBit(words, 266);
         }
         else if(bond->containsBoth(chemkit::Atom::Lithium, chemkit::Atom::Oxygen)){
-            bitset[267] = 1;
+            setBit(words, 267);
         }
         else if(bond->containsBoth(chemkit::Atom::Lithium, chemkit::Atom::Fluorine)){
-            bitset[268] = 1;
+            setBit(words, 268);
         }
         else if(bond->containsBoth(chemkit::Atom::Lithium, chemkit::Atom::Phosphorus)){
-            bitset[269] = 1;
+            setBit(words, 269);
         }
         else if(bond->containsBoth(chemkit::Atom::Lithium, chemkit::Atom::Sulfur)){
-            bitset[270] = 1;
+            setBit(words, 270);
         }
         else if(bond->containsBoth(chemkit::Atom::Lithium, chemkit::Atom::Chlorine)){
-            bitset[271] = 1;
+            setBit(words, 271);
         }
         else if(bond->containsBoth(chemkit::Atom::Boron, chemkit::Atom::Hydrogen)){
-            bitset[272] = 1;
+            setBit(words, 272);
         }
         else if(bond->containsBoth(chemkit::Atom::Boron, chemkit::Atom::Boron)){
-            bitset[273] = 1;
+            setBit(words, 273);
         }
         else if(bond->containsBoth(chemkit::Atom::Boron, chemkit::Atom::Carbon)){
-            bitset[274] = 1;
+            setBit(words, 274);
         }
         else if(bond->containsBoth(chemkit::Atom::Boron, chemkit::Atom::Nitrogen)){
-            bitset[275] = 1;
+            setBit(words, 275);
         }
         else if(bond->containsBoth(chemkit::Atom::Boron, chemkit::Atom::Oxygen)){
-            bitset[276] = 1;
+            setBit(words, 276);
         }
         else if(bond->containsBoth(chemkit::Atom::Boron, chemkit::Atom::Fluorine)){
-            bitset[277] = 1;
+            setBit(words, 277);
         }
         else if(bond->containsBoth(chemkit::Atom::Boron, chemkit::Atom::Silicon)){
-            bitset[278] = 1;
+            setBit(words, 278);
         }
         else if(bond->containsBoth(chemkit::Atom::Boron, chemkit::Atom::Phosphorus)){
-            bitset[279] = 1;
+            setBit(words, 279);
         }
         else if(bond->containsBoth(chemkit::Atom::Boron, chemkit::Atom::Sulfur)){
-            bitset[280] = 1;
+            setBit(words, 280);
         }
         else if(bond->containsBoth(chemkit::Atom::Boron, chemkit::Atom::Chlorine)){
-            bitset[281] = 1;
+            setBit(words, 281);
         }
         else if(bond->containsBoth(chemkit::Atom::Boron, chemkit::Atom::Bromine)){
-            bitset[282] = 1;
+            setBit(words, 282);
         }
         else if(bond->containsBoth(chemkit::Atom::Carbon, chemkit::Atom::Hydrogen)){
-            bitset[283] = 1;
+            setBit(words, 283);
         }
         else if(bond->containsBoth(chemkit::Atom::Carbon, chemkit::Atom::Carbon)){
-            bitset[284] = 1;
+            setBit(words, 284);
         }
         else if(bond->containsBoth(chemkit::Atom::Carbon, chemkit::Atom::Nitrogen)){
-            bitset[285] = 1;
+            setBit(words, 285);
         }
         else if(bond->containsBoth(chemkit::Atom::Carbon, chemkit::Atom::Oxygen)){
-            bitset[286] = 1;
+            setBit(words, 286);
         }
         else if(bond->containsBoth(chemkit::Atom::Carbon, chemkit::Atom::Fluorine)){
-            bitset[287] = 1;
+            setBit(words, 287);
         }
         else if(bond->containsBoth(chemkit::Atom::Carbon, chemkit::Atom::Sodium)){
-            bitset[288] = 1;
+            setBit(words, 288);
         }
         else if(bond->containsBoth(chemkit::Atom::Carbon, chemkit::Atom::Magnesium)){
-            bitset[289] = 1;
+            setBit(words, 289);
         }
         else if(bond->containsBoth(chemkit::Atom::Carbon, chemkit::Atom::Aluminum)){
-            bitset[290] = 1;
+            setBit(words, 290);
         }
         else if(bond->containsBoth(chemkit::Atom::Carbon, chemkit::Atom::Silicon)){
-            bitset[291] = 1;
+            setBit(words, 291);
         }
         else if(bond->containsBoth(chemkit::Atom::Carbon, chemkit::Atom::Phosphorus)){
-            bitset[292] = 1;
+            setBit(words, 292);
         }
         else if(bond->containsBoth(chemkit::Atom::Carbon, chemkit::Atom::Sulfur)){
-            bitset[293] = 1;
+            setBit(words, 293);
         }
         else if(bond->containsBoth(chemkit::Atom::Carbon, chemkit::Atom::Chlorine)){
-            bitset[294] = 1;
+            setBit(words, 294);
         }
         else if(bond->containsBoth(chemkit::Atom::Carbon, chemkit::Atom::Arsenic)){
-            bitset[295] = 1;
+            setBit(words, 295);
         }
         else if(bond->containsBoth(chemkit::Atom::Carbon, chemkit::Atom::Selenium)){
-            bitset[296] = 1;
+            setBit(words, 296);
         }
         else if(bond->containsBoth(chemkit::Atom::Carbon, chemkit::Atom::Bromine)){
-            bitset[297] = 1;
+            setBit(words, 297);
         }
         else if(bond->containsBoth(chemkit::Atom::Carbon, chemkit::Atom::Iodine)){
-            bitset[298] = 1;
+            setBit(words, 298);
         }
         else if(bond->containsBoth(chemkit::Atom::Nitrogen, chemkit::Atom::Hydrogen)){
-            bitset[299] = 1;
+            setBit(words, 299);
         }
         else if(bond->containsBoth(chemkit::Atom::Nitrogen, chemkit::Atom::Nitrogen)){
-            bitset[300] = 1;
+            setBit(words, 300);
         }
         else if(bond->containsBoth(chemkit::Atom::Nitrogen, chemkit::Atom::Oxygen)){
-            bitset[301] = 1;
+            setBit(words, 301);
         }
         else if(bond->containsBoth(chemkit::Atom::Nitrogen, chemkit::Atom::Fluorine)){
-            bitset[302] = 1;
+            setBit(words, 302);
         }
         else if(bond->containsBoth(chemkit::Atom::Nitrogen, chemkit::Atom::Silicon)){
-            bitset[303] = 1;
+            setBit(words, 303);
         }
         else if(bond->containsBoth(chemkit::Atom::Nitrogen, chemkit::Atom::Phosphorus)){
-            bitset[304] = 1;
+            setBit(words, 304);
         }
         else if(bond->containsBoth(chemkit::Atom::Nitrogen, chemkit::Atom::Sulfur)){
-            bitset[305] = 1;
+            setBit(words, 305);
         }
         else if(bond->containsBoth(chemkit::Atom::Nitrogen, chemkit::Atom::Chlorine)){
-            bitset[306] = 1;
+            setBit(words, 306);
         }
         else if(bond->containsBoth(chemkit::Atom::Nitrogen, chemkit::Atom::Bromine)){
-            bitset[307] = 1;
+            setBit(words, 307);
         }
         else if(bond->containsBoth(chemkit::Atom::Oxygen, chemkit::Atom::Hydrogen)){
-            bitset[308] = 1;
+            setBit(words, 308);
         }
         else if(bond->containsBoth(chemkit::Atom::Oxygen, chemkit::Atom::Oxygen)){
-            bitset[309] = 1;
+            setBit(words, 309);
         }
         else if(bond->containsBoth(chemkit::Atom::Oxygen, chemkit::Atom::Magnesium)){
-            bitset[310] = 1;
+            setBit(words, 310);
         }
         else if(bond->containsBoth(chemkit::Atom::Oxygen, chemkit::Atom::Sodium)){
-            bitset[311] = 1;
+            setBit(words, 311);
         }
         else if(bond->containsBoth(chemkit::Atom::Oxygen, chemkit::Atom::Aluminum)){
-            bitset[312] = 1;
+            setBit(words, 312);
         }
         else if(bond->containsBoth(chemkit::Atom::Oxygen, chemkit::Atom::Silicon)){
-            bitset[313] = 1;
+            setBit(words, 313);
         }
         else if(bond->containsBoth(chemkit::Atom::Oxygen, chemkit::Atom::Phosphorus)){
-            bitset[314] = 1;
+            setBit(words, 314);
         }
         else if(bond->containsBoth(chemkit::Atom::Oxygen, chemkit::Atom::Potassium)){
-            bitset[315] = 1;
+            setBit(words, 315);
         }
         else if(bond->containsBoth(chemkit::Atom::Fluorine, chemkit::Atom::Phosphorus)){
-            bitset[316] = 1;
+            setBit(words, 316);
         }
         else if(bond->containsBoth(chemkit::Atom::Fluorine, chemkit::Atom::Sulfur)){
-            bitset[317] = 1;
+            setBit(words, 317);
         }
         else if(bond->containsBoth(chemkit::Atom::Aluminum, chemkit::Atom::Hydrogen)){
-            bitset[318] = 1;
+            setBit(words, 318);
         }
         else if(bond->containsBoth(chemkit::Atom::Aluminum, chemkit::Atom::Chlorine)){
-            bitset[319] = 1;
+            setBit(words, 319);
         }
         else if(bond->containsBoth(chemkit::Atom::Silicon, chemkit::Atom::Hydrogen)){
-            bitset[320] = 1;
+            setBit(words, 320);
         }
         else if(bond->containsBoth(chemkit::Atom::Silicon, chemkit::Atom::Silicon)){
-            bitset[321] = 1;
+            setBit(words, 321);
         }
         else if(bond->containsBoth(chemkit::Atom::Silicon, chemkit::Atom::Chlorine)){
-            bitset[322] = 1;
+            setBit(words, 322);
         }
         else if(bond->containsBoth(chemkit::Atom::Phosphorus, chemkit::Atom::Hydrogen)){
-            bitset[323] = 1;
+            setBit(words, 323);
         }
         else if(bond->containsBoth(chemkit::Atom::Phosphorus, chemkit::Atom::Phosphorus)){
-            bitset[324] = 1;
+            setBit(words, 324);
         }
         else if(bond->containsBoth(chemkit::Atom::Arsenic, chemkit::Atom::Hydrogen)){
-            bitset[325] = 1;
+            setBit(words, 325);
         }
         else if(bond->containsBoth(chemkit::Atom::Arsenic, chemkit::Atom::Arsenic)){
-            bitset[326] = 1;
+            setBit(words, 326);
         }
     }
 
@@ -413,6 +447,4 @@ chemkit::Bitset PubChemFingerprint::value(const chemkit::Molecule *molecule) con
 
     // section 7 - complex SMARTS patterns
     // TODO
-
-    return bitset;
 }
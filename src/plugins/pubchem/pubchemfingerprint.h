@@ -44,7 +44,9 @@ public:
     PubChemFingerprint();
     ~PubChemFingerprint();
 
+    size_t size() const CHEMKIT_OVERRIDE;
     chemkit::Bitset value(const chemkit::Molecule *molecule) const CHEMKIT_OVERRIDE;
+    void packedValue(const chemkit::Molecule *molecule, boost::uint64_t *words) const CHEMKIT_OVERRIDE;
 };
 
 #endif // PUBCHEMFINGERPRINT_H
@@ -93,3 +93,33 @@ chemkit::Variant SolventAccessibleVolumeDescriptor::value(const chemkit::Molecul
 
     return surface.volume();
 }
+
+// === ShrakeRupleyAreaDescriptor ========================================== //
+ShrakeRupleyAreaDescriptor::ShrakeRupleyAreaDescriptor()
+    : chemkit::MolecularDescriptor("sas-area-sr")
+{
+    setDimensionality(3);
+}
+
+chemkit::Variant ShrakeRupleyAreaDescriptor::value(const chemkit::Molecule *molecule) const
+{
+    chemkit::MolecularSurface surface(molecule, chemkit::MolecularSurface::SolventAccessible);
+    surface.setAlgorithm(chemkit::MolecularSurface::ShrakeRupley);
+
+    return surface.surfaceArea();
+}
+
+// === LcpoAreaDescriptor ================================================== //
+LcpoAreaDescriptor::LcpoAreaDescriptor()
+    : chemkit::MolecularDescriptor("sas-area-lcpo")
+{
+    setDimensionality(3);
+}
+
+chemkit::Variant LcpoAreaDescriptor::value(const chemkit::Molecule *molecule) const
+{
+    chemkit::MolecularSurface surface(molecule, chemkit::MolecularSurface::SolventAccessible);
+    surface.setAlgorithm(chemkit::MolecularSurface::Lcpo);
+
+    return surface.surfaceArea();
+}
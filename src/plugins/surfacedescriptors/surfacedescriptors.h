@@ -70,4 +70,20 @@ public:
     chemkit::Variant value(const chemkit::Molecule *molecule) const CHEMKIT_OVERRIDE;
 };
 
+class ShrakeRupleyAreaDescriptor : public chemkit::MolecularDescriptor
+{
+public:
+    ShrakeRupleyAreaDescriptor();
+
+    chemkit::Variant value(const chemkit::Molecule *molecule) const CHEMKIT_OVERRIDE;
+};
+
+class LcpoAreaDescriptor : public chemkit::MolecularDescriptor
+{
+public:
+    LcpoAreaDescriptor();
+
+    chemkit::Variant value(const chemkit::Molecule *molecule) const CHEMKIT_OVERRIDE;
+};
+
 #endif // SURFACEDESCRIPTORS_H
@@ -47,6 +47,8 @@ public:
         CHEMKIT_REGISTER_MOLECULAR_DESCRIPTOR("vdw-volume", VanDerWallsVolumeDescriptor);
         CHEMKIT_REGISTER_MOLECULAR_DESCRIPTOR("sas-area", SolventAccessibleAreaDescriptor);
         CHEMKIT_REGISTER_MOLECULAR_DESCRIPTOR("sas-volume", SolventAccessibleVolumeDescriptor);
+        CHEMKIT_REGISTER_MOLECULAR_DESCRIPTOR("sas-area-sr", ShrakeRupleyAreaDescriptor);
+        CHEMKIT_REGISTER_MOLECULAR_DESCRIPTOR("sas-area-lcpo", LcpoAreaDescriptor);
     }
 };
 
@@ -35,12 +35,14 @@
 
 #include "uffcalculation.h"
 
+#include <boost/thread/locks.hpp>
 #include <boost/algorithm/string.hpp>
 
 #include "uffatomtyper.h"
 #include "uffforcefield.h"
 #include "uffparameters.h"
 
+#include <chemkit/foreach.h>
 #include <chemkit/topology.h>
 #include <chemkit/constants.h>
 #include <chemkit/cartesiancoordinates.h>
@@ -578,3 +580,299 @@ chemkit::Real UffElectrostaticCalculation::energy(const chemkit::CartesianCoordi
 
     return 332.037 * (qa * qb) / (e * r);
 }
+
+// === UffNeighborListCalculation ========================================== //
+// Calculates the van der waals energy for each pair of atoms within
+// the nonbonded cutoff distance using a neighbor list.
+UffNeighborListCalculation::UffNeighborListCalculation(size_t size, chemkit::Real cutoff, chemkit::Real skin)
+    : UffCalculation(VanDerWaals, size, 0),
+      m_neighborList(size, cutoff, skin)
+{
+    for(size_t i = 0; i < size; i++){
+        setAtom(i, i);
+    }
+}
+
+bool UffNeighborListCalculation::setup()
+{
+    m_neighborList.addExclusions(topology().get());
+
+    m_wellDepths.resize(atomCount());
+    m_distances.resize(atomCount());
+
+    bool ok = true;
+
+    for(size_t i = 0; i < atomCount(); i++){
+        const UffAtomParameters *p = parameters(atomType(i));
+        if(!p){
+            ok = false;
+            continue;
+        }
+
+        // store square roots so that equations 21b and 22 become
+        // a product for each pair
+        m_wellDepths[i] = sqrt(p->D);
+        m_distances[i] = sqrt(p->x);
+    }
+
+    return ok;
+}
+
+chemkit::Real UffNeighborListCalculation::energy(const chemkit::CartesianCoordinates *coordinates) const
+{
+    boost::lock_guard<boost::mutex> lock(m_neighborListMutex);
+    m_neighborList.update(coordinates);
+
+    chemkit::Real cutoff = m_neighborList.cutoff();
+    chemkit::Real energy = 0;
+
+    foreach(const chemkit::NeighborList::Pair &pair, m_neighborList.pairs()){
+        size_t a = pair[0];
+        size_t b = pair[1];
+
+        chemkit::Real r = coordinates->distance(a, b);
+        if(r > cutoff){
+            continue;
+        }
+
+        chemkit::Real d = m_wellDepths[a] * m_wellDepths[b];
+        chemkit::Real x = m_distances[a] * m_distances[b];
+
+        energy += d * (-2 * pow(x/r, 6) + pow(x/r, 12));
+    }
+
+    return energy;
+}
+
+std::vector<chemkit::Vector3> UffNeighborListCalculation::gradient(const chemkit::CartesianCoordinates *coordinates) const
+{
+    boost::lock_guard<boost::mutex> lock(m_neighborListMutex);
+    m_neighborList.update(coordinates);
+
+    std::vector<chemkit::Vector3> gradient(atomCount(), chemkit::Vector3(0, 0, 0));
+    chemkit::Real cutoff = m_neighborList.cutoff();
+
+    foreach(const chemkit::NeighborList::Pair &pair, m_neighborList.pairs()){
+        size_t a = pair[0];
+        size_t b = pair[1];
+
+        chemkit::Vector3 ab = (*coordinates)[a] - (*coordinates)[b];
+        chemkit::Real r = ab.norm();
+        if(r > cutoff){
+            continue;
+        }
+
+        chemkit::Real d = m_wellDepths[a] * m_wellDepths[b];
+        chemkit::Real x = m_distances[a] * m_distances[b];
+
+        // dE/dr
+        chemkit::Real de_dr = -12 * d * x / pow(r, 2) * (pow(x/r, 11) - pow(x/r, 5));
+
+        chemkit::Vector3 de_da = ab * (de_dr / r);
+        gradient[a] += de_da;
+        gradient[b] -= de_da;
+    }
+
+    return gradient;
+}
+
+// === UffBondStrechBatch ================================================== //
+UffBondStrechBatch::UffBondStrechBatch()
+    : chemkit::ForceFieldCalculationBatch(chemkit::ForceFieldCalculation::BondStrech, 2, 2)
+{
+}
+
+chemkit::Real UffBondStrechBatch::energy(const chemkit::CartesianCoordinates *coordinates, size_t begin, size_t end) const
+{
+    const size_t *a = atoms(0);
+    const size_t *b = atoms(1);
+    const chemkit::Real *kb = parameters(0);
+    const chemkit::Real *r0 = parameters(1);
+
+    chemkit::Real energy = 0;
+
+    for(size_t i = begin; i < end; i++){
+        chemkit::Real r = coordinates->distance(a[i], b[i]);
+
+        energy += 0.5 * kb[i] * pow(r - r0[i], 2);
+    }
+
+    return energy;
+}
+
+void UffBondStrechBatch::gradient(const chemkit::CartesianCoordinates *coordinates, std::vector<chemkit::Vector3> &gradient, size_t begin, size_t end) const
+{
+    const size_t *a = atoms(0);
+    const size_t *b = atoms(1);
+    const chemkit::Real *kb = parameters(0);
+    const chemkit::Real *r0 = parameters(1);
+
+    for(size_t i = begin; i < end; i++){
+        chemkit::Real r = coordinates->distance(a[i], b[i]);
+
+        // dE/dr
+        chemkit::Real de_dr = kb[i] * (r - r0[i]);
+
+        boost::array<chemkit::Vector3, 2> distanceGradient = coordinates->distanceGradient(a[i], b[i]);
+
+        gradient[a[i]] += distanceGradient[0] * de_dr;
+        gradient[b[i]] += distanceGradient[1] * de_dr;
+    }
+}
+
+// === UffAngleBendBatch =================================================== //
+UffAngleBendBatch::UffAngleBendBatch()
+    : chemkit::ForceFieldCalculationBatch(chemkit::ForceFieldCalculation::AngleBend, 3, 4)
+{
+}
+
+chemkit::Real UffAngleBendBatch::energy(const chemkit::CartesianCoordinates *coordinates, size_t begin, size_t end) const
+{
+    const size_t *a = atoms(0);
+    const size_t *b = atoms(1);
+    const size_t *c = atoms(2);
+    const chemkit::Real *ka = parameters(0);
+    const chemkit::Real *c0 = parameters(1);
+    const chemkit::Real *c1 = parameters(2);
+    const chemkit::Real *c2 = parameters(3);
+
+    chemkit::Real energy = 0;
+
+    for(size_t i = begin; i < end; i++){
+        chemkit::Real theta = coordinates->angleRadians(a[i], b[i], c[i]);
+
+        energy += ka[i] * (c0[i] + (c1[i] * cos(theta)) + (c2[i] * cos(2*theta)));
+    }
+
+    return energy;
+}
+
+void UffAngleBendBatch::gradient(const chemkit::CartesianCoordinates *coordinates, std::vector<chemkit::Vector3> &gradient, size_t begin, size_t end) const
+{
+    const size_t *a = atoms(0);
+    const size_t *b = atoms(1);
+    const size_t *c = atoms(2);
+    const chemkit::Real *ka = parameters(0);
+    const chemkit::Real *c1 = parameters(2);
+    const chemkit::Real *c2 = parameters(3);
+
+    for(size_t i = begin; i < end; i++){
+        chemkit::Real theta = coordinates->angleRadians(a[i], b[i], c[i]);
+
+        // dE/dtheta
+        chemkit::Real de_dtheta = -ka[i] * (c1[i] * sin(theta) + 2 * c2[i] * sin(2 * theta));
+
+        boost::array<chemkit::Vector3, 3> angleGradient = coordinates->angleGradientRadians(a[i], b[i], c[i]);
+
+        gradient[a[i]] += angleGradient[0] * de_dtheta;
+        gradient[b[i]] += angleGradient[1] * de_dtheta;
+        gradient[c[i]] += angleGradient[2] * de_dtheta;
+    }
+}
+
+// === UffTorsionBatch ===================================================== //
+UffTorsionBatch::UffTorsionBatch()
+    : chemkit::ForceFieldCalculationBatch(chemkit::ForceFieldCalculation::Torsion, 4, 3)
+{
+}
+
+chemkit::Real UffTorsionBatch::energy(const chemkit::CartesianCoordinates *coordinates, size_t begin, size_t end) const
+{
+    const size_t *a = atoms(0);
+    const size_t *b = atoms(1);
+    const size_t *c = atoms(2);
+    const size_t *d = atoms(3);
+    const chemkit::Real *V = parameters(0);
+    const chemkit::Real *n = parameters(1);
+    const chemkit::Real *phi0 = parameters(2);
+
+    chemkit::Real energy = 0;
+
+    for(size_t i = begin; i < end; i++){
+        chemkit::Real phi = coordinates->torsionAngleRadians(a[i], b[i], c[i], d[i]);
+
+        energy += 0.5 * V[i] * (1 - cos(n[i] * phi0[i]) * cos(n[i] * phi));
+    }
+
+    return energy;
+}
+
+void UffTorsionBatch::gradient(const chemkit::CartesianCoordinates *coordinates, std::vector<chemkit::Vector3> &gradient, size_t begin, size_t end) const
+{
+    const size_t *a = atoms(0);
+    const size_t *b = atoms(1);
+    const size_t *c = atoms(2);
+    const size_t *d = atoms(3);
+    const chemkit::Real *V = parameters(0);
+    const chemkit::Real *n = parameters(1);
+    const chemkit::Real *phi0 = parameters(2);
+
+    for(size_t i = begin; i < end; i++){
+        chemkit::Real phi = coordinates->torsionAngleRadians(a[i], b[i], c[i], d[i]);
+
+        // dE/dphi
+        chemkit::Real de_dphi = 0.5 * V[i] * n[i] * cos(n[i] * phi0[i]) * sin(n[i] * phi);
+
+        boost::array<chemkit::Vector3, 4> torsionGradient = coordinates->torsionAngleGradientRadians(a[i], b[i], c[i], d[i]);
+
+        gradient[a[i]] += torsionGradient[0] * de_dphi;
+        gradient[b[i]] += torsionGradient[1] * de_dphi;
+        gradient[c[i]] += torsionGradient[2] * de_dphi;
+        gradient[d[i]] += torsionGradient[3] * de_dphi;
+    }
+}
+
+// === UffInversionBatch =================================================== //
+UffInversionBatch::UffInversionBatch()
+    : chemkit::ForceFieldCalculationBatch(chemkit::ForceFieldCalculation::Inversion, 4, 4)
+{
+}
+
+chemkit::Real UffInversionBatch::energy(const chemkit::CartesianCoordinates *coordinates, size_t begin, size_t end) const
+{
+    const size_t *a = atoms(0);
+    const size_t *b = atoms(1);
+    const size_t *c = atoms(2);
+    const size_t *d = atoms(3);
+    const chemkit::Real *k = parameters(0);
+    const chemkit::Real *c0 = parameters(1);
+    const chemkit::Real *c1 = parameters(2);
+    const chemkit::Real *c2 = parameters(3);
+
+    chemkit::Real energy = 0;
+
+    for(size_t i = begin; i < end; i++){
+        chemkit::Real w = coordinates->wilsonAngleRadians(a[i], b[i], c[i], d[i]);
+        chemkit::Real y = w + (chemkit::constants::Pi / 2.0);
+
+        energy += k[i] * (c0[i] + c1[i] * sin(y) + c2[i] * cos(2 * y));
+    }
+
+    return energy;
+}
+
+void UffInversionBatch::gradient(const chemkit::CartesianCoordinates *coordinates, std::vector<chemkit::Vector3> &gradient, size_t begin, size_t end) const
+{
+    const size_t *a = atoms(0);
+    const size_t *b = atoms(1);
+    const size_t *c = atoms(2);
+    const size_t *d = atoms(3);
+    const chemkit::Real *k = parameters(0);
+    const chemkit::Real *c1 = parameters(2);
+    const chemkit::Real *c2 = parameters(3);
+
+    for(size_t i = begin; i < end; i++){
+        chemkit::Real w = coordinates->wilsonAngleRadians(a[i], b[i], c[i], d[i]);
+        chemkit::Real y = w + (chemkit::constants::Pi / 2.0);
+
+        // dE/dw
+        chemkit::Real de_dw = k[i] * (c1[i] * cos(y) - 2 * c2[i] * sin(2 * y));
+
+        boost::array<chemkit::Vector3, 4> wilsonGradient = coordinates->wilsonAngleGradientRadians(a[i], b[i], c[i], d[i]);
+
+        gradient[a[i]] += wilsonGradient[0] * de_dw;
+        gradient[b[i]] += wilsonGradient[1] * de_dw;
+        gradient[c[i]] += wilsonGradient[2] * de_dw;
+        gradient[d[i]] += wilsonGradient[3] * de_dw;
+    }
+}
@@ -36,7 +36,11 @@
 #ifndef UFFCALCULATION_H
 #define UFFCALCULATION_H
 
+#include <boost/thread/mutex.hpp>
+
+#include <chemkit/neighborlist.h>
 #include <chemkit/forcefieldcalculation.h>
+#include <chemkit/forcefieldcalculationbatch.h>
 
 #include "uffparameters.h"
 
@@ -112,4 +116,68 @@ public:
     chemkit::Real energy(const chemkit::CartesianCoordinates *coordinates) const CHEMKIT_OVERRIDE;
 };
 
+class UffNeighborListCalculation : public UffCalculation
+{
+public:
+    UffNeighborListCalculation(size_t size, chemkit::Real cutoff, chemkit::Real skin);
+
+    bool setup();
+    chemkit::Real energy(const chemkit::CartesianCoordinates *coordinates) const CHEMKIT_OVERRIDE;
+    std::vector<chemkit::Vector3> gradient(const chemkit::CartesianCoordinates *coordinates) const CHEMKIT_OVERRIDE;
+
+private:
+    mutable chemkit::NeighborList m_neighborList;
+    mutable boost::mutex m_neighborListMutex;
+    std::vector<chemkit::Real> m_wellDepths;
+    std::vector<chemkit::Real> m_distances;
+};
+
+class UffBondStrechBatch : public chemkit::ForceFieldCalculationBatch
+{
+public:
+    UffBondStrechBatch();
+
+    using chemkit::ForceFieldCalculationBatch::energy;
+    using chemkit::ForceFieldCalculationBatch::gradient;
+
+    chemkit::Real energy(const chemkit::CartesianCoordinates *coordinates, size_t begin, size_t end) const CHEMKIT_OVERRIDE;
+    void gradient(const chemkit::CartesianCoordinates *coordinates, std::vector<chemkit::Vector3> &gradient, size_t begin, size_t end) const CHEMKIT_OVERRIDE;
+};
+
+class UffAngleBendBatch : public chemkit::ForceFieldCalculationBatch
+{
+public:
+    UffAngleBendBatch();
+
+    using chemkit::ForceFieldCalculationBatch::energy;
+    using chemkit::ForceFieldCalculationBatch::gradient;
+
+    chemkit::Real energy(const chemkit::CartesianCoordinates *coordinates, size_t begin, size_t end) const CHEMKIT_OVERRIDE;
+    void gradient(const chemkit::CartesianCoordinates *coordinates, std::vector<chemkit::Vector3> &gradient, size_t begin, size_t end) const CHEMKIT_OVERRIDE;
+};
+
+class UffTorsionBatch : public chemkit::ForceFieldCalculationBatch
+{
+public:
+    UffTorsionBatch();
+
+    using chemkit::ForceFieldCalculationBatch::energy;
+    using chemkit::ForceFieldCalculationBatch::gradient;
+
+    chemkit::Real energy(const chemkit::CartesianCoordinates *coordinates, size_t begin, size_t end) const CHEMKIT_OVERRIDE;
+    void gradient(const chemkit::CartesianCoordinates *coordinates, std::vector<chemkit::Vector3> &gradient, size_t begin, size_t end) const CHEMKIT_OVERRIDE;
+};
+
+class UffInversionBatch : public chemkit::ForceFieldCalculationBatch
+{
+public:
+    UffInversionBatch();
+
+    using chemkit::ForceFieldCalculationBatch::energy;
+    using chemkit::ForceFieldCalculationBatch::gradient;
+
+    chemkit::Real energy(const chemkit::CartesianCoordinates *coordinates, size_t begin, size_t end) const CHEMKIT_OVERRIDE;
+    void gradient(const chemkit::CartesianCoordinates *coordinates, std::vector<chemkit::Vector3> &gradient, size_t begin, size_t end) const CHEMKIT_OVERRIDE;
+};
+
 #endif // UFFCALCULATION_H
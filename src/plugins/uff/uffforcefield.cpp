@@ -78,25 +78,37 @@ bool UffForceField::setup()
         return false;
     }
 
+    // the bonded calculations are evaluated in batches
+    UffBondStrechBatch *bondStrechBatch = new UffBondStrechBatch;
+    UffAngleBendBatch *angleBendBatch = new UffAngleBendBatch;
+    UffTorsionBatch *torsionBatch = new UffTorsionBatch;
+    UffInversionBatch *inversionBatch = new UffInversionBatch;
+
     // bond strech
     foreach(const chemkit::Topology::BondedInteraction &interaction, topology->bondedInteractions()){
-        addCalculation(new UffBondStrechCalculation(interaction[0],
-                                                    interaction[1]));
+        UffBondStrechCalculation *calculation = new UffBondStrechCalculation(interaction[0],
+                                                                             interaction[1]);
+        addCalculation(calculation);
+        bondStrechBatch->addCalculation(calculation);
     }
 
     // angle bend
     foreach(const chemkit::Topology::AngleInteraction &interaction, topology->angleInteractions()){
-        addCalculation(new UffAngleBendCalculation(interaction[0],
-                                                   interaction[1],
-                                                   interaction[2]));
+        UffAngleBendCalculation *calculation = new UffAngleBendCalculation(interaction[0],
+                                                                           interaction[1],
+                                                                           interaction[2]);
+        addCalculation(calculation);
+        angleBendBatch->addCalculation(calculation);
     }
 
     // torsion
     foreach(const chemkit::Topology::TorsionInteraction &interaction, topology->torsionInteractions()){
-        addCalculation(new UffTorsionCalculation(interaction[0],
-                                                 interaction[1],
-                                                 interaction[2],
-                                                 interaction[3]));
+        UffTorsionCalculation *calculation = new UffTorsionCalculation(interaction[0],
+                                                                       interaction[1],
+                                                                       interaction[2],
+                                                                       interaction[3]);
+        addCalculation(calculation);
+        torsionBatch->addCalculation(calculation);
     }
 
     // inversion
@@ -110,25 +122,55 @@ bool UffForceField::setup()
            boost::starts_with(typeB, "As") ||
            boost::starts_with(typeB, "Sb") ||
            boost::starts_with(typeB, "Bi")){
-            addCalculation(new UffInversionCalculation(interaction[0],
-                                                       interaction[1],
-                                                       interaction[2],
-                                                       interaction[3]));
-            addCalculation(new UffInversionCalculation(interaction[0],
-                                                       interaction[1],
-                                                       interaction[3],
-                                                       interaction[2]));
-            addCalculation(new UffInversionCalculation(interaction[2],
-                                                       interaction[1],
-                                                       interaction[0],
-                                                       interaction[3]));
+            UffInversionCalculation *calculations[] = {
+                new UffInversionCalculation(interaction[0],
+                                            interaction[1],
+                                            interaction[2],
+                                            interaction[3]),
+                new UffInversionCalculation(interaction[0],
+                                            interaction[1],
+                                            interaction[3],
+                                            interaction[2]),
+                new UffInversionCalculation(interaction[2],
+                                            interaction[1],
+                                            interaction[0],
+                                            interaction[3])
+            };
+
+            for(int i = 0; i < 3; i++){
+                addCalculation(calculations[i]);
+                inversionBatch->addCalculation(calculations[i]);
+            }
         }
     }
 
     // van der waals
-    foreach(const chemkit::Topology::NonbondedInteraction &interaction, topology->nonbondedInteractions()){
-        addCalculation(new UffVanDerWaalsCalculation(interaction[0],
-                                                     interaction[1]));
+    if(nonbondedCutoff() > 0){
+        addCalculation(new UffNeighborListCalculation(topology->size(),
+                                                      nonbondedCutoff(),
+                                                      neighborListSkin()));
+    }
+    else{
+        foreach(const chemkit::Topology::NonbondedInteraction &interaction, topology->nonbondedInteractions()){
+            addCalculation(new UffVanDerWaalsCalculation(interaction[0],
+                                                         interaction[1]));
+        }
+    }
+
+    chemkit::ForceFieldCalculationBatch *batches[] = {
+        bondStrechBatch,
+        angleBendBatch,
+        torsionBatch,
+        inversionBatch
+    };
+
+    for(int i = 0; i < 4; i++){
+        if(batches[i]->isEmpty()){
+            delete batches[i];
+        }
+        else{
+            addCalculationBatch(batches[i]);
+        }
     }
 
     bool ok = true;
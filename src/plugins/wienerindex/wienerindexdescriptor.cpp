@@ -35,55 +35,11 @@
 
 #include "wienerindexdescriptor.h"
 
-#include <set>
 #include <vector>
 
 #include <chemkit/atom.h>
-#include <chemkit/foreach.h>
 #include <chemkit/molecule.h>
-
-namespace {
-
-// Returns the graph distance between the two atoms.
-int distanceBetween(const chemkit::Atom *a, const chemkit::Atom *b)
-{
-    int distance = 0;
-
-    std::set<const chemkit::Atom*> visited;
-
-    std::vector<const chemkit::Atom*> row;
-    row.push_back(a);
-
-    while(!row.empty()){
-        std::vector<const chemkit::Atom*> nextRow;
-
-        foreach(const chemkit::Atom *atom, row){
-            if(atom == b){
-                return distance;
-            }
-
-            visited.insert(atom);
-
-            foreach(const chemkit::Atom *neighbor, atom->neighbors()){
-                if(visited.find(neighbor) != visited.end()){
-                    continue;
-                }
-                else if(neighbor->isTerminalHydrogen()){
-                    continue;
-                }
-
-                nextRow.push_back(neighbor);
-            }
-        }
-
-        row = nextRow;
-        distance++;
-    }
-
-    return 0;
-}
-
-} // end anonymous namespace
+#include <chemkit/topologicaldistancematrix.h>
 
 WienerIndexDescriptor::WienerIndexDescriptor()
     : chemkit::MolecularDescriptor("wiener-index")
@@ -98,21 +54,25 @@ WienerIndexDescriptor::~WienerIndexDescriptor()
 // Returns the wiener index for the molecule.
 chemkit::Variant WienerIndexDescriptor::value(const chemkit::Molecule *molecule) const
 {
-    int index = 0;
+    const chemkit::TopologicalDistanceMatrix *distances = molecule->topologicalDistanceMatrix();
 
+    // terminal hydrogens are not included
+    std::vector<size_t> atoms;
     for(size_t i = 0; i < molecule->atomCount(); i++){
-        const chemkit::Atom *a = molecule->atom(i);
-        if(a->isTerminalHydrogen()){
-            continue;
+        if(!molecule->atom(i)->isTerminalHydrogen()){
+            atoms.push_back(i);
         }
+    }
 
-        for(size_t j = i + 1; j < molecule->atomCount(); j++){
-            const chemkit::Atom *b = molecule->atom(j);
-            if(b->isTerminalHydrogen()){
-                continue;
-            }
+    int index = 0;
+
+    for(size_t i = 0; i < atoms.size(); i++){
+        for(size_t j = i + 1; j < atoms.size(); j++){
+            size_t distance = distances->distance(atoms[i], atoms[j]);
 
-            index += distanceBetween(a, b);
+            if(distance != chemkit::TopologicalDistanceMatrix::npos){
+                index += distance;
+            }
         }
     }
 
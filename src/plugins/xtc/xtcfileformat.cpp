@@ -35,108 +35,564 @@
 
 #include "xtcfileformat.h"
 
-#include <boost/filesystem.hpp>
+#include <cstring>
+#include <iterator>
+
+#include <boost/cstdint.hpp>
 #include <boost/make_shared.hpp>
 
-#include <rpc/xdr.h>
-#include <rpc/types.h>
 #include <chemkit/vector3.h>
 #include <chemkit/unitcell.h>
 #include <chemkit/trajectory.h>
 #include <chemkit/trajectoryfile.h>
 #include <chemkit/trajectoryframe.h>
-#include <chemkit/cartesiancoordinates.h>
 
-#include "../../3rdparty/xdrf/xdrf.h"
+namespace {
 
-XtcFileFormat::XtcFileFormat()
-    : chemkit::TrajectoryFileFormat("xtc")
+// XTC frames are XDR encoded (big-endian, four byte aligned) and
+// store their coordinates with the compression scheme from the
+// GROMACS xdrfile library. The decoder below reads them straight
+// from memory so that any single frame can be decoded on its own.
+
+const int XtcMagic = 1995;
+
+// frames with this many atoms or fewer store uncompressed coordinates
+const int XtcUncompressedAtomCount = 9;
+
+// size of the frame header (magic, atom count, step, time and box)
+const size_t XtcHeaderSize = 13 * 4;
+
+const unsigned int magicints[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 10, 12, 16, 20, 25, 32, 40, 50, 64,
+    80, 101, 128, 161, 203, 256, 322, 406, 512, 645, 812, 1024, 1290,
+    1625, 2048, 2580, 3250, 4096, 5060, 6501, 8192, 10321, 13003,
+    16384, 20642, 26007, 32768, 41285, 52015, 65536, 82570, 104031,
+    131072, 165140, 208063, 262144, 330280, 416127, 524287, 660561,
+    832255, 1048576, 1321122, 1664510, 2097152, 2642245, 3329021,
+    4194304, 5284491, 6658042, 8388607, 10568983, 13316085, 16777216
+};
+
+const int FirstMagicIndex = 9;
+const int LastMagicIndex = sizeof(magicints) / sizeof(*magicints);
+
+// Reads XDR encoded values from a block of memory.
+class XdrReader
 {
-}
+public:
+    XdrReader(const char *data, size_t size)
+        : m_data(reinterpret_cast<const unsigned char *>(data)),
+          m_size(size),
+          m_position(0)
+    {
+    }
 
-bool XtcFileFormat::read(std::istream &input, chemkit::TrajectoryFile *file)
+    size_t position() const
+    {
+        return m_position;
+    }
+
+    const unsigned char* current() const
+    {
+        return m_data + m_position;
+    }
+
+    bool readInt(int &value)
+    {
+        if(m_position + 4 > m_size){
+            return false;
+        }
+
+        const unsigned char *p = m_data + m_position;
+        value = static_cast<int>((boost::uint32_t(p[0]) << 24) |
+                                 (boost::uint32_t(p[1]) << 16) |
+                                 (boost::uint32_t(p[2]) << 8) |
+                                  boost::uint32_t(p[3]));
+        m_position += 4;
+        return true;
+    }
+
+    bool readFloat(float &value)
+    {
+        int bits;
+        if(!readInt(bits)){
+            return false;
+        }
+
+        std::memcpy(&value, &bits, sizeof(value));
+        return true;
+    }
+
+    bool skip(size_t size)
+    {
+        // opaque data is padded to a multiple of four bytes
+        size = (size + 3) & ~size_t(3);
+
+        if(size > m_size - m_position){
+            return false;
+        }
+
+        m_position += size;
+        return true;
+    }
+
+private:
+    const unsigned char *m_data;
+    size_t m_size;
+    size_t m_position;
+};
+
+// Reads packed integers from the compressed coordinate data.
+class BitReader
 {
-    // read data into temporary file
-    std::string tempFileName = (boost::filesystem::temp_directory_path() /
-                                boost::filesystem::unique_path()).string();
+public:
+    BitReader(const unsigned char *data, size_t size)
+        : m_data(data),
+          m_size(size),
+          m_position(0),
+          m_lastBits(0),
+          m_lastByte(0),
+          m_overflow(false)
+    {
+    }
 
-    std::ofstream ostream(tempFileName.c_str());
-    ostream << input.rdbuf();
-    size_t dataSize = ostream.tellp();
-    ostream.close();
+    bool overflow() const
+    {
+        return m_overflow;
+    }
 
-    XDR xdrs;
-    xdropen(&xdrs, tempFileName.c_str(), "r");
+    unsigned int read(int bitCount)
+    {
+        unsigned int mask = bitCount < 32 ? (1u << bitCount) - 1 : ~0u;
+        unsigned int value = 0;
 
-    boost::shared_ptr<chemkit::Trajectory> trajectory = boost::make_shared<chemkit::Trajectory>();
+        while(bitCount >= 8){
+            m_lastByte = (m_lastByte << 8) | nextByte();
+            value |= (m_lastByte >> m_lastBits) << (bitCount - 8);
+            bitCount -= 8;
+        }
 
-    while(xdr_getpos(&xdrs) < dataSize){
-        // read magic (should be '1995')
-        int magic = 0;
-        xdr_int(&xdrs, &magic);
-        if(magic != 1995){
-            break;
+        if(bitCount > 0){
+            if(m_lastBits < bitCount){
+                m_lastBits += 8;
+                m_lastByte = (m_lastByte << 8) | nextByte();
+            }
+
+            m_lastBits -= bitCount;
+            value |= (m_lastByte >> m_lastBits) & ((1u << bitCount) - 1);
         }
 
-        // read atom count
-        int atomCount = 0;
-        xdr_int(&xdrs, &atomCount);
+        return value & mask;
+    }
 
-        // set trajectory size
-        if(trajectory->isEmpty() || trajectory->size() < size_t(atomCount)){
-            trajectory->resize(atomCount);
+    void readInts(int bitCount, const unsigned int sizes[3], int values[3])
+    {
+        unsigned int bytes[32];
+        int byteCount = 0;
+        bytes[1] = bytes[2] = bytes[3] = 0;
+
+        while(bitCount > 8){
+            bytes[byteCount++] = read(8);
+            bitCount -= 8;
+        }
+        if(bitCount > 0){
+            bytes[byteCount++] = read(bitCount);
         }
 
-        // create new frame
-        chemkit::TrajectoryFrame *frame = trajectory->addFrame();
+        for(int i = 2; i > 0; i--){
+            unsigned int value = 0;
+            for(int j = byteCount - 1; j >= 0; j--){
+                value = (value << 8) | bytes[j];
+                unsigned int quotient = value / sizes[i];
+                bytes[j] = quotient;
+                value -= quotient * sizes[i];
+            }
+            values[i] = value;
+        }
 
-        // read frame number
-        int frameNumber = 0;
-        xdr_int(&xdrs, &frameNumber);
+        values[0] = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | (bytes[3] << 24);
+    }
 
-        // read time
-        float time = 0;
-        xdr_float(&xdrs, &time);
+private:
+    unsigned int nextByte()
+    {
+        if(m_position >= m_size){
+            m_overflow = true;
+            return 0;
+        }
+
+        return m_data[m_position++];
+    }
+
+private:
+    const unsigned char *m_data;
+    size_t m_size;
+    size_t m_position;
+    int m_lastBits;
+    unsigned int m_lastByte;
+    bool m_overflow;
+};
+
+// Returns the number of bits needed to store values up to size.
+int bitsForInt(unsigned int size)
+{
+    int bitCount = 0;
+    boost::uint64_t value = 1;
+
+    while(size >= value && bitCount < 32){
+        bitCount++;
+        value <<= 1;
+    }
+
+    return bitCount;
+}
 
-        // read unit cell
-        float box[3][3];
+// Returns the number of bits needed to store three values packed
+// into a single integer in the mixed radix given by sizes.
+int bitsForInts(const unsigned int sizes[3])
+{
+    unsigned int bytes[32];
+    int byteCount = 1;
+    int bitCount = 0;
+    bytes[0] = 1;
+
+    for(int i = 0; i < 3; i++){
+        unsigned int carry = 0;
+        int byteIndex;
+        for(byteIndex = 0; byteIndex < byteCount; byteIndex++){
+            carry = bytes[byteIndex] * sizes[i] + carry;
+            bytes[byteIndex] = carry & 0xff;
+            carry >>= 8;
+        }
+        while(carry != 0){
+            bytes[byteIndex++] = carry & 0xff;
+            carry >>= 8;
+        }
+        byteCount = byteIndex;
+    }
+
+    unsigned int value = 1;
+    byteCount--;
+    while(bytes[byteCount] >= value){
+        bitCount++;
+        value *= 2;
+    }
+
+    return bitCount + byteCount * 8;
+}
+
+// Decodes the compressed coordinates for atomCount atoms into
+// coordinates (in nanometers). Returns false if the data is invalid.
+bool decodeCoordinates(XdrReader &reader, int atomCount, std::vector<float> &coordinates)
+{
+    int storedAtomCount = 0;
+    if(!reader.readInt(storedAtomCount) || storedAtomCount != atomCount){
+        return false;
+    }
+
+    coordinates.resize(3 * atomCount);
+
+    // small systems are stored uncompressed
+    if(atomCount <= XtcUncompressedAtomCount){
+        for(int i = 0; i < 3 * atomCount; i++){
+            if(!reader.readFloat(coordinates[i])){
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    float precision = 0;
+    int minimum[3];
+    int maximum[3];
+    int smallIndex = 0;
+    int byteCount = 0;
+
+    bool ok = reader.readFloat(precision);
+    for(int i = 0; i < 3; i++){
+        ok = ok && reader.readInt(minimum[i]);
+    }
+    for(int i = 0; i < 3; i++){
+        ok = ok && reader.readInt(maximum[i]);
+    }
+    ok = ok && reader.readInt(smallIndex);
+    ok = ok && reader.readInt(byteCount);
+
+    if(!ok ||
+       precision <= 0 ||
+       byteCount < 0 ||
+       smallIndex < FirstMagicIndex ||
+       smallIndex >= LastMagicIndex){
+        return false;
+    }
+
+    const unsigned char *data = reader.current();
+    if(!reader.skip(byteCount)){
+        return false;
+    }
+
+    unsigned int sizes[3];
+    int bitCounts[3] = { 0, 0, 0 };
+    int bitCount = 0;
+    for(int i = 0; i < 3; i++){
+        sizes[i] = static_cast<unsigned int>(maximum[i]) - static_cast<unsigned int>(minimum[i]) + 1;
+    }
+    if((sizes[0] | sizes[1] | sizes[2]) > 0xffffff){
         for(int i = 0; i < 3; i++){
+            bitCounts[i] = bitsForInt(sizes[i]);
+        }
+    }
+    else{
+        bitCount = bitsForInts(sizes);
+    }
+
+    int smaller = magicints[std::max(FirstMagicIndex, smallIndex - 1)] / 2;
+    int small = magicints[smallIndex] / 2;
+    unsigned int smallSizes[3] = { magicints[smallIndex], magicints[smallIndex], magicints[smallIndex] };
+
+    BitReader bits(data, byteCount);
+    float inversePrecision = 1.0f / precision;
+    float *output = &coordinates[0];
+    int run = 0;
+    int i = 0;
+
+    while(i < atomCount){
+        int position[3];
+        if(bitCount == 0){
             for(int j = 0; j < 3; j++){
-                xdr_float(&xdrs, &box[i][j]);
+                position[j] = bits.read(bitCounts[j]);
             }
         }
+        else{
+            bits.readInts(bitCount, sizes, position);
+        }
+        i++;
+
+        for(int j = 0; j < 3; j++){
+            position[j] += minimum[j];
+        }
+
+        int isSmaller = 0;
+        if(bits.read(1)){
+            run = bits.read(5);
+            isSmaller = run % 3;
+            run -= isSmaller;
+            isSmaller--;
+        }
 
-        chemkit::Vector3 x(box[0][0], box[0][1], box[0][2]);
-        chemkit::Vector3 y(box[1][0], box[1][1], box[1][2]);
-        chemkit::Vector3 z(box[2][0], box[2][1], box[2][2]);
+        if(run > 0){
+            if(i + run / 3 > atomCount){
+                return false;
+            }
 
-        frame->setUnitCell(new chemkit::UnitCell(x * 10, y * 10, z * 10));
+            for(int k = 0; k < run; k += 3){
+                int next[3];
+                bits.readInts(smallIndex, smallSizes, next);
+                i++;
 
-        // read coordinates
-        std::vector<float> coordinateData(3 * atomCount);
-        float precision = 1000.0f;
-        xdr3dfcoord(&xdrs, &coordinateData[0], &atomCount, &precision);
+                for(int j = 0; j < 3; j++){
+                    next[j] += position[j] - small;
+                }
 
-        for(int i = 0; i < atomCount; i++){
-            // multiply each coordinate by 10 to convert
-            // from nanometers to angstroms
-            chemkit::Point3 position(coordinateData[i*3+0] * 10,
-                                     coordinateData[i*3+1] * 10,
-                                     coordinateData[i*3+2] * 10);
+                if(k == 0){
+                    // the first two atoms of a run are swapped when
+                    // writing to improve the compression of water
+                    for(int j = 0; j < 3; j++){
+                        std::swap(next[j], position[j]);
+                        *output++ = position[j] * inversePrecision;
+                    }
+                }
+                else{
+                    for(int j = 0; j < 3; j++){
+                        position[j] = next[j];
+                    }
+                }
 
-            frame->setPosition(i, position);
+                for(int j = 0; j < 3; j++){
+                    *output++ = next[j] * inversePrecision;
+                }
+            }
         }
+        else{
+            for(int j = 0; j < 3; j++){
+                *output++ = position[j] * inversePrecision;
+            }
+        }
+
+        smallIndex += isSmaller;
+        if(smallIndex < FirstMagicIndex || smallIndex >= LastMagicIndex){
+            return false;
+        }
+
+        if(isSmaller < 0){
+            small = smaller;
+            smaller = smallIndex > FirstMagicIndex ? magicints[smallIndex - 1] / 2 : 0;
+        }
+        else if(isSmaller > 0){
+            smaller = small;
+            small = magicints[smallIndex] / 2;
+        }
+
+        smallSizes[0] = smallSizes[1] = smallSizes[2] = magicints[smallIndex];
     }
 
-    xdrclose(&xdrs);
+    return !bits.overflow();
+}
 
-    // remove temp file
-    boost::filesystem::remove(tempFileName);
+} // end anonymous namespace
 
-    if(trajectory->isEmpty()){
+XtcFileFormat::XtcFileFormat()
+    : chemkit::TrajectoryFileFormat("xtc")
+{
+}
+
+bool XtcFileFormat::read(std::istream &input, chemkit::TrajectoryFile *file)
+{
+    std::vector<char> data((std::istreambuf_iterator<char>(input)),
+                           std::istreambuf_iterator<char>());
+
+    return readData(data.empty() ? 0 : &data[0], data.size(), file);
+}
+
+bool XtcFileFormat::readMappedFile(const boost::iostreams::mapped_file_source &input,
+                                   chemkit::TrajectoryFile *file)
+{
+    return readData(input.data(), input.size(), file);
+}
+
+bool XtcFileFormat::readFrameIndex(const char *data,
+                                   size_t size,
+                                   std::vector<size_t> &offsets,
+                                   std::vector<chemkit::Real> &times)
+{
+    XdrReader reader(data, size);
+
+    while(reader.position() + XtcHeaderSize <= size){
+        size_t offset = reader.position();
+
+        int magic = 0;
+        int atomCount = 0;
+        int step = 0;
+        float time = 0;
+        reader.readInt(magic);
+        reader.readInt(atomCount);
+        reader.readInt(step);
+        reader.readFloat(time);
+
+        if(magic != XtcMagic || atomCount < 0){
+            setErrorString("Invalid XTC frame header.");
+            return false;
+        }
+
+        // skip the box and the coordinates. a frame that is cut short
+        // (e.g. from a simulation that is still running) is ignored
+        bool ok = reader.skip(9 * 4);
+        int storedAtomCount = 0;
+        ok = ok && reader.readInt(storedAtomCount);
+
+        if(ok && atomCount <= XtcUncompressedAtomCount){
+            ok = reader.skip(3 * 4 * atomCount);
+        }
+        else if(ok){
+            int byteCount = 0;
+            ok = reader.skip(8 * 4) && reader.readInt(byteCount) && byteCount >= 0 && reader.skip(byteCount);
+        }
+
+        if(!ok){
+            break;
+        }
+
+        offsets.push_back(offset);
+        times.push_back(time);
+    }
+
+    if(offsets.empty()){
+        setErrorString("No frames found in XTC file.");
+        return false;
+    }
+
+    return true;
+}
+
+bool XtcFileFormat::readFrame(const char *data,
+                              size_t size,
+                              chemkit::TrajectoryFrame *frame)
+{
+    XdrReader reader(data, size);
+
+    // read header
+    int magic = 0;
+    int atomCount = 0;
+    int step = 0;
+    float time = 0;
+    float box[3][3];
+
+    bool ok = reader.readInt(magic) && reader.readInt(atomCount) &&
+              reader.readInt(step) && reader.readFloat(time);
+    for(int i = 0; i < 3; i++){
+        for(int j = 0; j < 3; j++){
+            ok = ok && reader.readFloat(box[i][j]);
+        }
+    }
+
+    if(!ok || magic != XtcMagic || atomCount < 0){
+        setErrorString("Invalid XTC frame header.");
+        return false;
+    }
+
+    // read coordinates
+    std::vector<float> coordinates;
+    if(!decodeCoordinates(reader, atomCount, coordinates)){
+        setErrorString("Invalid XTC coordinate data.");
         return false;
     }
 
+    // set trajectory size
+    chemkit::Trajectory *trajectory = frame->trajectory();
+    if(trajectory->size() < size_t(atomCount)){
+        trajectory->resize(atomCount);
+    }
+
+    frame->setTime(time);
+
+    // multiply the unit cell and each coordinate by 10 to
+    // convert from nanometers to angstroms
+    chemkit::Vector3 x(box[0][0], box[0][1], box[0][2]);
+    chemkit::Vector3 y(box[1][0], box[1][1], box[1][2]);
+    chemkit::Vector3 z(box[2][0], box[2][1], box[2][2]);
+
+    frame->setUnitCell(new chemkit::UnitCell(x * 10, y * 10, z * 10));
+
+    for(int i = 0; i < atomCount; i++){
+        chemkit::Point3 position(coordinates[i*3+0] * 10,
+                                 coordinates[i*3+1] * 10,
+                                 coordinates[i*3+2] * 10);
+
+        frame->setPosition(i, position);
+    }
+
+    return true;
+}
+
+bool XtcFileFormat::readData(const char *data, size_t size, chemkit::TrajectoryFile *file)
+{
+    std::vector<size_t> offsets;
+    std::vector<chemkit::Real> times;
+    if(!readFrameIndex(data, size, offsets, times)){
+        return false;
+    }
+
+    boost::shared_ptr<chemkit::Trajectory> trajectory = boost::make_shared<chemkit::Trajectory>();
+
+    for(size_t i = 0; i < offsets.size(); i++){
+        size_t end = i + 1 < offsets.size() ? offsets[i+1] : size;
+
+        chemkit::TrajectoryFrame *frame = trajectory->addFrame();
+        if(!readFrame(data + offsets[i], end - offsets[i], frame)){
+            return false;
+        }
+    }
+
     file->setTrajectory(trajectory);
 
     return true;
@@ -43,7 +43,13 @@ class XtcFileFormat : public chemkit::TrajectoryFileFormat
 public:
     XtcFileFormat();
 
-    bool read(std::istream &input, chemkit::TrajectoryFile *file);
+    bool read(std::istream &input, chemkit::TrajectoryFile *file) CHEMKIT_OVERRIDE;
+    bool readMappedFile(const boost::iostreams::mapped_file_source &input, chemkit::TrajectoryFile *file) CHEMKIT_OVERRIDE;
+    bool readFrameIndex(const char *data, size_t size, std::vector<size_t> &offsets, std::vector<chemkit::Real> &times) CHEMKIT_OVERRIDE;
+    bool readFrame(const char *data, size_t size, chemkit::TrajectoryFrame *frame) CHEMKIT_OVERRIDE;
+
+private:
+    bool readData(const char *data, size_t size, chemkit::TrajectoryFile *file);
 };
 
 #endif // XTCFILEFORMAT_H
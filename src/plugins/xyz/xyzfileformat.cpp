@@ -36,6 +36,7 @@
 #include "xyzfileformat.h"
 
 #include <cstdio>
+#include <cstring>
 #include <iomanip>
 
 #include <boost/make_shared.hpp>
@@ -46,95 +47,73 @@
 #include <chemkit/molecule.h>
 #include <chemkit/moleculefile.h>
 
-XyzFileFormat::XyzFileFormat()
-    : chemkit::MoleculeFileFormat("xyz")
-{
-}
+namespace {
 
-bool XyzFileFormat::read(std::istream &input, chemkit::MoleculeFile *file)
+// Returns the line starting at position and moves position to the
+// start of the next line.
+std::string readLine(const char *&position, const char *end)
 {
-    // atom count line
-    int atomCount = 0;
-    input >> atomCount;
-    input.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-
-    // comment line (unused)
-    std::string commentLine;
-    std::getline(input, commentLine);
-    CHEMKIT_UNUSED(commentLine);
+    const char *newline = static_cast<const char *>(memchr(position, '\n', end - position));
+    const char *lineEnd = newline ? newline : end;
 
-    // create molecule
-    boost::shared_ptr<chemkit::Molecule> molecule(new chemkit::Molecule);
+    std::string line(position, lineEnd);
+    position = newline ? newline + 1 : end;
 
-    // read atoms and coordinates
-    for(int i = 0; i < atomCount; i++){
-        std::string symbol;
-        double x = 0;
-        double y = 0;
-        double z = 0;
+    return line;
+}
 
-        input >> symbol >> x >> y >> z;
-        if(input.fail()){
-            input.clear();
-        }
+} // end anonymous namespace
 
-        // add atom from symbol or atomic number
-        chemkit::Atom *atom = 0;
-        if(symbol.empty()){
-            continue;
-        }
-        else if(isdigit(symbol.at(0))){
-            int atomicNumber = boost::lexical_cast<int>(symbol);
-            atom = molecule->addAtom(atomicNumber);
-        }
-        else{
-            atom = molecule->addAtom(symbol);
-        }
+XyzFileFormat::XyzFileFormat()
+    : chemkit::MoleculeFileFormat("xyz")
+{
+}
 
-        // set atom position
-        if(atom){
-            atom->setPosition(x, y, z);
-        }
+bool XyzFileFormat::read(std::istream &input, chemkit::MoleculeFile *file)
+{
+    chemkit::Molecule *molecule = readNext(input);
+    if(!molecule){
+        setErrorString("Failed to read atom count line");
+        return false;
     }
 
     // add molecule to file
-    file->addMolecule(molecule);
+    file->addMolecule(boost::shared_ptr<chemkit::Molecule>(molecule));
 
     return true;
 }
 
 bool XyzFileFormat::readMappedFile(const boost::iostreams::mapped_file_source &input, chemkit::MoleculeFile *file)
 {
-    const char *data = input.data();
-    size_t position = 0;
+    const char *position = input.data();
+    const char *end = input.data() + input.size();
 
     // atom count line
+    std::string line = readLine(position, end);
     unsigned int atomCount = 0;
-    int count = sscanf(&data[position], "%u", &atomCount);
+    int count = sscanf(line.c_str(), "%u", &atomCount);
     if(count != 1){
         setErrorString("Failed to read atom count line");
         return false;
     }
 
-    while(data[position++] != '\n');
-
     // comment line
-    while(data[position++] != '\n');
+    readLine(position, end);
 
     // create molecule
     boost::shared_ptr<chemkit::Molecule> molecule = boost::make_shared<chemkit::Molecule>();
 
     // read atoms and coordinates
-    for(unsigned int i = 0; i < atomCount; i++){
+    for(unsigned int i = 0; i < atomCount && position < end; i++){
         char symbol[4];
         double x, y, z;
 
-        count = sscanf(&data[position], "%3s %lf %lf %lf", symbol, &x, &y, &z);
+        line = readLine(position, end);
+        count = sscanf(line.c_str(), "%3s %lf %lf %lf", symbol, &x, &y, &z);
         if(count != 4){
             setErrorString("Failed to read atom line");
             continue;
         }
-        while(data[position++] != '\n');
 
         chemkit::Atom *atom = 0;
         if(strlen(symbol) == 0){
@@ -169,6 +148,72 @@ bool XyzFileFormat::write(const chemkit::MoleculeFile *file, std::ostream &outpu
         return false;
     }
 
+    return writeNext(molecule.get(), output);
+}
+
+bool XyzFileFormat::supportsStreaming() const
+{
+    return true;
+}
+
+chemkit::Molecule* XyzFileFormat::readNext(std::istream &input)
+{
+    // atom count line
+    int atomCount = 0;
+    input >> atomCount;
+    if(input.fail()){
+        if(!input.eof()){
+            setErrorString("Failed to read atom count line");
+        }
+
+        return 0;
+    }
+    input.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+    // comment line (unused)
+    std::string commentLine;
+    std::getline(input, commentLine);
+    CHEMKIT_UNUSED(commentLine);
+
+    // create molecule
+    chemkit::Molecule *molecule = new chemkit::Molecule;
+
+    // read atoms and coordinates
+    for(int i = 0; i < atomCount; i++){
+        std::string symbol;
+        double x = 0;
+        double y = 0;
+        double z = 0;
+
+        input >> symbol >> x >> y >> z;
+        if(input.fail()){
+            input.clear();
+        }
+
+        // add atom from symbol or atomic number
+        chemkit::Atom *atom = 0;
+        if(symbol.empty()){
+            continue;
+        }
+        else if(isdigit(symbol.at(0))){
+            int atomicNumber = boost::lexical_cast<int>(symbol);
+            atom = molecule->addAtom(atomicNumber);
+        }
+        else{
+            atom = molecule->addAtom(symbol);
+        }
+
+        // set atom position
+        if(atom){
+            atom->setPosition(x, y, z);
+        }
+    }
+
+    return molecule;
+}
+
+bool XyzFileFormat::writeNext(const chemkit::Molecule *molecule, std::ostream &output)
+{
     // atom count line
     output << molecule->atomCount() << "\n";
 
@@ -46,6 +46,9 @@ public:
     bool read(std::istream &input, chemkit::MoleculeFile *file) CHEMKIT_OVERRIDE;
     bool readMappedFile(const boost::iostreams::mapped_file_source &input, chemkit::MoleculeFile *file) CHEMKIT_OVERRIDE;
     bool write(const chemkit::MoleculeFile *file, std::ostream &output) CHEMKIT_OVERRIDE;
+    bool supportsStreaming() const CHEMKIT_OVERRIDE;
+    chemkit::Molecule* readNext(std::istream &input) CHEMKIT_OVERRIDE;
+    bool writeNext(const chemkit::Molecule *molecule, std::ostream &output) CHEMKIT_OVERRIDE;
 };
 
 #endif // XYZFILEFORMAT_H
@@ -65,4 +65,47 @@ void BondPredictorTest::predictBonds()
     QCOMPARE(h1->isBondedTo(h2), false);
 }
 
+void BondPredictorTest::predictedBonds()
+{
+    // create a 10x10x10 lattice of carbon atoms 1.5 angstroms apart
+    chemkit::Molecule molecule;
+    for(int x = 0; x < 10; x++){
+        for(int y = 0; y < 10; y++){
+            for(int z = 0; z < 10; z++){
+                chemkit::Atom *atom = molecule.addAtom(6);
+                atom->setPosition(1.5 * x, 1.5 * y, 1.5 * z);
+            }
+        }
+    }
+
+    // each atom should be bonded to its neighbors along each axis
+    chemkit::BondPredictor predictor(&molecule);
+    std::vector<chemkit::BondPredictor::PredictedBond> bonds = predictor.predictedBonds();
+    QCOMPARE(bonds.size(), size_t(2700));
+
+    // bonds should be sorted by atom index
+    for(size_t i = 0; i < bonds.size(); i++){
+        chemkit::Atom *a = boost::get<0>(bonds[i]);
+        chemkit::Atom *b = boost::get<1>(bonds[i]);
+        QVERIFY(a->index() < b->index());
+
+        if(i > 0){
+            chemkit::Atom *previousA = boost::get<0>(bonds[i-1]);
+            chemkit::Atom *previousB = boost::get<1>(bonds[i-1]);
+            QVERIFY(previousA->index() < a->index() ||
+                    (previousA == a && previousB->index() < b->index()));
+        }
+    }
+
+    // the same bonds should be predicted with multiple threads
+    predictor.setThreadCount(4);
+    QCOMPARE(predictor.threadCount(), size_t(4));
+    std::vector<chemkit::BondPredictor::PredictedBond> threadedBonds = predictor.predictedBonds();
+    QCOMPARE(threadedBonds.size(), bonds.size());
+    for(size_t i = 0; i < bonds.size(); i++){
+        QVERIFY(boost::get<0>(threadedBonds[i]) == boost::get<0>(bonds[i]));
+        QVERIFY(boost::get<1>(threadedBonds[i]) == boost::get<1>(bonds[i]));
+    }
+}
+
 QTEST_APPLESS_MAIN(BondPredictorTest)
@@ -44,6 +44,7 @@ class BondPredictorTest : public QObject
 
     private slots:
         void predictBonds();
+        void predictedBonds();
 };
 
 #endif // BONDPREDICTORTEST_H
@@ -37,6 +37,7 @@
 
 #include <limits>
 
+#include <chemkit/atom.h>
 #include <chemkit/molecule.h>
 #include <chemkit/coordinatepredictor.h>
 
@@ -85,4 +86,27 @@ void CoordinatePredictorTest::eliminateCloseContacts()
     QVERIFY(modified == false);
 }
 
+void CoordinatePredictorTest::eliminateCloseContactsLarge()
+{
+    // create 1000 carbon atoms packed into a 5 angstrom cube
+    chemkit::Molecule molecule;
+    for(int i = 0; i < 1000; i++){
+        chemkit::Atom *atom = molecule.addAtom(6);
+        atom->setPosition(2.5 * chemkit::Vector3::Random());
+    }
+
+    bool modified = chemkit::CoordinatePredictor::eliminateCloseContacts(&molecule, 1.0);
+    QVERIFY(modified == true);
+
+    // verify that no two atoms are less than one angstrom from each other
+    for(size_t i = 0; i < molecule.size(); i++){
+        for(size_t j = i + 1; j < molecule.size(); j++){
+            QVERIFY(molecule.distance(molecule.atom(i), molecule.atom(j)) >= 1.0);
+        }
+    }
+
+    modified = chemkit::CoordinatePredictor::eliminateCloseContacts(&molecule, 1.0);
+    QVERIFY(modified == false);
+}
+
 QTEST_APPLESS_MAIN(CoordinatePredictorTest)
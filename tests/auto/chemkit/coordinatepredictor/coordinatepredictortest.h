@@ -45,6 +45,7 @@ class CoordinatePredictorTest : public QObject
     private slots:
         void molecule();
         void eliminateCloseContacts();
+        void eliminateCloseContactsLarge();
 };
 
 #endif // COORDINATEPREDICTORTEST_H
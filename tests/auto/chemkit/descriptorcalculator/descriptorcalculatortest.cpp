@@ -0,0 +1,184 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+
+#include "descriptorcalculatortest.h"
+
+#include <sstream>
+
+#include <chemkit/molecule.h>
+#include <chemkit/descriptorcalculator.h>
+
+namespace {
+
+std::vector<boost::shared_ptr<chemkit::Molecule> > createMolecules()
+{
+    const char *formulas[] = { "C", "CCO", "c1ccccc1", "CC(=O)O", "C1CCCCC1N" };
+
+    std::vector<boost::shared_ptr<chemkit::Molecule> > molecules;
+    for(size_t i = 0; i < sizeof(formulas) / sizeof(*formulas); i++){
+        boost::shared_ptr<chemkit::Molecule> molecule(new chemkit::Molecule(formulas[i], "smiles"));
+        molecule->setName(formulas[i]);
+        molecules.push_back(molecule);
+    }
+
+    return molecules;
+}
+
+std::vector<std::string> descriptorNames()
+{
+    std::vector<std::string> descriptors;
+    descriptors.push_back("atom-count");
+    descriptors.push_back("ring-count");
+    descriptors.push_back("wiener-index");
+
+    return descriptors;
+}
+
+} // end anonymous namespace
+
+void DescriptorCalculatorTest::basic()
+{
+    chemkit::DescriptorCalculator calculator(descriptorNames());
+    QCOMPARE(calculator.descriptorCount(), size_t(3));
+    QCOMPARE(calculator.threadCount(), size_t(1));
+    QCOMPARE(calculator.rowCount(), size_t(0));
+
+    std::vector<boost::shared_ptr<chemkit::Molecule> > molecules = createMolecules();
+    QVERIFY(calculator.calculate(molecules));
+    QCOMPARE(calculator.rowCount(), size_t(5));
+    QCOMPARE(calculator.columnCount(), size_t(3));
+    QCOMPARE(calculator.values().size(), size_t(15));
+    QCOMPARE(calculator.name(1), std::string("CCO"));
+
+    // methane
+    QCOMPARE(qRound(calculator.value(0, 0)), 5);
+    QCOMPARE(qRound(calculator.value(0, 1)), 0);
+
+    // benzene
+    QCOMPARE(qRound(calculator.value(2, 0)), 12);
+    QCOMPARE(qRound(calculator.value(2, 1)), 1);
+
+    for(size_t row = 0; row < molecules.size(); row++){
+        QCOMPARE(calculator.value(row, 2), molecules[row]->descriptor("wiener-index").toReal());
+    }
+
+    calculator.clear();
+    QCOMPARE(calculator.rowCount(), size_t(0));
+    QCOMPARE(calculator.descriptorCount(), size_t(3));
+}
+
+void DescriptorCalculatorTest::invalid()
+{
+    chemkit::DescriptorCalculator calculator;
+    QVERIFY(!calculator.calculate(createMolecules()));
+
+    std::vector<std::string> descriptors = descriptorNames();
+    descriptors.push_back("invalid-descriptor");
+    QVERIFY(!calculator.setDescriptors(descriptors));
+    QVERIFY(!calculator.errorString().empty());
+    QCOMPARE(calculator.descriptorCount(), size_t(0));
+
+    // missing molecules result in missing values
+    std::vector<const chemkit::Molecule *> molecules(2);
+    QVERIFY(calculator.setDescriptors(descriptorNames()));
+    QVERIFY(calculator.calculate(molecules));
+    QCOMPARE(calculator.rowCount(), size_t(2));
+    QVERIFY(calculator.value(0, 0) != calculator.value(0, 0));
+}
+
+void DescriptorCalculatorTest::threads()
+{
+    std::vector<boost::shared_ptr<chemkit::Molecule> > molecules;
+    for(int i = 0; i < 10; i++){
+        std::vector<boost::shared_ptr<chemkit::Molecule> > set = createMolecules();
+        molecules.insert(molecules.end(), set.begin(), set.end());
+    }
+
+    chemkit::DescriptorCalculator serial(descriptorNames());
+    QVERIFY(serial.calculate(molecules));
+
+    chemkit::DescriptorCalculator parallel(descriptorNames());
+    parallel.setThreadCount(4);
+    QCOMPARE(parallel.threadCount(), size_t(4));
+    QVERIFY(parallel.calculate(molecules));
+
+    QCOMPARE(parallel.rowCount(), serial.rowCount());
+    QVERIFY(parallel.values() == serial.values());
+}
+
+void DescriptorCalculatorTest::writeCsv()
+{
+    std::vector<std::string> descriptors;
+    descriptors.push_back("atom-count");
+    descriptors.push_back("ring-count");
+
+    chemkit::DescriptorCalculator calculator(descriptors);
+    std::vector<boost::shared_ptr<chemkit::Molecule> > molecules = createMolecules();
+    molecules.resize(3);
+    molecules[1]->setName("ethanol, absolute");
+    QVERIFY(calculator.calculate(molecules));
+
+    std::stringstream output;
+    QVERIFY(calculator.writeCsv(output));
+    QCOMPARE(output.str(), std::string("name,atom-count,ring-count\n"
+                                       "C,5,0\n"
+                                       "\"ethanol, absolute\",9,0\n"
+                                       "c1ccccc1,12,1\n"));
+
+    output.str(std::string());
+    QVERIFY(calculator.writeCsv(output, false));
+    QCOMPARE(output.str().substr(0, 6), std::string("C,5,0\n"));
+}
+
+void DescriptorCalculatorTest::writeBinary()
+{
+    chemkit::DescriptorCalculator calculator(descriptorNames());
+    QVERIFY(calculator.calculate(createMolecules()));
+
+    std::stringstream output;
+    QVERIFY(calculator.writeBinary(output));
+
+    std::string data = output.str();
+    QCOMPARE(data.size(), size_t(24 + 3 * 64 + 5 * 3 * sizeof(double)));
+    QCOMPARE(data.substr(0, 8), std::string("CKDESC01"));
+    QCOMPARE(std::string(data.c_str() + 24 + 64), std::string("ring-count"));
+
+    const double *values = reinterpret_cast<const double *>(data.c_str() + 24 + 3 * 64);
+    QCOMPARE(values[2 * 3 + 0], double(calculator.value(2, 0)));
+    QCOMPARE(values[4 * 3 + 2], double(calculator.value(4, 2)));
+}
+
+QTEST_APPLESS_MAIN(DescriptorCalculatorTest)
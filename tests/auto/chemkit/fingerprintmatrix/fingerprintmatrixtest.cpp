@@ -0,0 +1,102 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+
+#include "fingerprintmatrixtest.h"
+
+#include <chemkit/fingerprint.h>
+#include <chemkit/fingerprintmatrix.h>
+
+void FingerprintMatrixTest::basic()
+{
+    chemkit::FingerprintMatrix empty;
+    QVERIFY(empty.isEmpty());
+    QCOMPARE(empty.rowCount(), size_t(0));
+    QCOMPARE(empty.bitCount(), size_t(0));
+    QCOMPARE(empty.stride(), size_t(0));
+
+    chemkit::FingerprintMatrix matrix(3, 130);
+    QVERIFY(!matrix.isEmpty());
+    QCOMPARE(matrix.rowCount(), size_t(3));
+    QCOMPARE(matrix.bitCount(), size_t(130));
+    QCOMPARE(matrix.stride(), size_t(3));
+
+    // rows are contiguous with a fixed stride
+    QVERIFY(matrix.row(0) == matrix.data());
+    QVERIFY(matrix.row(2) == matrix.data() + 6);
+
+    for(size_t i = 0; i < 3; i++){
+        QCOMPARE(matrix.count(i), size_t(0));
+    }
+}
+
+void FingerprintMatrixTest::value()
+{
+    chemkit::FingerprintMatrix matrix(2, 100);
+    matrix.row(1)[0] = 0x5;
+    matrix.row(1)[1] = boost::uint64_t(1) << 35;
+
+    QVERIFY(!matrix.test(0, 0));
+    QVERIFY(matrix.test(1, 0));
+    QVERIFY(!matrix.test(1, 1));
+    QVERIFY(matrix.test(1, 2));
+    QVERIFY(matrix.test(1, 99));
+    QCOMPARE(matrix.count(0), size_t(0));
+    QCOMPARE(matrix.count(1), size_t(3));
+
+    chemkit::Bitset value = matrix.value(1);
+    QCOMPARE(value.size(), size_t(100));
+    QCOMPARE(value.count(), size_t(3));
+    QVERIFY(value.test(0));
+    QVERIFY(value.test(2));
+    QVERIFY(value.test(99));
+    QCOMPARE(matrix.value(0).count(), size_t(0));
+}
+
+void FingerprintMatrixTest::tanimotoCoefficient()
+{
+    chemkit::FingerprintMatrix matrix(2, 70);
+    matrix.row(0)[0] = 0xf;
+    matrix.row(0)[1] = 0x1;
+    matrix.row(1)[0] = 0x3;
+    matrix.row(1)[1] = 0x3;
+
+    QCOMPARE(matrix.tanimotoCoefficient(0, 0), chemkit::Real(1.0));
+    QCOMPARE(matrix.tanimotoCoefficient(0, 1), chemkit::Real(0.5));
+    QCOMPARE(matrix.tanimotoCoefficient(0, 1),
+             chemkit::Fingerprint::tanimotoCoefficient(matrix.value(0), matrix.value(1)));
+}
+
+QTEST_APPLESS_MAIN(FingerprintMatrixTest)
@@ -47,6 +47,7 @@
 #include <chemkit/polymerfile.h>
 #include <chemkit/moleculefile.h>
 #include <chemkit/molecularsurface.h>
+#include <chemkit/cartesiancoordinates.h>
 
 const std::string dataPath = "../../../data/";
 
@@ -94,6 +95,106 @@ void MolecularSurfaceTest::surfaceType()
     QCOMPARE(surface2.surfaceType(), chemkit::MolecularSurface::SolventAccessible);
 }
 
+void MolecularSurfaceTest::algorithm()
+{
+    chemkit::Molecule molecule;
+    chemkit::MolecularSurface surface(&molecule);
+
+    // ensure default algorithm is exact
+    QCOMPARE(surface.algorithm(), chemkit::MolecularSurface::Exact);
+
+    surface.setAlgorithm(chemkit::MolecularSurface::ShrakeRupley);
+    QCOMPARE(surface.algorithm(), chemkit::MolecularSurface::ShrakeRupley);
+
+    surface.setAlgorithm(chemkit::MolecularSurface::Lcpo);
+    QCOMPARE(surface.algorithm(), chemkit::MolecularSurface::Lcpo);
+}
+
+void MolecularSurfaceTest::spherePointCount()
+{
+    chemkit::Molecule molecule;
+    chemkit::Atom *C1 = molecule.addAtom("C");
+    chemkit::Atom *C2 = molecule.addAtom("C");
+    C2->setPosition(2.0, 0, 0);
+
+    chemkit::MolecularSurface surface(&molecule);
+    surface.setAlgorithm(chemkit::MolecularSurface::ShrakeRupley);
+    QCOMPARE(surface.spherePointCount(), 960);
+    QCOMPARE(qRound(surface.surfaceArea()), 58);
+
+    // fewer points gives a less accurate area
+    surface.setSpherePointCount(92);
+    QCOMPARE(surface.spherePointCount(), 92);
+    QVERIFY(qAbs(surface.surfaceArea() - 58) < 3);
+
+    // a single atom has the area of its sphere for any point count
+    molecule.removeAtom(C1);
+    surface.setMolecule(&molecule);
+    QCOMPARE(qRound(surface.surfaceArea()), 36);
+}
+
+void MolecularSurfaceTest::atomSurfaceAreas()
+{
+    chemkit::MoleculeFile file(dataPath + "adenosine.mol");
+    bool ok = file.read();
+    if(!ok)
+        qDebug() << file.errorString().c_str();
+    QVERIFY(ok);
+
+    const boost::shared_ptr<chemkit::Molecule> molecule = file.molecule();
+    QVERIFY(molecule);
+
+    // shrake-rupley areas are within one percent of the exact areas
+    chemkit::MolecularSurface surface(molecule.get());
+    surface.setAlgorithm(chemkit::MolecularSurface::ShrakeRupley);
+    QCOMPARE(qRound(surface.surfaceArea() / 10), 28);
+
+    surface.setSurfaceType(chemkit::MolecularSurface::SolventAccessible);
+    QCOMPARE(qRound(surface.surfaceArea() / 10), 46);
+
+    std::vector<chemkit::Real> areas = surface.atomSurfaceAreas();
+    QCOMPARE(areas.size(), molecule->size());
+
+    chemkit::Real total = 0;
+    for(size_t i = 0; i < areas.size(); i++){
+        QVERIFY(areas[i] >= 0);
+        QCOMPARE(surface.atomSurfaceArea(i), areas[i]);
+        total += areas[i];
+    }
+    QCOMPARE(qRound(total), qRound(surface.surfaceArea()));
+
+    // lcpo ignores hydrogens
+    surface.setAlgorithm(chemkit::MolecularSurface::Lcpo);
+    QVERIFY(surface.surfaceArea() > 0);
+    for(size_t i = 0; i < molecule->size(); i++){
+        if(molecule->atom(i)->is(chemkit::Atom::Hydrogen)){
+            QCOMPARE(surface.atomSurfaceArea(i), chemkit::Real(0));
+        }
+    }
+}
+
+void MolecularSurfaceTest::coordinates()
+{
+    chemkit::Molecule molecule;
+    molecule.addAtom("O");
+    molecule.addAtom("H")->setPosition(0.96, 0, 0);
+    molecule.addAtom("H")->setPosition(-0.24, 0.93, 0);
+
+    chemkit::MolecularSurface surface(&molecule);
+    surface.setAlgorithm(chemkit::MolecularSurface::ShrakeRupley);
+    chemkit::Real area = surface.surfaceArea();
+
+    // moving the atoms apart exposes their whole spheres
+    chemkit::CartesianCoordinates coordinates(3);
+    coordinates.setPosition(0, chemkit::Point3(0, 0, 0));
+    coordinates.setPosition(1, chemkit::Point3(10, 0, 0));
+    coordinates.setPosition(2, chemkit::Point3(0, 10, 0));
+    surface.setCoordinates(&coordinates);
+    QVERIFY(surface.surfaceArea() > area);
+    QCOMPARE(surface.position(1), chemkit::Point3(10, 0, 0));
+    QCOMPARE(qRound(surface.atomSurfaceArea(1)), 18);
+}
+
 void MolecularSurfaceTest::hydrogen()
 {
     chemkit::Molecule molecule;
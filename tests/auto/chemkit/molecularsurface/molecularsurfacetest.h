@@ -47,6 +47,10 @@ class MolecularSurfaceTest : public QObject
         void molecule();
         void probeRadius();
         void surfaceType();
+        void algorithm();
+        void spherePointCount();
+        void atomSurfaceAreas();
+        void coordinates();
 
         // molecule tests
         void hydrogen();
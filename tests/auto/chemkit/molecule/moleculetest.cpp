@@ -152,6 +152,67 @@ void MoleculeTest::removeAtomIf()
     QCOMPARE(ethanol.formula(), std::string("O"));
 }
 
+void MoleculeTest::removeAtoms()
+{
+    chemkit::Molecule molecule;
+    std::vector<chemkit::Atom *> atoms;
+    for(int i = 0; i < 10; i++){
+        chemkit::Atom *atom = molecule.addAtom(i % 2 ? "O" : "C");
+        atom->setPosition(i, 0, 0);
+        atom->setPartialCharge(i);
+        atoms.push_back(atom);
+    }
+    for(int i = 0; i < 9; i++){
+        molecule.addBond(atoms[i], atoms[i+1], i % 2 ? 1 : 2);
+    }
+
+    // remove every other atom (and duplicates are ignored)
+    std::vector<chemkit::Atom *> oxygens;
+    for(int i = 1; i < 10; i += 2){
+        oxygens.push_back(atoms[i]);
+    }
+    oxygens.push_back(atoms[3]);
+    molecule.removeAtoms(oxygens);
+    QCOMPARE(molecule.size(), size_t(5));
+    QCOMPARE(molecule.bondCount(), size_t(0));
+    QCOMPARE(molecule.formula(), std::string("C5"));
+
+    // remaining atoms keep their properties at their new indices
+    for(size_t i = 0; i < molecule.size(); i++){
+        chemkit::Atom *atom = molecule.atom(i);
+        QVERIFY(atom == atoms[2*i]);
+        QCOMPARE(atom->index(), i);
+        QCOMPARE(atom->x(), chemkit::Real(2*i));
+        QCOMPARE(atom->partialCharge(), chemkit::Real(2*i));
+    }
+
+    // remove atoms with bonds to remaining atoms
+    chemkit::Molecule propanol("CCCO", "smiles");
+    QCOMPARE(propanol.bondCount(), size_t(11));
+    propanol.removeAtoms(std::vector<chemkit::Atom *>(1, propanol.atom(2)));
+    QCOMPARE(propanol.formula(), std::string("C2H8O"));
+    QCOMPARE(propanol.bondCount(), size_t(7));
+    for(size_t i = 0; i < propanol.bondCount(); i++){
+        const chemkit::Bond *bond = propanol.bond(i);
+        QCOMPARE(bond->index(), i);
+        QVERIFY(bond->atom1()->molecule() == &propanol);
+        QVERIFY(bond->atom2()->molecule() == &propanol);
+    }
+}
+
+void MoleculeTest::removeBondIf()
+{
+    chemkit::Molecule ethanol("CCO", "smiles");
+    QCOMPARE(ethanol.bondCount(), size_t(8));
+
+    ethanol.removeBondIf(boost::bind(&chemkit::Bond::isTerminal, _1));
+    QCOMPARE(ethanol.bondCount(), size_t(2));
+    QCOMPARE(ethanol.size(), size_t(9));
+    QCOMPARE(ethanol.bond(0)->index(), size_t(0));
+    QCOMPARE(ethanol.bond(1)->index(), size_t(1));
+    QCOMPARE(ethanol.fragmentCount(), size_t(7));
+}
+
 void MoleculeTest::atom()
 {
     chemkit::Molecule molecule;
@@ -294,6 +355,66 @@ void MoleculeTest::rings()
     QCOMPARE(cyclopropane.ringCount(), size_t(0));
 }
 
+void MoleculeTest::ringsAfterEdit()
+{
+    chemkit::Molecule molecule;
+
+    // cyclopropane
+    chemkit::Atom *A1 = molecule.addAtom("C");
+    chemkit::Atom *A2 = molecule.addAtom("C");
+    chemkit::Atom *A3 = molecule.addAtom("C");
+    molecule.addBond(A1, A2);
+    molecule.addBond(A2, A3);
+    chemkit::Bond *A1_A3 = molecule.addBond(A1, A3);
+
+    // cyclobutane
+    chemkit::Atom *B1 = molecule.addAtom("C");
+    chemkit::Atom *B2 = molecule.addAtom("C");
+    chemkit::Atom *B3 = molecule.addAtom("C");
+    chemkit::Atom *B4 = molecule.addAtom("C");
+    molecule.addBond(B1, B2);
+    molecule.addBond(B2, B3);
+    molecule.addBond(B3, B4);
+    molecule.addBond(B1, B4);
+    QCOMPARE(molecule.ringCount(), size_t(2));
+
+    // join the two rings with a bond
+    chemkit::Bond *A1_B1 = molecule.addBond(A1, B1);
+    QCOMPARE(molecule.ringCount(), size_t(2));
+    QCOMPARE(A1_B1->isInRing(), false);
+
+    // attach a methyl group
+    chemkit::Atom *C1 = molecule.addAtom("C");
+    molecule.addBond(A2, C1);
+    QCOMPARE(molecule.ringCount(), size_t(2));
+
+    // close a ring through the methyl group
+    molecule.addBond(C1, B2);
+    QCOMPARE(molecule.ringCount(), size_t(3));
+
+    // remove the methyl group
+    molecule.removeAtom(C1);
+    QCOMPARE(molecule.ringCount(), size_t(2));
+
+    // split the cyclobutane into two three-membered rings
+    molecule.addBond(B1, B3);
+    QCOMPARE(molecule.ringCount(), size_t(3));
+    QCOMPARE(molecule.ring(0)->size(), size_t(3));
+    QCOMPARE(molecule.ring(1)->size(), size_t(3));
+    QCOMPARE(molecule.ring(2)->size(), size_t(3));
+
+    // break the cyclopropane
+    molecule.removeBond(A1_A3);
+    QCOMPARE(molecule.ringCount(), size_t(2));
+    QCOMPARE(A2->isInRing(), false);
+    QCOMPARE(B3->isInRing(), true);
+
+    // remove the bond between the fragments
+    molecule.removeBond(A1_B1);
+    QCOMPARE(molecule.ringCount(), size_t(2));
+    QCOMPARE(molecule.fragmentCount(), size_t(2));
+}
+
 void MoleculeTest::distance()
 {
     chemkit::Molecule molecule;
@@ -50,12 +50,15 @@ class MoleculeTest : public QObject
         void addAtom();
         void addAtomCopy();
         void removeAtomIf();
+        void removeAtoms();
+        void removeBondIf();
         void atom();
         void addBond();
         void bond();
         void size();
         void isEmpty();
         void rings();
+        void ringsAfterEdit();
         void distance();
         void center();
         void bondAngle();
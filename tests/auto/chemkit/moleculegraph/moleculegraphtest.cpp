@@ -0,0 +1,131 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+#include "moleculegraphtest.h"
+
+#include <chemkit/atom.h>
+#include <chemkit/bond.h>
+#include <chemkit/molecule.h>
+#include <chemkit/moleculegraph.h>
+
+void MoleculeGraphTest::basic()
+{
+    chemkit::MoleculeGraph empty;
+    QCOMPARE(empty.size(), size_t(0));
+    QCOMPARE(empty.edgeCount(), size_t(0));
+    QVERIFY(empty.isEmpty());
+
+    chemkit::Molecule molecule;
+    chemkit::Atom *C1 = molecule.addAtom("C");
+    chemkit::Atom *C2 = molecule.addAtom("C");
+    chemkit::Atom *O3 = molecule.addAtom("O");
+    chemkit::Atom *He4 = molecule.addAtom("He");
+    chemkit::Bond *C1_C2 = molecule.addBond(C1, C2);
+    chemkit::Bond *C2_O3 = molecule.addBond(C2, O3, chemkit::Bond::Double);
+
+    chemkit::MoleculeGraph graph(&molecule);
+    QCOMPARE(graph.size(), size_t(4));
+    QCOMPARE(graph.vertexCount(), size_t(4));
+    QCOMPARE(graph.edgeCount(), size_t(2));
+    QCOMPARE(graph.degree(C1->index()), size_t(1));
+    QCOMPARE(graph.degree(C2->index()), size_t(2));
+    QCOMPARE(graph.degree(O3->index()), size_t(1));
+    QCOMPARE(graph.degree(He4->index()), size_t(0));
+
+    QCOMPARE(graph.neighbor(C2->index(), 0), C1->index());
+    QCOMPARE(graph.neighbor(C2->index(), 1), O3->index());
+    QCOMPARE(graph.bond(C2->index(), 1), C2_O3->index());
+    QCOMPARE(graph.bondOrder(C2->index(), 0), chemkit::Bond::BondOrderType(1));
+    QCOMPARE(graph.bondOrder(C2->index(), 1), chemkit::Bond::BondOrderType(2));
+
+    QCOMPARE(graph.bondBetween(C1->index(), C2->index()), C1_C2->index());
+    QCOMPARE(graph.bondBetween(O3->index(), C2->index()), C2_O3->index());
+    QCOMPARE(graph.bondBetween(C1->index(), O3->index()), chemkit::MoleculeGraph::npos);
+    QCOMPARE(graph.isAdjacent(C1->index(), C2->index()), true);
+    QCOMPARE(graph.isAdjacent(C1->index(), He4->index()), false);
+}
+
+void MoleculeGraphTest::subgraph()
+{
+    chemkit::Molecule ethanol("CCO", "smiles");
+    QCOMPARE(ethanol.atomCount(), size_t(9));
+
+    std::vector<chemkit::Atom *> heavyAtoms;
+    foreach(chemkit::Atom *atom, ethanol.atoms()){
+        if(!atom->is(chemkit::Atom::Hydrogen)){
+            heavyAtoms.push_back(atom);
+        }
+    }
+
+    chemkit::MoleculeGraph graph(heavyAtoms);
+    QCOMPARE(graph.size(), size_t(3));
+    QCOMPARE(graph.edgeCount(), size_t(2));
+    QCOMPARE(graph.degree(0), size_t(1));
+    QCOMPARE(graph.degree(1), size_t(2));
+    QCOMPARE(graph.degree(2), size_t(1));
+    QCOMPARE(graph.isAdjacent(0, 1), true);
+    QCOMPARE(graph.isAdjacent(0, 2), false);
+
+    chemkit::Bond *bond = ethanol.bond(graph.bondBetween(1, 2));
+    QVERIFY(bond->contains(heavyAtoms[1]));
+    QVERIFY(bond->contains(heavyAtoms[2]));
+}
+
+void MoleculeGraphTest::invalidate()
+{
+    chemkit::Molecule molecule;
+    chemkit::Atom *C1 = molecule.addAtom("C");
+    chemkit::Atom *C2 = molecule.addAtom("C");
+    QCOMPARE(molecule.graph()->size(), size_t(2));
+    QCOMPARE(molecule.graph()->edgeCount(), size_t(0));
+
+    chemkit::Bond *bond = molecule.addBond(C1, C2);
+    QCOMPARE(molecule.graph()->edgeCount(), size_t(1));
+    QCOMPARE(molecule.graph()->bondOrder(0, 0), chemkit::Bond::BondOrderType(1));
+
+    bond->setOrder(chemkit::Bond::Triple);
+    QCOMPARE(molecule.graph()->bondOrder(0, 0), chemkit::Bond::BondOrderType(3));
+
+    molecule.removeBond(bond);
+    QCOMPARE(molecule.graph()->edgeCount(), size_t(0));
+
+    molecule.addAtom("N");
+    QCOMPARE(molecule.graph()->size(), size_t(3));
+
+    molecule.clear();
+    QCOMPARE(molecule.graph()->size(), size_t(0));
+}
+
+QTEST_APPLESS_MAIN(MoleculeGraphTest)
@@ -35,9 +35,21 @@
 
 #include "moleculewatchertest.h"
 
+#include <boost/bind.hpp>
+
+#include <chemkit/atom.h>
 #include <chemkit/molecule.h>
 #include <chemkit/moleculewatcher.h>
 
+namespace {
+
+void count(int *counter)
+{
+    (*counter)++;
+}
+
+} // end anonymous namespace
+
 void MoleculeWatcherTest::molecule()
 {
     chemkit::Molecule molecule;
@@ -51,4 +63,27 @@ void MoleculeWatcherTest::molecule()
     QVERIFY(watcher.molecule() == 0);
 }
 
+void MoleculeWatcherTest::atomsRemoved()
+{
+    chemkit::Molecule molecule("CCO", "smiles");
+    chemkit::MoleculeWatcher watcher(&molecule);
+
+    int atomsRemovedCount = 0;
+    int atomRemovedCount = 0;
+    int bondsRemovedCount = 0;
+    int bondRemovedCount = 0;
+    watcher.atomsRemoved.connect(boost::bind(count, &atomsRemovedCount));
+    watcher.atomRemoved.connect(boost::bind(count, &atomRemovedCount));
+    watcher.bondsRemoved.connect(boost::bind(count, &bondsRemovedCount));
+    watcher.bondRemoved.connect(boost::bind(count, &bondRemovedCount));
+
+    // removing several atoms sends one notification for the atoms
+    // and one for their bonds
+    molecule.removeAtomIf(boost::bind(&chemkit::Atom::isTerminalHydrogen, _1));
+    QCOMPARE(atomsRemovedCount, 1);
+    QCOMPARE(atomRemovedCount, 6);
+    QCOMPARE(bondsRemovedCount, 1);
+    QCOMPARE(bondRemovedCount, 6);
+}
+
 QTEST_APPLESS_MAIN(MoleculeWatcherTest)
@@ -44,6 +44,7 @@ class MoleculeWatcherTest : public QObject
 
     private slots:
         void molecule();
+        void atomsRemoved();
 };
 
 #endif // MOLECULEWATCHERTEST_H
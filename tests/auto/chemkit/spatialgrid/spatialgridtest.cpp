@@ -0,0 +1,149 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+#include "spatialgridtest.h"
+
+#include <chemkit/vector3.h>
+#include <chemkit/spatialgrid.h>
+
+namespace {
+
+// returns the indices of the positions within distance of point
+// other than exclude by checking every position
+std::vector<size_t> bruteForceNeighbors(const std::vector<chemkit::Point3> &positions,
+                                        const chemkit::Point3 &point,
+                                        chemkit::Real distance,
+                                        size_t exclude = static_cast<size_t>(-1))
+{
+    std::vector<size_t> neighbors;
+
+    for(size_t i = 0; i < positions.size(); i++){
+        if(i != exclude && (positions[i] - point).norm() <= distance){
+            neighbors.push_back(i);
+        }
+    }
+
+    return neighbors;
+}
+
+// returns count random positions inside a cube with sides of length size
+std::vector<chemkit::Point3> randomPositions(size_t count, chemkit::Real size)
+{
+    std::vector<chemkit::Point3> positions;
+
+    for(size_t i = 0; i < count; i++){
+        chemkit::Vector3 random = chemkit::Vector3::Random();
+        positions.push_back(chemkit::Point3(0.5 * size * (random.x() + 1),
+                                            0.5 * size * (random.y() + 1),
+                                            0.5 * size * (random.z() + 1)));
+    }
+
+    return positions;
+}
+
+} // end anonymous namespace
+
+void SpatialGridTest::basic()
+{
+    chemkit::SpatialGrid grid;
+    QCOMPARE(grid.size(), size_t(0));
+    QCOMPARE(grid.isEmpty(), true);
+    QCOMPARE(grid.cellSize(), chemkit::Real(1.0));
+    QVERIFY(grid.neighbors(chemkit::Point3(0, 0, 0), 10.0).empty());
+
+    std::vector<chemkit::Point3> positions;
+    positions.push_back(chemkit::Point3(0, 0, 0));
+    positions.push_back(chemkit::Point3(1, 0, 0));
+    positions.push_back(chemkit::Point3(5, 0, 0));
+    grid.setPositions(positions);
+    QCOMPARE(grid.size(), size_t(3));
+    QCOMPARE(grid.isEmpty(), false);
+    QVERIFY(grid.position(2) == chemkit::Point3(5, 0, 0));
+
+    std::vector<size_t> neighbors = grid.neighbors(size_t(0), 2.0);
+    QCOMPARE(neighbors.size(), size_t(1));
+    QCOMPARE(neighbors[0], size_t(1));
+
+    neighbors = grid.neighbors(chemkit::Point3(0.5, 0, 0), 5.0);
+    QCOMPARE(neighbors.size(), size_t(3));
+    QCOMPARE(neighbors[0], size_t(0));
+    QCOMPARE(neighbors[1], size_t(1));
+    QCOMPARE(neighbors[2], size_t(2));
+
+    grid.clear();
+    QCOMPARE(grid.size(), size_t(0));
+    QCOMPARE(grid.isEmpty(), true);
+}
+
+void SpatialGridTest::neighbors()
+{
+    std::vector<chemkit::Point3> positions = randomPositions(500, 20.0);
+    chemkit::SpatialGrid grid(positions, 2.0);
+    QCOMPARE(grid.size(), size_t(500));
+
+    // distances smaller and larger than the cell size
+    chemkit::Real distances[] = { 1.0, 2.0, 4.5 };
+
+    for(int k = 0; k < 3; k++){
+        for(size_t i = 0; i < positions.size(); i += 7){
+            QVERIFY(grid.neighbors(i, distances[k]) == bruteForceNeighbors(positions, positions[i], distances[k], i));
+        }
+
+        // points outside of the grid
+        chemkit::Point3 point(-3, 25, 10);
+        QVERIFY(grid.neighbors(point, distances[k]) == bruteForceNeighbors(positions, point, distances[k]));
+    }
+}
+
+void SpatialGridTest::setPosition()
+{
+    std::vector<chemkit::Point3> positions = randomPositions(300, 15.0);
+    chemkit::SpatialGrid grid(positions, 2.0);
+
+    // move points within and outside of the grid
+    std::vector<chemkit::Point3> newPositions = randomPositions(300, 30.0);
+    for(size_t i = 0; i < positions.size(); i += 2){
+        positions[i] = newPositions[i] - chemkit::Vector3(7.5, 7.5, 7.5);
+        grid.setPosition(i, positions[i]);
+        QVERIFY(grid.position(i) == positions[i]);
+    }
+
+    for(size_t i = 0; i < positions.size(); i += 3){
+        QVERIFY(grid.neighbors(i, 2.0) == bruteForceNeighbors(positions, positions[i], 2.0, i));
+        QVERIFY(grid.neighbors(i, 5.0) == bruteForceNeighbors(positions, positions[i], 5.0, i));
+    }
+}
+
+QTEST_APPLESS_MAIN(SpatialGridTest)
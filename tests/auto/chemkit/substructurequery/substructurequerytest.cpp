@@ -301,4 +301,37 @@ void SubstructureQueryTest::find()
     QCOMPARE(carboxylMoiety.isEmpty(), true);
 }
 
+void SubstructureQueryTest::screening()
+{
+    boost::shared_ptr<chemkit::Molecule> ethane = boost::make_shared<chemkit::Molecule>("CC", "smiles");
+    boost::shared_ptr<chemkit::Molecule> butadiene = boost::make_shared<chemkit::Molecule>("C=CC=C", "smiles");
+    boost::shared_ptr<chemkit::Molecule> benzene = boost::make_shared<chemkit::Molecule>("c1ccccc1", "smiles");
+    boost::shared_ptr<chemkit::Molecule> phenol = boost::make_shared<chemkit::Molecule>("c1ccccc1O", "smiles");
+
+    chemkit::SubstructureQuery query(butadiene);
+    QCOMPARE(query.isScreeningEnabled(), false);
+    query.setScreeningEnabled(true);
+    QCOMPARE(query.isScreeningEnabled(), true);
+
+    // screening must not reject molecules which match
+    QCOMPARE(query.matches(benzene.get()), true);
+    QCOMPARE(query.matches(phenol.get()), true);
+    QCOMPARE(query.matches(ethane.get()), false);
+    QCOMPARE(query.screenedCount(), size_t(3));
+    QCOMPARE(query.screenedOutCount(), size_t(1));
+
+    query.resetScreeningStatistics();
+    QCOMPARE(query.screenedCount(), size_t(0));
+    QCOMPARE(query.screenedOutCount(), size_t(0));
+
+    // precomputed fingerprints
+    query.setMolecule(phenol);
+    chemkit::Bitset benzeneFingerprint = chemkit::SubstructureQuery::screeningFingerprint(benzene.get());
+    chemkit::Bitset phenolFingerprint = chemkit::SubstructureQuery::screeningFingerprint(phenol.get());
+    QCOMPARE(query.matches(benzene.get(), benzeneFingerprint), false);
+    QCOMPARE(query.matches(phenol.get(), phenolFingerprint), true);
+    QCOMPARE(query.screenedCount(), size_t(2));
+    QCOMPARE(query.screenedOutCount(), size_t(1));
+}
+
 QTEST_APPLESS_MAIN(SubstructureQueryTest)
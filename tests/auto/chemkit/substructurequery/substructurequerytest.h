@@ -48,6 +48,7 @@ class SubstructureQueryTest : public QObject
         void maximumMapping();
         void matches();
         void find();
+        void screening();
 };
 
 #endif // SUBSTRUCTUREQUERYTEST_H
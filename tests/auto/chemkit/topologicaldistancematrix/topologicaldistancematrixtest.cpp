@@ -0,0 +1,159 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+#include "topologicaldistancematrixtest.h"
+
+#include <chemkit/atom.h>
+#include <chemkit/bond.h>
+#include <chemkit/molecule.h>
+#include <chemkit/topologicaldistancematrix.h>
+
+void TopologicalDistanceMatrixTest::basic()
+{
+    chemkit::Molecule molecule;
+    chemkit::Atom *C1 = molecule.addAtom("C");
+    chemkit::Atom *C2 = molecule.addAtom("C");
+    chemkit::Atom *C3 = molecule.addAtom("C");
+    chemkit::Atom *O4 = molecule.addAtom("O");
+    chemkit::Atom *He5 = molecule.addAtom("He");
+    molecule.addBond(C1, C2);
+    molecule.addBond(C2, C3);
+    molecule.addBond(C3, O4);
+    molecule.addBond(O4, C1);
+
+    chemkit::TopologicalDistanceMatrix matrix(&molecule);
+    QCOMPARE(matrix.size(), size_t(5));
+    QVERIFY(!matrix.isEmpty());
+    QCOMPARE(matrix.distance(C1, C1), size_t(0));
+    QCOMPARE(matrix.distance(C1, C2), size_t(1));
+    QCOMPARE(matrix.distance(C1, C3), size_t(2));
+    QCOMPARE(matrix.distance(C3, C1), size_t(2));
+    QCOMPARE(matrix.distance(C1, O4), size_t(1));
+    QCOMPARE(matrix.distance(C2, O4), size_t(2));
+    QCOMPARE(matrix.distance(C1, He5), chemkit::TopologicalDistanceMatrix::npos);
+    QCOMPARE(matrix.distance(He5, He5), size_t(0));
+}
+
+void TopologicalDistanceMatrixTest::hydrogens()
+{
+    chemkit::Molecule propane("CCC", "smiles");
+    QCOMPARE(propane.size(), size_t(11));
+
+    const chemkit::TopologicalDistanceMatrix *matrix = propane.topologicalDistanceMatrix();
+    QCOMPARE(matrix->size(), size_t(11));
+
+    // compare against a breadth-first search from each atom
+    for(size_t i = 0; i < propane.size(); i++){
+        std::vector<size_t> distances(propane.size(), chemkit::TopologicalDistanceMatrix::npos);
+        std::vector<const chemkit::Atom *> row(1, propane.atom(i));
+        distances[i] = 0;
+
+        for(size_t distance = 1; !row.empty(); distance++){
+            std::vector<const chemkit::Atom *> nextRow;
+
+            foreach(const chemkit::Atom *atom, row){
+                foreach(const chemkit::Atom *neighbor, atom->neighbors()){
+                    if(distances[neighbor->index()] == chemkit::TopologicalDistanceMatrix::npos){
+                        distances[neighbor->index()] = distance;
+                        nextRow.push_back(neighbor);
+                    }
+                }
+            }
+
+            row = nextRow;
+        }
+
+        for(size_t j = 0; j < propane.size(); j++){
+            QCOMPARE(matrix->distance(i, j), distances[j]);
+        }
+    }
+
+    // hydrogen molecule
+    chemkit::Molecule hydrogen;
+    chemkit::Atom *H1 = hydrogen.addAtom("H");
+    chemkit::Atom *H2 = hydrogen.addAtom("H");
+    hydrogen.addBond(H1, H2);
+    QCOMPARE(hydrogen.topologicalDistanceMatrix()->distance(H1, H2), size_t(1));
+}
+
+void TopologicalDistanceMatrixTest::invalidate()
+{
+    chemkit::Molecule molecule;
+    chemkit::Atom *C1 = molecule.addAtom("C");
+    chemkit::Atom *C2 = molecule.addAtom("C");
+    chemkit::Atom *C3 = molecule.addAtom("C");
+    molecule.addBond(C1, C2);
+    chemkit::Bond *C2_C3 = molecule.addBond(C2, C3);
+    QCOMPARE(molecule.topologicalDistanceMatrix()->distance(C1, C3), size_t(2));
+
+    molecule.addBond(C1, C3);
+    QCOMPARE(molecule.topologicalDistanceMatrix()->distance(C1, C3), size_t(1));
+
+    molecule.removeBond(C2_C3);
+    molecule.removeAtom(C1);
+    QCOMPARE(molecule.topologicalDistanceMatrix()->size(), size_t(2));
+    QCOMPARE(molecule.topologicalDistanceMatrix()->distance(C2, C3), chemkit::TopologicalDistanceMatrix::npos);
+}
+
+void TopologicalDistanceMatrixTest::largeMolecule()
+{
+    // a chain of 300 carbons is too long to store its distances
+    // in eight bits
+    chemkit::Molecule molecule;
+    chemkit::Atom *previous = molecule.addAtom("C");
+    for(size_t i = 1; i < 300; i++){
+        chemkit::Atom *atom = molecule.addAtom("C");
+        molecule.addBond(previous, atom);
+        previous = atom;
+    }
+
+    // terminal hydrogen on the last carbon and a disconnected atom
+    chemkit::Atom *H300 = molecule.addAtom("H");
+    molecule.addBond(previous, H300);
+    chemkit::Atom *He301 = molecule.addAtom("He");
+
+    chemkit::TopologicalDistanceMatrix matrix(&molecule);
+    QCOMPARE(matrix.size(), size_t(302));
+    QCOMPARE(matrix.distance(0, 1), size_t(1));
+    QCOMPARE(matrix.distance(0, 255), size_t(255));
+    QCOMPARE(matrix.distance(0, 299), size_t(299));
+    QCOMPARE(matrix.distance(299, 0), size_t(299));
+    QCOMPARE(matrix.distance(0, 300), size_t(300));
+    QCOMPARE(matrix.distance(0, 301), chemkit::TopologicalDistanceMatrix::npos);
+    QCOMPARE(matrix.distance(H300, He301), chemkit::TopologicalDistanceMatrix::npos);
+    QCOMPARE(matrix.distance(He301, He301), size_t(0));
+}
+
+QTEST_APPLESS_MAIN(TopologicalDistanceMatrixTest)
@@ -0,0 +1,192 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+#include "fingerprintdatabasetest.h"
+
+#include <algorithm>
+#include <functional>
+
+#include <boost/scoped_ptr.hpp>
+
+#include <chemkit/molecule.h>
+#include <chemkit/fingerprint.h>
+#include <chemkit/moleculefile.h>
+#include <chemkit/fingerprintdatabase.h>
+
+const std::string dataPath = "../../../data/";
+
+void FingerprintDatabaseTest::create()
+{
+    chemkit::MoleculeFile input(dataPath + "pubchem_416_benzenes.sdf");
+    QVERIFY(input.beginRead());
+
+    chemkit::FingerprintDatabase database;
+    QVERIFY(database.isOpen() == false);
+    QVERIFY(database.isEmpty());
+
+    QVERIFY(database.create("pubchem_416_benzenes.ckfp", &input, "fp2"));
+    QVERIFY(database.isOpen());
+    QCOMPARE(database.size(), size_t(416));
+    QCOMPARE(database.fingerprintName(), std::string("fp2"));
+    QCOMPARE(database.fingerprintSize(), size_t(1021));
+
+    // records are stored in input order
+    chemkit::MoleculeFile file(dataPath + "pubchem_416_benzenes.sdf");
+    QVERIFY(file.read());
+
+    boost::scoped_ptr<chemkit::Fingerprint> fp2(chemkit::Fingerprint::create("fp2"));
+    for(size_t i = 0; i < file.moleculeCount(); i++){
+        QCOMPARE(database.name(i), file.molecule(i)->name());
+        QVERIFY(database.fingerprint(i) == fp2->value(file.molecule(i).get()));
+    }
+
+    // reopen
+    database.close();
+    QVERIFY(database.isOpen() == false);
+    QVERIFY(database.open("pubchem_416_benzenes.ckfp"));
+    QCOMPARE(database.size(), size_t(416));
+    QCOMPARE(database.name(0), file.molecule(0)->name());
+}
+
+void FingerprintDatabaseTest::search()
+{
+    chemkit::FingerprintDatabase database("pubchem_416_benzenes.ckfp");
+    QVERIFY(database.isOpen());
+
+    chemkit::MoleculeFile file(dataPath + "pubchem_416_benzenes.sdf");
+    QVERIFY(file.read());
+
+    boost::scoped_ptr<chemkit::Fingerprint> fp2(chemkit::Fingerprint::create("fp2"));
+
+    for(size_t i = 0; i < file.moleculeCount(); i += 13){
+        chemkit::Bitset query = fp2->value(file.molecule(i).get());
+
+        std::vector<chemkit::FingerprintDatabase::Hit> hits = database.search(query, 10);
+        QCOMPARE(hits.size(), size_t(10));
+
+        // a molecule is most similar to itself
+        QCOMPARE(hits[0].second, chemkit::Real(1.0));
+
+        // compare with the similarity to every molecule
+        std::vector<chemkit::Real> similarities;
+        for(size_t j = 0; j < file.moleculeCount(); j++){
+            similarities.push_back(chemkit::Fingerprint::tanimotoCoefficient(query, fp2->value(file.molecule(j).get())));
+        }
+
+        std::vector<chemkit::Real> sorted = similarities;
+        std::sort(sorted.begin(), sorted.end(), std::greater<chemkit::Real>());
+
+        for(size_t k = 0; k < hits.size(); k++){
+            QCOMPARE(hits[k].second, sorted[k]);
+            QCOMPARE(hits[k].second, similarities[hits[k].first]);
+        }
+    }
+
+    // threshold limits the number of hits
+    chemkit::Bitset query = fp2->value(file.molecule(0).get());
+    std::vector<chemkit::FingerprintDatabase::Hit> hits = database.search(query, 416, 0.5);
+    QVERIFY(hits.size() < 416);
+    QVERIFY(hits.back().second >= 0.5);
+}
+
+void FingerprintDatabaseTest::thresholdSearch()
+{
+    chemkit::FingerprintDatabase database("pubchem_416_benzenes.ckfp");
+    QVERIFY(database.isOpen());
+
+    chemkit::MoleculeFile file(dataPath + "pubchem_416_benzenes.sdf");
+    QVERIFY(file.read());
+
+    boost::scoped_ptr<chemkit::Fingerprint> fp2(chemkit::Fingerprint::create("fp2"));
+
+    for(size_t i = 0; i < file.moleculeCount(); i += 13){
+        chemkit::Bitset query = fp2->value(file.molecule(i).get());
+
+        size_t expected = 0;
+        for(size_t j = 0; j < file.moleculeCount(); j++){
+            if(chemkit::Fingerprint::tanimotoCoefficient(query, fp2->value(file.molecule(j).get())) >= 0.6){
+                expected++;
+            }
+        }
+
+        std::vector<chemkit::FingerprintDatabase::Hit> hits = database.thresholdSearch(query, 0.6);
+        QCOMPARE(hits.size(), expected);
+        QCOMPARE(database.search(query, 416, 0.6) == hits, true);
+    }
+}
+
+void FingerprintDatabaseTest::emptyFingerprint()
+{
+    chemkit::MoleculeFile output("empty_fingerprint.sdf");
+    boost::shared_ptr<chemkit::Molecule> phenol(new chemkit::Molecule("c1ccccc1O", "smiles"));
+    phenol->setName("phenol");
+    output.addMolecule(phenol);
+    boost::shared_ptr<chemkit::Molecule> methane(new chemkit::Molecule("C", "smiles"));
+    methane->setName("methane");
+    output.addMolecule(methane);
+    QVERIFY(output.write());
+
+    chemkit::MoleculeFile input("empty_fingerprint.sdf");
+    QVERIFY(input.beginRead());
+
+    chemkit::FingerprintDatabase database;
+    QVERIFY(database.create("empty_fingerprint.ckfp", &input, "fp2"));
+    QCOMPARE(database.size(), size_t(2));
+
+    // methane has no bits set in its fp2 fingerprint
+    QCOMPARE(database.fingerprint(1).count(), size_t(0));
+
+    // with a zero threshold every record is a hit, including the
+    // record with an empty fingerprint
+    chemkit::Bitset query = database.fingerprint(0);
+    std::vector<chemkit::FingerprintDatabase::Hit> hits = database.thresholdSearch(query, 0);
+    QCOMPARE(hits.size(), size_t(2));
+    QCOMPARE(hits[1].first, size_t(1));
+    QCOMPARE(hits[1].second, chemkit::Real(0));
+    QCOMPARE(database.search(query, 2, 0) == hits, true);
+}
+
+void FingerprintDatabaseTest::invalidFile()
+{
+    chemkit::FingerprintDatabase database;
+    QCOMPARE(database.open("missing.ckfp"), false);
+    QVERIFY(!database.errorString().empty());
+    QVERIFY(database.isOpen() == false);
+
+    QCOMPARE(database.open(dataPath + "benzene.xyz"), false);
+    QVERIFY(database.isOpen() == false);
+}
+
+QTEST_APPLESS_MAIN(FingerprintDatabaseTest)
@@ -40,6 +40,7 @@
 #include <chemkit/chemkit.h>
 #include <chemkit/molecule.h>
 #include <chemkit/forcefield.h>
+#include <chemkit/threadpool.h>
 
 #include "mockforcefield.h"
 
@@ -68,6 +69,20 @@ void ForceFieldTest::name()
     delete forceField;
 }
 
+void ForceFieldTest::threadCount()
+{
+    chemkit::ForceField *forceField = chemkit::ForceField::create("mock");
+    QCOMPARE(forceField->threadCount(), size_t(1));
+
+    forceField->setThreadCount(4);
+    QCOMPARE(forceField->threadCount(), size_t(4));
+
+    forceField->setThreadCount(0);
+    QCOMPARE(forceField->threadCount(), chemkit::ThreadPool::idealThreadCount());
+
+    delete forceField;
+}
+
 void ForceFieldTest::cleanupTestCase()
 {
     delete m_plugin;
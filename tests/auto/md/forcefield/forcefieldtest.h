@@ -51,6 +51,7 @@ class ForceFieldTest : public QObject
         void initTestCase();
         void create();
         void name();
+        void threadCount();
         void cleanupTestCase();
 };
 
@@ -82,4 +82,37 @@ void MoleculeGeometryOptimizerTest::water()
     QCOMPARE(qRound(molecule.bondAngle(H2, O1, H3)), 104);
 }
 
+void MoleculeGeometryOptimizerTest::algorithm()
+{
+    chemkit::MoleculeGeometryOptimizer::Algorithm algorithms[] = {
+        chemkit::MoleculeGeometryOptimizer::SteepestDescent,
+        chemkit::MoleculeGeometryOptimizer::ConjugateGradient,
+        chemkit::MoleculeGeometryOptimizer::Lbfgs
+    };
+
+    for(int i = 0; i < 3; i++){
+        chemkit::Molecule molecule;
+        chemkit::Atom *O1 = molecule.addAtom("O");
+        chemkit::Atom *H2 = molecule.addAtom("H");
+        chemkit::Atom *H3 = molecule.addAtom("H");
+        molecule.addBond(O1, H2);
+        molecule.addBond(O1, H3);
+
+        O1->setPosition(0, 0, 0);
+        H2->setPosition(0, 1, 0);
+        H3->setPosition(1, 0, 0);
+
+        chemkit::MoleculeGeometryOptimizer optimizer(&molecule);
+        optimizer.setAlgorithm(algorithms[i]);
+        QVERIFY(optimizer.algorithm() == algorithms[i]);
+        optimizer.setGradientTolerance(0.01);
+        QCOMPARE(optimizer.gradientTolerance(), chemkit::Real(0.01));
+        QVERIFY(optimizer.optimize());
+
+        // uff minimum is at approximately 104.5 degrees
+        QVERIFY(qAbs(molecule.bondAngle(H2, O1, H3) - 104.5) < 0.5);
+        QCOMPARE(qRound(molecule.distance(O1, H2) * 100), qRound(molecule.distance(O1, H3) * 100));
+    }
+}
+
 QTEST_APPLESS_MAIN(MoleculeGeometryOptimizerTest)
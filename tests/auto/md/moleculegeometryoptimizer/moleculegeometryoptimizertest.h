@@ -45,6 +45,7 @@ class MoleculeGeometryOptimizerTest : public QObject
     private slots:
         void molecule();
         void water();
+        void algorithm();
 };
 
 #endif // MOLECULEGEOMTRYOPTIMIZERTEST_H
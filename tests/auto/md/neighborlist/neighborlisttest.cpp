@@ -0,0 +1,158 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+#include "neighborlisttest.h"
+
+#include <chemkit/neighborlist.h>
+#include <chemkit/cartesiancoordinates.h>
+
+// Returns coordinates for a cubic lattice with n points on each side.
+chemkit::CartesianCoordinates* lattice(size_t n, chemkit::Real spacing)
+{
+    chemkit::CartesianCoordinates *coordinates = new chemkit::CartesianCoordinates;
+
+    for(size_t i = 0; i < n; i++){
+        for(size_t j = 0; j < n; j++){
+            for(size_t k = 0; k < n; k++){
+                coordinates->append(i * spacing, j * spacing, k * spacing);
+            }
+        }
+    }
+
+    return coordinates;
+}
+
+void NeighborListTest::cutoff()
+{
+    chemkit::NeighborList list;
+    QCOMPARE(list.size(), size_t(0));
+    QCOMPARE(list.cutoff(), chemkit::Real(0));
+    QCOMPARE(list.skin(), chemkit::Real(0));
+
+    list.setCutoff(8.0);
+    QCOMPARE(list.cutoff(), chemkit::Real(8.0));
+
+    list.setSkin(1.5);
+    QCOMPARE(list.skin(), chemkit::Real(1.5));
+
+    chemkit::NeighborList list2(10, 12.0, 2.0);
+    QCOMPARE(list2.size(), size_t(10));
+    QCOMPARE(list2.cutoff(), chemkit::Real(12.0));
+    QCOMPARE(list2.skin(), chemkit::Real(2.0));
+}
+
+void NeighborListTest::exclusions()
+{
+    chemkit::CartesianCoordinates *coordinates = lattice(2, 1.0);
+
+    chemkit::NeighborList list(8, 0, 0);
+    list.update(coordinates);
+    QCOMPARE(list.pairCount(), size_t(28));
+
+    list.addExclusion(0, 1);
+    list.addExclusion(3, 2);
+    list.addExclusion(2, 3);
+    QVERIFY(list.isExcluded(0, 1));
+    QVERIFY(list.isExcluded(1, 0));
+    QVERIFY(list.isExcluded(2, 3));
+    QVERIFY(!list.isExcluded(0, 2));
+
+    list.update(coordinates);
+    QCOMPARE(list.pairCount(), size_t(26));
+
+    list.clearExclusions();
+    QVERIFY(!list.isExcluded(0, 1));
+    list.update(coordinates);
+    QCOMPARE(list.pairCount(), size_t(28));
+
+    delete coordinates;
+}
+
+void NeighborListTest::pairs()
+{
+    chemkit::CartesianCoordinates *coordinates = lattice(8, 1.5);
+    QCOMPARE(coordinates->size(), size_t(512));
+
+    chemkit::NeighborList list(coordinates->size(), 3.0, 1.0);
+    list.addExclusion(0, 1);
+    list.update(coordinates);
+
+    // compare with every pair within the cutoff plus the skin
+    std::vector<chemkit::NeighborList::Pair> expected;
+    for(size_t i = 0; i < coordinates->size(); i++){
+        for(size_t j = i + 1; j < coordinates->size(); j++){
+            if(coordinates->distance(i, j) <= 4.0 && !(i == 0 && j == 1)){
+                chemkit::NeighborList::Pair pair = {{ i, j }};
+                expected.push_back(pair);
+            }
+        }
+    }
+
+    QCOMPARE(list.pairCount(), expected.size());
+    QVERIFY(std::equal(list.pairs().begin(), list.pairs().end(), expected.begin()));
+
+    delete coordinates;
+}
+
+void NeighborListTest::update()
+{
+    chemkit::CartesianCoordinates *coordinates = lattice(4, 1.5);
+
+    chemkit::NeighborList list(coordinates->size(), 3.0, 1.0);
+    QVERIFY(list.needsRebuild(coordinates));
+    QCOMPARE(list.update(coordinates), true);
+    QCOMPARE(list.rebuildCount(), size_t(1));
+
+    // moving an atom less than half of the skin distance
+    QCOMPARE(list.update(coordinates), false);
+    (*coordinates)[0] += chemkit::Vector3(0.4, 0, 0);
+    QCOMPARE(list.update(coordinates), false);
+    QCOMPARE(list.rebuildCount(), size_t(1));
+
+    // moving an atom more than half of the skin distance
+    (*coordinates)[0] += chemkit::Vector3(0.2, 0, 0);
+    QVERIFY(list.needsRebuild(coordinates));
+    QCOMPARE(list.update(coordinates), true);
+    QCOMPARE(list.rebuildCount(), size_t(2));
+
+    // changing the cutoff requires a rebuild
+    list.setCutoff(4.0);
+    QCOMPARE(list.update(coordinates), true);
+    QCOMPARE(list.rebuildCount(), size_t(3));
+
+    delete coordinates;
+}
+
+QTEST_APPLESS_MAIN(NeighborListTest)
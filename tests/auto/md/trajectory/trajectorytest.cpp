@@ -0,0 +1,97 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+
+#include "trajectorytest.h"
+
+#include <boost/make_shared.hpp>
+
+#include <chemkit/trajectory.h>
+#include <chemkit/trajectoryframe.h>
+#include <chemkit/trajectoryframesource.h>
+
+// A frame source with three frames which fails to read frame 1.
+class FailingFrameSource : public chemkit::TrajectoryFrameSource
+{
+public:
+    size_t frameCount() const
+    {
+        return 3;
+    }
+
+    bool readFrame(size_t index, chemkit::TrajectoryFrame *frame)
+    {
+        if(index == 1){
+            return false;
+        }
+
+        frame->setTime(index);
+        frame->setPosition(1, chemkit::Point3(1, 2, 3));
+        return true;
+    }
+};
+
+void TrajectoryTest::frameSourceError()
+{
+    chemkit::Trajectory trajectory(2);
+    trajectory.setFrameSource(boost::make_shared<FailingFrameSource>());
+    QCOMPARE(trajectory.frameCount(), size_t(3));
+    QCOMPARE(trajectory.cachedFrameCount(), size_t(1));
+    QVERIFY(trajectory.errorString().empty());
+
+    chemkit::TrajectoryFrame *frame = trajectory.frame(0);
+    QVERIFY(frame != 0);
+    QVERIFY(frame->position(1) == chemkit::Point3(1, 2, 3));
+
+    // the failed frame is not cached or returned
+    QVERIFY(trajectory.frame(1) == 0);
+    QVERIFY(!trajectory.errorString().empty());
+    QCOMPARE(trajectory.cachedFrameCount(), size_t(1));
+
+    // accessing the failed frame directly returns default values
+    frame = trajectory.frames()[1];
+    QVERIFY(frame->position(1) == chemkit::Point3(0, 0, 0));
+    QVERIFY(frame->coordinates() == 0);
+    QVERIFY(frame->unitCell() == 0);
+    QCOMPARE(trajectory.cachedFrameCount(), size_t(1));
+
+    // other frames are still read
+    frame = trajectory.frame(2);
+    QVERIFY(frame != 0);
+    QCOMPARE(frame->time(), chemkit::Real(2));
+    QCOMPARE(trajectory.cachedFrameCount(), size_t(2));
+}
+
+QTEST_APPLESS_MAIN(TrajectoryTest)
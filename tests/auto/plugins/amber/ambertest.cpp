@@ -204,4 +204,35 @@ void AmberTest::water()
     delete forceField;
 }
 
+void AmberTest::nonbondedCutoff()
+{
+    chemkit::MoleculeFile file(dataPath + "serine.mol");
+    QVERIFY(file.read());
+    boost::shared_ptr<chemkit::Molecule> molecule = file.molecule();
+
+    chemkit::ForceField *forceField = chemkit::ForceField::create("amber");
+    QVERIFY(forceField != 0);
+    QCOMPARE(forceField->nonbondedCutoff(), chemkit::Real(0));
+
+    // with a cutoff larger than the molecule the energy is unchanged
+    forceField->setNonbondedCutoff(100);
+    forceField->setTopologyFromMolecule(molecule.get());
+    QCOMPARE(forceField->topology()->nonbondedInteractionCount(), size_t(0));
+    forceField->setup();
+    QVERIFY(forceField->isSetup());
+
+    // all of the nonbonded interactions are in a single calculation
+    QCOMPARE(forceField->calculationCount(), size_t(63));
+    QCOMPARE(qRound(forceField->energy(molecule->coordinates())), 322);
+
+    // the analytical gradient matches the numerical gradient
+    std::vector<chemkit::Vector3> gradient = forceField->gradient(molecule->coordinates());
+    std::vector<chemkit::Vector3> numericalGradient = forceField->numericalGradient(molecule->coordinates());
+    for(size_t i = 0; i < gradient.size(); i++){
+        QVERIFY((gradient[i] - numericalGradient[i]).norm() < 0.5);
+    }
+
+    delete forceField;
+}
+
 QTEST_APPLESS_MAIN(AmberTest)
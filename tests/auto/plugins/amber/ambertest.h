@@ -47,6 +47,7 @@ class AmberTest : public QObject
         void adenosine();
         void serine();
         void water();
+        void nonbondedCutoff();
 };
 
 #endif // AMBERTEST_H
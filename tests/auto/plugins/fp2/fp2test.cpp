@@ -35,6 +35,7 @@
 
 #include "fp2test.h"
 
+#include <boost/make_shared.hpp>
 #include <boost/range/algorithm.hpp>
 
 #include <chemkit/molecule.h>
@@ -54,6 +55,15 @@ void Fp2Test::name()
     delete fingerprint;
 }
 
+void Fp2Test::size()
+{
+    chemkit::Fingerprint *fingerprint = chemkit::Fingerprint::create("fp2");
+    QVERIFY(fingerprint != 0);
+    QCOMPARE(fingerprint->size(), size_t(1021));
+    QCOMPARE(fingerprint->wordCount(), size_t(16));
+    delete fingerprint;
+}
+
 // data generated via the following openbabel invocation
 // echo "SMILES" | babel -ismi -ofpt -xfFP2 -xh
 void Fp2Test::test_data()
@@ -258,4 +268,28 @@ void Fp2Test::test()
     }
 }
 
+void Fp2Test::values()
+{
+    const char *formulas[] = { "CCO", "c1ccccc1O", "CN1C=NC2=C1C(=O)N(C(=O)N2C)C", "C1CC1Cl" };
+
+    std::vector<boost::shared_ptr<chemkit::Molecule> > molecules;
+    for(size_t i = 0; i < 4; i++){
+        molecules.push_back(boost::make_shared<chemkit::Molecule>(formulas[i], "smiles"));
+    }
+
+    chemkit::FingerprintMatrix matrix = chemkit::Fingerprint::values(molecules, "fp2");
+    QCOMPARE(matrix.rowCount(), size_t(4));
+    QCOMPARE(matrix.bitCount(), size_t(1021));
+
+    // the packed values match the bitset values
+    for(size_t i = 0; i < molecules.size(); i++){
+        QVERIFY(matrix.value(i) == molecules[i]->fingerprint("fp2"));
+    }
+
+    // the values do not depend on the number of threads
+    chemkit::FingerprintMatrix threadedMatrix = chemkit::Fingerprint::values(molecules, "fp2", 3);
+    QCOMPARE(threadedMatrix.rowCount(), size_t(4));
+    QVERIFY(std::equal(matrix.data(), matrix.data() + 4 * matrix.stride(), threadedMatrix.data()));
+}
+
 QTEST_APPLESS_MAIN(Fp2Test)
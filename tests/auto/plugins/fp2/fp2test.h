@@ -45,8 +45,10 @@ class Fp2Test : public QObject
     private slots:
         void initTestCase();
         void name();
+        void size();
         void test_data();
         void test();
+        void values();
 };
 
 #endif // FP2TEST_H
@@ -35,8 +35,11 @@
 
 #include "mdltest.h"
 
+#include <fstream>
+
 #include <boost/range/algorithm.hpp>
 
+#include <chemkit/atom.h>
 #include <chemkit/molecule.h>
 #include <chemkit/moleculefile.h>
 #include <chemkit/moleculefileformat.h>
@@ -116,6 +119,86 @@ void MdlTest::read_benzenes()
     }
 }
 
+void MdlTest::readNext_benzenes()
+{
+    chemkit::MoleculeFile file(dataPath + "pubchem_416_benzenes.sdf");
+
+    bool ok = file.beginRead();
+    if(!ok)
+        qDebug() << file.errorString().c_str();
+    QCOMPARE(ok, true);
+
+    // read molecules one at a time
+    size_t count = 0;
+    while(boost::shared_ptr<chemkit::Molecule> molecule = file.readNext()){
+        QCOMPARE(molecule->name(), molecule->data("PUBCHEM_COMPOUND_CID").toString());
+        count++;
+    }
+
+    QCOMPARE(file.errorString(), std::string());
+    QCOMPARE(count, size_t(416));
+
+    // molecules read with readNext() are not added to the file
+    QCOMPARE(file.moleculeCount(), size_t(0));
+    file.endRead();
+}
+
+void MdlTest::readMappedFile_benzenes()
+{
+    // read the file from a stream
+    std::ifstream input((dataPath + "pubchem_416_benzenes.sdf").c_str());
+    chemkit::MoleculeFile streamFile;
+    QVERIFY(streamFile.read(input, "sdf"));
+
+    // read the file from a memory map
+    boost::iostreams::mapped_file_source mappedInput(dataPath + "pubchem_416_benzenes.sdf");
+    chemkit::MoleculeFile mappedFile;
+    QVERIFY(mappedFile.read(mappedInput, "sdf"));
+
+    QCOMPARE(mappedFile.moleculeCount(), size_t(416));
+    QCOMPARE(mappedFile.moleculeCount(), streamFile.moleculeCount());
+
+    for(size_t i = 0; i < mappedFile.moleculeCount(); i++){
+        boost::shared_ptr<chemkit::Molecule> mapped = mappedFile.molecule(i);
+        boost::shared_ptr<chemkit::Molecule> streamed = streamFile.molecule(i);
+
+        QCOMPARE(mapped->name(), streamed->name());
+        QCOMPARE(mapped->formula(), streamed->formula());
+        QCOMPARE(mapped->bondCount(), streamed->bondCount());
+        QCOMPARE(mapped->data("PUBCHEM_IUPAC_NAME").toString(),
+                 streamed->data("PUBCHEM_IUPAC_NAME").toString());
+
+        for(size_t j = 0; j < mapped->atomCount(); j++){
+            QVERIFY(mapped->atom(j)->position().isApprox(streamed->atom(j)->position()));
+        }
+    }
+}
+
+void MdlTest::readParallel_benzenes()
+{
+    chemkit::MoleculeFile file(dataPath + "pubchem_416_benzenes.sdf");
+    QVERIFY(file.read());
+
+    for(size_t threadCount = 2; threadCount <= 4; threadCount++){
+        chemkit::MoleculeFile parallelFile(dataPath + "pubchem_416_benzenes.sdf");
+        parallelFile.setThreadCount(threadCount);
+        QCOMPARE(parallelFile.threadCount(), threadCount);
+        QVERIFY(parallelFile.read());
+        QCOMPARE(parallelFile.moleculeCount(), size_t(416));
+
+        // molecules are in the same order as the file
+        for(size_t i = 0; i < file.moleculeCount(); i++){
+            boost::shared_ptr<chemkit::Molecule> molecule = file.molecule(i);
+            boost::shared_ptr<chemkit::Molecule> parallelMolecule = parallelFile.molecule(i);
+
+            QCOMPARE(parallelMolecule->name(), molecule->name());
+            QCOMPARE(parallelMolecule->formula(), molecule->formula());
+            QCOMPARE(parallelMolecule->data("PUBCHEM_COMPOUND_CID").toString(),
+                     molecule->data("PUBCHEM_COMPOUND_CID").toString());
+        }
+    }
+}
+
 void MdlTest::read_serine()
 {
     // check that gz compression is supported
@@ -47,6 +47,9 @@ class MdlTest : public QObject
         void read_methanol();
         void read_guanine();
         void read_benzenes();
+        void readNext_benzenes();
+        void readMappedFile_benzenes();
+        void readParallel_benzenes();
         void read_serine();
 };
 
@@ -98,4 +98,29 @@ void OplsTest::energy()
     delete opls;
 }
 
+void OplsTest::parameterFile()
+{
+    boost::shared_ptr<chemkit::Molecule> molecule =
+        chemkit::MoleculeFile::quickRead(dataPath + "ethanol.cml");
+    QVERIFY(molecule != 0);
+
+    // the default parameters are compiled into the plugin
+    chemkit::ForceField *opls = chemkit::ForceField::create("opls");
+    QVERIFY(opls != 0);
+    QCOMPARE(opls->parameterSet(), std::string("oplsaa"));
+    opls->setTopologyFromMolecule(molecule.get());
+    QVERIFY(opls->setup());
+    chemkit::Real energy = opls->energy(molecule->coordinates());
+    delete opls;
+
+    // reading the same parameters from the text file gives the same energy
+    opls = chemkit::ForceField::create("opls");
+    QVERIFY(opls != 0);
+    opls->setParameterFile("../../../../src/plugins/opls/data/oplsaa.prm");
+    opls->setTopologyFromMolecule(molecule.get());
+    QVERIFY(opls->setup());
+    QCOMPARE(opls->energy(molecule->coordinates()), energy);
+    delete opls;
+}
+
 QTEST_APPLESS_MAIN(OplsTest)
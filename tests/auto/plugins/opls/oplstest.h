@@ -46,6 +46,7 @@ class OplsTest : public QObject
         void initTestCase();
         void energy_data();
         void energy();
+        void parameterFile();
 };
 
 #endif // OPLSTEST_H
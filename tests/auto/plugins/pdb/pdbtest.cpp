@@ -190,6 +190,10 @@ void PdbTest::read_2DHB()
     QCOMPARE(file.ligand(1)->name(), std::string("PROTOPORPHYRIN IX CONTAINING FE"));
     QCOMPARE(file.ligand(2)->name(), std::string("HOH"));
     QCOMPARE(file.ligand(3)->name(), std::string("HOH"));
+
+    // check two letter element symbols
+    QCOMPARE(file.ligand(0)->formula(), std::string("C34FeN4O4"));
+    QCOMPARE(file.ligand(1)->formula(), std::string("C34FeN4O4"));
 }
 
 void PdbTest::read_2DHB_pdbml()
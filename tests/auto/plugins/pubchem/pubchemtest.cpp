@@ -35,6 +35,7 @@
 
 #include "pubchemtest.h"
 
+#include <boost/make_shared.hpp>
 #include <boost/range/algorithm.hpp>
 
 #include <chemkit/molecule.h>
@@ -106,6 +107,15 @@ void PubChemTest::name()
     delete fingerprint;
 }
 
+void PubChemTest::size()
+{
+    chemkit::Fingerprint *fingerprint = chemkit::Fingerprint::create("pubchem");
+    QVERIFY(fingerprint != 0);
+    QCOMPARE(fingerprint->size(), size_t(881));
+    QCOMPARE(fingerprint->wordCount(), size_t(14));
+    delete fingerprint;
+}
+
 void PubChemTest::test_data()
 {
     QTest::addColumn<QString>("cid");
@@ -249,4 +259,28 @@ void PubChemTest::test()
     compareFingerprints(fingerprint, expected);
 }
 
+void PubChemTest::values()
+{
+    const char *formulas[] = { "CCO", "c1ccccc1O", "CN1C=NC2=C1C(=O)N(C(=O)N2C)C", "C1CC1Cl" };
+
+    std::vector<boost::shared_ptr<chemkit::Molecule> > molecules;
+    for(size_t i = 0; i < 4; i++){
+        molecules.push_back(boost::make_shared<chemkit::Molecule>(formulas[i], "smiles"));
+    }
+
+    chemkit::FingerprintMatrix matrix = chemkit::Fingerprint::values(molecules, "pubchem");
+    QCOMPARE(matrix.rowCount(), size_t(4));
+    QCOMPARE(matrix.bitCount(), size_t(881));
+
+    // the packed values match the bitset values
+    for(size_t i = 0; i < molecules.size(); i++){
+        QVERIFY(matrix.value(i) == molecules[i]->fingerprint("pubchem"));
+    }
+
+    // the values do not depend on the number of threads
+    chemkit::FingerprintMatrix threadedMatrix = chemkit::Fingerprint::values(molecules, "pubchem", 3);
+    QCOMPARE(threadedMatrix.rowCount(), size_t(4));
+    QVERIFY(std::equal(matrix.data(), matrix.data() + 4 * matrix.stride(), threadedMatrix.data()));
+}
+
 QTEST_APPLESS_MAIN(PubChemTest)
@@ -45,8 +45,10 @@ class PubChemTest : public QObject
     private slots:
         void initTestCase();
         void name();
+        void size();
         void test_data();
         void test();
+        void values();
 };
 
 #endif // PUBCHEMTEST_H
@@ -1348,4 +1348,20 @@ void SmilesTest::cox2()
     QCOMPARE(file.molecule(127)->formula(), std::string("C21H19NO5S"));
 }
 
+void SmilesTest::cox2Parallel()
+{
+    chemkit::MoleculeFile file(dataPath + "cox2.smi");
+    file.setThreadCount(4);
+
+    bool ok = file.read();
+    if(!ok)
+        qDebug() << "Failed to read file: " << file.errorString().c_str();
+    QVERIFY(ok);
+
+    QCOMPARE(file.moleculeCount(), size_t(128));
+    QCOMPARE(file.molecule(0)->formula(), std::string("C13H18N2O5S"));
+    QCOMPARE(file.molecule(2)->formula(), std::string("C16H13F2NO3S2"));
+    QCOMPARE(file.molecule(127)->formula(), std::string("C21H19NO5S"));
+}
+
 QTEST_APPLESS_MAIN(SmilesTest)
@@ -50,6 +50,8 @@ void SurfaceDescriptorsTest::initTestCase()
     QVERIFY(boost::count(chemkit::MolecularDescriptor::descriptors(), "vdw-volume") == 1);
     QVERIFY(boost::count(chemkit::MolecularDescriptor::descriptors(), "sas-area") == 1);
     QVERIFY(boost::count(chemkit::MolecularDescriptor::descriptors(), "sas-volume") == 1);
+    QVERIFY(boost::count(chemkit::MolecularDescriptor::descriptors(), "sas-area-sr") == 1);
+    QVERIFY(boost::count(chemkit::MolecularDescriptor::descriptors(), "sas-area-lcpo") == 1);
 }
 
 void SurfaceDescriptorsTest::test_data()
@@ -60,9 +62,10 @@ void SurfaceDescriptorsTest::test_data()
     QTest::addColumn<int>("vanDerWaalsVolume");
     QTest::addColumn<int>("solventAccessibleArea");
     QTest::addColumn<int>("solventAccessibleVolume");
+    QTest::addColumn<int>("lcpoArea");
 
-    QTest::newRow("ethanol") << "ethanol.cml" << "C2H6O" << 82 << 54 << 200 << 245;
-    QTest::newRow("serine") << "serine.mol" << "C3H7NO3" << 129 << 94 << 264 << 363;
+    QTest::newRow("ethanol") << "ethanol.cml" << "C2H6O" << 82 << 54 << 200 << 245 << 193;
+    QTest::newRow("serine") << "serine.mol" << "C3H7NO3" << 129 << 94 << 264 << 363 << 204;
 }
 
 void SurfaceDescriptorsTest::test()
@@ -73,6 +76,7 @@ void SurfaceDescriptorsTest::test()
     QFETCH(int, vanDerWaalsVolume);
     QFETCH(int, solventAccessibleArea);
     QFETCH(int, solventAccessibleVolume);
+    QFETCH(int, lcpoArea);
 
     QByteArray fileName = fileNameString.toAscii();
     QByteArray formula = formulaString.toAscii();
@@ -91,6 +95,8 @@ void SurfaceDescriptorsTest::test()
     QCOMPARE(qRound(molecule->descriptor("vdw-volume").toDouble()), vanDerWaalsVolume);
     QCOMPARE(qRound(molecule->descriptor("sas-area").toDouble()), solventAccessibleArea);
     QCOMPARE(qRound(molecule->descriptor("sas-volume").toDouble()), solventAccessibleVolume);
+    QCOMPARE(qRound(molecule->descriptor("sas-area-sr").toDouble()), solventAccessibleArea);
+    QCOMPARE(qRound(molecule->descriptor("sas-area-lcpo").toDouble()), lcpoArea);
 }
 
 QTEST_APPLESS_MAIN(SurfaceDescriptorsTest)
@@ -42,6 +42,9 @@
 #include <chemkit/forcefield.h>
 #include <chemkit/moleculefile.h>
 #include <chemkit/moleculardescriptor.h>
+#include <chemkit/cartesiancoordinates.h>
+
+const std::string dataPath = "../../../data/";
 
 void UffTest::initTestCase()
 {
@@ -51,4 +54,82 @@ void UffTest::initTestCase()
     QVERIFY(boost::count(chemkit::MolecularDescriptor::descriptors(), "uff-energy") == 1);
 }
 
+void UffTest::calculationBatches()
+{
+    boost::shared_ptr<chemkit::Molecule> molecule =
+        chemkit::MoleculeFile::quickRead(dataPath + "uridine.mol2");
+    QVERIFY(molecule);
+
+    chemkit::ForceField *forceField = chemkit::ForceField::create("uff");
+    QVERIFY(forceField);
+    forceField->setTopologyFromMolecule(molecule.get());
+    QVERIFY(forceField->setup());
+
+    // bond strech, angle bend, torsion and inversion batches
+    QCOMPARE(forceField->calculationBatches().size(), size_t(4));
+
+    // batched energy and gradient should equal the sum over each calculation
+    const chemkit::CartesianCoordinates *coordinates = molecule->coordinates();
+    chemkit::Real energy = 0;
+    std::vector<chemkit::Vector3> gradient(molecule->atomCount(), chemkit::Vector3(0, 0, 0));
+    foreach(const chemkit::ForceFieldCalculation *calculation, forceField->calculations()){
+        energy += calculation->energy(coordinates);
+
+        std::vector<chemkit::Vector3> atomGradients = calculation->gradient(coordinates);
+        for(size_t i = 0; i < atomGradients.size(); i++){
+            gradient[calculation->atom(i)] += atomGradients[i];
+        }
+    }
+
+    QVERIFY(qAbs(forceField->energy(coordinates) - energy) < 1e-6);
+
+    std::vector<chemkit::Vector3> batchedGradient = forceField->gradient(coordinates);
+    QCOMPARE(batchedGradient.size(), gradient.size());
+    for(size_t i = 0; i < gradient.size(); i++){
+        QVERIFY((batchedGradient[i] - gradient[i]).norm() < 1e-6);
+    }
+
+    // changing a parameter should update the batches
+    chemkit::ForceFieldCalculation *calculation = forceField->calculations().front();
+    chemkit::Real initialEnergy = calculation->energy(coordinates);
+    calculation->setParameter(0, 2 * calculation->parameter(0));
+    energy += calculation->energy(coordinates) - initialEnergy;
+    QVERIFY(qAbs(forceField->energy(coordinates) - energy) < 1e-6);
+
+    delete forceField;
+}
+
+void UffTest::threadCount()
+{
+    boost::shared_ptr<chemkit::Molecule> molecule =
+        chemkit::MoleculeFile::quickRead(dataPath + "uridine.mol2");
+    QVERIFY(molecule);
+
+    chemkit::ForceField *forceField = chemkit::ForceField::create("uff");
+    QVERIFY(forceField);
+    forceField->setTopologyFromMolecule(molecule.get());
+    QVERIFY(forceField->setup());
+
+    const chemkit::CartesianCoordinates *coordinates = molecule->coordinates();
+    chemkit::Real energy = forceField->energy(coordinates);
+    std::vector<chemkit::Vector3> gradient = forceField->gradient(coordinates);
+
+    forceField->setThreadCount(3);
+    QCOMPARE(forceField->threadCount(), size_t(3));
+
+    chemkit::Real threadedEnergy = forceField->energy(coordinates);
+    std::vector<chemkit::Vector3> threadedGradient = forceField->gradient(coordinates);
+    QVERIFY(qAbs(threadedEnergy - energy) < 1e-6);
+    QCOMPARE(threadedGradient.size(), gradient.size());
+    for(size_t i = 0; i < gradient.size(); i++){
+        QVERIFY((threadedGradient[i] - gradient[i]).norm() < 1e-6);
+    }
+
+    // results are identical between calls with the same thread count
+    QVERIFY(forceField->energy(coordinates) == threadedEnergy);
+    QVERIFY(forceField->gradient(coordinates) == threadedGradient);
+
+    delete forceField;
+}
+
 QTEST_APPLESS_MAIN(UffTest)
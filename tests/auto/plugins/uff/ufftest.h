@@ -44,6 +44,8 @@ class UffTest : public QObject
 
     private slots:
         void initTestCase();
+        void calculationBatches();
+        void threadCount();
 };
 
 #endif // UFFTEST_H
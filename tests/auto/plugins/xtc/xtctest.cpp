@@ -35,15 +35,57 @@
 
 #include "xtctest.h"
 
+#include <cmath>
+
+#include <boost/make_shared.hpp>
 #include <boost/range/algorithm.hpp>
 
+#include <chemkit/foreach.h>
+#include <chemkit/unitcell.h>
 #include <chemkit/trajectory.h>
 #include <chemkit/trajectoryfile.h>
 #include <chemkit/trajectoryframe.h>
 #include <chemkit/trajectoryfileformat.h>
+#include <chemkit/trajectoryfilereader.h>
+#include <chemkit/cartesiancoordinates.h>
 
 const std::string dataPath = "../../../data/";
 
+// reference coordinates (in nanometers) from spc216.xtc as
+// decoded by libxdrf
+struct ReferencePosition {
+    size_t frame;
+    size_t atom;
+    float x;
+    float y;
+    float z;
+};
+
+const ReferencePosition referencePositions[] = {
+    {   0,   0, 0.230f, 0.628f, 0.113f },
+    {   0,   1, 0.137f, 0.626f, 0.150f },
+    {   0,  42, 0.438f, 0.392f, 1.499f },
+    {   0, 647, 0.843f, 1.717f, 0.399f },
+    { 150,   0, 0.249f, 1.070f, 0.370f },
+    { 150,   1, 0.294f, 0.992f, 0.327f },
+    { 150,  42, 0.505f, 1.444f, 0.905f },
+    { 150, 647, 1.267f, 0.277f, 0.087f },
+    { 200,   0, 0.234f, 1.625f, 1.637f },
+    { 200,   1, 0.237f, 1.528f, 1.616f },
+    { 200,  42, 0.379f, 0.921f, 1.057f },
+    { 200, 647, 1.607f, 0.273f, 1.755f }
+};
+
+// Returns true if position is within the xtc precision (0.001 nm)
+// of the reference position.
+bool matchesReference(const chemkit::Point3 &position, const ReferencePosition &reference)
+{
+    // positions are stored in angstroms
+    return std::abs(position.x() / 10 - reference.x) <= 0.001 &&
+           std::abs(position.y() / 10 - reference.y) <= 0.001 &&
+           std::abs(position.z() / 10 - reference.z) <= 0.001;
+}
+
 void XtcTest::initTestCase()
 {
     // verify that the xtc plugin registered itself correctly
@@ -64,4 +106,193 @@ void XtcTest::spc216()
     QCOMPARE(trajectory->frameCount(), size_t(201));
 }
 
+void XtcTest::referenceCoordinates()
+{
+    chemkit::TrajectoryFile file(dataPath + "spc216.xtc");
+    QVERIFY(file.read());
+    boost::shared_ptr<chemkit::Trajectory> trajectory = file.trajectory();
+
+    chemkit::TrajectoryFileReader reader;
+    reader.setIndexFileName("spc216.xtc.ckidx");
+    QVERIFY(reader.open(dataPath + "spc216.xtc"));
+
+    foreach(const ReferencePosition &reference, referencePositions){
+        chemkit::TrajectoryFrame *frame = trajectory->frame(reference.frame);
+        QVERIFY(matchesReference(frame->position(reference.atom), reference));
+
+        chemkit::Trajectory frames;
+        frame = reader.readFrame(reference.frame, &frames);
+        QVERIFY(frame != 0);
+        QVERIFY(matchesReference(frame->position(reference.atom), reference));
+    }
+}
+
+void XtcTest::readFrame()
+{
+    chemkit::TrajectoryFile file(dataPath + "spc216.xtc");
+    QVERIFY(file.read());
+    boost::shared_ptr<chemkit::Trajectory> trajectory = file.trajectory();
+
+    // build the index and then reopen the file using the cached index
+    for(int i = 0; i < 2; i++){
+        chemkit::TrajectoryFileReader reader;
+        reader.setIndexFileName("spc216.xtc.ckidx");
+        bool ok = reader.open(dataPath + "spc216.xtc");
+        if(!ok)
+            qDebug() << reader.errorString().c_str();
+        QVERIFY(ok);
+        QCOMPARE(reader.formatName(), std::string("xtc"));
+        QCOMPARE(reader.frameCount(), size_t(201));
+        QCOMPARE(qRound(reader.frameTime(150)), 15);
+        QCOMPARE(reader.frameAtTime(4.3), size_t(43));
+        QCOMPARE(reader.frameAtTime(-1.0), size_t(0));
+        QCOMPARE(reader.frameAtTime(1000.0), size_t(200));
+
+        // read a single frame without reading the ones before it
+        chemkit::Trajectory frames;
+        chemkit::TrajectoryFrame *frame = reader.readFrame(150, &frames);
+        QVERIFY(frame != 0);
+        QCOMPARE(frames.size(), size_t(648));
+        QCOMPARE(frames.frameCount(), size_t(1));
+        QCOMPARE(qRound(frame->time()), 15);
+
+        chemkit::TrajectoryFrame *expected = trajectory->frame(150);
+        for(size_t j = 0; j < frame->size(); j++){
+            QVERIFY(frame->position(j).isApprox(expected->position(j)));
+        }
+
+        QVERIFY(reader.readFrame(201, &frames) == 0);
+    }
+}
+
+void XtcTest::pagedTrajectory()
+{
+    chemkit::TrajectoryFile file(dataPath + "spc216.xtc");
+    QVERIFY(file.read());
+    boost::shared_ptr<chemkit::Trajectory> expected = file.trajectory();
+
+    boost::shared_ptr<chemkit::TrajectoryFileReader> reader =
+        boost::make_shared<chemkit::TrajectoryFileReader>();
+    reader->setIndexFileName("spc216.xtc.ckidx");
+    QVERIFY(reader->open(dataPath + "spc216.xtc"));
+
+    // only keep two frames in memory at once
+    chemkit::Trajectory trajectory;
+    trajectory.setCacheSize(5 * 648 * sizeof(chemkit::Point3) / 2);
+    trajectory.setFrameSource(reader);
+    QVERIFY(trajectory.frameSource() == reader);
+    QCOMPARE(trajectory.size(), size_t(648));
+    QCOMPARE(trajectory.frameCount(), size_t(201));
+    QCOMPARE(trajectory.cachedFrameCount(), size_t(1));
+
+    size_t indices[] = { 200, 0, 150, 150, 7 };
+    for(size_t i = 0; i < 5; i++){
+        size_t index = indices[i];
+        chemkit::TrajectoryFrame *frame = trajectory.frame(index);
+        QCOMPARE(frame->time(), expected->frame(index)->time());
+        QVERIFY(frame->position(42).isApprox(expected->frame(index)->position(42)));
+        QVERIFY(frame->unitCell() != 0);
+        QVERIFY(trajectory.cachedFrameCount() <= 2);
+    }
+
+    // frame 200 was unloaded and is read again when accessed
+    QVERIFY(trajectory.frame(200)->position(0).isApprox(expected->frame(200)->position(0)));
+    QCOMPARE(trajectory.cachedFrameCount(), size_t(2));
+
+    trajectory.setFrameSource(boost::shared_ptr<chemkit::TrajectoryFrameSource>());
+    QCOMPARE(trajectory.frameCount(), size_t(0));
+}
+
+void XtcTest::singlePrecision()
+{
+    chemkit::TrajectoryFile file(dataPath + "spc216.xtc");
+    QVERIFY(file.read());
+    boost::shared_ptr<chemkit::Trajectory> expected = file.trajectory();
+
+    chemkit::TrajectoryFileReader reader;
+    reader.setIndexFileName("spc216.xtc.ckidx");
+    QVERIFY(reader.open(dataPath + "spc216.xtc"));
+
+    chemkit::Trajectory trajectory;
+    trajectory.setStorageMode(chemkit::Trajectory::SinglePrecision);
+    QVERIFY(trajectory.storageMode() == chemkit::Trajectory::SinglePrecision);
+    chemkit::TrajectoryFrame *frame = reader.readFrame(100, &trajectory);
+    QVERIFY(frame != 0);
+    QCOMPARE(frame->size(), size_t(648));
+
+    // xtc coordinates are single precision so no precision is lost
+    for(size_t i = 0; i < frame->size(); i++){
+        QVERIFY(frame->position(i) == expected->frame(100)->position(i));
+    }
+    QVERIFY(frame->coordinates()->position(10) == expected->frame(100)->position(10));
+
+    // convert back to double precision
+    trajectory.setStorageMode(chemkit::Trajectory::DoublePrecision);
+    QVERIFY(frame->position(10) == expected->frame(100)->position(10));
+    QCOMPARE(frame->size(), size_t(648));
+}
+
+void XtcTest::pagedSinglePrecision()
+{
+    boost::shared_ptr<chemkit::TrajectoryFileReader> reader =
+        boost::make_shared<chemkit::TrajectoryFileReader>();
+    reader->setIndexFileName("spc216.xtc.ckidx");
+    QVERIFY(reader->open(dataPath + "spc216.xtc"));
+
+    // room for two single precision frames
+    chemkit::Trajectory trajectory;
+    trajectory.setStorageMode(chemkit::Trajectory::SinglePrecision);
+    trajectory.setCacheSize(2 * (sizeof(chemkit::UnitCell) + 648 * 3 * sizeof(float)));
+    trajectory.setFrameSource(reader);
+    QCOMPARE(trajectory.cachedFrameCount(), size_t(1));
+
+    chemkit::TrajectoryFrame *frame = trajectory.frame(1);
+    QVERIFY(frame != 0);
+    QCOMPARE(trajectory.cachedFrameCount(), size_t(2));
+
+    // the converted coordinates count towards the cache size
+    const chemkit::CartesianCoordinates *coordinates = frame->coordinates();
+    QVERIFY(coordinates != 0);
+    QCOMPARE(trajectory.cachedFrameCount(), size_t(1));
+    QVERIFY(coordinates->position(42) == frame->position(42));
+
+    // and are freed when the frame is unloaded
+    QVERIFY(trajectory.frame(2) != 0);
+    QCOMPARE(trajectory.cachedFrameCount(), size_t(1));
+    QVERIFY(trajectory.frame(3) != 0);
+    QCOMPARE(trajectory.cachedFrameCount(), size_t(2));
+}
+
+void XtcTest::pagedStorageMode()
+{
+    boost::shared_ptr<chemkit::TrajectoryFileReader> reader =
+        boost::make_shared<chemkit::TrajectoryFileReader>();
+    reader->setIndexFileName("spc216.xtc.ckidx");
+    QVERIFY(reader->open(dataPath + "spc216.xtc"));
+
+    // room for two double precision frames
+    chemkit::Trajectory trajectory;
+    trajectory.setStorageMode(chemkit::Trajectory::SinglePrecision);
+    trajectory.setCacheSize(2 * (sizeof(chemkit::UnitCell) +
+                                 sizeof(chemkit::CartesianCoordinates) +
+                                 648 * sizeof(chemkit::Point3)));
+    trajectory.setFrameSource(reader);
+
+    chemkit::Point3 position = trajectory.frame(2)->position(42);
+    QVERIFY(trajectory.frame(1) != 0);
+    QVERIFY(trajectory.frame(2) != 0);
+    QCOMPARE(trajectory.cachedFrameCount(), size_t(3));
+
+    // converting the frames to double precision unloads the least
+    // recently used frame
+    trajectory.setStorageMode(chemkit::Trajectory::DoublePrecision);
+    QCOMPARE(trajectory.cachedFrameCount(), size_t(2));
+    QVERIFY(trajectory.frame(2)->position(42) == position);
+
+    // loading more frames keeps two frames in the cache
+    QVERIFY(trajectory.frame(3) != 0);
+    QVERIFY(trajectory.frame(4) != 0);
+    QCOMPARE(trajectory.cachedFrameCount(), size_t(2));
+}
+
 QTEST_APPLESS_MAIN(XtcTest)
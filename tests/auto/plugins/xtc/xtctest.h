@@ -45,6 +45,12 @@ class XtcTest : public QObject
     private slots:
         void initTestCase();
         void spc216();
+        void referenceCoordinates();
+        void readFrame();
+        void pagedTrajectory();
+        void singlePrecision();
+        void pagedSinglePrecision();
+        void pagedStorageMode();
 };
 
 #endif // XTCTEST_H
@@ -147,4 +147,40 @@ void XyzTest::readWriteReadLoop()
     QCOMPARE(molecule->formula().c_str(), formula.constData());
 }
 
+void XyzTest::readNextWriteNext()
+{
+    // write two molecules to a single stream
+    boost::shared_ptr<chemkit::Molecule> methane =
+        chemkit::MoleculeFile::quickRead(dataPath + "methane.xyz");
+    QVERIFY(methane != 0);
+    boost::shared_ptr<chemkit::Molecule> benzene =
+        chemkit::MoleculeFile::quickRead(dataPath + "benzene.xyz");
+    QVERIFY(benzene != 0);
+
+    std::stringstream string;
+    chemkit::MoleculeFile output;
+    output.setFormat("xyz");
+    QVERIFY(output.beginWrite(string));
+    QVERIFY(output.writeNext(methane.get()));
+    QVERIFY(output.writeNext(benzene.get()));
+    QVERIFY(output.endWrite());
+
+    // read them back one at a time
+    chemkit::MoleculeFile input;
+    input.setFormat("xyz");
+    QVERIFY(input.beginRead(string));
+
+    boost::shared_ptr<chemkit::Molecule> molecule = input.readNext();
+    QVERIFY(molecule != 0);
+    QCOMPARE(molecule->formula(), std::string("CH4"));
+
+    molecule = input.readNext();
+    QVERIFY(molecule != 0);
+    QCOMPARE(molecule->formula(), std::string("C6H6"));
+
+    molecule = input.readNext();
+    QVERIFY(molecule == 0);
+    QCOMPARE(input.errorString(), std::string());
+}
+
 QTEST_APPLESS_MAIN(XyzTest)
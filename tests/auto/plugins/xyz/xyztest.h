@@ -49,6 +49,7 @@ class XyzTest : public QObject
         void readMappedFile();
         void readWriteReadLoop_data();
         void readWriteReadLoop();
+        void readNextWriteNext();
 };
 
 #endif // XYZTEST_H
@@ -0,0 +1,164 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+// This benchmark measures the time to predict the bonds for a protein
+// (2DHB.pdb) and for boxes of water built by replicating the 216 water
+// molecules in spc216.gro along each axis.
+
+#include "bondpredictionbenchmark.h"
+
+#include <fstream>
+
+#include <boost/lexical_cast.hpp>
+#include <boost/algorithm/string.hpp>
+
+#include <chemkit/atom.h>
+#include <chemkit/polymer.h>
+#include <chemkit/foreach.h>
+#include <chemkit/molecule.h>
+#include <chemkit/polymerfile.h>
+#include <chemkit/bondpredictor.h>
+
+const std::string dataPath = "../../data/";
+
+namespace {
+
+// Returns a new molecule containing the atoms in the pdb file.
+chemkit::Molecule* readProtein(const std::string &fileName)
+{
+    chemkit::PolymerFile file(dataPath + fileName);
+    if(!file.read() || !file.polymerCount()){
+        return 0;
+    }
+
+    chemkit::Molecule *molecule = new chemkit::Molecule;
+    foreach(const chemkit::Atom *atom, file.polymer()->atoms()){
+        molecule->addAtom(atom->element())->setPosition(atom->position());
+    }
+
+    return molecule;
+}
+
+// Returns a new molecule containing the water box in the gro file
+// replicated count times along each axis.
+chemkit::Molecule* readWaterBox(const std::string &fileName, int count)
+{
+    std::ifstream file((dataPath + fileName).c_str());
+    if(!file.is_open()){
+        return 0;
+    }
+
+    std::string line;
+    std::getline(file, line);
+    std::getline(file, line);
+    size_t size = boost::lexical_cast<size_t>(boost::trim_copy(line));
+
+    std::vector<chemkit::Element> elements;
+    std::vector<chemkit::Point3> positions;
+    for(size_t i = 0; i < size && std::getline(file, line); i++){
+        elements.push_back(chemkit::Element::fromSymbol(boost::trim_copy(line.substr(10, 5)).substr(0, 1)));
+
+        // coordinates are in nanometers
+        positions.push_back(chemkit::Point3(boost::lexical_cast<chemkit::Real>(boost::trim_copy(line.substr(20, 8))) * 10,
+                                            boost::lexical_cast<chemkit::Real>(boost::trim_copy(line.substr(28, 8))) * 10,
+                                            boost::lexical_cast<chemkit::Real>(boost::trim_copy(line.substr(36, 8))) * 10));
+    }
+
+    std::getline(file, line);
+    chemkit::Real box = boost::lexical_cast<chemkit::Real>(boost::trim_copy(line.substr(0, 10))) * 10;
+
+    chemkit::Molecule *molecule = new chemkit::Molecule;
+    molecule->setAtomCapacity(positions.size() * count * count * count);
+
+    for(int x = 0; x < count; x++){
+        for(int y = 0; y < count; y++){
+            for(int z = 0; z < count; z++){
+                chemkit::Vector3 offset(x * box, y * box, z * box);
+
+                for(size_t i = 0; i < positions.size(); i++){
+                    molecule->addAtom(elements[i])->setPosition(positions[i] + offset);
+                }
+            }
+        }
+    }
+
+    return molecule;
+}
+
+} // end anonymous namespace
+
+void BondPredictionBenchmark::predict_data()
+{
+    QTest::addColumn<QString>("fileNameString");
+    QTest::addColumn<int>("replicas");
+    QTest::addColumn<int>("threadCount");
+
+    QTest::newRow("2DHB") << "2DHB.pdb" << 0 << 1;
+    QTest::newRow("2DHB-4-threads") << "2DHB.pdb" << 0 << 4;
+    QTest::newRow("spc216") << "spc216.gro" << 1 << 1;
+    QTest::newRow("spc216-x27") << "spc216.gro" << 3 << 1;
+    QTest::newRow("spc216-x216") << "spc216.gro" << 6 << 1;
+    QTest::newRow("spc216-x216-4-threads") << "spc216.gro" << 6 << 4;
+}
+
+void BondPredictionBenchmark::predict()
+{
+    QFETCH(QString, fileNameString);
+    QFETCH(int, replicas);
+    QFETCH(int, threadCount);
+
+    QByteArray fileName = fileNameString.toAscii();
+
+    chemkit::Molecule *molecule = 0;
+    if(replicas == 0){
+        molecule = readProtein(fileName.constData());
+    }
+    else{
+        molecule = readWaterBox(fileName.constData(), replicas);
+    }
+    QVERIFY(molecule != 0);
+
+    chemkit::BondPredictor predictor(molecule);
+    predictor.setThreadCount(threadCount);
+
+    QBENCHMARK {
+        std::vector<chemkit::BondPredictor::PredictedBond> bonds = predictor.predictedBonds();
+        QVERIFY(!bonds.empty());
+    }
+
+    delete molecule;
+}
+
+QTEST_APPLESS_MAIN(BondPredictionBenchmark)
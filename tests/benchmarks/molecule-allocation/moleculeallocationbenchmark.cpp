@@ -0,0 +1,103 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+// This benchmark measures the cost of creating and destroying large
+// numbers of molecules and their atoms and bonds.
+
+#include "moleculeallocationbenchmark.h"
+
+#include <chemkit/atom.h>
+#include <chemkit/bond.h>
+#include <chemkit/molecule.h>
+#include <chemkit/moleculefile.h>
+
+const std::string dataPath = "../../data/";
+
+void MoleculeAllocationBenchmark::build()
+{
+    QBENCHMARK {
+        size_t atomCount = 0;
+
+        // build and destroy 10000 decane molecules
+        for(int i = 0; i < 10000; i++){
+            chemkit::Molecule molecule;
+
+            chemkit::Atom *previous = 0;
+            for(int j = 0; j < 10; j++){
+                chemkit::Atom *carbon = molecule.addAtom("C");
+
+                for(int k = 0; k < 2; k++){
+                    molecule.addBond(carbon, molecule.addAtom("H"));
+                }
+
+                if(previous){
+                    molecule.addBond(previous, carbon);
+                }
+
+                previous = carbon;
+            }
+
+            molecule.addBond(molecule.atom(0), molecule.addAtom("H"));
+            molecule.addBond(previous, molecule.addAtom("H"));
+
+            atomCount += molecule.atomCount();
+        }
+
+        QCOMPARE(atomCount, size_t(320000));
+    }
+}
+
+void MoleculeAllocationBenchmark::copy()
+{
+    // load test file
+    chemkit::MoleculeFile file(dataPath + "pubchem_416_benzenes.sdf");
+    bool ok = file.read();
+    if(!ok)
+        qDebug() << file.errorString().c_str();
+    QVERIFY(ok);
+
+    QBENCHMARK {
+        // copy and destroy each molecule in the file 25 times
+        for(int i = 0; i < 25; i++){
+            foreach(const boost::shared_ptr<chemkit::Molecule> &molecule, file.molecules()){
+                chemkit::Molecule copy(*molecule);
+                QCOMPARE(copy.atomCount(), molecule->atomCount());
+                copy.clear();
+            }
+        }
+    }
+}
+
+QTEST_APPLESS_MAIN(MoleculeAllocationBenchmark)
@@ -0,0 +1,138 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+// This benchmark compares the performance of traversing a molecule's
+// connectivity through the Atom::neighbors() method and through the
+// compressed adjacency arrays of the MoleculeGraph class. Each case
+// runs a breadth-first search from every atom in every molecule.
+
+#include "moleculegraphbenchmark.h"
+
+#include <chemkit/atom.h>
+#include <chemkit/molecule.h>
+#include <chemkit/moleculefile.h>
+#include <chemkit/moleculegraph.h>
+
+const std::string dataPath = "../../data/";
+
+void MoleculeGraphBenchmark::atomNeighbors()
+{
+    // load test file
+    chemkit::MoleculeFile file(dataPath + "pubchem_416_benzenes.sdf");
+    bool ok = file.read();
+    if(!ok)
+        qDebug() << file.errorString().c_str();
+    QVERIFY(ok);
+
+    size_t distanceSum = 0;
+
+    QBENCHMARK {
+        distanceSum = 0;
+
+        foreach(const boost::shared_ptr<chemkit::Molecule> &molecule, file.molecules()){
+            std::vector<size_t> distances(molecule->atomCount());
+            std::vector<const chemkit::Atom *> queue;
+
+            foreach(const chemkit::Atom *root, molecule->atoms()){
+                std::fill(distances.begin(), distances.end(), size_t(-1));
+                distances[root->index()] = 0;
+
+                queue.clear();
+                queue.push_back(root);
+
+                for(size_t i = 0; i < queue.size(); i++){
+                    const chemkit::Atom *atom = queue[i];
+
+                    foreach(const chemkit::Atom *neighbor, atom->neighbors()){
+                        if(distances[neighbor->index()] == size_t(-1)){
+                            distances[neighbor->index()] = distances[atom->index()] + 1;
+                            distanceSum += distances[neighbor->index()];
+                            queue.push_back(neighbor);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    QVERIFY(distanceSum > 0);
+}
+
+void MoleculeGraphBenchmark::moleculeGraph()
+{
+    // load test file
+    chemkit::MoleculeFile file(dataPath + "pubchem_416_benzenes.sdf");
+    bool ok = file.read();
+    if(!ok)
+        qDebug() << file.errorString().c_str();
+    QVERIFY(ok);
+
+    size_t distanceSum = 0;
+
+    QBENCHMARK {
+        distanceSum = 0;
+
+        foreach(const boost::shared_ptr<chemkit::Molecule> &molecule, file.molecules()){
+            const chemkit::MoleculeGraph *graph = molecule->graph();
+
+            std::vector<size_t> distances(graph->size());
+            std::vector<size_t> queue;
+
+            for(size_t root = 0; root < graph->size(); root++){
+                std::fill(distances.begin(), distances.end(), size_t(-1));
+                distances[root] = 0;
+
+                queue.clear();
+                queue.push_back(root);
+
+                for(size_t i = 0; i < queue.size(); i++){
+                    size_t vertex = queue[i];
+
+                    foreach(size_t neighbor, graph->neighbors(vertex)){
+                        if(distances[neighbor] == size_t(-1)){
+                            distances[neighbor] = distances[vertex] + 1;
+                            distanceSum += distances[neighbor];
+                            queue.push_back(neighbor);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    QVERIFY(distanceSum > 0);
+}
+
+QTEST_APPLESS_MAIN(MoleculeGraphBenchmark)
@@ -0,0 +1,106 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+// This benchmark measures the number of records read per second from
+// a large SDF file as the number of threads used to read it increases.
+// The file is made by concatenating copies of pubchem_416_benzenes.sdf.
+
+#include "parallelreadingbenchmark.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+
+#include <chemkit/molecule.h>
+#include <chemkit/moleculefile.h>
+
+const std::string dataPath = "../../data/";
+
+// number of times the data file is repeated
+const int copies = 50;
+
+// name of the concatenated file
+const std::string fileName = "parallel_reading_benzenes.sdf";
+
+void ParallelReadingBenchmark::initTestCase()
+{
+    std::ifstream input((dataPath + "pubchem_416_benzenes.sdf").c_str(), std::ios_base::binary);
+    std::string data((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+    QVERIFY(!data.empty());
+
+    std::ofstream output(fileName.c_str(), std::ios_base::binary);
+    for(int i = 0; i < copies; i++){
+        output << data;
+    }
+}
+
+void ParallelReadingBenchmark::cleanupTestCase()
+{
+    std::remove(fileName.c_str());
+}
+
+void ParallelReadingBenchmark::read_data()
+{
+    QTest::addColumn<int>("threadCount");
+
+    QTest::newRow("1 thread") << 1;
+    QTest::newRow("2 threads") << 2;
+    QTest::newRow("4 threads") << 4;
+    QTest::newRow("8 threads") << 8;
+}
+
+void ParallelReadingBenchmark::read()
+{
+    QFETCH(int, threadCount);
+
+    int elapsed = 0;
+
+    QBENCHMARK {
+        QTime time;
+        time.start();
+
+        chemkit::MoleculeFile file(fileName);
+        file.setThreadCount(threadCount);
+        bool ok = file.read();
+        QVERIFY(ok);
+        QCOMPARE(file.moleculeCount(), size_t(416 * copies));
+
+        elapsed = time.elapsed();
+    }
+
+    qDebug() << "records/sec:" << (elapsed ? 416 * copies * 1000 / elapsed : 0);
+}
+
+QTEST_APPLESS_MAIN(ParallelReadingBenchmark)
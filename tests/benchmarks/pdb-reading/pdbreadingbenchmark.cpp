@@ -0,0 +1,82 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+// This benchmark measures the time to read each of the PDB files in
+// the test data directory. The files range from small proteins to the
+// NMR structure in 1D3Z.pdb which contains ten models.
+
+#include "pdbreadingbenchmark.h"
+
+#include <chemkit/polymer.h>
+#include <chemkit/polymerfile.h>
+
+const std::string dataPath = "../../data/";
+
+void PdbReadingBenchmark::read_data()
+{
+    QTest::addColumn<QString>("fileNameString");
+
+    QTest::newRow("1BNA") << "1BNA.pdb";
+    QTest::newRow("1D3Z") << "1D3Z.pdb";
+    QTest::newRow("1MME") << "1MME.pdb";
+    QTest::newRow("1PLX") << "1PLX.pdb";
+    QTest::newRow("1TAU") << "1TAU.pdb";
+    QTest::newRow("1THM") << "1THM.pdb";
+    QTest::newRow("1UBQ") << "1UBQ.pdb";
+    QTest::newRow("2D1S") << "2D1S.pdb";
+    QTest::newRow("2DHB") << "2DHB.pdb";
+    QTest::newRow("2LYZ") << "2LYZ.pdb";
+    QTest::newRow("2SN3") << "2SN3.pdb";
+    QTest::newRow("3CYT") << "3CYT.pdb";
+    QTest::newRow("alphabet") << "alphabet.pdb";
+    QTest::newRow("fmc") << "fmc.pdb";
+}
+
+void PdbReadingBenchmark::read()
+{
+    QFETCH(QString, fileNameString);
+
+    QByteArray fileName = fileNameString.toAscii();
+
+    QBENCHMARK {
+        chemkit::PolymerFile file(dataPath + fileName.constData());
+        bool ok = file.read();
+        if(!ok)
+            qDebug() << file.errorString().c_str();
+        QVERIFY(ok);
+    }
+}
+
+QTEST_APPLESS_MAIN(PdbReadingBenchmark)
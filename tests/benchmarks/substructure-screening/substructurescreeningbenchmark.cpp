@@ -0,0 +1,134 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+// This benchmark measures the throughput of substructure screening
+// as the number of threads matching molecules increases. Molecules
+// are split into batches which are matched on a thread pool sharing
+// a single query, in the same way as chemkit-grep's --threads option.
+
+#include "substructurescreeningbenchmark.h"
+
+#include <deque>
+
+#include <boost/bind.hpp>
+
+#include <chemkit/molecule.h>
+#include <chemkit/threadpool.h>
+#include <chemkit/moleculefile.h>
+#include <chemkit/substructurequery.h>
+
+const std::string dataPath = "../../data/";
+
+typedef std::vector<boost::shared_ptr<chemkit::Molecule> > MoleculeBatch;
+
+// number of times the data file is repeated
+const int copies = 25;
+
+// number of molecules matched by a thread at once
+const size_t batchSize = 64;
+
+namespace {
+
+size_t countMatches(const chemkit::SubstructureQuery *query, const MoleculeBatch &batch)
+{
+    size_t count = 0;
+
+    for(size_t i = 0; i < batch.size(); i++){
+        if(query->matches(batch[i].get())){
+            count++;
+        }
+    }
+
+    return count;
+}
+
+} // end anonymous namespace
+
+void SubstructureScreeningBenchmark::screen_data()
+{
+    QTest::addColumn<int>("threadCount");
+
+    QTest::newRow("1 thread") << 1;
+    QTest::newRow("2 threads") << 2;
+    QTest::newRow("4 threads") << 4;
+    QTest::newRow("8 threads") << 8;
+}
+
+void SubstructureScreeningBenchmark::screen()
+{
+    QFETCH(int, threadCount);
+
+    // load test file
+    chemkit::MoleculeFile file(dataPath + "pubchem_416_benzenes.sdf");
+    bool ok = file.read();
+    if(!ok)
+        qDebug() << file.errorString().c_str();
+    QVERIFY(ok);
+
+    // split copies of the molecules into batches
+    std::vector<MoleculeBatch> batches;
+    for(int i = 0; i < copies; i++){
+        foreach(const boost::shared_ptr<chemkit::Molecule> &molecule, file.molecules()){
+            if(batches.empty() || batches.back().size() == batchSize){
+                batches.push_back(MoleculeBatch());
+            }
+
+            // use a copy so that each molecule's lazily computed
+            // data is only touched by a single thread
+            batches.back().push_back(boost::shared_ptr<chemkit::Molecule>(new chemkit::Molecule(*molecule)));
+        }
+    }
+
+    // create query for benzene molecule
+    chemkit::SubstructureQuery query("1/C6H6/c1-2-4-6-5-3-1/h1-6H", "inchi");
+
+    chemkit::ThreadPool pool(threadCount);
+
+    QBENCHMARK {
+        std::deque<boost::shared_future<size_t> > counts;
+        foreach(const MoleculeBatch &batch, batches){
+            counts.push_back(pool.run(boost::bind(countMatches, &query, batch)));
+        }
+
+        size_t count = 0;
+        foreach(const boost::shared_future<size_t> &batchCount, counts){
+            count += batchCount.get();
+        }
+
+        QCOMPARE(count, size_t(412 * copies));
+    }
+}
+
+QTEST_APPLESS_MAIN(SubstructureScreeningBenchmark)
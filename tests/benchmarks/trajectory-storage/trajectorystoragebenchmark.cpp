@@ -0,0 +1,112 @@
+/******************************************************************************
+**
+** Copyright (C) 2009-2012 Kyle Lutz <kyle.r.lutz@gmail.com>
+** All rights reserved.
+**
+** This file is a part of the chemkit project. For more information
+** see <http://www.chemkit.org>.
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions
+** are met:
+**
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in the
+**     documentation and/or other materials provided with the distribution.
+**   * Neither the name of the chemkit project nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+**
+******************************************************************************/
+
+// This benchmark measures the memory used and the time taken to
+// read every position from a large trajectory stored in double and
+// single precision. The trajectory is made by repeating the frames
+// of spc216.xtc.
+
+#include "trajectorystoragebenchmark.h"
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#include <chemkit/trajectory.h>
+#include <chemkit/trajectoryframe.h>
+#include <chemkit/trajectoryfilereader.h>
+
+const std::string dataPath = "../../data/";
+
+namespace {
+
+// number of times to repeat the frames from the file
+const int CopyCount = 20;
+
+// returns the number of bytes currently allocated on the heap
+size_t allocatedMemory()
+{
+#if defined(__GLIBC__) && __GLIBC_PREREQ(2, 33)
+    return mallinfo2().uordblks;
+#else
+    return 0;
+#endif
+}
+
+void benchmark(chemkit::Trajectory::StorageMode mode)
+{
+    chemkit::TrajectoryFileReader reader;
+    reader.setIndexFileName("spc216.xtc.ckidx");
+    QVERIFY(reader.open(dataPath + "spc216.xtc"));
+
+    size_t memory = allocatedMemory();
+
+    chemkit::Trajectory trajectory;
+    trajectory.setStorageMode(mode);
+    for(int copy = 0; copy < CopyCount; copy++){
+        for(size_t i = 0; i < reader.frameCount(); i++){
+            QVERIFY(reader.readFrame(i, &trajectory));
+        }
+    }
+
+    qDebug() << "frames:" << trajectory.frameCount()
+             << "memory (MB):" << (allocatedMemory() - memory) / (1024.0 * 1024.0);
+
+    chemkit::Real sum = 0;
+    QBENCHMARK {
+        for(size_t i = 0; i < trajectory.frameCount(); i++){
+            const chemkit::TrajectoryFrame *frame = trajectory.frame(i);
+
+            for(size_t j = 0; j < frame->size(); j++){
+                sum += frame->position(j).x();
+            }
+        }
+    }
+    QVERIFY(sum != 0);
+}
+
+} // end anonymous namespace
+
+void TrajectoryStorageBenchmark::doublePrecision()
+{
+    benchmark(chemkit::Trajectory::DoublePrecision);
+}
+
+void TrajectoryStorageBenchmark::singlePrecision()
+{
+    benchmark(chemkit::Trajectory::SinglePrecision);
+}
+
+QTEST_APPLESS_MAIN(TrajectoryStorageBenchmark)
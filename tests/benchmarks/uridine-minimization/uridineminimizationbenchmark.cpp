@@ -35,12 +35,91 @@
 
 #include "uridineminimizationbenchmark.h"
 
+#include <boost/scoped_ptr.hpp>
+
 #include <chemkit/molecule.h>
+#include <chemkit/forcefield.h>
 #include <chemkit/moleculefile.h>
+#include <chemkit/lbfgsintegrator.h>
 #include <chemkit/moleculegeometryoptimizer.h>
+#include <chemkit/steepestdescentintegrator.h>
+#include <chemkit/conjugategradientintegrator.h>
 
 const std::string dataPath = "../../data/";
 
+namespace {
+
+// Potential which counts the number of energy and gradient
+// evaluations of a force field.
+class CountingPotential : public chemkit::Potential
+{
+public:
+    CountingPotential(chemkit::ForceField *forceField)
+        : m_forceField(forceField),
+          m_energyCount(0),
+          m_gradientCount(0)
+    {
+    }
+
+    size_t size() const
+    {
+        return m_forceField->size();
+    }
+
+    chemkit::Real energy(const chemkit::CartesianCoordinates *coordinates) const
+    {
+        m_energyCount++;
+        return m_forceField->energy(coordinates);
+    }
+
+    std::vector<chemkit::Vector3> gradient(const chemkit::CartesianCoordinates *coordinates) const
+    {
+        m_gradientCount++;
+        return m_forceField->gradient(coordinates);
+    }
+
+    size_t energyCount() const { return m_energyCount; }
+    size_t gradientCount() const { return m_gradientCount; }
+
+private:
+    chemkit::ForceField *m_forceField;
+    mutable size_t m_energyCount;
+    mutable size_t m_gradientCount;
+};
+
+// Minimizes uridine with integrator until the rmsg is below 0.1 and
+// prints the number of iterations and evaluations required.
+void minimize(chemkit::Integrator *integrator)
+{
+    boost::shared_ptr<chemkit::Molecule> molecule = chemkit::MoleculeFile::quickRead(dataPath + "uridine.mol2");
+    QVERIFY(molecule != 0);
+
+    boost::scoped_ptr<chemkit::ForceField> forceField(chemkit::ForceField::create("uff"));
+    QVERIFY(forceField != 0);
+    forceField->setTopologyFromMolecule(molecule.get());
+    QVERIFY(forceField->setup());
+
+    boost::shared_ptr<CountingPotential> potential(new CountingPotential(forceField.get()));
+    integrator->setPotential(potential);
+
+    size_t iterationCount = 0;
+
+    QBENCHMARK_ONCE {
+        integrator->setCoordinates(molecule->coordinates());
+
+        while(integrator->rmsg() >= 0.1){
+            integrator->integrate();
+            iterationCount++;
+        }
+    }
+
+    qDebug() << "iterations:" << iterationCount
+             << "energy evaluations:" << potential->energyCount()
+             << "gradient evaluations:" << potential->gradientCount();
+}
+
+} // end anonymous namespace
+
 void UridineMinimizationBenchmark::benchmark()
 {
     boost::shared_ptr<chemkit::Molecule> molecule = chemkit::MoleculeFile::quickRead(dataPath + "uridine.mol2");
@@ -65,4 +144,22 @@ void UridineMinimizationBenchmark::benchmark()
     }
 }
 
+void UridineMinimizationBenchmark::steepestDescent()
+{
+    chemkit::SteepestDescentIntegrator integrator;
+    minimize(&integrator);
+}
+
+void UridineMinimizationBenchmark::conjugateGradient()
+{
+    chemkit::ConjugateGradientIntegrator integrator;
+    minimize(&integrator);
+}
+
+void UridineMinimizationBenchmark::lbfgs()
+{
+    chemkit::LbfgsIntegrator integrator;
+    minimize(&integrator);
+}
+
 QTEST_APPLESS_MAIN(UridineMinimizationBenchmark)
@@ -44,6 +44,9 @@ class UridineMinimizationBenchmark : public QObject
 
     private slots:
         void benchmark();
+        void steepestDescent();
+        void conjugateGradient();
+        void lbfgs();
 };
 
 #endif // URIDINEMINIMIZATIONBENCHMARK_H